@@ -0,0 +1,157 @@
+/**
+ * @file    benchmark_math.cpp
+ * @brief   Compares the instruction sets used to evaluate compiled math.
+ * @author  Frank T. Bergmann
+ * 
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML.  Please visit http://sed-ml.org for more
+ * information about SED-ML, and the latest version of libSEDML.
+ *
+ * Copyright (c) 2013, Frank T. Bergmann  
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met: 
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer. 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <vector>
+#include <sedml/SedTypes.h>
+#include <sbml/math/L3Parser.h>
+
+using namespace std;
+LIBSEDML_CPP_NAMESPACE_USE
+LIBSBML_CPP_NAMESPACE_USE
+
+// data generator math exercising arithmetic, exp/log/pow and piecewise
+static const char* FORMULAS[] =
+{
+  "x * y + 2 * x - y / 3",
+  "exp(-x / 10) * y^2.5 + ln(y)",
+  "piecewise(x * y, x > y, x - y)",
+  "piecewise(exp(-x / 10) * y^2.5, x >= y && y > 0, ln(abs(x) + 1)) "
+  "- max(x, y) / (1 + x^2)"
+};
+
+int
+main (int argc, char* argv[])
+{
+  unsigned int count = 1000000;
+  if (argc > 1)
+  {
+    count = (unsigned int)atoi(argv[1]);
+  }
+  if (count == 0)
+  {
+    cout << endl << "Usage: benchmark_math [number-of-points]"
+         << endl << endl;
+    return 2;
+  }
+
+  // the columns of two variables, as a simulation would report them
+  vector<double> x(count);
+  vector<double> y(count);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    x[i] = sin(0.001 * i) * 50.0;
+    y[i] = cos(0.002 * i) * 40.0 + 50.0;
+  }
+  const double* inputs[] = { &x[0], &y[0] };
+
+  vector<string> names;
+  names.push_back("x");
+  names.push_back("y");
+
+  vector<string> sets = SedCompiledMath::getInstructionSets();
+  vector<double> expected(count);
+  vector<double> result(count);
+
+  cout << "points          = " << count << endl;
+  cout << "instruction set = " << SedCompiledMath::getInstructionSet()
+       << endl;
+
+  for (size_t f = 0; f < sizeof(FORMULAS) / sizeof(FORMULAS[0]); ++f)
+  {
+    ASTNode* math = SBML_parseL3Formula(FORMULAS[f]);
+    SedCompiledMath program;
+    if (program.compile(math, names) != LIBSEDML_OPERATION_SUCCESS)
+    {
+      cerr << "could not compile " << FORMULAS[f] << endl;
+      delete math;
+      return 1;
+    }
+
+    cout << endl << FORMULAS[f] << endl;
+
+    double scalarTime = 0;
+    for (size_t s = 0; s < sets.size(); ++s)
+    {
+      SedCompiledMath::setInstructionSet(sets[s]);
+      vector<double>& out = s == 0 ? expected : result;
+
+      // the best of a few runs, to keep other processes out of the timing
+      double best = 0;
+      for (int run = 0; run < 5; ++run)
+      {
+        clock_t start = clock();
+        program.evaluate(inputs, count, &out[0]);
+        double ms = 1000.0 * (clock() - start) / CLOCKS_PER_SEC;
+        if (run == 0 || ms < best)
+        {
+          best = ms;
+        }
+      }
+
+      double error = 0;
+      for (unsigned int i = 0; s != 0 && i < count; ++i)
+      {
+        double scale = fabs(expected[i]) > 1.0 ? fabs(expected[i]) : 1.0;
+        double diff = fabs(out[i] - expected[i]) / scale;
+        if (diff > error)
+        {
+          error = diff;
+        }
+      }
+
+      if (s == 0)
+      {
+        scalarTime = best;
+      }
+
+      cout << "  " << sets[s] << ": " << best << " ms";
+      if (s != 0)
+      {
+        cout << ", speedup = " << scalarTime / best
+             << ", max relative error = " << error;
+      }
+      cout << endl;
+    }
+
+    delete math;
+  }
+
+  SedCompiledMath::setInstructionSet("");
+  return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file    benchmark_memory.cpp
+ * @brief   Reports the size, heap use and allocation cost of SED-ML objects.
+ * @author  Frank T. Bergmann
+ * 
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML.  Please visit http://sed-ml.org for more
+ * information about SED-ML, and the latest version of libSEDML.
+ *
+ * Copyright (c) 2013, Frank T. Bergmann  
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met: 
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer. 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <new>
+#include <sedml/SedTypes.h>
+
+using namespace std;
+LIBSEDML_CPP_NAMESPACE_USE
+
+// bytes currently allocated through operator new, and the number of calls
+static size_t sAllocatedBytes = 0;
+static size_t sAllocations = 0;
+
+void* operator new (size_t size)
+{
+  // keep the size in front of the block, so that delete can subtract it
+  size_t* block = static_cast<size_t*>(malloc(size + sizeof(size_t) * 2));
+  if (block == NULL) throw std::bad_alloc();
+  block[0] = size;
+  sAllocatedBytes += size;
+  ++sAllocations;
+  return block + 2;
+}
+
+void operator delete (void* ptr) throw()
+{
+  if (ptr == NULL) return;
+  size_t* block = static_cast<size_t*>(ptr) - 2;
+  sAllocatedBytes -= block[0];
+  free(block);
+}
+
+void* operator new[] (size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete[] (void* ptr) throw()
+{
+  operator delete(ptr);
+}
+
+int
+main (int argc, char* argv[])
+{
+  unsigned int count = 100000;
+  if (argc > 1)
+  {
+    count = (unsigned int)atoi(argv[1]);
+  }
+  if (count == 0)
+  {
+    cout << endl << "Usage: benchmark_memory [number-of-variables]"
+         << endl << endl;
+    return 2;
+  }
+
+  cout << "sizeof(SedBase)        = " << sizeof(SedBase) << endl;
+  cout << "sizeof(SedVariable)    = " << sizeof(SedVariable) << endl;
+  cout << "sizeof(SedSetValue)    = " << sizeof(SedSetValue) << endl;
+  cout << "sizeof(SedDataSet)     = " << sizeof(SedDataSet) << endl;
+
+  // the same objects, allocated one by one and from the document's arena
+  for (int arena = 0; arena < 2; ++arena)
+  {
+    SedDocument* doc = new SedDocument(1, 4);
+    doc->setArenaAllocation(arena != 0);
+    SedDataGenerator* generator = doc->createDataGenerator();
+    generator->setId("dg");
+
+    size_t bytesBefore = sAllocatedBytes;
+    size_t callsBefore = sAllocations;
+    clock_t start = clock();
+
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      SedVariable* variable = generator->createVariable();
+      variable->setTarget("/sbml:sbml/sbml:model");
+      variable->setTaskReference("task1");
+    }
+
+    clock_t created = clock();
+    size_t bytes = sAllocatedBytes - bytesBefore;
+    size_t calls = sAllocations - callsBefore;
+
+    delete doc;
+    clock_t deleted = clock();
+
+    cout << endl << (arena ? "arena allocation" : "heap allocation") << endl;
+    cout << "variables created      = " << count << endl;
+    cout << "heap bytes / variable  = " << (double)bytes / count << endl;
+    cout << "allocations / variable = " << (double)calls / count << endl;
+    cout << "create time            = "
+         << 1000.0 * (created - start) / CLOCKS_PER_SEC << " ms" << endl;
+    cout << "delete time            = "
+         << 1000.0 * (deleted - created) / CLOCKS_PER_SEC << " ms" << endl;
+  }
+
+  return 0;
+}
@@ -35,6 +35,7 @@
 
 %module(directors="1") libsedml
 %feature("director") SedElementFilter;
+%feature("director") SedReaderHandler;
 
 %pragma(java) moduleclassmodifiers="
 /**
@@ -114,6 +115,36 @@ LIBNUML_CPP_NAMESPACE_USE
  */
 %ignore *::accept;
 
+/**
+ * Ignore the raw-buffer overloads of SedNumberFormat and SedVectorRange.
+ */
+%ignore SedNumberFormat::parseDouble(const char*, const char*, double&);
+%ignore SedNumberFormat::formatDouble(double, char*);
+%ignore SedVectorRange::getValuesData;
+%ignore SedVectorRange::setValues(const double*, size_t);
+
+/**
+ * Ignore the arena allocation internals; the bindings only need
+ * SedDocument/SedReader::setArenaAllocation().
+ */
+%ignore SedBase::operator new;
+%ignore SedBase::operator delete;
+%ignore SedDocument::getArena;
+
+/**
+ * Ignore the hook SedFrozenDocument uses to compute lazily built state, and
+ * the reference graph, which is not wrapped.
+ */
+%ignore *::prepareForConcurrentReads;
+%ignore SedFrozenDocument::getReferenceGraph;
+
+/**
+ * Ignore the binary serialization hooks used by SedBinaryReader and
+ * SedBinaryWriter.
+ */
+%ignore *::writeBinary;
+%ignore *::readBinary;
+
 /**
  * Ignore internal implementation methods in ASTNode.h
  */
@@ -232,12 +263,18 @@ LIBNUML_CPP_NAMESPACE_USE
 
 %newobject *::clone;
 %newobject SedBase::toSed;
+%newobject SedDocument::freeze;
 %newobject SedReader::readSedMLFromString;
+%newobject SedReader::readSedMLFromBuffer;
 %newobject SedReader::readSedMLFromFile;
 %newobject SedReader::readSedML;
 %newobject readSedML(const char *);
 %newobject readSedMLFromString(const char *);
 %newobject readSedMLFromFile(const char *);
+%newobject SedBinaryReader::readSedML;
+%newobject readSedMLFromBinaryFile(const char *);
+%newobject SedDocumentCache::readSedMLFromFile;
+%newobject SedDocumentCache::readSedMLFromString;
 %newobject SedWriter::writeToString;
 %newobject writeSedMLToString;
 %newobject readMathMLFromString;
@@ -325,9 +362,14 @@ typedef std::vector<double> DoubleStdVector;
 typedef std::vector<XMLError*> XmlErrorStdVector;
 %template(SedErrorStdVector) std::vector<SedError>;
 typedef std::vector<SedError> SedErrorStdVector;
+%template(SedDocumentStdVector) std::vector<SedDocument*>;
+typedef std::vector<SedDocument*> SedDocumentStdVector;
+%template(StringStdVector) std::vector<std::string>;
+typedef std::vector<std::string> StringStdVector;
 
 %include sedml/common/libsedml-version.h
 %include sedml/common/SedOperationReturnValues.h
+%include sedml/common/SedNumberFormat.h
 %include sbml/common/libsbml-version.h
 %include sbml/common/operationReturnValues.h
 
@@ -337,14 +379,20 @@ typedef std::vector<SedError> SedErrorStdVector;
 
 
 
+%include <sedml/SedReaderHandler.h>
 %include <sedml/SedReader.h>
 %include <sedml/SedWriter.h>
+%include <sedml/SedBinaryReader.h>
+%include <sedml/SedBinaryWriter.h>
+%include <sedml/SedDocumentCache.h>
 %include <sedml/SedTypeCodes.h>
 %include <sedml/SedTypes.h>
+%include <sedml/SedMemoryUsage.h>
 %include <sedml/SedBase.h>
 %include <sedml/SedElementFilter.h>
 %include <sedml/SedListOf.h>
 %include <sedml/SedDocument.h>
+%include <sedml/SedFrozenDocument.h>
 %include <sedml/SedErrorLog.h>
 %include <sedml/SedError.h>
 
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedAbstractCurve.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfCurves.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -67,7 +68,6 @@ SedAbstractCurve::SedAbstractCurve(unsigned int level, unsigned int version)
   , mXDataReference ("")
   , mElementName("abstractCurve")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mNameAllowedPreV4 = true;
   mIdAllowedPreV4 = true;
 }
@@ -77,7 +77,7 @@ SedAbstractCurve::SedAbstractCurve(unsigned int level, unsigned int version)
  * Creates a new SedAbstractCurve using the given SedNamespaces object @p
  * sedmlns.
  */
-SedAbstractCurve::SedAbstractCurve(SedNamespaces *sedmlns)
+SedAbstractCurve::SedAbstractCurve(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mLogX (false)
   , mIsSetLogX (false)
@@ -111,6 +111,23 @@ SedAbstractCurve::SedAbstractCurve(const SedAbstractCurve& orig)
 }
 
 
+/*
+ * Move constructor for SedAbstractCurve.
+ */
+SedAbstractCurve::SedAbstractCurve(SedAbstractCurve&& orig)
+  : SedBase( std::move(orig) )
+  , mLogX ( std::move(orig.mLogX) )
+  , mIsSetLogX ( std::move(orig.mIsSetLogX) )
+  , mOrder ( std::move(orig.mOrder) )
+  , mIsSetOrder ( std::move(orig.mIsSetOrder) )
+  , mStyle ( std::move(orig.mStyle) )
+  , mYAxis ( std::move(orig.mYAxis) )
+  , mXDataReference ( std::move(orig.mXDataReference) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
 /*
  * Assignment operator for SedAbstractCurve.
  */
@@ -134,6 +151,29 @@ SedAbstractCurve::operator=(const SedAbstractCurve& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedAbstractCurve.
+ */
+SedAbstractCurve&
+SedAbstractCurve::operator=(SedAbstractCurve&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mLogX = std::move(rhs.mLogX);
+    mIsSetLogX = std::move(rhs.mIsSetLogX);
+    mOrder = std::move(rhs.mOrder);
+    mIsSetOrder = std::move(rhs.mIsSetOrder);
+    mStyle = std::move(rhs.mStyle);
+    mYAxis = std::move(rhs.mYAxis);
+    mXDataReference = std::move(rhs.mXDataReference);
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAbstractCurve object.
  */
@@ -499,6 +539,87 @@ SedAbstractCurve::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedAbstractCurve object to @p refs.
+ */
+void
+SedAbstractCurve::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetStyle())
+  {
+    refs.push_back(std::make_pair(std::string("style"), mStyle));
+  }
+
+  if (isSetXDataReference())
+  {
+    refs.push_back(std::make_pair(std::string("xDataReference"),
+      mXDataReference));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedAbstractCurve object to @p usage.
+ */
+void
+SedAbstractCurve::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedAbstractCurve) - sizeof(SedBase));
+  usage.addString(type, mStyle);
+  usage.addString(type, mYAxis);
+  usage.addString(type, mXDataReference);
+  usage.addString(type, mElementName);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedAbstractCurve object to @p
+ * stream.
+ */
+void
+SedAbstractCurve::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeBool(mLogX);
+  stream.writeBool(mIsSetLogX);
+  stream.writeInt(mOrder);
+  stream.writeBool(mIsSetOrder);
+  stream.writeString(mStyle);
+  stream.writeString(mYAxis);
+  stream.writeString(mXDataReference);
+  stream.writeString(mElementName);
+}
+
+
+/*
+ * Reads the attributes and children of this SedAbstractCurve object from @p
+ * stream.
+ */
+void
+SedAbstractCurve::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  mLogX = stream.readBool();
+  mIsSetLogX = stream.readBool();
+  mOrder = static_cast<int>(stream.readInt());
+  mIsSetOrder = stream.readBool();
+  stream.readString(mStyle);
+  stream.readString(mYAxis);
+  stream.readString(mXDataReference);
+  stream.readString(mElementName);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedAbstractCurve object.
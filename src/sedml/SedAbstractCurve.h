@@ -103,7 +103,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedAbstractCurve(SedNamespaces *sedmlns);
+  SedAbstractCurve(const SedNamespaces *sedmlns);
 
 
   /**
@@ -123,6 +123,28 @@ public:
   SedAbstractCurve& operator=(const SedAbstractCurve& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedAbstractCurve.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedAbstractCurve instance to move from.
+   */
+  SedAbstractCurve(SedAbstractCurve&& orig);
+
+
+  /**
+   * Move assignment operator for SedAbstractCurve.
+   *
+   * @param rhs the SedAbstractCurve object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedAbstractCurve& operator=(SedAbstractCurve&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAbstractCurve object.
    *
@@ -378,6 +400,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedAbstractCurve object.
    *
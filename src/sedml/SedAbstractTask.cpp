@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedAbstractTask.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfTasks.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -62,7 +63,6 @@ SedAbstractTask::SedAbstractTask(unsigned int level, unsigned int version)
 {
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -70,7 +70,7 @@ SedAbstractTask::SedAbstractTask(unsigned int level, unsigned int version)
  * Creates a new SedAbstractTask using the given SedNamespaces object @p
  * sedmlns.
  */
-SedAbstractTask::SedAbstractTask(SedNamespaces *sedmlns)
+SedAbstractTask::SedAbstractTask(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mElementName("task")
 {
@@ -90,6 +90,16 @@ SedAbstractTask::SedAbstractTask(const SedAbstractTask& orig)
 }
 
 
+/*
+ * Move constructor for SedAbstractTask.
+ */
+SedAbstractTask::SedAbstractTask(SedAbstractTask&& orig)
+  : SedBase( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
 /*
  * Assignment operator for SedAbstractTask.
  */
@@ -106,6 +116,22 @@ SedAbstractTask::operator=(const SedAbstractTask& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedAbstractTask.
+ */
+SedAbstractTask&
+SedAbstractTask::operator=(SedAbstractTask&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAbstractTask object.
  */
@@ -157,6 +183,51 @@ SedAbstractTask::isSedParameterEstimationTask() const
 }
 
 
+/*
+ * Adds the memory held by this SedAbstractTask object to @p usage.
+ */
+void
+SedAbstractTask::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedAbstractTask) - sizeof(SedBase));
+  usage.addString(type, mElementName);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedAbstractTask object to @p
+ * stream.
+ */
+void
+SedAbstractTask::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mElementName);
+}
+
+
+/*
+ * Reads the attributes and children of this SedAbstractTask object from @p
+ * stream.
+ */
+void
+SedAbstractTask::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mElementName);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedAbstractTask object.
  */
@@ -97,7 +97,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedAbstractTask(SedNamespaces *sedmlns);
+  SedAbstractTask(const SedNamespaces *sedmlns);
 
 
   /**
@@ -117,6 +117,28 @@ public:
   SedAbstractTask& operator=(const SedAbstractTask& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedAbstractTask.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedAbstractTask instance to move from.
+   */
+  SedAbstractTask(SedAbstractTask&& orig);
+
+
+  /**
+   * Move assignment operator for SedAbstractTask.
+   *
+   * @param rhs the SedAbstractTask object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedAbstractTask& operator=(SedAbstractTask&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAbstractTask object.
    *
@@ -162,6 +184,28 @@ public:
   virtual bool isSedParameterEstimationTask() const;
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedAbstractTask object.
    *
@@ -32,6 +32,8 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedAddXML.h>
+#include <sedml/SedBinaryStream.h>
+#include <sedml/SedReader.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -54,7 +56,6 @@ SedAddXML::SedAddXML(unsigned int level, unsigned int version)
   : SedChange(level, version)
   , mNewXML (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -62,7 +63,7 @@ SedAddXML::SedAddXML(unsigned int level, unsigned int version)
 /*
  * Creates a new SedAddXML using the given SedNamespaces object @p sedmlns.
  */
-SedAddXML::SedAddXML(SedNamespaces *sedmlns)
+SedAddXML::SedAddXML(const SedNamespaces *sedmlns)
   : SedChange(sedmlns)
   , mNewXML (NULL)
 {
@@ -77,6 +78,7 @@ SedAddXML::SedAddXML(SedNamespaces *sedmlns)
 SedAddXML::SedAddXML(const SedAddXML& orig)
   : SedChange( orig )
   , mNewXML ( NULL )
+  , mRawNewXML ( orig.mRawNewXML )
 {
   if (orig.mNewXML != NULL)
   {
@@ -87,6 +89,20 @@ SedAddXML::SedAddXML(const SedAddXML& orig)
 }
 
 
+/*
+ * Move constructor for SedAddXML.
+ */
+SedAddXML::SedAddXML(SedAddXML&& orig)
+  : SedChange( std::move(orig) )
+  , mNewXML ( orig.mNewXML )
+  , mRawNewXML ( std::move(orig.mRawNewXML) )
+{
+  orig.mNewXML = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedAddXML.
  */
@@ -106,6 +122,29 @@ SedAddXML::operator=(const SedAddXML& rhs)
       mNewXML = NULL;
     }
 
+    mRawNewXML = rhs.mRawNewXML;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+/*
+ * Move assignment operator for SedAddXML.
+ */
+SedAddXML&
+SedAddXML::operator=(SedAddXML&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedChange::operator=(std::move(rhs));
+    mRawNewXML = std::move(rhs.mRawNewXML);
+    delete mNewXML;
+    mNewXML = rhs.mNewXML;
+    rhs.mNewXML = NULL;
+
     connectToChild();
   }
 
@@ -139,6 +178,7 @@ SedAddXML::~SedAddXML()
 const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedAddXML::getNewXML() const
 {
+  parseRawNewXML();
   return mNewXML;
 }
 
@@ -149,6 +189,7 @@ SedAddXML::getNewXML() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedAddXML::getNewXML()
 {
+  parseRawNewXML();
   return mNewXML;
 }
 
@@ -159,7 +200,7 @@ SedAddXML::getNewXML()
 bool
 SedAddXML::isSetNewXML() const
 {
-  return (mNewXML != NULL);
+  return (mNewXML != NULL || !mRawNewXML.empty());
 }
 
 
@@ -169,6 +210,8 @@ SedAddXML::isSetNewXML() const
 int
 SedAddXML::setNewXML(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* newXML)
 {
+  mRawNewXML.clear();
+
   if (mNewXML == newXML)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -194,12 +237,74 @@ SedAddXML::setNewXML(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* newXML)
 int
 SedAddXML::unsetNewXML()
 {
+  mRawNewXML.clear();
   delete mNewXML;
   mNewXML = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
 
+/*
+ * Adds the memory held by this SedAddXML object to @p usage.
+ */
+void
+SedAddXML::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedChange::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedAddXML) - sizeof(SedChange));
+  usage.addXML(type, mNewXML);
+  usage.addString(type, mRawNewXML);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Also parses the "newXML" element if it is still kept as markup.
+ */
+void
+SedAddXML::prepareForConcurrentReads() const
+{
+  SedChange::prepareForConcurrentReads();
+  parseRawNewXML();
+}
+
+/** @endcond */
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedAddXML object to @p stream.
+ */
+void
+SedAddXML::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedChange::writeBinary(stream);
+
+  stream.writeXML(mRawNewXML, mNewXML);
+}
+
+
+/*
+ * Reads the attributes and children of this SedAddXML object from @p stream.
+ */
+void
+SedAddXML::readBinary(SedBinaryInputStream& stream)
+{
+  SedChange::readBinary(stream);
+
+  delete mNewXML;
+  mNewXML = NULL;
+  stream.readXML(mRawNewXML, mNewXML);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedAddXML object.
  */
@@ -266,9 +371,17 @@ SedAddXML::writeElements(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 
   if (isSetNewXML() == true)
   {
-    stream.startElement("newXML");
-    stream << *mNewXML;
-    stream.endElement("newXML");
+    if (!mRawNewXML.empty())
+    {
+      // written back unchanged as long as it has not been accessed
+      writeRawXML(stream, mRawNewXML);
+    }
+    else
+    {
+      stream.startElement("newXML");
+      stream << *mNewXML;
+      stream.endElement("newXML");
+    }
   }
 }
 
@@ -615,81 +728,144 @@ SedAddXML::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
 {
   bool read = false;
   const string& name = stream.peek().getName();
-  std::string newElementText;
 
   if (name == "newXML")
   {
-    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken& token = stream.next();
-
-    while (stream.isGood() && stream.peek().isText())
+    // keep the markup and only build the XMLNode tree when it is accessed;
+    // a payload without any content leaves "newXML" unset
+    delete mNewXML;
+    mNewXML = NULL;
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode outline;
+    mRawNewXML = readRawXML(stream, &outline);
+    if (outline.getNumChildren() == 0)
     {
-      newElementText += stream.next().getCharacters();
+      mRawNewXML.clear();
     }
-    newElementText = _trim(newElementText);
 
-    delete mNewXML;
-    mNewXML = NULL;
+    read = true;
+  }
 
-    while (stream.isGood())
-    {
-      const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken& next = stream.peek();
-      if (!stream.isGood()) break;
+  if (SedChange::readOtherXML(stream))
+  {
+    read = true;
+  }
 
-      if (next.isEndFor(token))
-      {
-        stream.next();
-        break;
-      }
-      else if (next.isStart())
-      {
-        if (mNewXML == NULL)
-        {
-          mNewXML = new
-            LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode();
+  return read;
+}
 
-          if (!newElementText.empty())
-            mNewXML->addChild(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(newElementText));
-        }
+/** @endcond */
 
-        mNewXML->addChild(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream));
-      }
-      else if (next.isText())
-      {
-        std::string s = _trim(next.getCharacters());
 
-        if (s != "" && mNewXML != NULL)
-          mNewXML->addChild(stream.next());
-        else
-          stream.skipText();
-      }
-      else
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Builds mNewXML from the content of the "newXML" element on the stream
+ */
+void
+SedAddXML::readNewXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream) const
+{
+  std::string newElementText;
+  const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken& token = stream.next();
+
+  while (stream.isGood() && stream.peek().isText())
+  {
+    newElementText += stream.next().getCharacters();
+  }
+  newElementText = _trim(newElementText);
+
+  delete mNewXML;
+  mNewXML = NULL;
+
+  while (stream.isGood())
+  {
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken& next = stream.peek();
+    if (!stream.isGood()) break;
+
+    if (next.isEndFor(token))
+    {
+      stream.next();
+      break;
+    }
+    else if (next.isStart())
+    {
+      if (mNewXML == NULL)
       {
-        stream.skipPastEnd(stream.next());
+        mNewXML = new
+          LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode();
+
+        if (!newElementText.empty())
+          mNewXML->addChild(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(newElementText));
       }
+
+      mNewXML->addChild(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream));
     }
+    else if (next.isText())
+    {
+      std::string s = _trim(next.getCharacters());
 
-    if (mNewXML != NULL && mNewXML->getNumChildren() == 1)
+      if (s != "" && mNewXML != NULL)
+        mNewXML->addChild(stream.next());
+      else
+        stream.skipText();
+    }
+    else
     {
-      // for convenience if we have just one element hide the nesting
-      LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* copy = new
-        LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(mNewXML->getChild(0));
-      delete mNewXML;
-      mNewXML = copy;
+      stream.skipPastEnd(stream.next());
     }
+  }
 
-    if (mNewXML == NULL && !newElementText.empty())
-      mNewXML = new
-      LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(newElementText);
+  if (mNewXML != NULL && mNewXML->getNumChildren() == 1)
+  {
+    // for convenience if we have just one element hide the nesting
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* copy = new
+      LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(mNewXML->getChild(0));
+    delete mNewXML;
+    mNewXML = copy;
+  }
 
-    read = true;
+  if (mNewXML == NULL && !newElementText.empty())
+    mNewXML = new
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(newElementText);
+}
+
+
+/*
+ * Builds mNewXML from the markup kept by readOtherXML()
+ */
+void
+SedAddXML::parseRawNewXML() const
+{
+  if (mRawNewXML.empty())
+  {
+    return;
   }
 
-  if (SedChange::readOtherXML(stream))
+  const std::string wrapped = wrapRawXML(mRawNewXML);
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream stream(wrapped.c_str(), false);
+  stream.next();
+  readNewXML(stream);
+  mRawNewXML.clear();
+}
+
+/** @endcond */
+
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Skips the "newXML" element when excluded by the load mask
+ */
+bool
+SedAddXML::isSkippedOnRead(const std::string& name) const
+{
+  if (name == "newXML")
   {
-    read = true;
+    return !isLoadedOnRead(SEDML_LOAD_XML_PAYLOADS);
   }
 
-  return read;
+  return SedChange::isSkippedOnRead(name);
 }
 
 /** @endcond */
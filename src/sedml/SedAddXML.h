@@ -64,7 +64,10 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* mNewXML;
+  mutable LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* mNewXML;
+
+  // "newXML" as read, kept as markup until first accessed
+  mutable std::string mRawNewXML;
 
   /** @endcond */
 
@@ -92,7 +95,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedAddXML(SedNamespaces *sedmlns);
+  SedAddXML(const SedNamespaces *sedmlns);
 
 
   /**
@@ -112,6 +115,28 @@ public:
   SedAddXML& operator=(const SedAddXML& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedAddXML.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedAddXML instance to move from.
+   */
+  SedAddXML(SedAddXML&& orig);
+
+
+  /**
+   * Move assignment operator for SedAddXML.
+   *
+   * @param rhs the SedAddXML object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedAddXML& operator=(SedAddXML&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAddXML object.
    *
@@ -177,6 +202,38 @@ public:
   int unsetNewXML();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::prepareForConcurrentReads
+   */
+  virtual void prepareForConcurrentReads() const;
+
+  /** @endcond */
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedAddXML object.
    *
@@ -565,6 +622,34 @@ protected:
 
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Builds mNewXML from the content of the "newXML" element on the stream
+   */
+  void readNewXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream) const;
+
+
+  /**
+   * Builds mNewXML from the markup kept by readOtherXML()
+   */
+  void parseRawNewXML() const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Skips the "newXML" element when excluded by the load mask
+   */
+  virtual bool isSkippedOnRead(const std::string& name) const;
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibSEDMLInternal */
 
   /**
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedAdjustableParameter.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfAdjustableParameters.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -62,7 +63,6 @@ SedAdjustableParameter::SedAdjustableParameter(unsigned int level,
   , mModelReference ("")
   , mTarget ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -71,7 +71,7 @@ SedAdjustableParameter::SedAdjustableParameter(unsigned int level,
  * Creates a new SedAdjustableParameter using the given SedNamespaces object @p
  * sedmlns.
  */
-SedAdjustableParameter::SedAdjustableParameter(SedNamespaces *sedmlns)
+SedAdjustableParameter::SedAdjustableParameter(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mInitialValue (util_NaN())
   , mIsSetInitialValue (false)
@@ -107,6 +107,24 @@ SedAdjustableParameter::SedAdjustableParameter(const SedAdjustableParameter&
 }
 
 
+/*
+ * Move constructor for SedAdjustableParameter.
+ */
+SedAdjustableParameter::SedAdjustableParameter(SedAdjustableParameter&& orig)
+  : SedBase( std::move(orig) )
+  , mInitialValue ( std::move(orig.mInitialValue) )
+  , mIsSetInitialValue ( std::move(orig.mIsSetInitialValue) )
+  , mBounds ( orig.mBounds )
+  , mExperimentReferences ( std::move(orig.mExperimentReferences) )
+  , mModelReference ( std::move(orig.mModelReference) )
+  , mTarget ( std::move(orig.mTarget) )
+{
+  orig.mBounds = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedAdjustableParameter.
  */
@@ -138,6 +156,31 @@ SedAdjustableParameter::operator=(const SedAdjustableParameter& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedAdjustableParameter.
+ */
+SedAdjustableParameter&
+SedAdjustableParameter::operator=(SedAdjustableParameter&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mInitialValue = std::move(rhs.mInitialValue);
+    mIsSetInitialValue = std::move(rhs.mIsSetInitialValue);
+    mExperimentReferences = std::move(rhs.mExperimentReferences);
+    mModelReference = std::move(rhs.mModelReference);
+    mTarget = std::move(rhs.mTarget);
+    delete mBounds;
+    mBounds = rhs.mBounds;
+    rhs.mBounds = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAdjustableParameter object.
  */
@@ -399,7 +442,7 @@ SedAdjustableParameter::createBounds()
     delete mBounds;
   }
 
-  mBounds = new SedBounds(getSedNamespaces());
+  mBounds = new (getSedArena()) SedBounds(getSedNamespaces());
 
   connectToChild();
 
@@ -516,6 +559,47 @@ SedAdjustableParameter::addExperimentReference(const SedExperimentReference* ser
 }
 
 
+/*
+ * Adds the given SedExperimentReference to this SedAdjustableParameter,
+ * which takes ownership of it.
+ */
+int
+SedAdjustableParameter::addExperimentReference(std::unique_ptr<SedExperimentReference> ser)
+{
+  if (!ser)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ser->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ser.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ser->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ser->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ser->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ser.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return mExperimentReferences.appendAndOwn(std::move(ser));
+  }
+}
+
+
 /*
  * Get the number of SedExperimentReference objects in this SedAdjustableParameter.
  */
@@ -538,7 +622,7 @@ SedAdjustableParameter::createExperimentReference()
 
   try
   {
-    ser = new SedExperimentReference(getSedNamespaces());
+    ser = new (getSedArena()) SedExperimentReference(getSedNamespaces());
   }
   catch (...)
   {
@@ -577,6 +661,83 @@ SedAdjustableParameter::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedAdjustableParameter object to @p refs.
+ */
+void
+SedAdjustableParameter::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetModelReference())
+  {
+    refs.push_back(std::make_pair(std::string("modelReference"),
+      mModelReference));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedAdjustableParameter object to @p usage.
+ */
+void
+SedAdjustableParameter::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedAdjustableParameter) - sizeof(SedBase) -
+    sizeof(SedListOfExperimentReferences));
+  usage.addString(type, mModelReference);
+  usage.addString(type, mTarget);
+
+  if (mExperimentReferences.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mExperimentReferences.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedAdjustableParameter object to
+ * @p stream.
+ */
+void
+SedAdjustableParameter::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeDouble(mInitialValue);
+  stream.writeBool(mIsSetInitialValue);
+  stream.writeObject(mBounds);
+  mExperimentReferences.writeBinary(stream);
+  stream.writeString(mModelReference);
+  stream.writeString(mTarget);
+}
+
+
+/*
+ * Reads the attributes and children of this SedAdjustableParameter object from
+ * @p stream.
+ */
+void
+SedAdjustableParameter::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  mInitialValue = stream.readDouble();
+  mIsSetInitialValue = stream.readBool();
+  stream.readObject(mBounds, this);
+  mExperimentReferences.readBinary(stream);
+  stream.readString(mModelReference);
+  stream.readString(mTarget);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedAdjustableParameter object.
@@ -1229,7 +1390,7 @@ SedAdjustableParameter::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
     }
 
     delete mBounds;
-    mBounds = new SedBounds(getSedNamespaces());
+    mBounds = new (getSedArena()) SedBounds(getSedNamespaces());
     obj = mBounds;
   }
   else if (name == "listOfExperimentReferences")
@@ -1351,7 +1512,9 @@ SedAdjustableParameter::readAttributes(
   // modelReference SIdRef (use = "optional" )
   // 
 
-  assigned = attributes.readInto("modelReference", mModelReference);
+  std::string modelReference;
+  assigned = attributes.readInto("modelReference", modelReference);
+  mModelReference = modelReference;
 
   if (assigned == true)
   {
@@ -1369,8 +1532,8 @@ SedAdjustableParameter::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mModelReference + "', which does not conform to the "
-        "syntax.";
+      msg += " is '" + mModelReference.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlAdjustableParameterModelReferenceMustBeModel, level,
         version, msg);
     }
@@ -1380,7 +1543,9 @@ SedAdjustableParameter::readAttributes(
   // target string (use = "optional" )
   // 
 
-  assigned = attributes.readInto("target", mTarget);
+  std::string target;
+  assigned = attributes.readInto("target", target);
+  mTarget = target;
 
   if (assigned == true)
   {
@@ -53,6 +53,7 @@
 #include <sedml/SedBase.h>
 #include <sedml/SedBounds.h>
 #include <sedml/SedListOfExperimentReferences.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -69,8 +70,8 @@ protected:
   bool mIsSetInitialValue;
   SedBounds* mBounds;
   SedListOfExperimentReferences mExperimentReferences;
-  std::string mModelReference;
-  std::string mTarget;
+  SedInternedString mModelReference;
+  SedInternedString mTarget;
 
   /** @endcond */
 
@@ -100,7 +101,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedAdjustableParameter(SedNamespaces *sedmlns);
+  SedAdjustableParameter(const SedNamespaces *sedmlns);
 
 
   /**
@@ -120,6 +121,28 @@ public:
   SedAdjustableParameter& operator=(const SedAdjustableParameter& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedAdjustableParameter.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedAdjustableParameter instance to move from.
+   */
+  SedAdjustableParameter(SedAdjustableParameter&& orig);
+
+
+  /**
+   * Move assignment operator for SedAdjustableParameter.
+   *
+   * @param rhs the SedAdjustableParameter object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedAdjustableParameter& operator=(SedAdjustableParameter&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAdjustableParameter object.
    *
@@ -467,6 +490,28 @@ public:
   int addExperimentReference(const SedExperimentReference* ser);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedExperimentReference to this SedAdjustableParameter without copying it.
+   *
+   * @param ser the SedExperimentReference object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addExperimentReference(const SedExperimentReference* ser)
+   */
+  int addExperimentReference(std::unique_ptr<SedExperimentReference> ser);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedExperimentReference objects in this SedAdjustableParameter.
    *
@@ -531,6 +576,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedAdjustableParameter object.
    *
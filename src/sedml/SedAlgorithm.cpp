@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedAlgorithm.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 #include <map>
@@ -43,7 +44,7 @@ using namespace std;
 
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
-extern map<int, string> g_kisaomap;
+extern const map<int, string> g_kisaomap;
 
 
 
@@ -59,7 +60,6 @@ SedAlgorithm::SedAlgorithm(unsigned int level, unsigned int version)
   , mKisaoID ("")
   , mAlgorithmParameters (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -67,7 +67,7 @@ SedAlgorithm::SedAlgorithm(unsigned int level, unsigned int version)
 /*
  * Creates a new SedAlgorithm using the given SedNamespaces object @p sedmlns.
  */
-SedAlgorithm::SedAlgorithm(SedNamespaces *sedmlns)
+SedAlgorithm::SedAlgorithm(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mKisaoID ("")
   , mAlgorithmParameters (sedmlns)
@@ -89,6 +89,18 @@ SedAlgorithm::SedAlgorithm(const SedAlgorithm& orig)
 }
 
 
+/*
+ * Move constructor for SedAlgorithm.
+ */
+SedAlgorithm::SedAlgorithm(SedAlgorithm&& orig)
+  : SedBase( std::move(orig) )
+  , mKisaoID ( std::move(orig.mKisaoID) )
+  , mAlgorithmParameters ( std::move(orig.mAlgorithmParameters) )
+{
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedAlgorithm.
  */
@@ -107,6 +119,25 @@ SedAlgorithm::operator=(const SedAlgorithm& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedAlgorithm.
+ */
+SedAlgorithm&
+SedAlgorithm::operator=(SedAlgorithm&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mKisaoID = std::move(rhs.mKisaoID);
+    mAlgorithmParameters = std::move(rhs.mAlgorithmParameters);
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAlgorithm object.
  */
@@ -155,8 +186,9 @@ SedAlgorithm::setKisaoID(const std::string& kisaoID)
   mKisaoID = kisaoID;
   if (!isSetName()) {
       int knum = getKisaoIDasInt();
-      if (g_kisaomap.find(knum) != g_kisaomap.end()) {
-          setName(g_kisaomap[knum]);
+      map<int, string>::const_iterator kisao = g_kisaomap.find(knum);
+      if (kisao != g_kisaomap.end()) {
+          setName(kisao->second);
       }
   }
   return LIBSEDML_OPERATION_SUCCESS;
@@ -256,6 +288,47 @@ SedAlgorithm::addAlgorithmParameter(const SedAlgorithmParameter* sap)
 }
 
 
+/*
+ * Adds the given SedAlgorithmParameter to this SedAlgorithm,
+ * which takes ownership of it.
+ */
+int
+SedAlgorithm::addAlgorithmParameter(std::unique_ptr<SedAlgorithmParameter> sap)
+{
+  if (!sap)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sap->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sap.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sap->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sap->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sap->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sap.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return mAlgorithmParameters.appendAndOwn(std::move(sap));
+  }
+}
+
+
 /*
  * Get the number of SedAlgorithmParameter objects in this SedAlgorithm.
  */
@@ -277,7 +350,7 @@ SedAlgorithm::createAlgorithmParameter()
 
   try
   {
-    sap = new SedAlgorithmParameter(getSedNamespaces());
+    sap = new (getSedArena()) SedAlgorithmParameter(getSedNamespaces());
   }
   catch (...)
   {
@@ -314,6 +387,58 @@ SedAlgorithm::removeAlgorithmParameter(const string& id)
 }
 
 
+/*
+ * Adds the memory held by this SedAlgorithm object to @p usage.
+ */
+void
+SedAlgorithm::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedAlgorithm) - sizeof(SedBase) -
+    sizeof(SedListOfAlgorithmParameters));
+  usage.addString(type, mKisaoID);
+
+  if (mAlgorithmParameters.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mAlgorithmParameters.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedAlgorithm object to @p stream.
+ */
+void
+SedAlgorithm::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mKisaoID);
+  mAlgorithmParameters.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedAlgorithm object from @p stream.
+ */
+void
+SedAlgorithm::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mKisaoID);
+  mAlgorithmParameters.readBinary(stream);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedAlgorithm object.
  */
@@ -909,7 +1034,9 @@ SedAlgorithm::readAttributes(
   // kisaoID string (use = "required" )
   // 
 
-  assigned = attributes.readInto("kisaoID", mKisaoID);
+  std::string kisaoID;
+  assigned = attributes.readInto("kisaoID", kisaoID);
+  mKisaoID = kisaoID;
 
   if (assigned == true)
   {
@@ -961,14 +1088,14 @@ SedAlgorithm::writeAttributes(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 int 
 SedAlgorithm::getKisaoIDasInt() const
 {
-  std::string::size_type pos = mKisaoID.find(':');
+  std::string::size_type pos = mKisaoID.str().find(':');
   if (pos == std::string::npos)
-    pos = mKisaoID.find('_');
+    pos = mKisaoID.str().find('_');
   
   if (pos == std::string::npos)
     return -1;
   
-  std::stringstream str(mKisaoID.substr(pos+1));
+  std::stringstream str(mKisaoID.str().substr(pos+1));
   int result; str >> result;
   return result;
 }
@@ -985,8 +1112,11 @@ SedAlgorithm::setKisaoID(int kisaoID)
       << std::setw(7)
       << kisaoID; 
   mKisaoID = str.str();
-  if (!isSetName() && g_kisaomap.find(kisaoID) != g_kisaomap.end()) {
-      setName(g_kisaomap[kisaoID]);
+  if (!isSetName()) {
+      map<int, string>::const_iterator kisao = g_kisaomap.find(kisaoID);
+      if (kisao != g_kisaomap.end()) {
+          setName(kisao->second);
+      }
   }
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -52,6 +52,7 @@
 
 #include <sedml/SedBase.h>
 #include <sedml/SedListOfAlgorithmParameters.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -64,7 +65,7 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  std::string mKisaoID;
+  SedInternedString mKisaoID;
   SedListOfAlgorithmParameters mAlgorithmParameters;
 
   /** @endcond */
@@ -95,7 +96,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedAlgorithm(SedNamespaces *sedmlns);
+  SedAlgorithm(const SedNamespaces *sedmlns);
 
 
   /**
@@ -115,6 +116,28 @@ public:
   SedAlgorithm& operator=(const SedAlgorithm& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedAlgorithm.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedAlgorithm instance to move from.
+   */
+  SedAlgorithm(SedAlgorithm&& orig);
+
+
+  /**
+   * Move assignment operator for SedAlgorithm.
+   *
+   * @param rhs the SedAlgorithm object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedAlgorithm& operator=(SedAlgorithm&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAlgorithm object.
    *
@@ -276,6 +299,28 @@ public:
   int addAlgorithmParameter(const SedAlgorithmParameter* sap);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAlgorithmParameter to this SedAlgorithm without copying it.
+   *
+   * @param sap the SedAlgorithmParameter object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addAlgorithmParameter(const SedAlgorithmParameter* sap)
+   */
+  int addAlgorithmParameter(std::unique_ptr<SedAlgorithmParameter> sap);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAlgorithmParameter objects in this SedAlgorithm.
    *
@@ -351,6 +396,28 @@ public:
   SedAlgorithmParameter* removeAlgorithmParameter(const std::string& id);
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedAlgorithm object.
    *
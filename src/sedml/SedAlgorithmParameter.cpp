@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedAlgorithmParameter.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfAlgorithmParameters.h>
 #include <sbml/xml/XMLInputStream.h>
 #include <map>
@@ -42,7 +43,7 @@ using namespace std;
 
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
-extern map<int, string> g_kisaomap;
+extern const map<int, string> g_kisaomap;
 
 
 
@@ -60,7 +61,6 @@ SedAlgorithmParameter::SedAlgorithmParameter(unsigned int level,
   , mValue ("")
   , mAlgorithmParameters (new SedListOfAlgorithmParameters (level, version))
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -69,7 +69,7 @@ SedAlgorithmParameter::SedAlgorithmParameter(unsigned int level,
  * Creates a new SedAlgorithmParameter using the given SedNamespaces object @p
  * sedmlns.
  */
-SedAlgorithmParameter::SedAlgorithmParameter(SedNamespaces *sedmlns)
+SedAlgorithmParameter::SedAlgorithmParameter(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mKisaoID ("")
   , mValue ("")
@@ -98,6 +98,20 @@ SedAlgorithmParameter::SedAlgorithmParameter(const SedAlgorithmParameter& orig)
 }
 
 
+/*
+ * Move constructor for SedAlgorithmParameter.
+ */
+SedAlgorithmParameter::SedAlgorithmParameter(SedAlgorithmParameter&& orig)
+  : SedBase( std::move(orig) )
+  , mKisaoID ( std::move(orig.mKisaoID) )
+  , mValue ( std::move(orig.mValue) )
+  , mAlgorithmParameters ( new SedListOfAlgorithmParameters
+    (std::move(*orig.mAlgorithmParameters)) )
+{
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedAlgorithmParameter.
  */
@@ -126,6 +140,26 @@ SedAlgorithmParameter::operator=(const SedAlgorithmParameter& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedAlgorithmParameter.
+ */
+SedAlgorithmParameter&
+SedAlgorithmParameter::operator=(SedAlgorithmParameter&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mKisaoID = std::move(rhs.mKisaoID);
+    mValue = std::move(rhs.mValue);
+    *mAlgorithmParameters = std::move(*rhs.mAlgorithmParameters);
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAlgorithmParameter object.
  */
@@ -197,8 +231,9 @@ SedAlgorithmParameter::setKisaoID(const std::string& kisaoID)
   mKisaoID = kisaoID;
   if (!isSetName()) {
       int knum = getKisaoIDasInt();
-      if (g_kisaomap.find(knum) != g_kisaomap.end()) {
-          setName(g_kisaomap[knum]);
+      map<int, string>::const_iterator kisao = g_kisaomap.find(knum);
+      if (kisao != g_kisaomap.end()) {
+          setName(kisao->second);
       }
   }
   return LIBSEDML_OPERATION_SUCCESS;
@@ -329,6 +364,47 @@ SedAlgorithmParameter::addAlgorithmParameter(const SedAlgorithmParameter* sap1)
 }
 
 
+/*
+ * Adds the given SedAlgorithmParameter to this SedAlgorithmParameter,
+ * which takes ownership of it.
+ */
+int
+SedAlgorithmParameter::addAlgorithmParameter(std::unique_ptr<SedAlgorithmParameter> sap1)
+{
+  if (!sap1)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sap1->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sap1.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sap1->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sap1->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sap1->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sap1.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return mAlgorithmParameters->appendAndOwn(std::move(sap1));
+  }
+}
+
+
 /*
  * Get the number of SedAlgorithmParameter objects in this
  * SedAlgorithmParameter.
@@ -352,7 +428,7 @@ SedAlgorithmParameter::createAlgorithmParameter()
 
   try
   {
-    sap1 = new SedAlgorithmParameter(getSedNamespaces());
+    sap1 = new (getSedArena()) SedAlgorithmParameter(getSedNamespaces());
   }
   catch (...)
   {
@@ -378,6 +454,71 @@ SedAlgorithmParameter::removeAlgorithmParameter(unsigned int n)
 }
 
 
+/*
+ * Adds the memory held by this SedAlgorithmParameter object to @p usage.
+ */
+void
+SedAlgorithmParameter::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedAlgorithmParameter) - sizeof(SedBase));
+  usage.addString(type, mKisaoID);
+  usage.addString(type, mValue);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedAlgorithmParameter object to @p
+ * stream.
+ */
+void
+SedAlgorithmParameter::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mKisaoID);
+  stream.writeString(mValue);
+
+  stream.writeBool(mAlgorithmParameters != NULL);
+  if (mAlgorithmParameters != NULL)
+  {
+    mAlgorithmParameters->writeBinary(stream);
+  }
+}
+
+
+/*
+ * Reads the attributes and children of this SedAlgorithmParameter object from
+ * @p stream.
+ */
+void
+SedAlgorithmParameter::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mKisaoID);
+  stream.readString(mValue);
+
+  if (stream.readBool())
+  {
+    if (mAlgorithmParameters == NULL)
+    {
+      mAlgorithmParameters =
+        new SedListOfAlgorithmParameters(getSedNamespaces());
+      mAlgorithmParameters->connectToParent(this);
+    }
+    mAlgorithmParameters->readBinary(stream);
+  }
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedAlgorithmParameter object.
  */
@@ -1030,7 +1171,9 @@ SedAlgorithmParameter::readAttributes(
   // kisaoID string (use = "required" )
   // 
 
-  assigned = attributes.readInto("kisaoID", mKisaoID);
+  std::string kisaoID;
+  assigned = attributes.readInto("kisaoID", kisaoID);
+  mKisaoID = kisaoID;
 
   if (assigned == true)
   {
@@ -1111,14 +1254,14 @@ SedAlgorithmParameter::writeAttributes(LIBSBML_CPP_NAMESPACE_QUALIFIER
 int 
 SedAlgorithmParameter::getKisaoIDasInt() const
 {
-  std::string::size_type pos = mKisaoID.find(':');
+  std::string::size_type pos = mKisaoID.str().find(':');
   if (pos == std::string::npos)
-    pos = mKisaoID.find('_');
+    pos = mKisaoID.str().find('_');
   
   if (pos == std::string::npos)
     return -1;
   
-  std::stringstream str(mKisaoID.substr(pos+1));
+  std::stringstream str(mKisaoID.str().substr(pos+1));
   int result; str >> result;
   return result;
 }
@@ -1135,8 +1278,11 @@ SedAlgorithmParameter::setKisaoID(int kisaoID)
       << std::setw(7)
       << kisaoID; 
   mKisaoID = str.str();
-  if (!isSetName() && g_kisaomap.find(kisaoID) != g_kisaomap.end()) {
-      setName(g_kisaomap[kisaoID]);
+  if (!isSetName()) {
+      map<int, string>::const_iterator kisao = g_kisaomap.find(kisaoID);
+      if (kisao != g_kisaomap.end()) {
+          setName(kisao->second);
+      }
   }
   return LIBSEDML_OPERATION_SUCCESS;
 }
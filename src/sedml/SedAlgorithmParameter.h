@@ -51,6 +51,7 @@
 
 
 #include <sedml/SedBase.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -65,7 +66,7 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  std::string mKisaoID;
+  SedInternedString mKisaoID;
   std::string mValue;
   SedListOfAlgorithmParameters * mAlgorithmParameters;
 
@@ -97,7 +98,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedAlgorithmParameter(SedNamespaces *sedmlns);
+  SedAlgorithmParameter(const SedNamespaces *sedmlns);
 
 
   /**
@@ -117,6 +118,28 @@ public:
   SedAlgorithmParameter& operator=(const SedAlgorithmParameter& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedAlgorithmParameter.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedAlgorithmParameter instance to move from.
+   */
+  SedAlgorithmParameter(SedAlgorithmParameter&& orig);
+
+
+  /**
+   * Move assignment operator for SedAlgorithmParameter.
+   *
+   * @param rhs the SedAlgorithmParameter object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedAlgorithmParameter& operator=(SedAlgorithmParameter&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAlgorithmParameter object.
    *
@@ -327,6 +350,28 @@ public:
   int addAlgorithmParameter(const SedAlgorithmParameter* sap1);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAlgorithmParameter to this SedAlgorithmParameter without copying it.
+   *
+   * @param sap1 the SedAlgorithmParameter object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addAlgorithmParameter(const SedAlgorithmParameter* sap1)
+   */
+  int addAlgorithmParameter(std::unique_ptr<SedAlgorithmParameter> sap1);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAlgorithmParameter objects in this
    * SedAlgorithmParameter.
@@ -385,6 +430,28 @@ public:
   SedAlgorithmParameter* removeAlgorithmParameter(unsigned int n);
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedAlgorithmParameter object.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedAnalysis::SedAnalysis(unsigned int level, unsigned int version)
   : SedSimulation(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -62,7 +61,7 @@ SedAnalysis::SedAnalysis(unsigned int level, unsigned int version)
  * Creates a new SedAnalysis using the given SedNamespaces object @p
  * sedmlns.
  */
-SedAnalysis::SedAnalysis(SedNamespaces *sedmlns)
+SedAnalysis::SedAnalysis(const SedNamespaces *sedmlns)
   : SedSimulation(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -78,6 +77,15 @@ SedAnalysis::SedAnalysis(const SedAnalysis& orig)
 }
 
 
+/*
+ * Move constructor for SedAnalysis.
+ */
+SedAnalysis::SedAnalysis(SedAnalysis&& orig)
+  : SedSimulation( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedAnalysis.
  */
@@ -93,6 +101,21 @@ SedAnalysis::operator=(const SedAnalysis& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedAnalysis.
+ */
+SedAnalysis&
+SedAnalysis::operator=(SedAnalysis&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedSimulation::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAnalysis object.
  */
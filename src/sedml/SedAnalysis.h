@@ -86,7 +86,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedAnalysis(SedNamespaces *sedmlns);
+  SedAnalysis(const SedNamespaces *sedmlns);
 
 
   /**
@@ -106,6 +106,28 @@ public:
   SedAnalysis& operator=(const SedAnalysis& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedAnalysis.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedAnalysis instance to move from.
+   */
+  SedAnalysis(SedAnalysis&& orig);
+
+
+  /**
+   * Move assignment operator for SedAnalysis.
+   *
+   * @param rhs the SedAnalysis object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedAnalysis& operator=(SedAnalysis&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAnalysis object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedAppliedDimension.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfAppliedDimensions.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -58,7 +59,6 @@ SedAppliedDimension::SedAppliedDimension(unsigned int level,
   , mTarget ("")
   , mDimensionTarget ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -66,7 +66,7 @@ SedAppliedDimension::SedAppliedDimension(unsigned int level,
  * Creates a new SedAppliedDimension using the given SedNamespaces object @p
  * sedmlns.
  */
-SedAppliedDimension::SedAppliedDimension(SedNamespaces *sedmlns)
+SedAppliedDimension::SedAppliedDimension(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mTarget ("")
   , mDimensionTarget ("")
@@ -86,6 +86,17 @@ SedAppliedDimension::SedAppliedDimension(const SedAppliedDimension& orig)
 }
 
 
+/*
+ * Move constructor for SedAppliedDimension.
+ */
+SedAppliedDimension::SedAppliedDimension(SedAppliedDimension&& orig)
+  : SedBase( std::move(orig) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mDimensionTarget ( std::move(orig.mDimensionTarget) )
+{
+}
+
+
 /*
  * Assignment operator for SedAppliedDimension.
  */
@@ -103,6 +114,23 @@ SedAppliedDimension::operator=(const SedAppliedDimension& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedAppliedDimension.
+ */
+SedAppliedDimension&
+SedAppliedDimension::operator=(SedAppliedDimension&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mTarget = std::move(rhs.mTarget);
+    mDimensionTarget = std::move(rhs.mDimensionTarget);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAppliedDimension object.
  */
@@ -258,6 +286,73 @@ SedAppliedDimension::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedAppliedDimension object to @p refs.
+ */
+void
+SedAppliedDimension::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetTarget())
+  {
+    refs.push_back(std::make_pair(std::string("target"), mTarget));
+  }
+
+  if (isSetDimensionTarget())
+  {
+    refs.push_back(std::make_pair(std::string("dimensionTarget"),
+      mDimensionTarget));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedAppliedDimension object to @p usage.
+ */
+void
+SedAppliedDimension::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedAppliedDimension) - sizeof(SedBase));
+  usage.addString(type, mTarget);
+  usage.addString(type, mDimensionTarget);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedAppliedDimension object to @p
+ * stream.
+ */
+void
+SedAppliedDimension::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mTarget);
+  stream.writeString(mDimensionTarget);
+}
+
+
+/*
+ * Reads the attributes and children of this SedAppliedDimension object from @p
+ * stream.
+ */
+void
+SedAppliedDimension::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mTarget);
+  stream.readString(mDimensionTarget);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedAppliedDimension object.
@@ -685,7 +780,9 @@ SedAppliedDimension::readAttributes(
   // target SIdRef (use = "optional" )
   // 
 
-  assigned = attributes.readInto("target", mTarget);
+  std::string target;
+  assigned = attributes.readInto("target", target);
+  mTarget = target;
 
   if (assigned == true)
   {
@@ -702,7 +799,8 @@ SedAppliedDimension::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mTarget + "', which does not conform to the syntax.";
+      msg += " is '" + mTarget.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlAppliedDimensionTargetMustBeSId, level, version, msg,
         getLine(), getColumn());
     }
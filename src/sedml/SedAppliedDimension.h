@@ -51,6 +51,7 @@
 
 
 #include <sedml/SedBase.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -63,7 +64,7 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  std::string mTarget;
+  SedInternedString mTarget;
   std::string mDimensionTarget;
 
   /** @endcond */
@@ -94,7 +95,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedAppliedDimension(SedNamespaces *sedmlns);
+  SedAppliedDimension(const SedNamespaces *sedmlns);
 
 
   /**
@@ -114,6 +115,28 @@ public:
   SedAppliedDimension& operator=(const SedAppliedDimension& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedAppliedDimension.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedAppliedDimension instance to move from.
+   */
+  SedAppliedDimension(SedAppliedDimension&& orig);
+
+
+  /**
+   * Move assignment operator for SedAppliedDimension.
+   *
+   * @param rhs the SedAppliedDimension object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedAppliedDimension& operator=(SedAppliedDimension&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAppliedDimension object.
    *
@@ -223,6 +246,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedAppliedDimension object.
    *
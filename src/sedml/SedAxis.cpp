@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedAxis.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -64,14 +65,13 @@ SedAxis::SedAxis(unsigned int level, unsigned int version)
   , mStyle ("")
   , mElementName("axis")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedAxis using the given SedNamespaces object @p sedmlns.
  */
-SedAxis::SedAxis(SedNamespaces *sedmlns)
+SedAxis::SedAxis(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mType (SEDML_AXISTYPE_INVALID)
   , mMin (util_NaN())
@@ -109,6 +109,26 @@ SedAxis::SedAxis(const SedAxis& orig)
 }
 
 
+/*
+ * Move constructor for SedAxis.
+ */
+SedAxis::SedAxis(SedAxis&& orig)
+  : SedBase( std::move(orig) )
+  , mType ( std::move(orig.mType) )
+  , mMin ( std::move(orig.mMin) )
+  , mIsSetMin ( std::move(orig.mIsSetMin) )
+  , mMax ( std::move(orig.mMax) )
+  , mIsSetMax ( std::move(orig.mIsSetMax) )
+  , mGrid ( std::move(orig.mGrid) )
+  , mIsSetGrid ( std::move(orig.mIsSetGrid) )
+  , mReverse ( std::move(orig.mReverse) )
+  , mIsSetReverse ( std::move(orig.mIsSetReverse) )
+  , mStyle ( std::move(orig.mStyle) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
 /*
  * Assignment operator for SedAxis.
  */
@@ -135,6 +155,32 @@ SedAxis::operator=(const SedAxis& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedAxis.
+ */
+SedAxis&
+SedAxis::operator=(SedAxis&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mType = std::move(rhs.mType);
+    mMin = std::move(rhs.mMin);
+    mIsSetMin = std::move(rhs.mIsSetMin);
+    mMax = std::move(rhs.mMax);
+    mIsSetMax = std::move(rhs.mIsSetMax);
+    mGrid = std::move(rhs.mGrid);
+    mIsSetGrid = std::move(rhs.mIsSetGrid);
+    mReverse = std::move(rhs.mReverse);
+    mIsSetReverse = std::move(rhs.mIsSetReverse);
+    mStyle = std::move(rhs.mStyle);
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAxis object.
  */
@@ -508,6 +554,83 @@ SedAxis::renameSIdRefs(const std::string& oldid, const std::string& newid)
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedAxis object to @p refs.
+ */
+void
+SedAxis::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetStyle())
+  {
+    refs.push_back(std::make_pair(std::string("style"), mStyle));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedAxis object to @p usage.
+ */
+void
+SedAxis::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedAxis) - sizeof(SedBase));
+  usage.addString(type, mStyle);
+  usage.addString(type, mElementName);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedAxis object to @p stream.
+ */
+void
+SedAxis::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeInt(mType);
+  stream.writeDouble(mMin);
+  stream.writeBool(mIsSetMin);
+  stream.writeDouble(mMax);
+  stream.writeBool(mIsSetMax);
+  stream.writeBool(mGrid);
+  stream.writeBool(mIsSetGrid);
+  stream.writeBool(mReverse);
+  stream.writeBool(mIsSetReverse);
+  stream.writeString(mStyle);
+  stream.writeString(mElementName);
+}
+
+
+/*
+ * Reads the attributes and children of this SedAxis object from @p stream.
+ */
+void
+SedAxis::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  mType = static_cast<AxisType_t>(stream.readInt());
+  mMin = stream.readDouble();
+  mIsSetMin = stream.readBool();
+  mMax = stream.readDouble();
+  mIsSetMax = stream.readBool();
+  mGrid = stream.readBool();
+  mIsSetGrid = stream.readBool();
+  mReverse = stream.readBool();
+  mIsSetReverse = stream.readBool();
+  stream.readString(mStyle);
+  stream.readString(mElementName);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedAxis object.
@@ -126,7 +126,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedAxis(SedNamespaces *sedmlns);
+  SedAxis(const SedNamespaces *sedmlns);
 
 
   /**
@@ -146,6 +146,28 @@ public:
   SedAxis& operator=(const SedAxis& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedAxis.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedAxis instance to move from.
+   */
+  SedAxis(SedAxis&& orig);
+
+
+  /**
+   * Move assignment operator for SedAxis.
+   *
+   * @param rhs the SedAxis object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedAxis& operator=(SedAxis&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAxis object.
    *
@@ -449,6 +471,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedAxis object.
    *
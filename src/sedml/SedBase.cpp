@@ -39,17 +39,21 @@
 #include <sbml/xml/XMLError.h>
 #include <sbml/xml/XMLErrorLog.h>
 #include <sbml/xml/XMLOutputStream.h>
+#include <sedml/common/SedXMLOutputStream.h>
 #include <sbml/xml/XMLInputStream.h>
 #include <sbml/xml/XMLToken.h>
 #include <sbml/xml/XMLNode.h>
 
 #include <sbml/util/util.h>
+#include <sbml/math/ASTNode.h>
 
 #include <sedml/SedError.h>
 #include <sedml/SedErrorLog.h>
 #include <sedml/SedDocument.h>
 #include <sedml/SedListOf.h>
+#include <sedml/SedReader.h>
 #include <sedml/SedBase.h>
+#include <sedml/SedBinaryStream.h>
 
 
 /** @cond doxygenIgnored */
@@ -60,12 +64,145 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 
 #ifdef __cplusplus
 
+/** @cond doxygenLibsedmlInternal */
+/*
+ * The fields of SedBase that most objects never set; SedBase only
+ * allocates them once one of them is assigned.
+ */
+struct SedBaseColdFields
+{
+  std::string mMetaId;
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* mNotes;
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* mAnnotation;
+
+  //
+  // notes and annotation as read, kept as markup until first accessed;
+  // at most one of mRawNotes and mNotes (and of mRawAnnotation and
+  // mAnnotation) is set at any time.
+  //
+  std::string mRawNotes;
+  std::string mRawAnnotation;
+  void* mUserData;
+
+  SedBaseColdFields()
+    : mNotes(NULL)
+    , mAnnotation(NULL)
+    , mUserData(NULL)
+  {
+  }
+
+  SedBaseColdFields(const SedBaseColdFields& orig)
+    : mMetaId(orig.mMetaId)
+    , mNotes(NULL)
+    , mAnnotation(NULL)
+    , mRawNotes(orig.mRawNotes)
+    , mRawAnnotation(orig.mRawAnnotation)
+    , mUserData(orig.mUserData)
+  {
+    if (orig.mNotes != NULL)
+      mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*orig.mNotes);
+    if (orig.mAnnotation != NULL)
+      mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*orig.mAnnotation);
+  }
+
+  ~SedBaseColdFields()
+  {
+    delete mNotes;
+    delete mAnnotation;
+  }
+
+  bool isEmpty() const
+  {
+    return mMetaId.empty() && mNotes == NULL && mAnnotation == NULL &&
+      mRawNotes.empty() && mRawAnnotation.empty() && mUserData == NULL;
+  }
+
+private:
+  SedBaseColdFields& operator=(const SedBaseColdFields&);
+};
+
+
+SedBaseColdFields&
+SedBase::getColdFields() const
+{
+  if (mCold == NULL)
+  {
+    mCold = new SedBaseColdFields();
+  }
+
+  return *mCold;
+}
+
+
+const std::string&
+SedBase::getStoredMetaId() const
+{
+  static const std::string empty;
+  return (mCold != NULL) ? mCold->mMetaId : empty;
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+void*
+SedBase::operator new (size_t size)
+{
+  return SedArena::allocate(NULL, size);
+}
+
+
+void*
+SedBase::operator new (size_t size, SedArena* arena)
+{
+  return SedArena::allocate(arena, size);
+}
+
+
+void*
+SedBase::operator new (size_t size, const std::nothrow_t&) throw()
+{
+  try
+  {
+    return SedArena::allocate(NULL, size);
+  }
+  catch (...)
+  {
+    return NULL;
+  }
+}
+
+
+/*
+ * The size, that of the object being deleted as the destructor is
+ * virtual, lets an arena reuse its memory.
+ */
+void
+SedBase::operator delete (void* ptr, size_t size)
+{
+  SedArena::deallocate(ptr, size);
+}
+
+
+void
+SedBase::operator delete (void* ptr, SedArena*)
+{
+  SedArena::deallocate(ptr);
+}
+
+
+void
+SedBase::operator delete (void* ptr, const std::nothrow_t&) throw()
+{
+  SedArena::deallocate(ptr);
+}
+/** @endcond */
+
+
 SedBase*
 SedBase::getElementBySId(const std::string& id)
 {
-  if (id.empty()) return NULL;
-
-  return NULL;
+  return const_cast<SedBase*>(static_cast<const
+    SedBase&>(*this).getElementBySId(id));
 }
 
 
@@ -74,16 +211,15 @@ SedBase::getElementBySId(const std::string& id) const
 {
   if (id.empty()) return NULL;
 
-  return NULL;
+  return findElement(id, false);
 }
 
 
 SedBase*
 SedBase::getElementByMetaId(const std::string& metaid)
 {
-  if (metaid.empty()) return NULL;
-
-  return NULL;
+  return const_cast<SedBase*>(static_cast<const
+    SedBase&>(*this).getElementByMetaId(metaid));
 }
 
 const SedBase*
@@ -91,40 +227,214 @@ SedBase::getElementByMetaId(const std::string& metaid) const
 {
   if (metaid.empty()) return NULL;
 
-  return NULL;
+  return findElement(metaid, true);
 }
 
 
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Searches the descendants of this object for an element with the given
+ * id (or metaid), in document order.
+ */
+const SedBase*
+SedBase::findElement(const std::string& key, bool isMetaId) const
+{
+  List* elements = const_cast<SedBase*>(this)->getAllElements();
+  if (elements == NULL) return NULL;
+
+  const SedBase* result = NULL;
+  while (result == NULL && elements->getSize() > 0)
+  {
+    const SedBase* element = static_cast<const SedBase*>(elements->remove(0));
+    if ((isMetaId ? element->getMetaId() : element->getId()) == key)
+    {
+      result = element;
+    }
+  }
+
+  delete elements;
+  return result;
+}
+/** @endcond */
+
+
 List*
 SedBase::getAllElements(SedElementFilter* filter)
 {
   return NULL;
 }
 
+
+/*
+ * Appends the SIdRef attributes of this object to refs; SedBase itself has
+ * none.
+ */
+void
+SedBase::collectSIdRefs(SedIdRefList&) const
+{
+}
+
+
+/*
+ * Returns the heap memory held by this object and all its descendants.
+ */
+SedMemoryUsage
+SedBase::getMemoryUsage() const
+{
+  SedMemoryUsage usage;
+  addMemoryUsage(usage);
+
+  List* elements = const_cast<SedBase*>(this)->getAllElements();
+  if (elements != NULL)
+  {
+    while (elements->getSize() > 0)
+    {
+      static_cast<const SedBase*>(elements->remove(0))->addMemoryUsage(usage);
+    }
+    delete elements;
+  }
+
+  return usage;
+}
+
+
+/*
+ * Adds the memory held by this object (but not its children) to usage.
+ */
+void
+SedBase::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  int type = getTypeCode();
+
+  usage.addObject(type, sizeof(SedBase));
+  usage.addString(type, mId);
+  usage.addString(type, mName);
+  usage.addNamespaces(type, mSedNamespaces);
+
+  if (mCold != NULL)
+  {
+    usage.addBytes(type, sizeof(SedBaseColdFields));
+    usage.addString(type, mCold->mMetaId);
+    usage.addString(type, mCold->mRawNotes);
+    usage.addString(type, mCold->mRawAnnotation);
+    usage.addXML(type, mCold->mNotes);
+    usage.addXML(type, mCold->mAnnotation);
+  }
+}
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Parses the notes and annotation that are still kept as markup.
+ */
+void
+SedBase::prepareForConcurrentReads() const
+{
+  parseRawNotes();
+  parseRawAnnotation();
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Writes the id, name, metaid, notes and annotation; notes and annotation
+ * are written in whichever form (markup or tree) they are held in.
+ */
+void
+SedBase::writeBinary(SedBinaryOutputStream& stream) const
+{
+  static const std::string empty;
+
+  stream.writeString(mId);
+  stream.writeString(mName);
+  stream.writeString(getStoredMetaId());
+  stream.writeXML(mCold != NULL ? mCold->mRawNotes : empty,
+                  mCold != NULL ? mCold->mNotes : NULL);
+  stream.writeXML(mCold != NULL ? mCold->mRawAnnotation : empty,
+                  mCold != NULL ? mCold->mAnnotation : NULL);
+}
+
+
+/*
+ * Reads what writeBinary() wrote.
+ */
+void
+SedBase::readBinary(SedBinaryInputStream& stream)
+{
+  stream.readString(mId);
+  stream.readString(mName);
+
+  std::string metaid;
+  stream.readString(metaid);
+
+  std::string rawNotes;
+  std::string rawAnnotation;
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes = NULL;
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annotation = NULL;
+  stream.readXML(rawNotes, notes);
+  stream.readXML(rawAnnotation, annotation);
+
+  if (mCold == NULL && metaid.empty() && rawNotes.empty() && notes == NULL
+      && rawAnnotation.empty() && annotation == NULL)
+  {
+    return;
+  }
+
+  SedBaseColdFields& cold = getColdFields();
+  cold.mMetaId.swap(metaid);
+  cold.mRawNotes.swap(rawNotes);
+  cold.mRawAnnotation.swap(rawAnnotation);
+  delete cold.mNotes;
+  cold.mNotes = notes;
+  delete cold.mAnnotation;
+  cold.mAnnotation = annotation;
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Appends the names of all the identifiers used in math to refs.
+ */
+void
+SedBase::collectMathSIdRefs(const ASTNode* math, SedIdRefList& refs)
+{
+  if (math == NULL) return;
+
+  if (math->getType() == AST_NAME && math->getName() != NULL)
+  {
+    refs.push_back(std::make_pair(std::string("math"),
+      std::string(math->getName())));
+  }
+
+  for (unsigned int n = 0; n < math->getNumChildren(); ++n)
+  {
+    collectMathSIdRefs(math->getChild(n), refs);
+  }
+}
+/** @endcond */
+
 /** @cond doxygenLibsedmlInternal */
 /*
  * Creates a new SedBase object with the given level and version.
  * Only subclasses may create SedBase objects.
  */
 SedBase::SedBase (unsigned int level, unsigned int version) 
- : mMetaId ("")
- , mId ("")
+ : mId ("")
  , mName("")
- , mIdAllowedPreV4(false)
- , mNameAllowedPreV4(false)
- , mNotes(NULL)
- , mAnnotation( NULL )
  , mSed      ( NULL )
  , mSedNamespaces (NULL)
- , mUserData(NULL)
+ , mParentSedObject (NULL)
+ , mURI(SedNamespaces::internURI(""))
+ , mCold(NULL)
  , mLine      ( 0 )
  , mColumn    ( 0 )
- , mParentSedObject (NULL)
-  , mHasBeenDeleted(false)
-  , mEmptyString("")
- , mURI("")
+ , mIdAllowedPreV4(false)
+ , mNameAllowedPreV4(false)
+ , mHasBeenDeleted(false)
 {
-  mSedNamespaces = new SedNamespaces(level, version);
+  mSedNamespaces = SedNamespaces::getShared(level, version);
 
   //
   // Sets the XMLNS URI of corresponding SED-ML Level/Version to
@@ -140,32 +450,28 @@ SedBase::SedBase (unsigned int level, unsigned int version)
  * Creates a new SedBase object with the given SedNamespaces.
  * Only subclasses may create SedBase objects.
  */
-SedBase::SedBase (SedNamespaces *sedmlns) 
- : mMetaId("")
- , mId("")
+SedBase::SedBase (const SedNamespaces *sedmlns) 
+ : mId("")
  , mName("")
- , mIdAllowedPreV4(false)
- , mNameAllowedPreV4(false)
- , mNotes(NULL)
- , mAnnotation(NULL)
  , mSed(NULL)
  , mSedNamespaces(NULL)
- , mUserData(NULL)
+ , mParentSedObject(NULL)
+ , mURI(SedNamespaces::internURI(""))
+ , mCold(NULL)
  , mLine(0)
  , mColumn(0)
- , mParentSedObject(NULL)
+ , mIdAllowedPreV4(false)
+ , mNameAllowedPreV4(false)
  , mHasBeenDeleted(false)
- , mEmptyString("")
- , mURI("")
 {
   if (!sedmlns)
   {
     std::string err("SedBase::SedBase(SedNamespaces*) : SedNamespaces is null");
     throw SedConstructorException(err);
   }
-  mSedNamespaces = sedmlns->clone();
+  mSedNamespaces = SedNamespaces::getShared(sedmlns);
 
-  setElementNamespace(static_cast<SedNamespaces>(*mSedNamespaces).getURI());
+  setElementNamespace(mSedNamespaces->getURI());
 }
 /** @endcond */
 
@@ -175,38 +481,55 @@ SedBase::SedBase (SedNamespaces *sedmlns)
  * Copy constructor. Creates a copy of this SedBase object.
  */
 SedBase::SedBase(const SedBase& orig)
-  : mMetaId (orig.mMetaId)
-  , mId (orig.mId)
+  : mId (orig.mId)
   , mName(orig.mName)
+  , mSed (NULL)
+  , mSedNamespaces(NULL)
+  , mParentSedObject(NULL)
+  , mURI(SedNamespaces::retainURI(orig.mURI))
+  , mCold(NULL)
+  , mLine(orig.mLine)
+  , mColumn(orig.mColumn)
   , mIdAllowedPreV4(orig.mIdAllowedPreV4)
   , mNameAllowedPreV4(orig.mNameAllowedPreV4)
-  , mNotes (NULL)
-  , mAnnotation (NULL)
+  , mHasBeenDeleted(false)
+{
+  if (orig.mCold != NULL && !orig.mCold->isEmpty())
+    this->mCold = new SedBaseColdFields(*orig.mCold);
+
+  this->mSedNamespaces = SedNamespaces::getShared(orig.getSedNamespaces());
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Move constructor. Takes over the identifiers, notes and annotation of
+ * orig.
+ */
+SedBase::SedBase(SedBase&& orig)
+  : mId (std::move(orig.mId))
+  , mName(std::move(orig.mName))
   , mSed (NULL)
   , mSedNamespaces(NULL)
-  , mUserData(orig.mUserData)
+  , mParentSedObject(NULL)
+  , mURI(SedNamespaces::retainURI(orig.mURI))
+  , mCold(orig.mCold)
   , mLine(orig.mLine)
   , mColumn(orig.mColumn)
-  , mParentSedObject(NULL)
-  , mURI(orig.mURI)
+  , mIdAllowedPreV4(orig.mIdAllowedPreV4)
+  , mNameAllowedPreV4(orig.mNameAllowedPreV4)
+  , mHasBeenDeleted(false)
 {
-  if(orig.mNotes != NULL)
-    this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(orig).getNotes());
-  else
-    this->mNotes = NULL;
-
-  if(orig.mAnnotation != NULL)
-    this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(orig).mAnnotation);
-  else
-    this->mAnnotation = NULL;
+  orig.mId.clear();
+  orig.mName.clear();
+  orig.mCold = NULL;
 
-  if(orig.getSedNamespaces() != NULL)
-    this->mSedNamespaces =
-    new SedNamespaces(*const_cast<SedBase&>(orig).getSedNamespaces());
-  else
-    this->mSedNamespaces = NULL;
+  this->mSedNamespaces = SedNamespaces::getShared(orig.getSedNamespaces());
 
-  this->mHasBeenDeleted = false;
+  // orig stays where it is, but no longer has our identifiers
+  orig.updateParentIdIndex(mId);
+  orig.updateDocumentIndex(mId, getStoredMetaId());
 }
 /** @endcond */
 
@@ -216,54 +539,96 @@ SedBase::SedBase(const SedBase& orig)
  */
 SedBase::~SedBase ()
 {
-  if (mNotes != NULL)       delete mNotes;
-  if (mAnnotation != NULL)  delete mAnnotation;
-  if (mSedNamespaces != NULL)  delete mSedNamespaces;
+  if (mSed != NULL && mSed != this)
+  {
+    mSed->dropFromElementIndex(this, mId, getStoredMetaId());
+  }
+
+  delete mCold;
+  SedNamespaces::releaseShared(mSedNamespaces);
+  SedNamespaces::releaseURI(mURI);
 }
 
 /*
- * Assignment operator
+ * Assignment operator.  This object stays where it is, in its own parent
+ * and document; only the indexes of its identifiers are updated.
  */
 SedBase& SedBase::operator=(const SedBase& rhs)
 {
   if(&rhs!=this)
   {
-    this->mMetaId = rhs.mMetaId;
+    std::string oldId = mId;
+    std::string oldMetaId = getStoredMetaId();
+
     this->mId = rhs.mId;
     this->mName = rhs.mName;
     this->mIdAllowedPreV4 = rhs.mIdAllowedPreV4;
     this->mNameAllowedPreV4 = rhs.mNameAllowedPreV4;
 
-    delete this->mNotes;
+    delete this->mCold;
 
-    if(rhs.mNotes != NULL)
-      this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(rhs).getNotes());
+    if (rhs.mCold != NULL && !rhs.mCold->isEmpty())
+      this->mCold = new SedBaseColdFields(*rhs.mCold);
     else
-      this->mNotes = NULL;
+      this->mCold = NULL;
 
-    delete this->mAnnotation;
+    this->mLine       = rhs.mLine;
+    this->mColumn     = rhs.mColumn;
+
+    SedNamespaces* sedmlns = SedNamespaces::getShared(rhs.mSedNamespaces);
+    SedNamespaces::releaseShared(this->mSedNamespaces);
+    this->mSedNamespaces = sedmlns;
 
-    if(rhs.mAnnotation != NULL)
-      this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(rhs).mAnnotation);
-    else
-      this->mAnnotation = NULL;
 
-    this->mSed       = rhs.mSed;
+    const std::string* uri = SedNamespaces::retainURI(rhs.mURI);
+    SedNamespaces::releaseURI(this->mURI);
+    this->mURI = uri;
+
+    updateParentIdIndex(oldId);
+    updateDocumentIndex(oldId, oldMetaId);
+  }
+
+  return *this;
+}
+
+
+/*
+ * Move assignment operator
+ */
+SedBase& SedBase::operator=(SedBase&& rhs)
+{
+  if (&rhs != this)
+  {
+    std::string oldId = mId;
+    std::string oldMetaId = getStoredMetaId();
+
+    this->mId = std::move(rhs.mId);
+    rhs.mId.clear();
+    this->mName = std::move(rhs.mName);
+    rhs.mName.clear();
+    this->mIdAllowedPreV4 = rhs.mIdAllowedPreV4;
+    this->mNameAllowedPreV4 = rhs.mNameAllowedPreV4;
+
+    delete this->mCold;
+    this->mCold = rhs.mCold;
+    rhs.mCold = NULL;
+
     this->mLine       = rhs.mLine;
     this->mColumn     = rhs.mColumn;
-    this->mParentSedObject = rhs.mParentSedObject;
-    this->mUserData   = rhs.mUserData;
-
-    delete this->mSedNamespaces;
 
-    if(rhs.mSedNamespaces != NULL)
-      this->mSedNamespaces =
-      new SedNamespaces(*const_cast<SedBase&>(rhs).mSedNamespaces);
-    else
-      this->mSedNamespaces = NULL;
+    SedNamespaces* sedmlns = SedNamespaces::getShared(rhs.mSedNamespaces);
+    SedNamespaces::releaseShared(this->mSedNamespaces);
+    this->mSedNamespaces = sedmlns;
 
+    const std::string* uri = SedNamespaces::retainURI(rhs.mURI);
+    SedNamespaces::releaseURI(this->mURI);
+    this->mURI = uri;
 
-    this->mURI = rhs.mURI;
+    // both objects stay where they are; only their identifiers changed
+    rhs.updateParentIdIndex(mId);
+    rhs.updateDocumentIndex(mId, getStoredMetaId());
+    updateParentIdIndex(oldId);
+    updateDocumentIndex(oldId, oldMetaId);
   }
 
   return *this;
@@ -276,7 +641,7 @@ SedBase& SedBase::operator=(const SedBase& rhs)
 const string&
 SedBase::getMetaId () const
 {
-  return mMetaId;
+  return getStoredMetaId();
 }
 
 
@@ -286,7 +651,7 @@ SedBase::getMetaId () const
 string&
 SedBase::getMetaId ()
 {
-  return mMetaId;
+  return getColdFields().mMetaId;
 }
 
 
@@ -294,7 +659,7 @@ const string&
 SedBase::getId() const
 {
     if (!mIdAllowedPreV4 && getVersion() < 4 && getLevel() == 1) {
-        static string empty;
+        static const string empty;
         return empty;
     }
     return mId;
@@ -303,7 +668,7 @@ SedBase::getId() const
 const std::string& SedBase::getName() const
 {
     if (!mNameAllowedPreV4 && getVersion() < 4 && getLevel() == 1) {
-        static string empty;
+        static const string empty;
         return empty;
     }
     return mName;
@@ -316,14 +681,16 @@ const std::string& SedBase::getName() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedBase::getNotes()
 {
-  return mNotes;
+  parseRawNotes();
+  return (mCold != NULL) ? mCold->mNotes : NULL;
 }
 
 
 const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedBase::getNotes() const
 {
-  return mNotes;
+  parseRawNotes();
+  return (mCold != NULL) ? mCold->mNotes : NULL;
 }
 
 
@@ -333,14 +700,20 @@ SedBase::getNotes() const
 std::string
 SedBase::getNotesString()
 {
-  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mNotes);
+  if (mCold == NULL) return "";
+  if (!mCold->mRawNotes.empty()) return mCold->mRawNotes;
+
+  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mCold->mNotes);
 }
 
 
 std::string
 SedBase::getNotesString() const
 {
-  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mNotes);
+  if (mCold == NULL) return "";
+  if (!mCold->mRawNotes.empty()) return mCold->mRawNotes;
+
+  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mCold->mNotes);
 }
 
 
@@ -350,7 +723,8 @@ SedBase::getNotesString() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedBase::getAnnotation ()
 {
-  return mAnnotation;
+  parseRawAnnotation();
+  return (mCold != NULL) ? mCold->mAnnotation : NULL;
 }
 
 
@@ -367,6 +741,8 @@ SedBase::getAnnotation () const
 std::string
 SedBase::getAnnotationString ()
 {
+  if (mCold != NULL && !mCold->mRawAnnotation.empty()) return mCold->mRawAnnotation;
+
   return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(getAnnotation());
 }
 
@@ -374,6 +750,8 @@ SedBase::getAnnotationString ()
 std::string
 SedBase::getAnnotationString () const
 {
+  if (mCold != NULL && !mCold->mRawAnnotation.empty()) return mCold->mRawAnnotation;
+
   return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(getAnnotation());
 }
 
@@ -387,7 +765,7 @@ SedBase::getURI() const
   if (doc == NULL)
     return getElementNamespace();
 
-  SedNamespaces* sedmlns = doc->getSedNamespaces();
+  const SedNamespaces* sedmlns = doc->getSedNamespaces();
 
   if (sedmlns == NULL)
     return getElementNamespace();
@@ -400,53 +778,36 @@ SedBase::getURI() const
 void *
 SedBase::getUserData() const
 {
-  return this->mUserData;
+  return (mCold != NULL) ? mCold->mUserData : NULL;
 }
 
 
 int
 SedBase::setUserData(void *userData)
 {
-  this->mUserData = userData;
-  if (userData == NULL && mUserData == NULL)
-  {
-    return LIBSEDML_OPERATION_SUCCESS;
-  }
-  else if (mUserData != NULL)
-  {
-    return LIBSEDML_OPERATION_SUCCESS;
-  }
-  else
+  if (userData != NULL || mCold != NULL)
   {
-    return LIBSEDML_OPERATION_FAILED;
+    getColdFields().mUserData = userData;
   }
+
+  return LIBSEDML_OPERATION_SUCCESS;
 }
 
 bool
 SedBase::isSetUserData() const
 {
-  if (mUserData != NULL)
-  {
-    return true;
-  }
-  else
-  {
-    return false;
-  }
+  return (mCold != NULL && mCold->mUserData != NULL);
 }
 
 int
 SedBase::unsetUserData()
 {
-  this->mUserData = NULL;
-  if (mUserData == NULL)
+  if (mCold != NULL)
   {
-    return LIBSEDML_OPERATION_SUCCESS;
-  }
-  else
-  {
-    return LIBSEDML_OPERATION_FAILED;
+    mCold->mUserData = NULL;
   }
+
+  return LIBSEDML_OPERATION_SUCCESS;
 }
 
 /*
@@ -455,10 +816,13 @@ SedBase::unsetUserData()
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces*
 SedBase::getNamespaces()
 {
+  // a document never shares its SedNamespaces
   if (mSed != NULL)
-    return mSed->getSedNamespaces()->getNamespaces();
-  else
-    return mSedNamespaces->getNamespaces();
+    return mSed->mSedNamespaces->getNamespaces();
+
+  // the caller may modify the namespaces
+  ownSedNamespaces();
+  return mSedNamespaces->getNamespaces();
 }
 
 
@@ -622,7 +986,7 @@ SedBase::getColumn () const
 bool
 SedBase::isSetMetaId () const
 {
-  return (mMetaId.empty() == false);
+  return (mCold != NULL && mCold->mMetaId.empty() == false);
 }
 
 
@@ -645,7 +1009,7 @@ bool SedBase::isSetName() const
 bool
 SedBase::isSetNotes () const
 {
-  return (mNotes != NULL);
+  return (mCold != NULL && (mCold->mNotes != NULL || !mCold->mRawNotes.empty()));
 }
 
 
@@ -656,7 +1020,8 @@ SedBase::isSetNotes () const
 bool
 SedBase::isSetAnnotation () const
 {
-  return (mAnnotation != NULL);
+  return (mCold != NULL &&
+          (mCold->mAnnotation != NULL || !mCold->mRawAnnotation.empty()));
 }
 
 
@@ -668,8 +1033,7 @@ SedBase::setMetaId (const std::string& metaid)
 {
   if (metaid.empty())
   {
-    mMetaId.erase();
-    return LIBSEDML_OPERATION_SUCCESS;
+    return unsetMetaId();
   }
   else if (!(SyntaxChecker::isValidXMLID(metaid)))
   {
@@ -677,7 +1041,9 @@ SedBase::setMetaId (const std::string& metaid)
   }
   else
   {
-    mMetaId = metaid;
+    std::string oldMetaId = getStoredMetaId();
+    getColdFields().mMetaId = metaid;
+    updateDocumentIndex(getId(), oldMetaId);
     return LIBSEDML_OPERATION_SUCCESS;
   }
 }
@@ -690,8 +1056,7 @@ SedBase::setId (const std::string& sid)
 {
   if (sid.empty())
   {
-    mId.erase();
-    return LIBSEDML_OPERATION_SUCCESS;
+    return unsetId();
   }
   else if (!(SyntaxChecker::isValidXMLID(sid)))
   {
@@ -701,7 +1066,10 @@ SedBase::setId (const std::string& sid)
   {
       return LIBSEDML_UNEXPECTED_ATTRIBUTE;
   }
+  std::string oldId = getId();
   mId = sid;
+  updateParentIdIndex(oldId);
+  updateDocumentIndex(oldId, getStoredMetaId());
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -729,15 +1097,24 @@ SedBase::setAnnotation (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annotation)
 {
   if (annotation == NULL)
   {
-    delete mAnnotation;
-    mAnnotation = NULL;
+    if (mCold != NULL)
+    {
+      mCold->mRawAnnotation.clear();
+      delete mCold->mAnnotation;
+      mCold->mAnnotation = NULL;
+    }
+
+    return LIBSEDML_OPERATION_SUCCESS;
   }
 
-  if (mAnnotation != annotation)
+  SedBaseColdFields& cold = getColdFields();
+  cold.mRawAnnotation.clear();
+
+  if (cold.mAnnotation != annotation)
   {
-    delete mAnnotation;
+    delete cold.mAnnotation;
 
-    mAnnotation = annotation->clone();
+    cold.mAnnotation = annotation->clone();
   }
 
   return LIBSEDML_OPERATION_SUCCESS;
@@ -794,6 +1171,8 @@ SedBase::appendAnnotation (const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annota
   if(annotation == NULL)
     return LIBSEDML_OPERATION_SUCCESS;
 
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* current = getAnnotation();
+
   LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* new_annotation = NULL;
   const string&  name = annotation->getName();
 
@@ -810,22 +1189,22 @@ SedBase::appendAnnotation (const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annota
   }
 
 
-  if (mAnnotation != NULL)
+  if (current != NULL)
   {
-    // if mAnnotation is just <annotation/> need to tell
+    // if the annotation is just <annotation/> need to tell
     // it to no longer be an end
-    if (mAnnotation->isEnd())
+    if (current->isEnd())
     {
-      mAnnotation->unsetEnd();
+      current->unsetEnd();
     }
 
 
     // create a list of existing top level ns
       vector<string> topLevelNs;
     unsigned int i = 0;
-    for(i = 0; i < mAnnotation->getNumChildren(); i++)
+    for(i = 0; i < current->getNumChildren(); i++)
     {
-          topLevelNs.push_back(mAnnotation->getChild(i).getName());
+          topLevelNs.push_back(current->getChild(i).getName());
     }
 
 
@@ -834,7 +1213,7 @@ SedBase::appendAnnotation (const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annota
     {
           if (find(topLevelNs.begin(), topLevelNs.end(), (new_annotation->getChild(i).getName())) != topLevelNs.end())
       {
-        mAnnotation->addChild(new_annotation->getChild(i));
+        current->addChild(new_annotation->getChild(i));
       }
       else
       {
@@ -850,7 +1229,7 @@ SedBase::appendAnnotation (const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annota
     }
     else
     {
-      LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode *copy = mAnnotation->clone();
+      LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode *copy = current->clone();
       success = setAnnotation(copy);
       delete copy;
     }
@@ -903,13 +1282,14 @@ SedBase::removeTopLevelAnnotationElement(const std::string elementName,
 {
 
   int success = LIBSEDML_OPERATION_FAILED;
-  if (mAnnotation == NULL)
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* current = getAnnotation();
+  if (current == NULL)
   {
     success = LIBSEDML_OPERATION_SUCCESS;
     return success;
   }
 
-  int index = mAnnotation->getIndex(elementName);
+  int index = current->getIndex(elementName);
   if (index < 0)
   {
     // the annotation does not have a child of this name
@@ -921,7 +1301,7 @@ SedBase::removeTopLevelAnnotationElement(const std::string elementName,
     // check uri matches
     if (elementURI.empty() == false)
     {
-      LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode child = mAnnotation->getChild(index);
+      LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode child = current->getChild(index);
       std::string prefix = child.getPrefix();
 
       if (prefix.empty() == false
@@ -953,16 +1333,16 @@ SedBase::removeTopLevelAnnotationElement(const std::string elementName,
     }
 
     // remove the annotation at the index corresponding to the name
-    delete mAnnotation->removeChild(index);
+    delete current->removeChild(index);
 
-      if (mAnnotation->getNumChildren() == 0)
+      if (current->getNumChildren() == 0)
         {
-          delete mAnnotation;
-          mAnnotation = NULL;
+          unsetAnnotation();
+          current = NULL;
         }
 
     // check success
-    if (mAnnotation == NULL || mAnnotation->getIndex(elementName) < 0)
+    if (current == NULL || current->getIndex(elementName) < 0)
     {
       success = LIBSEDML_OPERATION_SUCCESS;
     }
@@ -1038,31 +1418,33 @@ SedBase::replaceTopLevelAnnotationElement(const std::string& annotation)
 int
 SedBase::setNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
 {
-  if (mNotes == notes)
+  if (notes == NULL)
   {
-    return LIBSEDML_OPERATION_SUCCESS;
+    return unsetNotes();
   }
-  else if (notes == NULL)
+
+  SedBaseColdFields& cold = getColdFields();
+  cold.mRawNotes.clear();
+
+  if (cold.mNotes == notes)
   {
-    delete mNotes;
-    mNotes = NULL;
     return LIBSEDML_OPERATION_SUCCESS;
   }
 
-  delete mNotes;
+  delete cold.mNotes;
   const string&  name = notes->getName();
 
   /* check for notes tags and add if necessary */
 
   if (name == "notes")
   {
-    mNotes = static_cast<LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*>( notes->clone() );
+    cold.mNotes = static_cast<LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*>( notes->clone() );
   }
   else
   {
     LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken notes_t = LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLTriple("notes", "", ""),
                                 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLAttributes());
-    mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(notes_t);
+    cold.mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(notes_t);
 
     // The root node of the given XMLNode tree can be an empty XMLNode
     // (i.e. neither start, end, nor text XMLNode) if the given notes was
@@ -1073,7 +1455,7 @@ SedBase::setNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
     {
       for (unsigned int i=0; i < notes->getNumChildren(); i++)
       {
-        if (mNotes->addChild(notes->getChild(i)) < 0)
+        if (cold.mNotes->addChild(notes->getChild(i)) < 0)
         {
           return LIBSEDML_OPERATION_FAILED;
         }
@@ -1081,15 +1463,15 @@ SedBase::setNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
     }
     else
     {
-      if (mNotes->addChild(*notes) < 0)
+      if (cold.mNotes->addChild(*notes) < 0)
         return LIBSEDML_OPERATION_FAILED;
     }
   }
 
-    if (!SyntaxChecker::hasExpectedXHTMLSyntax(mNotes, NULL))
+    if (!SyntaxChecker::hasExpectedXHTMLSyntax(cold.mNotes, NULL))
     {
-      delete mNotes;
-      mNotes = NULL;
+      delete cold.mNotes;
+      cold.mNotes = NULL;
       return LIBSEDML_INVALID_OBJECT;
     }
 
@@ -1176,6 +1558,8 @@ SedBase::appendNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
     return LIBSEDML_OPERATION_SUCCESS;
   }
 
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* current = getNotes();
+
   const string&  name = notes->getName();
 
   // The content of notes in SED-ML can consist only of the following
@@ -1329,7 +1713,7 @@ SedBase::appendNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
   }
 
 
-  if ( mNotes != NULL )
+  if ( current != NULL )
   {
     //------------------------------------------------------------
     //
@@ -1338,7 +1722,7 @@ SedBase::appendNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
     //------------------------------------------------------------
 
     _NotesType curNotesType   = _ANotesAny;
-    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode&  curNotes = *mNotes;
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode&  curNotes = *current;
 
     // curNotes.getChild(0) must be "html", "body", or any XHTML
     // element that would be permitted within a "body" element .
@@ -1497,7 +1881,7 @@ SedBase::appendNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
       success = LIBSEDML_OPERATION_SUCCESS;
     }
   }
-  else // if (mNotes == NULL)
+  else // if (current == NULL)
   {
     // setNotes accepts XMLNode with/without top level notes tags.
     success = setNotes(notes);
@@ -1548,7 +1932,24 @@ SedBase::appendNotes(const std::string& notes)
 void
 SedBase::setSedDocument (SedDocument* d)
 {
+  if (mSed == d)
+  {
+    return;
+  }
+
+  // the overrides pass the document on to every descendant, which keeps
+  // the SId/metaid index of the document(s) involved up to date
+  if (mSed != NULL && mSed != this)
+  {
+    mSed->removeFromElementIndex(this);
+  }
+
   mSed = d;
+
+  if (mSed != NULL && mSed != this)
+  {
+    mSed->addToElementIndex(this);
+  }
 }
 
 
@@ -1655,7 +2056,15 @@ SedBase::getAncestorOfType(int type) const
 int
 SedBase::setNamespaces(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* xmlns)
 {
-  if (xmlns == NULL)
+  if (mSedNamespaces->isShared())
+  {
+    SedNamespaces* sedmlns = SedNamespaces::getShared(
+      mSedNamespaces->getLevel(), mSedNamespaces->getVersion(), xmlns);
+    SedNamespaces::releaseShared(mSedNamespaces);
+    mSedNamespaces = sedmlns;
+    return LIBSEDML_OPERATION_SUCCESS;
+  }
+  else if (xmlns == NULL)
   {
     mSedNamespaces->setNamespaces(NULL);
     return LIBSEDML_OPERATION_SUCCESS;
@@ -1675,7 +2084,9 @@ SedBase::setNamespaces(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* xmlns)
 int
 SedBase::unsetMetaId ()
 {
-  mMetaId.erase();
+  std::string oldMetaId = getStoredMetaId();
+  if (mCold != NULL) mCold->mMetaId.erase();
+  updateDocumentIndex(getId(), oldMetaId);
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -1686,7 +2097,10 @@ SedBase::unsetMetaId ()
 int
 SedBase::unsetId ()
 {
+  std::string oldId = getId();
   mId.erase();
+  updateParentIdIndex(oldId);
+  updateDocumentIndex(oldId, getStoredMetaId());
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -1703,8 +2117,13 @@ int SedBase::unsetName()
 int
 SedBase::unsetNotes ()
 {
-  delete mNotes;
-  mNotes = NULL;
+  if (mCold != NULL)
+  {
+    mCold->mRawNotes.clear();
+    delete mCold->mNotes;
+    mCold->mNotes = NULL;
+  }
+
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -1821,8 +2240,8 @@ SedBase::matchesCoreSedNamespace(const SedBase * sb)
 {
   bool match = false;
 
-  SedNamespaces *sedmlns = getSedNamespaces();
-  SedNamespaces *sedmlns_rhs = sb->getSedNamespaces();
+  const SedNamespaces *sedmlns = getSedNamespaces();
+  const SedNamespaces *sedmlns_rhs = sb->getSedNamespaces();
 
   if (sedmlns->getLevel() != sedmlns_rhs->getLevel())
     return match;
@@ -1848,8 +2267,8 @@ SedBase::matchesCoreSedNamespace(const SedBase * sb) const
 {
   bool match = false;
 
-  SedNamespaces *sedmlns = getSedNamespaces();
-  SedNamespaces *sedmlns_rhs = sb->getSedNamespaces();
+  const SedNamespaces *sedmlns = getSedNamespaces();
+  const SedNamespaces *sedmlns_rhs = sb->getSedNamespaces();
 
   if (sedmlns->getLevel() != sedmlns_rhs->getLevel())
     return match;
@@ -1916,7 +2335,7 @@ SedBase::hasValidLevelVersionNamespaceCombination(int typecode, LIBSBML_CPP_NAME
 
 /* sets the Sednamespaces - internal use only*/
 int
-SedBase::setSedNamespaces(SedNamespaces * sedmlns)
+SedBase::setSedNamespaces(const SedNamespaces * sedmlns)
 {
   if (sedmlns == NULL)
     return LIBSEDML_INVALID_OBJECT;
@@ -1936,17 +2355,27 @@ SedBase::setSedNamespacesAndOwn(SedNamespaces * sedmlns)
 {
     XMLNamespaces* names = mSedNamespaces->getNamespaces();
     XMLNamespaces* newnames = sedmlns->getNamespaces();
-    for (int name = 0; name < names->getNumNamespaces(); name++)
+    for (int name = 0; names != NULL && name < names->getNumNamespaces(); name++)
     {
         if (!names->getPrefix(name).empty())
         {
-            if (!newnames->containsUri(names->getURI(name)))
+            if (newnames == NULL || !newnames->containsUri(names->getURI(name)))
             {
                 sedmlns->addNamespace(names->getURI(name), names->getPrefix(name));
+                newnames = sedmlns->getNamespaces();
             }
         }
     }
-    delete mSedNamespaces;
+
+    // objects other than documents keep pointing at a shared instance
+    if (mSedNamespaces->isShared())
+    {
+        SedNamespaces* shared = SedNamespaces::getShared(sedmlns);
+        delete sedmlns;
+        sedmlns = shared;
+    }
+
+    SedNamespaces::releaseShared(mSedNamespaces);
     mSedNamespaces = sedmlns;
 
     if (sedmlns != NULL)
@@ -1955,7 +2384,7 @@ SedBase::setSedNamespacesAndOwn(SedNamespaces * sedmlns)
 
 
 /* gets the Sednamespaces - internal use only*/
-SedNamespaces *
+const SedNamespaces *
 SedBase::getSedNamespaces() const
 {
   if (mSed != NULL)
@@ -1963,9 +2392,24 @@ SedBase::getSedNamespaces() const
   
   // initialize SED-ML namespace if need be
   if (mSedNamespaces == NULL)
-    const_cast<SedBase*>(this)->mSedNamespaces = new SedNamespaces(getLevel(), getVersion());
+    const_cast<SedBase*>(this)->mSedNamespaces = SedNamespaces::getShared(getLevel(), getVersion());
   return mSedNamespaces;  
 }
+
+
+/*
+ * Replaces a shared SedNamespaces by a private copy that may be modified.
+ */
+void
+SedBase::ownSedNamespaces()
+{
+  if (mSedNamespaces != NULL && mSedNamespaces->isShared())
+  {
+    SedNamespaces* sedmlns = mSedNamespaces->clone();
+    SedNamespaces::releaseShared(mSedNamespaces);
+    mSedNamespaces = sedmlns;
+  }
+}
 /** @endcond */
 
 
@@ -1977,7 +2421,7 @@ char*
 SedBase::toSed ()
 {
   ostringstream    os;
-  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream  stream(os, "UTF-8", false);
+  SedXMLOutputStream stream(os, "UTF-8", false);
 
   write(stream);
 
@@ -2222,7 +2666,7 @@ SedBase::read (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     // need to check that any prefix on the sedmlns also occurs on element
     // remembering the horrible situation where the sedmlns might be declared
     // with more than one prefix
-    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces * xmlns = this->getSedNamespaces()->getNamespaces();
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces * xmlns = this->getSedNamespaces()->getNamespaces();
     if (xmlns != NULL)
     {
       int i = xmlns->getIndexByPrefix(element.getPrefix());
@@ -2265,8 +2709,7 @@ SedBase::read (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
 
         if (error == true && errorLoggedAlready == false)
         {
-          static ostringstream errMsg;
-          errMsg.str("");
+          ostringstream errMsg;
           errMsg << "The prefix for the <sedml> element does not match "
             << "the prefix for the SED-ML namespace.  This means that "
             << "the <sedml> element in not in the SedNamespace."<< endl;
@@ -2322,6 +2765,12 @@ SedBase::read (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     {
       const std::string nextName = next.getName();
 
+      if (isSkippedOnRead(nextName))
+      {
+        stream.skipPastEnd( stream.next() );
+        continue;
+      }
+
       SedBase * object = createObject(stream);
 
       if (object != NULL)
@@ -2386,9 +2835,14 @@ SedBase::write (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream& stream) const
 void
 SedBase::writeElements (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream& stream) const
 {
-  if ( mNotes != NULL ) stream << *mNotes;
+  // markup that was read but never accessed is written back unchanged
+  if (mCold == NULL) return;
 
-  if (mAnnotation != NULL) stream << *mAnnotation;
+  if (!mCold->mRawNotes.empty()) writeRawXML(stream, mCold->mRawNotes);
+  else if ( mCold->mNotes != NULL ) stream << *mCold->mNotes;
+
+  if (!mCold->mRawAnnotation.empty()) writeRawXML(stream, mCold->mRawAnnotation);
+  else if (mCold->mAnnotation != NULL) stream << *mCold->mAnnotation;
 }
 
 
@@ -2427,6 +2881,41 @@ SedBase::readOtherXML (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
 /** @endcond */
 
 
+/** @cond doxygenLibsedmlInternal */
+/*
+ * @return true if the child element name is excluded by the load mask of
+ * the document being read
+ */
+bool
+SedBase::isSkippedOnRead (const std::string& name) const
+{
+  if (name == "notes")
+  {
+    return !isLoadedOnRead(SEDML_LOAD_NOTES);
+  }
+  else if (name == "annotation")
+  {
+    return !isLoadedOnRead(SEDML_LOAD_ANNOTATIONS);
+  }
+
+  return false;
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * @return true if the load mask of the parent document includes flag
+ */
+bool
+SedBase::isLoadedOnRead (unsigned int flag) const
+{
+  const SedDocument* doc = getSedDocument();
+  return (doc == NULL) || ((doc->getLoadMask() & flag) != 0);
+}
+/** @endcond */
+
+
 /** @cond doxygenLibsedmlInternal */
 /*
  * @return true if read an <annotation> element from the stream
@@ -2441,16 +2930,21 @@ SedBase::readAnnotation (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     // If an annotation already exists, log it as an error and replace
     // the content of the existing annotation with the new one.
 
-    if (mAnnotation != NULL)
+    if (isSetAnnotation())
     {
       string msg = "A SED-ML <" + getElementName() + "> element ";
       msg += "has multiple <annotation> children.";
       logError(SedMultipleAnnotations, getLevel(), getVersion(), msg);
     }
 
-    delete mAnnotation;
-    mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream);
-    checkAnnotation();
+    // keep the markup and only build the XMLNode tree when it is accessed;
+    // the outline holds just enough of it to validate the top level
+    SedBaseColdFields& cold = getColdFields();
+    delete cold.mAnnotation;
+    cold.mAnnotation = NULL;
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode outline;
+    cold.mRawAnnotation = readRawXML(stream, &outline);
+    checkAnnotation(&outline);
     return true;
   }
 
@@ -2474,19 +2968,22 @@ SedBase::readNotes (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     // If an annotation element already exists, then the ordering is wrong.
     // In either case, replace existing content with the new notes read.
 
-    if (mNotes != NULL)
+    if (isSetNotes())
     {
       logError(SedOnlyOneNotesElementAllowed, getLevel(), getVersion());
     }
 
-    delete mNotes;
-    mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream);
+    // keep the markup and only build the XMLNode tree when it is accessed
+    SedBaseColdFields& cold = getColdFields();
+    delete cold.mNotes;
+    cold.mNotes = NULL;
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces xmlns = stream.peek().getNamespaces();
+    cold.mRawNotes = readRawXML(stream);
 
     //
     // checks if the given default namespace (if any) is a valid
     // SED-ML namespace
     //
-    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces &xmlns = mNotes->getNamespaces();
     checkDefaultNamespace(&xmlns,"notes");
 
     return true;
@@ -2494,7 +2991,254 @@ SedBase::readNotes (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
 
   return false;
 }
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Builds the notes tree from the markup kept by readNotes().
+ */
+void
+SedBase::parseRawNotes () const
+{
+  if (mCold == NULL || mCold->mRawNotes.empty()) return;
+
+  delete mCold->mNotes;
+  mCold->mNotes = parseRawXML(mCold->mRawNotes);
+  mCold->mRawNotes.clear();
+}
+
+
+/*
+ * Builds the annotation tree from the markup kept by readAnnotation().
+ */
+void
+SedBase::parseRawAnnotation () const
+{
+  if (mCold == NULL || mCold->mRawAnnotation.empty()) return;
+
+  delete mCold->mAnnotation;
+  mCold->mAnnotation = parseRawXML(mCold->mRawAnnotation);
+  mCold->mRawAnnotation.clear();
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * @return the markup of the next element on the stream, with the
+ * namespaces it uses but inherits from its ancestors declared on it
+ */
+std::string
+SedBase::readRawXML (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream,
+                     LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* outline)
+{
+  std::ostringstream raw;
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStringStream out(raw, "UTF-8", false);
+  unsigned int depth = 0;
+
+  // the prefixes declared within the markup, with the depth of the element
+  // declaring them, and those it uses that are declared further up
+  std::vector<std::pair<unsigned int, std::string> > declared;
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces inherited;
+  std::streampos rootEnd = 0;
+
+  while (stream.isGood())
+  {
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken token = stream.next();
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLTriple triple(token.getName(),
+      token.getURI(), token.getPrefix());
+
+    if (token.isStart())
+    {
+      out.startElement(triple);
+
+      const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces& xmlns = token.getNamespaces();
+      for (int n = 0; n < xmlns.getLength(); ++n)
+      {
+        declared.push_back(std::make_pair(depth, xmlns.getPrefix(n)));
+
+        if (xmlns.getPrefix(n).empty())
+          out.writeAttribute("xmlns", xmlns.getURI(n));
+        else
+          out.writeAttribute(xmlns.getPrefix(n), "xmlns", xmlns.getURI(n));
+      }
+
+      noteInheritedPrefix(token.getPrefix(), token.getURI(), declared,
+                          inherited);
+
+      const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLAttributes& attributes = token.getAttributes();
+      for (int n = 0; n < attributes.getLength(); ++n)
+      {
+        out.writeAttribute(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLTriple(
+          attributes.getName(n), attributes.getURI(n), attributes.getPrefix(n)),
+          attributes.getValue(n));
+        noteInheritedPrefix(attributes.getPrefix(n), attributes.getURI(n),
+                            declared, inherited);
+      }
+
+      if (depth == 0)
+      {
+        rootEnd = raw.tellp();
+      }
+
+      if (outline != NULL && depth == 0)
+      {
+        *outline = LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(token);
+      }
+      else if (outline != NULL && depth == 1)
+      {
+        outline->addChild(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(token));
+      }
+
+      ++depth;
+    }
+    else if (token.isText())
+    {
+      const std::string& chars = token.getCharacters();
+      out << chars;
+
+      if (outline != NULL && depth == 1 &&
+          chars.find_first_not_of(" \t\r\n") != std::string::npos)
+      {
+        outline->addChild(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(token));
+      }
+    }
+
+    if (token.isEnd())
+    {
+      out.endElement(triple);
+
+      while (depth > 0 && !declared.empty() &&
+             declared.back().first >= depth - 1)
+      {
+        declared.pop_back();
+      }
+
+      if (depth == 0 || --depth == 0) break;
+    }
+  }
+
+  std::string markup = raw.str();
+
+  if (inherited.getLength() > 0)
+  {
+    // declare them on the root element, so that the markup can be read
+    // on its own
+    std::ostringstream declarations;
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStringStream
+      declarationsOut(declarations, "UTF-8", false);
+    for (int n = 0; n < inherited.getLength(); ++n)
+    {
+      declarationsOut.writeAttribute(inherited.getPrefix(n), "xmlns",
+                                     inherited.getURI(n));
+    }
+
+    markup.insert(static_cast<std::string::size_type>(rootEnd),
+                  declarations.str());
+  }
+
+  return markup;
+}
+
+
+/*
+ * Adds @p prefix to @p inherited unless it is declared in @p declared or
+ * needs no declaration.
+ */
+void
+SedBase::noteInheritedPrefix (const std::string& prefix,
+  const std::string& uri,
+  const std::vector<std::pair<unsigned int, std::string> >& declared,
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces& inherited)
+{
+  if (prefix.empty() || uri.empty() || prefix == "xml" ||
+      prefix == "xmlns" || inherited.hasPrefix(prefix))
+  {
+    return;
+  }
+
+  for (size_t n = 0; n < declared.size(); ++n)
+  {
+    if (declared[n].second == prefix) return;
+  }
+
+  inherited.add(uri, prefix);
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * @return raw wrapped in a root element declaring the document namespaces
+ */
+std::string
+SedBase::wrapRawXML (const std::string& raw) const
+{
+  std::ostringstream wrapped;
+  wrapped << "<?xml version='1.0' encoding='UTF-8'?>" << "<sedRawXML";
+
+  const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* xmlns =
+    (mSed != NULL) ? mSed->getNamespaces() : NULL;
+  for (int n = 0; xmlns != NULL && n < xmlns->getLength(); ++n)
+  {
+    wrapped << " xmlns";
+    if (!xmlns->getPrefix(n).empty()) wrapped << ":" << xmlns->getPrefix(n);
+    wrapped << "=\"" << xmlns->getURI(n) << "\"";
+  }
+
+  wrapped << ">" << raw << "</sedRawXML>";
+  return wrapped.str();
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * @return a new XMLNode read from markup kept by readRawXML()
+ */
+LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
+SedBase::parseRawXML (const std::string& raw) const
+{
+  const std::string wrapped = wrapRawXML(raw);
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream stream(wrapped.c_str(), false);
+
+  stream.next();
+  return new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream);
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Writes markup kept by readRawXML() unchanged when the stream is a
+ * SedXMLOutputStream; any other XMLOutputStream gets it as a tree.
+ */
+void
+SedBase::writeRawXML (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream& stream,
+                      const std::string& raw) const
+{
+  SedXMLOutputStream* rawStream = dynamic_cast<SedXMLOutputStream*>(&stream);
+
+  if (rawStream != NULL)
+  {
+    rawStream->writeRaw(raw);
+    return;
+  }
+
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* node = parseRawXML(raw);
+
+  if (node != NULL)
+  {
+    stream << *node;
+  }
+
+  delete node;
+}
+/** @endcond */
+
 
+/** @cond doxygenLibsedmlInternal */
 bool
 SedBase::getHasBeenDeleted() const
 {
@@ -2503,6 +3247,18 @@ SedBase::getHasBeenDeleted() const
 /** @endcond */
 
 
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Returns the SedArena new children of this object are allocated from.
+ */
+SedArena*
+SedBase::getSedArena() const
+{
+  return (mSed != NULL) ? mSed->getArena() : NULL;
+}
+/** @endcond */
+
+
 /** @cond doxygenLibsedmlInternal */
 /*
  * @return the ordinal position of the element with respect to its siblings
@@ -2718,10 +3474,14 @@ SedBase::readAttributes (const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLAttributes& at
   // id SId (use = "optional" )
   // 
 
+  std::string oldId = getId();
   bool assigned = attributes.readInto("id", mId, getErrorLog(), false, getLine(), getColumn());
 
   if (assigned == true)
   {
+    updateParentIdIndex(oldId);
+    updateDocumentIndex(oldId, getStoredMetaId());
+
     if (mId.empty() == true)
     {
       logEmptyString(mId, level, version, (string)"<" + getElementName() + ">");
@@ -2748,9 +3508,17 @@ SedBase::readAttributes (const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLAttributes& at
     }
   }
 
-  assigned = attributes.readInto("metaid", mMetaId, getErrorLog(), false, getLine(), getColumn());
+  std::string metaid;
+  assigned = attributes.readInto("metaid", metaid, getErrorLog(), false, getLine(), getColumn());
 
-    if (assigned && mMetaId.empty())
+  if (assigned)
+  {
+    std::string oldMetaId = getStoredMetaId();
+    getColdFields().mMetaId = metaid;
+    updateDocumentIndex(getId(), oldMetaId);
+  }
+
+    if (assigned && metaid.empty())
     {
       logEmptyString("metaid", level, version,
                      SedTypeCode_toString(getTypeCode()));
@@ -2758,9 +3526,9 @@ SedBase::readAttributes (const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLAttributes& at
 
     if (isSetMetaId())
     {
-      if (!SyntaxChecker::isValidXMLID(mMetaId))
+      if (!SyntaxChecker::isValidXMLID(getMetaId()))
       {
-        logError(SedInvalidMetaidSyntax, getLevel(), getVersion(), "The metaid '" + mMetaId + "' does not conform to the syntax.");
+        logError(SedInvalidMetaidSyntax, getLevel(), getVersion(), "The metaid '" + getMetaId() + "' does not conform to the syntax.");
       }
   }
 
@@ -2851,9 +3619,9 @@ SedBase::writeAttributes (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream& strea
   {
       stream.writeAttribute("name", sedmlPrefix, mName);
   }
-  if ( !mMetaId.empty() )
+  if ( isSetMetaId() )
   {
-    stream.writeAttribute("metaid", sedmlPrefix, mMetaId);
+    stream.writeAttribute("metaid", sedmlPrefix, mCold->mMetaId);
   }
 
 }
@@ -2983,18 +3751,17 @@ SedBase::checkDefaultNamespace(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespac
     return;
 
   const std::string defaultURI = xmlns->getURI(prefix);
-  if (defaultURI.empty() || mURI == defaultURI)
+  if (defaultURI.empty() || *mURI == defaultURI)
     return;
 
   // if this element (SedBase derived) has notes or annotation elements,
   // it is ok for them to be in the SED-ML namespace!
   if ( SedNamespaces::isSedNamespace(defaultURI)
-       && !SedNamespaces::isSedNamespace(mURI)
+       && !SedNamespaces::isSedNamespace(*mURI)
        && (elementName == "notes" || elementName == "annotation"))
     return;
 
-  static ostringstream errMsg;
-  errMsg.str("");
+  ostringstream errMsg;
   errMsg << "xmlns=\"" << defaultURI << "\" in <" << elementName
          << "> element is an invalid namespace." << endl;
 
@@ -3008,6 +3775,16 @@ SedBase::checkDefaultNamespace(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespac
   */
 void
 SedBase::checkAnnotation()
+{
+  checkAnnotation(getAnnotation());
+}
+
+
+/*
+  * Checks the top-level children of the given annotation.
+  */
+void
+SedBase::checkAnnotation(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annotation)
 {
   unsigned int nNodes = 0;
   unsigned int match = 0;
@@ -3015,18 +3792,18 @@ SedBase::checkAnnotation()
   std::vector<std::string> uri_list;
   uri_list.clear();
 
-  if (mAnnotation == NULL) return;
+  if (annotation == NULL) return;
 
   //
   // checks if the given default namespace (if any) is a valid
   // SED-ML namespace
   //
-  const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces &xmlns = mAnnotation->getNamespaces();
+  const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces &xmlns = annotation->getNamespaces();
   checkDefaultNamespace(&xmlns,"annotation");
 
-  while (nNodes < mAnnotation->getNumChildren())
+  while (nNodes < annotation->getNumChildren())
   {
-    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode topLevel = mAnnotation->getChild(nNodes);
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode topLevel = annotation->getChild(nNodes);
 
     // the top level must be an element (so it should be a start)
     if (topLevel.isStart() == false)
@@ -3286,13 +4063,90 @@ SedBase::setSedBaseFields (const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken& eleme
 }
 
 
+/*
+ * Informs the parent SedListOf (if any) that the id of this object changed.
+ */
+void
+SedBase::updateParentIdIndex(const std::string& oldId)
+{
+  if (mParentSedObject != NULL
+    && mParentSedObject->getTypeCode() == SEDML_LIST_OF)
+  {
+    static_cast<SedListOf*>(mParentSedObject)->updateIdIndex(this, oldId);
+  }
+}
+
+
+/*
+ * Discards the effective styles cached by the SedDocument (if any).
+ */
+void
+SedBase::invalidateEffectiveStyles()
+{
+  if (mSed != NULL)
+  {
+    mSed->clearEffectiveStyleCache();
+  }
+}
+
+
+/*
+ * Discards the compiled math of the object owning this Variable, Parameter
+ * or list of them.
+ */
+void
+SedBase::invalidateCompiledMath()
+{
+  SedBase* owner = mParentSedObject;
+
+  if (owner != NULL && owner->getTypeCode() == SEDML_LIST_OF)
+  {
+    owner = owner->getParentSedObject();
+  }
+
+  if (owner != NULL)
+  {
+    owner->clearCompiledMath();
+  }
+}
+
+
+/*
+ * Objects without math have nothing to discard.
+ */
+void
+SedBase::clearCompiledMath()
+{
+}
+
+
+/*
+ * Informs the SedDocument (if any) that the id or metaid of this object
+ * changed.
+ */
+void
+SedBase::updateDocumentIndex(const std::string& oldId,
+                             const std::string& oldMetaId)
+{
+  if (mSed != NULL && mSed != this)
+  {
+    mSed->updateElementIndex(this, oldId, oldMetaId);
+  }
+}
+
+
 /*
  * Sets the XML namespace to which this element belongs to.
  */
 int
 SedBase::setElementNamespace(const std::string &uri)
 {
-  mURI = uri;
+  if (*mURI != uri)
+  {
+    const std::string* interned = SedNamespaces::internURI(uri);
+    SedNamespaces::releaseURI(mURI);
+    mURI = interned;
+  }
 
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -3303,7 +4157,7 @@ SedBase::setElementNamespace(const std::string &uri)
 const std::string&
 SedBase::getElementNamespace() const
 {
-  return mURI;
+  return *mURI;
 }
 /** @endcond */
 
@@ -48,6 +48,8 @@
 #include <sedml/SedNamespaces.h>
 #include <sedml/SedConstructorException.h>
 #include <sedml/SedElementFilter.h>
+#include <sedml/SedMemoryUsage.h>
+#include <sedml/common/SedArena.h>
 #include <sbml/util/List.h>
 #include <sbml/SyntaxChecker.h>
 #include <sbml/ExpectedAttributes.h>
@@ -57,6 +59,10 @@
 
 
 #include <string>
+#include <utility>
+#include <vector>
+#include <memory>
+#include <new>
 #include <stdexcept>
 #include <algorithm>
 
@@ -74,12 +80,22 @@ class XMLInputStream;
 class XMLNamespaces;
 class XMLOutputStream;
 class XMLToken;
+class ASTNode;
 
 LIBSBML_CPP_NAMESPACE_END
 
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
 class SedDocument;
+class SedBinaryOutputStream;
+class SedBinaryInputStream;
+struct SedBaseColdFields;
+
+/**
+ * A list of (attribute name, referenced identifier) pairs, as filled in by
+ * SedBase::collectSIdRefs().
+ */
+typedef std::vector< std::pair<std::string, std::string> > SedIdRefList;
 
 
 class LIBSEDML_EXTERN SedBase
@@ -101,6 +117,35 @@ public:
   SedBase& operator=(const SedBase& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move assignment operator for SedBase.
+   *
+   * This object keeps its place in its parent and document; the
+   * identifiers, notes and annotation of @p rhs are moved into it.
+   *
+   * @param rhs The object whose values are moved into this one; it is left
+   * without them.
+   */
+  SedBase& operator=(SedBase&& rhs);
+#endif /* !SWIG */
+
+
+  /** @cond doxygenLibsedmlInternal */
+  /*
+   * SED-ML objects are allocated through SedArena, so that objects created
+   * in a SedDocument with arena allocation enabled come from its pool while
+   * all others come from the heap; either kind may be deleted as usual.
+   */
+  static void* operator new (size_t size);
+  static void* operator new (size_t size, SedArena* arena);
+  static void* operator new (size_t size, const std::nothrow_t&) throw();
+  static void operator delete (void* ptr, size_t size);
+  static void operator delete (void* ptr, SedArena* arena);
+  static void operator delete (void* ptr, const std::nothrow_t&) throw();
+  /** @endcond */
+
+
   /** @cond doxygenLibsedmlInternal */
   /**
    * Accepts the given SedVisitor for this SedBase object.
@@ -176,6 +221,84 @@ public:
   virtual List* getAllElements(SedElementFilter* filter = NULL);
 
 
+  /**
+   * Appends the SIdRef attributes that are set on this object (the ones
+   * renameSIdRefs() acts on) to @p refs, as pairs of attribute name and
+   * referenced identifier. Identifiers used in the math of this object are
+   * reported under the name @c "math".
+   *
+   * Child objects are not visited; use getAllElements() for that.
+   *
+   * @param refs the list the references are appended to.
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * Returns the heap memory held by this object and all its descendants,
+   * broken down by type.
+   *
+   * @return a SedMemoryUsage with the number of objects and bytes per
+   * @if clike #SedTypeCode_t@else type code@endif.
+   *
+   * @see SedMemoryUsage
+   */
+  virtual SedMemoryUsage getMemoryUsage() const;
+
+
+  /**
+   * Adds the memory held by this object (but not its children) to
+   * @p usage: the object itself and the strings, math, XML and other data
+   * it owns. Child objects stored by value, such as the lists of a
+   * SedDocument, are counted as objects of their own and not included in
+   * the size of their parent.
+   *
+   * Child objects are not visited; use getMemoryUsage() for that.
+   *
+   * @param usage the SedMemoryUsage the counts are added to.
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibsedmlInternal */
+
+  /**
+   * Computes everything that the const accessors of this object would
+   * otherwise compute on first use: parsed notes and annotation, id
+   * indexes and other caches. Afterwards, reading the object does not
+   * modify it, so that it can be read from several threads at once.
+   *
+   * Child objects are not visited.
+   *
+   * @see SedFrozenDocument
+   */
+  virtual void prepareForConcurrentReads() const;
+
+  /** @endcond */
+
+
+  /** @cond doxygenLibsedmlInternal */
+
+  /**
+   * Writes the attributes, notes, annotation and children of this object
+   * to @p stream in the binary form read by readBinary().
+   *
+   * @see SedBinaryWriter
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * Reads the attributes, notes, annotation and children of this object
+   * from @p stream, replacing what it held before.
+   *
+   * @see SedBinaryReader
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the value of the "metaid" attribute of this object.
    *
@@ -1295,6 +1418,44 @@ public:
   /** @endcond */
 
 
+  /** @cond doxygenLibsedmlInternal */
+
+  /**
+   * Appends the names of all the identifiers used in @p math to @p refs,
+   * under the attribute name @c "math".
+   */
+  static void collectMathSIdRefs(const LIBSBML_CPP_NAMESPACE_QUALIFIER
+    ASTNode* math, SedIdRefList& refs);
+
+  /** @endcond */
+
+
+  /** @cond doxygenLibsedmlInternal */
+
+  /**
+   * Discards the effective styles cached by the SedDocument containing this
+   * object. Called by SedStyle, SedLine, SedMarker and SedFill whenever they
+   * change.
+   */
+  void invalidateEffectiveStyles ();
+
+
+  /**
+   * Discards the compiled math of the object that owns this object, when
+   * this is one of its Variable or Parameter children or their list.
+   * Called by SedParameter and SedListOf whenever they change.
+   */
+  void invalidateCompiledMath ();
+
+
+  /**
+   * Discards the compiled math of this object, if it has any.
+   */
+  virtual void clearCompiledMath ();
+
+  /** @endcond */
+
+
   /**
    * Sets the namespaces relevant of this SED-ML object.
    *
@@ -1673,7 +1834,7 @@ public:
 
   /** @cond doxygenLibsedmlInternal */
   /* sets the Sednamespaces - internal use only*/
-  int setSedNamespaces(SedNamespaces * sedmlns);
+  int setSedNamespaces(const SedNamespaces * sedmlns);
 
   /* sets the SedNamaepaces and owns the given object - internal use only */
   void setSedNamespacesAndOwn(SedNamespaces * disownedNs);
@@ -1681,8 +1842,18 @@ public:
 
 
   /** @cond doxygenLibsedmlInternal */
-  /* gets the Sednamespaces - internal use only*/
-  virtual SedNamespaces * getSedNamespaces() const;
+  /*
+   * gets the Sednamespaces - internal use only.  These may be shared with
+   * other objects; see ownSedNamespaces() before modifying them.
+   */
+  virtual const SedNamespaces * getSedNamespaces() const;
+
+
+  /*
+   * Replaces a shared SedNamespaces (see SedNamespaces::getShared()) by a
+   * private copy that may be modified - internal use only.
+   */
+  void ownSedNamespaces();
   /** @endcond */
 
 
@@ -1816,6 +1987,15 @@ protected:
 
   bool getHasBeenDeleted() const;
 
+
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Returns the SedArena new children of this object are allocated from:
+   * that of the SedDocument containing it, or @c NULL (the heap).
+   */
+  SedArena* getSedArena() const;
+  /** @endcond */
+
   /** 
    * When overridden allows SedBase elements to use the text included in between
    * the elements tags. The default implementation does nothing.
@@ -1841,7 +2021,7 @@ protected:
    * Creates a new SedBase object with the given SedNamespaces.
    * Only subclasses may create SedBase objects.
    */
-  SedBase (SedNamespaces* sedmlns);
+  SedBase (const SedNamespaces* sedmlns);
 
 
   /**
@@ -1852,6 +2032,17 @@ protected:
   SedBase(const SedBase& orig);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor. Takes over the identifiers, notes and annotation of
+   * @p orig; like a copy, the new object has no parent or document.
+   *
+   * @param orig the object to move from.
+   */
+  SedBase(SedBase&& orig);
+#endif /* !SWIG */
+
+
   /**
    * Subclasses should override this method to create, store, and then
    * return an SED-ML object corresponding to the next XMLToken in the
@@ -1889,6 +2080,26 @@ protected:
   virtual bool readOtherXML (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream);
 
 
+  /**
+   * Returns @c true if the child element @p name is to be skipped while
+   * reading, because the load mask of the document being read excludes it.
+   * Skipped elements are scanned past without constructing any objects.
+   *
+   * Subclasses with optional content of their own should override this
+   * method and call their parents implementation for any other name.
+   *
+   * @see SedReader::setLoadMask()
+   */
+  virtual bool isSkippedOnRead (const std::string& name) const;
+
+
+  /**
+   * Returns @c true if the load mask of the document this object belongs
+   * to includes @p flag (one of the SedLoadMask_t values).
+   */
+  bool isLoadedOnRead (unsigned int flag) const;
+
+
   /**
    * The SED-ML XML Schema is written such that the order of child elements
    * is significant.  LibSEDML can read elements out of order.  If you
@@ -2008,6 +2219,57 @@ protected:
   void checkAnnotation();
 
 
+  /**
+   * Checks the given annotation does not declare an sedml namespace.
+   * Only the top-level children of @p annotation are inspected.
+   */
+  void checkAnnotation(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annotation);
+
+
+  /**
+   * Reads the next element from the stream and returns its markup without
+   * building an XMLNode tree for it.  Prefixes that the markup uses but
+   * that are declared on its ancestors are declared on its root element.
+   *
+   * If @p outline is not @c NULL, it is set to the element together with
+   * its top-level children (element starts and non-blank text) only.
+   */
+  static std::string readRawXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream,
+                                LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* outline = NULL);
+
+
+  /**
+   * Adds @p prefix, bound to @p uri, to @p inherited unless it is one of
+   * the @p declared prefixes or needs no declaration.
+   */
+  static void noteInheritedPrefix(const std::string& prefix,
+    const std::string& uri,
+    const std::vector<std::pair<unsigned int, std::string> >& declared,
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces& inherited);
+
+
+  /**
+   * Returns @p raw wrapped in a root element that declares the namespaces
+   * of the parent SedDocument, ready to be read by an XMLInputStream.
+   */
+  std::string wrapRawXML(const std::string& raw) const;
+
+
+  /**
+   * Parses markup obtained from readRawXML() into a new XMLNode.
+   */
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* parseRawXML(const std::string& raw) const;
+
+
+  /**
+   * Writes markup obtained from readRawXML() to the stream as a child
+   * element: unchanged if the stream is a SedXMLOutputStream, as SedWriter
+   * uses, and parsed and serialized otherwise.
+   */
+  void writeRawXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream& stream,
+                   const std::string& raw) const;
+
+
   /**
    * Checks that the XHTML is valid.
    * If the xhtml does not conform to the specification of valid xhtml within
@@ -2071,25 +2333,14 @@ protected:
   // ------------------------------------------------------------------
 
 
-  std::string     mMetaId;
   std::string     mId;
   std::string     mName;
-  bool            mIdAllowedPreV4;
-  bool            mNameAllowedPreV4;
-  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*        mNotes;
-  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*        mAnnotation;
   SedDocument*   mSed;
+  // shared with other objects except in a SedDocument; see ownSedNamespaces()
   SedNamespaces* mSedNamespaces;
-  void*          mUserData;
-
-  unsigned int mLine;
-  unsigned int mColumn;
 
   /* store the parent SED-ML object */
   SedBase* mParentSedObject;
-  bool mHasBeenDeleted;
-
-  std::string mEmptyString;
 
   //
   // namespace to which this SedBase object belongs.
@@ -2107,7 +2358,26 @@ protected:
   // if the prefix needs to be added when printing elements in some package extension.
   // (i.e. used in getPrefix function)
   //
-  std::string mURI;
+  // Points at a string interned by SedNamespaces::internURI(), which is
+  // shared by all objects in the same namespace; each object holds a
+  // reference that its destructor gives back with releaseURI().
+  //
+  const std::string* mURI;
+
+  //
+  // metaid, notes, annotation and user data; most objects have none of
+  // these, so they are only allocated once one is set (see getColdFields()).
+  //
+  mutable SedBaseColdFields* mCold;
+
+  unsigned int mLine;
+  unsigned int mColumn;
+
+  bool            mIdAllowedPreV4;
+  bool            mNameAllowedPreV4;
+  bool mHasBeenDeleted;
+
+  friend class SedBinaryInputStream;
 
   
   /** @endcond */
@@ -2137,6 +2407,50 @@ private:
   bool readNotes (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream);
 
 
+  /**
+   * Builds the notes and annotation trees from the markup kept by
+   * readNotes() and readAnnotation(), if they have not been accessed yet.
+   */
+  void parseRawNotes() const;
+  void parseRawAnnotation() const;
+
+
+  /**
+   * Returns the rarely used fields of this object, allocating them first
+   * if none has been set yet.
+   */
+  SedBaseColdFields& getColdFields() const;
+
+
+  /**
+   * Returns the "metaid" of this object without allocating the rarely used
+   * fields.
+   */
+  const std::string& getStoredMetaId() const;
+
+
+  /**
+   * Lets the SedListOf containing this object (if any) know that the
+   * "id" of this object changed from @p oldId.
+   */
+  void updateParentIdIndex (const std::string& oldId);
+
+
+  /**
+   * Lets the SedDocument containing this object (if any) know that the
+   * "id" or "metaid" of this object changed from @p oldId / @p oldMetaId.
+   */
+  void updateDocumentIndex (const std::string& oldId,
+                            const std::string& oldMetaId);
+
+
+  /**
+   * Returns the first descendant (in document order) whose "id", or
+   * "metaid" if @p isMetaId is true, equals @p key.
+   */
+  const SedBase* findElement (const std::string& key, bool isMetaId) const;
+
+
   /** @endcond */
 };
 
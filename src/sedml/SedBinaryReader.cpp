@@ -0,0 +1,193 @@
+/**
+ * @file SedBinaryReader.cpp
+ * @brief Implementation of the SedBinaryReader class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+#include <fstream>
+#include <iterator>
+
+#include <sbml/util/util.h>
+
+#include <sedml/SedError.h>
+#include <sedml/SedErrorLog.h>
+#include <sedml/SedDocument.h>
+#include <sedml/SedBinaryStream.h>
+#include <sedml/SedBinaryReader.h>
+#include <sedml/common/SedMappedFile.h>
+
+/** @cond doxygenIgnored */
+
+using namespace std;
+
+/** @endcond */
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+#ifdef __cplusplus
+
+/*
+ * Creates a new SedBinaryReader.
+ */
+SedBinaryReader::SedBinaryReader ()
+  : mArenaAllocation (false)
+{
+}
+
+
+/*
+ * Destroys this SedBinaryReader.
+ */
+SedBinaryReader::~SedBinaryReader ()
+{
+}
+
+
+/*
+ * Reads a SedDocument from the binary file filename; the file is decoded
+ * from a memory mapping where possible, and read into memory otherwise.
+ */
+SedDocument*
+SedBinaryReader::readSedML (const std::string& filename)
+{
+  SedMappedFile mapped(filename);
+
+  if (mapped.getData() != NULL)
+  {
+    return readInternal(mapped.getData(), mapped.getSize());
+  }
+
+  std::ifstream stream(filename.c_str(), ios_base::in | ios_base::binary);
+
+  if (!util_file_exists(filename.c_str()) || !stream.is_open())
+  {
+    SedDocument* d = new SedDocument();
+    d->getErrorLog()->logError(XMLFileUnreadable);
+    return d;
+  }
+
+  const std::string data((std::istreambuf_iterator<char>(stream)),
+                         std::istreambuf_iterator<char>());
+  return readInternal(data.data(), data.size());
+}
+
+
+/*
+ * Reads a SedDocument from a buffer owned by the caller.
+ */
+SedDocument*
+SedBinaryReader::readSedMLFromBuffer (const void* data, size_t length)
+{
+  return readInternal(data, length);
+}
+
+
+/*
+ * Reads a SedDocument from a string holding its binary form.
+ */
+SedDocument*
+SedBinaryReader::readSedMLFromStdString (const std::string& data)
+{
+  return readInternal(data.data(), data.size());
+}
+
+
+/*
+ * Sets whether documents read by this SedBinaryReader allocate their
+ * objects from a pool.
+ */
+void
+SedBinaryReader::setArenaAllocation (bool enable)
+{
+  mArenaAllocation = enable;
+}
+
+
+/*
+ * Returns whether documents read by this SedBinaryReader allocate their
+ * objects from a pool.
+ */
+bool
+SedBinaryReader::getArenaAllocation () const
+{
+  return mArenaAllocation;
+}
+
+
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * Used by the read methods: checks the header, then reads the document
+ * with the level and version recorded in it.  Anything left over after the
+ * document counts as corruption.
+ */
+SedDocument*
+SedBinaryReader::readInternal (const void* data, size_t length)
+{
+  SedBinaryInputStream stream(data, length);
+  unsigned int level = 0;
+  unsigned int version = 0;
+
+  if (!stream.readHeader(level, version))
+  {
+    SedDocument* d = new SedDocument();
+    d->getErrorLog()->logError(SedInvalidBinaryFormat);
+    return d;
+  }
+
+  SedDocument* d = new SedDocument(level, version);
+  d->setArenaAllocation(mArenaAllocation);
+  d->readBinary(stream);
+
+  if (!stream.isAtEnd())
+  {
+    d->getErrorLog()->logError(SedInvalidBinaryFormat, level, version);
+  }
+
+  return d;
+}
+
+/** @endcond */
+
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_EXTERN
+SedDocument_t *
+readSedMLFromBinaryFile (const char *filename)
+{
+  SedBinaryReader sr;
+  return (filename != NULL) ? sr.readSedML(filename) : sr.readSedML("");
+}
+
+
+LIBSEDML_CPP_NAMESPACE_END
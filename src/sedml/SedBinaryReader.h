@@ -0,0 +1,204 @@
+/**
+ * @file SedBinaryReader.h
+ * @brief Definition of the SedBinaryReader class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedBinaryReader
+ * @sbmlbrief{} Reads a SedDocument from the binary form written by
+ * SedBinaryWriter.
+ *
+ * Reading the binary form does not involve an XML parser: the data is
+ * decoded in a single pass and strings are taken directly from its string
+ * table.  Files are read from a read-only memory mapping on platforms that
+ * support it, so that they are never copied as a whole.
+ *
+ * Data that is not in a format version and byte order this copy of
+ * libSEDML can read, or that is truncated or otherwise corrupt, results in
+ * a SedDocument with a @c SedInvalidBinaryFormat error in its error log,
+ * holding whatever could be read before the problem was found.
+ *
+ * @see SedBinaryWriter
+ */
+
+
+#ifndef SedBinaryReader_h
+#define SedBinaryReader_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <cstddef>
+#include <string>
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedDocument;
+
+
+class LIBSEDML_EXTERN SedBinaryReader
+{
+public:
+
+  /**
+   * Creates a new SedBinaryReader.
+   */
+  SedBinaryReader ();
+
+
+  /**
+   * Destroys this SedBinaryReader.
+   */
+  virtual ~SedBinaryReader ();
+
+
+  /**
+   * Reads a SedDocument from the binary file @p filename.
+   *
+   * @param filename the name or full pathname of the file to be read.
+   *
+   * @return a pointer to the SedDocument created from the content of
+   * @p filename.  Problems encountered while reading the file are recorded
+   * in the error log of the document.
+   *
+   * @see SedError
+   * @see SedDocument
+   */
+  SedDocument* readSedML (const std::string& filename);
+
+
+#ifndef SWIG
+
+  /**
+   * Reads a SedDocument from a buffer owned by the caller.
+   *
+   * The buffer is decoded in place, without being copied, and must stay
+   * valid until this method returns.
+   *
+   * @param data the first byte of the binary form of a document.
+   *
+   * @param length the size of the binary form in bytes.
+   *
+   * @return a pointer to the SedDocument created from the content of the
+   * buffer.
+   */
+  SedDocument* readSedMLFromBuffer (const void* data, size_t length);
+
+
+  /**
+   * Reads a SedDocument from a string holding its binary form, as returned
+   * by SedBinaryWriter::writeSedMLToStdString().
+   *
+   * @param data the binary form of a document.
+   *
+   * @return a pointer to the SedDocument created from @p data.
+   */
+  SedDocument* readSedMLFromStdString (const std::string& data);
+
+#endif
+
+
+  /**
+   * Sets whether the documents read by subsequent calls to the read methods
+   * of this SedBinaryReader allocate their objects from a pool.
+   *
+   * @param enable @c true to read documents into a pool; the default is
+   * @c false.
+   *
+   * @see SedReader::setArenaAllocation(bool enable)
+   */
+  void setArenaAllocation (bool enable);
+
+
+  /**
+   * Returns whether the documents read by this SedBinaryReader allocate
+   * their objects from a pool.
+   *
+   * @return @c true if arena allocation is enabled, @c false otherwise.
+   *
+   * @see setArenaAllocation(bool enable)
+   */
+  bool getArenaAllocation () const;
+
+
+protected:
+  /** @cond doxygenLibsedmlInternal */
+
+  /**
+   * Used by the read methods to decode a buffer.
+   */
+  SedDocument* readInternal (const void* data, size_t length);
+
+
+  bool mArenaAllocation;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+BEGIN_C_DECLS
+
+
+/**
+ * Reads a SedDocument from the binary file named by @p filename.  This
+ * convenience function is functionally equivalent to:
+ *
+ *   SedBinaryReader().readSedML(filename);
+ *
+ * @param filename the name or full pathname of the file to be read.
+ *
+ * @return a pointer to the SedDocument structure created from the content
+ * of @p filename.
+ *
+ * @if conly
+ * @memberof SedDocument_t
+ * @endif
+ */
+LIBSEDML_EXTERN
+SedDocument_t *
+readSedMLFromBinaryFile (const char *filename);
+
+
+END_C_DECLS
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* SedBinaryReader_h */
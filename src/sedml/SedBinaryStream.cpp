@@ -0,0 +1,1271 @@
+/**
+ * @file SedBinaryStream.cpp
+ * @brief Implementation of the SED-ML binary stream classes.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+#include <sedml/SedBinaryStream.h>
+#include <sedml/SedTypes.h>
+
+#include <sbml/math/ASTNode.h>
+#include <sbml/xml/XMLNode.h>
+#include <sbml/xml/XMLInputStream.h>
+#include <sbml/xml/XMLOutputStream.h>
+#include <numl/DimensionDescription.h>
+
+#include <cstring>
+#include <sstream>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+LIBNUML_CPP_NAMESPACE_USE
+
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+static const char sMagic[8] = { 'S', 'E', 'D', 'M', 'L', 'B', 'I', 'N' };
+static const unsigned int sByteOrderMark = 0x01020304;
+
+/*
+ * Math and XML trees nested deeper than this are rejected on reading, so
+ * that a corrupt buffer cannot exhaust the stack.
+ */
+static const unsigned int sMaxDepth = 10000;
+
+/*
+ * Objects nest only a few levels deep in practice, but the parameters of
+ * an algorithm can contain parameters without limit; objects nested deeper
+ * than this are rejected on reading.
+ */
+static const unsigned int sMaxObjectDepth = 1000;
+
+/*
+ * Flags of the optional parts of an AST node.
+ */
+enum
+{
+  MATH_NAME = 1,
+  MATH_UNITS = 2,
+  MATH_DEFINITION_URL = 4,
+  MATH_ID = 8,
+  MATH_CLASS = 16,
+  MATH_STYLE = 32,
+  MATH_BVAR = 64,
+  MATH_SEMANTICS = 128
+};
+
+/*
+ * Flags of the kind of an XML node.
+ */
+enum
+{
+  XML_START = 1,
+  XML_END = 2,
+  XML_TEXT = 4
+};
+
+/*
+ * The forms XML content can be stored in.
+ */
+enum
+{
+  XML_CONTENT_NONE = 0,
+  XML_CONTENT_RAW = 1,
+  XML_CONTENT_TREE = 2
+};
+
+/** @endcond */
+
+
+/*
+ * Creates a new, empty SedBinaryOutputStream.
+ */
+SedBinaryOutputStream::SedBinaryOutputStream()
+  : mBody ()
+  , mStringIndex ()
+  , mStrings ()
+{
+}
+
+
+/*
+ * Returns the header, the string table and the body.
+ */
+std::string
+SedBinaryOutputStream::getBytes(unsigned int level,
+                                unsigned int version) const
+{
+  SedBinaryOutputStream header;
+
+  header.mBody.append(sMagic, sizeof(sMagic));
+  header.mBody.append(reinterpret_cast<const char*>(&FORMAT_VERSION),
+                      sizeof(FORMAT_VERSION));
+  header.mBody.append(reinterpret_cast<const char*>(&sByteOrderMark),
+                      sizeof(sByteOrderMark));
+  header.writeUnsigned(level);
+  header.writeUnsigned(version);
+
+  header.writeUnsigned(mStrings.size());
+  for (size_t i = 0; i < mStrings.size(); ++i)
+  {
+    header.writeUnsigned(mStrings[i]->size());
+    header.mBody.append(*mStrings[i]);
+  }
+
+  return header.mBody + mBody;
+}
+
+
+/*
+ * Writes a boolean value.
+ */
+void
+SedBinaryOutputStream::writeBool(bool value)
+{
+  mBody.push_back(value ? 1 : 0);
+}
+
+
+/*
+ * Writes a signed integer, zigzag encoded so that small negative numbers
+ * stay short.
+ */
+void
+SedBinaryOutputStream::writeInt(long value)
+{
+  const unsigned long long bits = static_cast<unsigned long long>(value);
+  writeVarint((bits << 1) ^ (value < 0 ? ~0ULL : 0ULL));
+}
+
+
+/*
+ * Writes an unsigned integer.
+ */
+void
+SedBinaryOutputStream::writeUnsigned(unsigned long value)
+{
+  writeVarint(value);
+}
+
+
+/*
+ * Writes a double, bit for bit.
+ */
+void
+SedBinaryOutputStream::writeDouble(double value)
+{
+  mBody.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+
+/*
+ * Writes a string as its index in the string table; index 0 stands for
+ * the empty string, which is not stored in the table.
+ */
+void
+SedBinaryOutputStream::writeString(const std::string& value)
+{
+  if (value.empty())
+  {
+    writeUnsigned(0);
+    return;
+  }
+
+  std::pair<std::unordered_map<std::string, unsigned int>::iterator, bool>
+    inserted = mStringIndex.insert(
+      std::make_pair(value, static_cast<unsigned int>(mStrings.size() + 1)));
+
+  if (inserted.second)
+  {
+    mStrings.push_back(&inserted.first->first);
+  }
+
+  writeUnsigned(inserted.first->second);
+}
+
+
+/*
+ * Writes an interned string as its index in the string table.
+ */
+void
+SedBinaryOutputStream::writeString(const SedInternedString& value)
+{
+  writeString(value.str());
+}
+
+
+/*
+ * Writes a math tree, which may be NULL.
+ */
+void
+SedBinaryOutputStream::writeMath(const ASTNode* math)
+{
+  writeBool(math != NULL);
+
+  if (math != NULL)
+  {
+    writeMathNode(*math);
+  }
+}
+
+
+/*
+ * Writes XML content held either as markup or as a tree.
+ */
+void
+SedBinaryOutputStream::writeXML(const std::string& raw, const XMLNode* node)
+{
+  if (!raw.empty())
+  {
+    writeUnsigned(XML_CONTENT_RAW);
+    writeString(raw);
+  }
+  else if (node != NULL)
+  {
+    writeUnsigned(XML_CONTENT_TREE);
+    writeXMLNode(*node);
+  }
+  else
+  {
+    writeUnsigned(XML_CONTENT_NONE);
+  }
+}
+
+
+/*
+ * Writes a set of XML namespace declarations, which may be NULL.
+ */
+void
+SedBinaryOutputStream::writeNamespaces(const XMLNamespaces* xmlns)
+{
+  writeBool(xmlns != NULL);
+
+  if (xmlns == NULL)
+  {
+    return;
+  }
+
+  writeUnsigned(xmlns->getNumNamespaces());
+  for (int i = 0; i < xmlns->getNumNamespaces(); ++i)
+  {
+    writeString(xmlns->getPrefix(i));
+    writeString(xmlns->getURI(i));
+  }
+}
+
+
+/*
+ * Writes a NuML dimension description as its markup.
+ */
+void
+SedBinaryOutputStream::writeDimensionDescription(
+  const DimensionDescription* dd)
+{
+  writeBool(dd != NULL);
+
+  if (dd == NULL)
+  {
+    return;
+  }
+
+  ostringstream os;
+  XMLOutputStream stream(os, "UTF-8", false);
+  dd->write(stream);
+  writeString(os.str());
+}
+
+
+/*
+ * Writes a vector of doubles.
+ */
+void
+SedBinaryOutputStream::writeValues(const std::vector<double>& values)
+{
+  writeUnsigned(values.size());
+
+  if (!values.empty())
+  {
+    mBody.append(reinterpret_cast<const char*>(&values[0]),
+                 values.size() * sizeof(double));
+  }
+}
+
+
+/*
+ * Writes the type code of object followed by the object itself.
+ */
+void
+SedBinaryOutputStream::writeObject(const SedBase* object)
+{
+  if (object == NULL)
+  {
+    writeUnsigned(SEDML_UNKNOWN);
+    return;
+  }
+
+  writeUnsigned(object->getTypeCode());
+  object->writeBinary(*this);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes an unsigned number in 7 bit groups, least significant first; the
+ * top bit of each byte flags that more bytes follow.
+ */
+void
+SedBinaryOutputStream::writeVarint(unsigned long long value)
+{
+  while (value >= 0x80)
+  {
+    mBody.push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+
+  mBody.push_back(static_cast<char>(value));
+}
+
+
+/*
+ * Writes an AST node and its children.
+ */
+void
+SedBinaryOutputStream::writeMathNode(const ASTNode& math)
+{
+  const ASTNodeType_t type = math.getType();
+  writeUnsigned(static_cast<unsigned long>(type));
+
+  unsigned int flags = 0;
+  const bool hasName = math.isName() || type == AST_FUNCTION ||
+    math.isCSymbolFunction();
+
+  if (hasName && math.getName() != NULL) flags |= MATH_NAME;
+  if (math.isSetUnits()) flags |= MATH_UNITS;
+  if ((type == AST_NAME || type == AST_FUNCTION) &&
+      !math.getDefinitionURLString().empty())
+  {
+    flags |= MATH_DEFINITION_URL;
+  }
+  if (math.isSetId()) flags |= MATH_ID;
+  if (math.isSetClass()) flags |= MATH_CLASS;
+  if (math.isSetStyle()) flags |= MATH_STYLE;
+  if (math.isBvar()) flags |= MATH_BVAR;
+  if (math.getNumSemanticsAnnotations() > 0) flags |= MATH_SEMANTICS;
+
+  writeUnsigned(flags);
+
+  if (flags & MATH_NAME)
+  {
+    writeString(std::string(math.getName()));
+  }
+
+  switch (type)
+  {
+  case AST_INTEGER:
+    writeInt(math.getInteger());
+    break;
+  case AST_REAL:
+    writeDouble(math.getReal());
+    break;
+  case AST_REAL_E:
+    writeDouble(math.getMantissa());
+    writeInt(math.getExponent());
+    break;
+  case AST_RATIONAL:
+    writeInt(math.getNumerator());
+    writeInt(math.getDenominator());
+    break;
+  default:
+    break;
+  }
+
+  if (flags & MATH_UNITS) writeString(math.getUnits());
+  if (flags & MATH_DEFINITION_URL)
+  {
+    writeString(math.getDefinitionURLString());
+  }
+  if (flags & MATH_ID) writeString(math.getId());
+  if (flags & MATH_CLASS) writeString(math.getClass());
+  if (flags & MATH_STYLE) writeString(math.getStyle());
+
+  if (flags & MATH_SEMANTICS)
+  {
+    writeUnsigned(math.getNumSemanticsAnnotations());
+    for (unsigned int i = 0; i < math.getNumSemanticsAnnotations(); ++i)
+    {
+      writeXMLNode(*math.getSemanticsAnnotation(i));
+    }
+  }
+
+  writeUnsigned(math.getNumChildren());
+  for (unsigned int i = 0; i < math.getNumChildren(); ++i)
+  {
+    writeMathNode(*math.getChild(i));
+  }
+}
+
+
+/*
+ * Writes an XML node and its children.
+ */
+void
+SedBinaryOutputStream::writeXMLNode(const XMLNode& node)
+{
+  unsigned int flags = 0;
+  if (node.isStart()) flags |= XML_START;
+  if (node.isEnd()) flags |= XML_END;
+  if (node.isText()) flags |= XML_TEXT;
+
+  writeUnsigned(flags);
+
+  if (flags & XML_TEXT)
+  {
+    writeString(node.getCharacters());
+  }
+  else
+  {
+    writeString(node.getName());
+    writeString(node.getPrefix());
+    writeString(node.getURI());
+
+    writeUnsigned(node.getAttributesLength());
+    for (int i = 0; i < node.getAttributesLength(); ++i)
+    {
+      writeString(node.getAttrName(i));
+      writeString(node.getAttrPrefix(i));
+      writeString(node.getAttrURI(i));
+      writeString(node.getAttrValue(i));
+    }
+
+    writeUnsigned(node.getNamespacesLength());
+    for (int i = 0; i < node.getNamespacesLength(); ++i)
+    {
+      writeString(node.getNamespacePrefix(i));
+      writeString(node.getNamespaceURI(i));
+    }
+  }
+
+  writeUnsigned(node.getNumChildren());
+  for (unsigned int i = 0; i < node.getNumChildren(); ++i)
+  {
+    writeXMLNode(node.getChild(i));
+  }
+}
+
+/** @endcond */
+
+
+/*
+ * Creates a SedBinaryInputStream over the given buffer.
+ */
+SedBinaryInputStream::SedBinaryInputStream(const void* data, size_t length)
+  : mData (static_cast<const unsigned char*>(data))
+  , mLength (data != NULL ? length : 0)
+  , mPosition (0)
+  , mGood (true)
+  , mDepth (0)
+  , mStrings ()
+  , mInterned ()
+{
+}
+
+
+/*
+ * Reads the header and the string table.
+ */
+bool
+SedBinaryInputStream::readHeader(unsigned int& level, unsigned int& version)
+{
+  unsigned int format = 0;
+  unsigned int mark = 0;
+
+  if (!canRead(sizeof(sMagic) + sizeof(format) + sizeof(mark)) ||
+      memcmp(mData, sMagic, sizeof(sMagic)) != 0)
+  {
+    setError();
+    return false;
+  }
+
+  memcpy(&format, mData + sizeof(sMagic), sizeof(format));
+  memcpy(&mark, mData + sizeof(sMagic) + sizeof(format), sizeof(mark));
+  mPosition = sizeof(sMagic) + sizeof(format) + sizeof(mark);
+
+  if (format != SedBinaryOutputStream::FORMAT_VERSION ||
+      mark != sByteOrderMark)
+  {
+    setError();
+    return false;
+  }
+
+  level = static_cast<unsigned int>(readUnsigned());
+  version = static_cast<unsigned int>(readUnsigned());
+
+  // every entry takes at least one byte, which bounds the count
+  const unsigned long count = readUnsigned();
+  if (!isGood() || count > mLength - mPosition)
+  {
+    setError();
+    return false;
+  }
+
+  mStrings.reserve(count);
+  for (unsigned long i = 0; i < count && isGood(); ++i)
+  {
+    const unsigned long length = readUnsigned();
+    if (!canRead(length))
+    {
+      setError();
+      break;
+    }
+
+    mStrings.push_back(std::make_pair(
+      reinterpret_cast<const char*>(mData + mPosition),
+      static_cast<size_t>(length)));
+    mPosition += length;
+  }
+
+  mInterned.resize(mStrings.size());
+  return isGood();
+}
+
+
+/*
+ * Returns true if the whole buffer has been read without error.
+ */
+bool
+SedBinaryInputStream::isAtEnd() const
+{
+  return mGood && mPosition == mLength;
+}
+
+
+/*
+ * Returns false once a read has failed.
+ */
+bool
+SedBinaryInputStream::isGood() const
+{
+  return mGood;
+}
+
+
+/*
+ * Puts this stream into the error state.
+ */
+void
+SedBinaryInputStream::setError()
+{
+  mGood = false;
+}
+
+
+/*
+ * Reads a boolean value.
+ */
+bool
+SedBinaryInputStream::readBool()
+{
+  if (!canRead(1))
+  {
+    setError();
+    return false;
+  }
+
+  return mData[mPosition++] != 0;
+}
+
+
+/*
+ * Reads a zigzag encoded signed integer.
+ */
+long
+SedBinaryInputStream::readInt()
+{
+  unsigned long long value = 0;
+  if (!readVarint(value)) return 0;
+
+  const unsigned long long bits = (value >> 1) ^ (~(value & 1) + 1);
+  return static_cast<long>(bits);
+}
+
+
+/*
+ * Reads an unsigned integer.
+ */
+unsigned long
+SedBinaryInputStream::readUnsigned()
+{
+  unsigned long long value = 0;
+  if (!readVarint(value)) return 0;
+
+  return static_cast<unsigned long>(value);
+}
+
+
+/*
+ * Reads a double.
+ */
+double
+SedBinaryInputStream::readDouble()
+{
+  double value = 0;
+
+  if (!canRead(sizeof(value)))
+  {
+    setError();
+    return value;
+  }
+
+  memcpy(&value, mData + mPosition, sizeof(value));
+  mPosition += sizeof(value);
+  return value;
+}
+
+
+/*
+ * Reads a string written by SedBinaryOutputStream::writeString().
+ */
+void
+SedBinaryInputStream::readString(std::string& value)
+{
+  const char* data = NULL;
+  size_t length = 0;
+
+  if (readStringEntry(readUnsigned(), data, length))
+  {
+    value.assign(data, length);
+  }
+  else
+  {
+    value.clear();
+  }
+}
+
+
+/*
+ * Reads a string into an interned string; the table entry is interned on
+ * first use and shared by reference afterwards.
+ */
+void
+SedBinaryInputStream::readString(SedInternedString& value)
+{
+  const unsigned long index = readUnsigned();
+  const char* data = NULL;
+  size_t length = 0;
+
+  if (!readStringEntry(index, data, length))
+  {
+    value.erase();
+    return;
+  }
+
+  SedInternedString& interned = mInterned[index - 1];
+  if (interned.empty())
+  {
+    interned = std::string(data, length);
+  }
+
+  value = interned;
+}
+
+
+/*
+ * Reads a math tree.
+ */
+ASTNode*
+SedBinaryInputStream::readMath()
+{
+  if (!readBool())
+  {
+    return NULL;
+  }
+
+  ASTNode* math = readMathNode(0);
+
+  if (!isGood())
+  {
+    delete math;
+    return NULL;
+  }
+
+  return math;
+}
+
+
+/*
+ * Reads XML content, either as markup or as a tree.
+ */
+void
+SedBinaryInputStream::readXML(std::string& raw, XMLNode*& node)
+{
+  raw.clear();
+
+  switch (readUnsigned())
+  {
+  case XML_CONTENT_NONE:
+    break;
+  case XML_CONTENT_RAW:
+    readString(raw);
+    break;
+  case XML_CONTENT_TREE:
+    node = readXMLNode(0);
+    if (!isGood())
+    {
+      delete node;
+      node = NULL;
+    }
+    break;
+  default:
+    setError();
+    break;
+  }
+}
+
+
+/*
+ * Reads a set of XML namespace declarations.
+ */
+XMLNamespaces*
+SedBinaryInputStream::readNamespaces()
+{
+  if (!readBool())
+  {
+    return NULL;
+  }
+
+  XMLNamespaces* xmlns = new XMLNamespaces();
+  const unsigned long count = readUnsigned();
+  std::string prefix;
+  std::string uri;
+
+  for (unsigned long i = 0; i < count && isGood(); ++i)
+  {
+    readString(prefix);
+    readString(uri);
+    xmlns->add(uri, prefix);
+  }
+
+  return xmlns;
+}
+
+
+/*
+ * Reads a NuML dimension description from its markup.
+ */
+DimensionDescription*
+SedBinaryInputStream::readDimensionDescription()
+{
+  if (!readBool())
+  {
+    return NULL;
+  }
+
+  std::string markup;
+  readString(markup);
+
+  if (!isGood() || markup.empty())
+  {
+    setError();
+    return NULL;
+  }
+
+  XMLInputStream stream(markup.c_str(), false);
+  DimensionDescription* dd = new DimensionDescription();
+  dd->read(stream);
+  return dd;
+}
+
+
+/*
+ * Reads a vector of doubles.
+ */
+void
+SedBinaryInputStream::readValues(std::vector<double>& values)
+{
+  const unsigned long count = readUnsigned();
+
+  if (!isGood() || count > (mLength - mPosition) / sizeof(double))
+  {
+    setError();
+    values.clear();
+    return;
+  }
+
+  values.resize(count);
+  if (count > 0)
+  {
+    memcpy(&values[0], mData + mPosition, count * sizeof(double));
+    mPosition += count * sizeof(double);
+  }
+}
+
+
+/*
+ * Reads a type code and creates an empty object of that type.
+ */
+SedBase*
+SedBinaryInputStream::createObject(SedBase* parent)
+{
+  const unsigned long type = readUnsigned();
+
+  if (!isGood() || type == SEDML_UNKNOWN)
+  {
+    return NULL;
+  }
+
+  SedArena* arena = parent->getSedArena();
+  const SedNamespaces* sedmlns = parent->getSedNamespaces();
+
+  switch (type)
+  {
+  case SEDML_MODEL:
+    return new (arena) SedModel(sedmlns);
+  case SEDML_CHANGE:
+    return new (arena) SedChange(sedmlns);
+  case SEDML_CHANGE_ADDXML:
+    return new (arena) SedAddXML(sedmlns);
+  case SEDML_CHANGE_CHANGEXML:
+    return new (arena) SedChangeXML(sedmlns);
+  case SEDML_CHANGE_REMOVEXML:
+    return new (arena) SedRemoveXML(sedmlns);
+  case SEDML_CHANGE_ATTRIBUTE:
+    return new (arena) SedChangeAttribute(sedmlns);
+  case SEDML_CHANGE_COMPUTECHANGE:
+    return new (arena) SedComputeChange(sedmlns);
+  case SEDML_VARIABLE:
+    return new (arena) SedVariable(sedmlns);
+  case SEDML_PARAMETER:
+    return new (arena) SedParameter(sedmlns);
+  case SEDML_SIMULATION:
+    return new (arena) SedSimulation(sedmlns);
+  case SEDML_SIMULATION_UNIFORMTIMECOURSE:
+    return new (arena) SedUniformTimeCourse(sedmlns);
+  case SEDML_SIMULATION_ONESTEP:
+    return new (arena) SedOneStep(sedmlns);
+  case SEDML_SIMULATION_STEADYSTATE:
+    return new (arena) SedSteadyState(sedmlns);
+  case SEDML_SIMULATION_ANALYSIS:
+    return new (arena) SedAnalysis(sedmlns);
+  case SEDML_SIMULATION_ALGORITHM:
+    return new (arena) SedAlgorithm(sedmlns);
+  case SEDML_SIMULATION_ALGORITHM_PARAMETER:
+    return new (arena) SedAlgorithmParameter(sedmlns);
+  case SEDML_SEDML_ABSTRACTTASK:
+    return new (arena) SedAbstractTask(sedmlns);
+  case SEDML_TASK:
+    return new (arena) SedTask(sedmlns);
+  case SEDML_TASK_REPEATEDTASK:
+    return new (arena) SedRepeatedTask(sedmlns);
+  case SEDML_TASK_SUBTASK:
+    return new (arena) SedSubTask(sedmlns);
+  case SEDML_TASK_SETVALUE:
+    return new (arena) SedSetValue(sedmlns);
+  case SEDML_TASK_PARAMETER_ESTIMATION:
+    return new (arena) SedParameterEstimationTask(sedmlns);
+  case SEDML_RANGE:
+    return new (arena) SedRange(sedmlns);
+  case SEDML_RANGE_UNIFORMRANGE:
+    return new (arena) SedUniformRange(sedmlns);
+  case SEDML_RANGE_VECTORRANGE:
+    return new (arena) SedVectorRange(sedmlns);
+  case SEDML_RANGE_FUNCTIONALRANGE:
+    return new (arena) SedFunctionalRange(sedmlns);
+  case SEDML_DATA_RANGE:
+    return new (arena) SedDataRange(sedmlns);
+  case SEDML_DATAGENERATOR:
+    return new (arena) SedDataGenerator(sedmlns);
+  case SEDML_DATA_DESCRIPTION:
+    return new (arena) SedDataDescription(sedmlns);
+  case SEDML_DATA_SOURCE:
+    return new (arena) SedDataSource(sedmlns);
+  case SEDML_DATA_SLICE:
+    return new (arena) SedSlice(sedmlns);
+  case SEDML_OUTPUT:
+    return new (arena) SedOutput(sedmlns);
+  case SEDML_OUTPUT_REPORT:
+    return new (arena) SedReport(sedmlns);
+  case SEDML_OUTPUT_PLOT:
+    return new (arena) SedPlot(sedmlns);
+  case SEDML_OUTPUT_PLOT2D:
+    return new (arena) SedPlot2D(sedmlns);
+  case SEDML_OUTPUT_PLOT3D:
+    return new (arena) SedPlot3D(sedmlns);
+  case SEDML_OUTPUT_DATASET:
+    return new (arena) SedDataSet(sedmlns);
+  case SEDML_ABSTRACTCURVE:
+    return new (arena) SedAbstractCurve(sedmlns);
+  case SEDML_OUTPUT_CURVE:
+    return new (arena) SedCurve(sedmlns);
+  case SEDML_OUTPUT_SURFACE:
+    return new (arena) SedSurface(sedmlns);
+  case SEDML_SHADEDAREA:
+    return new (arena) SedShadedArea(sedmlns);
+  case SEDML_FIGURE:
+    return new (arena) SedFigure(sedmlns);
+  case SEDML_SUBPLOT:
+    return new (arena) SedSubPlot(sedmlns);
+  case SEDML_AXIS:
+    return new (arena) SedAxis(sedmlns);
+  case SEDML_STYLE:
+    return new (arena) SedStyle(sedmlns);
+  case SEDML_LINE:
+    return new (arena) SedLine(sedmlns);
+  case SEDML_MARKER:
+    return new (arena) SedMarker(sedmlns);
+  case SEDML_FILL:
+    return new (arena) SedFill(sedmlns);
+  case SEDML_APPLIEDDIMENSION:
+    return new (arena) SedAppliedDimension(sedmlns);
+  case SEDML_PARAMETERESTIMATIONRESULTPLOT:
+    return new (arena) SedParameterEstimationResultPlot(sedmlns);
+  case SEDML_WATERFALLPLOT:
+    return new (arena) SedWaterfallPlot(sedmlns);
+  case SEDML_PARAMETERESTIMATIONREPORT:
+    return new (arena) SedParameterEstimationReport(sedmlns);
+  case SEDML_ADJUSTABLE_PARAMETER:
+    return new (arena) SedAdjustableParameter(sedmlns);
+  case SEDML_BOUNDS:
+    return new (arena) SedBounds(sedmlns);
+  case SEDML_EXPERIMENT_REFERENCE:
+    return new (arena) SedExperimentReference(sedmlns);
+  case SEDML_FIT_EXPERIMENT:
+    return new (arena) SedFitExperiment(sedmlns);
+  case SEDML_FITMAPPING:
+    return new (arena) SedFitMapping(sedmlns);
+  case SEDML_OBJECTIVE:
+    return new (arena) SedObjective(sedmlns);
+  case SEDML_LEAST_SQUARE_OBJECTIVE:
+    return new (arena) SedLeastSquareObjectiveFunction(sedmlns);
+  default:
+    break;
+  }
+
+  setError();
+  return NULL;
+}
+
+
+/*
+ * Reads the contents of an object created by createObject(), keeping
+ * track of how deeply objects are nested.
+ */
+void
+SedBinaryInputStream::readObjectContents(SedBase* object)
+{
+  if (mDepth >= sMaxObjectDepth)
+  {
+    setError();
+    return;
+  }
+
+  ++mDepth;
+  object->readBinary(*this);
+  --mDepth;
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Reads a number written by SedBinaryOutputStream::writeVarint().
+ */
+bool
+SedBinaryInputStream::readVarint(unsigned long long& value)
+{
+  value = 0;
+
+  for (unsigned int shift = 0; shift < 64 && canRead(1); shift += 7)
+  {
+    const unsigned char byte = mData[mPosition++];
+    value |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+
+    if ((byte & 0x80) == 0)
+    {
+      return true;
+    }
+  }
+
+  setError();
+  value = 0;
+  return false;
+}
+
+
+/*
+ * Returns true if length more bytes can be read.
+ */
+bool
+SedBinaryInputStream::canRead(size_t length) const
+{
+  return mGood && length <= mLength - mPosition;
+}
+
+
+/*
+ * Looks up a string table entry; index 0 is the empty string.
+ */
+bool
+SedBinaryInputStream::readStringEntry(unsigned long index,
+                                      const char*& data, size_t& length)
+{
+  if (!isGood() || index == 0)
+  {
+    return false;
+  }
+
+  if (index > mStrings.size())
+  {
+    setError();
+    return false;
+  }
+
+  data = mStrings[index - 1].first;
+  length = mStrings[index - 1].second;
+  return true;
+}
+
+
+/*
+ * Reads an AST node and its children.
+ */
+ASTNode*
+SedBinaryInputStream::readMathNode(unsigned int depth)
+{
+  if (depth > sMaxDepth)
+  {
+    setError();
+    return NULL;
+  }
+
+  const unsigned long type = readUnsigned();
+  const unsigned long flags = readUnsigned();
+
+  if (!isGood())
+  {
+    return NULL;
+  }
+
+  ASTNode* math = new ASTNode(static_cast<int>(type));
+  std::string value;
+
+  if (flags & MATH_NAME)
+  {
+    readString(value);
+    math->setName(value.c_str());
+  }
+
+  switch (type)
+  {
+  case AST_INTEGER:
+    math->setValue(readInt());
+    break;
+  case AST_REAL:
+    math->setValue(readDouble());
+    break;
+  case AST_REAL_E:
+    {
+      const double mantissa = readDouble();
+      math->setValue(mantissa, readInt());
+    }
+    break;
+  case AST_RATIONAL:
+    {
+      const long numerator = readInt();
+      math->setValue(numerator, readInt());
+    }
+    break;
+  default:
+    break;
+  }
+
+  if (flags & MATH_UNITS)
+  {
+    readString(value);
+    math->setUnits(value);
+  }
+
+  if (flags & MATH_DEFINITION_URL)
+  {
+    readString(value);
+    math->setDefinitionURL(value);
+  }
+
+  if (flags & MATH_ID)
+  {
+    readString(value);
+    math->setId(value);
+  }
+
+  if (flags & MATH_CLASS)
+  {
+    readString(value);
+    math->setClass(value);
+  }
+
+  if (flags & MATH_STYLE)
+  {
+    readString(value);
+    math->setStyle(value);
+  }
+
+  if (flags & MATH_BVAR)
+  {
+    math->setBvar();
+  }
+
+  if (flags & MATH_SEMANTICS)
+  {
+    const unsigned long count = readUnsigned();
+    for (unsigned long i = 0; i < count && isGood(); ++i)
+    {
+      XMLNode* annotation = readXMLNode(depth + 1);
+      if (annotation != NULL)
+      {
+        math->addSemanticsAnnotation(annotation);
+      }
+    }
+  }
+
+  const unsigned long count = readUnsigned();
+  for (unsigned long i = 0; i < count && isGood(); ++i)
+  {
+    ASTNode* child = readMathNode(depth + 1);
+    if (child != NULL)
+    {
+      math->addChild(child);
+    }
+  }
+
+  return math;
+}
+
+
+/*
+ * Reads an XML node and its children.
+ */
+XMLNode*
+SedBinaryInputStream::readXMLNode(unsigned int depth)
+{
+  if (depth > sMaxDepth)
+  {
+    setError();
+    return NULL;
+  }
+
+  const unsigned long flags = readUnsigned();
+  XMLNode* node = NULL;
+
+  if (flags & XML_TEXT)
+  {
+    std::string characters;
+    readString(characters);
+    node = new XMLNode(characters);
+  }
+  else
+  {
+    std::string name;
+    std::string prefix;
+    std::string uri;
+    std::string value;
+
+    readString(name);
+    readString(prefix);
+    readString(uri);
+    XMLTriple triple(name, uri, prefix);
+
+    XMLAttributes attributes;
+    unsigned long count = readUnsigned();
+    for (unsigned long i = 0; i < count && isGood(); ++i)
+    {
+      readString(name);
+      readString(prefix);
+      readString(uri);
+      readString(value);
+      attributes.add(name, value, uri, prefix);
+    }
+
+    XMLNamespaces xmlns;
+    count = readUnsigned();
+    for (unsigned long i = 0; i < count && isGood(); ++i)
+    {
+      readString(prefix);
+      readString(uri);
+      xmlns.add(uri, prefix);
+    }
+
+    if (flags & XML_START)
+    {
+      node = new XMLNode(triple, attributes, xmlns);
+    }
+    else
+    {
+      node = new XMLNode();
+      if (!triple.isEmpty()) node->setTriple(triple);
+    }
+
+    if (flags & XML_END)
+    {
+      node->setEnd();
+    }
+  }
+
+  const unsigned long count = readUnsigned();
+  for (unsigned long i = 0; i < count && isGood(); ++i)
+  {
+    XMLNode* child = readXMLNode(depth + 1);
+    if (child != NULL)
+    {
+      node->addChild(*child);
+      delete child;
+    }
+  }
+
+  return node;
+}
+
+/** @endcond */
+
+
+#endif /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
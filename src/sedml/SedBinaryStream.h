@@ -0,0 +1,416 @@
+/**
+ * @file SedBinaryStream.h
+ * @brief Definition of the SED-ML binary stream classes.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedBinaryOutputStream
+ * @sbmlbrief{} Encoder for the binary form of a SedDocument.
+ *
+ * The binary form starts with a header: the eight characters
+ * <code>SEDMLBIN</code>, the format version and a byte order mark (each a
+ * 32 bit number in the byte order of the machine that wrote it) and the
+ * SED-ML level and version.  Then follows the string table, listing every
+ * distinct string once, and the body, which holds the objects in document
+ * order.  In the body, integers are stored as variable-length numbers,
+ * doubles as their 8 bytes, and strings as indexes into the string table.
+ *
+ * Math is stored as a tree of AST nodes, notes, annotations and other XML
+ * content either as markup or as a tree of XML nodes, whichever form the
+ * object holds at the time.  NuML dimension descriptions are stored as
+ * their NuML markup, the only form libNUML can rebuild them from.
+ *
+ *
+ * @class SedBinaryInputStream
+ * @sbmlbrief{} Decoder for the binary form of a SedDocument.
+ *
+ * A SedBinaryInputStream reads a buffer written by SedBinaryOutputStream in
+ * place; it neither copies the buffer nor requires it to be terminated, so
+ * it can decode a memory-mapped file directly.  Reading past the end of the
+ * buffer, or any value that is out of range, puts the stream into an error
+ * state, after which every read returns a zero or empty value.
+ */
+
+
+#ifndef SedBinaryStream_h
+#define SedBinaryStream_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+#include <sedml/SedBase.h>
+#include <sedml/common/SedInternedString.h>
+
+
+#ifdef __cplusplus
+
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class XMLNode;
+class XMLNamespaces;
+class ASTNode;
+
+LIBSBML_CPP_NAMESPACE_END
+
+LIBNUML_CPP_NAMESPACE_BEGIN
+
+class DimensionDescription;
+
+LIBNUML_CPP_NAMESPACE_END
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+class LIBSEDML_EXTERN SedBinaryOutputStream
+{
+public:
+
+  /**
+   * The version of the binary format written by this class.
+   */
+  static const unsigned int FORMAT_VERSION = 2;
+
+
+  /**
+   * Creates a new, empty SedBinaryOutputStream.
+   */
+  SedBinaryOutputStream();
+
+
+  /**
+   * Returns the complete binary form of what has been written so far: the
+   * header, the string table and the body.
+   *
+   * @param level the SED-ML level to record in the header.
+   *
+   * @param version the SED-ML version to record in the header.
+   *
+   * @return the encoded bytes.
+   */
+  std::string getBytes(unsigned int level, unsigned int version) const;
+
+
+  /**
+   * Writes a boolean value.
+   */
+  void writeBool(bool value);
+
+
+  /**
+   * Writes a signed integer.
+   */
+  void writeInt(long value);
+
+
+  /**
+   * Writes an unsigned integer.
+   */
+  void writeUnsigned(unsigned long value);
+
+
+  /**
+   * Writes a double, bit for bit.
+   */
+  void writeDouble(double value);
+
+
+  /**
+   * Writes a string as its index in the string table.
+   */
+  void writeString(const std::string& value);
+
+
+  /**
+   * Writes an interned string as its index in the string table.
+   */
+  void writeString(const SedInternedString& value);
+
+
+  /**
+   * Writes a math tree, which may be @c NULL.
+   */
+  void writeMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math);
+
+
+  /**
+   * Writes XML content that is held either as markup (@p raw) or as a
+   * tree (@p node); an empty @p raw and a @c NULL @p node mean no content.
+   */
+  void writeXML(const std::string& raw,
+                const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* node);
+
+
+  /**
+   * Writes a set of XML namespace declarations, which may be @c NULL.
+   */
+  void writeNamespaces(
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* xmlns);
+
+
+  /**
+   * Writes a NuML dimension description, which may be @c NULL.
+   */
+  void writeDimensionDescription(
+    const LIBNUML_CPP_NAMESPACE_QUALIFIER DimensionDescription* dd);
+
+
+  /**
+   * Writes a vector of doubles.
+   */
+  void writeValues(const std::vector<double>& values);
+
+
+  /**
+   * Writes the type code of @p object followed by the object itself, or
+   * only a zero if @p object is @c NULL.
+   */
+  void writeObject(const SedBase* object);
+
+
+private:
+
+  void writeVarint(unsigned long long value);
+  void writeMathNode(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode& math);
+  void writeXMLNode(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode& node);
+
+  std::string mBody;
+  std::unordered_map<std::string, unsigned int> mStringIndex;
+  std::vector<const std::string*> mStrings;
+};
+
+
+class LIBSEDML_EXTERN SedBinaryInputStream
+{
+public:
+
+  /**
+   * Creates a SedBinaryInputStream over the given buffer, which has to
+   * stay valid and unchanged while the stream is used.
+   *
+   * @param data the first byte of the buffer.
+   *
+   * @param length the size of the buffer in bytes.
+   */
+  SedBinaryInputStream(const void* data, size_t length);
+
+
+  /**
+   * Reads the header and the string table.
+   *
+   * @param level set to the SED-ML level recorded in the header.
+   *
+   * @param version set to the SED-ML version recorded in the header.
+   *
+   * @return @c true if the buffer starts with a header this class can
+   * read, @c false otherwise.
+   */
+  bool readHeader(unsigned int& level, unsigned int& version);
+
+
+  /**
+   * Returns @c true if the whole buffer has been read without error.
+   */
+  bool isAtEnd() const;
+
+
+  /**
+   * Returns @c false once a read has failed.
+   */
+  bool isGood() const;
+
+
+  /**
+   * Puts this stream into the error state.
+   */
+  void setError();
+
+
+  /**
+   * Reads a boolean value.
+   */
+  bool readBool();
+
+
+  /**
+   * Reads a signed integer.
+   */
+  long readInt();
+
+
+  /**
+   * Reads an unsigned integer.
+   */
+  unsigned long readUnsigned();
+
+
+  /**
+   * Reads a double.
+   */
+  double readDouble();
+
+
+  /**
+   * Reads a string written by SedBinaryOutputStream::writeString().
+   */
+  void readString(std::string& value);
+
+
+  /**
+   * Reads a string written by SedBinaryOutputStream::writeString() into an
+   * interned string; every string of the table is interned only once.
+   */
+  void readString(SedInternedString& value);
+
+
+  /**
+   * Reads a math tree.
+   *
+   * @return the tree, owned by the caller, or @c NULL.
+   */
+  LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* readMath();
+
+
+  /**
+   * Reads XML content, setting either @p raw or @p node.  @p node has to
+   * be @c NULL on entry.
+   */
+  void readXML(std::string& raw,
+               LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*& node);
+
+
+  /**
+   * Reads a set of XML namespace declarations.
+   *
+   * @return the declarations, owned by the caller, or @c NULL.
+   */
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* readNamespaces();
+
+
+  /**
+   * Reads a NuML dimension description.
+   *
+   * @return the dimension description, owned by the caller, or @c NULL.
+   */
+  LIBNUML_CPP_NAMESPACE_QUALIFIER DimensionDescription*
+    readDimensionDescription();
+
+
+  /**
+   * Reads a vector of doubles.
+   */
+  void readValues(std::vector<double>& values);
+
+
+  /**
+   * Reads a type code and creates an empty object of that type in the
+   * document of @p parent, without reading its contents.
+   *
+   * @return the new object, or @c NULL if a @c NULL object was written
+   * or the type code is not valid.
+   */
+  SedBase* createObject(SedBase* parent);
+
+
+  /**
+   * Reads the contents of an object created by createObject(), putting
+   * this stream into the error state instead if objects are nested too
+   * deeply.
+   */
+  void readObjectContents(SedBase* object);
+
+
+  /**
+   * Reads an object written by SedBinaryOutputStream::writeObject() and
+   * stores it in @p child as a child of @p parent, deleting what @p child
+   * pointed to before.
+   */
+  template <typename T>
+  void readObject(T*& child, SedBase* parent)
+  {
+    SedBase* object = createObject(parent);
+    T* typed = dynamic_cast<T*>(object);
+
+    if (object != NULL && typed == NULL)
+    {
+      delete object;
+      setError();
+    }
+
+    if (!isGood()) return;
+
+    delete child;
+    child = typed;
+
+    if (child != NULL)
+    {
+      child->connectToParent(parent);
+      readObjectContents(child);
+    }
+  }
+
+
+private:
+
+  bool readVarint(unsigned long long& value);
+  bool canRead(size_t length) const;
+  bool readStringEntry(unsigned long index, const char*& data,
+                       size_t& length);
+  LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* readMathNode(unsigned int depth);
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* readXMLNode(unsigned int depth);
+
+  const unsigned char* mData;
+  size_t mLength;
+  size_t mPosition;
+  bool mGood;
+  unsigned int mDepth;
+  std::vector< std::pair<const char*, size_t> > mStrings;
+  std::vector<SedInternedString> mInterned;
+};
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedBinaryStream_h */
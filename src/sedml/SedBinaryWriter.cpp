@@ -0,0 +1,155 @@
+/**
+ * @file SedBinaryWriter.cpp
+ * @brief Implementation of the SedBinaryWriter class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+#include <ios>
+#include <fstream>
+
+#include <sedml/SedError.h>
+#include <sedml/SedErrorLog.h>
+#include <sedml/SedDocument.h>
+#include <sedml/SedBinaryStream.h>
+#include <sedml/SedBinaryWriter.h>
+
+/** @cond doxygenIgnored */
+
+using namespace std;
+
+/** @endcond */
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+#ifdef __cplusplus
+
+/*
+ * Creates a new SedBinaryWriter.
+ */
+SedBinaryWriter::SedBinaryWriter ()
+{
+}
+
+
+/*
+ * Destroys this SedBinaryWriter.
+ */
+SedBinaryWriter::~SedBinaryWriter ()
+{
+}
+
+
+/*
+ * Writes the given SedDocument in binary form to filename.
+ *
+ * @return true on success and false if the filename could not be opened
+ * for writing.
+ */
+bool
+SedBinaryWriter::writeSedML (const SedDocument* d,
+                             const std::string& filename)
+{
+  if (d == NULL)
+  {
+    return false;
+  }
+
+  std::ofstream stream(filename.c_str(), ios_base::out | ios_base::binary);
+
+  if (!stream.is_open())
+  {
+    SedErrorLog *log = (const_cast<SedDocument *>(d))->getErrorLog();
+    log->logError(XMLFileUnwritable);
+    return false;
+  }
+
+  return writeSedML(d, stream);
+}
+
+
+/*
+ * Writes the given SedDocument in binary form to the output stream.
+ *
+ * @return true on success and false if writing to the stream failed.
+ */
+bool
+SedBinaryWriter::writeSedML (const SedDocument* d, std::ostream& stream)
+{
+  if (d == NULL)
+  {
+    return false;
+  }
+
+  const std::string bytes = writeSedMLToStdString(d);
+  stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  stream.flush();
+
+  if (!stream)
+  {
+    SedErrorLog *log = (const_cast<SedDocument *>(d))->getErrorLog();
+    log->logError(XMLFileOperationError);
+    return false;
+  }
+
+  return true;
+}
+
+
+/*
+ * Returns the binary form of the given SedDocument.
+ */
+std::string
+SedBinaryWriter::writeSedMLToStdString (const SedDocument* d)
+{
+  if (d == NULL) return "";
+
+  SedBinaryOutputStream stream;
+  d->writeBinary(stream);
+  return stream.getBytes(d->getLevel(), d->getVersion());
+}
+
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_EXTERN
+int
+writeSedMLToBinaryFile (const SedDocument_t *d, const char *filename)
+{
+  SedBinaryWriter sw;
+  if (d == NULL || filename == NULL)
+    return 0;
+  else
+    return static_cast<int>( sw.writeSedML(d, filename) );
+}
+
+
+LIBSEDML_CPP_NAMESPACE_END
@@ -0,0 +1,168 @@
+/**
+ * @file SedBinaryWriter.h
+ * @brief Definition of the SedBinaryWriter class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedBinaryWriter
+ * @sbmlbrief{} Writes a SedDocument in the binary form read by
+ * SedBinaryReader.
+ *
+ * The binary form holds exactly what a SedDocument holds, including notes,
+ * annotations and namespace declarations of any kind, so that writing the
+ * document read back by SedBinaryReader with SedWriter gives the same XML
+ * as writing the original.  It is much faster to load than the XML form,
+ * and is meant as a cache of documents that are read over and over again;
+ * it is not a replacement for the XML form as an exchange format.
+ *
+ * Strings are stored once each, in a table at the start of the data, and
+ * numbers in the byte order of the machine that wrote them; a binary file
+ * can only be read on machines with the same byte order, and by copies of
+ * libSEDML that support its format version.
+ *
+ * @see SedBinaryReader
+ */
+
+
+#ifndef SedBinaryWriter_h
+#define SedBinaryWriter_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <iosfwd>
+#include <string>
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedDocument;
+
+
+class LIBSEDML_EXTERN SedBinaryWriter
+{
+public:
+
+  /**
+   * Creates a new SedBinaryWriter.
+   */
+  SedBinaryWriter  ();
+
+
+  /**
+   * Destroys this SedBinaryWriter.
+   */
+  ~SedBinaryWriter ();
+
+
+  /**
+   * Writes the given SedDocument in binary form to filename.
+   *
+   * @param d the SedDocument to be written
+   *
+   * @param filename the name or full pathname of the file where the
+   * document is to be written.
+   *
+   * @return @c true on success and @c false if the filename could not be
+   * opened for writing.
+   */
+  bool writeSedML (const SedDocument* d, const std::string& filename);
+
+
+  /**
+   * Writes the given SedDocument in binary form to the output stream.
+   *
+   * @param d the SedDocument to be written
+   *
+   * @param stream the stream object where the document is to be written;
+   * it should have been opened in binary mode.
+   *
+   * @return @c true on success and @c false if writing to the stream
+   * failed.
+   */
+  bool writeSedML (const SedDocument* d, std::ostream& stream);
+
+
+#ifndef SWIG
+
+  /**
+   * Returns the binary form of the given SedDocument.
+   *
+   * @param d the SedDocument to be written
+   *
+   * @return the binary form, or an empty string if @p d is @c NULL.
+   */
+  std::string writeSedMLToStdString (const SedDocument* d);
+
+#endif
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+BEGIN_C_DECLS
+
+
+/**
+ * Writes the given SedDocument @p d in binary form to the file named by
+ * @p filename.  This convenience function is functionally equivalent to:
+ *
+ *   SedBinaryWriter().writeSedML(d, filename);
+ *
+ * @param d the SedDocument object to be written out
+ *
+ * @param filename a string giving the path to a file where the document
+ * is to be written.
+ *
+ * @return @c 1 on success and @c 0 (zero) if @p filename could not be
+ * written.
+ *
+ * @if conly
+ * @memberof SedDocument_t
+ * @endif
+ */
+LIBSEDML_EXTERN
+int
+writeSedMLToBinaryFile (const SedDocument_t *d, const char *filename);
+
+
+END_C_DECLS
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* SedBinaryWriter_h */
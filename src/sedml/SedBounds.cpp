@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedBounds.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -58,14 +59,13 @@ SedBounds::SedBounds(unsigned int level, unsigned int version)
   , mIsSetUpperBound (false)
   , mScale (SEDML_SCALETYPE_INVALID)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedBounds using the given SedNamespaces object @p sedmlns.
  */
-SedBounds::SedBounds(SedNamespaces *sedmlns)
+SedBounds::SedBounds(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mLowerBound (util_NaN())
   , mIsSetLowerBound (false)
@@ -91,6 +91,20 @@ SedBounds::SedBounds(const SedBounds& orig)
 }
 
 
+/*
+ * Move constructor for SedBounds.
+ */
+SedBounds::SedBounds(SedBounds&& orig)
+  : SedBase( std::move(orig) )
+  , mLowerBound ( std::move(orig.mLowerBound) )
+  , mIsSetLowerBound ( std::move(orig.mIsSetLowerBound) )
+  , mUpperBound ( std::move(orig.mUpperBound) )
+  , mIsSetUpperBound ( std::move(orig.mIsSetUpperBound) )
+  , mScale ( std::move(orig.mScale) )
+{
+}
+
+
 /*
  * Assignment operator for SedBounds.
  */
@@ -111,6 +125,26 @@ SedBounds::operator=(const SedBounds& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedBounds.
+ */
+SedBounds&
+SedBounds::operator=(SedBounds&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mLowerBound = std::move(rhs.mLowerBound);
+    mIsSetLowerBound = std::move(rhs.mIsSetLowerBound);
+    mUpperBound = std::move(rhs.mUpperBound);
+    mIsSetUpperBound = std::move(rhs.mIsSetUpperBound);
+    mScale = std::move(rhs.mScale);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedBounds object.
  */
@@ -313,6 +347,56 @@ SedBounds::unsetScale()
 }
 
 
+/*
+ * Adds the memory held by this SedBounds object to @p usage.
+ */
+void
+SedBounds::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedBounds) - sizeof(SedBase));
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedBounds object to @p stream.
+ */
+void
+SedBounds::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeDouble(mLowerBound);
+  stream.writeBool(mIsSetLowerBound);
+  stream.writeDouble(mUpperBound);
+  stream.writeBool(mIsSetUpperBound);
+  stream.writeInt(mScale);
+}
+
+
+/*
+ * Reads the attributes and children of this SedBounds object from @p stream.
+ */
+void
+SedBounds::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  mLowerBound = stream.readDouble();
+  mIsSetLowerBound = stream.readBool();
+  mUpperBound = stream.readDouble();
+  mIsSetUpperBound = stream.readBool();
+  mScale = static_cast<ScaleType_t>(stream.readInt());
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedBounds object.
  */
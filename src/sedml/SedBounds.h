@@ -123,7 +123,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedBounds(SedNamespaces *sedmlns);
+  SedBounds(const SedNamespaces *sedmlns);
 
 
   /**
@@ -143,6 +143,28 @@ public:
   SedBounds& operator=(const SedBounds& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedBounds.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedBounds instance to move from.
+   */
+  SedBounds(SedBounds&& orig);
+
+
+  /**
+   * Move assignment operator for SedBounds.
+   *
+   * @param rhs the SedBounds object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedBounds& operator=(SedBounds&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedBounds object.
    *
@@ -326,6 +348,28 @@ public:
   int unsetScale();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedBounds object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedChange.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfChanges.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -62,14 +63,13 @@ SedChange::SedChange(unsigned int level, unsigned int version)
   , mTarget ("")
   , mElementName("change")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedChange using the given SedNamespaces object @p sedmlns.
  */
-SedChange::SedChange(SedNamespaces *sedmlns)
+SedChange::SedChange(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mTarget ("")
   , mElementName("change")
@@ -89,6 +89,17 @@ SedChange::SedChange(const SedChange& orig)
 }
 
 
+/*
+ * Move constructor for SedChange.
+ */
+SedChange::SedChange(SedChange&& orig)
+  : SedBase( std::move(orig) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
 /*
  * Assignment operator for SedChange.
  */
@@ -106,6 +117,23 @@ SedChange::operator=(const SedChange& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedChange.
+ */
+SedChange&
+SedChange::operator=(SedChange&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mTarget = std::move(rhs.mTarget);
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedChange object.
  */
@@ -229,6 +257,52 @@ SedChange::isSedComputeChange() const
 }
 
 
+/*
+ * Adds the memory held by this SedChange object to @p usage.
+ */
+void
+SedChange::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedChange) - sizeof(SedBase));
+  usage.addString(type, mTarget);
+  usage.addString(type, mElementName);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedChange object to @p stream.
+ */
+void
+SedChange::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mTarget);
+  stream.writeString(mElementName);
+}
+
+
+/*
+ * Reads the attributes and children of this SedChange object from @p stream.
+ */
+void
+SedChange::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mTarget);
+  stream.readString(mElementName);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedChange object.
  */
@@ -637,7 +711,9 @@ SedChange::readAttributes(
   // target string (use = "required" )
   // 
 
-  assigned = attributes.readInto("target", mTarget);
+  std::string target;
+  assigned = attributes.readInto("target", target);
+  mTarget = target;
 
   if (assigned == true)
   {
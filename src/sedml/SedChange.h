@@ -51,6 +51,7 @@
 
 
 #include <sedml/SedBase.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -69,7 +70,7 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  std::string mTarget;
+  SedInternedString mTarget;
   std::string mElementName;
 
   /** @endcond */
@@ -98,7 +99,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedChange(SedNamespaces *sedmlns);
+  SedChange(const SedNamespaces *sedmlns);
 
 
   /**
@@ -118,6 +119,28 @@ public:
   SedChange& operator=(const SedChange& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedChange.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedChange instance to move from.
+   */
+  SedChange(SedChange&& orig);
+
+
+  /**
+   * Move assignment operator for SedChange.
+   *
+   * @param rhs the SedChange object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedChange& operator=(SedChange&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedChange object.
    *
@@ -223,6 +246,28 @@ public:
   virtual bool isSedComputeChange() const;
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedChange object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedChangeAttribute.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -56,7 +57,6 @@ SedChangeAttribute::SedChangeAttribute(unsigned int level,
   : SedChange(level, version)
   , mNewValue ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -64,7 +64,7 @@ SedChangeAttribute::SedChangeAttribute(unsigned int level,
  * Creates a new SedChangeAttribute using the given SedNamespaces object @p
  * sedmlns.
  */
-SedChangeAttribute::SedChangeAttribute(SedNamespaces *sedmlns)
+SedChangeAttribute::SedChangeAttribute(const SedNamespaces *sedmlns)
   : SedChange(sedmlns)
   , mNewValue ("")
 {
@@ -82,6 +82,16 @@ SedChangeAttribute::SedChangeAttribute(const SedChangeAttribute& orig)
 }
 
 
+/*
+ * Move constructor for SedChangeAttribute.
+ */
+SedChangeAttribute::SedChangeAttribute(SedChangeAttribute&& orig)
+  : SedChange( std::move(orig) )
+  , mNewValue ( std::move(orig.mNewValue) )
+{
+}
+
+
 /*
  * Assignment operator for SedChangeAttribute.
  */
@@ -98,6 +108,22 @@ SedChangeAttribute::operator=(const SedChangeAttribute& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedChangeAttribute.
+ */
+SedChangeAttribute&
+SedChangeAttribute::operator=(SedChangeAttribute&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedChange::operator=(std::move(rhs));
+    mNewValue = std::move(rhs.mNewValue);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedChangeAttribute object.
  */
@@ -167,6 +193,51 @@ SedChangeAttribute::unsetNewValue()
 }
 
 
+/*
+ * Adds the memory held by this SedChangeAttribute object to @p usage.
+ */
+void
+SedChangeAttribute::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedChange::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedChangeAttribute) - sizeof(SedChange));
+  usage.addString(type, mNewValue);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedChangeAttribute object to @p
+ * stream.
+ */
+void
+SedChangeAttribute::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedChange::writeBinary(stream);
+
+  stream.writeString(mNewValue);
+}
+
+
+/*
+ * Reads the attributes and children of this SedChangeAttribute object from @p
+ * stream.
+ */
+void
+SedChangeAttribute::readBinary(SedBinaryInputStream& stream)
+{
+  SedChange::readBinary(stream);
+
+  stream.readString(mNewValue);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedChangeAttribute object.
  */
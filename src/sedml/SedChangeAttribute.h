@@ -93,7 +93,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedChangeAttribute(SedNamespaces *sedmlns);
+  SedChangeAttribute(const SedNamespaces *sedmlns);
 
 
   /**
@@ -113,6 +113,28 @@ public:
   SedChangeAttribute& operator=(const SedChangeAttribute& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedChangeAttribute.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedChangeAttribute instance to move from.
+   */
+  SedChangeAttribute(SedChangeAttribute&& orig);
+
+
+  /**
+   * Move assignment operator for SedChangeAttribute.
+   *
+   * @param rhs the SedChangeAttribute object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedChangeAttribute& operator=(SedChangeAttribute&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedChangeAttribute object.
    *
@@ -170,6 +192,28 @@ public:
   int unsetNewValue();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedChangeAttribute object.
    *
@@ -32,6 +32,8 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedChangeXML.h>
+#include <sedml/SedBinaryStream.h>
+#include <sedml/SedReader.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -55,7 +57,6 @@ SedChangeXML::SedChangeXML(unsigned int level, unsigned int version)
   : SedChange(level, version)
   , mNewXML (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -63,7 +64,7 @@ SedChangeXML::SedChangeXML(unsigned int level, unsigned int version)
 /*
  * Creates a new SedChangeXML using the given SedNamespaces object @p sedmlns.
  */
-SedChangeXML::SedChangeXML(SedNamespaces *sedmlns)
+SedChangeXML::SedChangeXML(const SedNamespaces *sedmlns)
   : SedChange(sedmlns)
   , mNewXML (NULL)
 {
@@ -78,6 +79,7 @@ SedChangeXML::SedChangeXML(SedNamespaces *sedmlns)
 SedChangeXML::SedChangeXML(const SedChangeXML& orig)
   : SedChange( orig )
   , mNewXML ( NULL )
+  , mRawNewXML ( orig.mRawNewXML )
 {
   if (orig.mNewXML != NULL)
   {
@@ -88,6 +90,20 @@ SedChangeXML::SedChangeXML(const SedChangeXML& orig)
 }
 
 
+/*
+ * Move constructor for SedChangeXML.
+ */
+SedChangeXML::SedChangeXML(SedChangeXML&& orig)
+  : SedChange( std::move(orig) )
+  , mNewXML ( orig.mNewXML )
+  , mRawNewXML ( std::move(orig.mRawNewXML) )
+{
+  orig.mNewXML = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedChangeXML.
  */
@@ -107,6 +123,29 @@ SedChangeXML::operator=(const SedChangeXML& rhs)
       mNewXML = NULL;
     }
 
+    mRawNewXML = rhs.mRawNewXML;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+/*
+ * Move assignment operator for SedChangeXML.
+ */
+SedChangeXML&
+SedChangeXML::operator=(SedChangeXML&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedChange::operator=(std::move(rhs));
+    mRawNewXML = std::move(rhs.mRawNewXML);
+    delete mNewXML;
+    mNewXML = rhs.mNewXML;
+    rhs.mNewXML = NULL;
+
     connectToChild();
   }
 
@@ -140,6 +179,7 @@ SedChangeXML::~SedChangeXML()
 const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedChangeXML::getNewXML() const
 {
+  parseRawNewXML();
   return mNewXML;
 }
 
@@ -150,6 +190,7 @@ SedChangeXML::getNewXML() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedChangeXML::getNewXML()
 {
+  parseRawNewXML();
   return mNewXML;
 }
 
@@ -160,7 +201,7 @@ SedChangeXML::getNewXML()
 bool
 SedChangeXML::isSetNewXML() const
 {
-  return (mNewXML != NULL);
+  return (mNewXML != NULL || !mRawNewXML.empty());
 }
 
 
@@ -170,6 +211,8 @@ SedChangeXML::isSetNewXML() const
 int
 SedChangeXML::setNewXML(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* newXML)
 {
+  mRawNewXML.clear();
+
   if (mNewXML == newXML)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -195,12 +238,74 @@ SedChangeXML::setNewXML(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* newXML)
 int
 SedChangeXML::unsetNewXML()
 {
+  mRawNewXML.clear();
   delete mNewXML;
   mNewXML = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
 
+/*
+ * Adds the memory held by this SedChangeXML object to @p usage.
+ */
+void
+SedChangeXML::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedChange::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedChangeXML) - sizeof(SedChange));
+  usage.addXML(type, mNewXML);
+  usage.addString(type, mRawNewXML);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Also parses the "newXML" element if it is still kept as markup.
+ */
+void
+SedChangeXML::prepareForConcurrentReads() const
+{
+  SedChange::prepareForConcurrentReads();
+  parseRawNewXML();
+}
+
+/** @endcond */
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedChangeXML object to @p stream.
+ */
+void
+SedChangeXML::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedChange::writeBinary(stream);
+
+  stream.writeXML(mRawNewXML, mNewXML);
+}
+
+
+/*
+ * Reads the attributes and children of this SedChangeXML object from @p stream.
+ */
+void
+SedChangeXML::readBinary(SedBinaryInputStream& stream)
+{
+  SedChange::readBinary(stream);
+
+  delete mNewXML;
+  mNewXML = NULL;
+  stream.readXML(mRawNewXML, mNewXML);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedChangeXML object.
  */
@@ -262,9 +367,17 @@ SedChangeXML::writeElements(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 
   if (isSetNewXML() == true)
   {
-    stream.startElement("newXML");
-    stream << *mNewXML;
-    stream.endElement("newXML");
+    if (!mRawNewXML.empty())
+    {
+      // written back unchanged as long as it has not been accessed
+      writeRawXML(stream, mRawNewXML);
+    }
+    else
+    {
+      stream.startElement("newXML");
+      stream << *mNewXML;
+      stream.endElement("newXML");
+    }
   }
 }
 
@@ -616,82 +729,145 @@ SedChangeXML::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 {
   bool read = false;
   const string& name = stream.peek().getName();
-  std::string newElementText;
 
   if (name == "newXML")
   {
-    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken& token = stream.next();
-    
-    while (stream.isGood() && stream.peek().isText())
+    // keep the markup and only build the XMLNode tree when it is accessed;
+    // a payload without any content leaves "newXML" unset
+    delete mNewXML;
+    mNewXML = NULL;
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode outline;
+    mRawNewXML = readRawXML(stream, &outline);
+    if (outline.getNumChildren() == 0)
     {
-      newElementText += stream.next().getCharacters();
+      mRawNewXML.clear();
     }
-    newElementText = _trim(newElementText);
 
-    delete mNewXML;
-    mNewXML = NULL;
+    read = true;
+  }
 
-    while (stream.isGood())
-    {
-      const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken& next = stream.peek();
-      if (!stream.isGood()) break;
+  if (SedChange::readOtherXML(stream))
+  {
+    read = true;
+  }
 
-      if (next.isEndFor(token))
-      {
-        stream.next();
-        break;
-      }
-      else if (next.isStart())
-      {
-        if (mNewXML == NULL)
-        {
-          mNewXML = new
-            LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode();
-    
-          if (!newElementText.empty())
-            mNewXML->addChild(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(newElementText));
+  return read;
+}
 
-        }
+/** @endcond */
 
-        mNewXML->addChild(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream));
-      }
-      else if (next.isText())
-      {
-        std::string s = _trim(next.getCharacters());
 
-        if (s != "" && mNewXML != NULL)
-          mNewXML->addChild(stream.next());
-        else
-          stream.skipText();
-      }
-      else
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Builds mNewXML from the content of the "newXML" element on the stream
+ */
+void
+SedChangeXML::readNewXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream) const
+{
+  std::string newElementText;
+  const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken& token = stream.next();
+  
+  while (stream.isGood() && stream.peek().isText())
+  {
+    newElementText += stream.next().getCharacters();
+  }
+  newElementText = _trim(newElementText);
+
+  delete mNewXML;
+  mNewXML = NULL;
+
+  while (stream.isGood())
+  {
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken& next = stream.peek();
+    if (!stream.isGood()) break;
+
+    if (next.isEndFor(token))
+    {
+      stream.next();
+      break;
+    }
+    else if (next.isStart())
+    {
+      if (mNewXML == NULL)
       {
-        stream.skipPastEnd(stream.next());
+        mNewXML = new
+          LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode();
+  
+        if (!newElementText.empty())
+          mNewXML->addChild(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(newElementText));
+
       }
+
+      mNewXML->addChild(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream));
     }
+    else if (next.isText())
+    {
+      std::string s = _trim(next.getCharacters());
 
-    if (mNewXML != NULL && mNewXML->getNumChildren() == 1)
+      if (s != "" && mNewXML != NULL)
+        mNewXML->addChild(stream.next());
+      else
+        stream.skipText();
+    }
+    else
     {
-      // for convenience if we have just one element hide the nesting
-      LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* copy = new
-        LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(mNewXML->getChild(0));
-      delete mNewXML;
-      mNewXML = copy;
+      stream.skipPastEnd(stream.next());
     }
+  }
 
-    if (mNewXML == NULL && !newElementText.empty())
-      mNewXML = new
-      LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(newElementText);
+  if (mNewXML != NULL && mNewXML->getNumChildren() == 1)
+  {
+    // for convenience if we have just one element hide the nesting
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* copy = new
+      LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(mNewXML->getChild(0));
+    delete mNewXML;
+    mNewXML = copy;
+  }
 
-    read = true;
+  if (mNewXML == NULL && !newElementText.empty())
+    mNewXML = new
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(newElementText);
+}
+
+
+/*
+ * Builds mNewXML from the markup kept by readOtherXML()
+ */
+void
+SedChangeXML::parseRawNewXML() const
+{
+  if (mRawNewXML.empty())
+  {
+    return;
   }
 
-  if (SedChange::readOtherXML(stream))
+  const std::string wrapped = wrapRawXML(mRawNewXML);
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream stream(wrapped.c_str(), false);
+  stream.next();
+  readNewXML(stream);
+  mRawNewXML.clear();
+}
+
+/** @endcond */
+
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Skips the "newXML" element when excluded by the load mask
+ */
+bool
+SedChangeXML::isSkippedOnRead(const std::string& name) const
+{
+  if (name == "newXML")
   {
-    read = true;
+    return !isLoadedOnRead(SEDML_LOAD_XML_PAYLOADS);
   }
 
-  return read;
+  return SedChange::isSkippedOnRead(name);
 }
 
 /** @endcond */
@@ -64,7 +64,10 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* mNewXML;
+  mutable LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* mNewXML;
+
+  // "newXML" as read, kept as markup until first accessed
+  mutable std::string mRawNewXML;
 
   /** @endcond */
 
@@ -94,7 +97,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedChangeXML(SedNamespaces *sedmlns);
+  SedChangeXML(const SedNamespaces *sedmlns);
 
 
   /**
@@ -114,6 +117,28 @@ public:
   SedChangeXML& operator=(const SedChangeXML& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedChangeXML.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedChangeXML instance to move from.
+   */
+  SedChangeXML(SedChangeXML&& orig);
+
+
+  /**
+   * Move assignment operator for SedChangeXML.
+   *
+   * @param rhs the SedChangeXML object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedChangeXML& operator=(SedChangeXML&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedChangeXML object.
    *
@@ -180,6 +205,38 @@ public:
   int unsetNewXML();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::prepareForConcurrentReads
+   */
+  virtual void prepareForConcurrentReads() const;
+
+  /** @endcond */
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedChangeXML object.
    *
@@ -567,6 +624,34 @@ protected:
 
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Builds mNewXML from the content of the "newXML" element on the stream
+   */
+  void readNewXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream) const;
+
+
+  /**
+   * Builds mNewXML from the markup kept by readOtherXML()
+   */
+  void parseRawNewXML() const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Skips the "newXML" element when excluded by the load mask
+   */
+  virtual bool isSkippedOnRead(const std::string& name) const;
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibSEDMLInternal */
 
   /**
@@ -0,0 +1,1394 @@
+/**
+ * @file SedCompiledMath.cpp
+ * @brief Implementation of the SedCompiledMath class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+#include <sedml/SedCompiledMath.h>
+#include <sedml/SedDataGenerator.h>
+#include <sedml/SedComputeChange.h>
+#include <sedml/SedSetValue.h>
+#include <sedml/SedFunctionalRange.h>
+#include <sedml/SedTypeCodes.h>
+#include <sedml/common/SedMathKernels.h>
+
+#include <sbml/math/ASTNode.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Number of elements each instruction processes at a time; small enough
+ * for the registers to stay in the first level cache.
+ */
+static const size_t BLOCK_SIZE = 256;
+
+static const double NOT_A_NUMBER = numeric_limits<double>::quiet_NaN();
+
+
+enum SedMathReduction
+{
+  SEDML_REDUCE_NONE = -1,
+  SEDML_REDUCE_SUM,
+  SEDML_REDUCE_PRODUCT,
+  SEDML_REDUCE_MIN,
+  SEDML_REDUCE_MAX
+};
+
+
+static double factorial(double x) { return tgamma(x + 1.0); }
+static double sec(double x)       { return 1.0 / cos(x); }
+static double csc(double x)       { return 1.0 / sin(x); }
+static double cot(double x)       { return 1.0 / tan(x); }
+static double sech(double x)      { return 1.0 / cosh(x); }
+static double csch(double x)      { return 1.0 / sinh(x); }
+static double coth(double x)      { return 1.0 / tanh(x); }
+static double arcsec(double x)    { return acos(1.0 / x); }
+static double arccsc(double x)    { return asin(1.0 / x); }
+static double arccot(double x)    { return atan(1.0 / x); }
+static double arcsech(double x)   { return acosh(1.0 / x); }
+static double arccsch(double x)   { return asinh(1.0 / x); }
+static double arccoth(double x)   { return atanh(1.0 / x); }
+
+static double sinFunction(double x)   { return sin(x); }
+static double cosFunction(double x)   { return cos(x); }
+static double tanFunction(double x)   { return tan(x); }
+static double sinhFunction(double x)  { return sinh(x); }
+static double coshFunction(double x)  { return cosh(x); }
+static double tanhFunction(double x)  { return tanh(x); }
+static double asinFunction(double x)  { return asin(x); }
+static double acosFunction(double x)  { return acos(x); }
+static double atanFunction(double x)  { return atan(x); }
+static double asinhFunction(double x) { return asinh(x); }
+static double acoshFunction(double x) { return acosh(x); }
+static double atanhFunction(double x) { return atanh(x); }
+
+
+/*
+ * Returns the function computing a MathML function without an instruction
+ * of its own, or @c NULL.
+ */
+static double
+(*getFunction(int type))(double)
+{
+  switch (type)
+  {
+  case AST_FUNCTION_FACTORIAL: return factorial;
+  case AST_FUNCTION_SIN:       return sinFunction;
+  case AST_FUNCTION_COS:       return cosFunction;
+  case AST_FUNCTION_TAN:       return tanFunction;
+  case AST_FUNCTION_SEC:       return sec;
+  case AST_FUNCTION_CSC:       return csc;
+  case AST_FUNCTION_COT:       return cot;
+  case AST_FUNCTION_SINH:      return sinhFunction;
+  case AST_FUNCTION_COSH:      return coshFunction;
+  case AST_FUNCTION_TANH:      return tanhFunction;
+  case AST_FUNCTION_SECH:      return sech;
+  case AST_FUNCTION_CSCH:      return csch;
+  case AST_FUNCTION_COTH:      return coth;
+  case AST_FUNCTION_ARCSIN:    return asinFunction;
+  case AST_FUNCTION_ARCCOS:    return acosFunction;
+  case AST_FUNCTION_ARCTAN:    return atanFunction;
+  case AST_FUNCTION_ARCSEC:    return arcsec;
+  case AST_FUNCTION_ARCCSC:    return arccsc;
+  case AST_FUNCTION_ARCCOT:    return arccot;
+  case AST_FUNCTION_ARCSINH:   return asinhFunction;
+  case AST_FUNCTION_ARCCOSH:   return acoshFunction;
+  case AST_FUNCTION_ARCTANH:   return atanhFunction;
+  case AST_FUNCTION_ARCSECH:   return arcsech;
+  case AST_FUNCTION_ARCCSCH:   return arccsch;
+  case AST_FUNCTION_ARCCOTH:   return arccoth;
+  default:                     return NULL;
+  }
+}
+
+
+/*
+ * Returns the instruction computing a unary MathML operator or function,
+ * or -1.
+ */
+static int
+getUnaryOp(int type)
+{
+  switch (type)
+  {
+  case AST_FUNCTION_ABS:     return SEDML_OP_ABS;
+  case AST_FUNCTION_EXP:     return SEDML_OP_EXP;
+  case AST_FUNCTION_LN:      return SEDML_OP_LN;
+  case AST_FUNCTION_LOG:     return SEDML_OP_LOG10;
+  case AST_FUNCTION_ROOT:    return SEDML_OP_SQRT;
+  case AST_FUNCTION_FLOOR:   return SEDML_OP_FLOOR;
+  case AST_FUNCTION_CEILING: return SEDML_OP_CEIL;
+  case AST_LOGICAL_NOT:      return SEDML_OP_NOT;
+  case AST_MINUS:            return SEDML_OP_NEG;
+  default:                   return -1;
+  }
+}
+
+
+/*
+ * Returns the instruction computing a binary MathML operator or function,
+ * or -1.
+ */
+static int
+getBinaryOp(int type)
+{
+  switch (type)
+  {
+  case AST_MINUS:              return SEDML_OP_SUB;
+  case AST_DIVIDE:             return SEDML_OP_DIV;
+  case AST_POWER:
+  case AST_FUNCTION_POWER:     return SEDML_OP_POW;
+  case AST_FUNCTION_ROOT:      return SEDML_OP_ROOT;
+  case AST_FUNCTION_LOG:       return SEDML_OP_LOGBASE;
+  case AST_FUNCTION_QUOTIENT:  return SEDML_OP_QUOTIENT;
+  case AST_FUNCTION_REM:       return SEDML_OP_REM;
+  case AST_LOGICAL_IMPLIES:    return SEDML_OP_IMPLIES;
+  default:                     return -1;
+  }
+}
+
+
+/*
+ * Returns the instruction comparing two values, or -1.
+ */
+static int
+getRelationalOp(int type)
+{
+  switch (type)
+  {
+  case AST_RELATIONAL_EQ:  return SEDML_OP_EQ;
+  case AST_RELATIONAL_NEQ: return SEDML_OP_NEQ;
+  case AST_RELATIONAL_GT:  return SEDML_OP_GT;
+  case AST_RELATIONAL_GEQ: return SEDML_OP_GEQ;
+  case AST_RELATIONAL_LT:  return SEDML_OP_LT;
+  case AST_RELATIONAL_LEQ: return SEDML_OP_LEQ;
+  default:                 return -1;
+  }
+}
+
+
+/*
+ * Returns the reduction named by a function, or SEDML_REDUCE_NONE.
+ */
+static int
+getReduction(const ASTNode* node)
+{
+  switch (node->getType())
+  {
+  case AST_FUNCTION_MIN: return SEDML_REDUCE_MIN;
+  case AST_FUNCTION_MAX: return SEDML_REDUCE_MAX;
+  default:               break;
+  }
+
+  const string name = node->getName() != NULL ? node->getName() : "";
+  if (name == "min")     return SEDML_REDUCE_MIN;
+  if (name == "max")     return SEDML_REDUCE_MAX;
+  if (name == "sum")     return SEDML_REDUCE_SUM;
+  if (name == "product") return SEDML_REDUCE_PRODUCT;
+  return SEDML_REDUCE_NONE;
+}
+
+
+/*
+ * Applies one instruction to @p n elements.
+ */
+static void
+execute(int op, double* d, const double* a, const double* b,
+        const double* c, double (*function)(double), size_t n)
+{
+  switch (op)
+  {
+  case SEDML_OP_COPY:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i];
+    break;
+  case SEDML_OP_NEG:
+    for (size_t i = 0; i < n; ++i) d[i] = -a[i];
+    break;
+  case SEDML_OP_ADD:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] + b[i];
+    break;
+  case SEDML_OP_SUB:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] - b[i];
+    break;
+  case SEDML_OP_MUL:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] * b[i];
+    break;
+  case SEDML_OP_DIV:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] / b[i];
+    break;
+  case SEDML_OP_POW:
+    for (size_t i = 0; i < n; ++i) d[i] = pow(a[i], b[i]);
+    break;
+  case SEDML_OP_ROOT:
+    for (size_t i = 0; i < n; ++i) d[i] = pow(b[i], 1.0 / a[i]);
+    break;
+  case SEDML_OP_LOGBASE:
+    for (size_t i = 0; i < n; ++i) d[i] = log(b[i]) / log(a[i]);
+    break;
+  case SEDML_OP_ABS:
+    for (size_t i = 0; i < n; ++i) d[i] = fabs(a[i]);
+    break;
+  case SEDML_OP_EXP:
+    for (size_t i = 0; i < n; ++i) d[i] = exp(a[i]);
+    break;
+  case SEDML_OP_LN:
+    for (size_t i = 0; i < n; ++i) d[i] = log(a[i]);
+    break;
+  case SEDML_OP_LOG10:
+    for (size_t i = 0; i < n; ++i) d[i] = log10(a[i]);
+    break;
+  case SEDML_OP_SQRT:
+    for (size_t i = 0; i < n; ++i) d[i] = sqrt(a[i]);
+    break;
+  case SEDML_OP_FLOOR:
+    for (size_t i = 0; i < n; ++i) d[i] = floor(a[i]);
+    break;
+  case SEDML_OP_CEIL:
+    for (size_t i = 0; i < n; ++i) d[i] = ceil(a[i]);
+    break;
+  case SEDML_OP_QUOTIENT:
+    for (size_t i = 0; i < n; ++i) d[i] = trunc(a[i] / b[i]);
+    break;
+  case SEDML_OP_REM:
+    for (size_t i = 0; i < n; ++i) d[i] = fmod(a[i], b[i]);
+    break;
+  case SEDML_OP_MIN:
+    for (size_t i = 0; i < n; ++i) d[i] = b[i] < a[i] ? b[i] : a[i];
+    break;
+  case SEDML_OP_MAX:
+    for (size_t i = 0; i < n; ++i) d[i] = b[i] > a[i] ? b[i] : a[i];
+    break;
+  case SEDML_OP_EQ:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] == b[i] ? 1.0 : 0.0;
+    break;
+  case SEDML_OP_NEQ:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] != b[i] ? 1.0 : 0.0;
+    break;
+  case SEDML_OP_GT:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] > b[i] ? 1.0 : 0.0;
+    break;
+  case SEDML_OP_GEQ:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] >= b[i] ? 1.0 : 0.0;
+    break;
+  case SEDML_OP_LT:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] < b[i] ? 1.0 : 0.0;
+    break;
+  case SEDML_OP_LEQ:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] <= b[i] ? 1.0 : 0.0;
+    break;
+  case SEDML_OP_AND:
+    for (size_t i = 0; i < n; ++i)
+      d[i] = a[i] != 0.0 && b[i] != 0.0 ? 1.0 : 0.0;
+    break;
+  case SEDML_OP_OR:
+    for (size_t i = 0; i < n; ++i)
+      d[i] = a[i] != 0.0 || b[i] != 0.0 ? 1.0 : 0.0;
+    break;
+  case SEDML_OP_XOR:
+    for (size_t i = 0; i < n; ++i)
+      d[i] = (a[i] != 0.0) != (b[i] != 0.0) ? 1.0 : 0.0;
+    break;
+  case SEDML_OP_NOT:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] == 0.0 ? 1.0 : 0.0;
+    break;
+  case SEDML_OP_IMPLIES:
+    for (size_t i = 0; i < n; ++i)
+      d[i] = a[i] == 0.0 || b[i] != 0.0 ? 1.0 : 0.0;
+    break;
+  case SEDML_OP_SELECT:
+    for (size_t i = 0; i < n; ++i) d[i] = a[i] != 0.0 ? b[i] : c[i];
+    break;
+  case SEDML_OP_CALL:
+    for (size_t i = 0; i < n; ++i) d[i] = function(a[i]);
+    break;
+  default:
+    for (size_t i = 0; i < n; ++i) d[i] = NOT_A_NUMBER;
+    break;
+  }
+}
+
+
+/*
+ * Describes the math, Variable and Parameter children of an object that
+ * owns math.
+ */
+template <typename Owner>
+static void
+describe(const Owner* owner, const ASTNode*& math,
+         vector<string>& variables, vector<pair<string, double> >& parameters)
+{
+  math = owner->getMath();
+
+  for (unsigned int i = 0; i < owner->getNumVariables(); ++i)
+  {
+    variables.push_back(owner->getVariable(i)->getId());
+  }
+
+  for (unsigned int i = 0; i < owner->getNumParameters(); ++i)
+  {
+    const SedParameter* parameter = owner->getParameter(i);
+    parameters.push_back(make_pair(parameter->getId(), parameter->getValue()));
+  }
+}
+
+
+static bool
+describeOwner(const SedBase* owner, const ASTNode*& math,
+              vector<string>& variables,
+              vector<pair<string, double> >& parameters)
+{
+  switch (owner->getTypeCode())
+  {
+  case SEDML_DATAGENERATOR:
+    describe(static_cast<const SedDataGenerator*>(owner), math, variables,
+             parameters);
+    return true;
+  case SEDML_CHANGE_COMPUTECHANGE:
+    describe(static_cast<const SedComputeChange*>(owner), math, variables,
+             parameters);
+    return true;
+  case SEDML_TASK_SETVALUE:
+    describe(static_cast<const SedSetValue*>(owner), math, variables,
+             parameters);
+    return true;
+  case SEDML_RANGE_FUNCTIONALRANGE:
+    describe(static_cast<const SedFunctionalRange*>(owner), math, variables,
+             parameters);
+    return true;
+  default:
+    return false;
+  }
+}
+
+
+/*
+ * Returns the math of an object that owns math, or NULL.
+ */
+static const ASTNode*
+getOwnerMath(const SedBase* owner)
+{
+  switch (owner->getTypeCode())
+  {
+  case SEDML_DATAGENERATOR:
+    return static_cast<const SedDataGenerator*>(owner)->getMath();
+  case SEDML_CHANGE_COMPUTECHANGE:
+    return static_cast<const SedComputeChange*>(owner)->getMath();
+  case SEDML_TASK_SETVALUE:
+    return static_cast<const SedSetValue*>(owner)->getMath();
+  case SEDML_RANGE_FUNCTIONALRANGE:
+    return static_cast<const SedFunctionalRange*>(owner)->getMath();
+  default:
+    return NULL;
+  }
+}
+
+
+/*
+ * Mixes @p value into the FNV-1a hash @p hash.
+ */
+static void
+mix(unsigned long long& hash, unsigned long long value)
+{
+  for (int i = 0; i < 8; ++i)
+  {
+    hash = (hash ^ (value & 0xff)) * 1099511628211ULL;
+    value >>= 8;
+  }
+}
+
+/** @endcond */
+
+
+/*
+ * Creates a new, empty SedCompiledMath.
+ */
+SedCompiledMath::SedCompiledMath()
+  : mPrograms ()
+  , mInputs ()
+  , mUsed ()
+  , mConstants ()
+  , mCompiled (false)
+  , mFingerprint (0)
+  , mRetired (NULL)
+{
+}
+
+
+/*
+ * Destructor for SedCompiledMath.
+ */
+SedCompiledMath::~SedCompiledMath()
+{
+  delete mRetired;
+}
+
+
+/*
+ * Compiles the given math.
+ */
+int
+SedCompiledMath::compile(const ASTNode* math,
+                         const std::vector<std::string>& inputs)
+{
+  clear();
+  return compileMath(math, inputs);
+}
+
+
+/*
+ * Compiles the math of an object, with its Variable children as inputs
+ * and its Parameter children as constants.
+ */
+int
+SedCompiledMath::compile(const SedBase* owner)
+{
+  clear();
+
+  const ASTNode* math = NULL;
+  vector<string> variables;
+  if (owner == NULL ||
+      !describeOwner(owner, math, variables, mConstants))
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  mFingerprint = fingerprint(math);
+  return compileMath(math, variables);
+}
+
+
+/*
+ * Predicate returning @c true if this SedCompiledMath holds a program.
+ */
+bool
+SedCompiledMath::isCompiled() const
+{
+  return mCompiled;
+}
+
+
+/*
+ * Returns the number of inputs of the program.
+ */
+unsigned int
+SedCompiledMath::getNumInputs() const
+{
+  return static_cast<unsigned int>(mInputs.size());
+}
+
+
+/*
+ * Returns the identifier bound to the nth input.
+ */
+const std::string&
+SedCompiledMath::getInputName(unsigned int n) const
+{
+  static const std::string empty;
+  return n < mInputs.size() ? mInputs[n] : empty;
+}
+
+
+/*
+ * Returns the index of the input bound to the given identifier.
+ */
+int
+SedCompiledMath::getInputIndex(const std::string& name) const
+{
+  for (size_t i = 0; i < mInputs.size(); ++i)
+  {
+    if (mInputs[i] == name)
+    {
+      return static_cast<int>(i);
+    }
+  }
+
+  return -1;
+}
+
+
+/*
+ * Predicate returning @c true if the program reads the nth input.
+ */
+bool
+SedCompiledMath::usesInput(unsigned int n) const
+{
+  return n < mUsed.size() && mUsed[n];
+}
+
+
+/*
+ * Predicate returning true if the program contains reductions.
+ */
+bool
+SedCompiledMath::hasReductions() const
+{
+  return mPrograms.size() > 1;
+}
+
+
+/*
+ * Returns the number of instructions of the program.
+ */
+unsigned int
+SedCompiledMath::getNumInstructions() const
+{
+  size_t count = 0;
+
+  for (size_t i = 0; i < mPrograms.size(); ++i)
+  {
+    count += mPrograms[i].code.size();
+  }
+
+  return static_cast<unsigned int>(count);
+}
+
+
+/*
+ * Evaluates the program for a single set of input values.
+ */
+double
+SedCompiledMath::evaluate(const double* inputs) const
+{
+  vector<const double*> columns(mInputs.size(), NULL);
+  for (size_t i = 0; i < columns.size(); ++i)
+  {
+    columns[i] = inputs + i;
+  }
+
+  double result = NOT_A_NUMBER;
+  evaluate(columns.data(), 1, &result);
+  return result;
+}
+
+
+/*
+ * Evaluates the program over arrays, one block of elements at a time.
+ * Reductions are computed first, innermost first, each over all elements.
+ */
+int
+SedCompiledMath::evaluate(const double* const* inputs, size_t length,
+                          double* result) const
+{
+  if (!mCompiled)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  for (size_t i = 0; i < mInputs.size(); ++i)
+  {
+    if (mUsed[i] && inputs[i] == NULL)
+    {
+      return LIBSEDML_INVALID_OBJECT;
+    }
+  }
+
+  int registers = 1;
+  for (size_t i = 0; i < mPrograms.size(); ++i)
+  {
+    registers = max(registers, mPrograms[i].registers);
+  }
+
+  vector<double> scratch(static_cast<size_t>(registers) * BLOCK_SIZE);
+  vector<double> scalars(mPrograms.size(), 0.0);
+
+  for (size_t k = mPrograms.size() - 1; k > 0; --k)
+  {
+    const Program& program = mPrograms[k];
+    double total = program.reduction == SEDML_REDUCE_PRODUCT ? 1.0 : 0.0;
+    bool first = true;
+
+    for (size_t offset = 0; offset < length; offset += BLOCK_SIZE)
+    {
+      const size_t count = min(BLOCK_SIZE, length - offset);
+      const double* values = run(program, inputs, offset, count,
+                                 scratch.data(), scalars);
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        const double value = values != NULL ? values[i] : program.value;
+        switch (program.reduction)
+        {
+        case SEDML_REDUCE_SUM:     total += value; break;
+        case SEDML_REDUCE_PRODUCT: total *= value; break;
+        case SEDML_REDUCE_MIN:
+          total = first || value < total ? value : total;
+          break;
+        default:
+          total = first || value > total ? value : total;
+          break;
+        }
+        first = false;
+      }
+    }
+
+    if (first && (program.reduction == SEDML_REDUCE_MIN ||
+                  program.reduction == SEDML_REDUCE_MAX))
+    {
+      total = NOT_A_NUMBER;
+    }
+
+    scalars[k] = total;
+  }
+
+  const Program& main = mPrograms[0];
+  for (size_t offset = 0; offset < length; offset += BLOCK_SIZE)
+  {
+    const size_t count = min(BLOCK_SIZE, length - offset);
+    const double* values = run(main, inputs, offset, count, scratch.data(),
+                               scalars);
+
+    if (values != NULL)
+    {
+      copy(values, values + count, result + offset);
+    }
+    else
+    {
+      fill(result + offset, result + offset + count, main.value);
+    }
+  }
+
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Selects the instruction set used by all programs.
+ */
+int
+SedCompiledMath::setInstructionSet(const std::string& name)
+{
+  return setSedMathKernels(name) ? LIBSEDML_OPERATION_SUCCESS
+                                 : LIBSEDML_INVALID_ATTRIBUTE_VALUE;
+}
+
+
+/*
+ * Returns the instruction set used by all programs.
+ */
+std::string
+SedCompiledMath::getInstructionSet()
+{
+  return getSedMathKernels()->name;
+}
+
+
+/*
+ * Returns the instruction sets supported here.
+ */
+std::vector<std::string>
+SedCompiledMath::getInstructionSets()
+{
+  return getAvailableSedMathKernels();
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Discards the program.
+ */
+void
+SedCompiledMath::clear()
+{
+  mPrograms.clear();
+  mInputs.clear();
+  mUsed.clear();
+  mConstants.clear();
+  mCompiled = false;
+  mFingerprint = 0;
+}
+
+
+/*
+ * Compiles math into mPrograms[0], keeping the constants already set.
+ */
+int
+SedCompiledMath::compileMath(const ASTNode* math,
+                             const std::vector<std::string>& inputs)
+{
+  mInputs = inputs;
+  mUsed.assign(inputs.size(), false);
+
+  if (math == NULL)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  Program main;
+  main.registers = 0;
+  main.result = 0;
+  main.constant = false;
+  main.value = 0.0;
+  main.reduction = SEDML_REDUCE_NONE;
+  mPrograms.push_back(main);
+
+  int top = 0;
+  Operand result;
+  if (!compileNode(math, 0, top, result))
+  {
+    mPrograms.clear();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  mPrograms[0].constant = result.constant;
+  mPrograms[0].value = result.value;
+  mPrograms[0].result = result.ref;
+  mCompiled = true;
+
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Compiles a node into the given program.  The result is a constant, an
+ * input, or the register at the top of the stack; registers above @p top
+ * are free.
+ */
+bool
+SedCompiledMath::compileNode(const ASTNode* node, size_t program, int& top,
+                             Operand& result)
+{
+  if (node == NULL)
+  {
+    return false;
+  }
+
+  const int type = node->getType();
+  const unsigned int n = node->getNumChildren();
+
+  result.constant = true;
+  result.value = NOT_A_NUMBER;
+  result.ref = 0;
+
+  switch (type)
+  {
+  case AST_INTEGER:
+    result.value = static_cast<double>(node->getInteger());
+    return true;
+  case AST_REAL:
+  case AST_REAL_E:
+  case AST_RATIONAL:
+    result.value = node->getReal();
+    return true;
+  case AST_CONSTANT_E:
+    result.value = exp(1.0);
+    return true;
+  case AST_CONSTANT_PI:
+    result.value = 4.0 * atan(1.0);
+    return true;
+  case AST_CONSTANT_TRUE:
+    result.value = 1.0;
+    return true;
+  case AST_CONSTANT_FALSE:
+    result.value = 0.0;
+    return true;
+  case AST_NAME_AVOGADRO:
+    result.value = 6.02214179e23;
+    return true;
+
+  case AST_NAME:
+  case AST_NAME_TIME:
+  {
+    const string name = node->getName() != NULL ? node->getName() : "time";
+
+    for (size_t i = 0; i < mConstants.size(); ++i)
+    {
+      if (mConstants[i].first == name)
+      {
+        result.value = mConstants[i].second;
+        return true;
+      }
+    }
+
+    int index = getInputIndex(name);
+    if (index < 0)
+    {
+      index = static_cast<int>(mInputs.size());
+      mInputs.push_back(name);
+      mUsed.push_back(false);
+    }
+    mUsed[index] = true;
+
+    result.constant = false;
+    result.ref = -1 - index;
+    return true;
+  }
+
+  case AST_PLUS:
+  case AST_TIMES:
+  case AST_LOGICAL_AND:
+  case AST_LOGICAL_OR:
+  case AST_LOGICAL_XOR:
+  case AST_FUNCTION_MIN:
+  case AST_FUNCTION_MAX:
+  case AST_FUNCTION:
+  {
+    if (type == AST_FUNCTION || type == AST_FUNCTION_MIN ||
+        type == AST_FUNCTION_MAX)
+    {
+      const int reduction = getReduction(node);
+      if (reduction == SEDML_REDUCE_NONE ||
+          (n != 1 && (reduction == SEDML_REDUCE_SUM ||
+                      reduction == SEDML_REDUCE_PRODUCT)))
+      {
+        return false;
+      }
+      if (n == 1)
+      {
+        return compileReduction(reduction, node->getChild(0), program, top,
+                                result);
+      }
+    }
+
+    int op = SEDML_OP_ADD;
+    switch (type)
+    {
+    case AST_TIMES:         op = SEDML_OP_MUL; result.value = 1.0; break;
+    case AST_LOGICAL_AND:   op = SEDML_OP_AND; result.value = 1.0; break;
+    case AST_LOGICAL_OR:    op = SEDML_OP_OR;  result.value = 0.0; break;
+    case AST_LOGICAL_XOR:   op = SEDML_OP_XOR; result.value = 0.0; break;
+    case AST_PLUS:          op = SEDML_OP_ADD; result.value = 0.0; break;
+    default:
+      op = getReduction(node) == SEDML_REDUCE_MIN ? SEDML_OP_MIN
+                                                  : SEDML_OP_MAX;
+      break;
+    }
+
+    if (n == 0)
+    {
+      return true;
+    }
+
+    Operand operands[2];
+    if (!compileNode(node->getChild(0), program, top, operands[0]))
+    {
+      return false;
+    }
+
+    const bool logical = op == SEDML_OP_AND || op == SEDML_OP_OR ||
+                         op == SEDML_OP_XOR;
+    if (n == 1 && logical)
+    {
+      // a single argument is converted to a truth value
+      operands[1].constant = true;
+      operands[1].value = 0.0;
+      operands[1].ref = 0;
+      result = emit(program, SEDML_OP_NEQ, operands, 2, top);
+      return true;
+    }
+
+    for (unsigned int i = 1; i < n; ++i)
+    {
+      if (!compileNode(node->getChild(i), program, top, operands[1]))
+      {
+        return false;
+      }
+      operands[0] = emit(program, op, operands, 2, top);
+    }
+
+    result = operands[0];
+    return true;
+  }
+
+  case AST_RELATIONAL_EQ:
+  case AST_RELATIONAL_NEQ:
+  case AST_RELATIONAL_GT:
+  case AST_RELATIONAL_GEQ:
+  case AST_RELATIONAL_LT:
+  case AST_RELATIONAL_LEQ:
+  {
+    // a < b < c is (a < b) and (b < c); b is compiled twice
+    result.value = 1.0;
+    bool first = true;
+
+    for (unsigned int i = 1; i < n; ++i)
+    {
+      Operand pair[2];
+      if (!compileNode(node->getChild(i - 1), program, top, pair[0]) ||
+          !compileNode(node->getChild(i), program, top, pair[1]))
+      {
+        return false;
+      }
+
+      Operand operands[2];
+      operands[0] = result;
+      operands[1] = emit(program, getRelationalOp(type), pair, 2, top);
+      result = first ? operands[1]
+                     : emit(program, SEDML_OP_AND, operands, 2, top);
+      first = false;
+    }
+
+    return true;
+  }
+
+  case AST_FUNCTION_PIECEWISE:
+  {
+    // piece, condition, ..., otherwise: built from the otherwise upwards
+    Operand operands[3];
+    if (n % 2 == 1)
+    {
+      if (!compileNode(node->getChild(n - 1), program, top, operands[0]))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      operands[0] = result;
+    }
+
+    for (unsigned int i = n - n % 2; i >= 2; i -= 2)
+    {
+      if (!compileNode(node->getChild(i - 2), program, top, operands[1]) ||
+          !compileNode(node->getChild(i - 1), program, top, operands[2]))
+      {
+        return false;
+      }
+
+      Operand select[3] = { operands[2], operands[1], operands[0] };
+      operands[0] = emit(program, SEDML_OP_SELECT, select, 3, top);
+    }
+
+    result = operands[0];
+    return true;
+  }
+
+  default:
+    break;
+  }
+
+  double (*function)(double) = getFunction(type);
+  const int unary = getUnaryOp(type);
+  const int binary = getBinaryOp(type);
+
+  if (n == 1 && (function != NULL || unary >= 0))
+  {
+    Operand operand;
+    if (!compileNode(node->getChild(0), program, top, operand))
+    {
+      return false;
+    }
+
+    result = function != NULL
+      ? emit(program, SEDML_OP_CALL, &operand, 1, top, function)
+      : emit(program, unary, &operand, 1, top);
+    return true;
+  }
+
+  if (n == 2 && binary >= 0)
+  {
+    Operand operands[2];
+    if (!compileNode(node->getChild(0), program, top, operands[0]) ||
+        !compileNode(node->getChild(1), program, top, operands[1]))
+    {
+      return false;
+    }
+
+    result = emit(program, binary, operands, 2, top);
+    return true;
+  }
+
+  // lambda, delay, rateOf, unknown functions, wrong argument counts
+  return false;
+}
+
+
+/*
+ * Compiles the argument of a reduction into a program of its own; the
+ * calling program reads the result from a scalar.
+ */
+bool
+SedCompiledMath::compileReduction(int kind, const ASTNode* node,
+                                  size_t program, int& top, Operand& result)
+{
+  const size_t index = mPrograms.size();
+
+  Program reduction;
+  reduction.registers = 0;
+  reduction.result = 0;
+  reduction.constant = false;
+  reduction.value = 0.0;
+  reduction.reduction = kind;
+  mPrograms.push_back(reduction);
+
+  int reductionTop = 0;
+  Operand value;
+  if (!compileNode(node, index, reductionTop, value))
+  {
+    return false;
+  }
+
+  mPrograms[index].constant = value.constant;
+  mPrograms[index].value = value.value;
+  mPrograms[index].result = value.ref;
+
+  Instruction instruction;
+  instruction.op = SEDML_OP_SCALAR;
+  instruction.dst = top;
+  instruction.a = static_cast<int>(index);
+  instruction.b = instruction.a;
+  instruction.c = instruction.a;
+  instruction.value = 0.0;
+  instruction.function = NULL;
+  mPrograms[program].code.push_back(instruction);
+
+  result.constant = false;
+  result.value = 0.0;
+  result.ref = top++;
+  mPrograms[program].registers = max(mPrograms[program].registers, top);
+
+  return true;
+}
+
+
+/*
+ * Emits an instruction, or computes its result right away if all operands
+ * are constant.  The result goes to the lowest register among the
+ * operands, which are the topmost ones, or to a new register.
+ */
+SedCompiledMath::Operand
+SedCompiledMath::emit(size_t program, int op, const Operand* operands,
+                      unsigned int count, int& top,
+                      double (*function)(double))
+{
+  bool constant = true;
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    constant = constant && operands[i].constant;
+  }
+
+  Operand result;
+  result.constant = constant;
+  result.value = 0.0;
+  result.ref = 0;
+
+  if (constant)
+  {
+    const double a = operands[0].value;
+    const double b = count > 1 ? operands[1].value : a;
+    const double c = count > 2 ? operands[2].value : a;
+    execute(op, &result.value, &a, &b, &c, function, 1);
+    return result;
+  }
+
+  Operand args[3];
+  int dst = -1;
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    args[i] = operands[i];
+    materialize(program, args[i], top);
+    if (args[i].ref >= 0)
+    {
+      dst = dst < 0 ? args[i].ref : min(dst, args[i].ref);
+    }
+  }
+
+  if (dst < 0)
+  {
+    dst = top;
+  }
+  top = dst + 1;
+
+  Program& code = mPrograms[program];
+  code.registers = max(code.registers, top);
+
+  Instruction instruction;
+  instruction.op = op;
+  instruction.dst = dst;
+  instruction.a = args[0].ref;
+  instruction.b = count > 1 ? args[1].ref : args[0].ref;
+  instruction.c = count > 2 ? args[2].ref : args[0].ref;
+  instruction.value = 0.0;
+  instruction.function = function;
+  code.code.push_back(instruction);
+
+  result.ref = dst;
+  return result;
+}
+
+
+/*
+ * Loads a constant operand into a new register.
+ */
+void
+SedCompiledMath::materialize(size_t program, Operand& operand, int& top)
+{
+  if (!operand.constant)
+  {
+    return;
+  }
+
+  Instruction instruction;
+  instruction.op = SEDML_OP_CONST;
+  instruction.dst = top;
+  instruction.a = top;
+  instruction.b = top;
+  instruction.c = top;
+  instruction.value = operand.value;
+  instruction.function = NULL;
+  mPrograms[program].code.push_back(instruction);
+
+  operand.constant = false;
+  operand.ref = top++;
+  mPrograms[program].registers = max(mPrograms[program].registers, top);
+}
+
+
+/*
+ * Runs a program over @p count elements starting at @p offset; returns the
+ * result, or @c NULL if the program is a constant.
+ */
+const double*
+SedCompiledMath::run(const Program& program, const double* const* inputs,
+                     size_t offset, size_t count, double* registers,
+                     const std::vector<double>& scalars) const
+{
+  if (program.constant)
+  {
+    return NULL;
+  }
+
+  const SedMathKernelSet* kernels = getSedMathKernels();
+
+  for (size_t i = 0; i < program.code.size(); ++i)
+  {
+    const Instruction& instruction = program.code[i];
+    double* d = registers + instruction.dst * BLOCK_SIZE;
+
+    if (instruction.op == SEDML_OP_CONST)
+    {
+      fill(d, d + count, instruction.value);
+      continue;
+    }
+    if (instruction.op == SEDML_OP_SCALAR)
+    {
+      fill(d, d + count, scalars[instruction.a]);
+      continue;
+    }
+
+    const int refs[3] = { instruction.a, instruction.b, instruction.c };
+    const double* operands[3];
+    for (int j = 0; j < 3; ++j)
+    {
+      operands[j] = refs[j] >= 0 ? registers + refs[j] * BLOCK_SIZE
+                                 : inputs[-1 - refs[j]] + offset;
+    }
+
+    SedMathKernel kernel = kernels->kernels[instruction.op];
+    if (kernel != NULL)
+    {
+      kernel(d, operands[0], operands[1], operands[2], count);
+    }
+    else
+    {
+      execute(instruction.op, d, operands[0], operands[1], operands[2],
+              instruction.function, count);
+    }
+  }
+
+  return program.result >= 0 ? registers + program.result * BLOCK_SIZE
+                             : inputs[-1 - program.result] + offset;
+}
+
+
+/*
+ * Returns a hash of the structure, names and numbers of @p math, without
+ * allocating.
+ */
+unsigned long long
+SedCompiledMath::fingerprint(const ASTNode* math)
+{
+  unsigned long long hash = 14695981039346656037ULL;
+
+  if (math == NULL)
+  {
+    return hash;
+  }
+
+  mix(hash, static_cast<unsigned long long>(math->getType()));
+
+  if (math->isNumber())
+  {
+    const double value = math->getReal();
+    unsigned long long bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    mix(hash, bits);
+  }
+  else if (math->getName() != NULL)
+  {
+    for (const char* c = math->getName(); *c != '\0'; ++c)
+    {
+      mix(hash, static_cast<unsigned char>(*c));
+    }
+  }
+
+  mix(hash, math->getNumChildren());
+  for (unsigned int i = 0; i < math->getNumChildren(); ++i)
+  {
+    mix(hash, fingerprint(math->getChild(i)));
+  }
+
+  return hash;
+}
+
+
+/*
+ * Creates an empty cache.
+ */
+SedCompiledMathCache::SedCompiledMathCache()
+  : mCompiled (NULL)
+  , mMathExposed (false)
+{
+}
+
+
+/*
+ * Copies start empty.
+ */
+SedCompiledMathCache::SedCompiledMathCache(const SedCompiledMathCache&)
+  : mCompiled (NULL)
+  , mMathExposed (false)
+{
+}
+
+
+/*
+ * Assignment discards the program, as the math it was compiled from has
+ * been replaced.
+ */
+SedCompiledMathCache&
+SedCompiledMathCache::operator=(const SedCompiledMathCache& rhs)
+{
+  if (&rhs != this)
+  {
+    clear();
+    mMathExposed = false;
+  }
+
+  return *this;
+}
+
+
+/*
+ * Deletes the program and the one it replaced.
+ */
+SedCompiledMathCache::~SedCompiledMathCache()
+{
+  clear();
+}
+
+
+/*
+ * Returns the program for @p owner, compiling it if there is none or the
+ * math was edited in place since.  If another thread installs a program
+ * first, that one is used.
+ */
+const SedCompiledMath*
+SedCompiledMathCache::get(const SedBase* owner) const
+{
+  SedCompiledMath* current = mCompiled.load(memory_order_acquire);
+
+  if (current != NULL && (!mMathExposed || current->mFingerprint ==
+      SedCompiledMath::fingerprint(getOwnerMath(owner))))
+  {
+    return current;
+  }
+
+  SedCompiledMath* compiled = new SedCompiledMath();
+  compiled->compile(owner);
+  compiled->mRetired = current;
+
+  if (mCompiled.compare_exchange_strong(current, compiled,
+                                        memory_order_acq_rel))
+  {
+    if (current != NULL)
+    {
+      // the math was edited since current's predecessor was replaced, so
+      // no thread reads that one any more
+      delete current->mRetired;
+      current->mRetired = NULL;
+    }
+
+    return compiled;
+  }
+
+  compiled->mRetired = NULL;
+  delete compiled;
+  return current;
+}
+
+
+/*
+ * Deletes the program; only called while no other thread reads it.
+ */
+void
+SedCompiledMathCache::clear()
+{
+  delete mCompiled.exchange(NULL);
+}
+
+
+/*
+ * Deletes the program and notes that the math may be edited in place.
+ */
+void
+SedCompiledMathCache::exposeMath()
+{
+  clear();
+  mMathExposed = true;
+}
+
+/** @endcond */
+
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
@@ -0,0 +1,414 @@
+/**
+ * @file SedCompiledMath.h
+ * @brief Definition of the SedCompiledMath class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedCompiledMath
+ * @sbmlbrief{} SED-ML math compiled into a register-based program.
+ *
+ * A SedCompiledMath turns the math of a SedDataGenerator, SedComputeChange,
+ * SedSetValue or SedFunctionalRange into a flat list of instructions that
+ * operate on registers.  The program is evaluated over whole arrays: every
+ * input is a column of values (one per time point, say), and each
+ * instruction processes a block of elements before the next one runs, so
+ * the tree is walked once at compile time instead of once per value.
+ *
+ * Inputs are bound by index.  When compiling the math of an object, input
+ * @em n is its nth Variable; the values of its Parameter children are
+ * folded into the program as constants.  Identifiers that are neither
+ * become further inputs, in the order they first appear, so that for
+ * instance the math of a SetValue can read the ranges of its repeated
+ * task.  Subexpressions without inputs are computed at compile time.
+ *
+ * The functions @c min, @c max, @c sum and @c product applied to a single
+ * argument reduce it over all elements, as defined by SED-ML for data
+ * generators; with several arguments @c min and @c max work element-wise.
+ *
+ * On x86 processors, arithmetic, comparisons, logical operators,
+ * piecewise, exp(), ln() and power are evaluated with SSE2 or AVX2
+ * instructions, whichever is the best the processor supports; see
+ * setInstructionSet().  The vectorized exp() and ln() may differ from the
+ * C library in the last bit, and power by about 1e-13 relative.
+ *
+ * The objects that own math keep their compiled form, see for instance
+ * SedDataGenerator::getCompiledMath().
+ */
+
+
+#ifndef SedCompiledMath_h
+#define SedCompiledMath_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class ASTNode;
+
+LIBSBML_CPP_NAMESPACE_END
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedBase;
+class SedCompiledMathCache;
+
+
+class LIBSEDML_EXTERN SedCompiledMath
+{
+public:
+
+  /**
+   * Creates a new, empty SedCompiledMath.
+   */
+  SedCompiledMath();
+
+
+  /**
+   * Destructor for SedCompiledMath.
+   */
+  virtual ~SedCompiledMath();
+
+
+  /**
+   * Compiles the given math, discarding any previous program.
+   *
+   * @param math the ASTNode to compile.
+   * @param inputs the identifiers bound to the first inputs, in order;
+   * identifiers used by @p math that are not listed become further inputs.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p math is @c NULL or uses a construct that cannot be evaluated,
+   * such as a call of an unknown function.
+   */
+  int compile(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math,
+              const std::vector<std::string>& inputs =
+                std::vector<std::string>());
+
+
+  /**
+   * Compiles the math of a SedDataGenerator, SedComputeChange, SedSetValue
+   * or SedFunctionalRange, binding its Variable children to the first
+   * inputs and folding in the values of its Parameter children.
+   *
+   * @param owner the object whose math to compile.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p owner has no math, is of another type, or its math cannot be
+   * compiled.
+   */
+  int compile(const SedBase* owner);
+
+
+  /**
+   * Predicate returning @c true if this SedCompiledMath holds a program.
+   *
+   * @return @c true if the last compilation succeeded.
+   */
+  bool isCompiled() const;
+
+
+  /**
+   * Returns the number of inputs of the program.
+   *
+   * @return the number of inputs.
+   */
+  unsigned int getNumInputs() const;
+
+
+  /**
+   * Returns the identifier bound to the nth input.
+   *
+   * @param n an unsigned int representing the index of the input.
+   *
+   * @return the identifier, or an empty string if @p n is out of range.
+   */
+  const std::string& getInputName(unsigned int n) const;
+
+
+  /**
+   * Returns the index of the input bound to the given identifier.
+   *
+   * @param name a string representing the identifier.
+   *
+   * @return the index of the input, or @c -1 if there is none.
+   */
+  int getInputIndex(const std::string& name) const;
+
+
+  /**
+   * Predicate returning @c true if the program reads the nth input; the
+   * Variable children of an object are inputs even if its math does not
+   * use them.
+   *
+   * @param n an unsigned int representing the index of the input.
+   *
+   * @return @c true if the input is used, @c false otherwise.
+   */
+  bool usesInput(unsigned int n) const;
+
+
+  /**
+   * Predicate returning @c true if the program reduces an input over all
+   * elements, with @c sum, @c product, or @c min or @c max of a single
+   * argument.  Such a program has to be evaluated over whole arrays at
+   * once; any other can be evaluated piecewise.
+   *
+   * @return @c true if the program contains reductions, @c false
+   * otherwise.
+   */
+  bool hasReductions() const;
+
+
+  /**
+   * Returns the number of instructions of the program, including those of
+   * reductions.
+   *
+   * @return the number of instructions.
+   */
+  unsigned int getNumInstructions() const;
+
+
+  /**
+   * Evaluates the program for a single set of input values.
+   *
+   * @param inputs getNumInputs() values, one for each input.
+   *
+   * @return the result, or NaN if nothing has been compiled.
+   */
+  double evaluate(const double* inputs) const;
+
+
+  /**
+   * Evaluates the program over arrays.
+   *
+   * @param inputs getNumInputs() pointers, each to @p length values; an
+   * input that the program does not use may be @c NULL.
+   * @param length the number of elements to compute.
+   * @param result the array receiving the @p length results.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if nothing has been compiled, or an input the program uses is
+   * @c NULL.
+   */
+  int evaluate(const double* const* inputs, size_t length,
+               double* result) const;
+
+
+  /**
+   * Selects the instruction set that programs are evaluated with, in this
+   * process.  Evaluation uses the best set the processor supports unless
+   * told otherwise; selecting another is meant for testing and
+   * benchmarking.
+   *
+   * @param name the name of the instruction set, one of those returned by
+   * getInstructionSets(), or an empty string for the best one.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_ATTRIBUTE_VALUE, OperationReturnValues_t}
+   * if the instruction set is unknown or not supported here.
+   */
+  static int setInstructionSet(const std::string& name);
+
+
+  /**
+   * Returns the name of the instruction set that programs are evaluated
+   * with: @c "scalar", @c "sse2" or @c "avx2".
+   *
+   * @return the name of the instruction set in use.
+   */
+  static std::string getInstructionSet();
+
+
+  /**
+   * Returns the names of the instruction sets supported by this build and
+   * processor, from the portable @c "scalar" to the best.
+   *
+   * @return the names of the available instruction sets.
+   */
+  static std::vector<std::string> getInstructionSets();
+
+
+private:
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  friend class SedCompiledMathCache;
+
+  struct Instruction
+  {
+    int op;
+    int dst;
+    int a;
+    int b;
+    int c;
+    double value;
+    double (*function)(double);
+  };
+
+  // operands: registers are >= 0, inputs are encoded as -1 - index
+  struct Program
+  {
+    std::vector<Instruction> code;
+    int registers;
+    int result;
+    bool constant;
+    double value;
+    int reduction;
+  };
+
+  struct Operand
+  {
+    bool constant;
+    double value;
+    int ref;
+  };
+
+  SedCompiledMath(const SedCompiledMath&);
+  SedCompiledMath& operator=(const SedCompiledMath&);
+
+  void clear();
+
+  int compileMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math,
+                  const std::vector<std::string>& inputs);
+
+  bool compileNode(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* node,
+                   size_t program, int& top, Operand& result);
+
+  bool compileReduction(int kind,
+                        const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* node,
+                        size_t program, int& top, Operand& result);
+
+  Operand emit(size_t program, int op, const Operand* operands,
+               unsigned int count, int& top,
+               double (*function)(double) = NULL);
+
+  void materialize(size_t program, Operand& operand, int& top);
+
+  const double* run(const Program& program, const double* const* inputs,
+                    size_t offset, size_t count, double* registers,
+                    const std::vector<double>& scalars) const;
+
+  static unsigned long long fingerprint(
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math);
+
+  // programs[0] is the expression; the others compute reductions, each
+  // before the programs that use its result
+  std::vector<Program> mPrograms;
+  std::vector<std::string> mInputs;
+  std::vector<bool> mUsed;
+  std::vector<std::pair<std::string, double> > mConstants;
+  bool mCompiled;
+
+  // a hash of the math the program was compiled from, to notice edits
+  // made to it in place
+  unsigned long long mFingerprint;
+
+  // the program this one replaced, which another thread may still be
+  // reading
+  SedCompiledMath* mRetired;
+
+  /** @endcond */
+};
+
+
+#ifndef SWIG
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * The compiled math of an object, built on first use.  Reading is
+ * lock-free, so that frozen documents can be evaluated from several
+ * threads.  The owner, and its Variable and Parameter children through
+ * SedBase::invalidateCompiledMath(), discard the program whenever they
+ * change, so that get() only checks that there is one.  Once the math
+ * has been handed out for editing in place, get() also compares a hash
+ * of it; a program replaced then is freed with the next replacement, as
+ * the math can only be edited again while no other thread reads it.
+ */
+class LIBSEDML_EXTERN SedCompiledMathCache
+{
+public:
+
+  SedCompiledMathCache();
+
+  // copies start empty: the program belongs to the object it was built
+  // for
+  SedCompiledMathCache(const SedCompiledMathCache& orig);
+
+  SedCompiledMathCache& operator=(const SedCompiledMathCache& rhs);
+
+  ~SedCompiledMathCache();
+
+  const SedCompiledMath* get(const SedBase* owner) const;
+
+  void clear();
+
+  // discards the program, and checks the math on every later get() as it
+  // may now be edited in place
+  void exposeMath();
+
+private:
+
+  mutable std::atomic<SedCompiledMath*> mCompiled;
+  bool mMathExposed;
+};
+
+/** @endcond */
+
+#endif  /* !SWIG */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedCompiledMath_h */
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedComputeChange.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedVariable.h>
 #include <sbml/xml/XMLInputStream.h>
 #include <sbml/math/MathML.h>
@@ -60,7 +61,6 @@ SedComputeChange::SedComputeChange(unsigned int level, unsigned int version)
   , mParameters (level, version)
   , mSymbol ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -69,7 +69,7 @@ SedComputeChange::SedComputeChange(unsigned int level, unsigned int version)
  * Creates a new SedComputeChange using the given SedNamespaces object @p
  * sedmlns.
  */
-SedComputeChange::SedComputeChange(SedNamespaces *sedmlns)
+SedComputeChange::SedComputeChange(const SedNamespaces *sedmlns)
   : SedChange(sedmlns)
   , mMath (NULL)
   , mVariables (sedmlns)
@@ -100,6 +100,22 @@ SedComputeChange::SedComputeChange(const SedComputeChange& orig)
 }
 
 
+/*
+ * Move constructor for SedComputeChange.
+ */
+SedComputeChange::SedComputeChange(SedComputeChange&& orig)
+  : SedChange( std::move(orig) )
+  , mMath ( orig.mMath )
+  , mVariables ( std::move(orig.mVariables) )
+  , mParameters ( std::move(orig.mParameters) )
+  , mSymbol ( std::move(orig.mSymbol) )
+{
+  orig.mMath = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedComputeChange.
  */
@@ -113,6 +129,7 @@ SedComputeChange::operator=(const SedComputeChange& rhs)
     mParameters = rhs.mParameters;
     mSymbol = rhs.mSymbol;
     delete mMath;
+    mCompiledMath.clear();
     if (rhs.mMath != NULL)
     {
       mMath = rhs.mMath->deepCopy();
@@ -129,6 +146,30 @@ SedComputeChange::operator=(const SedComputeChange& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedComputeChange.
+ */
+SedComputeChange&
+SedComputeChange::operator=(SedComputeChange&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedChange::operator=(std::move(rhs));
+    mVariables = std::move(rhs.mVariables);
+    mParameters = std::move(rhs.mParameters);
+    mSymbol = std::move(rhs.mSymbol);
+    delete mMath;
+    mCompiledMath.clear();
+    mMath = rhs.mMath;
+    rhs.mMath = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedComputeChange object.
  */
@@ -158,7 +199,7 @@ SedComputeChange::getSymbol() const
     if (getLevel() > 1 || getVersion() >= 4) {
         return mSymbol;
     }
-    static string empty = "";
+    static const string empty = "";
     return empty;
 }
 
@@ -225,6 +266,7 @@ SedComputeChange::getMath() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedComputeChange::getMath()
 {
+  mCompiledMath.exposeMath();
   return mMath;
 }
 
@@ -240,6 +282,31 @@ SedComputeChange::isSetMath() const
 }
 
 
+/*
+ * Returns the math of this SedComputeChange compiled for evaluation over
+ * arrays.
+ */
+const SedCompiledMath*
+SedComputeChange::getCompiledMath() const
+{
+  return mCompiledMath.get(this);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Discards the compiled math of this SedComputeChange.
+ */
+void
+SedComputeChange::clearCompiledMath()
+{
+  mCompiledMath.clear();
+}
+
+/** @endcond */
+
+
 /*
  * Sets the value of the "math" element of this SedComputeChange.
  */
@@ -253,6 +320,7 @@ SedComputeChange::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
   else if (math == NULL)
   {
     delete mMath;
+    mCompiledMath.clear();
     mMath = NULL;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -263,6 +331,7 @@ SedComputeChange::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
   else
   {
     delete mMath;
+    mCompiledMath.clear();
     mMath = (math != NULL) ? math->deepCopy() : NULL;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -276,6 +345,7 @@ int
 SedComputeChange::unsetMath()
 {
   delete mMath;
+  mCompiledMath.clear();
   mMath = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -423,6 +493,51 @@ SedComputeChange::addVariable(const SedVariable* sv)
 }
 
 
+/*
+ * Adds the given SedVariable to this SedComputeChange,
+ * which takes ownership of it.
+ */
+int
+SedComputeChange::addVariable(std::unique_ptr<SedVariable> sv)
+{
+  if (!sv)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sv->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sv.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sv->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sv->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sv->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sv.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sv->isSetId() && (mVariables.get(sv->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mVariables.appendAndOwn(std::move(sv));
+  }
+}
+
+
 /*
  * Get the number of SedVariable objects in this SedComputeChange.
  */
@@ -444,7 +559,7 @@ SedComputeChange::createVariable()
 
   try
   {
-    sv = new SedVariable(getSedNamespaces());
+    sv = new (getSedArena()) SedVariable(getSedNamespaces());
   }
   catch (...)
   {
@@ -580,6 +695,51 @@ SedComputeChange::addParameter(const SedParameter* sp)
 }
 
 
+/*
+ * Adds the given SedParameter to this SedComputeChange,
+ * which takes ownership of it.
+ */
+int
+SedComputeChange::addParameter(std::unique_ptr<SedParameter> sp)
+{
+  if (!sp)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sp->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sp.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sp->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sp->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sp->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sp.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sp->isSetId() && (mParameters.get(sp->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mParameters.appendAndOwn(std::move(sp));
+  }
+}
+
+
 /*
  * Get the number of SedParameter objects in this SedComputeChange.
  */
@@ -601,7 +761,7 @@ SedComputeChange::createParameter()
 
   try
   {
-    sp = new SedParameter(getSedNamespaces());
+    sp = new (getSedArena()) SedParameter(getSedNamespaces());
   }
   catch (...)
   {
@@ -648,9 +808,92 @@ SedComputeChange::renameSIdRefs(const std::string& oldid,
   if (isSetMath())
   {
     mMath->renameSIdRefs(oldid, newid);
+    mCompiledMath.clear();
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedComputeChange object to @p refs.
+ */
+void
+SedComputeChange::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetMath())
+  {
+    collectMathSIdRefs(mMath, refs);
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedComputeChange object to @p usage.
+ */
+void
+SedComputeChange::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedChange::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedComputeChange) - sizeof(SedChange) -
+    sizeof(SedListOfVariables) -
+    sizeof(SedListOfParameters));
+  usage.addMath(type, mMath);
+  usage.addString(type, mSymbol);
+
+  if (mVariables.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mVariables.addMemoryUsage(usage);
+  }
+
+  if (mParameters.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mParameters.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedComputeChange object to @p
+ * stream.
+ */
+void
+SedComputeChange::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedChange::writeBinary(stream);
+
+  stream.writeMath(mMath);
+  mVariables.writeBinary(stream);
+  mParameters.writeBinary(stream);
+  stream.writeString(mSymbol);
+}
+
+
+/*
+ * Reads the attributes and children of this SedComputeChange object from @p
+ * stream.
+ */
+void
+SedComputeChange::readBinary(SedBinaryInputStream& stream)
+{
+  SedChange::readBinary(stream);
+
+  delete mMath;
+  mCompiledMath.clear();
+  mMath = stream.readMath();
+
+  mVariables.readBinary(stream);
+  mParameters.readBinary(stream);
+  stream.readString(mSymbol);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedComputeChange object.
@@ -1335,6 +1578,7 @@ SedComputeChange::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
     const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken elem = stream.peek();
     const std::string prefix = checkMathMLNamespace(elem);
     delete mMath;
+    mCompiledMath.clear();
     mMath = readMathML(stream, prefix);
     read = true;
   }
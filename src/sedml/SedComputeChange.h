@@ -52,6 +52,7 @@
 
 #include <sedml/SedChange.h>
 #include <sbml/math/ASTNode.h>
+#include <sedml/SedCompiledMath.h>
 #include <sedml/SedListOfVariables.h>
 #include <sedml/SedListOfParameters.h>
 #include <sbml/common/libsbml-namespace.h>
@@ -67,6 +68,7 @@ protected:
   /** @cond doxygenLibSEDMLInternal */
 
   LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* mMath;
+  SedCompiledMathCache mCompiledMath;
   SedListOfVariables mVariables;
   SedListOfParameters mParameters;
   std::string mSymbol;
@@ -99,7 +101,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedComputeChange(SedNamespaces *sedmlns);
+  SedComputeChange(const SedNamespaces *sedmlns);
 
 
   /**
@@ -119,6 +121,28 @@ public:
   SedComputeChange& operator=(const SedComputeChange& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedComputeChange.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedComputeChange instance to move from.
+   */
+  SedComputeChange(SedComputeChange&& orig);
+
+
+  /**
+   * Move assignment operator for SedComputeChange.
+   *
+   * @param rhs the SedComputeChange object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedComputeChange& operator=(SedComputeChange&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedComputeChange object.
    *
@@ -204,6 +228,26 @@ public:
   bool isSetMath() const;
 
 
+#ifndef SWIG
+  /**
+   * Returns the math of this SedComputeChange compiled for evaluation over
+   * arrays, with its Variable children bound to the first inputs and its
+   * Parameter children folded in.
+   *
+   * The program is built on first use and kept until the math, the
+   * variables or the parameters change.  Once the non-const getMath() has
+   * been called, edits made to the math in place are noticed as well, at
+   * the cost of hashing the math on each call.  The program may be used
+   * from several threads at once.
+   *
+   * @return the SedCompiledMath of this SedComputeChange; use
+   * SedCompiledMath::isCompiled() to check that the math could be
+   * compiled.
+   */
+  const SedCompiledMath* getCompiledMath() const;
+#endif
+
+
   /**
    * Sets the value of the "math" element of this SedComputeChange.
    *
@@ -436,6 +480,28 @@ public:
   int addVariable(const SedVariable* sv);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedVariable to this SedComputeChange without copying it.
+   *
+   * @param sv the SedVariable object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addVariable(const SedVariable* sv)
+   */
+  int addVariable(std::unique_ptr<SedVariable> sv);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedVariable objects in this SedComputeChange.
    *
@@ -660,6 +726,28 @@ public:
   int addParameter(const SedParameter* sp);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedParameter to this SedComputeChange without copying it.
+   *
+   * @param sp the SedParameter object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addParameter(const SedParameter* sp)
+   */
+  int addParameter(std::unique_ptr<SedParameter> sp);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedParameter objects in this SedComputeChange.
    *
@@ -743,6 +831,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedComputeChange object.
    *
@@ -1160,6 +1276,17 @@ public:
 
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Discards the compiled math of this SedComputeChange.
+   */
+  virtual void clearCompiledMath();
+
+  /** @endcond */
+
+
+
 
   #endif /* !SWIG */
 
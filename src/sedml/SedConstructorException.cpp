@@ -61,13 +61,13 @@ SedConstructorException::SedConstructorException (std::string errmsg, std::strin
 }
 
 
-SedConstructorException::SedConstructorException (std::string elementName, SedNamespaces* sedmlns) :
+SedConstructorException::SedConstructorException (std::string elementName, const SedNamespaces* sedmlns) :
     std::invalid_argument("Level/version/namespaces combination is invalid")
   , mSedErrMsg(elementName)
 {
   if (sedmlns == NULL) return;
   
-  XMLNamespaces* xmlns = sedmlns->getNamespaces();
+  const XMLNamespaces* xmlns = sedmlns->getNamespaces();
   
   if (xmlns == NULL) return;
     
@@ -60,7 +60,7 @@ public:
   /* constructor */
   SedConstructorException (std::string errmsg = "");
   SedConstructorException (std::string errmsg, std::string sedmlErrMsg);
-  SedConstructorException (std::string elementName, SedNamespaces* xmlns);
+  SedConstructorException (std::string elementName, const SedNamespaces* xmlns);
   virtual ~SedConstructorException () throw();
   
  /** @endcond */
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedCurve.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 #include <sedml/SedPlot2D.h>
 
@@ -62,14 +63,13 @@ SedCurve::SedCurve(unsigned int level, unsigned int version)
   , mYErrorUpper ("")
   , mYErrorLower ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedCurve using the given SedNamespaces object @p sedmlns.
  */
-SedCurve::SedCurve(SedNamespaces *sedmlns)
+SedCurve::SedCurve(const SedNamespaces *sedmlns)
   : SedAbstractCurve(sedmlns)
   , mLogY (false)
   , mIsSetLogY (false)
@@ -101,6 +101,23 @@ SedCurve::SedCurve(const SedCurve& orig)
 }
 
 
+/*
+ * Move constructor for SedCurve.
+ */
+SedCurve::SedCurve(SedCurve&& orig)
+  : SedAbstractCurve( std::move(orig) )
+  , mLogY ( std::move(orig.mLogY) )
+  , mIsSetLogY ( std::move(orig.mIsSetLogY) )
+  , mYDataReference ( std::move(orig.mYDataReference) )
+  , mType ( std::move(orig.mType) )
+  , mXErrorUpper ( std::move(orig.mXErrorUpper) )
+  , mXErrorLower ( std::move(orig.mXErrorLower) )
+  , mYErrorUpper ( std::move(orig.mYErrorUpper) )
+  , mYErrorLower ( std::move(orig.mYErrorLower) )
+{
+}
+
+
 /*
  * Assignment operator for SedCurve.
  */
@@ -124,6 +141,29 @@ SedCurve::operator=(const SedCurve& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedCurve.
+ */
+SedCurve&
+SedCurve::operator=(SedCurve&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedAbstractCurve::operator=(std::move(rhs));
+    mLogY = std::move(rhs.mLogY);
+    mIsSetLogY = std::move(rhs.mIsSetLogY);
+    mYDataReference = std::move(rhs.mYDataReference);
+    mType = std::move(rhs.mType);
+    mXErrorUpper = std::move(rhs.mXErrorUpper);
+    mXErrorLower = std::move(rhs.mXErrorLower);
+    mYErrorUpper = std::move(rhs.mYErrorUpper);
+    mYErrorLower = std::move(rhs.mYErrorLower);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedCurve object.
  */
@@ -630,6 +670,103 @@ SedCurve::renameSIdRefs(const std::string& oldid, const std::string& newid)
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedCurve object to @p refs.
+ */
+void
+SedCurve::collectSIdRefs(SedIdRefList& refs) const
+{
+  SedAbstractCurve::collectSIdRefs(refs);
+
+  if (isSetYDataReference())
+  {
+    refs.push_back(std::make_pair(std::string("yDataReference"),
+      mYDataReference));
+  }
+
+  if (isSetXErrorUpper())
+  {
+    refs.push_back(std::make_pair(std::string("xErrorUpper"), mXErrorUpper));
+  }
+
+  if (isSetXErrorLower())
+  {
+    refs.push_back(std::make_pair(std::string("xErrorLower"), mXErrorLower));
+  }
+
+  if (isSetYErrorUpper())
+  {
+    refs.push_back(std::make_pair(std::string("yErrorUpper"), mYErrorUpper));
+  }
+
+  if (isSetYErrorLower())
+  {
+    refs.push_back(std::make_pair(std::string("yErrorLower"), mYErrorLower));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedCurve object to @p usage.
+ */
+void
+SedCurve::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedAbstractCurve::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedCurve) - sizeof(SedAbstractCurve));
+  usage.addString(type, mYDataReference);
+  usage.addString(type, mXErrorUpper);
+  usage.addString(type, mXErrorLower);
+  usage.addString(type, mYErrorUpper);
+  usage.addString(type, mYErrorLower);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedCurve object to @p stream.
+ */
+void
+SedCurve::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedAbstractCurve::writeBinary(stream);
+
+  stream.writeBool(mLogY);
+  stream.writeBool(mIsSetLogY);
+  stream.writeString(mYDataReference);
+  stream.writeInt(mType);
+  stream.writeString(mXErrorUpper);
+  stream.writeString(mXErrorLower);
+  stream.writeString(mYErrorUpper);
+  stream.writeString(mYErrorLower);
+}
+
+
+/*
+ * Reads the attributes and children of this SedCurve object from @p stream.
+ */
+void
+SedCurve::readBinary(SedBinaryInputStream& stream)
+{
+  SedAbstractCurve::readBinary(stream);
+
+  mLogY = stream.readBool();
+  mIsSetLogY = stream.readBool();
+  stream.readString(mYDataReference);
+  mType = static_cast<CurveType_t>(stream.readInt());
+  stream.readString(mXErrorUpper);
+  stream.readString(mXErrorLower);
+  stream.readString(mYErrorUpper);
+  stream.readString(mYErrorLower);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedCurve object.
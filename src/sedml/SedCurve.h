@@ -129,7 +129,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedCurve(SedNamespaces *sedmlns);
+  SedCurve(const SedNamespaces *sedmlns);
 
 
   /**
@@ -149,6 +149,28 @@ public:
   SedCurve& operator=(const SedCurve& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedCurve.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedCurve instance to move from.
+   */
+  SedCurve(SedCurve&& orig);
+
+
+  /**
+   * Move assignment operator for SedCurve.
+   *
+   * @param rhs the SedCurve object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedCurve& operator=(SedCurve&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedCurve object.
    *
@@ -514,6 +536,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedCurve object.
    *
@@ -32,7 +32,9 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedDataDescription.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfDataDescriptions.h>
+#include <sedml/SedReader.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -60,7 +62,6 @@ SedDataDescription::SedDataDescription(unsigned int level,
   , mDimensionDescription (NULL)
   , mDataSources (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -71,7 +72,7 @@ SedDataDescription::SedDataDescription(unsigned int level,
  * Creates a new SedDataDescription using the given SedNamespaces object @p
  * sedmlns.
  */
-SedDataDescription::SedDataDescription(SedNamespaces *sedmlns)
+SedDataDescription::SedDataDescription(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mFormat ("")
   , mSource ("")
@@ -104,6 +105,22 @@ SedDataDescription::SedDataDescription(const SedDataDescription& orig)
 }
 
 
+/*
+ * Move constructor for SedDataDescription.
+ */
+SedDataDescription::SedDataDescription(SedDataDescription&& orig)
+  : SedBase( std::move(orig) )
+  , mFormat ( std::move(orig.mFormat) )
+  , mSource ( std::move(orig.mSource) )
+  , mDimensionDescription ( orig.mDimensionDescription )
+  , mDataSources ( std::move(orig.mDataSources) )
+{
+  orig.mDimensionDescription = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedDataDescription.
  */
@@ -133,6 +150,29 @@ SedDataDescription::operator=(const SedDataDescription& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedDataDescription.
+ */
+SedDataDescription&
+SedDataDescription::operator=(SedDataDescription&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mFormat = std::move(rhs.mFormat);
+    mSource = std::move(rhs.mSource);
+    mDataSources = std::move(rhs.mDataSources);
+    delete mDimensionDescription;
+    mDimensionDescription = rhs.mDimensionDescription;
+    rhs.mDimensionDescription = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedDataDescription object.
  */
@@ -475,6 +515,51 @@ SedDataDescription::addDataSource(const SedDataSource* sds)
 }
 
 
+/*
+ * Adds the given SedDataSource to this SedDataDescription,
+ * which takes ownership of it.
+ */
+int
+SedDataDescription::addDataSource(std::unique_ptr<SedDataSource> sds)
+{
+  if (!sds)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sds->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sds.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sds->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sds->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sds->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sds.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sds->isSetId() && (mDataSources.get(sds->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mDataSources.appendAndOwn(std::move(sds));
+  }
+}
+
+
 /*
  * Get the number of SedDataSource objects in this SedDataDescription.
  */
@@ -496,7 +581,7 @@ SedDataDescription::createDataSource()
 
   try
   {
-    sds = new SedDataSource(getSedNamespaces());
+    sds = new (getSedArena()) SedDataSource(getSedNamespaces());
   }
   catch (...)
   {
@@ -533,6 +618,69 @@ SedDataDescription::removeDataSource(const std::string& sid)
 }
 
 
+/*
+ * Adds the memory held by this SedDataDescription object to @p usage.
+ */
+void
+SedDataDescription::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedDataDescription) - sizeof(SedBase) -
+    sizeof(SedListOfDataSources));
+  usage.addString(type, mFormat);
+  usage.addString(type, mSource);
+  usage.addDimensionDescription(type, mDimensionDescription);
+
+  if (mDataSources.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mDataSources.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedDataDescription object to @p
+ * stream.
+ */
+void
+SedDataDescription::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mFormat);
+  stream.writeString(mSource);
+  stream.writeDimensionDescription(mDimensionDescription);
+  mDataSources.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedDataDescription object from @p
+ * stream.
+ */
+void
+SedDataDescription::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mFormat);
+  stream.readString(mSource);
+
+  delete mDimensionDescription;
+  mDimensionDescription = stream.readDimensionDescription();
+
+  mDataSources.readBinary(stream);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedDataDescription object.
  */
@@ -1260,6 +1408,26 @@ SedDataDescription::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
 /** @endcond */
 
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Skips the "dimensionDescription" element when excluded by the load mask
+ */
+bool
+SedDataDescription::isSkippedOnRead(const std::string& name) const
+{
+  if (name == "dimensionDescription")
+  {
+    return !isLoadedOnRead(SEDML_LOAD_DIMENSION_DESCRIPTIONS);
+  }
+
+  return SedBase::isSkippedOnRead(name);
+}
+
+/** @endcond */
+
 /** @cond doxygenLibSEDMLInternal */
 
 /*
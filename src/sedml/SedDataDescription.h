@@ -99,7 +99,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedDataDescription(SedNamespaces *sedmlns);
+  SedDataDescription(const SedNamespaces *sedmlns);
 
 
   /**
@@ -119,6 +119,28 @@ public:
   SedDataDescription& operator=(const SedDataDescription& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedDataDescription.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedDataDescription instance to move from.
+   */
+  SedDataDescription(SedDataDescription&& orig);
+
+
+  /**
+   * Move assignment operator for SedDataDescription.
+   *
+   * @param rhs the SedDataDescription object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedDataDescription& operator=(SedDataDescription&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedDataDescription object.
    *
@@ -464,6 +486,28 @@ public:
   int addDataSource(const SedDataSource* sds);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedDataSource to this SedDataDescription without copying it.
+   *
+   * @param sds the SedDataSource object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addDataSource(const SedDataSource* sds)
+   */
+  int addDataSource(std::unique_ptr<SedDataSource> sds);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedDataSource objects in this SedDataDescription.
    *
@@ -540,6 +584,28 @@ public:
   SedDataSource* removeDataSource(const std::string& sid);
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedDataDescription object.
    *
@@ -1043,6 +1109,17 @@ protected:
 
   /** @endcond doxygen-libsedml-internal */
 
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Skips the "dimensionDescription" element when excluded by the load mask
+   */
+  virtual bool isSkippedOnRead(const std::string& name) const;
+
+  /** @endcond */
+
   /** @cond doxygenLibSEDMLInternal */
 
   /**
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedDataGenerator.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedVariable.h>
 #include <sedml/SedListOfDataGenerators.h>
 #include <sbml/xml/XMLInputStream.h>
@@ -60,7 +61,6 @@ SedDataGenerator::SedDataGenerator(unsigned int level, unsigned int version)
   , mParameters (level, version)
   , mMath (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -71,7 +71,7 @@ SedDataGenerator::SedDataGenerator(unsigned int level, unsigned int version)
  * Creates a new SedDataGenerator using the given SedNamespaces object @p
  * sedmlns.
  */
-SedDataGenerator::SedDataGenerator(SedNamespaces *sedmlns)
+SedDataGenerator::SedDataGenerator(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mVariables (sedmlns)
   , mParameters (sedmlns)
@@ -102,6 +102,21 @@ SedDataGenerator::SedDataGenerator(const SedDataGenerator& orig)
 }
 
 
+/*
+ * Move constructor for SedDataGenerator.
+ */
+SedDataGenerator::SedDataGenerator(SedDataGenerator&& orig)
+  : SedBase( std::move(orig) )
+  , mVariables ( std::move(orig.mVariables) )
+  , mParameters ( std::move(orig.mParameters) )
+  , mMath ( orig.mMath )
+{
+  orig.mMath = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedDataGenerator.
  */
@@ -114,6 +129,7 @@ SedDataGenerator::operator=(const SedDataGenerator& rhs)
     mVariables = rhs.mVariables;
     mParameters = rhs.mParameters;
     delete mMath;
+    mCompiledMath.clear();
     if (rhs.mMath != NULL)
     {
       mMath = rhs.mMath->deepCopy();
@@ -130,6 +146,29 @@ SedDataGenerator::operator=(const SedDataGenerator& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedDataGenerator.
+ */
+SedDataGenerator&
+SedDataGenerator::operator=(SedDataGenerator&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mVariables = std::move(rhs.mVariables);
+    mParameters = std::move(rhs.mParameters);
+    delete mMath;
+    mCompiledMath.clear();
+    mMath = rhs.mMath;
+    rhs.mMath = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedDataGenerator object.
  */
@@ -166,6 +205,7 @@ SedDataGenerator::getMath() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedDataGenerator::getMath()
 {
+  mCompiledMath.exposeMath();
   return mMath;
 }
 
@@ -181,6 +221,31 @@ SedDataGenerator::isSetMath() const
 }
 
 
+/*
+ * Returns the math of this SedDataGenerator compiled for evaluation over
+ * arrays.
+ */
+const SedCompiledMath*
+SedDataGenerator::getCompiledMath() const
+{
+  return mCompiledMath.get(this);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Discards the compiled math of this SedDataGenerator.
+ */
+void
+SedDataGenerator::clearCompiledMath()
+{
+  mCompiledMath.clear();
+}
+
+/** @endcond */
+
+
 /*
  * Sets the value of the "math" element of this SedDataGenerator.
  */
@@ -194,6 +259,7 @@ SedDataGenerator::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
   else if (math == NULL)
   {
     delete mMath;
+    mCompiledMath.clear();
     mMath = NULL;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -204,6 +270,7 @@ SedDataGenerator::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
   else
   {
     delete mMath;
+    mCompiledMath.clear();
     mMath = (math != NULL) ? math->deepCopy() : NULL;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -217,6 +284,7 @@ int
 SedDataGenerator::unsetMath()
 {
   delete mMath;
+  mCompiledMath.clear();
   mMath = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -364,6 +432,51 @@ SedDataGenerator::addVariable(const SedVariable* sv)
 }
 
 
+/*
+ * Adds the given SedVariable to this SedDataGenerator,
+ * which takes ownership of it.
+ */
+int
+SedDataGenerator::addVariable(std::unique_ptr<SedVariable> sv)
+{
+  if (!sv)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sv->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sv.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sv->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sv->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sv->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sv.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sv->isSetId() && (mVariables.get(sv->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mVariables.appendAndOwn(std::move(sv));
+  }
+}
+
+
 /*
  * Get the number of SedVariable objects in this SedDataGenerator.
  */
@@ -385,7 +498,7 @@ SedDataGenerator::createVariable()
 
   try
   {
-    sv = new SedVariable(getSedNamespaces());
+    sv = new (getSedArena()) SedVariable(getSedNamespaces());
   }
   catch (...)
   {
@@ -521,6 +634,51 @@ SedDataGenerator::addParameter(const SedParameter* sp)
 }
 
 
+/*
+ * Adds the given SedParameter to this SedDataGenerator,
+ * which takes ownership of it.
+ */
+int
+SedDataGenerator::addParameter(std::unique_ptr<SedParameter> sp)
+{
+  if (!sp)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sp->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sp.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sp->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sp->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sp->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sp.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sp->isSetId() && (mParameters.get(sp->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mParameters.appendAndOwn(std::move(sp));
+  }
+}
+
+
 /*
  * Get the number of SedParameter objects in this SedDataGenerator.
  */
@@ -542,7 +700,7 @@ SedDataGenerator::createParameter()
 
   try
   {
-    sp = new SedParameter(getSedNamespaces());
+    sp = new (getSedArena()) SedParameter(getSedNamespaces());
   }
   catch (...)
   {
@@ -589,9 +747,89 @@ SedDataGenerator::renameSIdRefs(const std::string& oldid,
   if (isSetMath())
   {
     mMath->renameSIdRefs(oldid, newid);
+    mCompiledMath.clear();
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedDataGenerator object to @p refs.
+ */
+void
+SedDataGenerator::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetMath())
+  {
+    collectMathSIdRefs(mMath, refs);
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedDataGenerator object to @p usage.
+ */
+void
+SedDataGenerator::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedDataGenerator) - sizeof(SedBase) -
+    sizeof(SedListOfVariables) -
+    sizeof(SedListOfParameters));
+  usage.addMath(type, mMath);
+
+  if (mVariables.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mVariables.addMemoryUsage(usage);
+  }
+
+  if (mParameters.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mParameters.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedDataGenerator object to @p
+ * stream.
+ */
+void
+SedDataGenerator::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  mVariables.writeBinary(stream);
+  mParameters.writeBinary(stream);
+  stream.writeMath(mMath);
+}
+
+
+/*
+ * Reads the attributes and children of this SedDataGenerator object from @p
+ * stream.
+ */
+void
+SedDataGenerator::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  mVariables.readBinary(stream);
+  mParameters.readBinary(stream);
+
+  delete mMath;
+  mCompiledMath.clear();
+  mMath = stream.readMath();
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedDataGenerator object.
@@ -1260,6 +1498,7 @@ SedDataGenerator::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
     const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken elem = stream.peek();
     const std::string prefix = checkMathMLNamespace(elem);
     delete mMath;
+    mCompiledMath.clear();
     mMath = readMathML(stream, prefix);
     read = true;
   }
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedDataRange.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -55,14 +56,13 @@ SedDataRange::SedDataRange(unsigned int level, unsigned int version)
   : SedRange(level, version)
   , mSourceReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedDataRange using the given SedNamespaces object @p sedmlns.
  */
-SedDataRange::SedDataRange(SedNamespaces *sedmlns)
+SedDataRange::SedDataRange(const SedNamespaces *sedmlns)
   : SedRange(sedmlns)
   , mSourceReference ("")
 {
@@ -80,6 +80,16 @@ SedDataRange::SedDataRange(const SedDataRange& orig)
 }
 
 
+/*
+ * Move constructor for SedDataRange.
+ */
+SedDataRange::SedDataRange(SedDataRange&& orig)
+  : SedRange( std::move(orig) )
+  , mSourceReference ( std::move(orig.mSourceReference) )
+{
+}
+
+
 /*
  * Assignment operator for SedDataRange.
  */
@@ -96,6 +106,22 @@ SedDataRange::operator=(const SedDataRange& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedDataRange.
+ */
+SedDataRange&
+SedDataRange::operator=(SedDataRange&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedRange::operator=(std::move(rhs));
+    mSourceReference = std::move(rhs.mSourceReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedDataRange object.
  */
@@ -185,6 +211,63 @@ SedDataRange::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedDataRange object to @p refs.
+ */
+void
+SedDataRange::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetSourceReference())
+  {
+    refs.push_back(std::make_pair(std::string("sourceReference"),
+      mSourceReference));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedDataRange object to @p usage.
+ */
+void
+SedDataRange::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedRange::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedDataRange) - sizeof(SedRange));
+  usage.addString(type, mSourceReference);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedDataRange object to @p stream.
+ */
+void
+SedDataRange::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedRange::writeBinary(stream);
+
+  stream.writeString(mSourceReference);
+}
+
+
+/*
+ * Reads the attributes and children of this SedDataRange object from @p stream.
+ */
+void
+SedDataRange::readBinary(SedBinaryInputStream& stream)
+{
+  SedRange::readBinary(stream);
+
+  stream.readString(mSourceReference);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedDataRange object.
@@ -93,7 +93,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedDataRange(SedNamespaces *sedmlns);
+  SedDataRange(const SedNamespaces *sedmlns);
 
 
   /**
@@ -113,6 +113,28 @@ public:
   SedDataRange& operator=(const SedDataRange& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedDataRange.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedDataRange instance to move from.
+   */
+  SedDataRange(SedDataRange&& orig);
+
+
+  /**
+   * Move assignment operator for SedDataRange.
+   *
+   * @param rhs the SedDataRange object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedDataRange& operator=(SedDataRange&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedDataRange object.
    *
@@ -177,6 +199,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedDataRange object.
    *
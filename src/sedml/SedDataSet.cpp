@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedDataSet.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfDataSets.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -56,7 +57,6 @@ SedDataSet::SedDataSet(unsigned int level, unsigned int version)
   , mLabel ("")
   , mDataReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mNameAllowedPreV4 = true;
   mIdAllowedPreV4 = true;
 }
@@ -65,7 +65,7 @@ SedDataSet::SedDataSet(unsigned int level, unsigned int version)
 /*
  * Creates a new SedDataSet using the given SedNamespaces object @p sedmlns.
  */
-SedDataSet::SedDataSet(SedNamespaces *sedmlns)
+SedDataSet::SedDataSet(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mLabel ("")
   , mDataReference ("")
@@ -87,6 +87,17 @@ SedDataSet::SedDataSet(const SedDataSet& orig)
 }
 
 
+/*
+ * Move constructor for SedDataSet.
+ */
+SedDataSet::SedDataSet(SedDataSet&& orig)
+  : SedBase( std::move(orig) )
+  , mLabel ( std::move(orig.mLabel) )
+  , mDataReference ( std::move(orig.mDataReference) )
+{
+}
+
+
 /*
  * Assignment operator for SedDataSet.
  */
@@ -104,6 +115,23 @@ SedDataSet::operator=(const SedDataSet& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedDataSet.
+ */
+SedDataSet&
+SedDataSet::operator=(SedDataSet&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mLabel = std::move(rhs.mLabel);
+    mDataReference = std::move(rhs.mDataReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedDataSet object.
  */
@@ -242,6 +270,66 @@ SedDataSet::renameSIdRefs(const std::string& oldid, const std::string& newid)
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedDataSet object to @p refs.
+ */
+void
+SedDataSet::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetDataReference())
+  {
+    refs.push_back(std::make_pair(std::string("dataReference"),
+      mDataReference));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedDataSet object to @p usage.
+ */
+void
+SedDataSet::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedDataSet) - sizeof(SedBase));
+  usage.addString(type, mLabel);
+  usage.addString(type, mDataReference);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedDataSet object to @p stream.
+ */
+void
+SedDataSet::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mLabel);
+  stream.writeString(mDataReference);
+}
+
+
+/*
+ * Reads the attributes and children of this SedDataSet object from @p stream.
+ */
+void
+SedDataSet::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mLabel);
+  stream.readString(mDataReference);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedDataSet object.
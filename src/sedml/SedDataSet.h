@@ -93,7 +93,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedDataSet(SedNamespaces *sedmlns);
+  SedDataSet(const SedNamespaces *sedmlns);
 
 
   /**
@@ -113,6 +113,28 @@ public:
   SedDataSet& operator=(const SedDataSet& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedDataSet.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedDataSet instance to move from.
+   */
+  SedDataSet(SedDataSet&& orig);
+
+
+  /**
+   * Move assignment operator for SedDataSet.
+   *
+   * @param rhs the SedDataSet object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedDataSet& operator=(SedDataSet&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedDataSet object.
    *
@@ -218,6 +240,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedDataSet object.
    *
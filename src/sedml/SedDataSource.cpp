@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedDataSource.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfDataSources.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -57,7 +58,6 @@ SedDataSource::SedDataSource(unsigned int level, unsigned int version)
   , mIndexSet ("")
   , mSlices (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -67,7 +67,7 @@ SedDataSource::SedDataSource(unsigned int level, unsigned int version)
 /*
  * Creates a new SedDataSource using the given SedNamespaces object @p sedmlns.
  */
-SedDataSource::SedDataSource(SedNamespaces *sedmlns)
+SedDataSource::SedDataSource(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mIndexSet ("")
   , mSlices (sedmlns)
@@ -91,6 +91,18 @@ SedDataSource::SedDataSource(const SedDataSource& orig)
 }
 
 
+/*
+ * Move constructor for SedDataSource.
+ */
+SedDataSource::SedDataSource(SedDataSource&& orig)
+  : SedBase( std::move(orig) )
+  , mIndexSet ( std::move(orig.mIndexSet) )
+  , mSlices ( std::move(orig.mSlices) )
+{
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedDataSource.
  */
@@ -109,6 +121,25 @@ SedDataSource::operator=(const SedDataSource& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedDataSource.
+ */
+SedDataSource&
+SedDataSource::operator=(SedDataSource&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mIndexSet = std::move(rhs.mIndexSet);
+    mSlices = std::move(rhs.mSlices);
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedDataSource object.
  */
@@ -301,6 +332,46 @@ SedDataSource::addSlice(const SedSlice* ss)
 }
 
 
+/*
+ * Adds the given SedSlice to this SedDataSource, which takes ownership of it.
+ */
+int
+SedDataSource::addSlice(std::unique_ptr<SedSlice> ss)
+{
+  if (!ss)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ss->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ss.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ss->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ss->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ss->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ss.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return mSlices.appendAndOwn(std::move(ss));
+  }
+}
+
+
 /*
  * Get the number of SedSlice objects in this SedDataSource.
  */
@@ -322,7 +393,7 @@ SedDataSource::createSlice()
 
   try
   {
-    ss = new SedSlice(getSedNamespaces());
+    ss = new (getSedArena()) SedSlice(getSedNamespaces());
   }
   catch (...)
   {
@@ -361,6 +432,72 @@ SedDataSource::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedDataSource object to @p refs.
+ */
+void
+SedDataSource::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetIndexSet())
+  {
+    refs.push_back(std::make_pair(std::string("indexSet"), mIndexSet));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedDataSource object to @p usage.
+ */
+void
+SedDataSource::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedDataSource) - sizeof(SedBase) -
+    sizeof(SedListOfSlices));
+  usage.addString(type, mIndexSet);
+
+  if (mSlices.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mSlices.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedDataSource object to @p stream.
+ */
+void
+SedDataSource::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mIndexSet);
+  mSlices.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedDataSource object from @p
+ * stream.
+ */
+void
+SedDataSource::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mIndexSet);
+  mSlices.readBinary(stream);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedDataSource object.
@@ -95,7 +95,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedDataSource(SedNamespaces *sedmlns);
+  SedDataSource(const SedNamespaces *sedmlns);
 
 
   /**
@@ -115,6 +115,28 @@ public:
   SedDataSource& operator=(const SedDataSource& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedDataSource.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedDataSource instance to move from.
+   */
+  SedDataSource(SedDataSource&& orig);
+
+
+  /**
+   * Move assignment operator for SedDataSource.
+   *
+   * @param rhs the SedDataSource object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedDataSource& operator=(SedDataSource&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedDataSource object.
    *
@@ -335,6 +357,28 @@ public:
   int addSlice(const SedSlice* ss);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSlice to this SedDataSource without copying it.
+   *
+   * @param ss the SedSlice object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addSlice(const SedSlice* ss)
+   */
+  int addSlice(std::unique_ptr<SedSlice> ss);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSlice objects in this SedDataSource.
    *
@@ -395,6 +439,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedDataSource object.
    *
@@ -32,8 +32,12 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedDocument.h>
+#include <sedml/SedBinaryStream.h>
+#include <sedml/SedReader.h>
 #include <sbml/xml/XMLInputStream.h>
 
+#include <algorithm>
+
 #include <sedml/SedUniformTimeCourse.h>
 #include <sedml/SedOneStep.h>
 #include <sedml/SedSteadyState.h>
@@ -46,6 +50,7 @@
 #include <sedml/SedPlot3D.h>
 #include <sedml/SedFigure.h>
 #include <sedml/SedParameterEstimationResultPlot.h>
+#include <sedml/SedFrozenDocument.h>
 
 
 using namespace std;
@@ -60,6 +65,53 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 #ifdef __cplusplus
 
 
+/*
+ * Returns an empty list in the namespaces of @p list, whose items are
+ * copied or shared afterwards (see SedListOf::copySharing()).
+ */
+template <class ListType>
+static ListType
+emptyListLike(const ListType& list)
+{
+  return ListType(list.getSedNamespaces());
+}
+
+
+/*
+ * Adds @p list, its items and all their descendants to @p elements without
+ * giving the list copies of the items it shares with a copy-on-write
+ * snapshot, as SedListOf::getAllElements() would.
+ */
+static void
+addListElements(List* elements, const SedListOf& list,
+                SedElementFilter* filter)
+{
+  if (list.size() == 0)
+  {
+    return;
+  }
+
+  SedListOf* plist = const_cast<SedListOf*>(&list);
+  if (filter == NULL || filter->filter(plist))
+  {
+    elements->add(plist);
+  }
+
+  for (unsigned int n = 0; n < list.size(); ++n)
+  {
+    SedBase* item = const_cast<SedBase*>(list.get(n));
+    if (filter == NULL || filter->filter(item))
+    {
+      elements->add(item);
+    }
+
+    List* sublist = item->getAllElements(filter);
+    elements->transferFrom(sublist);
+    delete sublist;
+  }
+}
+
+
 /*
  * Creates a new SedDocument using the given SED-ML Level and @ p version
  * values.
@@ -70,6 +122,18 @@ SedDocument::SedDocument(unsigned int level, unsigned int version)
   , mIsSetLevel (false)
   , mVersion (SEDML_INT_MAX)
   , mIsSetVersion (false)
+  , mSIdIndex ()
+  , mMetaIdIndex ()
+  , mSIdDuplicates ()
+  , mMetaIdDuplicates ()
+  , mElementIndexValid (false)
+  , mEffectiveStyles ()
+  , mCyclicStyles ()
+  , mLoadMask (SEDML_LOAD_ALL)
+  , mArena (NULL)
+  , mCopyOnWriteClone (false)
+  , mCowSnapshot ()
+  , mCowSource ()
   , mAlgorithmParameters (level, version)
   , mDataDescriptions (level, version)
   , mModels (level, version)
@@ -79,6 +143,8 @@ SedDocument::SedDocument(unsigned int level, unsigned int version)
   , mOutputs (level, version)
   , mStyles (level, version)
 {
+  // the document keeps a private, modifiable copy of its namespaces
+  ownSedNamespaces();
   setSedNamespacesAndOwn(new SedNamespaces(level, version));
   setLevel(level);
   setVersion(version);
@@ -90,12 +156,24 @@ SedDocument::SedDocument(unsigned int level, unsigned int version)
 /*
  * Creates a new SedDocument using the given SedNamespaces object @p sedmlns.
  */
-SedDocument::SedDocument(SedNamespaces *sedmlns)
+SedDocument::SedDocument(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mLevel (SEDML_INT_MAX)
   , mIsSetLevel (false)
   , mVersion (SEDML_INT_MAX)
   , mIsSetVersion (false)
+  , mSIdIndex ()
+  , mMetaIdIndex ()
+  , mSIdDuplicates ()
+  , mMetaIdDuplicates ()
+  , mElementIndexValid (false)
+  , mEffectiveStyles ()
+  , mCyclicStyles ()
+  , mLoadMask (SEDML_LOAD_ALL)
+  , mArena (NULL)
+  , mCopyOnWriteClone (false)
+  , mCowSnapshot ()
+  , mCowSource ()
   , mAlgorithmParameters (sedmlns)
   , mDataDescriptions (sedmlns)
   , mModels (sedmlns)
@@ -105,6 +183,7 @@ SedDocument::SedDocument(SedNamespaces *sedmlns)
   , mOutputs (sedmlns)
   , mStyles (sedmlns)
 {
+  ownSedNamespaces();
   setElementNamespace(sedmlns->getURI());
   setLevel(sedmlns->getLevel());
   setVersion(sedmlns->getVersion());
@@ -122,15 +201,74 @@ SedDocument::SedDocument(const SedDocument& orig)
   , mIsSetLevel ( orig.mIsSetLevel )
   , mVersion ( orig.mVersion )
   , mIsSetVersion ( orig.mIsSetVersion )
-  , mAlgorithmParameters (orig.mAlgorithmParameters)
-  , mDataDescriptions ( orig.mDataDescriptions )
-  , mModels ( orig.mModels )
-  , mSimulations ( orig.mSimulations )
-  , mAbstractTasks ( orig.mAbstractTasks )
-  , mDataGenerators ( orig.mDataGenerators )
-  , mOutputs ( orig.mOutputs )
-  , mStyles ( orig.mStyles )
-{
+  , mSIdIndex ()
+  , mMetaIdIndex ()
+  , mSIdDuplicates ()
+  , mMetaIdDuplicates ()
+  , mElementIndexValid (false)
+  , mEffectiveStyles ()
+  , mCyclicStyles ()
+  , mLoadMask ( orig.mLoadMask )
+  , mArena ( (orig.mArena != NULL) ? SedArena::create() : NULL )
+  , mCopyOnWriteClone ( false )
+  , mCowSnapshot ()
+  , mCowSource ( orig.mCopyOnWriteClone ? orig.getCopyOnWriteSnapshot()
+                                        : orig.mCowSource )
+  , mAlgorithmParameters ( emptyListLike(orig.mAlgorithmParameters) )
+  , mDataDescriptions ( emptyListLike(orig.mDataDescriptions) )
+  , mModels ( emptyListLike(orig.mModels) )
+  , mSimulations ( emptyListLike(orig.mSimulations) )
+  , mAbstractTasks ( emptyListLike(orig.mAbstractTasks) )
+  , mDataGenerators ( emptyListLike(orig.mDataGenerators) )
+  , mOutputs ( emptyListLike(orig.mOutputs) )
+  , mStyles ( emptyListLike(orig.mStyles) )
+{
+  ownSedNamespaces();
+  setSedDocument(this);
+
+  // a copy-on-write clone shares every item of the snapshot; any other
+  // copy shares what orig shares and copies the rest
+  copyListsSharing(orig.mCopyOnWriteClone ? *mCowSource : orig);
+  connectToChild();
+}
+
+
+/*
+ * Move constructor for SedDocument.
+ */
+SedDocument::SedDocument(SedDocument&& orig)
+  : SedBase( std::move(orig) )
+  , mLevel ( orig.mLevel )
+  , mIsSetLevel ( orig.mIsSetLevel )
+  , mVersion ( orig.mVersion )
+  , mIsSetVersion ( orig.mIsSetVersion )
+  , mSIdIndex ()
+  , mMetaIdIndex ()
+  , mSIdDuplicates ()
+  , mMetaIdDuplicates ()
+  , mElementIndexValid (false)
+  , mEffectiveStyles ()
+  , mCyclicStyles ()
+  , mLoadMask ( orig.mLoadMask )
+  , mArena ( orig.mArena )
+  , mCopyOnWriteClone ( orig.mCopyOnWriteClone )
+  , mCowSnapshot ()
+  , mCowSource ( std::move(orig.mCowSource) )
+  , mAlgorithmParameters ( std::move(orig.mAlgorithmParameters) )
+  , mDataDescriptions ( std::move(orig.mDataDescriptions) )
+  , mModels ( std::move(orig.mModels) )
+  , mSimulations ( std::move(orig.mSimulations) )
+  , mAbstractTasks ( std::move(orig.mAbstractTasks) )
+  , mDataGenerators ( std::move(orig.mDataGenerators) )
+  , mOutputs ( std::move(orig.mOutputs) )
+  , mStyles ( std::move(orig.mStyles) )
+{
+  orig.mArena = NULL;
+  orig.mCowSnapshot.reset();
+  orig.invalidateElementIndex();
+  orig.clearEffectiveStyleCache();
+
+  ownSedNamespaces();
   setSedDocument(this);
 
   connectToChild();
@@ -145,19 +283,70 @@ SedDocument::operator=(const SedDocument& rhs)
 {
   if (&rhs != this)
   {
+    invalidateElementIndex();
+    clearEffectiveStyleCache();
     SedBase::operator=(rhs);
+    ownSedNamespaces();
+    mLevel = rhs.mLevel;
+    mIsSetLevel = rhs.mIsSetLevel;
+    mVersion = rhs.mVersion;
+    mIsSetVersion = rhs.mIsSetVersion;
+    mLoadMask = rhs.mLoadMask;
+    setArenaAllocation(rhs.getArenaAllocation());
+    mCowSnapshot.reset();
+
+    // the items shared so far must outlive the lists that are replaced
+    std::shared_ptr<const SedDocument> oldSource = mCowSource;
+    mCowSource = rhs.mCowSource;
+    copyListsSharing(rhs);
+    connectToChild();
+    setSedDocument(this);
+  }
+
+  return *this;
+}
+
+
+/*
+ * Move assignment operator for SedDocument.
+ */
+SedDocument&
+SedDocument::operator=(SedDocument&& rhs)
+{
+  if (&rhs != this)
+  {
+    invalidateElementIndex();
+    clearEffectiveStyleCache();
+    rhs.invalidateElementIndex();
+    rhs.clearEffectiveStyleCache();
+    SedBase::operator=(std::move(rhs));
+    ownSedNamespaces();
     mLevel = rhs.mLevel;
     mIsSetLevel = rhs.mIsSetLevel;
     mVersion = rhs.mVersion;
     mIsSetVersion = rhs.mIsSetVersion;
-    mAlgorithmParameters = rhs.mAlgorithmParameters;
-    mDataDescriptions = rhs.mDataDescriptions;
-    mModels = rhs.mModels;
-    mSimulations = rhs.mSimulations;
-    mAbstractTasks = rhs.mAbstractTasks;
-    mDataGenerators = rhs.mDataGenerators;
-    mOutputs = rhs.mOutputs;
-    mStyles = rhs.mStyles;
+    mLoadMask = rhs.mLoadMask;
+    if (mArena != NULL)
+    {
+      mArena->release();
+    }
+    mArena = rhs.mArena;
+    rhs.mArena = NULL;
+    mCopyOnWriteClone = rhs.mCopyOnWriteClone;
+    mCowSnapshot.reset();
+    rhs.mCowSnapshot.reset();
+
+    // the items shared so far must outlive the lists that are replaced
+    std::shared_ptr<const SedDocument> oldSource = std::move(mCowSource);
+    mCowSource = std::move(rhs.mCowSource);
+    mAlgorithmParameters = std::move(rhs.mAlgorithmParameters);
+    mDataDescriptions = std::move(rhs.mDataDescriptions);
+    mModels = std::move(rhs.mModels);
+    mSimulations = std::move(rhs.mSimulations);
+    mAbstractTasks = std::move(rhs.mAbstractTasks);
+    mDataGenerators = std::move(rhs.mDataGenerators);
+    mOutputs = std::move(rhs.mOutputs);
+    mStyles = std::move(rhs.mStyles);
     connectToChild();
     setSedDocument(this);
   }
@@ -181,6 +370,16 @@ SedDocument::clone() const
  */
 SedDocument::~SedDocument()
 {
+  // the children are destroyed after this body; keep them from
+  // maintaining an index that is going away
+  invalidateElementIndex();
+  clearEffectiveStyleCache();
+
+  // objects allocated from the arena keep it alive until they are deleted
+  if (mArena != NULL)
+  {
+    mArena->release();
+  }
 }
 
 
@@ -307,7 +506,7 @@ SedDocument::unsetVersion()
 const SedListOfAlgorithmParameters*
 SedDocument::getListOfAlgorithmParameters() const
 {
-    return &mAlgorithmParameters;
+  return &mAlgorithmParameters;
 }
 
 
@@ -317,7 +516,8 @@ SedDocument::getListOfAlgorithmParameters() const
 SedListOfAlgorithmParameters*
 SedDocument::getListOfAlgorithmParameters()
 {
-    return &mAlgorithmParameters;
+  mCowSnapshot.reset();
+  return &mAlgorithmParameters;
 }
 
 
@@ -327,7 +527,7 @@ SedDocument::getListOfAlgorithmParameters()
 SedAlgorithmParameter*
 SedDocument::getAlgorithmParameter(unsigned int n)
 {
-    return mAlgorithmParameters.get(n);
+    return getListOfAlgorithmParameters()->get(n);
 }
 
 
@@ -337,7 +537,7 @@ SedDocument::getAlgorithmParameter(unsigned int n)
 const SedAlgorithmParameter*
 SedDocument::getAlgorithmParameter(unsigned int n) const
 {
-    return mAlgorithmParameters.get(n);
+    return getListOfAlgorithmParameters()->get(n);
 }
 
 
@@ -347,7 +547,7 @@ SedDocument::getAlgorithmParameter(unsigned int n) const
 SedAlgorithmParameter*
 SedDocument::getAlgorithmParameter(const string& id)
 {
-    return mAlgorithmParameters.get(id);
+    return getListOfAlgorithmParameters()->get(id);
 }
 
 
@@ -357,7 +557,7 @@ SedDocument::getAlgorithmParameter(const string& id)
 const SedAlgorithmParameter*
 SedDocument::getAlgorithmParameter(const string& id) const
 {
-    return mAlgorithmParameters.get(id);
+    return getListOfAlgorithmParameters()->get(id);
 }
 
 
@@ -394,7 +594,52 @@ SedDocument::addAlgorithmParameter(const SedAlgorithmParameter* sap)
     }
     else
     {
-        return mAlgorithmParameters.append(sap);
+        return getListOfAlgorithmParameters()->append(sap);
+    }
+}
+
+
+/*
+ * Adds the given SedAlgorithmParameter to this SedDocument,
+ * which takes ownership of it.
+ */
+int
+SedDocument::addAlgorithmParameter(std::unique_ptr<SedAlgorithmParameter> sap)
+{
+    if (!sap)
+    {
+        return LIBSEDML_OPERATION_FAILED;
+    }
+    else if (sap->getParentSedObject() != NULL)
+    {
+        // still owned by its parent, which deletes it
+        sap.release();
+        return LIBSEDML_INVALID_OBJECT;
+    }
+    else if (sap->hasRequiredAttributes() == false)
+    {
+        return LIBSEDML_INVALID_OBJECT;
+    }
+    else if (getLevel() != sap->getLevel())
+    {
+        return LIBSEDML_LEVEL_MISMATCH;
+    }
+    else if (getVersion() != sap->getVersion())
+    {
+        return LIBSEDML_VERSION_MISMATCH;
+    }
+    else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+        SedBase*>(sap.get())) == false)
+    {
+        return LIBSEDML_NAMESPACES_MISMATCH;
+    }
+    else if (getLevel() == 1 && getVersion() < 4)
+    {
+        return LIBSEDML_INVALID_OBJECT;
+    }
+    else
+    {
+        return getListOfAlgorithmParameters()->appendAndOwn(std::move(sap));
     }
 }
 
@@ -405,7 +650,7 @@ SedDocument::addAlgorithmParameter(const SedAlgorithmParameter* sap)
 unsigned int
 SedDocument::getNumAlgorithmParameters() const
 {
-    return mAlgorithmParameters.size();
+    return getListOfAlgorithmParameters()->size();
 }
 
 
@@ -424,7 +669,7 @@ SedDocument::createAlgorithmParameter()
 
     try
     {
-        sap = new SedAlgorithmParameter(getSedNamespaces());
+        sap = new (getSedArena()) SedAlgorithmParameter(getSedNamespaces());
     }
     catch (...)
     {
@@ -432,7 +677,7 @@ SedDocument::createAlgorithmParameter()
 
     if (sap != NULL)
     {
-        mAlgorithmParameters.appendAndOwn(sap);
+        getListOfAlgorithmParameters()->appendAndOwn(sap);
     }
 
     return sap;
@@ -446,7 +691,7 @@ SedDocument::createAlgorithmParameter()
 SedAlgorithmParameter*
 SedDocument::removeAlgorithmParameter(unsigned int n)
 {
-    return mAlgorithmParameters.remove(n);
+    return getListOfAlgorithmParameters()->remove(n);
 }
 
 
@@ -457,7 +702,7 @@ SedDocument::removeAlgorithmParameter(unsigned int n)
 SedAlgorithmParameter*
 SedDocument::removeAlgorithmParameter(const string& id)
 {
-    return mAlgorithmParameters.remove(id);
+    return getListOfAlgorithmParameters()->remove(id);
 }
 
 
@@ -477,6 +722,7 @@ SedDocument::getListOfDataDescriptions() const
 SedListOfDataDescriptions*
 SedDocument::getListOfDataDescriptions()
 {
+  mCowSnapshot.reset();
   return &mDataDescriptions;
 }
 
@@ -487,7 +733,7 @@ SedDocument::getListOfDataDescriptions()
 SedDataDescription*
 SedDocument::getDataDescription(unsigned int n)
 {
-  return mDataDescriptions.get(n);
+  return getListOfDataDescriptions()->get(n);
 }
 
 
@@ -497,7 +743,7 @@ SedDocument::getDataDescription(unsigned int n)
 const SedDataDescription*
 SedDocument::getDataDescription(unsigned int n) const
 {
-  return mDataDescriptions.get(n);
+  return getListOfDataDescriptions()->get(n);
 }
 
 
@@ -507,7 +753,7 @@ SedDocument::getDataDescription(unsigned int n) const
 SedDataDescription*
 SedDocument::getDataDescription(const std::string& sid)
 {
-  return mDataDescriptions.get(sid);
+  return getListOfDataDescriptions()->get(sid);
 }
 
 
@@ -517,7 +763,7 @@ SedDocument::getDataDescription(const std::string& sid)
 const SedDataDescription*
 SedDocument::getDataDescription(const std::string& sid) const
 {
-  return mDataDescriptions.get(sid);
+  return getListOfDataDescriptions()->get(sid);
 }
 
 
@@ -548,13 +794,60 @@ SedDocument::addDataDescription(const SedDataDescription* sdd)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (sdd->isSetId() && (mDataDescriptions.get(sdd->getId())) != NULL)
+  else if (sdd->isSetId() &&
+    getListOfDataDescriptions()->get(sdd->getId()) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return getListOfDataDescriptions()->append(sdd);
+  }
+}
+
+
+/*
+ * Adds the given SedDataDescription to this SedDocument,
+ * which takes ownership of it.
+ */
+int
+SedDocument::addDataDescription(std::unique_ptr<SedDataDescription> sdd)
+{
+  if (!sdd)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sdd->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sdd.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sdd->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sdd->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sdd->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sdd.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sdd->isSetId() &&
+    getListOfDataDescriptions()->get(sdd->getId()) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mDataDescriptions.append(sdd);
+    return getListOfDataDescriptions()->appendAndOwn(std::move(sdd));
   }
 }
 
@@ -565,7 +858,7 @@ SedDocument::addDataDescription(const SedDataDescription* sdd)
 unsigned int
 SedDocument::getNumDataDescriptions() const
 {
-  return mDataDescriptions.size();
+  return getListOfDataDescriptions()->size();
 }
 
 
@@ -580,7 +873,7 @@ SedDocument::createDataDescription()
 
   try
   {
-    sdd = new SedDataDescription(getSedNamespaces());
+    sdd = new (getSedArena()) SedDataDescription(getSedNamespaces());
   }
   catch (...)
   {
@@ -588,7 +881,7 @@ SedDocument::createDataDescription()
 
   if (sdd != NULL)
   {
-    mDataDescriptions.appendAndOwn(sdd);
+    getListOfDataDescriptions()->appendAndOwn(sdd);
   }
 
   return sdd;
@@ -602,7 +895,7 @@ SedDocument::createDataDescription()
 SedDataDescription*
 SedDocument::removeDataDescription(unsigned int n)
 {
-  return mDataDescriptions.remove(n);
+  return getListOfDataDescriptions()->remove(n);
 }
 
 
@@ -613,7 +906,7 @@ SedDocument::removeDataDescription(unsigned int n)
 SedDataDescription*
 SedDocument::removeDataDescription(const std::string& sid)
 {
-  return mDataDescriptions.remove(sid);
+  return getListOfDataDescriptions()->remove(sid);
 }
 
 
@@ -633,6 +926,7 @@ SedDocument::getListOfModels() const
 SedListOfModels*
 SedDocument::getListOfModels()
 {
+  mCowSnapshot.reset();
   return &mModels;
 }
 
@@ -643,7 +937,7 @@ SedDocument::getListOfModels()
 SedModel*
 SedDocument::getModel(unsigned int n)
 {
-  return mModels.get(n);
+  return getListOfModels()->get(n);
 }
 
 
@@ -653,7 +947,7 @@ SedDocument::getModel(unsigned int n)
 const SedModel*
 SedDocument::getModel(unsigned int n) const
 {
-  return mModels.get(n);
+  return getListOfModels()->get(n);
 }
 
 
@@ -663,7 +957,7 @@ SedDocument::getModel(unsigned int n) const
 SedModel*
 SedDocument::getModel(const std::string& sid)
 {
-  return mModels.get(sid);
+  return getListOfModels()->get(sid);
 }
 
 
@@ -673,7 +967,7 @@ SedDocument::getModel(const std::string& sid)
 const SedModel*
 SedDocument::getModel(const std::string& sid) const
 {
-  return mModels.get(sid);
+  return getListOfModels()->get(sid);
 }
 
 
@@ -704,13 +998,57 @@ SedDocument::addModel(const SedModel* sm)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (sm->isSetId() && (mModels.get(sm->getId())) != NULL)
+  else if (sm->isSetId() && (getListOfModels()->get(sm->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return getListOfModels()->append(sm);
+  }
+}
+
+
+/*
+ * Adds the given SedModel to this SedDocument, which takes ownership of it.
+ */
+int
+SedDocument::addModel(std::unique_ptr<SedModel> sm)
+{
+  if (!sm)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sm->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sm.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sm->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sm->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sm->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sm.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sm->isSetId() && (getListOfModels()->get(sm->getId())) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mModels.append(sm);
+    return getListOfModels()->appendAndOwn(std::move(sm));
   }
 }
 
@@ -721,7 +1059,7 @@ SedDocument::addModel(const SedModel* sm)
 unsigned int
 SedDocument::getNumModels() const
 {
-  return mModels.size();
+  return getListOfModels()->size();
 }
 
 
@@ -736,7 +1074,7 @@ SedDocument::createModel()
 
   try
   {
-    sm = new SedModel(getSedNamespaces());
+    sm = new (getSedArena()) SedModel(getSedNamespaces());
   }
   catch (...)
   {
@@ -744,7 +1082,7 @@ SedDocument::createModel()
 
   if (sm != NULL)
   {
-    mModels.appendAndOwn(sm);
+    getListOfModels()->appendAndOwn(sm);
   }
 
   return sm;
@@ -757,7 +1095,7 @@ SedDocument::createModel()
 SedModel*
 SedDocument::removeModel(unsigned int n)
 {
-  return mModels.remove(n);
+  return getListOfModels()->remove(n);
 }
 
 
@@ -768,7 +1106,7 @@ SedDocument::removeModel(unsigned int n)
 SedModel*
 SedDocument::removeModel(const std::string& sid)
 {
-  return mModels.remove(sid);
+  return getListOfModels()->remove(sid);
 }
 
 
@@ -788,6 +1126,7 @@ SedDocument::getListOfSimulations() const
 SedListOfSimulations*
 SedDocument::getListOfSimulations()
 {
+  mCowSnapshot.reset();
   return &mSimulations;
 }
 
@@ -798,7 +1137,7 @@ SedDocument::getListOfSimulations()
 SedSimulation*
 SedDocument::getSimulation(unsigned int n)
 {
-  return mSimulations.get(n);
+  return getListOfSimulations()->get(n);
 }
 
 
@@ -808,7 +1147,7 @@ SedDocument::getSimulation(unsigned int n)
 const SedSimulation*
 SedDocument::getSimulation(unsigned int n) const
 {
-  return mSimulations.get(n);
+  return getListOfSimulations()->get(n);
 }
 
 
@@ -818,7 +1157,7 @@ SedDocument::getSimulation(unsigned int n) const
 SedSimulation*
 SedDocument::getSimulation(const std::string& sid)
 {
-  return mSimulations.get(sid);
+  return getListOfSimulations()->get(sid);
 }
 
 
@@ -828,7 +1167,7 @@ SedDocument::getSimulation(const std::string& sid)
 const SedSimulation*
 SedDocument::getSimulation(const std::string& sid) const
 {
-  return mSimulations.get(sid);
+  return getListOfSimulations()->get(sid);
 }
 
 
@@ -863,13 +1202,62 @@ SedDocument::addSimulation(const SedSimulation* ss)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (ss->isSetId() && (mSimulations.get(ss->getId())) != NULL)
+  else if (ss->isSetId() && (getListOfSimulations()->get(ss->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return getListOfSimulations()->append(ss);
+  }
+}
+
+
+/*
+ * Adds the given SedSimulation to this SedDocument,
+ * which takes ownership of it.
+ */
+int
+SedDocument::addSimulation(std::unique_ptr<SedSimulation> ss)
+{
+  if (!ss)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ss->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ss.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ss->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ss->hasRequiredElements() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ss->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ss->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ss.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (ss->isSetId() && (getListOfSimulations()->get(ss->getId())) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mSimulations.append(ss);
+    return getListOfSimulations()->appendAndOwn(std::move(ss));
   }
 }
 
@@ -880,7 +1268,7 @@ SedDocument::addSimulation(const SedSimulation* ss)
 unsigned int
 SedDocument::getNumSimulations() const
 {
-  return mSimulations.size();
+  return getListOfSimulations()->size();
 }
 
 
@@ -895,7 +1283,7 @@ SedDocument::createUniformTimeCourse()
 
   try
   {
-    sutc = new SedUniformTimeCourse(getSedNamespaces());
+    sutc = new (getSedArena()) SedUniformTimeCourse(getSedNamespaces());
   }
   catch (...)
   {
@@ -903,7 +1291,7 @@ SedDocument::createUniformTimeCourse()
 
   if (sutc != NULL)
   {
-    mSimulations.appendAndOwn(sutc);
+    getListOfSimulations()->appendAndOwn(sutc);
   }
 
   return sutc;
@@ -921,7 +1309,7 @@ SedDocument::createOneStep()
 
   try
   {
-    sos = new SedOneStep(getSedNamespaces());
+    sos = new (getSedArena()) SedOneStep(getSedNamespaces());
   }
   catch (...)
   {
@@ -929,7 +1317,7 @@ SedDocument::createOneStep()
 
   if (sos != NULL)
   {
-    mSimulations.appendAndOwn(sos);
+    getListOfSimulations()->appendAndOwn(sos);
   }
 
   return sos;
@@ -947,7 +1335,7 @@ SedDocument::createSteadyState()
 
   try
   {
-    sss = new SedSteadyState(getSedNamespaces());
+    sss = new (getSedArena()) SedSteadyState(getSedNamespaces());
   }
   catch (...)
   {
@@ -955,7 +1343,7 @@ SedDocument::createSteadyState()
 
   if (sss != NULL)
   {
-    mSimulations.appendAndOwn(sss);
+    getListOfSimulations()->appendAndOwn(sss);
   }
 
   return sss;
@@ -973,7 +1361,7 @@ SedDocument::createAnalysis()
 
     try
     {
-        sss = new SedAnalysis(getSedNamespaces());
+        sss = new (getSedArena()) SedAnalysis(getSedNamespaces());
     }
     catch (...)
     {
@@ -981,7 +1369,7 @@ SedDocument::createAnalysis()
 
     if (sss != NULL)
     {
-        mSimulations.appendAndOwn(sss);
+        getListOfSimulations()->appendAndOwn(sss);
     }
 
     return sss;
@@ -995,7 +1383,7 @@ SedDocument::createAnalysis()
 SedSimulation*
 SedDocument::removeSimulation(unsigned int n)
 {
-  return mSimulations.remove(n);
+  return getListOfSimulations()->remove(n);
 }
 
 
@@ -1006,7 +1394,7 @@ SedDocument::removeSimulation(unsigned int n)
 SedSimulation*
 SedDocument::removeSimulation(const std::string& sid)
 {
-  return mSimulations.remove(sid);
+  return getListOfSimulations()->remove(sid);
 }
 
 
@@ -1026,6 +1414,7 @@ SedDocument::getListOfTasks() const
 SedListOfTasks*
 SedDocument::getListOfTasks()
 {
+  mCowSnapshot.reset();
   return &mAbstractTasks;
 }
 
@@ -1036,7 +1425,7 @@ SedDocument::getListOfTasks()
 SedAbstractTask*
 SedDocument::getTask(unsigned int n)
 {
-  return mAbstractTasks.get(n);
+  return getListOfTasks()->get(n);
 }
 
 
@@ -1046,7 +1435,7 @@ SedDocument::getTask(unsigned int n)
 const SedAbstractTask*
 SedDocument::getTask(unsigned int n) const
 {
-  return mAbstractTasks.get(n);
+  return getListOfTasks()->get(n);
 }
 
 
@@ -1056,7 +1445,7 @@ SedDocument::getTask(unsigned int n) const
 SedAbstractTask*
 SedDocument::getTask(const std::string& sid)
 {
-  return mAbstractTasks.get(sid);
+  return getListOfTasks()->get(sid);
 }
 
 
@@ -1066,7 +1455,7 @@ SedDocument::getTask(const std::string& sid)
 const SedAbstractTask*
 SedDocument::getTask(const std::string& sid) const
 {
-  return mAbstractTasks.get(sid);
+  return getListOfTasks()->get(sid);
 }
 
 
@@ -1097,13 +1486,58 @@ SedDocument::addTask(const SedAbstractTask* sat)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (sat->isSetId() && (mAbstractTasks.get(sat->getId())) != NULL)
+  else if (sat->isSetId() && (getListOfTasks()->get(sat->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return getListOfTasks()->append(sat);
+  }
+}
+
+
+/*
+ * Adds the given SedAbstractTask to this SedDocument,
+ * which takes ownership of it.
+ */
+int
+SedDocument::addTask(std::unique_ptr<SedAbstractTask> sat)
+{
+  if (!sat)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sat->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sat.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sat->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sat->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sat->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sat.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sat->isSetId() && (getListOfTasks()->get(sat->getId())) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mAbstractTasks.append(sat);
+    return getListOfTasks()->appendAndOwn(std::move(sat));
   }
 }
 
@@ -1114,7 +1548,7 @@ SedDocument::addTask(const SedAbstractTask* sat)
 unsigned int
 SedDocument::getNumTasks() const
 {
-  return mAbstractTasks.size();
+  return getListOfTasks()->size();
 }
 
 
@@ -1129,7 +1563,7 @@ SedDocument::createTask()
 
   try
   {
-    st = new SedTask(getSedNamespaces());
+    st = new (getSedArena()) SedTask(getSedNamespaces());
   }
   catch (...)
   {
@@ -1137,7 +1571,7 @@ SedDocument::createTask()
 
   if (st != NULL)
   {
-    mAbstractTasks.appendAndOwn(st);
+    getListOfTasks()->appendAndOwn(st);
   }
 
   return st;
@@ -1155,7 +1589,7 @@ SedDocument::createRepeatedTask()
 
   try
   {
-    srt = new SedRepeatedTask(getSedNamespaces());
+    srt = new (getSedArena()) SedRepeatedTask(getSedNamespaces());
   }
   catch (...)
   {
@@ -1163,7 +1597,7 @@ SedDocument::createRepeatedTask()
 
   if (srt != NULL)
   {
-    mAbstractTasks.appendAndOwn(srt);
+    getListOfTasks()->appendAndOwn(srt);
   }
 
   return srt;
@@ -1181,7 +1615,7 @@ SedDocument::createParameterEstimationTask()
 
   try
   {
-    spet = new SedParameterEstimationTask(getSedNamespaces());
+    spet = new (getSedArena()) SedParameterEstimationTask(getSedNamespaces());
   }
   catch (...)
   {
@@ -1189,7 +1623,7 @@ SedDocument::createParameterEstimationTask()
 
   if (spet != NULL)
   {
-    mAbstractTasks.appendAndOwn(spet);
+    getListOfTasks()->appendAndOwn(spet);
   }
 
   return spet;
@@ -1203,7 +1637,7 @@ SedDocument::createParameterEstimationTask()
 SedAbstractTask*
 SedDocument::removeTask(unsigned int n)
 {
-  return mAbstractTasks.remove(n);
+  return getListOfTasks()->remove(n);
 }
 
 
@@ -1214,7 +1648,7 @@ SedDocument::removeTask(unsigned int n)
 SedAbstractTask*
 SedDocument::removeTask(const std::string& sid)
 {
-  return mAbstractTasks.remove(sid);
+  return getListOfTasks()->remove(sid);
 }
 
 
@@ -1234,6 +1668,7 @@ SedDocument::getListOfDataGenerators() const
 SedListOfDataGenerators*
 SedDocument::getListOfDataGenerators()
 {
+  mCowSnapshot.reset();
   return &mDataGenerators;
 }
 
@@ -1244,7 +1679,7 @@ SedDocument::getListOfDataGenerators()
 SedDataGenerator*
 SedDocument::getDataGenerator(unsigned int n)
 {
-  return mDataGenerators.get(n);
+  return getListOfDataGenerators()->get(n);
 }
 
 
@@ -1254,7 +1689,7 @@ SedDocument::getDataGenerator(unsigned int n)
 const SedDataGenerator*
 SedDocument::getDataGenerator(unsigned int n) const
 {
-  return mDataGenerators.get(n);
+  return getListOfDataGenerators()->get(n);
 }
 
 
@@ -1264,7 +1699,7 @@ SedDocument::getDataGenerator(unsigned int n) const
 SedDataGenerator*
 SedDocument::getDataGenerator(const std::string& sid)
 {
-  return mDataGenerators.get(sid);
+  return getListOfDataGenerators()->get(sid);
 }
 
 
@@ -1274,7 +1709,7 @@ SedDocument::getDataGenerator(const std::string& sid)
 const SedDataGenerator*
 SedDocument::getDataGenerator(const std::string& sid) const
 {
-  return mDataGenerators.get(sid);
+  return getListOfDataGenerators()->get(sid);
 }
 
 
@@ -1309,39 +1744,90 @@ SedDocument::addDataGenerator(const SedDataGenerator* sdg)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (sdg->isSetId() && (mDataGenerators.get(sdg->getId())) != NULL)
+  else if (sdg->isSetId() &&
+    getListOfDataGenerators()->get(sdg->getId()) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mDataGenerators.append(sdg);
+    return getListOfDataGenerators()->append(sdg);
   }
 }
 
 
 /*
- * Get the number of SedDataGenerator objects in this SedDocument.
- */
-unsigned int
-SedDocument::getNumDataGenerators() const
-{
-  return mDataGenerators.size();
-}
-
-
-/*
- * Creates a new SedDataGenerator object, adds it to this SedDocument object
- * and returns the SedDataGenerator object created.
+ * Adds the given SedDataGenerator to this SedDocument,
+ * which takes ownership of it.
  */
-SedDataGenerator*
-SedDocument::createDataGenerator()
+int
+SedDocument::addDataGenerator(std::unique_ptr<SedDataGenerator> sdg)
 {
-  SedDataGenerator* sdg = NULL;
-
+  if (!sdg)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sdg->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sdg.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sdg->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sdg->hasRequiredElements() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sdg->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sdg->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sdg.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sdg->isSetId() &&
+    getListOfDataGenerators()->get(sdg->getId()) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return getListOfDataGenerators()->appendAndOwn(std::move(sdg));
+  }
+}
+
+
+/*
+ * Get the number of SedDataGenerator objects in this SedDocument.
+ */
+unsigned int
+SedDocument::getNumDataGenerators() const
+{
+  return getListOfDataGenerators()->size();
+}
+
+
+/*
+ * Creates a new SedDataGenerator object, adds it to this SedDocument object
+ * and returns the SedDataGenerator object created.
+ */
+SedDataGenerator*
+SedDocument::createDataGenerator()
+{
+  SedDataGenerator* sdg = NULL;
+
   try
   {
-    sdg = new SedDataGenerator(getSedNamespaces());
+    sdg = new (getSedArena()) SedDataGenerator(getSedNamespaces());
   }
   catch (...)
   {
@@ -1349,7 +1835,7 @@ SedDocument::createDataGenerator()
 
   if (sdg != NULL)
   {
-    mDataGenerators.appendAndOwn(sdg);
+    getListOfDataGenerators()->appendAndOwn(sdg);
   }
 
   return sdg;
@@ -1363,7 +1849,7 @@ SedDocument::createDataGenerator()
 SedDataGenerator*
 SedDocument::removeDataGenerator(unsigned int n)
 {
-  return mDataGenerators.remove(n);
+  return getListOfDataGenerators()->remove(n);
 }
 
 
@@ -1374,7 +1860,7 @@ SedDocument::removeDataGenerator(unsigned int n)
 SedDataGenerator*
 SedDocument::removeDataGenerator(const std::string& sid)
 {
-  return mDataGenerators.remove(sid);
+  return getListOfDataGenerators()->remove(sid);
 }
 
 
@@ -1394,6 +1880,7 @@ SedDocument::getListOfOutputs() const
 SedListOfOutputs*
 SedDocument::getListOfOutputs()
 {
+  mCowSnapshot.reset();
   return &mOutputs;
 }
 
@@ -1404,7 +1891,7 @@ SedDocument::getListOfOutputs()
 SedOutput*
 SedDocument::getOutput(unsigned int n)
 {
-  return mOutputs.get(n);
+  return getListOfOutputs()->get(n);
 }
 
 
@@ -1414,7 +1901,7 @@ SedDocument::getOutput(unsigned int n)
 const SedOutput*
 SedDocument::getOutput(unsigned int n) const
 {
-  return mOutputs.get(n);
+  return getListOfOutputs()->get(n);
 }
 
 
@@ -1424,7 +1911,7 @@ SedDocument::getOutput(unsigned int n) const
 SedOutput*
 SedDocument::getOutput(const std::string& sid)
 {
-  return mOutputs.get(sid);
+  return getListOfOutputs()->get(sid);
 }
 
 
@@ -1434,7 +1921,7 @@ SedDocument::getOutput(const std::string& sid)
 const SedOutput*
 SedDocument::getOutput(const std::string& sid) const
 {
-  return mOutputs.get(sid);
+  return getListOfOutputs()->get(sid);
 }
 
 
@@ -1465,13 +1952,57 @@ SedDocument::addOutput(const SedOutput* so)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (so->isSetId() && (mOutputs.get(so->getId())) != NULL)
+  else if (so->isSetId() && (getListOfOutputs()->get(so->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return getListOfOutputs()->append(so);
+  }
+}
+
+
+/*
+ * Adds the given SedOutput to this SedDocument, which takes ownership of it.
+ */
+int
+SedDocument::addOutput(std::unique_ptr<SedOutput> so)
+{
+  if (!so)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (so->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    so.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (so->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != so->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != so->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(so.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (so->isSetId() && (getListOfOutputs()->get(so->getId())) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mOutputs.append(so);
+    return getListOfOutputs()->appendAndOwn(std::move(so));
   }
 }
 
@@ -1482,7 +2013,7 @@ SedDocument::addOutput(const SedOutput* so)
 unsigned int
 SedDocument::getNumOutputs() const
 {
-  return mOutputs.size();
+  return getListOfOutputs()->size();
 }
 
 
@@ -1497,7 +2028,7 @@ SedDocument::createReport()
 
   try
   {
-    sr = new SedReport(getSedNamespaces());
+    sr = new (getSedArena()) SedReport(getSedNamespaces());
   }
   catch (...)
   {
@@ -1505,7 +2036,7 @@ SedDocument::createReport()
 
   if (sr != NULL)
   {
-    mOutputs.appendAndOwn(sr);
+    getListOfOutputs()->appendAndOwn(sr);
   }
 
   return sr;
@@ -1523,7 +2054,7 @@ SedDocument::createPlot2D()
 
   try
   {
-    spd = new SedPlot2D(getSedNamespaces());
+    spd = new (getSedArena()) SedPlot2D(getSedNamespaces());
   }
   catch (...)
   {
@@ -1531,7 +2062,7 @@ SedDocument::createPlot2D()
 
   if (spd != NULL)
   {
-    mOutputs.appendAndOwn(spd);
+    getListOfOutputs()->appendAndOwn(spd);
   }
 
   return spd;
@@ -1549,7 +2080,7 @@ SedDocument::createPlot3D()
 
   try
   {
-    spd = new SedPlot3D(getSedNamespaces());
+    spd = new (getSedArena()) SedPlot3D(getSedNamespaces());
   }
   catch (...)
   {
@@ -1557,7 +2088,7 @@ SedDocument::createPlot3D()
 
   if (spd != NULL)
   {
-    mOutputs.appendAndOwn(spd);
+    getListOfOutputs()->appendAndOwn(spd);
   }
 
   return spd;
@@ -1575,7 +2106,7 @@ SedDocument::createFigure()
 
   try
   {
-    sf = new SedFigure(getSedNamespaces());
+    sf = new (getSedArena()) SedFigure(getSedNamespaces());
   }
   catch (...)
   {
@@ -1583,7 +2114,7 @@ SedDocument::createFigure()
 
   if (sf != NULL)
   {
-    mOutputs.appendAndOwn(sf);
+    getListOfOutputs()->appendAndOwn(sf);
   }
 
   return sf;
@@ -1602,7 +2133,7 @@ SedDocument::createParameterEstimationResultPlot()
 
   try
   {
-    sperp = new SedParameterEstimationResultPlot(getSedNamespaces());
+    sperp = new (getSedArena()) SedParameterEstimationResultPlot(getSedNamespaces());
   }
   catch (...)
   {
@@ -1610,7 +2141,7 @@ SedDocument::createParameterEstimationResultPlot()
 
   if (sperp != NULL)
   {
-    mOutputs.appendAndOwn(sperp);
+    getListOfOutputs()->appendAndOwn(sperp);
   }
 
   return sperp;
@@ -1623,7 +2154,7 @@ SedDocument::createParameterEstimationResultPlot()
 SedOutput*
 SedDocument::removeOutput(unsigned int n)
 {
-  return mOutputs.remove(n);
+  return getListOfOutputs()->remove(n);
 }
 
 
@@ -1634,7 +2165,7 @@ SedDocument::removeOutput(unsigned int n)
 SedOutput*
 SedDocument::removeOutput(const std::string& sid)
 {
-  return mOutputs.remove(sid);
+  return getListOfOutputs()->remove(sid);
 }
 
 
@@ -1654,6 +2185,7 @@ SedDocument::getListOfStyles() const
 SedListOfStyles*
 SedDocument::getListOfStyles()
 {
+  mCowSnapshot.reset();
   return &mStyles;
 }
 
@@ -1664,7 +2196,7 @@ SedDocument::getListOfStyles()
 SedStyle*
 SedDocument::getStyle(unsigned int n)
 {
-  return mStyles.get(n);
+  return getListOfStyles()->get(n);
 }
 
 
@@ -1674,7 +2206,7 @@ SedDocument::getStyle(unsigned int n)
 const SedStyle*
 SedDocument::getStyle(unsigned int n) const
 {
-  return mStyles.get(n);
+  return getListOfStyles()->get(n);
 }
 
 
@@ -1684,7 +2216,7 @@ SedDocument::getStyle(unsigned int n) const
 SedStyle*
 SedDocument::getStyle(const std::string& sid)
 {
-  return mStyles.get(sid);
+  return getListOfStyles()->get(sid);
 }
 
 
@@ -1694,247 +2226,802 @@ SedDocument::getStyle(const std::string& sid)
 const SedStyle*
 SedDocument::getStyle(const std::string& sid) const
 {
-  return mStyles.get(sid);
+  return getListOfStyles()->get(sid);
 }
 
 
 /*
- * Get a SedStyle from the SedDocument based on its identifier.
+ * Get the effective SedStyle from the SedDocument based on its identifier.
  */
 SedStyle
 SedDocument::getEffectiveStyle(const std::string& sid) const
 {
-    const SedStyle* top =  mStyles.get(sid);
-    if (top == NULL)
+    const SedStyle* resolved = getResolvedStyle(sid);
+    if (resolved == NULL)
     {
         return SedStyle(mLevel, mVersion);
     }
-    if (!top->isSetBaseStyle())
-    {
-        return SedStyle(*top);
-    }
-    SedStyle base = getEffectiveStyle(top->getBaseStyle());
-    base.setId(top->getId());
-    base.setName(top->getName());
-    base.unsetBaseStyle();
-
-    if (top->isSetLineStyle())
-    {
-        if (base.isSetLineStyle())
-        {
-            const SedLine* topline = top->getLineStyle();
-            SedLine* baseline = base.getLineStyle();
-
-            if (topline->isSetColor())
-            {
-                baseline->setColor(topline->getColor());
-            }
+    return SedStyle(*resolved);
+}
 
-            if (topline->isSetType())
-            {
-                baseline->setType(topline->getType());
-            }
 
-            if (topline->isSetThickness())
-            {
-                baseline->setThickness(topline->getThickness());
-            }
-        }
-        else
-        {
-            base.setLineStyle(top->getLineStyle());
-        }
-    }
+/*
+ * Get the effective SedStyle from the SedDocument based on its identifier,
+ * without copying it.
+ */
+const SedStyle*
+SedDocument::getResolvedStyle(const std::string& sid) const
+{
+    std::vector<std::string> chain;
+    bool cycle = false;
+    const SedStyle* resolved = resolveStyle(sid, chain, cycle);
 
-    if (top->isSetMarkerStyle())
+    // each style whose chain runs into a cycle is reported once
+    bool* reported = cycle ? &mCyclicStyles[sid] : NULL;
+    if (reported != NULL && !*reported)
     {
-        if (base.isSetMarkerStyle())
-        {
-            const SedMarker* topmarker = top->getMarkerStyle();
-            SedMarker* basemarker = base.getMarkerStyle();
-
-            if (topmarker->isSetType())
-            {
-                basemarker->setType(topmarker->getType());
-            }
-
-            if (topmarker->isSetSize())
-            {
-                basemarker->setSize(topmarker->getSize());
-            }
-
-            if (topmarker->isSetFill())
-            {
-                basemarker->setFill(topmarker->getFill());
-            }
-
-            if (topmarker->isSetLineColor())
-            {
-                basemarker->setLineColor(topmarker->getLineColor());
-            }
-
-            if (topmarker->isSetLineThickness())
-            {
-                basemarker->setLineThickness(topmarker->getLineThickness());
-            }
-        }
-        else
-        {
-            base.setMarkerStyle(top->getMarkerStyle());
-        }
+        *reported = true;
+        std::string msg = "The style with id '" + sid + "' has a circular "
+          "chain of baseStyle references.";
+        const_cast<SedDocument*>(this)->logError(
+          SedmlStyleBaseStyleMustNotBeCircular, getLevel(), getVersion(), msg);
     }
 
-    if (top->isSetFillStyle())
-    {
-        if (base.isSetFillStyle())
-        {
-            const SedFill* topfill = top->getFillStyle();
-            SedFill* basefill = base.getFillStyle();
-
-            if (topfill->isSetColor())
-            {
-                basefill->setColor(topfill->getColor());
-            }
-
-            //if (topfill->isSetSecondColor())
-            //{
-            //    basefill->setSecondColor(topfill->getSecondColor());
-            //}
-        }
-        else
-        {
-            base.setFillStyle(top->getFillStyle());
-        }
-    }
-    return base;
+    return resolved;
 }
 
 
 /*
- * Get a SedStyle from the SedDocument based on the BaseStyle to which it
- * refers.
+ * Returns the load mask this SedDocument was read with.
  */
-const SedStyle*
-SedDocument::getStyleByBaseStyle(const std::string& sid) const
+unsigned int
+SedDocument::getLoadMask() const
 {
-  return mStyles.getByBaseStyle(sid);
+  return mLoadMask;
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
 /*
- * Get a SedStyle from the SedDocument based on the BaseStyle to which it
- * refers.
+ * Sets the load mask used while reading this SedDocument.
  */
-SedStyle*
-SedDocument::getStyleByBaseStyle(const std::string& sid)
+void
+SedDocument::setLoadMask(unsigned int mask)
 {
-  return mStyles.getByBaseStyle(sid);
+  mLoadMask = mask;
 }
 
+/** @endcond */
+
 
 /*
- * Adds a copy of the given SedStyle to this SedDocument.
+ * Enables or disables arena allocation for the objects created in this
+ * SedDocument from now on.
  */
 int
-SedDocument::addStyle(const SedStyle* ss)
+SedDocument::setArenaAllocation(bool enable)
 {
-  if (ss == NULL)
-  {
-    return LIBSEDML_OPERATION_FAILED;
-  }
-  else if (ss->hasRequiredAttributes() == false)
-  {
-    return LIBSEDML_INVALID_OBJECT;
-  }
-  else if (getLevel() != ss->getLevel())
-  {
-    return LIBSEDML_LEVEL_MISMATCH;
-  }
-  else if (getVersion() != ss->getVersion())
-  {
-    return LIBSEDML_VERSION_MISMATCH;
-  }
-  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
-    SedBase*>(ss)) == false)
-  {
-    return LIBSEDML_NAMESPACES_MISMATCH;
-  }
-  else if (ss->isSetId() && (mStyles.get(ss->getId())) != NULL)
+  if (enable && mArena == NULL)
   {
-    return LIBSEDML_DUPLICATE_OBJECT_ID;
+    mArena = SedArena::create();
   }
-  else
+  else if (!enable && mArena != NULL)
   {
-    return mStyles.append(ss);
+    mArena->release();
+    mArena = NULL;
   }
+
+  return LIBSEDML_OPERATION_SUCCESS;
 }
 
 
 /*
- * Get the number of SedStyle objects in this SedDocument.
+ * Returns true if objects created in this SedDocument are allocated from
+ * its arena.
  */
-unsigned int
-SedDocument::getNumStyles() const
+bool
+SedDocument::getArenaAllocation() const
 {
-  return mStyles.size();
+  return (mArena != NULL);
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
 /*
- * Creates a new SedStyle object, adds it to this SedDocument object and
- * returns the SedStyle object created.
+ * Returns the SedArena objects created in this SedDocument come from.
  */
-SedStyle*
-SedDocument::createStyle()
+SedArena*
+SedDocument::getArena() const
 {
-  SedStyle* ss = NULL;
-
-  try
-  {
-    ss = new SedStyle(getSedNamespaces());
-  }
-  catch (...)
-  {
-  }
-
-  if (ss != NULL)
-  {
-    mStyles.appendAndOwn(ss);
-  }
-
-  return ss;
+  return mArena;
 }
 
+/** @endcond */
+
 
 /*
- * Removes the nth SedStyle from this SedDocument and returns a pointer to it.
+ * Enables or disables sharing the lists of this SedDocument with its
+ * clones.
  */
-SedStyle*
-SedDocument::removeStyle(unsigned int n)
+int
+SedDocument::setCopyOnWriteClone(bool enable)
 {
-  return mStyles.remove(n);
+  mCopyOnWriteClone = enable;
+  mCowSnapshot.reset();
+
+  return LIBSEDML_OPERATION_SUCCESS;
 }
 
 
 /*
- * Removes the SedStyle from this SedDocument based on its identifier and
- * returns a pointer to it.
+ * Returns true if clones of this SedDocument share its lists.
  */
-SedStyle*
-SedDocument::removeStyle(const std::string& sid)
+bool
+SedDocument::getCopyOnWriteClone() const
 {
-  return mStyles.remove(sid);
+  return mCopyOnWriteClone;
 }
 
 
 /*
- * Returns the XML element name of this SedDocument object.
+ * Returns the lists still shared with the document this one was cloned
+ * from.
  */
-const std::string&
-SedDocument::getElementName() const
+unsigned int
+SedDocument::getSharedLists() const
 {
-  static const string name = "sedML";
-  return name;
+  const SedListOf* lists[] = { &mAlgorithmParameters, &mDataDescriptions,
+    &mModels, &mSimulations, &mAbstractTasks, &mDataGenerators, &mOutputs,
+    &mStyles };
+  const unsigned int parts[] = { SEDML_LOAD_ALGORITHM_PARAMETERS,
+    SEDML_LOAD_DATA_DESCRIPTIONS, SEDML_LOAD_MODELS, SEDML_LOAD_SIMULATIONS,
+    SEDML_LOAD_TASKS, SEDML_LOAD_DATA_GENERATORS, SEDML_LOAD_OUTPUTS,
+    SEDML_LOAD_STYLES };
+
+  unsigned int shared = 0;
+  for (size_t i = 0; i < sizeof(lists) / sizeof(lists[0]); ++i)
+  {
+    if (lists[i]->hasSharedItems())
+    {
+      shared |= parts[i];
+    }
+  }
+
+  return shared;
+}
+
+
+/*
+ * Returns a read-only snapshot of this SedDocument.
+ */
+SedFrozenDocument*
+SedDocument::freeze() const
+{
+  return new SedFrozenDocument(*this);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns the snapshot shared by the copy-on-write clones of this document.
+ */
+std::shared_ptr<const SedDocument>
+SedDocument::getCopyOnWriteSnapshot() const
+{
+  // cloning is a const operation, and may happen on several threads
+  std::lock_guard<std::mutex> lock(mCowMutex);
+
+  if (!mCowSnapshot)
+  {
+    SedDocument* snapshot = new SedDocument(getLevel(), getVersion());
+    snapshot->mCowSource = mCowSource;
+    snapshot->copyListsSharing(*this);
+    snapshot->prepareCopyOnWriteSnapshot();
+    mCowSnapshot.reset(snapshot);
+  }
+
+  return mCowSnapshot;
+}
+
+
+/*
+ * Makes the items of the lists of this document those of source (see
+ * SedListOf::copySharing()).
+ */
+void
+SedDocument::copyListsSharing(const SedDocument& source)
+{
+  mAlgorithmParameters.copySharing(source.mAlgorithmParameters);
+  mDataDescriptions.copySharing(source.mDataDescriptions);
+  mModels.copySharing(source.mModels);
+  mSimulations.copySharing(source.mSimulations);
+  mAbstractTasks.copySharing(source.mAbstractTasks);
+  mDataGenerators.copySharing(source.mDataGenerators);
+  mOutputs.copySharing(source.mOutputs);
+  mStyles.copySharing(source.mStyles);
+
+  invalidateElementIndex();
+  clearEffectiveStyleCache();
+}
+
+
+/*
+ * Lets the lists of this snapshot lend their items, and builds everything
+ * its elements compute lazily: clones on several threads read them at the
+ * same time, so reading must never modify them.
+ */
+void
+SedDocument::prepareCopyOnWriteSnapshot()
+{
+  SedListOf* lists[] = { &mAlgorithmParameters, &mDataDescriptions,
+    &mModels, &mSimulations, &mAbstractTasks, &mDataGenerators, &mOutputs,
+    &mStyles };
+
+  for (size_t i = 0; i < sizeof(lists) / sizeof(lists[0]); ++i)
+  {
+    lists[i]->setLendsItems();
+  }
+
+  // the items shared with an earlier snapshot were prepared with it
+  List* elements = collectElements(NULL);
+  while (elements->getSize() > 0)
+  {
+    const SedBase* element = static_cast<const SedBase*>(elements->remove(0));
+    if (element->getSedDocument() == this)
+    {
+      element->prepareForConcurrentReads();
+    }
+  }
+  delete elements;
+
+  prepareForConcurrentReads();
+}
+
+
+/*
+ * Gives this document a copy of its own of the shared item of one of its
+ * lists that element belongs to.
+ */
+void
+SedDocument::unshareElement(const SedBase* element)
+{
+  if (element == NULL || element->getSedDocument() == this)
+  {
+    return;
+  }
+
+  // find the item of a list of the snapshot the element is in
+  const SedBase* item = element;
+  const SedBase* list = item->getParentSedObject();
+  while (list != NULL && list->getParentSedObject() != NULL &&
+         list->getParentSedObject()->getTypeCode() != SEDML_DOCUMENT)
+  {
+    item = list;
+    list = item->getParentSedObject();
+  }
+
+  SedListOf* lists[] = { &mAlgorithmParameters, &mDataDescriptions,
+    &mModels, &mSimulations, &mAbstractTasks, &mDataGenerators, &mOutputs,
+    &mStyles };
+
+  for (size_t i = 0; i < sizeof(lists) / sizeof(lists[0]); ++i)
+  {
+    if (lists[i]->unshareItem(item) != NULL)
+    {
+      break;
+    }
+  }
+
+  // the index refers to the elements of the shared item
+  invalidateElementIndex();
+}
+
+/** @endcond */
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Discards all cached effective styles.
+ */
+void
+SedDocument::clearEffectiveStyleCache() const
+{
+    for (StyleCache::iterator it = mEffectiveStyles.begin();
+         it != mEffectiveStyles.end(); ++it)
+    {
+        delete it->second;
+    }
+    mEffectiveStyles.clear();
+    mCyclicStyles.clear();
+}
+
+
+/*
+ * Computes (or fetches from the cache) the effective style sid.
+ */
+const SedStyle*
+SedDocument::resolveStyle(const std::string& sid,
+                          std::vector<std::string>& chain, bool& cycle) const
+{
+    if (mCyclicStyles.find(sid) != mCyclicStyles.end())
+    {
+        cycle = true;
+        return NULL;
+    }
+
+    StyleCache::const_iterator it = mEffectiveStyles.find(sid);
+    if (it != mEffectiveStyles.end())
+    {
+        return it->second;
+    }
+
+    const SedStyle* top = getListOfStyles()->get(sid);
+    if (top == NULL)
+    {
+        return NULL;
+    }
+
+    if (std::find(chain.begin(), chain.end(), sid) != chain.end())
+    {
+        cycle = true;
+        return NULL;
+    }
+
+    SedStyle* resolved = NULL;
+    if (!top->isSetBaseStyle())
+    {
+        resolved = new SedStyle(*top);
+    }
+    else
+    {
+        chain.push_back(sid);
+        const SedStyle* base = resolveStyle(top->getBaseStyle(), chain, cycle);
+        chain.pop_back();
+
+        if (cycle)
+        {
+            // remembered so that styles based on this one see the cycle
+            // as well
+            mCyclicStyles.insert(std::make_pair(sid, false));
+            return NULL;
+        }
+
+        resolved = (base != NULL) ? new SedStyle(*base)
+                                  : new SedStyle(mLevel, mVersion);
+        resolved->setId(top->getId());
+        resolved->setName(top->getName());
+        resolved->unsetBaseStyle();
+        mergeStyle(*resolved, *top);
+    }
+
+    mEffectiveStyles[sid] = resolved;
+    return resolved;
+}
+
+
+/*
+ * Overrides the attributes of base with those set on top.
+ */
+void
+SedDocument::mergeStyle(SedStyle& base, const SedStyle& top)
+{
+    if (top.isSetLineStyle())
+    {
+        if (base.isSetLineStyle())
+        {
+            const SedLine* topline = top.getLineStyle();
+            SedLine* baseline = base.getLineStyle();
+
+            if (topline->isSetColor())
+            {
+                baseline->setColor(topline->getColor());
+            }
+
+            if (topline->isSetType())
+            {
+                baseline->setType(topline->getType());
+            }
+
+            if (topline->isSetThickness())
+            {
+                baseline->setThickness(topline->getThickness());
+            }
+        }
+        else
+        {
+            base.setLineStyle(top.getLineStyle());
+        }
+    }
+
+    if (top.isSetMarkerStyle())
+    {
+        if (base.isSetMarkerStyle())
+        {
+            const SedMarker* topmarker = top.getMarkerStyle();
+            SedMarker* basemarker = base.getMarkerStyle();
+
+            if (topmarker->isSetType())
+            {
+                basemarker->setType(topmarker->getType());
+            }
+
+            if (topmarker->isSetSize())
+            {
+                basemarker->setSize(topmarker->getSize());
+            }
+
+            if (topmarker->isSetFill())
+            {
+                basemarker->setFill(topmarker->getFill());
+            }
+
+            if (topmarker->isSetLineColor())
+            {
+                basemarker->setLineColor(topmarker->getLineColor());
+            }
+
+            if (topmarker->isSetLineThickness())
+            {
+                basemarker->setLineThickness(topmarker->getLineThickness());
+            }
+        }
+        else
+        {
+            base.setMarkerStyle(top.getMarkerStyle());
+        }
+    }
+
+    if (top.isSetFillStyle())
+    {
+        if (base.isSetFillStyle())
+        {
+            const SedFill* topfill = top.getFillStyle();
+            SedFill* basefill = base.getFillStyle();
+
+            if (topfill->isSetColor())
+            {
+                basefill->setColor(topfill->getColor());
+            }
+
+            //if (topfill->isSetSecondColor())
+            //{
+            //    basefill->setSecondColor(topfill->getSecondColor());
+            //}
+        }
+        else
+        {
+            base.setFillStyle(top.getFillStyle());
+        }
+    }
+}
+
+/** @endcond */
+
+
+/*
+ * Get a SedStyle from the SedDocument based on the BaseStyle to which it
+ * refers.
+ */
+const SedStyle*
+SedDocument::getStyleByBaseStyle(const std::string& sid) const
+{
+  return getListOfStyles()->getByBaseStyle(sid);
+}
+
+
+/*
+ * Get a SedStyle from the SedDocument based on the BaseStyle to which it
+ * refers.
+ */
+SedStyle*
+SedDocument::getStyleByBaseStyle(const std::string& sid)
+{
+  return getListOfStyles()->getByBaseStyle(sid);
+}
+
+
+/*
+ * Adds a copy of the given SedStyle to this SedDocument.
+ */
+int
+SedDocument::addStyle(const SedStyle* ss)
+{
+  if (ss == NULL)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ss->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ss->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ss->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ss)) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (ss->isSetId() && (getListOfStyles()->get(ss->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return getListOfStyles()->append(ss);
+  }
+}
+
+
+/*
+ * Adds the given SedStyle to this SedDocument, which takes ownership of it.
+ */
+int
+SedDocument::addStyle(std::unique_ptr<SedStyle> ss)
+{
+  if (!ss)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ss->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ss.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ss->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ss->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ss->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ss.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (ss->isSetId() && (getListOfStyles()->get(ss->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return getListOfStyles()->appendAndOwn(std::move(ss));
+  }
+}
+
+
+/*
+ * Get the number of SedStyle objects in this SedDocument.
+ */
+unsigned int
+SedDocument::getNumStyles() const
+{
+  return getListOfStyles()->size();
+}
+
+
+/*
+ * Creates a new SedStyle object, adds it to this SedDocument object and
+ * returns the SedStyle object created.
+ */
+SedStyle*
+SedDocument::createStyle()
+{
+  SedStyle* ss = NULL;
+
+  try
+  {
+    ss = new (getSedArena()) SedStyle(getSedNamespaces());
+  }
+  catch (...)
+  {
+  }
+
+  if (ss != NULL)
+  {
+    getListOfStyles()->appendAndOwn(ss);
+  }
+
+  return ss;
+}
+
+
+/*
+ * Removes the nth SedStyle from this SedDocument and returns a pointer to it.
+ */
+SedStyle*
+SedDocument::removeStyle(unsigned int n)
+{
+  return getListOfStyles()->remove(n);
+}
+
+
+/*
+ * Removes the SedStyle from this SedDocument based on its identifier and
+ * returns a pointer to it.
+ */
+SedStyle*
+SedDocument::removeStyle(const std::string& sid)
+{
+  return getListOfStyles()->remove(sid);
+}
+
+
+/*
+ * Returns the heap memory held by this SedDocument and all its elements.
+ */
+SedMemoryUsage
+SedDocument::getMemoryUsage() const
+{
+  SedMemoryUsage usage;
+  addMemoryUsage(usage);
+
+  // read in place: unsharing the items would change what is being measured
+  List* elements = collectElements(NULL);
+  while (elements->getSize() > 0)
+  {
+    const SedBase* element = static_cast<const SedBase*>(elements->remove(0));
+
+    // shared items belong to the snapshot they come from
+    if (element->getSedDocument() == this)
+    {
+      element->addMemoryUsage(usage);
+    }
+  }
+
+  delete elements;
+  return usage;
+}
+
+
+/*
+ * Adds the memory held by this SedDocument object to @p usage.
+ */
+void
+SedDocument::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedDocument) - sizeof(SedBase) -
+    sizeof(SedListOfAlgorithmParameters) - sizeof(SedListOfDataDescriptions) -
+    sizeof(SedListOfModels) - sizeof(SedListOfSimulations) -
+    sizeof(SedListOfTasks) - sizeof(SedListOfDataGenerators) -
+    sizeof(SedListOfOutputs) - sizeof(SedListOfStyles));
+  usage.addIndex(type, mSIdIndex);
+  usage.addIndex(type, mMetaIdIndex);
+  usage.addIndex(type, mSIdDuplicates);
+  usage.addIndex(type, mMetaIdDuplicates);
+  usage.addIndex(type, mEffectiveStyles);
+  usage.addIndex(type, mCyclicStyles);
+  usage.addBytes(type, mErrorLog.getNumErrors() * sizeof(SedError));
+
+  // the lists of this document that are not returned by collectElements():
+  // empty ones
+  const SedListOf* lists[] = { &mAlgorithmParameters, &mDataDescriptions,
+    &mModels, &mSimulations, &mAbstractTasks, &mDataGenerators, &mOutputs,
+    &mStyles };
+
+  for (size_t i = 0; i < sizeof(lists) / sizeof(lists[0]); ++i)
+  {
+    if (lists[i]->size() == 0)
+    {
+      lists[i]->addMemoryUsage(usage);
+    }
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Also builds the SId/metaid index and resolves every style, so that
+ * getElementBySId() and getResolvedStyle() only read their caches.
+ */
+void
+SedDocument::prepareForConcurrentReads() const
+{
+  SedBase::prepareForConcurrentReads();
+
+  if (!mElementIndexValid)
+  {
+    buildElementIndex();
+  }
+
+  for (unsigned int n = 0; n < getNumStyles(); ++n)
+  {
+    getResolvedStyle(getStyle(n)->getId());
+  }
+}
+
+
+/*
+ * Writes the namespace declarations, level and version, and the lists.
+ * The lists are reached through the const accessors, so that those of a
+ * copy-on-write clone are read from the document they are shared with.
+ */
+void
+SedDocument::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeNamespaces(getNamespaces());
+  stream.writeUnsigned(mLevel);
+  stream.writeBool(mIsSetLevel);
+  stream.writeUnsigned(mVersion);
+  stream.writeBool(mIsSetVersion);
+
+  getListOfAlgorithmParameters()->writeBinary(stream);
+  getListOfDataDescriptions()->writeBinary(stream);
+  getListOfModels()->writeBinary(stream);
+  getListOfSimulations()->writeBinary(stream);
+  getListOfTasks()->writeBinary(stream);
+  getListOfDataGenerators()->writeBinary(stream);
+  getListOfOutputs()->writeBinary(stream);
+  getListOfStyles()->writeBinary(stream);
+}
+
+
+/*
+ * Reads what writeBinary() wrote and drops the caches built from the
+ * previous content.
+ */
+void
+SedDocument::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* xmlns =
+    stream.readNamespaces();
+  setNamespaces(xmlns);
+  delete xmlns;
+
+  mLevel = static_cast<unsigned int>(stream.readUnsigned());
+  mIsSetLevel = stream.readBool();
+  mVersion = static_cast<unsigned int>(stream.readUnsigned());
+  mIsSetVersion = stream.readBool();
+
+  getListOfAlgorithmParameters()->readBinary(stream);
+  getListOfDataDescriptions()->readBinary(stream);
+  getListOfModels()->readBinary(stream);
+  getListOfSimulations()->readBinary(stream);
+  getListOfTasks()->readBinary(stream);
+  getListOfDataGenerators()->readBinary(stream);
+  getListOfOutputs()->readBinary(stream);
+  getListOfStyles()->readBinary(stream);
+
+  invalidateElementIndex();
+  clearEffectiveStyleCache();
+}
+
+/** @endcond */
+
+
+/*
+ * Returns the XML element name of this SedDocument object.
+ */
+const std::string&
+SedDocument::getElementName() const
+{
+  static const string name = "sedML";
+  return name;
 }
 
 
@@ -1985,42 +3072,42 @@ SedDocument::writeElements(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 
   if (getNumAlgorithmParameters() > 0 && (getLevel() > 1 || getVersion() >= 4))
   {
-    mAlgorithmParameters.write(stream);
+    getListOfAlgorithmParameters()->write(stream);
   }
 
   if (getNumDataDescriptions() > 0)
   {
-    mDataDescriptions.write(stream);
+    getListOfDataDescriptions()->write(stream);
   }
 
   if (getNumModels() > 0)
   {
-    mModels.write(stream);
+    getListOfModels()->write(stream);
   }
 
   if (getNumSimulations() > 0)
   {
-    mSimulations.write(stream);
+    getListOfSimulations()->write(stream);
   }
 
   if (getNumTasks() > 0)
   {
-    mAbstractTasks.write(stream);
+    getListOfTasks()->write(stream);
   }
 
   if (getNumDataGenerators() > 0)
   {
-    mDataGenerators.write(stream);
+    getListOfDataGenerators()->write(stream);
   }
 
   if (getNumOutputs() > 0)
   {
-    mOutputs.write(stream);
+    getListOfOutputs()->write(stream);
   }
 
   if (getNumStyles() > 0)
   {
-    mStyles.write(stream);
+    getListOfStyles()->write(stream);
   }
 }
 
@@ -2607,200 +3694,585 @@ SedDocument::removeChildObject(const std::string& elementName,
   }
   else if (elementName == "plot3D")
   {
-    return removeOutput(id);
+    return removeOutput(id);
+  }
+  else if (elementName == "figure")
+  {
+    return removeOutput(id);
+  }
+  else if (elementName == "parameterEstimationResultPlot")
+  {
+    return removeOutput(id);
+  }
+  else if (elementName == "style")
+  {
+    return removeStyle(id);
+  }
+
+  return NULL;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns the number of "elementName" in this SedDocument.
+ */
+unsigned int
+SedDocument::getNumObjects(const std::string& elementName)
+{
+  unsigned int n = 0;
+
+  if (elementName == "algorithmParameter")
+  {
+    return getNumAlgorithmParameters();
+  }
+  else if (elementName == "dataDescription")
+  {
+      return getNumDataDescriptions();
+  }
+  else if (elementName == "model")
+  {
+    return getNumModels();
+  }
+  else if (elementName == "simulation")
+  {
+    return getNumSimulations();
+  }
+  else if (elementName == "task")
+  {
+    return getNumTasks();
+  }
+  else if (elementName == "dataGenerator")
+  {
+    return getNumDataGenerators();
+  }
+  else if (elementName == "output")
+  {
+    return getNumOutputs();
+  }
+  else if (elementName == "style")
+  {
+    return getNumStyles();
+  }
+
+  return n;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns the nth object of "objectName" in this SedDocument.
+ */
+SedBase*
+SedDocument::getObject(const std::string& elementName, unsigned int index)
+{
+  SedBase* obj = NULL;
+
+  if (elementName == "algorithmParameter")
+  {
+    return getAlgorithmParameter(index);
+  }
+  else if (elementName == "dataDescription")
+  {
+    return getDataDescription(index);
+  }
+  else if (elementName == "model")
+  {
+    return getModel(index);
+  }
+  else if (elementName == "simulation")
+  {
+    return getSimulation(index);
+  }
+  else if (elementName == "task")
+  {
+    return getTask(index);
+  }
+  else if (elementName == "dataGenerator")
+  {
+    return getDataGenerator(index);
+  }
+  else if (elementName == "output")
+  {
+    return getOutput(index);
+  }
+  else if (elementName == "style")
+  {
+    return getStyle(index);
+  }
+
+  return obj;
+}
+
+/** @endcond */
+
+
+/*
+ * Returns the first child element that has the given @p id in the model-wide
+ * SId namespace, or @c NULL if no such object is found.
+ */
+SedBase*
+SedDocument::getElementBySId(const std::string& id)
+{
+  const SedDocument& self = *this;
+  mCowSnapshot.reset();
+
+  // the caller may modify the element, which must not be a shared one
+  unshareElement(self.getElementBySId(id));
+
+  return const_cast<SedBase*>(self.getElementBySId(id));
+}
+
+
+/*
+ * Returns the first child element that has the given @p id in the model-wide
+ * SId namespace, or @c NULL if no such object is found.
+ */
+const SedBase*
+SedDocument::getElementBySId(const std::string& id) const
+{
+  if (id.empty())
+  {
+    return NULL;
   }
-  else if (elementName == "figure")
+
+  if (!mElementIndexValid)
   {
-    return removeOutput(id);
+    buildElementIndex();
   }
-  else if (elementName == "parameterEstimationResultPlot")
+
+  ElementIndex::const_iterator it = mSIdIndex.find(id);
+  return (it == mSIdIndex.end()) ? NULL : it->second;
+}
+
+
+/*
+ * Returns the first child element that has the given @p metaid, or @c NULL
+ * if no such object is found.
+ */
+SedBase*
+SedDocument::getElementByMetaId(const std::string& metaid)
+{
+  const SedDocument& self = *this;
+  mCowSnapshot.reset();
+
+  // the caller may modify the element, which must not be a shared one
+  unshareElement(self.getElementByMetaId(metaid));
+
+  return const_cast<SedBase*>(self.getElementByMetaId(metaid));
+}
+
+
+/*
+ * Returns the first child element that has the given @p metaid, or @c NULL
+ * if no such object is found.
+ */
+const SedBase*
+SedDocument::getElementByMetaId(const std::string& metaid) const
+{
+  if (metaid.empty())
   {
-    return removeOutput(id);
+    return NULL;
   }
-  else if (elementName == "style")
+
+  if (!mElementIndexValid)
   {
-    return removeStyle(id);
+    buildElementIndex();
   }
 
-  return NULL;
+  ElementIndex::const_iterator it = mMetaIdIndex.find(metaid);
+  return (it == mMetaIdIndex.end()) ? NULL : it->second;
 }
 
-/** @endcond */
-
-
 
 /** @cond doxygenLibSEDMLInternal */
 
 /*
- * Returns the number of "elementName" in this SedDocument.
+ * Discards the SId/metaid index of this SedDocument.
  */
-unsigned int
-SedDocument::getNumObjects(const std::string& elementName)
+void
+SedDocument::invalidateElementIndex()
 {
-  unsigned int n = 0;
+  mSIdIndex.clear();
+  mMetaIdIndex.clear();
+  mSIdDuplicates.clear();
+  mMetaIdDuplicates.clear();
+  mElementIndexValid = false;
+}
 
-  if (elementName == "algorithmParameter")
-  {
-    return getNumAlgorithmParameters();
-  }
-  else if (elementName == "dataDescription")
+
+/*
+ * Adds the given element (not its descendants) to the SId/metaid index.
+ */
+void
+SedDocument::addToElementIndex(SedBase* element)
+{
+  if (!mElementIndexValid || element == NULL)
   {
-      return getNumDataDescriptions();
+    return;
   }
-  else if (elementName == "model")
+
+  // an element attached in the middle of the document may precede one
+  // already indexed under the same key; when their order cannot be told
+  // locally, the index is rebuilt later
+  if (!indexElement(element, false))
   {
-    return getNumModels();
+    invalidateElementIndex();
   }
-  else if (elementName == "simulation")
+}
+
+
+/*
+ * Removes the given element (not its descendants) from the SId/metaid
+ * index.
+ */
+void
+SedDocument::removeFromElementIndex(SedBase* element)
+{
+  if (!mElementIndexValid || element == NULL)
   {
-    return getNumSimulations();
+    return;
   }
-  else if (elementName == "task")
+
+  unindexElement(element, element->getId(),
+    static_cast<const SedBase*>(element)->getMetaId());
+}
+
+
+/*
+ * Informs the index that the id and/or metaid of the given element changed.
+ */
+void
+SedDocument::updateElementIndex(SedBase* element, const std::string& oldId,
+                                const std::string& oldMetaId)
+{
+  // effective styles are keyed by (and linked through) style ids
+  if (element != NULL && element->getTypeCode() == SEDML_STYLE)
   {
-    return getNumTasks();
+    clearEffectiveStyleCache();
   }
-  else if (elementName == "dataGenerator")
+
+  if (!mElementIndexValid || element == NULL)
   {
-    return getNumDataGenerators();
+    return;
   }
-  else if (elementName == "output")
+
+  unindexElement(element, oldId, oldMetaId);
+
+  if (!indexElement(element, false))
   {
-    return getNumOutputs();
+    invalidateElementIndex();
   }
-  else if (elementName == "style")
+}
+
+
+/*
+ * Removes the entries of an element that is being destroyed.
+ */
+void
+SedDocument::dropFromElementIndex(SedBase* element, const std::string& id,
+                                  const std::string& metaid)
+{
+  if (!mElementIndexValid)
   {
-    return getNumStyles();
+    return;
   }
 
-  return n;
+  unindexElement(element, id, metaid);
 }
 
-/** @endcond */
 
+/*
+ * Populates the SId/metaid index from a walk over the whole document.
+ */
+void
+SedDocument::buildElementIndex() const
+{
+  mSIdIndex.clear();
+  mMetaIdIndex.clear();
+  mSIdDuplicates.clear();
+  mMetaIdDuplicates.clear();
+
+  List* elements = collectElements(NULL);
+  if (elements != NULL)
+  {
+    while (elements->getSize() > 0)
+    {
+      indexElement(static_cast<SedBase*>(elements->remove(0)), true);
+    }
+    delete elements;
+  }
 
+  mElementIndexValid = true;
+}
 
-/** @cond doxygenLibSEDMLInternal */
 
 /*
- * Returns the nth object of "objectName" in this SedDocument.
+ * Adds a single element (not its children) to the SId/metaid index.
  */
-SedBase*
-SedDocument::getObject(const std::string& elementName, unsigned int index)
+bool
+SedDocument::indexElement(SedBase* element, bool inDocumentOrder) const
 {
-  SedBase* obj = NULL;
+  if (element == NULL)
+  {
+    return true;
+  }
 
-  if (elementName == "algorithmParameter")
+  bool known = true;
+
+  const std::string& id = element->getId();
+  if (!id.empty())
   {
-    return getAlgorithmParameter(index);
+    known = indexKey(mSIdIndex, mSIdDuplicates, id, element,
+                     inDocumentOrder);
   }
-  else if (elementName == "dataDescription")
+
+  const std::string& metaid =
+    static_cast<const SedBase*>(element)->getMetaId();
+  if (!metaid.empty())
   {
-    return getDataDescription(index);
+    known = indexKey(mMetaIdIndex, mMetaIdDuplicates, metaid, element,
+                     inDocumentOrder) && known;
   }
-  else if (elementName == "model")
+
+  return known;
+}
+
+
+/*
+ * Removes the entries for id and metaid if they refer to the element.
+ */
+void
+SedDocument::unindexElement(SedBase* element, const std::string& id,
+                            const std::string& metaid)
+{
+  if (!id.empty())
   {
-    return getModel(index);
+    unindexKey(mSIdIndex, mSIdDuplicates, id, element);
   }
-  else if (elementName == "simulation")
+
+  if (!metaid.empty())
   {
-    return getSimulation(index);
+    unindexKey(mMetaIdIndex, mMetaIdDuplicates, metaid, element);
   }
-  else if (elementName == "task")
+}
+
+
+/*
+ * Records the element as a holder of key.
+ */
+bool
+SedDocument::indexKey(ElementIndex& index, DuplicateIndex& duplicates,
+                      const std::string& key, SedBase* element,
+                      bool inDocumentOrder) const
+{
+  std::pair<ElementIndex::iterator, bool> res =
+    index.insert(std::make_pair(key, element));
+  if (res.second || res.first->second == element)
   {
-    return getTask(index);
+    return true;
   }
-  else if (elementName == "dataGenerator")
+
+  std::vector<SedBase*>& holders = duplicates[key];
+  if (holders.empty())
   {
-    return getDataGenerator(index);
+    holders.push_back(res.first->second);
   }
-  else if (elementName == "output")
+  else if (std::find(holders.begin(), holders.end(), element) !=
+           holders.end())
   {
-    return getOutput(index);
+    return true;
   }
-  else if (elementName == "style")
+
+  // elements are mostly attached at the end of their list, so the place of
+  // the new holder is searched from the back
+  std::vector<SedBase*>::iterator pos = holders.end();
+  while (!inDocumentOrder && pos != holders.begin())
   {
-    return getStyle(index);
+    int order = compareDocumentOrder(*(pos - 1), element);
+    if (order == 0)
+    {
+      return false;
+    }
+    if (order < 0)
+    {
+      break;
+    }
+    --pos;
   }
 
-  return obj;
+  holders.insert(pos, element);
+  res.first->second = holders.front();
+  return true;
 }
 
-/** @endcond */
-
 
 /*
- * Returns the first child element that has the given @p id in the model-wide
- * SId namespace, or @c NULL if no such object is found.
+ * Removes the element from the holders of key.
  */
-SedBase*
-SedDocument::getElementBySId(const std::string& id)
+void
+SedDocument::unindexKey(ElementIndex& index, DuplicateIndex& duplicates,
+                        const std::string& key, SedBase* element)
 {
-  if (id.empty())
+  DuplicateIndex::iterator dup = duplicates.find(key);
+  if (dup == duplicates.end())
   {
-    return NULL;
+    ElementIndex::iterator it = index.find(key);
+    if (it != index.end() && it->second == element)
+    {
+      index.erase(it);
+    }
+    return;
   }
 
-  SedBase* obj = NULL;
-
-  obj = mAlgorithmParameters.getElementBySId(id);
-
-  if (obj != NULL)
+  // the next holder in document order takes over the entry
+  std::vector<SedBase*>& holders = dup->second;
+  holders.erase(std::remove(holders.begin(), holders.end(), element),
+                holders.end());
+  if (holders.empty())
   {
-      return obj;
+    index.erase(key);
+    duplicates.erase(dup);
+    return;
   }
 
-  obj = mDataDescriptions.getElementBySId(id);
-
-  if (obj != NULL)
+  index[key] = holders.front();
+  if (holders.size() == 1)
   {
-    return obj;
+    duplicates.erase(dup);
   }
+}
 
-  obj = mModels.getElementBySId(id);
 
-  if (obj != NULL)
+/*
+ * Compares the positions of two distinct elements in document order.
+ */
+int
+SedDocument::compareDocumentOrder(const SedBase* a, const SedBase* b) const
+{
+  unsigned int depthA = 0;
+  for (const SedBase* p = a->getParentSedObject(); p != NULL;
+       p = p->getParentSedObject())
   {
-    return obj;
+    ++depthA;
   }
 
-  obj = mSimulations.getElementBySId(id);
+  unsigned int depthB = 0;
+  for (const SedBase* p = b->getParentSedObject(); p != NULL;
+       p = p->getParentSedObject())
+  {
+    ++depthB;
+  }
 
-  if (obj != NULL)
+  const SedBase* ancestorA = a;
+  for (; depthA > depthB; --depthA)
   {
-    return obj;
+    ancestorA = ancestorA->getParentSedObject();
   }
 
-  obj = mAbstractTasks.getElementBySId(id);
+  const SedBase* ancestorB = b;
+  for (; depthB > depthA; --depthB)
+  {
+    ancestorB = ancestorB->getParentSedObject();
+  }
 
-  if (obj != NULL)
+  // an element precedes its descendants
+  if (ancestorA == ancestorB)
   {
-    return obj;
+    return (ancestorA == a) ? -1 : 1;
   }
 
-  obj = mDataGenerators.getElementBySId(id);
+  while (ancestorA->getParentSedObject() != ancestorB->getParentSedObject())
+  {
+    ancestorA = ancestorA->getParentSedObject();
+    ancestorB = ancestorB->getParentSedObject();
+  }
 
-  if (obj != NULL)
+  const SedBase* parent = ancestorA->getParentSedObject();
+  if (parent == NULL)
   {
-    return obj;
+    // no common ancestor, as with items shared with a snapshot
+    return 0;
   }
 
-  obj = mOutputs.getElementBySId(id);
+  if (parent->getTypeCode() == SEDML_LIST_OF)
+  {
+    const SedListOf* list = static_cast<const SedListOf*>(parent);
+    for (unsigned int n = 0; n < list->size(); ++n)
+    {
+      const SedBase* item = list->get(n);
+      if (item == ancestorA)
+      {
+        return -1;
+      }
+      if (item == ancestorB)
+      {
+        return 1;
+      }
+    }
+    return 0;
+  }
 
-  if (obj != NULL)
+  if (parent == this)
   {
-    return obj;
+    // the lists of this document, in the order collectElements() uses
+    const SedListOf* lists[] = { &mAlgorithmParameters, &mDataDescriptions,
+      &mModels, &mSimulations, &mAbstractTasks, &mDataGenerators, &mOutputs,
+      &mStyles };
+    for (size_t n = 0; n < sizeof(lists) / sizeof(lists[0]); ++n)
+    {
+      if (lists[n] == ancestorA)
+      {
+        return -1;
+      }
+      if (lists[n] == ancestorB)
+      {
+        return 1;
+      }
+    }
+    return 0;
   }
 
-  obj = mStyles.getElementBySId(id);
+  if (parent->getTypeCode() == SEDML_DOCUMENT)
+  {
+    return 0;
+  }
 
-  if (obj != NULL)
+  // two children of an object that is no list (say, the variables and the
+  // parameters of a data generator): only its own elements are listed
+  int order = 0;
+  List* elements = const_cast<SedBase*>(parent)->getAllElements();
+  if (elements != NULL)
   {
-    return obj;
+    while (order == 0 && elements->getSize() > 0)
+    {
+      const SedBase* element =
+        static_cast<const SedBase*>(elements->remove(0));
+      if (element == ancestorA)
+      {
+        order = -1;
+      }
+      else if (element == ancestorB)
+      {
+        order = 1;
+      }
+    }
+    delete elements;
   }
 
-  return obj;
+  return order;
 }
 
+/** @endcond */
+
 
 /*
  * Returns a List of all child SedBase objects, including those nested to an
@@ -2808,22 +4280,46 @@ SedDocument::getElementBySId(const std::string& id)
  */
 List*
 SedDocument::getAllElements(SedElementFilter* filter)
+{
+  SedListOf* lists[] = { &mAlgorithmParameters, &mDataDescriptions,
+    &mModels, &mSimulations, &mAbstractTasks, &mDataGenerators, &mOutputs,
+    &mStyles };
+
+  // the caller may modify the elements, which must not be shared ones
+  mCowSnapshot.reset();
+  for (size_t i = 0; i < sizeof(lists) / sizeof(lists[0]); ++i)
+  {
+    lists[i]->unshareItems();
+  }
+
+  return collectElements(filter);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns all the elements of this document, reading shared items in place.
+ */
+List*
+SedDocument::collectElements(SedElementFilter* filter) const
 {
   List* ret = new List();
-  List* sublist = NULL;
 
-  SED_ADD_FILTERED_LIST(ret, sublist, mAlgorithmParameters, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mDataDescriptions, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mModels, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mSimulations, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mAbstractTasks, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mDataGenerators, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mOutputs, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mStyles, filter);
+  addListElements(ret, mAlgorithmParameters, filter);
+  addListElements(ret, mDataDescriptions, filter);
+  addListElements(ret, mModels, filter);
+  addListElements(ret, mSimulations, filter);
+  addListElements(ret, mAbstractTasks, filter);
+  addListElements(ret, mDataGenerators, filter);
+  addListElements(ret, mOutputs, filter);
+  addListElements(ret, mStyles, filter);
 
   return ret;
 }
 
+/** @endcond */
+
 
 /*
  * Returns the value of the "Namespaces" element of this SedDocument.
@@ -3039,6 +4535,60 @@ SedDocument::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Skips the top-level lists excluded by the load mask
+ */
+bool
+SedDocument::isSkippedOnRead(const std::string& name) const
+{
+  unsigned int flag = 0;
+
+  if (name == "listOfAlgorithmParameters")
+  {
+    flag = SEDML_LOAD_ALGORITHM_PARAMETERS;
+  }
+  else if (name == "listOfDataDescriptions")
+  {
+    flag = SEDML_LOAD_DATA_DESCRIPTIONS;
+  }
+  else if (name == "listOfModels")
+  {
+    flag = SEDML_LOAD_MODELS;
+  }
+  else if (name == "listOfSimulations")
+  {
+    flag = SEDML_LOAD_SIMULATIONS;
+  }
+  else if (name == "listOfTasks")
+  {
+    flag = SEDML_LOAD_TASKS;
+  }
+  else if (name == "listOfDataGenerators")
+  {
+    flag = SEDML_LOAD_DATA_GENERATORS;
+  }
+  else if (name == "listOfOutputs")
+  {
+    flag = SEDML_LOAD_OUTPUTS;
+  }
+  else if (name == "listOfStyles")
+  {
+    flag = SEDML_LOAD_STYLES;
+  }
+  else
+  {
+    return SedBase::isSkippedOnRead(name);
+  }
+
+  return (mLoadMask & flag) == 0;
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibSEDMLInternal */
 
 /*
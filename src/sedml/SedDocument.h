@@ -47,7 +47,11 @@
 #ifdef __cplusplus
 
 
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 
 #include <sedml/SedBase.h>
@@ -66,6 +70,9 @@
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
 
+class SedFrozenDocument;
+
+
 class LIBSEDML_EXTERN SedDocument : public SedBase
 {
 protected:
@@ -76,6 +83,45 @@ protected:
   bool mIsSetLevel;
   unsigned int mVersion;
   bool mIsSetVersion;
+
+  // document-wide lookup tables for SIds and metaids; they are declared
+  // before the child lists so that they outlive them during destruction.
+  // A key held by several elements maps to the first of them in document
+  // order, and all its holders are kept in that order in the matching
+  // table of duplicates
+  typedef std::unordered_map<std::string, SedBase*> ElementIndex;
+  typedef std::unordered_map<std::string, std::vector<SedBase*> >
+    DuplicateIndex;
+  mutable ElementIndex mSIdIndex;
+  mutable ElementIndex mMetaIdIndex;
+  mutable DuplicateIndex mSIdDuplicates;
+  mutable DuplicateIndex mMetaIdDuplicates;
+  mutable bool mElementIndexValid;
+
+  // effective styles by style id, and the ids of the styles whose chain
+  // of baseStyle references runs into a cycle, with whether that has been
+  // reported
+  typedef std::unordered_map<std::string, SedStyle*> StyleCache;
+  mutable StyleCache mEffectiveStyles;
+  mutable std::unordered_map<std::string, bool> mCyclicStyles;
+
+  // parts of the document built when it was read (SedLoadMask_t)
+  unsigned int mLoadMask;
+
+  // pool for the objects created in this document, or NULL (see
+  // setArenaAllocation())
+  SedArena* mArena;
+
+  // copy-on-write cloning (see setCopyOnWriteClone()): the snapshot of
+  // this document shared by its clones, discarded whenever this document
+  // is accessed through a non-const method, and the snapshot that owns
+  // the items this document shares (declared before the lists, so that it
+  // outlives them)
+  bool mCopyOnWriteClone;
+  mutable std::shared_ptr<const SedDocument> mCowSnapshot;
+  mutable std::mutex mCowMutex;
+  std::shared_ptr<const SedDocument> mCowSource;
+
   SedListOfAlgorithmParameters mAlgorithmParameters;
   SedListOfDataDescriptions mDataDescriptions;
   SedListOfModels mModels;
@@ -86,6 +132,8 @@ protected:
   SedListOfStyles mStyles;
   SedErrorLog mErrorLog;
 
+  friend class SedReferenceGraph;
+
   /** @endcond */
 
 public:
@@ -113,7 +161,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedDocument(SedNamespaces *sedmlns);
+  SedDocument(const SedNamespaces *sedmlns);
 
 
   /**
@@ -133,6 +181,29 @@ public:
   SedDocument& operator=(const SedDocument& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedDocument.
+   *
+   * The contents of @p orig, including its arena (see
+   * setArenaAllocation()), are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedDocument instance to move from.
+   */
+  SedDocument(SedDocument&& orig);
+
+
+  /**
+   * Move assignment operator for SedDocument.
+   *
+   * @param rhs the SedDocument object whose contents are moved into this
+   * object; it is left empty.
+   */
+  SedDocument& operator=(SedDocument&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedDocument object.
    *
@@ -377,6 +448,28 @@ public:
   int addAlgorithmParameter(const SedAlgorithmParameter* sap);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAlgorithmParameter to this SedDocument without copying it.
+   *
+   * @param sap the SedAlgorithmParameter object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addAlgorithmParameter(const SedAlgorithmParameter* sap)
+   */
+  int addAlgorithmParameter(std::unique_ptr<SedAlgorithmParameter> sap);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAlgorithmParameter objects in this SedDocument.
    *
@@ -600,6 +693,28 @@ public:
   int addDataDescription(const SedDataDescription* sdd);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedDataDescription to this SedDocument without copying it.
+   *
+   * @param sdd the SedDataDescription object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addDataDescription(const SedDataDescription* sdd)
+   */
+  int addDataDescription(std::unique_ptr<SedDataDescription> sdd);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedDataDescription objects in this SedDocument.
    *
@@ -822,6 +937,28 @@ public:
   int addModel(const SedModel* sm);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedModel to this SedDocument without copying it.
+   *
+   * @param sm the SedModel object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addModel(const SedModel* sm)
+   */
+  int addModel(std::unique_ptr<SedModel> sm);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedModel objects in this SedDocument.
    *
@@ -1044,6 +1181,28 @@ public:
   int addSimulation(const SedSimulation* ss);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSimulation to this SedDocument without copying it.
+   *
+   * @param ss the SedSimulation object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addSimulation(const SedSimulation* ss)
+   */
+  int addSimulation(std::unique_ptr<SedSimulation> ss);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSimulation objects in this SedDocument.
    *
@@ -1320,6 +1479,28 @@ public:
   int addTask(const SedAbstractTask* sat);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAbstractTask to this SedDocument without copying it.
+   *
+   * @param sat the SedAbstractTask object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addTask(const SedAbstractTask* sat)
+   */
+  int addTask(std::unique_ptr<SedAbstractTask> sat);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAbstractTask objects in this SedDocument.
    *
@@ -1581,6 +1762,28 @@ public:
   int addDataGenerator(const SedDataGenerator* sdg);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedDataGenerator to this SedDocument without copying it.
+   *
+   * @param sdg the SedDataGenerator object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addDataGenerator(const SedDataGenerator* sdg)
+   */
+  int addDataGenerator(std::unique_ptr<SedDataGenerator> sdg);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedDataGenerator objects in this SedDocument.
    *
@@ -1803,6 +2006,28 @@ public:
   int addOutput(const SedOutput* so);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedOutput to this SedDocument without copying it.
+   *
+   * @param so the SedOutput object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addOutput(const SedOutput* so)
+   */
+  int addOutput(std::unique_ptr<SedOutput> so);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedOutput objects in this SedDocument.
    *
@@ -2085,6 +2310,202 @@ public:
   SedStyle getEffectiveStyle(const std::string& sid) const;
 
 
+  /**
+   * Get the effective SedStyle from the SedDocument based on its identifier,
+   * without copying it.
+   *
+   * Effective styles are computed once and cached. The returned object is
+   * owned by this SedDocument and remains valid until any SedStyle, SedLine,
+   * SedMarker or SedFill of the document is changed, added or removed.
+   *
+   * If the "baseStyle" chain of the style is circular, a
+   * SedmlStyleBaseStyleMustNotBeCircular error is logged the first time
+   * this style is resolved, and @c NULL is returned.  This includes styles
+   * whose chain only leads into a cycle.
+   *
+   * @param sid a string representing the identifier of the SedStyle to
+   * retrieve.
+   *
+   * @return the effective SedStyle, or @c NULL if there is no style with
+   * the given identifier or its "baseStyle" chain is circular.
+   *
+   * @see getEffectiveStyle(const std::string& sid)
+   */
+  const SedStyle* getResolvedStyle(const std::string& sid) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Discards all cached effective styles.
+   */
+  void clearEffectiveStyleCache() const;
+
+  /** @endcond */
+
+
+  /**
+   * Returns the load mask this SedDocument was read with.
+   *
+   * Content excluded by the mask was skipped by SedReader and is absent
+   * from this SedDocument; documents that were not read from XML report
+   * @c SEDML_LOAD_ALL.
+   *
+   * @return a bitwise combination of @if clike #SedLoadMask_t@else the
+   * SEDML_LOAD_* constants@endif@~.
+   *
+   * @see SedReader::setLoadMask()
+   */
+  unsigned int getLoadMask() const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Sets the load mask used while reading this SedDocument.
+   */
+  void setLoadMask(unsigned int mask);
+
+  /** @endcond */
+
+
+  /**
+   * Sets whether the objects created in this SedDocument are allocated from
+   * a pool owned by the document.
+   *
+   * While enabled, the objects made by the create* methods of this
+   * SedDocument and of its descendants, and by SedReader while reading it,
+   * take their memory from large chunks rather than from one heap
+   * allocation each.  That memory is returned in bulk once the SedDocument
+   * and all objects allocated for it are deleted; objects removed from the
+   * document remain valid and must still be deleted by the caller.  Memory
+   * of objects deleted earlier is not reused, so this suits documents that
+   * are mostly built or read and then used, rather than edited at length.
+   *
+   * @param enable @c true to allocate new objects from the pool, @c false
+   * to allocate them from the heap again.
+   *
+   * @copydetails doc_returns_one_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   *
+   * @see SedReader::setArenaAllocation()
+   */
+  int setArenaAllocation(bool enable);
+
+
+  /**
+   * Returns whether the objects created in this SedDocument are allocated
+   * from a pool owned by the document.
+   *
+   * @return @c true if arena allocation is enabled, @c false otherwise.
+   *
+   * @see setArenaAllocation(bool enable)
+   */
+  bool getArenaAllocation() const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Returns the SedArena objects created in this SedDocument come from, or
+   * @c NULL if arena allocation is disabled.
+   */
+  SedArena* getArena() const;
+
+  /** @endcond */
+
+
+  /**
+   * Sets whether clones of this SedDocument share its content until they
+   * are modified.
+   *
+   * While enabled, clone() and the copy constructor do not copy the
+   * elements of this SedDocument.  Instead, the first clone takes a single
+   * snapshot of them, which all later clones share.  A clone gets a copy
+   * of its own of a top-level element (such as a task, with everything in
+   * it) only when a non-const method returns that element or something in
+   * it, for instance getTask(), getElementBySId() or SedListOf::get(), as
+   * the caller may then modify it; the other elements remain shared.
+   * Reading through the const methods never copies anything.  This makes
+   * generating many variants of a template document cheap when each
+   * variant edits only a few elements.
+   *
+   * Everything the shared elements compute on first use (such as parsed
+   * notes and lookup indexes) is computed when the snapshot is taken, so
+   * clones may be read and modified on different threads.
+   *
+   * Elements returned by the const methods of a clone may be shared ones,
+   * which belong to the snapshot: their getSedDocument() and
+   * getParentSedObject() are those of the snapshot, which holds the same
+   * content as the clone except for the elements the clone copied.  Use
+   * the non-const methods where the clone itself has to be reached from
+   * an element.  Documents that were never cloned this way do not pay
+   * for any of this.
+   *
+   * The snapshot is renewed when this SedDocument is accessed through a
+   * non-const method, whether or not anything is modified: the next clone
+   * then copies the whole document once to take a new snapshot, which the
+   * clones after it share again.  Edit the template before cloning it in
+   * bulk, and read it through the const methods in between.  Objects of
+   * this SedDocument retrieved before a clone was taken and modified
+   * afterwards are not seen by later clones; call this method again to
+   * renew the snapshot in that case.
+   *
+   * Clones do not inherit this setting, but a clone of a clone shares the
+   * elements its original still shares.
+   *
+   * @param enable @c true to share content with clones, @c false to make
+   * clones deep copies again.
+   *
+   * @copydetails doc_returns_one_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   *
+   * @see getSharedLists()
+   */
+  int setCopyOnWriteClone(bool enable);
+
+
+  /**
+   * Returns whether clones of this SedDocument share its content until
+   * they are modified.
+   *
+   * @return @c true if copy-on-write cloning is enabled, @c false
+   * otherwise.
+   *
+   * @see setCopyOnWriteClone(bool enable)
+   */
+  bool getCopyOnWriteClone() const;
+
+
+  /**
+   * Returns the lists of this SedDocument that still share elements with
+   * the document it was cloned from.
+   *
+   * @return a bitwise combination of the @if clike #SedLoadMask_t@else
+   * SEDML_LOAD_* constants@endif@~ naming lists of this SedDocument, or
+   * @c 0 if it has a copy of each of its elements.
+   *
+   * @see setCopyOnWriteClone(bool enable)
+   */
+  unsigned int getSharedLists() const;
+
+
+  /**
+   * Returns a read-only snapshot of this SedDocument that any number of
+   * threads may read at the same time without locking.
+   *
+   * The snapshot holds its own copy of the document, with all indexes and
+   * caches computed up front; later changes to this SedDocument do not
+   * affect it.
+   *
+   * @return a new SedFrozenDocument; the caller owns the returned object
+   * and is responsible for deleting it.
+   *
+   * @see SedFrozenDocument
+   */
+  SedFrozenDocument* freeze() const;
+
+
   /**
    * Get a SedStyle from the SedDocument based on the BaseStyle to which it
    * refers.
@@ -2141,6 +2562,28 @@ public:
   int addStyle(const SedStyle* ss);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedStyle to this SedDocument without copying it.
+   *
+   * @param ss the SedStyle object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addStyle(const SedStyle* ss)
+   */
+  int addStyle(std::unique_ptr<SedStyle> ss);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedStyle objects in this SedDocument.
    *
@@ -2215,6 +2658,50 @@ public:
   SedStyle* removeStyle(const std::string& sid);
 
 
+  /**
+   * Returns the heap memory held by this SedDocument and all its elements,
+   * broken down by type.
+   *
+   * For a copy-on-write clone (see setCopyOnWriteClone()), the elements
+   * that are still shared with the original document are not included,
+   * since they do not belong to this document.
+   *
+   * @return a SedMemoryUsage with the number of objects and bytes per
+   * @if clike #SedTypeCode_t@else type code@endif.
+   *
+   * @see SedMemoryUsage
+   */
+  virtual SedMemoryUsage getMemoryUsage() const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::prepareForConcurrentReads
+   */
+  virtual void prepareForConcurrentReads() const;
+
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedDocument object.
    *
@@ -2640,6 +3127,85 @@ public:
   virtual SedBase* getElementBySId(const std::string& id);
 
 
+  /**
+   * Returns the first child element that has the given @p id in the model-wide
+   * SId namespace, or @c NULL if no such object is found.
+   *
+   * @param id a string representing the id attribute of the object to
+   * retrieve.
+   *
+   * @return a pointer to the SedBase element with the given @p id. If no such
+   * object is found, this method returns @c NULL.
+   */
+  virtual const SedBase* getElementBySId(const std::string& id) const;
+
+
+  /**
+   * Returns the first child element that has the given @p metaid, or @c NULL
+   * if no such object is found.
+   *
+   * @param metaid a string representing the metaid attribute of the object
+   * to retrieve.
+   *
+   * @return a pointer to the SedBase element with the given @p metaid. If no
+   * such object is found, this method returns @c NULL.
+   */
+  virtual SedBase* getElementByMetaId(const std::string& metaid);
+
+
+  /**
+   * Returns the first child element that has the given @p metaid, or @c NULL
+   * if no such object is found.
+   *
+   * @param metaid a string representing the metaid attribute of the object
+   * to retrieve.
+   *
+   * @return a pointer to the SedBase element with the given @p metaid. If no
+   * such object is found, this method returns @c NULL.
+   */
+  virtual const SedBase* getElementByMetaId(const std::string& metaid) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Discards the SId/metaid index of this SedDocument; it is rebuilt on the
+   * next call to getElementBySId() or getElementByMetaId().
+   */
+  void invalidateElementIndex();
+
+
+  /**
+   * Adds the given element (not its descendants) to the SId/metaid index.
+   * SedBase::setSedDocument() calls it for every element it reaches.
+   */
+  void addToElementIndex(SedBase* element);
+
+
+  /**
+   * Removes the given element (not its descendants) from the SId/metaid
+   * index.
+   */
+  void removeFromElementIndex(SedBase* element);
+
+
+  /**
+   * Informs the index that the id and/or metaid of the given element changed
+   * from @p oldId and @p oldMetaId.
+   */
+  void updateElementIndex(SedBase* element, const std::string& oldId,
+                          const std::string& oldMetaId);
+
+
+  /**
+   * Removes the entries of an element that is being destroyed.
+   */
+  void dropFromElementIndex(SedBase* element, const std::string& id,
+                            const std::string& metaid);
+
+  /** @endcond */
+
+
   /**
    * Returns the value of the "Namespaces" element of this SedDocument.
    *
@@ -2755,6 +3321,108 @@ public:
 protected:
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Populates the SId/metaid index from a walk over the whole document.
+   */
+  void buildElementIndex() const;
+
+
+  /**
+   * Returns all the elements of this document, reading lists shared with
+   * another document in place.
+   */
+  List* collectElements(SedElementFilter* filter) const;
+
+
+  /**
+   * Returns the snapshot of the elements of this document shared by its
+   * copy-on-write clones, taking it if needed.
+   */
+  std::shared_ptr<const SedDocument> getCopyOnWriteSnapshot() const;
+
+
+  /**
+   * Makes the items of each list of this document those of the same list
+   * of @p source, copying or sharing them (see SedListOf::copySharing()).
+   */
+  void copyListsSharing(const SedDocument& source);
+
+
+  /**
+   * Lets the lists of this newly taken snapshot lend their items and
+   * builds the lazily computed state of all its elements.
+   */
+  void prepareCopyOnWriteSnapshot();
+
+
+  /**
+   * Replaces the shared item that @p element is in (or is) by a copy of
+   * its own, if @p element is a shared one.
+   */
+  void unshareElement(const SedBase* element);
+
+
+  /**
+   * Adds a single element (not its children) to the SId/metaid index.
+   * Unless @p inDocumentOrder is @c true, its place among the other holders
+   * of its keys is looked up; returns @c false if that cannot be told.
+   */
+  bool indexElement(SedBase* element, bool inDocumentOrder) const;
+
+
+  /**
+   * Removes the entries for @p id and @p metaid if they refer to @p element.
+   */
+  void unindexElement(SedBase* element, const std::string& id,
+                      const std::string& metaid);
+
+
+  /**
+   * Records @p element as a holder of @p key in @p index and, if the key
+   * has several holders, in @p duplicates.  Returns @c false if the place of
+   * the element among the other holders cannot be told.
+   */
+  bool indexKey(ElementIndex& index, DuplicateIndex& duplicates,
+                const std::string& key, SedBase* element,
+                bool inDocumentOrder) const;
+
+
+  /**
+   * Removes @p element from the holders of @p key; the next holder in
+   * document order, if any, takes over the entry of @p index.
+   */
+  void unindexKey(ElementIndex& index, DuplicateIndex& duplicates,
+                  const std::string& key, SedBase* element);
+
+
+  /**
+   * Returns a negative number if @p a comes before @p b in document order,
+   * a positive one if it comes after it, and 0 if that cannot be told from
+   * their ancestors (for instance for items shared with a snapshot).
+   */
+  int compareDocumentOrder(const SedBase* a, const SedBase* b) const;
+
+
+  /**
+   * Computes (or fetches from the cache) the effective style @p sid;
+   * @p chain holds the styles currently being resolved.
+   */
+  const SedStyle* resolveStyle(const std::string& sid,
+                               std::vector<std::string>& chain,
+                               bool& cycle) const;
+
+
+  /**
+   * Overrides the attributes of @p base with those set on @p top.
+   */
+  static void mergeStyle(SedStyle& base, const SedStyle& top);
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibSEDMLInternal */
 
   /**
@@ -2767,6 +3435,17 @@ protected:
 
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Skips the top-level lists excluded by the load mask
+   */
+  virtual bool isSkippedOnRead(const std::string& name) const;
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibSEDMLInternal */
 
   /**
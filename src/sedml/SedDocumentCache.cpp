@@ -0,0 +1,600 @@
+/**
+ * @file SedDocumentCache.cpp
+ * @brief Implementation of the SedDocumentCache class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <thread>
+
+#include <sbml/util/util.h>
+
+#include <sedml/SedDocument.h>
+#include <sedml/SedReader.h>
+#include <sedml/SedBinaryReader.h>
+#include <sedml/SedBinaryWriter.h>
+#include <sedml/SedDocumentCache.h>
+#include <sedml/common/SedMappedFile.h>
+
+/** @cond doxygenIgnored */
+
+using namespace std;
+
+/** @endcond */
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+#ifdef __cplusplus
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * MurmurHash64A by Austin Appleby (public domain): fast, and good enough
+ * to tell the contents of files apart.
+ */
+static unsigned long long
+hashBytes(const char* data, size_t length, unsigned long long seed)
+{
+  const unsigned long long m = 0xc6a4a7935bd1e995ULL;
+  const int r = 47;
+
+  unsigned long long h = seed ^ (length * m);
+
+  const size_t blocks = length / 8;
+  for (size_t i = 0; i < blocks; ++i)
+  {
+    unsigned long long k;
+    memcpy(&k, data + i * 8, sizeof(k));
+
+    k *= m;
+    k ^= k >> r;
+    k *= m;
+
+    h ^= k;
+    h *= m;
+  }
+
+  const unsigned char* tail =
+    reinterpret_cast<const unsigned char*>(data + blocks * 8);
+
+  switch (length & 7)
+  {
+  case 7: h ^= static_cast<unsigned long long>(tail[6]) << 48; // fall through
+  case 6: h ^= static_cast<unsigned long long>(tail[5]) << 40; // fall through
+  case 5: h ^= static_cast<unsigned long long>(tail[4]) << 32; // fall through
+  case 4: h ^= static_cast<unsigned long long>(tail[3]) << 24; // fall through
+  case 3: h ^= static_cast<unsigned long long>(tail[2]) << 16; // fall through
+  case 2: h ^= static_cast<unsigned long long>(tail[1]) << 8;  // fall through
+  case 1: h ^= static_cast<unsigned long long>(tail[0]);
+          h *= m;
+  default: break;
+  }
+
+  h ^= h >> r;
+  h *= m;
+  h ^= h >> r;
+
+  return h;
+}
+
+
+/*
+ * Returns true if data starts like a file libSBML would have to
+ * decompress: gzip, zip or bzip2.
+ */
+static bool
+isCompressedContent(const char* data, size_t length)
+{
+  return (length >= 2 && memcmp(data, "\x1f\x8b", 2) == 0) ||
+         (length >= 4 && memcmp(data, "PK\x03\x04", 4) == 0) ||
+         (length >= 3 && memcmp(data, "BZh", 3) == 0);
+}
+
+
+/*
+ * Stores d in binary form at path.  The data is written to a temporary
+ * file that is then renamed, so that readers in other processes never see
+ * a partly written file; failures are ignored, as the document can always
+ * be parsed again.
+ */
+static void
+writeToDisk(const SedDocument* d, const std::string& path)
+{
+  static std::atomic<unsigned long> counter(0);
+
+  const std::string temp = path + "." +
+    std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()))
+    + "." + std::to_string(
+      std::chrono::steady_clock::now().time_since_epoch().count())
+    + "." + std::to_string(counter++) + ".tmp";
+
+  SedBinaryWriter writer;
+  const std::string data = writer.writeSedMLToStdString(d);
+
+  std::ofstream stream(temp.c_str(), ios_base::out | ios_base::binary);
+  stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+  stream.close();
+
+  if (!stream || std::rename(temp.c_str(), path.c_str()) != 0)
+  {
+    std::remove(temp.c_str());
+  }
+}
+
+/** @endcond */
+
+
+/*
+ * Creates a new, empty SedDocumentCache.
+ */
+SedDocumentCache::SedDocumentCache(size_t maxBytes)
+  : mMutex ()
+  , mEntries ()
+  , mIndex ()
+  , mBytes (0)
+  , mMaxBytes (maxBytes)
+  , mLoadMask (SEDML_LOAD_ALL)
+  , mArenaAllocation (false)
+  , mDiskCacheDirectory ()
+  , mHits (0)
+  , mDiskHits (0)
+  , mMisses (0)
+  , mEvictions (0)
+{
+}
+
+
+/*
+ * Destroys this SedDocumentCache.
+ */
+SedDocumentCache::~SedDocumentCache()
+{
+}
+
+
+/*
+ * Reads the SED-ML file filename, from the cache if possible; the file is
+ * hashed from a memory mapping where possible.
+ */
+SedDocument*
+SedDocumentCache::readSedMLFromFile(const std::string& filename)
+{
+  SedMappedFile mapped(filename);
+
+  if (mapped.getData() != NULL)
+  {
+    return read(mapped.getData(), mapped.getSize(), &filename);
+  }
+
+  std::ifstream stream(filename.c_str(), ios_base::in | ios_base::binary);
+
+  if (!stream.is_open())
+  {
+    // let SedReader report the problem
+    SedReader reader;
+    reader.setLoadMask(getLoadMask());
+    return reader.readSedMLFromFile(filename);
+  }
+
+  const std::string data((std::istreambuf_iterator<char>(stream)),
+                         std::istreambuf_iterator<char>());
+  return read(data.c_str(), data.size(), &filename);
+}
+
+
+/*
+ * Reads a SED-ML document from a string, from the cache if possible.
+ */
+SedDocument*
+SedDocumentCache::readSedMLFromString(const std::string& xml)
+{
+  return read(xml.c_str(), xml.size(), NULL);
+}
+
+
+/*
+ * Sets the load mask documents are read with.
+ */
+void
+SedDocumentCache::setLoadMask(unsigned int mask)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mLoadMask = mask;
+}
+
+
+/*
+ * Returns the load mask documents are read with.
+ */
+unsigned int
+SedDocumentCache::getLoadMask() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mLoadMask;
+}
+
+
+/*
+ * Sets whether parsed documents allocate their objects from a pool.
+ */
+void
+SedDocumentCache::setArenaAllocation(bool enable)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mArenaAllocation = enable;
+}
+
+
+/*
+ * Returns whether parsed documents allocate their objects from a pool.
+ */
+bool
+SedDocumentCache::getArenaAllocation() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mArenaAllocation;
+}
+
+
+/*
+ * Sets the memory budget, evicting documents until they fit.
+ */
+void
+SedDocumentCache::setMaxBytes(size_t maxBytes)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mMaxBytes = maxBytes;
+  evict();
+}
+
+
+/*
+ * Returns the memory budget.
+ */
+size_t
+SedDocumentCache::getMaxBytes() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mMaxBytes;
+}
+
+
+/*
+ * Sets the directory in which documents are also cached in binary form.
+ */
+void
+SedDocumentCache::setDiskCacheDirectory(const std::string& directory)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mDiskCacheDirectory = directory;
+}
+
+
+/*
+ * Returns the directory in which documents are also cached in binary form.
+ */
+std::string
+SedDocumentCache::getDiskCacheDirectory() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mDiskCacheDirectory;
+}
+
+
+/*
+ * Returns the number of documents held in memory.
+ */
+size_t
+SedDocumentCache::getNumEntries() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mEntries.size();
+}
+
+
+/*
+ * Returns the memory held by the cached documents.
+ */
+size_t
+SedDocumentCache::getBytes() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mBytes;
+}
+
+
+/*
+ * Returns the number of reads answered from memory.
+ */
+unsigned long
+SedDocumentCache::getNumHits() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mHits;
+}
+
+
+/*
+ * Returns the number of reads answered from the disk cache directory.
+ */
+unsigned long
+SedDocumentCache::getNumDiskHits() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mDiskHits;
+}
+
+
+/*
+ * Returns the number of reads that had to parse XML.
+ */
+unsigned long
+SedDocumentCache::getNumMisses() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mMisses;
+}
+
+
+/*
+ * Returns the number of documents evicted to stay within the budget.
+ */
+unsigned long
+SedDocumentCache::getNumEvictions() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mEvictions;
+}
+
+
+/*
+ * Sets the hit, miss and eviction counts back to zero.
+ */
+void
+SedDocumentCache::resetStatistics()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mHits = 0;
+  mDiskHits = 0;
+  mMisses = 0;
+  mEvictions = 0;
+}
+
+
+/*
+ * Removes all documents from memory.
+ */
+void
+SedDocumentCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mEntries.clear();
+  mIndex.clear();
+  mBytes = 0;
+}
+
+
+/*
+ * Returns the key under which content read with loadMask is cached.
+ */
+std::string
+SedDocumentCache::getContentKey(const std::string& content,
+                                unsigned int loadMask)
+{
+  return getContentKey(content.data(), content.size(), loadMask);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Two hashes with different seeds make up the 128 bit key; the load mask
+ * is folded into the seeds.
+ */
+std::string
+SedDocumentCache::getContentKey(const char* data, size_t length,
+                                unsigned int loadMask)
+{
+  const unsigned long long high =
+    hashBytes(data, length, 0x9e3779b97f4a7c15ULL ^ loadMask);
+  const unsigned long long low =
+    hashBytes(data, length, 0xc2b2ae3d27d4eb4fULL ^ loadMask);
+
+  char key[33];
+  snprintf(key, sizeof(key), "%016llx%016llx", high, low);
+  return key;
+}
+
+
+/*
+ * Looks the content up in memory, then on disk, and parses it if it is in
+ * neither.  The caller gets the document that was loaded; the cache keeps
+ * a copy-on-write clone of it, which shares a snapshot of its content
+ * with the copies handed out later.  Everything the snapshot builds
+ * lazily is built when it is taken, so that the copies never modify it
+ * and may be used on different threads.  The lock is not held while
+ * loading, so that several documents can be loaded at once; if the same
+ * content is loaded twice meanwhile, the first copy to arrive is kept.
+ */
+SedDocument*
+SedDocumentCache::read(const char* data, size_t length,
+                       const std::string* filename)
+{
+  unsigned int mask;
+  bool arena;
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mask = mLoadMask;
+    arena = mArenaAllocation;
+    directory = mDiskCacheDirectory;
+  }
+
+  const std::string key = getContentKey(data, length, mask);
+  std::shared_ptr<const SedDocument> cached;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::unordered_map<std::string, EntryList::iterator>::iterator found =
+      mIndex.find(key);
+    if (found != mIndex.end())
+    {
+      mEntries.splice(mEntries.begin(), mEntries, found->second);
+      cached = found->second->document;
+      ++mHits;
+    }
+  }
+
+  if (cached)
+  {
+    return cached->clone();
+  }
+
+  SedDocument* d = NULL;
+  bool fromDisk = false;
+  std::string path;
+
+  if (!directory.empty())
+  {
+    path = directory + "/" + key + ".sedmlb";
+
+    if (util_file_exists(path.c_str()))
+    {
+      SedBinaryReader reader;
+      reader.setArenaAllocation(arena);
+      d = reader.readSedML(path);
+
+      if (d == NULL || d->getNumErrors() != 0)
+      {
+        delete d;
+        d = NULL;
+      }
+      else
+      {
+        fromDisk = true;
+      }
+    }
+  }
+
+  if (d == NULL)
+  {
+    SedReader reader;
+    reader.setLoadMask(mask);
+    reader.setArenaAllocation(arena);
+
+    // data is null-terminated: it is a std::string or a memory mapping
+    d = (filename != NULL && isCompressedContent(data, length))
+      ? reader.readSedMLFromFile(*filename)
+      : reader.readSedMLFromBuffer(data);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    ++(fromDisk ? mDiskHits : mMisses);
+  }
+
+  if (d == NULL || d->getNumErrors() != 0)
+  {
+    return d;
+  }
+
+  if (!fromDisk && !path.empty())
+  {
+    writeToDisk(d, path);
+  }
+
+  const size_t bytes = d->getMemoryUsage().getTotalBytes();
+  d->setCopyOnWriteClone(true);
+  std::shared_ptr<const SedDocument> shell(d->clone());
+  d->setCopyOnWriteClone(false);
+
+  insert(key, shell, bytes);
+  return d;
+}
+
+
+/*
+ * Adds a document to the front of the list, unless it is too large or
+ * already there.
+ */
+void
+SedDocumentCache::insert(const std::string& key,
+                         const std::shared_ptr<const SedDocument>& document,
+                         size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  if (bytes > mMaxBytes || mIndex.find(key) != mIndex.end())
+  {
+    return;
+  }
+
+  Entry entry;
+  entry.key = key;
+  entry.document = document;
+  entry.bytes = bytes;
+  mEntries.push_front(entry);
+  mIndex[key] = mEntries.begin();
+  mBytes += bytes;
+
+  evict();
+}
+
+
+/*
+ * Drops the least recently used documents until the rest fit the budget;
+ * the lock has to be held.
+ */
+void
+SedDocumentCache::evict()
+{
+  while (mBytes > mMaxBytes && !mEntries.empty())
+  {
+    const Entry& last = mEntries.back();
+    mBytes -= last.bytes;
+    mIndex.erase(last.key);
+    mEntries.pop_back();
+    ++mEvictions;
+  }
+}
+
+/** @endcond */
+
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
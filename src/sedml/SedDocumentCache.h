@@ -0,0 +1,342 @@
+/**
+ * @file SedDocumentCache.h
+ * @brief Definition of the SedDocumentCache class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedDocumentCache
+ * @sbmlbrief{} Cache of parsed SED-ML documents, keyed by their content.
+ *
+ * A SedDocumentCache reads SED-ML files like SedReader does, but keeps the
+ * documents it has read in memory, keyed by a hash of the content they
+ * were read from.  Reading the same content again, from the same file or
+ * any other, returns a copy of the cached document without parsing any
+ * XML; a file that has changed is parsed again.
+ *
+ * The copies are copy-on-write clones (see
+ * SedDocument::setCopyOnWriteClone()): they share the cached elements and
+ * copy only those they hand out through non-const methods, so that handing
+ * one out is cheap, and changes made to one are not seen by the cache or
+ * by other copies.  The shared elements are never modified by reading
+ * them, so copies may be used on different threads.  The cached documents
+ * are evicted least recently used first once their total size (see
+ * SedBase::getMemoryUsage()) exceeds the budget set with setMaxBytes().
+ *
+ * With a disk cache directory set (see setDiskCacheDirectory()), the
+ * documents are also stored there in the binary form written by
+ * SedBinaryWriter, so that other processes, and this one after an
+ * eviction or a restart, can load them without parsing XML either.
+ *
+ * Only documents read without any error or warning are cached, as the
+ * copies do not carry the error log of the document they were made from.
+ * Other documents are returned as read, and read again every time.
+ *
+ * All methods of a SedDocumentCache may be called from several threads at
+ * once.  The hash used as the key is not cryptographic; the cache is not
+ * meant to hold content from untrusted sources that may be crafted to
+ * collide.
+ */
+
+
+#ifndef SedDocumentCache_h
+#define SedDocumentCache_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedDocument;
+
+
+class LIBSEDML_EXTERN SedDocumentCache
+{
+public:
+
+  /**
+   * Creates a new, empty SedDocumentCache.
+   *
+   * @param maxBytes the memory budget for the cached documents, in bytes;
+   * the default is 256 MiB.
+   */
+  SedDocumentCache(size_t maxBytes = 256 * 1024 * 1024);
+
+
+  /**
+   * Destroys this SedDocumentCache.  Documents returned by it stay valid.
+   */
+  ~SedDocumentCache();
+
+
+  /**
+   * Reads the SED-ML file @p filename, from the cache if its content has
+   * been read before.
+   *
+   * @param filename the name or full pathname of the file to be read.
+   *
+   * @return a pointer to a SedDocument owned by the caller.  Problems
+   * encountered while reading the file are recorded in its error log.
+   *
+   * @see SedReader::readSedMLFromFile(const std::string& filename)
+   */
+  SedDocument* readSedMLFromFile(const std::string& filename);
+
+
+  /**
+   * Reads a SED-ML document from a string, from the cache if the same
+   * content has been read before.
+   *
+   * @param xml a string containing a full SED-ML document.
+   *
+   * @return a pointer to a SedDocument owned by the caller.
+   *
+   * @see SedReader::readSedMLFromString(const std::string& xml)
+   */
+  SedDocument* readSedMLFromString(const std::string& xml);
+
+
+  /**
+   * Sets the load mask documents are read with; see
+   * SedReader::setLoadMask().  Documents read with different masks are
+   * cached separately.
+   *
+   * @param mask a bitwise combination of @if clike #SedLoadMask_t@else the
+   * SEDML_LOAD_* constants@endif@~; the default is @c SEDML_LOAD_ALL.
+   */
+  void setLoadMask(unsigned int mask);
+
+
+  /**
+   * Returns the load mask documents are read with.
+   *
+   * @return the bitwise combination of @if clike #SedLoadMask_t@else the
+   * SEDML_LOAD_* constants@endif@~ selecting the content that is built.
+   */
+  unsigned int getLoadMask() const;
+
+
+  /**
+   * Sets whether documents parsed by this SedDocumentCache allocate their
+   * objects from a pool; see SedReader::setArenaAllocation().
+   *
+   * @param enable @c true to read documents into a pool; the default is
+   * @c false.
+   */
+  void setArenaAllocation(bool enable);
+
+
+  /**
+   * Returns whether documents parsed by this SedDocumentCache allocate
+   * their objects from a pool.
+   *
+   * @return @c true if arena allocation is enabled, @c false otherwise.
+   */
+  bool getArenaAllocation() const;
+
+
+  /**
+   * Sets the memory budget for the cached documents, evicting documents
+   * until they fit.  A document larger than the budget is not cached.
+   *
+   * @param maxBytes the memory budget in bytes.
+   */
+  void setMaxBytes(size_t maxBytes);
+
+
+  /**
+   * Returns the memory budget for the cached documents.
+   *
+   * @return the memory budget in bytes.
+   */
+  size_t getMaxBytes() const;
+
+
+  /**
+   * Sets the directory in which documents are also cached in binary form.
+   *
+   * The directory has to exist; it may be shared by several processes.
+   * The files in it are named after the hash of the content they were read
+   * from and are never removed by the cache.
+   *
+   * @param directory the directory, or an empty string to only cache
+   * documents in memory (the default).
+   */
+  void setDiskCacheDirectory(const std::string& directory);
+
+
+  /**
+   * Returns the directory in which documents are also cached in binary
+   * form.
+   *
+   * @return the directory, or an empty string if documents are only
+   * cached in memory.
+   */
+  std::string getDiskCacheDirectory() const;
+
+
+  /**
+   * Returns the number of documents held in memory.
+   *
+   * @return the number of cached documents.
+   */
+  size_t getNumEntries() const;
+
+
+  /**
+   * Returns the memory held by the cached documents.
+   *
+   * @return the total size of the cached documents in bytes.
+   */
+  size_t getBytes() const;
+
+
+  /**
+   * Returns the number of reads answered from memory.
+   *
+   * @return the number of reads that found their document in memory.
+   */
+  unsigned long getNumHits() const;
+
+
+  /**
+   * Returns the number of reads answered from the disk cache directory.
+   *
+   * @return the number of reads that loaded their document in binary form.
+   */
+  unsigned long getNumDiskHits() const;
+
+
+  /**
+   * Returns the number of reads that had to parse XML.
+   *
+   * @return the number of reads that found their document in neither
+   * memory nor the disk cache directory.
+   */
+  unsigned long getNumMisses() const;
+
+
+  /**
+   * Returns the number of documents evicted to stay within the memory
+   * budget.
+   *
+   * @return the number of evicted documents.
+   */
+  unsigned long getNumEvictions() const;
+
+
+  /**
+   * Sets the hit, miss and eviction counts back to zero.
+   */
+  void resetStatistics();
+
+
+  /**
+   * Removes all documents from memory; the disk cache directory is left
+   * as it is.
+   */
+  void clear();
+
+
+  /**
+   * Returns the key under which content read with the given load mask is
+   * cached: 32 hexadecimal digits of a 128 bit hash.  Documents cached on
+   * disk are stored in files with this name and the extension
+   * @c ".sedmlb".
+   *
+   * @param content the content of a SED-ML file.
+   *
+   * @param loadMask the load mask the content is read with.
+   *
+   * @return the key.
+   */
+  static std::string getContentKey(const std::string& content,
+                                   unsigned int loadMask);
+
+
+private:
+  /** @cond doxygenLibSEDMLInternal */
+
+  struct Entry
+  {
+    std::string key;
+    std::shared_ptr<const SedDocument> document;
+    size_t bytes;
+  };
+
+  typedef std::list<Entry> EntryList;
+
+  SedDocumentCache(const SedDocumentCache&);
+  SedDocumentCache& operator=(const SedDocumentCache&);
+
+  static std::string getContentKey(const char* data, size_t length,
+                                   unsigned int loadMask);
+
+  SedDocument* read(const char* data, size_t length,
+                    const std::string* filename);
+  void insert(const std::string& key,
+              const std::shared_ptr<const SedDocument>& document,
+              size_t bytes);
+  void evict();
+
+  mutable std::mutex mMutex;
+  EntryList mEntries;
+  std::unordered_map<std::string, EntryList::iterator> mIndex;
+  size_t mBytes;
+  size_t mMaxBytes;
+  unsigned int mLoadMask;
+  bool mArenaAllocation;
+  std::string mDiskCacheDirectory;
+  unsigned long mHits;
+  unsigned long mDiskHits;
+  unsigned long mMisses;
+  unsigned long mEvictions;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedDocumentCache_h */
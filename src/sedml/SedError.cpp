@@ -122,7 +122,7 @@ std::string SedError::stringForSeverity(unsigned int code) const
  * A similar table for severity strings is currently unnecessary because
  * libSEDML never returns anything more than the XMLSeverityCode_t values.
  */
-static struct sedmlCategoryString {
+static const struct sedmlCategoryString {
   unsigned int catCode;
   const char * catString;
 } sedmlCategoryStringTable[] = 
@@ -134,7 +134,7 @@ static struct sedmlCategoryString {
   { LIBSEDML_CAT_INTERNAL_CONSISTENCY,   "Internal consistency"        }
 };
 
-static unsigned int sedmlCategoryStringTableSize
+static const unsigned int sedmlCategoryStringTableSize
   = sizeof(sedmlCategoryStringTable)/sizeof(sedmlCategoryStringTable[0]);
 
 /*
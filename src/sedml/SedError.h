@@ -54,6 +54,7 @@ typedef enum
 , SedNotUTF8                               = 10001 /*!< File does not use UTF-8 encoding. */
 , SedUnrecognizedElement                   = 10002 /*!< Encountered unrecognized element. */
 , SedNotSchemaConformant                   = 10003 /*!< Document does not conform to the SED-ML XML schema. */
+, SedInvalidBinaryFormat                   = 10004 /*!< Data is not a valid binary SED-ML document. */
 , SedInvalidMathElement                    = 10201
 , SedMissingAnnotationNamespace            = 10401 /*!< Missing declaration of the XML namespace for the annotation. */
 , SedDuplicateAnnotationNamespaces         = 10402 /*!< Multiple annotations using the same XML namespace. */
@@ -415,6 +416,7 @@ typedef enum
 , SedmlStyleAllowedAttributes      = 25103
 , SedmlStyleAllowedElements      = 25104
 , SedmlStyleBaseStyleMustBeStyle      = 25105
+, SedmlStyleBaseStyleMustNotBeCircular      = 25106
 , SedmlLineAllowedCoreAttributes      = 25201
 , SedmlLineAllowedCoreElements      = 25202
 , SedmlLineAllowedAttributes      = 25203
@@ -112,6 +112,19 @@ static const sedmlErrorTableEntry sedmlErrorTable[] =
     }
   },
 
+  //10004
+  {
+    SedInvalidBinaryFormat,
+    "Invalid binary SED-ML document",
+    LIBSEDML_CAT_SEDML,
+    LIBSEDML_SEV_ERROR,
+    "A binary SED-ML document must start with the header written by "
+    "SedBinaryWriter, in a format version and byte order this copy of "
+    "libSEDML can read, and must not be truncated or otherwise corrupt.",
+    {""
+    }
+  },
+
   //10201
   {
     SedInvalidMathElement,
@@ -4408,6 +4421,18 @@ static const sedmlErrorTableEntry sedmlErrorTable[] =
     }
   },
 
+  // 25106
+  { SedmlStyleBaseStyleMustNotBeCircular,
+    "The 'baseStyle' references must not form a cycle.",
+    LIBSEDML_CAT_GENERAL_CONSISTENCY,
+    LIBSEDML_SEV_ERROR,
+    "Following the 'sedml:baseStyle' attributes of <style> objects from one "
+    "<style> to the next must never lead back to a <style> that was already "
+    "visited.",
+    { "L3V1 Sedml V1 Section"
+    }
+  },
+
   // 25201
   { SedmlLineAllowedCoreAttributes,
     "Core attributes allowed on <line>.",
@@ -0,0 +1,397 @@
+/**
+ * @file SedExecutionPlan.cpp
+ * @brief Implementation of the SedExecutionPlan class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedExecutionPlan.h>
+#include <sedml/SedDocument.h>
+#include <sedml/SedReferenceGraph.h>
+#include <sedml/SedResultStore.h>
+#include <sedml/SedVariable.h>
+#include <sedml/common/SedOperationReturnValues.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <string>
+#include <unordered_set>
+
+
+using namespace std;
+
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Creates a new, empty SedExecutionPlan.
+ */
+SedExecutionPlan::SedExecutionPlan()
+  : mDocument (NULL)
+  , mNodes ()
+  , mIndex ()
+{
+}
+
+
+/*
+ * Creates a new SedExecutionPlan for the given SedDocument.
+ */
+SedExecutionPlan::SedExecutionPlan(const SedDocument* doc)
+  : mDocument (NULL)
+  , mNodes ()
+  , mIndex ()
+{
+  build(doc);
+}
+
+
+/*
+ * Destructor for SedExecutionPlan.
+ */
+SedExecutionPlan::~SedExecutionPlan()
+{
+}
+
+
+/*
+ * Builds the plan for the given SedDocument.
+ */
+int
+SedExecutionPlan::build(const SedDocument* doc)
+{
+  clear();
+
+  if (doc == NULL)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  // the nodes in document order; mIndex maps to these positions until the
+  // nodes are sorted
+  vector<const SedBase*> elements;
+  for (unsigned int i = 0; i < doc->getNumModels(); ++i)
+  {
+    elements.push_back(doc->getModel(i));
+  }
+  for (unsigned int i = 0; i < doc->getNumTasks(); ++i)
+  {
+    elements.push_back(doc->getTask(i));
+  }
+  for (unsigned int i = 0; i < doc->getNumDataGenerators(); ++i)
+  {
+    elements.push_back(doc->getDataGenerator(i));
+  }
+  for (unsigned int i = 0; i < doc->getNumOutputs(); ++i)
+  {
+    elements.push_back(doc->getOutput(i));
+  }
+
+  const unsigned int count = static_cast<unsigned int>(elements.size());
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    mIndex[elements[i]] = i;
+  }
+
+  vector<vector<unsigned int> > dependencies(count);
+  vector<vector<const SedVariable*> > variables(count);
+  vector<unordered_set<string> > keys(count);
+
+  SedReferenceGraph graph(doc);
+  for (unsigned int r = 0; r < graph.getNumReferences(); ++r)
+  {
+    const SedReference* reference = graph.getReference(r);
+    if (reference->target == NULL)
+    {
+      continue;
+    }
+
+    const int from = findNode(reference->referrer);
+    const int to = findNode(reference->target);
+    if (from < 0 || to < 0 || from == to)
+    {
+      continue;
+    }
+
+    dependencies[from].push_back(to);
+
+    const int type = reference->target->getTypeCode();
+    if (reference->attribute == "taskReference" &&
+        reference->referrer->getTypeCode() == SEDML_VARIABLE &&
+        (type == SEDML_TASK || type == SEDML_TASK_REPEATEDTASK ||
+         type == SEDML_TASK_PARAMETER_ESTIMATION))
+    {
+      const SedVariable* variable =
+        static_cast<const SedVariable*>(reference->referrer);
+      if (keys[to].insert(SedResultStore::getKey(variable)).second)
+      {
+        variables[to].push_back(variable);
+      }
+    }
+  }
+
+  vector<vector<unsigned int> > dependents(count);
+  vector<unsigned int> remaining(count);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    vector<unsigned int>& list = dependencies[i];
+    sort(list.begin(), list.end());
+    list.erase(unique(list.begin(), list.end()), list.end());
+
+    remaining[i] = static_cast<unsigned int>(list.size());
+    for (size_t k = 0; k < list.size(); ++k)
+    {
+      dependents[list[k]].push_back(i);
+    }
+  }
+
+  // Kahn's algorithm, taking the ready node that comes first in the
+  // document
+  priority_queue<unsigned int, vector<unsigned int>,
+                 greater<unsigned int> > ready;
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    if (remaining[i] == 0)
+    {
+      ready.push(i);
+    }
+  }
+
+  vector<unsigned int> order;
+  vector<unsigned int> position(count);
+  while (!ready.empty())
+  {
+    const unsigned int i = ready.top();
+    ready.pop();
+
+    position[i] = static_cast<unsigned int>(order.size());
+    order.push_back(i);
+
+    for (size_t k = 0; k < dependents[i].size(); ++k)
+    {
+      if (--remaining[dependents[i][k]] == 0)
+      {
+        ready.push(dependents[i][k]);
+      }
+    }
+  }
+
+  if (order.size() != count)
+  {
+    clear();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  mNodes.resize(count);
+  mIndex.clear();
+  for (unsigned int n = 0; n < count; ++n)
+  {
+    const unsigned int i = order[n];
+    Node& node = mNodes[n];
+
+    node.element = elements[i];
+    node.variables.swap(variables[i]);
+
+    for (size_t k = 0; k < dependencies[i].size(); ++k)
+    {
+      node.dependencies.push_back(position[dependencies[i][k]]);
+    }
+    for (size_t k = 0; k < dependents[i].size(); ++k)
+    {
+      node.dependents.push_back(position[dependents[i][k]]);
+    }
+    sort(node.dependencies.begin(), node.dependencies.end());
+    sort(node.dependents.begin(), node.dependents.end());
+
+    mIndex[node.element] = n;
+  }
+
+  mDocument = doc;
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Discards the plan.
+ */
+void
+SedExecutionPlan::clear()
+{
+  mDocument = NULL;
+  mNodes.clear();
+  mIndex.clear();
+}
+
+
+/*
+ * Returns the SedDocument the plan was built for.
+ */
+const SedDocument*
+SedExecutionPlan::getSedDocument() const
+{
+  return mDocument;
+}
+
+
+/*
+ * Returns the number of nodes of the plan.
+ */
+unsigned int
+SedExecutionPlan::getNumNodes() const
+{
+  return static_cast<unsigned int>(mNodes.size());
+}
+
+
+/*
+ * Returns the object of the nth node.
+ */
+const SedBase*
+SedExecutionPlan::getNode(unsigned int n) const
+{
+  return n < mNodes.size() ? mNodes[n].element : NULL;
+}
+
+
+/*
+ * Returns the index of the node of an object.
+ */
+int
+SedExecutionPlan::getNodeIndex(const SedBase* element) const
+{
+  unordered_map<const SedBase*, unsigned int>::const_iterator it =
+    mIndex.find(element);
+  return it != mIndex.end() ? static_cast<int>(it->second) : -1;
+}
+
+
+/*
+ * Returns the number of nodes the nth node depends on.
+ */
+unsigned int
+SedExecutionPlan::getNumDependencies(unsigned int n) const
+{
+  return n < mNodes.size()
+    ? static_cast<unsigned int>(mNodes[n].dependencies.size()) : 0;
+}
+
+
+/*
+ * Returns a node the nth node depends on.
+ */
+int
+SedExecutionPlan::getDependency(unsigned int n, unsigned int k) const
+{
+  if (n >= mNodes.size() || k >= mNodes[n].dependencies.size())
+  {
+    return -1;
+  }
+
+  return static_cast<int>(mNodes[n].dependencies[k]);
+}
+
+
+/*
+ * Returns the number of nodes that depend on the nth node.
+ */
+unsigned int
+SedExecutionPlan::getNumDependents(unsigned int n) const
+{
+  return n < mNodes.size()
+    ? static_cast<unsigned int>(mNodes[n].dependents.size()) : 0;
+}
+
+
+/*
+ * Returns a node that depends on the nth node.
+ */
+int
+SedExecutionPlan::getDependent(unsigned int n, unsigned int k) const
+{
+  if (n >= mNodes.size() || k >= mNodes[n].dependents.size())
+  {
+    return -1;
+  }
+
+  return static_cast<int>(mNodes[n].dependents[k]);
+}
+
+
+/*
+ * Returns the Variable objects whose results the task of the nth node
+ * produces.
+ */
+const vector<const SedVariable*>&
+SedExecutionPlan::getVariables(unsigned int n) const
+{
+  static const vector<const SedVariable*> none;
+  return n < mNodes.size() ? mNodes[n].variables : none;
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns the index of the node an object belongs to: its own, or that of
+ * its closest ancestor that has one.
+ */
+int
+SedExecutionPlan::findNode(const SedBase* element) const
+{
+  while (element != NULL)
+  {
+    const int index = getNodeIndex(element);
+    if (index >= 0)
+    {
+      return index;
+    }
+
+    element = element->getParentSedObject();
+  }
+
+  return -1;
+}
+
+/** @endcond */
+
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
@@ -0,0 +1,250 @@
+/**
+ * @file SedExecutionPlan.h
+ * @brief Definition of the SedExecutionPlan class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedExecutionPlan
+ * @sbmlbrief{} The objects of a SedDocument to execute, as a dependency
+ * graph.
+ *
+ * A SedExecutionPlan has a node for every Model, task, DataGenerator and
+ * Output of a SedDocument, and an edge from each to the nodes it refers
+ * to, as found by a SedReferenceGraph: a task depends on its model, a
+ * DataGenerator on the tasks of its variables, an Output on its data
+ * generators and a Figure on its plots.  A SedRepeatedTask depends on the
+ * tasks of its SubTask children, so that tasks are run on their own before
+ * the repeated tasks that run them again.  References made by child
+ * objects, such as the Curve of a Plot2D, count for the node they belong
+ * to.
+ *
+ * Nodes are kept in an order in which every node comes after its
+ * dependencies, and otherwise in document order.  A SedScheduler runs the
+ * nodes in parallel as their dependencies complete.
+ *
+ * The plan is a snapshot: it holds plain pointers into the document and
+ * has to be rebuilt with build() after the document has been modified.
+ */
+
+
+#ifndef SedExecutionPlan_h
+#define SedExecutionPlan_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <unordered_map>
+#include <vector>
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedBase;
+class SedDocument;
+class SedVariable;
+
+
+class LIBSEDML_EXTERN SedExecutionPlan
+{
+public:
+
+  /**
+   * Creates a new, empty SedExecutionPlan.
+   */
+  SedExecutionPlan();
+
+
+  /**
+   * Creates a new SedExecutionPlan for the given SedDocument.
+   *
+   * @param doc the SedDocument to plan; if it contains a cycle the plan is
+   * left empty.
+   */
+  explicit SedExecutionPlan(const SedDocument* doc);
+
+
+  /**
+   * Destructor for SedExecutionPlan.
+   */
+  virtual ~SedExecutionPlan();
+
+
+  /**
+   * Builds the plan for the given SedDocument, discarding any previous
+   * one.
+   *
+   * @param doc the SedDocument to plan.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p doc is @c NULL, or its objects depend on each other in a cycle,
+   * as repeated tasks running each other do; the plan is then empty.
+   */
+  int build(const SedDocument* doc);
+
+
+  /**
+   * Discards the plan.
+   */
+  void clear();
+
+
+  /**
+   * Returns the SedDocument the plan was built for.
+   *
+   * @return the SedDocument, or @c NULL if the plan is empty.
+   */
+  const SedDocument* getSedDocument() const;
+
+
+  /**
+   * Returns the number of nodes of the plan.
+   *
+   * @return the number of nodes.
+   */
+  unsigned int getNumNodes() const;
+
+
+  /**
+   * Returns the object of the nth node, nodes being in an order in which
+   * each comes after its dependencies.
+   *
+   * @param n an unsigned int representing the index of the node.
+   *
+   * @return the SedModel, SedAbstractTask, SedDataGenerator or SedOutput,
+   * or @c NULL if @p n is out of range.
+   */
+  const SedBase* getNode(unsigned int n) const;
+
+
+  /**
+   * Returns the index of the node of an object.
+   *
+   * @param element a SedModel, SedAbstractTask, SedDataGenerator or
+   * SedOutput of the document.
+   *
+   * @return the index of its node, or @c -1 if it has none.
+   */
+  int getNodeIndex(const SedBase* element) const;
+
+
+  /**
+   * Returns the number of nodes the nth node depends on.
+   *
+   * @param n an unsigned int representing the index of the node.
+   *
+   * @return the number of dependencies, @c 0 if @p n is out of range.
+   */
+  unsigned int getNumDependencies(unsigned int n) const;
+
+
+  /**
+   * Returns a node the nth node depends on.
+   *
+   * @param n an unsigned int representing the index of the node.
+   * @param k an unsigned int representing the index of the dependency.
+   *
+   * @return the index of the kth dependency, which is lower than @p n,
+   * or @c -1 if either index is out of range.
+   */
+  int getDependency(unsigned int n, unsigned int k) const;
+
+
+  /**
+   * Returns the number of nodes that depend on the nth node.
+   *
+   * @param n an unsigned int representing the index of the node.
+   *
+   * @return the number of dependents, @c 0 if @p n is out of range.
+   */
+  unsigned int getNumDependents(unsigned int n) const;
+
+
+  /**
+   * Returns a node that depends on the nth node.
+   *
+   * @param n an unsigned int representing the index of the node.
+   * @param k an unsigned int representing the index of the dependent.
+   *
+   * @return the index of the kth dependent, which is higher than @p n, or
+   * @c -1 if either index is out of range.
+   */
+  int getDependent(unsigned int n, unsigned int k) const;
+
+
+  /**
+   * Returns the Variable objects of the document whose results the task of
+   * the nth node produces: those whose taskReference is that task.  Only
+   * one Variable is listed for each column of a SedResultStore.
+   *
+   * @param n an unsigned int representing the index of the node.
+   *
+   * @return the variables, empty if the node is not a task or @p n is out
+   * of range.
+   */
+  const std::vector<const SedVariable*>& getVariables(unsigned int n) const;
+
+
+private:
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  struct Node
+  {
+    const SedBase* element;
+    std::vector<unsigned int> dependencies;
+    std::vector<unsigned int> dependents;
+    std::vector<const SedVariable*> variables;
+  };
+
+  SedExecutionPlan(const SedExecutionPlan&);
+  SedExecutionPlan& operator=(const SedExecutionPlan&);
+
+  int findNode(const SedBase* element) const;
+
+  const SedDocument* mDocument;
+  std::vector<Node> mNodes;
+  std::unordered_map<const SedBase*, unsigned int> mIndex;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedExecutionPlan_h */
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedExperimentReference.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfExperimentReferences.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -56,7 +57,6 @@ SedExperimentReference::SedExperimentReference(unsigned int level, unsigned int
   : SedBase(level, version)
   , mExperimentId ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -64,7 +64,7 @@ SedExperimentReference::SedExperimentReference(unsigned int level, unsigned int
  * Creates a new SedExperimentReference using the given SedNamespaces object @p
  * sedmlns.
  */
-SedExperimentReference::SedExperimentReference(SedNamespaces *sedmlns)
+SedExperimentReference::SedExperimentReference(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mExperimentId ("")
 {
@@ -82,6 +82,16 @@ SedExperimentReference::SedExperimentReference(const SedExperimentReference& ori
 }
 
 
+/*
+ * Move constructor for SedExperimentReference.
+ */
+SedExperimentReference::SedExperimentReference(SedExperimentReference&& orig)
+  : SedBase( std::move(orig) )
+  , mExperimentId ( std::move(orig.mExperimentId) )
+{
+}
+
+
 /*
  * Assignment operator for SedExperimentReference.
  */
@@ -98,6 +108,22 @@ SedExperimentReference::operator=(const SedExperimentReference& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedExperimentReference.
+ */
+SedExperimentReference&
+SedExperimentReference::operator=(SedExperimentReference&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mExperimentId = std::move(rhs.mExperimentId);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedExperimentReference object.
  */
@@ -187,6 +213,64 @@ SedExperimentReference::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedExperimentReference object to @p refs.
+ */
+void
+SedExperimentReference::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetExperimentId())
+  {
+    refs.push_back(std::make_pair(std::string("experimentId"), mExperimentId));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedExperimentReference object to @p usage.
+ */
+void
+SedExperimentReference::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedExperimentReference) - sizeof(SedBase));
+  usage.addString(type, mExperimentId);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedExperimentReference object to
+ * @p stream.
+ */
+void
+SedExperimentReference::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mExperimentId);
+}
+
+
+/*
+ * Reads the attributes and children of this SedExperimentReference object from
+ * @p stream.
+ */
+void
+SedExperimentReference::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mExperimentId);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedExperimentReference object.
@@ -93,7 +93,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedExperimentReference(SedNamespaces *sedmlns);
+  SedExperimentReference(const SedNamespaces *sedmlns);
 
 
   /**
@@ -113,6 +113,28 @@ public:
   SedExperimentReference& operator=(const SedExperimentReference& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedExperimentReference.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedExperimentReference instance to move from.
+   */
+  SedExperimentReference(SedExperimentReference&& orig);
+
+
+  /**
+   * Move assignment operator for SedExperimentReference.
+   *
+   * @param rhs the SedExperimentReference object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedExperimentReference& operator=(SedExperimentReference&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedExperimentReference object.
    *
@@ -178,6 +200,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedExperimentReference object.
    *
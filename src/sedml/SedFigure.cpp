@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedFigure.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -58,7 +59,6 @@ SedFigure::SedFigure(unsigned int level, unsigned int version)
   , mIsSetNumCols (false)
   , mSubPlots (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -66,7 +66,7 @@ SedFigure::SedFigure(unsigned int level, unsigned int version)
 /*
  * Creates a new SedFigure using the given SedNamespaces object @p sedmlns.
  */
-SedFigure::SedFigure(SedNamespaces *sedmlns)
+SedFigure::SedFigure(const SedNamespaces *sedmlns)
   : SedOutput(sedmlns)
   , mNumRows (SEDML_INT_MAX)
   , mIsSetNumRows (false)
@@ -94,6 +94,21 @@ SedFigure::SedFigure(const SedFigure& orig)
 }
 
 
+/*
+ * Move constructor for SedFigure.
+ */
+SedFigure::SedFigure(SedFigure&& orig)
+  : SedOutput( std::move(orig) )
+  , mNumRows ( std::move(orig.mNumRows) )
+  , mIsSetNumRows ( std::move(orig.mIsSetNumRows) )
+  , mNumCols ( std::move(orig.mNumCols) )
+  , mIsSetNumCols ( std::move(orig.mIsSetNumCols) )
+  , mSubPlots ( std::move(orig.mSubPlots) )
+{
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedFigure.
  */
@@ -115,6 +130,28 @@ SedFigure::operator=(const SedFigure& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedFigure.
+ */
+SedFigure&
+SedFigure::operator=(SedFigure&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedOutput::operator=(std::move(rhs));
+    mNumRows = std::move(rhs.mNumRows);
+    mIsSetNumRows = std::move(rhs.mIsSetNumRows);
+    mNumCols = std::move(rhs.mNumCols);
+    mIsSetNumCols = std::move(rhs.mIsSetNumCols);
+    mSubPlots = std::move(rhs.mSubPlots);
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedFigure object.
  */
@@ -331,6 +368,46 @@ SedFigure::addSubPlot(const SedSubPlot* ssp)
 }
 
 
+/*
+ * Adds the given SedSubPlot to this SedFigure, which takes ownership of it.
+ */
+int
+SedFigure::addSubPlot(std::unique_ptr<SedSubPlot> ssp)
+{
+  if (!ssp)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ssp->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ssp.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ssp->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ssp->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ssp->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ssp.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return mSubPlots.appendAndOwn(std::move(ssp));
+  }
+}
+
+
 /*
  * Get the number of SedSubPlot objects in this SedFigure.
  */
@@ -352,7 +429,7 @@ SedFigure::createSubPlot()
 
   try
   {
-    ssp = new SedSubPlot(getSedNamespaces());
+    ssp = new (getSedArena()) SedSubPlot(getSedNamespaces());
   }
   catch (...)
   {
@@ -377,6 +454,63 @@ SedFigure::removeSubPlot(unsigned int n)
 }
 
 
+/*
+ * Adds the memory held by this SedFigure object to @p usage.
+ */
+void
+SedFigure::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedOutput::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedFigure) - sizeof(SedOutput) -
+    sizeof(SedListOfSubPlots));
+
+  if (mSubPlots.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mSubPlots.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedFigure object to @p stream.
+ */
+void
+SedFigure::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedOutput::writeBinary(stream);
+
+  stream.writeInt(mNumRows);
+  stream.writeBool(mIsSetNumRows);
+  stream.writeInt(mNumCols);
+  stream.writeBool(mIsSetNumCols);
+  mSubPlots.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedFigure object from @p stream.
+ */
+void
+SedFigure::readBinary(SedBinaryInputStream& stream)
+{
+  SedOutput::readBinary(stream);
+
+  mNumRows = static_cast<int>(stream.readInt());
+  mIsSetNumRows = stream.readBool();
+  mNumCols = static_cast<int>(stream.readInt());
+  mIsSetNumCols = stream.readBool();
+  mSubPlots.readBinary(stream);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedFigure object.
  */
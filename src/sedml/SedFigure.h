@@ -96,7 +96,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedFigure(SedNamespaces *sedmlns);
+  SedFigure(const SedNamespaces *sedmlns);
 
 
   /**
@@ -116,6 +116,28 @@ public:
   SedFigure& operator=(const SedFigure& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedFigure.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedFigure instance to move from.
+   */
+  SedFigure(SedFigure&& orig);
+
+
+  /**
+   * Move assignment operator for SedFigure.
+   *
+   * @param rhs the SedFigure object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedFigure& operator=(SedFigure&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedFigure object.
    *
@@ -346,6 +368,28 @@ public:
   int addSubPlot(const SedSubPlot* ssp);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSubPlot to this SedFigure without copying it.
+   *
+   * @param ssp the SedSubPlot object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addSubPlot(const SedSubPlot* ssp)
+   */
+  int addSubPlot(std::unique_ptr<SedSubPlot> ssp);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSubPlot objects in this SedFigure.
    *
@@ -400,6 +444,28 @@ public:
   SedSubPlot* removeSubPlot(unsigned int n);
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedFigure object.
    *
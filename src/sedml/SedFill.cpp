@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedFill.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -55,14 +56,13 @@ SedFill::SedFill(unsigned int level, unsigned int version)
   , mColor ("")
   //, mSecondColor ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedFill using the given SedNamespaces object @p sedmlns.
  */
-SedFill::SedFill(SedNamespaces *sedmlns)
+SedFill::SedFill(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mColor ("")
   //, mSecondColor ("")
@@ -82,6 +82,16 @@ SedFill::SedFill(const SedFill& orig)
 }
 
 
+/*
+ * Move constructor for SedFill.
+ */
+SedFill::SedFill(SedFill&& orig)
+  : SedBase( std::move(orig) )
+  , mColor ( std::move(orig.mColor) )
+{
+}
+
+
 /*
  * Assignment operator for SedFill.
  */
@@ -99,6 +109,22 @@ SedFill::operator=(const SedFill& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedFill.
+ */
+SedFill&
+SedFill::operator=(SedFill&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mColor = std::move(rhs.mColor);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedFill object.
  */
@@ -164,6 +190,8 @@ SedFill::isSetColor() const
 int
 SedFill::setColor(const std::string& color)
 {
+  invalidateEffectiveStyles();
+
   mColor = color;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -186,6 +214,8 @@ SedFill::setColor(const std::string& color)
 int
 SedFill::unsetColor()
 {
+  invalidateEffectiveStyles();
+
   mColor.erase();
 
   if (mColor.empty() == true)
@@ -218,6 +248,49 @@ SedFill::unsetColor()
 //}
 
 
+/*
+ * Adds the memory held by this SedFill object to @p usage.
+ */
+void
+SedFill::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedFill) - sizeof(SedBase));
+  usage.addString(type, mColor);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedFill object to @p stream.
+ */
+void
+SedFill::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mColor);
+}
+
+
+/*
+ * Reads the attributes and children of this SedFill object from @p stream.
+ */
+void
+SedFill::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mColor);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedFill object.
  */
@@ -91,7 +91,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedFill(SedNamespaces *sedmlns);
+  SedFill(const SedNamespaces *sedmlns);
 
 
   /**
@@ -111,6 +111,28 @@ public:
   SedFill& operator=(const SedFill& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedFill.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedFill instance to move from.
+   */
+  SedFill(SedFill&& orig);
+
+
+  /**
+   * Move assignment operator for SedFill.
+   *
+   * @param rhs the SedFill object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedFill& operator=(SedFill&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedFill object.
    *
@@ -210,6 +232,28 @@ public:
   //int unsetSecondColor();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedFill object.
    *
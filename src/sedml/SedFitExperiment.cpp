@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedFitExperiment.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfFitExperiments.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -58,7 +59,6 @@ SedFitExperiment::SedFitExperiment(unsigned int level, unsigned int version)
   , mAlgorithm (NULL)
   , mFitMappings (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -67,7 +67,7 @@ SedFitExperiment::SedFitExperiment(unsigned int level, unsigned int version)
  * Creates a new SedFitExperiment using the given SedNamespaces object @p
  * sedmlns.
  */
-SedFitExperiment::SedFitExperiment(SedNamespaces *sedmlns)
+SedFitExperiment::SedFitExperiment(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mType (SEDML_EXPERIMENTTYPE_INVALID)
   , mAlgorithm (NULL)
@@ -96,6 +96,21 @@ SedFitExperiment::SedFitExperiment(const SedFitExperiment& orig)
 }
 
 
+/*
+ * Move constructor for SedFitExperiment.
+ */
+SedFitExperiment::SedFitExperiment(SedFitExperiment&& orig)
+  : SedBase( std::move(orig) )
+  , mType ( std::move(orig.mType) )
+  , mAlgorithm ( orig.mAlgorithm )
+  , mFitMappings ( std::move(orig.mFitMappings) )
+{
+  orig.mAlgorithm = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedFitExperiment.
  */
@@ -124,6 +139,28 @@ SedFitExperiment::operator=(const SedFitExperiment& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedFitExperiment.
+ */
+SedFitExperiment&
+SedFitExperiment::operator=(SedFitExperiment&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mType = std::move(rhs.mType);
+    mFitMappings = std::move(rhs.mFitMappings);
+    delete mAlgorithm;
+    mAlgorithm = rhs.mAlgorithm;
+    rhs.mAlgorithm = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedFitExperiment object.
  */
@@ -296,7 +333,7 @@ SedFitExperiment::createAlgorithm()
     delete mAlgorithm;
   }
 
-  mAlgorithm = new SedAlgorithm(getSedNamespaces());
+  mAlgorithm = new (getSedArena()) SedAlgorithm(getSedNamespaces());
 
   connectToChild();
 
@@ -456,6 +493,47 @@ SedFitExperiment::addFitMapping(const SedFitMapping* sfm)
 }
 
 
+/*
+ * Adds the given SedFitMapping to this SedFitExperiment,
+ * which takes ownership of it.
+ */
+int
+SedFitExperiment::addFitMapping(std::unique_ptr<SedFitMapping> sfm)
+{
+  if (!sfm)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sfm->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sfm.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sfm->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sfm->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sfm->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sfm.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return mFitMappings.appendAndOwn(std::move(sfm));
+  }
+}
+
+
 /*
  * Get the number of SedFitMapping objects in this SedFitExperiment.
  */
@@ -477,7 +555,7 @@ SedFitExperiment::createFitMapping()
 
   try
   {
-    sfm = new SedFitMapping(getSedNamespaces());
+    sfm = new (getSedArena()) SedFitMapping(getSedNamespaces());
   }
   catch (...)
   {
@@ -503,6 +581,61 @@ SedFitExperiment::removeFitMapping(unsigned int n)
 }
 
 
+/*
+ * Adds the memory held by this SedFitExperiment object to @p usage.
+ */
+void
+SedFitExperiment::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedFitExperiment) - sizeof(SedBase) -
+    sizeof(SedListOfFitMappings));
+
+  if (mFitMappings.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mFitMappings.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedFitExperiment object to @p
+ * stream.
+ */
+void
+SedFitExperiment::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeInt(mType);
+  stream.writeObject(mAlgorithm);
+  mFitMappings.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedFitExperiment object from @p
+ * stream.
+ */
+void
+SedFitExperiment::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  mType = static_cast<ExperimentType_t>(stream.readInt());
+  stream.readObject(mAlgorithm, this);
+  mFitMappings.readBinary(stream);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedFitExperiment object.
  */
@@ -1098,7 +1231,7 @@ SedFitExperiment::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
     }
 
     delete mAlgorithm;
-    mAlgorithm = new SedAlgorithm(getSedNamespaces());
+    mAlgorithm = new (getSedArena()) SedAlgorithm(getSedNamespaces());
     obj = mAlgorithm;
   }
   else if (name == "listOfFitMappings")
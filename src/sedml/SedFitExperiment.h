@@ -124,7 +124,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedFitExperiment(SedNamespaces *sedmlns);
+  SedFitExperiment(const SedNamespaces *sedmlns);
 
 
   /**
@@ -144,6 +144,28 @@ public:
   SedFitExperiment& operator=(const SedFitExperiment& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedFitExperiment.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedFitExperiment instance to move from.
+   */
+  SedFitExperiment(SedFitExperiment&& orig);
+
+
+  /**
+   * Move assignment operator for SedFitExperiment.
+   *
+   * @param rhs the SedFitExperiment object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedFitExperiment& operator=(SedFitExperiment&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedFitExperiment object.
    *
@@ -499,6 +521,28 @@ public:
   int addFitMapping(const SedFitMapping* sfm);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedFitMapping to this SedFitExperiment without copying it.
+   *
+   * @param sfm the SedFitMapping object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addFitMapping(const SedFitMapping* sfm)
+   */
+  int addFitMapping(std::unique_ptr<SedFitMapping> sfm);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedFitMapping objects in this SedFitExperiment.
    *
@@ -553,6 +597,28 @@ public:
   SedFitMapping* removeFitMapping(unsigned int n);
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedFitExperiment object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedFitMapping.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfFitMappings.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -61,14 +62,13 @@ SedFitMapping::SedFitMapping(unsigned int level, unsigned int version)
   , mIsSetWeight (false)
   , mPointWeight ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedFitMapping using the given SedNamespaces object @p sedmlns.
  */
-SedFitMapping::SedFitMapping(SedNamespaces *sedmlns)
+SedFitMapping::SedFitMapping(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mDataSource ("")
   , mTarget ("")
@@ -96,6 +96,21 @@ SedFitMapping::SedFitMapping(const SedFitMapping& orig)
 }
 
 
+/*
+ * Move constructor for SedFitMapping.
+ */
+SedFitMapping::SedFitMapping(SedFitMapping&& orig)
+  : SedBase( std::move(orig) )
+  , mDataSource ( std::move(orig.mDataSource) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mType ( std::move(orig.mType) )
+  , mWeight ( std::move(orig.mWeight) )
+  , mIsSetWeight ( std::move(orig.mIsSetWeight) )
+  , mPointWeight ( std::move(orig.mPointWeight) )
+{
+}
+
+
 /*
  * Assignment operator for SedFitMapping.
  */
@@ -117,6 +132,27 @@ SedFitMapping::operator=(const SedFitMapping& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedFitMapping.
+ */
+SedFitMapping&
+SedFitMapping::operator=(SedFitMapping&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mDataSource = std::move(rhs.mDataSource);
+    mTarget = std::move(rhs.mTarget);
+    mType = std::move(rhs.mType);
+    mWeight = std::move(rhs.mWeight);
+    mIsSetWeight = std::move(rhs.mIsSetWeight);
+    mPointWeight = std::move(rhs.mPointWeight);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedFitMapping object.
  */
@@ -463,6 +499,85 @@ SedFitMapping::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedFitMapping object to @p refs.
+ */
+void
+SedFitMapping::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetDataSource())
+  {
+    refs.push_back(std::make_pair(std::string("dataSource"), mDataSource));
+  }
+
+  if (isSetTarget())
+  {
+    refs.push_back(std::make_pair(std::string("target"), mTarget));
+  }
+
+  if (isSetPointWeight())
+  {
+    refs.push_back(std::make_pair(std::string("pointWeight"), mPointWeight));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedFitMapping object to @p usage.
+ */
+void
+SedFitMapping::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedFitMapping) - sizeof(SedBase));
+  usage.addString(type, mDataSource);
+  usage.addString(type, mTarget);
+  usage.addString(type, mPointWeight);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedFitMapping object to @p stream.
+ */
+void
+SedFitMapping::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mDataSource);
+  stream.writeString(mTarget);
+  stream.writeInt(mType);
+  stream.writeDouble(mWeight);
+  stream.writeBool(mIsSetWeight);
+  stream.writeString(mPointWeight);
+}
+
+
+/*
+ * Reads the attributes and children of this SedFitMapping object from @p
+ * stream.
+ */
+void
+SedFitMapping::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mDataSource);
+  stream.readString(mTarget);
+  mType = static_cast<MappingType_t>(stream.readInt());
+  mWeight = stream.readDouble();
+  mIsSetWeight = stream.readBool();
+  stream.readString(mPointWeight);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedFitMapping object.
@@ -993,7 +1108,9 @@ SedFitMapping::readAttributes(
   // target SIdRef (use = "required" )
   // 
 
-  assigned = attributes.readInto("target", mTarget);
+  std::string target;
+  assigned = attributes.readInto("target", target);
+  mTarget = target;
 
   if (assigned == true)
   {
@@ -1010,7 +1127,8 @@ SedFitMapping::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mTarget + "', which does not conform to the syntax.";
+      msg += " is '" + mTarget.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlFitMappingTargetMustBeDataGenerator, level, version, msg,
         getLine(), getColumn());
     }
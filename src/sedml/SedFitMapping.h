@@ -80,6 +80,7 @@
 
 
 #include <sedml/SedBase.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -93,7 +94,7 @@ protected:
   /** @cond doxygenLibSEDMLInternal */
 
   std::string mDataSource;
-  std::string mTarget;
+  SedInternedString mTarget;
   MappingType_t mType;
   double mWeight;
   bool mIsSetWeight;
@@ -127,7 +128,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedFitMapping(SedNamespaces *sedmlns);
+  SedFitMapping(const SedNamespaces *sedmlns);
 
 
   /**
@@ -147,6 +148,28 @@ public:
   SedFitMapping& operator=(const SedFitMapping& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedFitMapping.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedFitMapping instance to move from.
+   */
+  SedFitMapping(SedFitMapping&& orig);
+
+
+  /**
+   * Move assignment operator for SedFitMapping.
+   *
+   * @param rhs the SedFitMapping object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedFitMapping& operator=(SedFitMapping&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedFitMapping object.
    *
@@ -426,6 +449,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedFitMapping object.
    *
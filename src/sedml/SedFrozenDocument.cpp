@@ -0,0 +1,230 @@
+/**
+ * @file SedFrozenDocument.cpp
+ * @brief Implementation of the SedFrozenDocument class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedFrozenDocument.h>
+#include <sedml/SedDocument.h>
+
+
+using namespace std;
+
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Creates a new SedFrozenDocument from a copy of the given SedDocument.
+ */
+SedFrozenDocument::SedFrozenDocument(const SedDocument& doc)
+  : mDocument (doc.clone())
+  , mElements ()
+  , mElementsByType ()
+  , mTypeOffsets (SEDML_LIST_OF + 2, 0)
+  , mSIdIndex ()
+  , mMetaIdIndex ()
+  , mReferenceGraph ()
+{
+  // if doc makes copy-on-write clones, the copy still shares elements
+  // with doc; asking for all of them gives it copies of its own
+  List* elements = mDocument->getAllElements();
+
+  mDocument->prepareForConcurrentReads();
+  mElements.reserve(elements->getSize());
+
+  while (elements->getSize() > 0)
+  {
+    const SedBase* element = static_cast<const SedBase*>(elements->remove(0));
+    element->prepareForConcurrentReads();
+    mElements.push_back(element);
+
+    // as in SedDocument, the first element with a given id wins
+    const string& id = element->getId();
+    if (!id.empty())
+    {
+      mSIdIndex.insert(make_pair(id, element));
+    }
+
+    const string& metaid = element->getMetaId();
+    if (!metaid.empty())
+    {
+      mMetaIdIndex.insert(make_pair(metaid, element));
+    }
+
+    int type = element->getTypeCode();
+    if (type < 0 || type > SEDML_LIST_OF)
+    {
+      type = SEDML_UNKNOWN;
+    }
+    mTypeOffsets[type + 1]++;
+  }
+
+  delete elements;
+
+  // turn the counts into offsets and place the elements, keeping them in
+  // document order within each type
+  for (size_t type = 1; type < mTypeOffsets.size(); ++type)
+  {
+    mTypeOffsets[type] += mTypeOffsets[type - 1];
+  }
+
+  vector<unsigned int> next(mTypeOffsets.begin(), mTypeOffsets.end() - 1);
+  mElementsByType.resize(mElements.size());
+
+  for (vector<const SedBase*>::const_iterator it = mElements.begin();
+    it != mElements.end(); ++it)
+  {
+    int type = (*it)->getTypeCode();
+    if (type < 0 || type > SEDML_LIST_OF)
+    {
+      type = SEDML_UNKNOWN;
+    }
+    mElementsByType[next[type]++] = *it;
+  }
+
+  mReferenceGraph.build(mDocument);
+}
+
+
+/*
+ * Destructor for SedFrozenDocument.
+ */
+SedFrozenDocument::~SedFrozenDocument()
+{
+  mReferenceGraph.clear();
+  delete mDocument;
+}
+
+
+/*
+ * Returns the frozen copy of the document.
+ */
+const SedDocument*
+SedFrozenDocument::getSedDocument() const
+{
+  return mDocument;
+}
+
+
+/*
+ * Returns the number of elements of the document.
+ */
+unsigned int
+SedFrozenDocument::getNumElements() const
+{
+  return (unsigned int)mElements.size();
+}
+
+
+/*
+ * Returns the nth element of the document, in document order.
+ */
+const SedBase*
+SedFrozenDocument::getElement(unsigned int n) const
+{
+  return (n < mElements.size()) ? mElements[n] : NULL;
+}
+
+
+/*
+ * Returns the number of elements of the given type.
+ */
+unsigned int
+SedFrozenDocument::getNumElementsOfType(int type) const
+{
+  if (type < 0 || type > SEDML_LIST_OF)
+  {
+    return 0;
+  }
+
+  return mTypeOffsets[type + 1] - mTypeOffsets[type];
+}
+
+
+/*
+ * Returns the nth element of the given type, in document order.
+ */
+const SedBase*
+SedFrozenDocument::getElementOfType(int type, unsigned int n) const
+{
+  if (n >= getNumElementsOfType(type))
+  {
+    return NULL;
+  }
+
+  return mElementsByType[mTypeOffsets[type] + n];
+}
+
+
+/*
+ * Returns the first element with the given id.
+ */
+const SedBase*
+SedFrozenDocument::getElementBySId(const std::string& id) const
+{
+  ElementIndex::const_iterator it = mSIdIndex.find(id);
+  return (it == mSIdIndex.end()) ? NULL : it->second;
+}
+
+
+/*
+ * Returns the first element with the given metaid.
+ */
+const SedBase*
+SedFrozenDocument::getElementByMetaId(const std::string& metaid) const
+{
+  ElementIndex::const_iterator it = mMetaIdIndex.find(metaid);
+  return (it == mMetaIdIndex.end()) ? NULL : it->second;
+}
+
+
+/*
+ * Returns the references between the elements of the document.
+ */
+const SedReferenceGraph&
+SedFrozenDocument::getReferenceGraph() const
+{
+  return mReferenceGraph;
+}
+
+
+#endif /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
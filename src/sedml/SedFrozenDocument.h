@@ -0,0 +1,213 @@
+/**
+ * @file SedFrozenDocument.h
+ * @brief Definition of the SedFrozenDocument class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedFrozenDocument
+ * @sbmlbrief{} Read-only snapshot of a SedDocument that can be shared by
+ * several threads.
+ *
+ * A SedFrozenDocument holds a private copy of a SedDocument. When it is
+ * created, everything that would otherwise be computed on first use is
+ * computed up front: notes and annotations are parsed, the id indexes of
+ * the document and of all its lists are built, effective styles are
+ * resolved and a SedReferenceGraph is built. In addition, the frozen
+ * document keeps all elements in arrays, both in document order and
+ * grouped by type, and its own SId and metaid indexes.
+ *
+ * After construction nothing in the snapshot changes, so any number of
+ * threads may read it at the same time without locking, through the
+ * methods of this class or the const methods of getSedDocument(). The
+ * copy is not affected by later changes to the original document.
+ *
+ * A SedFrozenDocument is created with SedDocument::freeze().
+ */
+
+
+#ifndef SedFrozenDocument_h
+#define SedFrozenDocument_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+#include <sedml/SedTypeCodes.h>
+#include <sedml/SedReferenceGraph.h>
+
+
+#ifdef __cplusplus
+
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedBase;
+class SedDocument;
+
+
+class LIBSEDML_EXTERN SedFrozenDocument
+{
+public:
+
+  /**
+   * Creates a new SedFrozenDocument from a copy of the given SedDocument.
+   *
+   * @param doc the SedDocument to freeze.
+   */
+  explicit SedFrozenDocument(const SedDocument& doc);
+
+
+  /**
+   * Destructor for SedFrozenDocument.
+   */
+  virtual ~SedFrozenDocument();
+
+
+  /**
+   * Returns the frozen copy of the document.
+   *
+   * Only the const methods of the document may be used; they do not modify
+   * it.
+   *
+   * @return the SedDocument of this snapshot.
+   */
+  const SedDocument* getSedDocument() const;
+
+
+  /**
+   * Returns the number of elements of the document, not counting the
+   * SedDocument itself.
+   *
+   * @return the number of elements.
+   */
+  unsigned int getNumElements() const;
+
+
+  /**
+   * Returns the nth element of the document, in document order (the order
+   * of SedDocument::getAllElements()).
+   *
+   * @param n an unsigned int representing the index of the element.
+   *
+   * @return the nth element, or @c NULL if @p n is out of range.
+   */
+  const SedBase* getElement(unsigned int n) const;
+
+
+  /**
+   * Returns the number of elements of the given type.
+   *
+   * @param type the @if clike #SedTypeCode_t@else int@endif@~ of the
+   * elements.
+   *
+   * @return the number of elements of type @p type.
+   */
+  unsigned int getNumElementsOfType(int type) const;
+
+
+  /**
+   * Returns the nth element of the given type, in document order.
+   *
+   * @param type the @if clike #SedTypeCode_t@else int@endif@~ of the
+   * element.
+   * @param n an unsigned int representing the index of the element among
+   * those of type @p type.
+   *
+   * @return the nth element of type @p type, or @c NULL if @p n is out of
+   * range.
+   */
+  const SedBase* getElementOfType(int type, unsigned int n) const;
+
+
+  /**
+   * Returns the first element with the given id.
+   *
+   * @param id a string representing the id of the element.
+   *
+   * @return the element, or @c NULL if there is none.
+   */
+  const SedBase* getElementBySId(const std::string& id) const;
+
+
+  /**
+   * Returns the first element with the given metaid.
+   *
+   * @param metaid a string representing the metaid of the element.
+   *
+   * @return the element, or @c NULL if there is none.
+   */
+  const SedBase* getElementByMetaId(const std::string& metaid) const;
+
+
+  /**
+   * Returns the references between the elements of the document.
+   *
+   * @return the SedReferenceGraph of the frozen document.
+   */
+  const SedReferenceGraph& getReferenceGraph() const;
+
+
+private:
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  SedFrozenDocument(const SedFrozenDocument&);
+  SedFrozenDocument& operator=(const SedFrozenDocument&);
+
+  typedef std::unordered_map<std::string, const SedBase*> ElementIndex;
+
+  SedDocument* mDocument;
+
+  // all elements in document order, and the same elements grouped by type;
+  // the elements of type t are mElementsByType[mTypeOffsets[t]] up to
+  // mElementsByType[mTypeOffsets[t + 1]]
+  std::vector<const SedBase*> mElements;
+  std::vector<const SedBase*> mElementsByType;
+  std::vector<unsigned int> mTypeOffsets;
+
+  ElementIndex mSIdIndex;
+  ElementIndex mMetaIdIndex;
+
+  SedReferenceGraph mReferenceGraph;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedFrozenDocument_h */
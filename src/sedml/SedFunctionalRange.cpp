@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedFunctionalRange.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedVariable.h>
 #include <sbml/xml/XMLInputStream.h>
 #include <sbml/math/MathML.h>
@@ -61,7 +62,6 @@ SedFunctionalRange::SedFunctionalRange(unsigned int level,
   , mVariables (level, version)
   , mParameters (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -70,7 +70,7 @@ SedFunctionalRange::SedFunctionalRange(unsigned int level,
  * Creates a new SedFunctionalRange using the given SedNamespaces object @p
  * sedmlns.
  */
-SedFunctionalRange::SedFunctionalRange(SedNamespaces *sedmlns)
+SedFunctionalRange::SedFunctionalRange(const SedNamespaces *sedmlns)
   : SedRange(sedmlns)
   , mRange ("")
   , mMath (NULL)
@@ -101,6 +101,22 @@ SedFunctionalRange::SedFunctionalRange(const SedFunctionalRange& orig)
 }
 
 
+/*
+ * Move constructor for SedFunctionalRange.
+ */
+SedFunctionalRange::SedFunctionalRange(SedFunctionalRange&& orig)
+  : SedRange( std::move(orig) )
+  , mRange ( std::move(orig.mRange) )
+  , mMath ( orig.mMath )
+  , mVariables ( std::move(orig.mVariables) )
+  , mParameters ( std::move(orig.mParameters) )
+{
+  orig.mMath = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedFunctionalRange.
  */
@@ -114,6 +130,7 @@ SedFunctionalRange::operator=(const SedFunctionalRange& rhs)
     mVariables = rhs.mVariables;
     mParameters = rhs.mParameters;
     delete mMath;
+    mCompiledMath.clear();
     if (rhs.mMath != NULL)
     {
       mMath = rhs.mMath->deepCopy();
@@ -130,6 +147,30 @@ SedFunctionalRange::operator=(const SedFunctionalRange& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedFunctionalRange.
+ */
+SedFunctionalRange&
+SedFunctionalRange::operator=(SedFunctionalRange&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedRange::operator=(std::move(rhs));
+    mRange = std::move(rhs.mRange);
+    mVariables = std::move(rhs.mVariables);
+    mParameters = std::move(rhs.mParameters);
+    delete mMath;
+    mCompiledMath.clear();
+    mMath = rhs.mMath;
+    rhs.mMath = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedFunctionalRange object.
  */
@@ -224,6 +265,7 @@ SedFunctionalRange::getMath() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedFunctionalRange::getMath()
 {
+  mCompiledMath.exposeMath();
   return mMath;
 }
 
@@ -239,6 +281,31 @@ SedFunctionalRange::isSetMath() const
 }
 
 
+/*
+ * Returns the math of this SedFunctionalRange compiled for evaluation over
+ * arrays.
+ */
+const SedCompiledMath*
+SedFunctionalRange::getCompiledMath() const
+{
+  return mCompiledMath.get(this);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Discards the compiled math of this SedFunctionalRange.
+ */
+void
+SedFunctionalRange::clearCompiledMath()
+{
+  mCompiledMath.clear();
+}
+
+/** @endcond */
+
+
 /*
  * Sets the value of the "math" element of this SedFunctionalRange.
  */
@@ -253,6 +320,7 @@ SedFunctionalRange::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
   else if (math == NULL)
   {
     delete mMath;
+    mCompiledMath.clear();
     mMath = NULL;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -263,6 +331,7 @@ SedFunctionalRange::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
   else
   {
     delete mMath;
+    mCompiledMath.clear();
     mMath = (math != NULL) ? math->deepCopy() : NULL;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -276,6 +345,7 @@ int
 SedFunctionalRange::unsetMath()
 {
   delete mMath;
+  mCompiledMath.clear();
   mMath = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -423,6 +493,51 @@ SedFunctionalRange::addVariable(const SedVariable* sv)
 }
 
 
+/*
+ * Adds the given SedVariable to this SedFunctionalRange,
+ * which takes ownership of it.
+ */
+int
+SedFunctionalRange::addVariable(std::unique_ptr<SedVariable> sv)
+{
+  if (!sv)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sv->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sv.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sv->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sv->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sv->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sv.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sv->isSetId() && (mVariables.get(sv->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mVariables.appendAndOwn(std::move(sv));
+  }
+}
+
+
 /*
  * Get the number of SedVariable objects in this SedFunctionalRange.
  */
@@ -444,7 +559,7 @@ SedFunctionalRange::createVariable()
 
   try
   {
-    sv = new SedVariable(getSedNamespaces());
+    sv = new (getSedArena()) SedVariable(getSedNamespaces());
   }
   catch (...)
   {
@@ -579,6 +694,51 @@ SedFunctionalRange::addParameter(const SedParameter* sp)
 }
 
 
+/*
+ * Adds the given SedParameter to this SedFunctionalRange,
+ * which takes ownership of it.
+ */
+int
+SedFunctionalRange::addParameter(std::unique_ptr<SedParameter> sp)
+{
+  if (!sp)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sp->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sp.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sp->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sp->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sp->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sp.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sp->isSetId() && (mParameters.get(sp->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mParameters.appendAndOwn(std::move(sp));
+  }
+}
+
+
 /*
  * Get the number of SedParameter objects in this SedFunctionalRange.
  */
@@ -600,7 +760,7 @@ SedFunctionalRange::createParameter()
 
   try
   {
-    sp = new SedParameter(getSedNamespaces());
+    sp = new (getSedArena()) SedParameter(getSedNamespaces());
   }
   catch (...)
   {
@@ -652,9 +812,98 @@ SedFunctionalRange::renameSIdRefs(const std::string& oldid,
   if (isSetMath())
   {
     mMath->renameSIdRefs(oldid, newid);
+    mCompiledMath.clear();
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedFunctionalRange object to @p refs.
+ */
+void
+SedFunctionalRange::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetRange())
+  {
+    refs.push_back(std::make_pair(std::string("range"), mRange));
+  }
+
+  if (isSetMath())
+  {
+    collectMathSIdRefs(mMath, refs);
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedFunctionalRange object to @p usage.
+ */
+void
+SedFunctionalRange::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedRange::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedFunctionalRange) - sizeof(SedRange) -
+    sizeof(SedListOfVariables) -
+    sizeof(SedListOfParameters));
+  usage.addString(type, mRange);
+  usage.addMath(type, mMath);
+
+  if (mVariables.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mVariables.addMemoryUsage(usage);
+  }
+
+  if (mParameters.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mParameters.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedFunctionalRange object to @p
+ * stream.
+ */
+void
+SedFunctionalRange::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedRange::writeBinary(stream);
+
+  stream.writeString(mRange);
+  stream.writeMath(mMath);
+  mVariables.writeBinary(stream);
+  mParameters.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedFunctionalRange object from @p
+ * stream.
+ */
+void
+SedFunctionalRange::readBinary(SedBinaryInputStream& stream)
+{
+  SedRange::readBinary(stream);
+
+  stream.readString(mRange);
+
+  delete mMath;
+  mCompiledMath.clear();
+  mMath = stream.readMath();
+
+  mVariables.readBinary(stream);
+  mParameters.readBinary(stream);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedFunctionalRange object.
@@ -1370,6 +1619,7 @@ SedFunctionalRange::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER
     const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken elem = stream.peek();
     const std::string prefix = checkMathMLNamespace(elem);
     delete mMath;
+    mCompiledMath.clear();
     mMath = readMathML(stream, prefix);
     read = true;
   }
@@ -0,0 +1,961 @@
+/**
+ * @file SedIterationPlan.cpp
+ * @brief Implementation of the SedIterationPlan class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+#include <sedml/SedIterationPlan.h>
+#include <sedml/SedDocument.h>
+#include <sedml/SedRepeatedTask.h>
+#include <sedml/SedUniformRange.h>
+#include <sedml/SedVectorRange.h>
+#include <sedml/SedFunctionalRange.h>
+#include <sedml/SedSetValue.h>
+#include <sedml/SedSubTask.h>
+#include <sedml/SedCompiledMath.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+using namespace std;
+
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+enum SedIterationMathStatus
+{
+  SEDML_MATH_READY,
+  SEDML_MATH_PENDING,
+  SEDML_MATH_DYNAMIC
+};
+
+
+static const double NOT_A_NUMBER = numeric_limits<double>::quiet_NaN();
+
+/** @endcond */
+
+
+/*
+ * Creates a new, empty SedIterationPlan.
+ */
+SedIterationPlan::SedIterationPlan()
+  : mTask (NULL)
+  , mMasterRange (-1)
+  , mRanges ()
+  , mSetValues ()
+  , mSubTasks ()
+  , mNestedPlans ()
+{
+}
+
+
+/*
+ * Creates a new SedIterationPlan for the given SedRepeatedTask.
+ */
+SedIterationPlan::SedIterationPlan(const SedRepeatedTask* task)
+  : mTask (NULL)
+  , mMasterRange (-1)
+  , mRanges ()
+  , mSetValues ()
+  , mSubTasks ()
+  , mNestedPlans ()
+{
+  build(task);
+}
+
+
+/*
+ * Destructor for SedIterationPlan.
+ */
+SedIterationPlan::~SedIterationPlan()
+{
+  clear();
+}
+
+
+/*
+ * (Re)builds this plan from the given SedRepeatedTask.
+ */
+int
+SedIterationPlan::build(const SedRepeatedTask* task)
+{
+  vector<const SedRepeatedTask*> active;
+  return build(task, active);
+}
+
+
+/*
+ * Removes all content from this plan.
+ */
+void
+SedIterationPlan::clear()
+{
+  for (size_t i = 0; i < mNestedPlans.size(); ++i)
+  {
+    delete mNestedPlans[i];
+  }
+
+  mNestedPlans.clear();
+  mSubTasks.clear();
+  mSetValues.clear();
+  mRanges.clear();
+  mMasterRange = -1;
+  mTask = NULL;
+}
+
+
+/*
+ * Returns the SedRepeatedTask this plan was built for.
+ */
+const SedRepeatedTask*
+SedIterationPlan::getRepeatedTask() const
+{
+  return mTask;
+}
+
+
+/*
+ * Returns the number of iterations.
+ */
+unsigned int
+SedIterationPlan::getNumIterations() const
+{
+  return getRangeLength(mMasterRange);
+}
+
+
+/*
+ * Returns the number of tasks a SedIterationCursor visits for this plan.
+ */
+unsigned long long
+SedIterationPlan::getNumSteps() const
+{
+  unsigned long long perIteration = 0;
+
+  for (size_t i = 0; i < mSubTasks.size(); ++i)
+  {
+    if (mSubTasks[i].plan != NULL)
+    {
+      perIteration += mSubTasks[i].plan->getNumSteps();
+    }
+    else if (mSubTasks[i].task != NULL)
+    {
+      ++perIteration;
+    }
+  }
+
+  return perIteration * getNumIterations();
+}
+
+
+/*
+ * Returns the value of the "resetModel" attribute of the repeated task.
+ */
+bool
+SedIterationPlan::getResetModel() const
+{
+  return mTask != NULL && mTask->getResetModel();
+}
+
+
+/*
+ * Returns the value of the "concatenate" attribute of the repeated task.
+ */
+bool
+SedIterationPlan::getConcatenate() const
+{
+  return mTask != NULL && mTask->getConcatenate();
+}
+
+
+/*
+ * Returns the number of ranges of the repeated task.
+ */
+unsigned int
+SedIterationPlan::getNumRanges() const
+{
+  return static_cast<unsigned int>(mRanges.size());
+}
+
+
+/*
+ * Returns the nth range of the repeated task.
+ */
+const SedRange*
+SedIterationPlan::getRange(unsigned int n) const
+{
+  return n < mRanges.size() ? mRanges[n].range : NULL;
+}
+
+
+/*
+ * Returns the index of the range with the given identifier.
+ */
+int
+SedIterationPlan::getRangeIndex(const std::string& sid) const
+{
+  for (size_t i = 0; i < mRanges.size(); ++i)
+  {
+    if (mRanges[i].id == sid)
+    {
+      return static_cast<int>(i);
+    }
+  }
+
+  return -1;
+}
+
+
+/*
+ * Returns the index of the range named by the "range" attribute.
+ */
+int
+SedIterationPlan::getMasterRangeIndex() const
+{
+  return mMasterRange;
+}
+
+
+/*
+ * Returns the values of the nth range.
+ */
+const double*
+SedIterationPlan::getRangeValues(unsigned int n) const
+{
+  if (n >= mRanges.size() || !mRanges[n].known)
+  {
+    return NULL;
+  }
+
+  return mRanges[n].values.data();
+}
+
+
+/*
+ * Returns the value of the nth range in the given iteration.
+ */
+double
+SedIterationPlan::getRangeValue(unsigned int n, unsigned int iteration) const
+{
+  if (n >= mRanges.size() || !mRanges[n].known ||
+      iteration >= mRanges[n].values.size())
+  {
+    return NOT_A_NUMBER;
+  }
+
+  return mRanges[n].values[iteration];
+}
+
+
+/*
+ * Predicate returning @c true if the values of the nth range are dynamic.
+ */
+bool
+SedIterationPlan::isRangeDynamic(unsigned int n) const
+{
+  return n < mRanges.size() && mRanges[n].dynamic;
+}
+
+
+/*
+ * Sets the values of a range and re-evaluates everything that depends on
+ * it.
+ */
+int
+SedIterationPlan::setRangeValues(const std::string& sid,
+                                 const std::vector<double>& values)
+{
+  const int n = getRangeIndex(sid);
+
+  if (n < 0)
+  {
+    return LIBSEDML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  mRanges[n].values = values;
+  mRanges[n].known = true;
+  mRanges[n].dynamic = false;
+  mRanges[n].supplied = true;
+  update();
+
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Returns the number of SetValue objects.
+ */
+unsigned int
+SedIterationPlan::getNumSetValues() const
+{
+  return static_cast<unsigned int>(mSetValues.size());
+}
+
+
+/*
+ * Returns the nth SetValue.
+ */
+const SedIterationSetValue*
+SedIterationPlan::getSetValue(unsigned int n) const
+{
+  return n < mSetValues.size() ? &mSetValues[n] : NULL;
+}
+
+
+/*
+ * Returns the number of subtasks of the repeated task.
+ */
+unsigned int
+SedIterationPlan::getNumSubTasks() const
+{
+  return static_cast<unsigned int>(mSubTasks.size());
+}
+
+
+/*
+ * Returns the nth subtask in execution order.
+ */
+const SedIterationSubTask*
+SedIterationPlan::getSubTask(unsigned int n) const
+{
+  return n < mSubTasks.size() ? &mSubTasks[n] : NULL;
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Builds the plan; @p active holds the repeated tasks being planned
+ * further out, to detect repeated tasks that contain themselves.
+ */
+int
+SedIterationPlan::build(const SedRepeatedTask* task,
+                        std::vector<const SedRepeatedTask*>& active)
+{
+  clear();
+
+  if (task == NULL)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  int result = LIBSEDML_OPERATION_SUCCESS;
+  mTask = task;
+
+  for (unsigned int i = 0; i < task->getNumRanges(); ++i)
+  {
+    RangeValues entry;
+    entry.range = task->getRange(i);
+    entry.id = entry.range->getId();
+    entry.known = false;
+    entry.dynamic = false;
+    entry.supplied = false;
+
+    if (entry.range->isSedUniformRange())
+    {
+      const SedUniformRange* uniform =
+        static_cast<const SedUniformRange*>(entry.range);
+      const int steps = uniform->getNumberOfSteps();
+
+      if (uniform->isSetStart() && uniform->isSetEnd() &&
+          uniform->isSetNumberOfSteps() && steps >= 0)
+      {
+        const double start = uniform->getStart();
+        const double end = uniform->getEnd();
+        const bool logarithmic = uniform->getType() == "log" ||
+                                 uniform->getType() == "logarithmic";
+
+        entry.values.resize(static_cast<size_t>(steps) + 1);
+        for (int j = 0; j <= steps; ++j)
+        {
+          const double t = steps == 0 ? 0.0 : static_cast<double>(j) / steps;
+          entry.values[j] = logarithmic
+            ? exp(log(start) + t * (log(end) - log(start)))
+            : start + t * (end - start);
+        }
+        if (steps > 0)
+        {
+          entry.values[steps] = end;
+        }
+        entry.known = true;
+      }
+    }
+    else if (entry.range->isSedVectorRange())
+    {
+      entry.values =
+        static_cast<const SedVectorRange*>(entry.range)->getValues();
+      entry.known = true;
+    }
+
+    mRanges.push_back(entry);
+  }
+
+  mMasterRange = getRangeIndex(task->getRangeId());
+  if (mMasterRange < 0)
+  {
+    result = LIBSEDML_INVALID_OBJECT;
+  }
+
+  for (unsigned int i = 0; i < task->getNumTaskChanges(); ++i)
+  {
+    SedIterationSetValue entry;
+    entry.setValue = task->getTaskChange(i);
+    entry.subTask = NULL;
+    entry.range = entry.setValue->isSetRange()
+      ? getRangeIndex(entry.setValue->getRange()) : -1;
+    entry.dynamic = false;
+    mSetValues.push_back(entry);
+  }
+
+  vector<const SedSubTask*> subTasks;
+  for (unsigned int i = 0; i < task->getNumSubTasks(); ++i)
+  {
+    subTasks.push_back(task->getSubTask(i));
+  }
+  stable_sort(subTasks.begin(), subTasks.end(),
+    [](const SedSubTask* a, const SedSubTask* b)
+    {
+      if (a->isSetOrder() != b->isSetOrder())
+      {
+        return a->isSetOrder();
+      }
+      return a->isSetOrder() && a->getOrder() < b->getOrder();
+    });
+
+  const SedDocument* doc = task->getSedDocument();
+  active.push_back(task);
+
+  for (size_t i = 0; i < subTasks.size(); ++i)
+  {
+    SedIterationSubTask entry;
+    entry.subTask = subTasks[i];
+    entry.task = doc != NULL ? doc->getTask(entry.subTask->getTask()) : NULL;
+    entry.plan = NULL;
+
+    if (entry.task != NULL && entry.task->isSedRepeatedTask())
+    {
+      const SedRepeatedTask* nested =
+        static_cast<const SedRepeatedTask*>(entry.task);
+
+      if (find(active.begin(), active.end(), nested) != active.end())
+      {
+        entry.task = NULL;
+        result = LIBSEDML_INVALID_OBJECT;
+      }
+      else
+      {
+        SedIterationPlan* plan = new SedIterationPlan();
+        mNestedPlans.push_back(plan);
+        if (plan->build(nested, active) != LIBSEDML_OPERATION_SUCCESS)
+        {
+          result = LIBSEDML_INVALID_OBJECT;
+        }
+        entry.plan = plan;
+      }
+    }
+
+    mSubTasks.push_back(entry);
+
+    for (unsigned int j = 0; j < entry.subTask->getNumTaskChanges(); ++j)
+    {
+      SedIterationSetValue change;
+      change.setValue = entry.subTask->getTaskChange(j);
+      change.subTask = entry.subTask;
+      change.range = change.setValue->isSetRange()
+        ? getRangeIndex(change.setValue->getRange()) : -1;
+      change.dynamic = false;
+      mSetValues.push_back(change);
+    }
+  }
+
+  active.pop_back();
+  update();
+
+  return result;
+}
+
+
+/*
+ * Evaluates the FunctionalRange and SetValue children with their compiled
+ * math.  Functional ranges may use each other, so they are evaluated in
+ * passes until no more of them can be; the rest wait for data or form a
+ * cycle.
+ */
+void
+SedIterationPlan::update()
+{
+  for (size_t i = 0; i < mRanges.size(); ++i)
+  {
+    if (mRanges[i].range->isSedFunctionalRange() && !mRanges[i].supplied)
+    {
+      mRanges[i].values.clear();
+      mRanges[i].known = false;
+      mRanges[i].dynamic = false;
+    }
+  }
+
+  vector<const double*> columns;
+  vector<double> missing;
+
+  bool progress = true;
+  while (progress)
+  {
+    progress = false;
+
+    for (size_t i = 0; i < mRanges.size(); ++i)
+    {
+      RangeValues& entry = mRanges[i];
+      if (entry.known || entry.dynamic ||
+          !entry.range->isSedFunctionalRange())
+      {
+        continue;
+      }
+
+      const SedFunctionalRange* functional =
+        static_cast<const SedFunctionalRange*>(entry.range);
+      const int over = functional->isSetRange()
+        ? getRangeIndex(functional->getRange()) : mMasterRange;
+      const SedCompiledMath* program = functional->getCompiledMath();
+      if (over < 0 || !mRanges[over].known || !program->isCompiled())
+      {
+        continue;
+      }
+
+      const size_t length = mRanges[over].values.size();
+      switch (bindInputs(*program, functional->getNumVariables(), length,
+                         columns, missing))
+      {
+      case SEDML_MATH_PENDING:
+        continue;
+      case SEDML_MATH_DYNAMIC:
+        entry.dynamic = true;
+        break;
+      default:
+        entry.values.resize(length);
+        program->evaluate(columns.data(), length, entry.values.data());
+        entry.known = true;
+        break;
+      }
+      progress = true;
+    }
+  }
+
+  const size_t length = getNumIterations();
+
+  for (size_t i = 0; i < mSetValues.size(); ++i)
+  {
+    SedIterationSetValue& entry = mSetValues[i];
+    const SedSetValue* setValue = entry.setValue;
+    entry.values.clear();
+    entry.dynamic = false;
+
+    if (!setValue->isSetMath())
+    {
+      // without math, the value of the range is assigned
+      if (entry.range >= 0 && mRanges[entry.range].dynamic)
+      {
+        entry.dynamic = true;
+      }
+      else if (entry.range >= 0 && mRanges[entry.range].known &&
+               mRanges[entry.range].values.size() >= length)
+      {
+        entry.values.assign(mRanges[entry.range].values.begin(),
+          mRanges[entry.range].values.begin() + length);
+      }
+      continue;
+    }
+
+    const SedCompiledMath* program = setValue->getCompiledMath();
+    if (!program->isCompiled())
+    {
+      continue;
+    }
+
+    switch (bindInputs(*program, setValue->getNumVariables(), length,
+                       columns, missing))
+    {
+    case SEDML_MATH_PENDING:
+      break;
+    case SEDML_MATH_DYNAMIC:
+      entry.dynamic = true;
+      break;
+    default:
+      entry.values.resize(length);
+      program->evaluate(columns.data(), length, entry.values.data());
+      break;
+    }
+  }
+}
+
+
+/*
+ * Points the inputs of a program at the range columns they name.  The
+ * first @p numVariables inputs, and names that are not ranges, are read
+ * from the model; ranges shorter than @p length read NaN from @p missing.
+ */
+int
+SedIterationPlan::bindInputs(const SedCompiledMath& program,
+                             unsigned int numVariables, size_t length,
+                             std::vector<const double*>& columns,
+                             std::vector<double>& missing) const
+{
+  int status = SEDML_MATH_READY;
+  columns.assign(program.getNumInputs(), NULL);
+
+  for (unsigned int n = 0; n < program.getNumInputs(); ++n)
+  {
+    if (!program.usesInput(n))
+    {
+      continue;
+    }
+
+    const int range = n < numVariables
+      ? -1 : getRangeIndex(program.getInputName(n));
+    if (range < 0 || mRanges[range].dynamic)
+    {
+      status = max(status, static_cast<int>(SEDML_MATH_DYNAMIC));
+    }
+    else if (!mRanges[range].known)
+    {
+      status = max(status, static_cast<int>(SEDML_MATH_PENDING));
+    }
+    else if (mRanges[range].values.size() < length)
+    {
+      missing.assign(length, NOT_A_NUMBER);
+      columns[n] = missing.data();
+    }
+    else
+    {
+      columns[n] = mRanges[range].values.data();
+    }
+  }
+
+  return status;
+}
+
+
+/*
+ * Returns the number of values the nth range has, following functional
+ * ranges to the range they iterate over; 0 if it is not known.
+ */
+unsigned int
+SedIterationPlan::getRangeLength(int n) const
+{
+  for (size_t hops = 0; n >= 0 && hops <= mRanges.size(); ++hops)
+  {
+    const RangeValues& entry = mRanges[n];
+    if (entry.known)
+    {
+      return static_cast<unsigned int>(entry.values.size());
+    }
+    if (!entry.range->isSedFunctionalRange())
+    {
+      return 0;
+    }
+
+    const SedFunctionalRange* functional =
+      static_cast<const SedFunctionalRange*>(entry.range);
+    n = functional->isSetRange() ? getRangeIndex(functional->getRange())
+                                 : -1;
+  }
+
+  return 0;
+}
+
+/** @endcond */
+
+
+/*
+ * Creates a new SedIterationCursor for the given plan.
+ */
+SedIterationCursor::SedIterationCursor(const SedIterationPlan* plan)
+  : mPlan (plan)
+  , mStack ()
+  , mAssignments ()
+  , mStarted (false)
+  , mResetModel (false)
+{
+}
+
+
+/*
+ * Destructor for SedIterationCursor.
+ */
+SedIterationCursor::~SedIterationCursor()
+{
+}
+
+
+/*
+ * Moves to the next task to run.
+ */
+bool
+SedIterationCursor::next()
+{
+  mAssignments.clear();
+  mResetModel = false;
+
+  if (!mStarted)
+  {
+    mStarted = true;
+    if (mPlan != NULL && mPlan->getNumIterations() > 0)
+    {
+      enter(mPlan);
+    }
+  }
+
+  while (!mStack.empty())
+  {
+    Frame& frame = mStack.back();
+
+    if (frame.subTask >= frame.plan->getNumSubTasks())
+    {
+      if (++frame.iteration >= frame.plan->getNumIterations())
+      {
+        mStack.pop_back();
+      }
+      else
+      {
+        frame.subTask = 0;
+        beginIteration();
+      }
+      continue;
+    }
+
+    const SedIterationSubTask* sub =
+      frame.plan->getSubTask(frame.subTask++);
+    addAssignments(sub->subTask);
+
+    if (sub->plan != NULL)
+    {
+      if (sub->plan->getNumIterations() > 0)
+      {
+        enter(sub->plan);
+      }
+    }
+    else if (sub->task != NULL)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * Moves back before the first step.
+ */
+void
+SedIterationCursor::reset()
+{
+  mStack.clear();
+  mAssignments.clear();
+  mStarted = false;
+  mResetModel = false;
+}
+
+
+/*
+ * Returns the task to run in the current step.
+ */
+const SedAbstractTask*
+SedIterationCursor::getTask() const
+{
+  const SedSubTask* subTask = getSubTask();
+  if (subTask == NULL)
+  {
+    return NULL;
+  }
+
+  const Frame& frame = mStack.back();
+  return frame.plan->getSubTask(frame.subTask - 1)->task;
+}
+
+
+/*
+ * Returns the SubTask of the current step.
+ */
+const SedSubTask*
+SedIterationCursor::getSubTask() const
+{
+  if (mStack.empty() || mStack.back().subTask == 0)
+  {
+    return NULL;
+  }
+
+  const Frame& frame = mStack.back();
+  return frame.plan->getSubTask(frame.subTask - 1)->subTask;
+}
+
+
+/*
+ * Returns the number of nested plans the current step lies in.
+ */
+unsigned int
+SedIterationCursor::getDepth() const
+{
+  return static_cast<unsigned int>(mStack.size());
+}
+
+
+/*
+ * Returns the plan at the given nesting level.
+ */
+const SedIterationPlan*
+SedIterationCursor::getPlan(unsigned int level) const
+{
+  return level < mStack.size() ? mStack[level].plan : NULL;
+}
+
+
+/*
+ * Returns the current iteration of the plan at the given nesting level.
+ */
+unsigned int
+SedIterationCursor::getIteration(unsigned int level) const
+{
+  return level < mStack.size() ? mStack[level].iteration : 0;
+}
+
+
+/*
+ * Predicate returning @c true if the model has to be reset.
+ */
+bool
+SedIterationCursor::getResetModel() const
+{
+  return mResetModel;
+}
+
+
+/*
+ * Returns the number of SetValue objects to apply before the current step.
+ */
+unsigned int
+SedIterationCursor::getNumAssignments() const
+{
+  return static_cast<unsigned int>(mAssignments.size());
+}
+
+
+/*
+ * Returns the nth SetValue to apply before the current step.
+ */
+const SedIterationAssignment*
+SedIterationCursor::getAssignment(unsigned int n) const
+{
+  return n < mAssignments.size() ? &mAssignments[n] : NULL;
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Pushes the first iteration of a plan.
+ */
+void
+SedIterationCursor::enter(const SedIterationPlan* plan)
+{
+  Frame frame;
+  frame.plan = plan;
+  frame.iteration = 0;
+  frame.subTask = 0;
+  mStack.push_back(frame);
+  beginIteration();
+}
+
+
+/*
+ * Records what starting the current iteration of the innermost plan
+ * implies: a reset of the model and the SetValue children of the
+ * repeated task.
+ */
+void
+SedIterationCursor::beginIteration()
+{
+  const Frame& frame = mStack.back();
+
+  if (frame.plan->getResetModel())
+  {
+    mResetModel = true;
+  }
+
+  addAssignments(NULL);
+}
+
+
+/*
+ * Adds the SetValue children of @p subTask, or of the repeated task if it
+ * is @c NULL, for the current iteration of the innermost plan.
+ */
+void
+SedIterationCursor::addAssignments(const SedSubTask* subTask)
+{
+  const Frame& frame = mStack.back();
+
+  for (unsigned int i = 0; i < frame.plan->getNumSetValues(); ++i)
+  {
+    const SedIterationSetValue* setValue = frame.plan->getSetValue(i);
+    if (setValue->subTask != subTask)
+    {
+      continue;
+    }
+
+    SedIterationAssignment assignment;
+    assignment.setValue = setValue;
+    assignment.level = static_cast<unsigned int>(mStack.size() - 1);
+    assignment.iteration = frame.iteration;
+    assignment.value = frame.iteration < setValue->values.size()
+      ? setValue->values[frame.iteration]
+      : numeric_limits<double>::quiet_NaN();
+    mAssignments.push_back(assignment);
+  }
+}
+
+/** @endcond */
+
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
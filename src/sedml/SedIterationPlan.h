@@ -0,0 +1,555 @@
+/**
+ * @file SedIterationPlan.h
+ * @brief Definition of the SedIterationPlan class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedIterationPlan
+ * @sbmlbrief{} The iterations of a SedRepeatedTask, expanded into arrays.
+ *
+ * A SedIterationPlan compiles a SedRepeatedTask into the values its ranges
+ * take in each iteration, the values assigned by its SetValue children,
+ * and the order in which its SubTask children run.  Every range is held
+ * as a contiguous array with one value per iteration:
+ *
+ * @li a UniformRange yields numberOfSteps + 1 values, spaced linearly or,
+ * for type @c "log", logarithmically;
+ * @li a VectorRange yields its values;
+ * @li a FunctionalRange is evaluated for every iteration from its math,
+ * its Parameter children and the other ranges;
+ * @li a DataRange has no values until they are supplied with
+ * setRangeValues(), as the data it refers to is not part of the document.
+ *
+ * Math that uses Variable children (or any identifier that is neither a
+ * range nor a Parameter) depends on the state of the model during the
+ * simulation, and cannot be evaluated in advance; such ranges and SetValue
+ * objects are marked as dynamic and left to the caller.
+ *
+ * Nested repeated tasks get a plan of their own, so the size of a plan
+ * grows with the number of ranges and not with the number of simulations
+ * they imply.  A SedIterationCursor walks the tasks to run one at a time.
+ *
+ * A plan is a snapshot: it holds plain pointers into the document and has
+ * to be rebuilt with build() after the document has been modified.
+ */
+
+
+#ifndef SedIterationPlan_h
+#define SedIterationPlan_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedAbstractTask;
+class SedCompiledMath;
+class SedRange;
+class SedRepeatedTask;
+class SedSetValue;
+class SedSubTask;
+class SedIterationPlan;
+
+
+/**
+ * A SetValue of a SedRepeatedTask or of one of its SubTask children, with
+ * the value it assigns in each iteration.
+ */
+struct LIBSEDML_EXTERN SedIterationSetValue
+{
+  /** the SetValue */
+  const SedSetValue* setValue;
+
+  /** the SubTask the SetValue belongs to, or @c NULL if it belongs to the
+   * repeated task and applies at the start of every iteration */
+  const SedSubTask* subTask;
+
+  /** the index of the range named by the "range" attribute, or -1 */
+  int range;
+
+  /** @c true if the value depends on the state of the model */
+  bool dynamic;
+
+  /** the value for each iteration; empty if it is dynamic or depends on a
+   * range whose values are not known */
+  std::vector<double> values;
+};
+
+
+/**
+ * A SubTask of a SedRepeatedTask, in the order it runs in.
+ */
+struct LIBSEDML_EXTERN SedIterationSubTask
+{
+  /** the SubTask */
+  const SedSubTask* subTask;
+
+  /** the task the SubTask refers to, or @c NULL if it does not resolve */
+  const SedAbstractTask* task;
+
+  /** the plan of @c task if it is a repeated task, or @c NULL */
+  const SedIterationPlan* plan;
+};
+
+
+/**
+ * A SetValue to apply before the current step of a SedIterationCursor.
+ */
+struct LIBSEDML_EXTERN SedIterationAssignment
+{
+  /** the SetValue */
+  const SedIterationSetValue* setValue;
+
+  /** the nesting level of the plan the SetValue belongs to */
+  unsigned int level;
+
+  /** the iteration of that plan */
+  unsigned int iteration;
+
+  /** the value to assign, or NaN if it is not known in advance */
+  double value;
+};
+
+
+class LIBSEDML_EXTERN SedIterationPlan
+{
+public:
+
+  /**
+   * Creates a new, empty SedIterationPlan.
+   */
+  SedIterationPlan();
+
+
+  /**
+   * Creates a new SedIterationPlan for the given SedRepeatedTask.
+   *
+   * @param task the SedRepeatedTask to expand.
+   */
+  explicit SedIterationPlan(const SedRepeatedTask* task);
+
+
+  /**
+   * Destructor for SedIterationPlan.
+   */
+  virtual ~SedIterationPlan();
+
+
+  /**
+   * (Re)builds this plan from the given SedRepeatedTask, discarding any
+   * previous content.
+   *
+   * Subtasks referring to repeated tasks are planned recursively.
+   *
+   * @param task the SedRepeatedTask to expand.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p task is @c NULL, its "range" attribute does not name one of its
+   * ranges, or it contains itself through its subtasks.  The plan is
+   * built as far as possible regardless.
+   */
+  int build(const SedRepeatedTask* task);
+
+
+  /**
+   * Removes all content from this plan.
+   */
+  void clear();
+
+
+  /**
+   * Returns the SedRepeatedTask this plan was built for.
+   *
+   * @return the SedRepeatedTask, or @c NULL if the plan is empty.
+   */
+  const SedRepeatedTask* getRepeatedTask() const;
+
+
+  /**
+   * Returns the number of iterations, which is the number of values of the
+   * range named by the "range" attribute of the repeated task.
+   *
+   * @return the number of iterations, or @c 0 if the values of that range
+   * are not known.
+   */
+  unsigned int getNumIterations() const;
+
+
+  /**
+   * Returns the number of tasks a SedIterationCursor visits for this plan,
+   * counting the steps of nested plans.
+   *
+   * @return the total number of steps.
+   */
+  unsigned long long getNumSteps() const;
+
+
+  /**
+   * Returns the value of the "resetModel" attribute of the repeated task.
+   *
+   * @return @c true if the model is reset before each iteration.
+   */
+  bool getResetModel() const;
+
+
+  /**
+   * Returns the value of the "concatenate" attribute of the repeated task.
+   *
+   * @return @c true if the results of the iterations are concatenated.
+   */
+  bool getConcatenate() const;
+
+
+  /**
+   * Returns the number of ranges of the repeated task.
+   *
+   * @return the number of ranges.
+   */
+  unsigned int getNumRanges() const;
+
+
+  /**
+   * Returns the nth range of the repeated task.
+   *
+   * @param n an unsigned int representing the index of the range.
+   *
+   * @return the nth SedRange, or @c NULL if @p n is out of range.
+   */
+  const SedRange* getRange(unsigned int n) const;
+
+
+  /**
+   * Returns the index of the range with the given identifier.
+   *
+   * @param sid a string representing the identifier of the range.
+   *
+   * @return the index of the range, or @c -1 if there is none.
+   */
+  int getRangeIndex(const std::string& sid) const;
+
+
+  /**
+   * Returns the index of the range named by the "range" attribute of the
+   * repeated task.
+   *
+   * @return the index of the range, or @c -1 if it does not resolve.
+   */
+  int getMasterRangeIndex() const;
+
+
+  /**
+   * Returns the values of the nth range, one for each iteration.
+   *
+   * @param n an unsigned int representing the index of the range.
+   *
+   * @return a pointer to getNumIterations() values, or @c NULL if @p n is
+   * out of range or the values are not known in advance.
+   */
+  const double* getRangeValues(unsigned int n) const;
+
+
+  /**
+   * Returns the value of the nth range in the given iteration.
+   *
+   * @param n an unsigned int representing the index of the range.
+   * @param iteration an unsigned int representing the iteration.
+   *
+   * @return the value, or NaN if it is not known in advance.
+   */
+  double getRangeValue(unsigned int n, unsigned int iteration) const;
+
+
+  /**
+   * Predicate returning @c true if the values of the nth range depend on
+   * the state of the model and are computed during the simulation.
+   *
+   * @param n an unsigned int representing the index of the range.
+   *
+   * @return @c true if the range is dynamic, @c false otherwise.
+   */
+  bool isRangeDynamic(unsigned int n) const;
+
+
+  /**
+   * Sets the values of a range, typically a DataRange whose data has been
+   * loaded by the caller, and re-evaluates everything that depends on it.
+   *
+   * @param sid a string representing the identifier of the range.
+   * @param values the values of the range.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t} if there is no range @p sid.
+   */
+  int setRangeValues(const std::string& sid,
+                     const std::vector<double>& values);
+
+
+  /**
+   * Returns the number of SetValue objects of the repeated task and of its
+   * subtasks.
+   *
+   * @return the number of SetValue objects.
+   */
+  unsigned int getNumSetValues() const;
+
+
+  /**
+   * Returns the nth SetValue, those of the repeated task first.
+   *
+   * @param n an unsigned int representing the index of the SetValue.
+   *
+   * @return the nth SedIterationSetValue, or @c NULL if @p n is out of
+   * range.
+   */
+  const SedIterationSetValue* getSetValue(unsigned int n) const;
+
+
+  /**
+   * Returns the number of subtasks of the repeated task.
+   *
+   * @return the number of subtasks.
+   */
+  unsigned int getNumSubTasks() const;
+
+
+  /**
+   * Returns the nth subtask, ordered by their "order" attribute; subtasks
+   * without one follow the others in document order.
+   *
+   * @param n an unsigned int representing the index of the subtask.
+   *
+   * @return the nth SedIterationSubTask, or @c NULL if @p n is out of
+   * range.
+   */
+  const SedIterationSubTask* getSubTask(unsigned int n) const;
+
+
+private:
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  struct RangeValues
+  {
+    const SedRange* range;
+    std::string id;
+    std::vector<double> values;
+    bool known;
+    bool dynamic;
+    bool supplied;
+  };
+
+  SedIterationPlan(const SedIterationPlan&);
+  SedIterationPlan& operator=(const SedIterationPlan&);
+
+  int build(const SedRepeatedTask* task,
+            std::vector<const SedRepeatedTask*>& active);
+
+  void update();
+
+  int bindInputs(const SedCompiledMath& program, unsigned int numVariables,
+                 size_t length, std::vector<const double*>& columns,
+                 std::vector<double>& missing) const;
+
+  unsigned int getRangeLength(int n) const;
+
+  const SedRepeatedTask* mTask;
+  int mMasterRange;
+  std::vector<RangeValues> mRanges;
+  std::vector<SedIterationSetValue> mSetValues;
+  std::vector<SedIterationSubTask> mSubTasks;
+  std::vector<SedIterationPlan*> mNestedPlans;
+
+  /** @endcond */
+};
+
+
+class LIBSEDML_EXTERN SedIterationCursor
+{
+public:
+
+  /**
+   * Creates a new SedIterationCursor positioned before the first step of
+   * the given plan.
+   *
+   * @param plan the SedIterationPlan to walk; it has to outlive the
+   * cursor.
+   */
+  explicit SedIterationCursor(const SedIterationPlan* plan);
+
+
+  /**
+   * Destructor for SedIterationCursor.
+   */
+  virtual ~SedIterationCursor();
+
+
+  /**
+   * Moves to the next task to run, descending into nested repeated tasks.
+   *
+   * Subtasks whose task does not resolve are skipped.
+   *
+   * @return @c true if there is a next step, @c false once every step has
+   * been visited.
+   */
+  bool next();
+
+
+  /**
+   * Moves back before the first step.
+   */
+  void reset();
+
+
+  /**
+   * Returns the task to run in the current step.
+   *
+   * @return the SedAbstractTask, which is never a repeated task, or
+   * @c NULL if next() has not returned @c true.
+   */
+  const SedAbstractTask* getTask() const;
+
+
+  /**
+   * Returns the SubTask of the current step.
+   *
+   * @return the SedSubTask of the innermost repeated task, or @c NULL if
+   * next() has not returned @c true.
+   */
+  const SedSubTask* getSubTask() const;
+
+
+  /**
+   * Returns the number of nested plans the current step lies in.
+   *
+   * @return the nesting depth, @c 1 for a task run directly by the plan
+   * the cursor was created for.
+   */
+  unsigned int getDepth() const;
+
+
+  /**
+   * Returns the plan at the given nesting level.
+   *
+   * @param level an unsigned int, @c 0 for the outermost plan.
+   *
+   * @return the SedIterationPlan, or @c NULL if @p level is out of range.
+   */
+  const SedIterationPlan* getPlan(unsigned int level) const;
+
+
+  /**
+   * Returns the current iteration of the plan at the given nesting level.
+   *
+   * @param level an unsigned int, @c 0 for the outermost plan.
+   *
+   * @return the iteration, or @c 0 if @p level is out of range.
+   */
+  unsigned int getIteration(unsigned int level) const;
+
+
+  /**
+   * Predicate returning @c true if the model has to be reset before the
+   * current step, because it starts an iteration of a repeated task whose
+   * "resetModel" attribute is @c true.
+   *
+   * @return @c true if the model has to be reset.
+   */
+  bool getResetModel() const;
+
+
+  /**
+   * Returns the number of SetValue objects to apply, after resetting the
+   * model if needed, before running the current step.
+   *
+   * @return the number of assignments.
+   */
+  unsigned int getNumAssignments() const;
+
+
+  /**
+   * Returns the nth SetValue to apply before the current step; they have
+   * to be applied in order.
+   *
+   * @param n an unsigned int representing the index of the assignment.
+   *
+   * @return the nth SedIterationAssignment, or @c NULL if @p n is out of
+   * range.
+   */
+  const SedIterationAssignment* getAssignment(unsigned int n) const;
+
+
+private:
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  struct Frame
+  {
+    const SedIterationPlan* plan;
+    unsigned int iteration;
+    unsigned int subTask;
+  };
+
+  SedIterationCursor(const SedIterationCursor&);
+  SedIterationCursor& operator=(const SedIterationCursor&);
+
+  void enter(const SedIterationPlan* plan);
+  void beginIteration();
+  void addAssignments(const SedSubTask* subTask);
+
+  const SedIterationPlan* mPlan;
+  std::vector<Frame> mStack;
+  std::vector<SedIterationAssignment> mAssignments;
+  bool mStarted;
+  bool mResetModel;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedIterationPlan_h */
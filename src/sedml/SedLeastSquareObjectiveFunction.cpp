@@ -58,7 +58,6 @@ SedLeastSquareObjectiveFunction::SedLeastSquareObjectiveFunction(
                                                                    version)
   : SedObjective(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -66,7 +65,7 @@ SedLeastSquareObjectiveFunction::SedLeastSquareObjectiveFunction(
  * Creates a new SedLeastSquareObjectiveFunction using the given SedNamespaces
  * object @p sedmlns.
  */
-SedLeastSquareObjectiveFunction::SedLeastSquareObjectiveFunction(SedNamespaces
+SedLeastSquareObjectiveFunction::SedLeastSquareObjectiveFunction(const SedNamespaces
   *sedmlns)
   : SedObjective(sedmlns)
 {
@@ -84,6 +83,15 @@ SedLeastSquareObjectiveFunction::SedLeastSquareObjectiveFunction(const
 }
 
 
+/*
+ * Move constructor for SedLeastSquareObjectiveFunction.
+ */
+SedLeastSquareObjectiveFunction::SedLeastSquareObjectiveFunction(SedLeastSquareObjectiveFunction&& orig)
+  : SedObjective( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedLeastSquareObjectiveFunction.
  */
@@ -100,6 +108,21 @@ SedLeastSquareObjectiveFunction::operator=(const
 }
 
 
+/*
+ * Move assignment operator for SedLeastSquareObjectiveFunction.
+ */
+SedLeastSquareObjectiveFunction&
+SedLeastSquareObjectiveFunction::operator=(SedLeastSquareObjectiveFunction&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedObjective::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedLeastSquareObjectiveFunction
  * object.
@@ -88,7 +88,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedLeastSquareObjectiveFunction(SedNamespaces *sedmlns);
+  SedLeastSquareObjectiveFunction(const SedNamespaces *sedmlns);
 
 
   /**
@@ -109,6 +109,28 @@ public:
     SedLeastSquareObjectiveFunction& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedLeastSquareObjectiveFunction.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedLeastSquareObjectiveFunction instance to move from.
+   */
+  SedLeastSquareObjectiveFunction(SedLeastSquareObjectiveFunction&& orig);
+
+
+  /**
+   * Move assignment operator for SedLeastSquareObjectiveFunction.
+   *
+   * @param rhs the SedLeastSquareObjectiveFunction object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedLeastSquareObjectiveFunction& operator=(SedLeastSquareObjectiveFunction&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedLeastSquareObjectiveFunction
    * object.
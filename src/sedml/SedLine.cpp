@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedLine.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -57,14 +58,13 @@ SedLine::SedLine(unsigned int level, unsigned int version)
   , mThickness (util_NaN())
   , mIsSetThickness (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedLine using the given SedNamespaces object @p sedmlns.
  */
-SedLine::SedLine(SedNamespaces *sedmlns)
+SedLine::SedLine(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mType (SEDML_LINETYPE_INVALID)
   , mColor ("")
@@ -88,6 +88,19 @@ SedLine::SedLine(const SedLine& orig)
 }
 
 
+/*
+ * Move constructor for SedLine.
+ */
+SedLine::SedLine(SedLine&& orig)
+  : SedBase( std::move(orig) )
+  , mType ( std::move(orig.mType) )
+  , mColor ( std::move(orig.mColor) )
+  , mThickness ( std::move(orig.mThickness) )
+  , mIsSetThickness ( std::move(orig.mIsSetThickness) )
+{
+}
+
+
 /*
  * Assignment operator for SedLine.
  */
@@ -107,6 +120,25 @@ SedLine::operator=(const SedLine& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedLine.
+ */
+SedLine&
+SedLine::operator=(SedLine&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mType = std::move(rhs.mType);
+    mColor = std::move(rhs.mColor);
+    mThickness = std::move(rhs.mThickness);
+    mIsSetThickness = std::move(rhs.mIsSetThickness);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedLine object.
  */
@@ -202,6 +234,8 @@ SedLine::isSetThickness() const
 int
 SedLine::setType(const LineType_t type)
 {
+  invalidateEffectiveStyles();
+
   if (LineType_isValid(type) == 0)
   {
     mType = SEDML_LINETYPE_INVALID;
@@ -221,6 +255,8 @@ SedLine::setType(const LineType_t type)
 int
 SedLine::setType(const std::string& type)
 {
+  invalidateEffectiveStyles();
+
   mType = LineType_fromString(type.c_str());
 
   if (mType == SEDML_LINETYPE_INVALID)
@@ -238,6 +274,8 @@ SedLine::setType(const std::string& type)
 int
 SedLine::setColor(const std::string& color)
 {
+  invalidateEffectiveStyles();
+
   mColor = color;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -249,6 +287,8 @@ SedLine::setColor(const std::string& color)
 int
 SedLine::setThickness(double thickness)
 {
+  invalidateEffectiveStyles();
+
   mThickness = thickness;
   mIsSetThickness = true;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -261,6 +301,8 @@ SedLine::setThickness(double thickness)
 int
 SedLine::unsetType()
 {
+  invalidateEffectiveStyles();
+
   mType = SEDML_LINETYPE_INVALID;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -272,6 +314,8 @@ SedLine::unsetType()
 int
 SedLine::unsetColor()
 {
+  invalidateEffectiveStyles();
+
   mColor.erase();
 
   if (mColor.empty() == true)
@@ -291,6 +335,8 @@ SedLine::unsetColor()
 int
 SedLine::unsetThickness()
 {
+  invalidateEffectiveStyles();
+
   mThickness = util_NaN();
   mIsSetThickness = false;
 
@@ -305,6 +351,55 @@ SedLine::unsetThickness()
 }
 
 
+/*
+ * Adds the memory held by this SedLine object to @p usage.
+ */
+void
+SedLine::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedLine) - sizeof(SedBase));
+  usage.addString(type, mColor);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedLine object to @p stream.
+ */
+void
+SedLine::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeInt(mType);
+  stream.writeString(mColor);
+  stream.writeDouble(mThickness);
+  stream.writeBool(mIsSetThickness);
+}
+
+
+/*
+ * Reads the attributes and children of this SedLine object from @p stream.
+ */
+void
+SedLine::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  mType = static_cast<LineType_t>(stream.readInt());
+  stream.readString(mColor);
+  mThickness = stream.readDouble();
+  mIsSetThickness = stream.readBool();
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedLine object.
  */
@@ -127,7 +127,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedLine(SedNamespaces *sedmlns);
+  SedLine(const SedNamespaces *sedmlns);
 
 
   /**
@@ -147,6 +147,28 @@ public:
   SedLine& operator=(const SedLine& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedLine.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedLine instance to move from.
+   */
+  SedLine(SedLine&& orig);
+
+
+  /**
+   * Move assignment operator for SedLine.
+   *
+   * @param rhs the SedLine object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedLine& operator=(SedLine&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedLine object.
    *
@@ -335,6 +357,28 @@ public:
   int unsetThickness();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedLine object.
    *
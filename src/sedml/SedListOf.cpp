@@ -38,6 +38,7 @@
 
 #include <sedml/SedVisitor.h>
 #include <sedml/SedListOf.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/common/common.h>
 
 /** @cond doxygenIgnored */
@@ -49,11 +50,23 @@ using namespace std;
 LIBSEDML_CPP_NAMESPACE_BEGIN
 #ifdef __cplusplus
 
+/**
+ * Lists with fewer items than this are searched linearly by default.
+ */
+static const unsigned int SEDML_ID_INDEX_THRESHOLD = 16;
+
 /*
  * Creates a new SedListOf items.
  */
 SedListOf::SedListOf (unsigned int level, unsigned int version)
 : SedBase(level,version)
+, mItems()
+, mIdIndex()
+, mIdIndexValid(false)
+, mIdIndexHasDuplicates(false)
+, mIdIndexThreshold(SEDML_ID_INDEX_THRESHOLD)
+, mLendsItems(false)
+, mBorrowsItems(false)
 {
     if (!hasValidLevelVersionNamespaceCombination())
     throw SedConstructorException();
@@ -63,29 +76,27 @@ SedListOf::SedListOf (unsigned int level, unsigned int version)
 /*
  * Creates a new SedListOf items.
  */
-SedListOf::SedListOf (SedNamespaces* sedmlns)
+SedListOf::SedListOf (const SedNamespaces* sedmlns)
 : SedBase(sedmlns)
+, mItems()
+, mIdIndex()
+, mIdIndexValid(false)
+, mIdIndexHasDuplicates(false)
+, mIdIndexThreshold(SEDML_ID_INDEX_THRESHOLD)
+, mLendsItems(false)
+, mBorrowsItems(false)
 {
     if (!hasValidLevelVersionNamespaceCombination())
     throw SedConstructorException();
 }
 
 
-/**
- * Used by the Destructor to delete each item in mItems.
- */
-struct Delete
-{
-  void operator() (SedBase* sb) { delete sb; }
-};
-
-
 /*
  * Destroys the given SedListOf and its constituent items.
  */
 SedListOf::~SedListOf ()
 {
-  for_each( mItems.begin(), mItems.end(), Delete() );
+  deleteItems();
 }
 
 
@@ -101,7 +112,15 @@ struct Clone
 /*
  * Copy constructor. Creates a copy of this SedListOf items.
  */
-SedListOf::SedListOf (const SedListOf& orig) : SedBase(orig), mItems()
+SedListOf::SedListOf (const SedListOf& orig)
+  : SedBase(orig)
+  , mItems()
+  , mIdIndex()
+  , mIdIndexValid(false)
+  , mIdIndexHasDuplicates(false)
+  , mIdIndexThreshold(orig.mIdIndexThreshold)
+  , mLendsItems(false)
+  , mBorrowsItems(false)
 {
   mItems.resize( orig.size() );
   transform( orig.mItems.begin(), orig.mItems.end(), mItems.begin(), Clone() );
@@ -109,6 +128,26 @@ SedListOf::SedListOf (const SedListOf& orig) : SedBase(orig), mItems()
 }
 
 
+/*
+ * Move constructor. Takes over the items of orig.
+ */
+SedListOf::SedListOf (SedListOf&& orig)
+  : SedBase(std::move(orig))
+  , mItems(std::move(orig.mItems))
+  , mIdIndex()
+  , mIdIndexValid(false)
+  , mIdIndexHasDuplicates(false)
+  , mIdIndexThreshold(orig.mIdIndexThreshold)
+  , mLendsItems(false)
+  , mBorrowsItems(orig.mBorrowsItems)
+{
+  orig.mItems.clear();
+  orig.mBorrowsItems = false;
+  orig.invalidateIdIndex();
+  connectToChild();
+}
+
+
 /*
  * Assignment operator
  */
@@ -118,10 +157,39 @@ SedListOf& SedListOf::operator=(const SedListOf& rhs)
   {
     this->SedBase::operator =(rhs);
     // Deletes existing items
-    for_each( mItems.begin(), mItems.end(), Delete() );
+    deleteItems();
+    mBorrowsItems = false;
+    invalidateIdIndex();
+    mIdIndexThreshold = rhs.mIdIndexThreshold;
     mItems.resize( rhs.size() );
     transform( rhs.mItems.begin(), rhs.mItems.end(), mItems.begin(), Clone() );
     connectToChild();
+    invalidateCompiledMath();
+  }
+
+  return *this;
+}
+
+
+/*
+ * Move assignment operator
+ */
+SedListOf& SedListOf::operator=(SedListOf&& rhs)
+{
+  if(&rhs!=this)
+  {
+    this->SedBase::operator =(std::move(rhs));
+    // Deletes existing items
+    deleteItems();
+    invalidateIdIndex();
+    mIdIndexThreshold = rhs.mIdIndexThreshold;
+    mItems = std::move(rhs.mItems);
+    mBorrowsItems = rhs.mBorrowsItems;
+    rhs.mItems.clear();
+    rhs.mBorrowsItems = false;
+    rhs.invalidateIdIndex();
+    connectToChild();
+    invalidateCompiledMath();
   }
 
   return *this;
@@ -173,6 +241,8 @@ SedListOf::insertAndOwn(int location, SedBase* item)
   {
     mItems.insert( mItems.begin() + location, item );
     item->connectToParent(this);
+    addToIdIndex(item, false);
+    invalidateCompiledMath();
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (!isValidTypeForList(item))
@@ -183,6 +253,8 @@ SedListOf::insertAndOwn(int location, SedBase* item)
   {
     mItems.insert( mItems.begin() + location, item );
     item->connectToParent(this);
+    addToIdIndex(item, false);
+    invalidateCompiledMath();
     return LIBSEDML_OPERATION_SUCCESS;
   }
 }
@@ -217,6 +289,8 @@ SedListOf::appendAndOwn (SedBase* item)
   {
     mItems.push_back( item );
     item->connectToParent(this);
+    addToIdIndex(item, true);
+    invalidateCompiledMath();
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (!isValidTypeForList(item))
@@ -227,10 +301,38 @@ SedListOf::appendAndOwn (SedBase* item)
   {
     mItems.push_back( item );
     item->connectToParent(this);
+    addToIdIndex(item, true);
+    invalidateCompiledMath();
     return LIBSEDML_OPERATION_SUCCESS;
   }
 }
 
+/*
+ * Adds item to the end of this SedListOf items, taking ownership of it.
+ */
+int
+SedListOf::appendAndOwn (std::unique_ptr<SedBase> item)
+{
+  if (!item)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (item->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    item.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  int ret = appendAndOwn( item.get() );
+  if (ret == LIBSEDML_OPERATION_SUCCESS)
+  {
+    item.release();
+  }
+  return ret;
+}
+
+
 int SedListOf::appendFrom(const SedListOf* list)
 {
   if (list==NULL) return LIBSEDML_INVALID_OBJECT;
@@ -266,7 +368,7 @@ SedListOf::get (unsigned int n) const
 SedBase*
 SedListOf::get (unsigned int n)
 {
-  return const_cast<SedBase*>( static_cast<const SedListOf&>(*this).get(n) );
+  return unshareItem( static_cast<const SedListOf&>(*this).get(n) );
 }
 
 
@@ -275,17 +377,19 @@ SedListOf::getElementBySId(const std::string& id)
 {
   if (id.empty()) return NULL;
   
+  // only the item holding the element needs a copy of its own (see get())
   for (unsigned int i = 0; i < size(); i++)
   {
-    SedBase* obj = get(i);
+    SedBase* obj = mItems[i];
     if (obj->getId() == id)
     {
-      return obj;
+      return get(i);
     }
     
-    obj = obj->getElementBySId(id);
-    
-    if (obj != NULL) return obj;
+    if (obj->getElementBySId(id) != NULL)
+    {
+      return get(i)->getElementBySId(id);
+    }
   }
 
   return NULL;
@@ -297,17 +401,19 @@ SedListOf::getElementByMetaId(const std::string& metaid)
 {
   if (metaid.empty()) return NULL;
   
+  // only the item holding the element needs a copy of its own (see get())
   for (unsigned int i = 0; i < size(); i++)
   {
-    SedBase* obj = get(i);
-    if (obj->getMetaId() == metaid)
+    SedBase* obj = mItems[i];
+    if (obj->isSetMetaId() && obj->getMetaId() == metaid)
     {
-      return obj;
+      return get(i);
     }
     
-    obj = obj->getElementByMetaId(metaid);
-    
-    if (obj != NULL) return obj;
+    if (obj->getElementByMetaId(metaid) != NULL)
+    {
+      return get(i)->getElementByMetaId(metaid);
+    }
   }
 
   return NULL;
@@ -347,9 +453,16 @@ void
 SedListOf::clear (bool doDelete)
 {
   if (doDelete)
-    for_each( mItems.begin(), mItems.end(), Delete() );
-  
+    deleteItems();
+  else
+    for (ListItemIter it = mItems.begin(); it != mItems.end(); ++it)
+      if (!isSharedItem(*it))
+        (*it)->connectToParent(NULL);
+
   mItems.clear();
+  mBorrowsItems = false;
+  invalidateIdIndex();
+  invalidateCompiledMath();
 }
 
 
@@ -372,55 +485,65 @@ SedListOf::remove (unsigned int n)
 {
   SedBase* item = get(n);
   
-  if (item != NULL) mItems.erase( mItems.begin() + n );
+  if (item != NULL)
+  {
+    removeFromIdIndex(item, item->getId());
+    mItems.erase( mItems.begin() + n );
+    item->connectToParent(NULL);
+    invalidateCompiledMath();
+  }
   
   return item;
 }
 
 
 /*
- * @return the number of items in this SedListOf items.
+ * Sets the minimum size for which lookups by id use the id index.
  */
-unsigned int
-SedListOf::size () const
+void
+SedListOf::setIdIndexThreshold (unsigned int threshold)
 {
-  return (unsigned int)mItems.size();
+  mIdIndexThreshold = threshold;
 }
 
 
-/**
- * Used by SedListOf::setSedDocument().
+/*
+ * @return the minimum size for which lookups by id use the id index.
  */
-struct SetSedDocument
+unsigned int
+SedListOf::getIdIndexThreshold () const
 {
-  SedDocument* d;
-
-  SetSedDocument (SedDocument* d) : d(d) { }
-  void operator() (SedBase* sbase) { sbase->setSedDocument(d); }
-};
+  return mIdIndexThreshold;
+}
 
 
-/**
- * Used by SedListOf::setParentSedObject().
+/*
+ * @return the number of items in this SedListOf items.
  */
-struct SetParentSedObject
+unsigned int
+SedListOf::size () const
 {
-  SedBase* sb;
+  return (unsigned int)mItems.size();
+}
 
-  SetParentSedObject (SedBase *sb) : sb(sb) { }
-  void operator() (SedBase* sbase) { sbase->connectToParent(sb); }
-};
 
 /** @cond doxygenLibsedmlInternal */
 
 /*
- * Sets the parent SedDocument of this SED-ML object.
+ * Sets the parent SedDocument of this SED-ML object.  Shared items keep
+ * the snapshot they belong to.
  */
 void
 SedListOf::setSedDocument (SedDocument* d)
 {
   SedBase::setSedDocument(d);
-  for_each( mItems.begin(), mItems.end(), SetSedDocument(d) );
+  for (ListItemIter it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    if (!isSharedItem(*it))
+    {
+      (*it)->setSedDocument(d);
+    }
+  }
 }
 
 
@@ -432,7 +555,150 @@ void
 SedListOf::connectToChild()
 {
   SedBase::connectToChild();
-  for_each( mItems.begin(), mItems.end(), SetParentSedObject(this) );
+  for (ListItemIter it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    if (!isSharedItem(*it))
+    {
+      (*it)->connectToParent(this);
+    }
+  }
+}
+
+
+/*
+ * Makes the items of this SedListOf those of list, copying the ones list
+ * owns unless it lends them.
+ */
+void
+SedListOf::copySharing (const SedListOf& list)
+{
+  if (&list == this)
+  {
+    return;
+  }
+
+  SedBase::operator=(list);
+  deleteItems();
+  mItems.clear();
+  mBorrowsItems = false;
+  invalidateIdIndex();
+  mIdIndexThreshold = list.mIdIndexThreshold;
+  mItems.reserve(list.size());
+
+  for (ListItem::const_iterator it = list.mItems.begin();
+       it != list.mItems.end(); ++it)
+  {
+    if (list.mLendsItems || list.isSharedItem(*it))
+    {
+      mItems.push_back(*it);
+      mBorrowsItems = true;
+    }
+    else
+    {
+      mItems.push_back((*it)->clone());
+    }
+  }
+
+  connectToChild();
+}
+
+
+/*
+ * Lets other lists share the items of this SedListOf.
+ */
+void
+SedListOf::setLendsItems ()
+{
+  mLendsItems = true;
+}
+
+
+/*
+ * Returns true if item is owned by the list of a copy-on-write snapshot
+ * other than this one.
+ */
+bool
+SedListOf::isSharedItem (const SedBase* item) const
+{
+  // lists that never took items from a snapshot skip the check
+  if (!mBorrowsItems)
+  {
+    return false;
+  }
+
+  const SedBase* parent = item->getParentSedObject();
+  if (parent == NULL || parent == this ||
+      parent->getTypeCode() != SEDML_LIST_OF)
+  {
+    return false;
+  }
+
+  return static_cast<const SedListOf*>(parent)->mLendsItems;
+}
+
+
+/*
+ * Returns true if any item of this SedListOf is a shared one.
+ */
+bool
+SedListOf::hasSharedItems () const
+{
+  if (!mBorrowsItems)
+  {
+    return false;
+  }
+
+  for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    if (isSharedItem(*it))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * Returns item, replacing it first by a copy of its own if it is shared.
+ */
+SedBase*
+SedListOf::unshareItem (const SedBase* item)
+{
+  if (item == NULL || !isSharedItem(item))
+  {
+    return const_cast<SedBase*>(item);
+  }
+
+  ListItemIter it = find(mItems.begin(), mItems.end(), item);
+  if (it == mItems.end())
+  {
+    return NULL;
+  }
+
+  SedBase* copy = item->clone();
+  removeFromIdIndex(*it, item->getId());
+  *it = copy;
+  copy->connectToParent(this);
+  addToIdIndex(copy, false);
+
+  return copy;
+}
+
+
+/*
+ * Replaces every shared item of this SedListOf by a copy of its own.
+ */
+void
+SedListOf::unshareItems ()
+{
+  for (unsigned int n = 0; n < size(); ++n)
+  {
+    get(n);
+  }
+
+  mBorrowsItems = false;
 }
 
 /** @endcond */
@@ -460,6 +726,93 @@ SedListOf::getItemTypeCode () const
 }
 
 
+/*
+ * Adds the memory held by this SedListOf to @p usage: the array of item
+ * pointers and the id index, but not the items themselves.
+ */
+void
+SedListOf::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedListOf) - sizeof(SedBase) +
+    mItems.capacity() * sizeof(SedBase*));
+  usage.addIndex(type, mIdIndex);
+}
+
+
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * Also builds the id index, whatever the size of the list, so that lookups
+ * by id never need to build it.
+ */
+void
+SedListOf::prepareForConcurrentReads() const
+{
+  SedBase::prepareForConcurrentReads();
+
+  if (!mIdIndexValid)
+  {
+    buildIdIndex();
+  }
+}
+
+
+/*
+ * Writes the number of items followed by the items.
+ */
+void
+SedListOf::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeUnsigned(mItems.size());
+  for (unsigned int n = 0; n < mItems.size(); ++n)
+  {
+    stream.writeObject(mItems[n]);
+  }
+}
+
+
+/*
+ * Reads the items written by writeBinary().  They are added directly
+ * rather than through appendAndOwn(), so that the list ends up holding
+ * exactly what was written; an item of a type the list cannot hold puts
+ * the stream into the error state.
+ */
+void
+SedListOf::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  deleteItems();
+  mItems.clear();
+  mBorrowsItems = false;
+  invalidateIdIndex();
+
+  const unsigned long count = stream.readUnsigned();
+  for (unsigned long n = 0; n < count && stream.isGood(); ++n)
+  {
+    SedBase* item = stream.createObject(this);
+    if (item == NULL || !isValidTypeForList(item))
+    {
+      delete item;
+      stream.setError();
+      break;
+    }
+
+    mItems.push_back(item);
+    item->connectToParent(this);
+    stream.readObjectContents(item);
+  }
+}
+
+/** @endcond */
+
+
 /*
  * @return the name of this element ie "listOf".
  
@@ -548,6 +901,190 @@ SedListOf::isValidTypeForList(SedBase * item)
 /** @endcond */
 
 
+/** @cond doxygenLibsedmlInternal */
+/*
+ * @return the first item with the given id, or NULL.
+ */
+SedBase*
+SedListOf::getItemById (const std::string& sid) const
+{
+  if (sid.empty() || mItems.size() < mIdIndexThreshold)
+  {
+    ListItem::const_iterator result;
+    result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedBase>(sid));
+    return (result == mItems.end()) ? NULL : *result;
+  }
+
+  if (!mIdIndexValid)
+  {
+    buildIdIndex();
+  }
+
+  IdIndex::const_iterator it = mIdIndex.find(sid);
+  return (it == mIdIndex.end()) ? NULL : it->second;
+}
+
+
+/*
+ * Removes and returns the first item with the given id, or NULL.
+ */
+SedBase*
+SedListOf::removeItemById (const std::string& sid)
+{
+  SedBase* item = getItemById(sid);
+
+  if (item == NULL)
+  {
+    return NULL;
+  }
+
+  ListItemIter result = find(mItems.begin(), mItems.end(), item);
+  return SedListOf::remove((unsigned int)(result - mItems.begin()));
+}
+
+
+/*
+ * Discards the id index; it is rebuilt on the next lookup by id.
+ */
+void
+SedListOf::invalidateIdIndex ()
+{
+  mIdIndex.clear();
+  mIdIndexValid = false;
+  mIdIndexHasDuplicates = false;
+}
+
+
+/*
+ * Updates the id index after the id of one of the items changed.
+ */
+void
+SedListOf::updateIdIndex (SedBase* item, const std::string& oldId)
+{
+  invalidateCompiledMath();
+
+  if (!mIdIndexValid || item == NULL)
+  {
+    return;
+  }
+
+  removeFromIdIndex(item, oldId);
+  addToIdIndex(item, false);
+}
+
+
+/*
+ * Deletes the items owned by this SedListOf; shared items belong to the
+ * snapshot they come from.
+ */
+void
+SedListOf::deleteItems ()
+{
+  for (ListItemIter it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    if (!isSharedItem(*it))
+    {
+      delete *it;
+    }
+  }
+}
+
+
+/*
+ * Rebuilds the id index from scratch; for duplicated ids the first item
+ * in the list wins, which is what a linear scan would return.
+ */
+void
+SedListOf::buildIdIndex () const
+{
+  mIdIndex.clear();
+  mIdIndex.reserve(mItems.size());
+  mIdIndexHasDuplicates = false;
+
+  for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    const std::string& id = (*it)->getId();
+
+    if (id.empty())
+    {
+      continue;
+    }
+
+    if (!mIdIndex.insert(IdIndex::value_type(id, *it)).second)
+    {
+      mIdIndexHasDuplicates = true;
+    }
+  }
+
+  mIdIndexValid = true;
+}
+
+
+/*
+ * Adds the given item to the id index (if the index is in use).
+ */
+void
+SedListOf::addToIdIndex (SedBase* item, bool appended)
+{
+  if (!mIdIndexValid)
+  {
+    return;
+  }
+
+  const std::string& id = item->getId();
+
+  if (id.empty())
+  {
+    return;
+  }
+
+  if (!mIdIndex.insert(IdIndex::value_type(id, item)).second)
+  {
+    // an earlier item keeps the id unless the new one was placed
+    // somewhere before it; in that case rebuild on the next lookup
+    if (appended)
+    {
+      mIdIndexHasDuplicates = true;
+    }
+    else
+    {
+      invalidateIdIndex();
+    }
+  }
+}
+
+
+/*
+ * Removes the given item from the id index (if the index is in use).
+ */
+void
+SedListOf::removeFromIdIndex (SedBase* item, const std::string& id)
+{
+  if (!mIdIndexValid || id.empty())
+  {
+    return;
+  }
+
+  IdIndex::iterator it = mIdIndex.find(id);
+
+  if (it == mIdIndex.end() || it->second != item)
+  {
+    return;
+  }
+
+  // another item might share the id, so it has to be found again
+  if (mIdIndexHasDuplicates)
+  {
+    invalidateIdIndex();
+  }
+  else
+  {
+    mIdIndex.erase(it);
+  }
+}
+/** @endcond */
+
+
 
 #endif /* __cplusplus */
 /** @cond doxygenIgnored */
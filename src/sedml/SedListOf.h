@@ -51,6 +51,7 @@
 #include <vector>
 #include <algorithm>
 #include <functional>
+#include <unordered_map>
 
 #include <sedml/SedBase.h>
 
@@ -100,7 +101,7 @@ public:
    * @param sedmlns the set of SED-ML namespaces that this SedListOf should
    * contain.
    */
-  SedListOf (SedNamespaces* sedmlns);
+  SedListOf (const SedNamespaces* sedmlns);
 
 
   /**
@@ -123,6 +124,24 @@ public:
   SedListOf& operator=(const SedListOf& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor; takes over the items of @p orig without copying
+   * them, leaving @p orig empty.
+   *
+   * @param orig the SedListOf instance to move from.
+   */
+  SedListOf (SedListOf&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOf; the items of this SedListOf
+   * are deleted and replaced by those of @p rhs, which is left empty.
+   */
+  SedListOf& operator=(SedListOf&& rhs);
+#endif /* !SWIG */
+
+
 
   /** @cond doxygenLibsedmlInternal */
   /**
@@ -186,6 +205,27 @@ public:
   int appendAndOwn (SedBase* disownedItem);
 
 
+#ifndef SWIG
+  /**
+   * Adds an item to the end of this SedListOf's list of items, taking
+   * ownership of it.
+   *
+   * @param item the item to be added to the list; it is deleted if it
+   * cannot be added, unless it already belongs to a parent, which keeps
+   * it.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p item is of the wrong type or already belongs to a parent.
+   *
+   * @see appendAndOwn(SedBase* disownedItem)
+   */
+  int appendAndOwn (std::unique_ptr<SedBase> item);
+#endif /* !SWIG */
+
+
   /**
    * Adds a clone of a list of items to this SedListOf's list.
    *
@@ -258,6 +298,11 @@ public:
   /**
    * Get an item from the list.
    *
+   * If this list belongs to a copy-on-write clone of a SedDocument (see
+   * SedDocument::setCopyOnWriteClone()) and still shares the item with the
+   * document it was cloned from, the item is first replaced by a copy
+   * that belongs to this list, so that it may be modified.
+   *
    * @param n the index number of the item to get.
    * 
    * @return the <em>n</em>th item in this SedListOf items, or a null pointer if
@@ -359,6 +404,34 @@ public:
   unsigned int size () const;
 
 
+  /**
+   * Sets the number of items this SedListOf must hold before lookups by
+   * identifier use a hash index instead of a linear scan.
+   *
+   * Scanning a handful of items is cheaper than hashing and keeping an
+   * index up to date, so small lists are searched linearly.  The default
+   * threshold is 16.
+   *
+   * @param threshold the minimum size of this list for which the "id"
+   * index is used; @c 0 always uses the index, and the maximum value of
+   * an unsigned int disables it.
+   *
+   * @see getIdIndexThreshold()
+   */
+  void setIdIndexThreshold (unsigned int threshold);
+
+
+  /**
+   * Returns the number of items this SedListOf must hold before lookups
+   * by identifier use a hash index instead of a linear scan.
+   *
+   * @return the minimum size of this list for which the "id" index is used.
+   *
+   * @see setIdIndexThreshold(unsigned int threshold)
+   */
+  unsigned int getIdIndexThreshold () const;
+
+
   /** @cond doxygenLibsedmlInternal */
   /**
    * Sets the parent SedDocument of this SED-ML object.
@@ -389,6 +462,63 @@ public:
   /** @endcond */
 
 
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Informs this SedListOf that the "id" of one of its items changed, so
+   * that the id index stays consistent.
+   *
+   * @param item the item whose "id" was changed.
+   * @param oldId the previous value of the "id" of @p item.
+   */
+  void updateIdIndex (SedBase* item, const std::string& oldId);
+  /** @endcond */
+
+
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Makes the items of this SedListOf those of @p list: the items @p list
+   * owns are copied, unless @p list lends its items (see
+   * setLendsItems()), and the items it shares are shared as well.
+   */
+  void copySharing (const SedListOf& list);
+
+
+  /**
+   * Lets other lists share the items of this SedListOf, which is part of a
+   * copy-on-write snapshot and must not be modified afterwards.
+   */
+  void setLendsItems ();
+
+
+  /**
+   * Returns true if @p item is shared with (and owned by) the list of a
+   * copy-on-write snapshot rather than owned by this SedListOf.
+   */
+  bool isSharedItem (const SedBase* item) const;
+
+
+  /**
+   * Returns true if this SedListOf shares any item with a copy-on-write
+   * snapshot.
+   */
+  bool hasSharedItems () const;
+
+
+  /**
+   * Returns @p item, or the copy it is first replaced by if it is a shared
+   * item of this SedListOf; returns @c NULL if @p item is shared but not
+   * in this list.
+   */
+  SedBase* unshareItem (const SedBase* item);
+
+
+  /**
+   * Replaces every shared item of this SedListOf by a copy of its own.
+   */
+  void unshareItems ();
+  /** @endcond */
+
+
   /**
    * Returns the libSEDML type code for this object, namely,
    * @sedmlconstant{SEDML_LIST_OF, SedTypeCode_t}.
@@ -425,6 +555,34 @@ public:
   virtual int getItemTypeCode () const;
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibsedmlInternal */
+
+  /**
+   * @copydoc SedBase::prepareForConcurrentReads
+   */
+  virtual void prepareForConcurrentReads() const;
+
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this object, which for SedListOf, is
    * always @c "listOf".
@@ -448,6 +606,7 @@ protected:
   /** @cond doxygenLibsedmlInternal */
   typedef std::vector<SedBase*>           ListItem;
   typedef std::vector<SedBase*>::iterator ListItemIter;
+  typedef std::unordered_map<std::string, SedBase*> IdIndex;
 
   /**
    * Subclasses should override this method to get the list of
@@ -480,8 +639,49 @@ protected:
 
   virtual bool isValidTypeForList(SedBase * item);
 
+  /**
+   * Returns the first item in this SedListOf with the given "id", or
+   * @c NULL if there is none.  Lists holding at least
+   * getIdIndexThreshold() items are searched through the id index.
+   */
+  SedBase* getItemById (const std::string& sid) const;
+
+  /**
+   * Removes the first item in this SedListOf with the given "id" and
+   * returns it, or returns @c NULL if there is none.
+   */
+  SedBase* removeItemById (const std::string& sid);
+
+  /**
+   * Discards the id index; it is rebuilt on the next lookup by "id".
+   */
+  void invalidateIdIndex ();
+
   ListItem mItems;
 
+  mutable IdIndex mIdIndex;
+  mutable bool mIdIndexValid;
+  mutable bool mIdIndexHasDuplicates;
+  unsigned int mIdIndexThreshold;
+
+  // the list belongs to a copy-on-write snapshot and lends its items
+  bool mLendsItems;
+
+  // the list may hold items of a copy-on-write snapshot; while false, no
+  // item is checked for being shared
+  bool mBorrowsItems;
+
+  /** @endcond */
+
+private:
+  /** @cond doxygenLibsedmlInternal */
+  void deleteItems ();
+
+  void buildIdIndex () const;
+
+  void addToIdIndex (SedBase* item, bool appended);
+
+  void removeFromIdIndex (SedBase* item, const std::string& id);
   /** @endcond */
 };
 
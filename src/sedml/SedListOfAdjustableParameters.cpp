@@ -58,7 +58,6 @@ SedListOfAdjustableParameters::SedListOfAdjustableParameters(
                                                                version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -66,7 +65,7 @@ SedListOfAdjustableParameters::SedListOfAdjustableParameters(
  * Creates a new SedListOfAdjustableParameters using the given SedNamespaces
  * object @p sedmlns.
  */
-SedListOfAdjustableParameters::SedListOfAdjustableParameters(SedNamespaces
+SedListOfAdjustableParameters::SedListOfAdjustableParameters(const SedNamespaces
   *sedmlns)
   : SedListOf(sedmlns)
 {
@@ -84,6 +83,15 @@ SedListOfAdjustableParameters::SedListOfAdjustableParameters(const
 }
 
 
+/*
+ * Move constructor for SedListOfAdjustableParameters.
+ */
+SedListOfAdjustableParameters::SedListOfAdjustableParameters(SedListOfAdjustableParameters&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfAdjustableParameters.
  */
@@ -100,6 +108,21 @@ SedListOfAdjustableParameters::operator=(const SedListOfAdjustableParameters&
 }
 
 
+/*
+ * Move assignment operator for SedListOfAdjustableParameters.
+ */
+SedListOfAdjustableParameters&
+SedListOfAdjustableParameters::operator=(SedListOfAdjustableParameters&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfAdjustableParameters
  * object.
@@ -158,11 +181,7 @@ SedListOfAdjustableParameters::get(const std::string& sid)
 const SedAdjustableParameter*
 SedListOfAdjustableParameters::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAdjustableParameter>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const
-    SedAdjustableParameter*> (*result);
+  return static_cast <const SedAdjustableParameter*> (getItemById(sid));
 }
 
 
@@ -184,19 +203,7 @@ SedListOfAdjustableParameters::remove(unsigned int n)
 SedAdjustableParameter*
 SedListOfAdjustableParameters::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAdjustableParameter>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedAdjustableParameter*> (item);
+  return static_cast <SedAdjustableParameter*> (removeItemById(sid));
 }
 
 
@@ -236,6 +243,48 @@ SedListOfAdjustableParameters::addAdjustableParameter(const
 }
 
 
+/*
+ * Adds the given SedAdjustableParameter to this SedListOfAdjustableParameters,
+ * which takes ownership of it.
+ */
+int
+SedListOfAdjustableParameters::addAdjustableParameter(
+  std::unique_ptr<SedAdjustableParameter> sap)
+{
+  if (!sap)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sap->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sap.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sap->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sap->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sap->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sap.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sap));
+  }
+}
+
+
 /*
  * Get the number of SedAdjustableParameter objects in this
  * SedListOfAdjustableParameters.
@@ -259,7 +308,7 @@ SedListOfAdjustableParameters::createAdjustableParameter()
 
   try
   {
-    sap = new SedAdjustableParameter(getSedNamespaces());
+    sap = new (getSedArena()) SedAdjustableParameter(getSedNamespaces());
   }
   catch (...)
   {
@@ -365,7 +414,7 @@ SedListOfAdjustableParameters::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "adjustableParameter")
   {
-    object = new SedAdjustableParameter(getSedNamespaces());
+    object = new (getSedArena()) SedAdjustableParameter(getSedNamespaces());
     appendAndOwn(object);
   }
 
@@ -88,7 +88,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfAdjustableParameters(SedNamespaces *sedmlns);
+  SedListOfAdjustableParameters(const SedNamespaces *sedmlns);
 
 
   /**
@@ -109,6 +109,28 @@ public:
     rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfAdjustableParameters.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfAdjustableParameters instance to move from.
+   */
+  SedListOfAdjustableParameters(SedListOfAdjustableParameters&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfAdjustableParameters.
+   *
+   * @param rhs the SedListOfAdjustableParameters object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfAdjustableParameters& operator=(SedListOfAdjustableParameters&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfAdjustableParameters
    * object.
@@ -281,6 +303,28 @@ public:
   int addAdjustableParameter(const SedAdjustableParameter* sap);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAdjustableParameter to this SedListOfAdjustableParameters without copying it.
+   *
+   * @param sap the SedAdjustableParameter object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addAdjustableParameter(const SedAdjustableParameter* sap)
+   */
+  int addAdjustableParameter(std::unique_ptr<SedAdjustableParameter> sap);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAdjustableParameter objects in this
    * SedListOfAdjustableParameters.
@@ -56,7 +56,6 @@ SedListOfAlgorithmParameters::SedListOfAlgorithmParameters(unsigned int level,
                                                              version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -64,7 +63,7 @@ SedListOfAlgorithmParameters::SedListOfAlgorithmParameters(unsigned int level,
  * Creates a new SedListOfAlgorithmParameters using the given SedNamespaces
  * object @p sedmlns.
  */
-SedListOfAlgorithmParameters::SedListOfAlgorithmParameters(SedNamespaces
+SedListOfAlgorithmParameters::SedListOfAlgorithmParameters(const SedNamespaces
   *sedmlns)
   : SedListOf(sedmlns)
 {
@@ -82,6 +81,15 @@ SedListOfAlgorithmParameters::SedListOfAlgorithmParameters(const
 }
 
 
+/*
+ * Move constructor for SedListOfAlgorithmParameters.
+ */
+SedListOfAlgorithmParameters::SedListOfAlgorithmParameters(SedListOfAlgorithmParameters&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfAlgorithmParameters.
  */
@@ -98,6 +106,21 @@ SedListOfAlgorithmParameters::operator=(const SedListOfAlgorithmParameters&
 }
 
 
+/*
+ * Move assignment operator for SedListOfAlgorithmParameters.
+ */
+SedListOfAlgorithmParameters&
+SedListOfAlgorithmParameters::operator=(SedListOfAlgorithmParameters&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfAlgorithmParameters object.
  */
@@ -143,8 +166,8 @@ SedListOfAlgorithmParameters::get(unsigned int n) const
 SedAlgorithmParameter*
 SedListOfAlgorithmParameters::get(const std::string& sid)
 {
-  return const_cast<SedAlgorithmParameter*>(static_cast<const
-    SedListOfAlgorithmParameters&>(*this).get(sid));
+  return static_cast<SedAlgorithmParameter*>(unshareItem(static_cast<const
+    SedListOfAlgorithmParameters&>(*this).get(sid)));
 }
 
 
@@ -155,11 +178,7 @@ SedListOfAlgorithmParameters::get(const std::string& sid)
 const SedAlgorithmParameter*
 SedListOfAlgorithmParameters::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAlgorithmParameter>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const
-    SedAlgorithmParameter*> (*result);
+  return static_cast <const SedAlgorithmParameter*> (getItemById(sid));
 }
 
 
@@ -181,19 +200,7 @@ SedListOfAlgorithmParameters::remove(unsigned int n)
 SedAlgorithmParameter*
 SedListOfAlgorithmParameters::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAlgorithmParameter>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedAlgorithmParameter*> (item);
+  return static_cast <SedAlgorithmParameter*> (removeItemById(sid));
 }
 
 
@@ -233,6 +240,48 @@ SedListOfAlgorithmParameters::addAlgorithmParameter(const
 }
 
 
+/*
+ * Adds the given SedAlgorithmParameter to this SedListOfAlgorithmParameters,
+ * which takes ownership of it.
+ */
+int
+SedListOfAlgorithmParameters::addAlgorithmParameter(
+  std::unique_ptr<SedAlgorithmParameter> sap)
+{
+  if (!sap)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sap->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sap.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sap->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sap->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sap->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sap.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sap));
+  }
+}
+
+
 /*
  * Get the number of SedAlgorithmParameter objects in this
  * SedListOfAlgorithmParameters.
@@ -256,7 +305,7 @@ SedListOfAlgorithmParameters::createAlgorithmParameter()
 
   try
   {
-    sap = new SedAlgorithmParameter(getSedNamespaces());
+    sap = new (getSedArena()) SedAlgorithmParameter(getSedNamespaces());
   }
   catch (...)
   {
@@ -318,7 +367,7 @@ SedListOfAlgorithmParameters::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "algorithmParameter")
   {
-    object = new SedAlgorithmParameter(getSedNamespaces());
+    object = new (getSedArena()) SedAlgorithmParameter(getSedNamespaces());
     appendAndOwn(object);
   }
 
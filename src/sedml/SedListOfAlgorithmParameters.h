@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfAlgorithmParameters(SedNamespaces *sedmlns);
+  SedListOfAlgorithmParameters(const SedNamespaces *sedmlns);
 
 
   /**
@@ -108,6 +108,28 @@ public:
     rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfAlgorithmParameters.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfAlgorithmParameters instance to move from.
+   */
+  SedListOfAlgorithmParameters(SedListOfAlgorithmParameters&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfAlgorithmParameters.
+   *
+   * @param rhs the SedListOfAlgorithmParameters object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfAlgorithmParameters& operator=(SedListOfAlgorithmParameters&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfAlgorithmParameters
    * object.
@@ -280,6 +302,28 @@ public:
   int addAlgorithmParameter(const SedAlgorithmParameter* sap);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAlgorithmParameter to this SedListOfAlgorithmParameters without copying it.
+   *
+   * @param sap the SedAlgorithmParameter object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addAlgorithmParameter(const SedAlgorithmParameter* sap)
+   */
+  int addAlgorithmParameter(std::unique_ptr<SedAlgorithmParameter> sap);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAlgorithmParameter objects in this
    * SedListOfAlgorithmParameters.
@@ -56,7 +56,6 @@ SedListOfAppliedDimensions::SedListOfAppliedDimensions(unsigned int level,
                                                              version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -64,7 +63,7 @@ SedListOfAppliedDimensions::SedListOfAppliedDimensions(unsigned int level,
  * Creates a new SedListOfAppliedDimensions using the given SedNamespaces
  * object @p sedmlns.
  */
-SedListOfAppliedDimensions::SedListOfAppliedDimensions(SedNamespaces
+SedListOfAppliedDimensions::SedListOfAppliedDimensions(const SedNamespaces
   *sedmlns)
   : SedListOf(sedmlns)
 {
@@ -82,6 +81,15 @@ SedListOfAppliedDimensions::SedListOfAppliedDimensions(const
 }
 
 
+/*
+ * Move constructor for SedListOfAppliedDimensions.
+ */
+SedListOfAppliedDimensions::SedListOfAppliedDimensions(SedListOfAppliedDimensions&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfAppliedDimensions.
  */
@@ -98,6 +106,21 @@ SedListOfAppliedDimensions::operator=(const SedListOfAppliedDimensions&
 }
 
 
+/*
+ * Move assignment operator for SedListOfAppliedDimensions.
+ */
+SedListOfAppliedDimensions&
+SedListOfAppliedDimensions::operator=(SedListOfAppliedDimensions&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfAppliedDimensions object.
  */
@@ -155,11 +178,7 @@ SedListOfAppliedDimensions::get(const std::string& sid)
 const SedAppliedDimension*
 SedListOfAppliedDimensions::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAppliedDimension>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const
-    SedAppliedDimension*> (*result);
+  return static_cast <const SedAppliedDimension*> (getItemById(sid));
 }
 
 
@@ -181,19 +200,7 @@ SedListOfAppliedDimensions::remove(unsigned int n)
 SedAppliedDimension*
 SedListOfAppliedDimensions::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAppliedDimension>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedAppliedDimension*> (item);
+  return static_cast <SedAppliedDimension*> (removeItemById(sid));
 }
 
 
@@ -233,6 +240,48 @@ SedListOfAppliedDimensions::addAppliedDimension(const
 }
 
 
+/*
+ * Adds the given SedAppliedDimension to this SedListOfAppliedDimensions,
+ * which takes ownership of it.
+ */
+int
+SedListOfAppliedDimensions::addAppliedDimension(
+  std::unique_ptr<SedAppliedDimension> srd)
+{
+  if (!srd)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (srd->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    srd.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (srd->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != srd->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != srd->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(srd.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(srd));
+  }
+}
+
+
 /*
  * Get the number of SedAppliedDimension objects in this
  * SedListOfAppliedDimensions.
@@ -256,7 +305,7 @@ SedListOfAppliedDimensions::createAppliedDimension()
 
   try
   {
-    srd = new SedAppliedDimension(getSedNamespaces());
+    srd = new (getSedArena()) SedAppliedDimension(getSedNamespaces());
   }
   catch (...)
   {
@@ -403,7 +452,7 @@ SedListOfAppliedDimensions::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "appliedDimension")
   {
-    object = new SedAppliedDimension(getSedNamespaces());
+    object = new (getSedArena()) SedAppliedDimension(getSedNamespaces());
     appendAndOwn(object);
   }
 
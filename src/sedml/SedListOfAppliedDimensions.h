@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfAppliedDimensions(SedNamespaces *sedmlns);
+  SedListOfAppliedDimensions(const SedNamespaces *sedmlns);
 
 
   /**
@@ -108,6 +108,28 @@ public:
     rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfAppliedDimensions.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfAppliedDimensions instance to move from.
+   */
+  SedListOfAppliedDimensions(SedListOfAppliedDimensions&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfAppliedDimensions.
+   *
+   * @param rhs the SedListOfAppliedDimensions object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfAppliedDimensions& operator=(SedListOfAppliedDimensions&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfAppliedDimensions
    * object.
@@ -280,6 +302,28 @@ public:
   int addAppliedDimension(const SedAppliedDimension* srd);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAppliedDimension to this SedListOfAppliedDimensions without copying it.
+   *
+   * @param srd the SedAppliedDimension object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addAppliedDimension(const SedAppliedDimension* srd)
+   */
+  int addAppliedDimension(std::unique_ptr<SedAppliedDimension> srd);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAppliedDimension objects in this
    * SedListOfAppliedDimensions.
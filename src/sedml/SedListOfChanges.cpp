@@ -60,7 +60,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfChanges::SedListOfChanges(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -68,7 +67,7 @@ SedListOfChanges::SedListOfChanges(unsigned int level, unsigned int version)
  * Creates a new SedListOfChanges using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfChanges::SedListOfChanges(SedNamespaces *sedmlns)
+SedListOfChanges::SedListOfChanges(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -84,6 +83,15 @@ SedListOfChanges::SedListOfChanges(const SedListOfChanges& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfChanges.
+ */
+SedListOfChanges::SedListOfChanges(SedListOfChanges&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfChanges.
  */
@@ -99,6 +107,21 @@ SedListOfChanges::operator=(const SedListOfChanges& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfChanges.
+ */
+SedListOfChanges&
+SedListOfChanges::operator=(SedListOfChanges&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfChanges object.
  */
@@ -154,10 +177,7 @@ SedListOfChanges::get(const std::string& sid)
 const SedChange*
 SedListOfChanges::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedChange>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedChange*>
-    (*result);
+  return static_cast <const SedChange*> (getItemById(sid));
 }
 
 
@@ -179,18 +199,7 @@ SedListOfChanges::remove(unsigned int n)
 SedChange*
 SedListOfChanges::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedChange>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedChange*> (item);
+  return static_cast <SedChange*> (removeItemById(sid));
 }
 
 
@@ -228,6 +237,47 @@ SedListOfChanges::addChange(const SedChange* sc)
 }
 
 
+/*
+ * Adds the given SedChange to this SedListOfChanges,
+ * which takes ownership of it.
+ */
+int
+SedListOfChanges::addChange(std::unique_ptr<SedChange> sc)
+{
+  if (!sc)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sc->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sc.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sc->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sc->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sc->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sc.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sc));
+  }
+}
+
+
 /*
  * Get the number of SedChange objects in this SedListOfChanges.
  */
@@ -249,7 +299,7 @@ SedListOfChanges::createAddXML()
 
   try
   {
-    saxml = new SedAddXML(getSedNamespaces());
+    saxml = new (getSedArena()) SedAddXML(getSedNamespaces());
   }
   catch (...)
   {
@@ -275,7 +325,7 @@ SedListOfChanges::createChangeXML()
 
   try
   {
-    scxml = new SedChangeXML(getSedNamespaces());
+    scxml = new (getSedArena()) SedChangeXML(getSedNamespaces());
   }
   catch (...)
   {
@@ -301,7 +351,7 @@ SedListOfChanges::createRemoveXML()
 
   try
   {
-    srxml = new SedRemoveXML(getSedNamespaces());
+    srxml = new (getSedArena()) SedRemoveXML(getSedNamespaces());
   }
   catch (...)
   {
@@ -327,7 +377,7 @@ SedListOfChanges::createChangeAttribute()
 
   try
   {
-    sca = new SedChangeAttribute(getSedNamespaces());
+    sca = new (getSedArena()) SedChangeAttribute(getSedNamespaces());
   }
   catch (...)
   {
@@ -353,7 +403,7 @@ SedListOfChanges::createComputeChange()
 
   try
   {
-    scc = new SedComputeChange(getSedNamespaces());
+    scc = new (getSedArena()) SedComputeChange(getSedNamespaces());
   }
   catch (...)
   {
@@ -415,37 +465,37 @@ SedListOfChanges::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "change")
   {
-    object = new SedChange(getSedNamespaces());
+    object = new (getSedArena()) SedChange(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "addXML")
   {
-    object = new SedAddXML(getSedNamespaces());
+    object = new (getSedArena()) SedAddXML(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "changeXML")
   {
-    object = new SedChangeXML(getSedNamespaces());
+    object = new (getSedArena()) SedChangeXML(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "removeXML")
   {
-    object = new SedRemoveXML(getSedNamespaces());
+    object = new (getSedArena()) SedRemoveXML(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "changeAttribute")
   {
-    object = new SedChangeAttribute(getSedNamespaces());
+    object = new (getSedArena()) SedChangeAttribute(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "computeChange")
   {
-    object = new SedComputeChange(getSedNamespaces());
+    object = new (getSedArena()) SedComputeChange(getSedNamespaces());
     appendAndOwn(object);
   }
 
@@ -93,7 +93,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfChanges(SedNamespaces *sedmlns);
+  SedListOfChanges(const SedNamespaces *sedmlns);
 
 
   /**
@@ -113,6 +113,28 @@ public:
   SedListOfChanges& operator=(const SedListOfChanges& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfChanges.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfChanges instance to move from.
+   */
+  SedListOfChanges(SedListOfChanges&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfChanges.
+   *
+   * @param rhs the SedListOfChanges object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfChanges& operator=(SedListOfChanges&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfChanges object.
    *
@@ -280,6 +302,28 @@ public:
   int addChange(const SedChange* sc);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedChange to this SedListOfChanges without copying it.
+   *
+   * @param sc the SedChange object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addChange(const SedChange* sc)
+   */
+  int addChange(std::unique_ptr<SedChange> sc);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedChange objects in this SedListOfChanges.
    *
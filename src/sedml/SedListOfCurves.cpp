@@ -57,7 +57,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfCurves::SedListOfCurves(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -65,7 +64,7 @@ SedListOfCurves::SedListOfCurves(unsigned int level, unsigned int version)
  * Creates a new SedListOfCurves using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfCurves::SedListOfCurves(SedNamespaces *sedmlns)
+SedListOfCurves::SedListOfCurves(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -81,6 +80,15 @@ SedListOfCurves::SedListOfCurves(const SedListOfCurves& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfCurves.
+ */
+SedListOfCurves::SedListOfCurves(SedListOfCurves&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfCurves.
  */
@@ -96,6 +104,21 @@ SedListOfCurves::operator=(const SedListOfCurves& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfCurves.
+ */
+SedListOfCurves&
+SedListOfCurves::operator=(SedListOfCurves&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 struct AbstractCurvesOrderComparator
 {
     // Compare two SedSubTasks objects using the 'order' attribute.
@@ -119,6 +142,12 @@ struct AbstractCurvesOrderComparator
 void SedListOfCurves::sort()
 {
     std::sort(mItems.begin(), mItems.end(), AbstractCurvesOrderComparator());
+
+    // the first of several items sharing an id may have changed
+    if (mIdIndexHasDuplicates)
+    {
+        invalidateIdIndex();
+    }
 }
 
 /*
@@ -176,11 +205,7 @@ SedListOfCurves::get(const std::string& sid)
 const SedAbstractCurve*
 SedListOfCurves::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAbstractCurve>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedAbstractCurve*>
-    (*result);
+  return static_cast <const SedAbstractCurve*> (getItemById(sid));
 }
 
 
@@ -202,19 +227,7 @@ SedListOfCurves::remove(unsigned int n)
 SedAbstractCurve*
 SedListOfCurves::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAbstractCurve>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedAbstractCurve*> (item);
+  return static_cast <SedAbstractCurve*> (removeItemById(sid));
 }
 
 
@@ -252,6 +265,47 @@ SedListOfCurves::addCurve(const SedAbstractCurve* sac)
 }
 
 
+/*
+ * Adds the given SedAbstractCurve to this SedListOfCurves,
+ * which takes ownership of it.
+ */
+int
+SedListOfCurves::addCurve(std::unique_ptr<SedAbstractCurve> sac)
+{
+  if (!sac)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sac->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sac.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sac->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sac->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sac->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sac.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sac));
+  }
+}
+
+
 /*
  * Get the number of SedAbstractCurve objects in this SedListOfCurves.
  */
@@ -273,7 +327,7 @@ SedListOfCurves::createCurve()
 
   try
   {
-    sc = new SedCurve(getSedNamespaces());
+    sc = new (getSedArena()) SedCurve(getSedNamespaces());
   }
   catch (...)
   {
@@ -299,7 +353,7 @@ SedListOfCurves::createShadedArea()
 
   try
   {
-    ssa = new SedShadedArea(getSedNamespaces());
+    ssa = new (getSedArena()) SedShadedArea(getSedNamespaces());
   }
   catch (...)
   {
@@ -445,19 +499,19 @@ SedListOfCurves::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "abstractCurve")
   {
-    object = new SedAbstractCurve(getSedNamespaces());
+    object = new (getSedArena()) SedAbstractCurve(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "curve")
   {
-    object = new SedCurve(getSedNamespaces());
+    object = new (getSedArena()) SedCurve(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "shadedArea")
   {
-    object = new SedShadedArea(getSedNamespaces());
+    object = new (getSedArena()) SedShadedArea(getSedNamespaces());
     appendAndOwn(object);
   }
 
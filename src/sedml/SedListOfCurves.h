@@ -90,7 +90,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfCurves(SedNamespaces *sedmlns);
+  SedListOfCurves(const SedNamespaces *sedmlns);
 
 
   /**
@@ -110,6 +110,28 @@ public:
   SedListOfCurves& operator=(const SedListOfCurves& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfCurves.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfCurves instance to move from.
+   */
+  SedListOfCurves(SedListOfCurves&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfCurves.
+   *
+   * @param rhs the SedListOfCurves object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfCurves& operator=(SedListOfCurves&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Sort the SedListOfCurves according to the 'order' attribute.
    *
@@ -284,6 +306,28 @@ public:
   int addCurve(const SedAbstractCurve* sac);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAbstractCurve to this SedListOfCurves without copying it.
+   *
+   * @param sac the SedAbstractCurve object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addCurve(const SedAbstractCurve* sac)
+   */
+  int addCurve(std::unique_ptr<SedAbstractCurve> sac);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAbstractCurve objects in this SedListOfCurves.
    *
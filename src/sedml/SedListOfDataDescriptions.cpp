@@ -55,7 +55,6 @@ SedListOfDataDescriptions::SedListOfDataDescriptions(unsigned int level,
                                                      unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -63,7 +62,7 @@ SedListOfDataDescriptions::SedListOfDataDescriptions(unsigned int level,
  * Creates a new SedListOfDataDescriptions using the given SedNamespaces object
  * @p sedmlns.
  */
-SedListOfDataDescriptions::SedListOfDataDescriptions(SedNamespaces *sedmlns)
+SedListOfDataDescriptions::SedListOfDataDescriptions(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -80,6 +79,15 @@ SedListOfDataDescriptions::SedListOfDataDescriptions(const
 }
 
 
+/*
+ * Move constructor for SedListOfDataDescriptions.
+ */
+SedListOfDataDescriptions::SedListOfDataDescriptions(SedListOfDataDescriptions&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfDataDescriptions.
  */
@@ -95,6 +103,21 @@ SedListOfDataDescriptions::operator=(const SedListOfDataDescriptions& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfDataDescriptions.
+ */
+SedListOfDataDescriptions&
+SedListOfDataDescriptions::operator=(SedListOfDataDescriptions&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfDataDescriptions object.
  */
@@ -140,8 +163,8 @@ SedListOfDataDescriptions::get(unsigned int n) const
 SedDataDescription*
 SedListOfDataDescriptions::get(const std::string& sid)
 {
-  return const_cast<SedDataDescription*>(static_cast<const
-    SedListOfDataDescriptions&>(*this).get(sid));
+  return static_cast<SedDataDescription*>(unshareItem(static_cast<const
+    SedListOfDataDescriptions&>(*this).get(sid)));
 }
 
 
@@ -152,11 +175,7 @@ SedListOfDataDescriptions::get(const std::string& sid)
 const SedDataDescription*
 SedListOfDataDescriptions::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedDataDescription>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedDataDescription*>
-    (*result);
+  return static_cast <const SedDataDescription*> (getItemById(sid));
 }
 
 
@@ -178,19 +197,7 @@ SedListOfDataDescriptions::remove(unsigned int n)
 SedDataDescription*
 SedListOfDataDescriptions::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedDataDescription>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedDataDescription*> (item);
+  return static_cast <SedDataDescription*> (removeItemById(sid));
 }
 
 
@@ -229,6 +236,47 @@ SedListOfDataDescriptions::addDataDescription(const SedDataDescription* sdd)
 }
 
 
+/*
+ * Adds the given SedDataDescription to this SedListOfDataDescriptions,
+ * which takes ownership of it.
+ */
+int
+SedListOfDataDescriptions::addDataDescription(std::unique_ptr<SedDataDescription> sdd)
+{
+  if (!sdd)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sdd->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sdd.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sdd->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sdd->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sdd->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sdd.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sdd));
+  }
+}
+
+
 /*
  * Get the number of SedDataDescription objects in this
  * SedListOfDataDescriptions.
@@ -252,7 +300,7 @@ SedListOfDataDescriptions::createDataDescription()
 
   try
   {
-    sdd = new SedDataDescription(getSedNamespaces());
+    sdd = new (getSedArena()) SedDataDescription(getSedNamespaces());
   }
   catch (...)
   {
@@ -314,7 +362,7 @@ SedListOfDataDescriptions::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "dataDescription")
   {
-    object = new SedDataDescription(getSedNamespaces());
+    object = new (getSedArena()) SedDataDescription(getSedNamespaces());
     appendAndOwn(object);
   }
 
@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfDataDescriptions(SedNamespaces *sedmlns);
+  SedListOfDataDescriptions(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfDataDescriptions& operator=(const SedListOfDataDescriptions& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfDataDescriptions.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfDataDescriptions instance to move from.
+   */
+  SedListOfDataDescriptions(SedListOfDataDescriptions&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfDataDescriptions.
+   *
+   * @param rhs the SedListOfDataDescriptions object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfDataDescriptions& operator=(SedListOfDataDescriptions&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfDataDescriptions object.
    *
@@ -278,6 +300,28 @@ public:
   int addDataDescription(const SedDataDescription* sdd);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedDataDescription to this SedListOfDataDescriptions without copying it.
+   *
+   * @param sdd the SedDataDescription object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addDataDescription(const SedDataDescription* sdd)
+   */
+  int addDataDescription(std::unique_ptr<SedDataDescription> sdd);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedDataDescription objects in this
    * SedListOfDataDescriptions.
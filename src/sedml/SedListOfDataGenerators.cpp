@@ -56,7 +56,6 @@ SedListOfDataGenerators::SedListOfDataGenerators(unsigned int level,
                                                  unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -64,7 +63,7 @@ SedListOfDataGenerators::SedListOfDataGenerators(unsigned int level,
  * Creates a new SedListOfDataGenerators using the given SedNamespaces object
  * @p sedmlns.
  */
-SedListOfDataGenerators::SedListOfDataGenerators(SedNamespaces *sedmlns)
+SedListOfDataGenerators::SedListOfDataGenerators(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -81,6 +80,15 @@ SedListOfDataGenerators::SedListOfDataGenerators(const SedListOfDataGenerators&
 }
 
 
+/*
+ * Move constructor for SedListOfDataGenerators.
+ */
+SedListOfDataGenerators::SedListOfDataGenerators(SedListOfDataGenerators&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfDataGenerators.
  */
@@ -96,6 +104,21 @@ SedListOfDataGenerators::operator=(const SedListOfDataGenerators& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfDataGenerators.
+ */
+SedListOfDataGenerators&
+SedListOfDataGenerators::operator=(SedListOfDataGenerators&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfDataGenerators object.
  */
@@ -141,8 +164,8 @@ SedListOfDataGenerators::get(unsigned int n) const
 SedDataGenerator*
 SedListOfDataGenerators::get(const std::string& sid)
 {
-  return const_cast<SedDataGenerator*>(static_cast<const
-    SedListOfDataGenerators&>(*this).get(sid));
+  return static_cast<SedDataGenerator*>(unshareItem(static_cast<const
+    SedListOfDataGenerators&>(*this).get(sid)));
 }
 
 
@@ -153,11 +176,7 @@ SedListOfDataGenerators::get(const std::string& sid)
 const SedDataGenerator*
 SedListOfDataGenerators::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedDataGenerator>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedDataGenerator*>
-    (*result);
+  return static_cast <const SedDataGenerator*> (getItemById(sid));
 }
 
 
@@ -179,19 +198,7 @@ SedListOfDataGenerators::remove(unsigned int n)
 SedDataGenerator*
 SedListOfDataGenerators::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedDataGenerator>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedDataGenerator*> (item);
+  return static_cast <SedDataGenerator*> (removeItemById(sid));
 }
 
 
@@ -233,6 +240,51 @@ SedListOfDataGenerators::addDataGenerator(const SedDataGenerator* sdg)
 }
 
 
+/*
+ * Adds the given SedDataGenerator to this SedListOfDataGenerators,
+ * which takes ownership of it.
+ */
+int
+SedListOfDataGenerators::addDataGenerator(std::unique_ptr<SedDataGenerator> sdg)
+{
+  if (!sdg)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sdg->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sdg.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sdg->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sdg->hasRequiredElements() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sdg->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sdg->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sdg.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sdg));
+  }
+}
+
+
 /*
  * Get the number of SedDataGenerator objects in this SedListOfDataGenerators.
  */
@@ -255,7 +307,7 @@ SedListOfDataGenerators::createDataGenerator()
 
   try
   {
-    sdg = new SedDataGenerator(getSedNamespaces());
+    sdg = new (getSedArena()) SedDataGenerator(getSedNamespaces());
   }
   catch (...)
   {
@@ -317,7 +369,7 @@ SedListOfDataGenerators::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "dataGenerator")
   {
-    object = new SedDataGenerator(getSedNamespaces());
+    object = new (getSedArena()) SedDataGenerator(getSedNamespaces());
     appendAndOwn(object);
   }
 
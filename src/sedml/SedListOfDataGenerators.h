@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfDataGenerators(SedNamespaces *sedmlns);
+  SedListOfDataGenerators(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfDataGenerators& operator=(const SedListOfDataGenerators& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfDataGenerators.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfDataGenerators instance to move from.
+   */
+  SedListOfDataGenerators(SedListOfDataGenerators&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfDataGenerators.
+   *
+   * @param rhs the SedListOfDataGenerators object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfDataGenerators& operator=(SedListOfDataGenerators&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfDataGenerators object.
    *
@@ -277,6 +299,28 @@ public:
   int addDataGenerator(const SedDataGenerator* sdg);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedDataGenerator to this SedListOfDataGenerators without copying it.
+   *
+   * @param sdg the SedDataGenerator object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addDataGenerator(const SedDataGenerator* sdg)
+   */
+  int addDataGenerator(std::unique_ptr<SedDataGenerator> sdg);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedDataGenerator objects in this
    * SedListOfDataGenerators.
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfDataSets::SedListOfDataSets(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -62,7 +61,7 @@ SedListOfDataSets::SedListOfDataSets(unsigned int level, unsigned int version)
  * Creates a new SedListOfDataSets using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfDataSets::SedListOfDataSets(SedNamespaces *sedmlns)
+SedListOfDataSets::SedListOfDataSets(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -78,6 +77,15 @@ SedListOfDataSets::SedListOfDataSets(const SedListOfDataSets& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfDataSets.
+ */
+SedListOfDataSets::SedListOfDataSets(SedListOfDataSets&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfDataSets.
  */
@@ -93,6 +101,21 @@ SedListOfDataSets::operator=(const SedListOfDataSets& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfDataSets.
+ */
+SedListOfDataSets&
+SedListOfDataSets::operator=(SedListOfDataSets&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfDataSets object.
  */
@@ -148,10 +171,7 @@ SedListOfDataSets::get(const std::string& sid)
 const SedDataSet*
 SedListOfDataSets::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedDataSet>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedDataSet*>
-    (*result);
+  return static_cast <const SedDataSet*> (getItemById(sid));
 }
 
 
@@ -173,18 +193,7 @@ SedListOfDataSets::remove(unsigned int n)
 SedDataSet*
 SedListOfDataSets::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedDataSet>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedDataSet*> (item);
+  return static_cast <SedDataSet*> (removeItemById(sid));
 }
 
 
@@ -222,6 +231,47 @@ SedListOfDataSets::addDataSet(const SedDataSet* sds)
 }
 
 
+/*
+ * Adds the given SedDataSet to this SedListOfDataSets,
+ * which takes ownership of it.
+ */
+int
+SedListOfDataSets::addDataSet(std::unique_ptr<SedDataSet> sds)
+{
+  if (!sds)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sds->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sds.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sds->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sds->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sds->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sds.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sds));
+  }
+}
+
+
 /*
  * Get the number of SedDataSet objects in this SedListOfDataSets.
  */
@@ -243,7 +293,7 @@ SedListOfDataSets::createDataSet()
 
   try
   {
-    sds = new SedDataSet(getSedNamespaces());
+    sds = new (getSedArena()) SedDataSet(getSedNamespaces());
   }
   catch (...)
   {
@@ -347,7 +397,7 @@ SedListOfDataSets::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "dataSet")
   {
-    object = new SedDataSet(getSedNamespaces());
+    object = new (getSedArena()) SedDataSet(getSedNamespaces());
     appendAndOwn(object);
   }
 
@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfDataSets(SedNamespaces *sedmlns);
+  SedListOfDataSets(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfDataSets& operator=(const SedListOfDataSets& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfDataSets.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfDataSets instance to move from.
+   */
+  SedListOfDataSets(SedListOfDataSets&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfDataSets.
+   *
+   * @param rhs the SedListOfDataSets object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfDataSets& operator=(SedListOfDataSets&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfDataSets object.
    *
@@ -274,6 +296,28 @@ public:
   int addDataSet(const SedDataSet* sds);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedDataSet to this SedListOfDataSets without copying it.
+   *
+   * @param sds the SedDataSet object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addDataSet(const SedDataSet* sds)
+   */
+  int addDataSet(std::unique_ptr<SedDataSet> sds);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedDataSet objects in this SedListOfDataSets.
    *
@@ -55,7 +55,6 @@ SedListOfDataSources::SedListOfDataSources(unsigned int level,
                                            unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -63,7 +62,7 @@ SedListOfDataSources::SedListOfDataSources(unsigned int level,
  * Creates a new SedListOfDataSources using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfDataSources::SedListOfDataSources(SedNamespaces *sedmlns)
+SedListOfDataSources::SedListOfDataSources(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -79,6 +78,15 @@ SedListOfDataSources::SedListOfDataSources(const SedListOfDataSources& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfDataSources.
+ */
+SedListOfDataSources::SedListOfDataSources(SedListOfDataSources&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfDataSources.
  */
@@ -94,6 +102,21 @@ SedListOfDataSources::operator=(const SedListOfDataSources& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfDataSources.
+ */
+SedListOfDataSources&
+SedListOfDataSources::operator=(SedListOfDataSources&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfDataSources object.
  */
@@ -149,10 +172,7 @@ SedListOfDataSources::get(const std::string& sid)
 const SedDataSource*
 SedListOfDataSources::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedDataSource>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedDataSource*>
-    (*result);
+  return static_cast <const SedDataSource*> (getItemById(sid));
 }
 
 
@@ -174,18 +194,7 @@ SedListOfDataSources::remove(unsigned int n)
 SedDataSource*
 SedListOfDataSources::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedDataSource>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedDataSource*> (item);
+  return static_cast <SedDataSource*> (removeItemById(sid));
 }
 
 
@@ -223,6 +232,47 @@ SedListOfDataSources::addDataSource(const SedDataSource* sds)
 }
 
 
+/*
+ * Adds the given SedDataSource to this SedListOfDataSources,
+ * which takes ownership of it.
+ */
+int
+SedListOfDataSources::addDataSource(std::unique_ptr<SedDataSource> sds)
+{
+  if (!sds)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sds->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sds.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sds->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sds->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sds->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sds.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sds));
+  }
+}
+
+
 /*
  * Get the number of SedDataSource objects in this SedListOfDataSources.
  */
@@ -244,7 +294,7 @@ SedListOfDataSources::createDataSource()
 
   try
   {
-    sds = new SedDataSource(getSedNamespaces());
+    sds = new (getSedArena()) SedDataSource(getSedNamespaces());
   }
   catch (...)
   {
@@ -348,7 +398,7 @@ SedListOfDataSources::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "dataSource")
   {
-    object = new SedDataSource(getSedNamespaces());
+    object = new (getSedArena()) SedDataSource(getSedNamespaces());
     appendAndOwn(object);
   }
 
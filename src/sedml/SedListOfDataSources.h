@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfDataSources(SedNamespaces *sedmlns);
+  SedListOfDataSources(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfDataSources& operator=(const SedListOfDataSources& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfDataSources.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfDataSources instance to move from.
+   */
+  SedListOfDataSources(SedListOfDataSources&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfDataSources.
+   *
+   * @param rhs the SedListOfDataSources object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfDataSources& operator=(SedListOfDataSources&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfDataSources object.
    *
@@ -274,6 +296,28 @@ public:
   int addDataSource(const SedDataSource* sds);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedDataSource to this SedListOfDataSources without copying it.
+   *
+   * @param sds the SedDataSource object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addDataSource(const SedDataSource* sds)
+   */
+  int addDataSource(std::unique_ptr<SedDataSource> sds);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedDataSource objects in this SedListOfDataSources.
    *
@@ -55,7 +55,6 @@ SedListOfExperimentReferences::SedListOfExperimentReferences(unsigned int level,
                                                  unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -63,7 +62,7 @@ SedListOfExperimentReferences::SedListOfExperimentReferences(unsigned int level,
  * Creates a new SedListOfExperimentReferences using the given SedNamespaces object
  * @p sedmlns.
  */
-SedListOfExperimentReferences::SedListOfExperimentReferences(SedNamespaces *sedmlns)
+SedListOfExperimentReferences::SedListOfExperimentReferences(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -80,6 +79,15 @@ SedListOfExperimentReferences::SedListOfExperimentReferences(const SedListOfExpe
 }
 
 
+/*
+ * Move constructor for SedListOfExperimentReferences.
+ */
+SedListOfExperimentReferences::SedListOfExperimentReferences(SedListOfExperimentReferences&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfExperimentReferences.
  */
@@ -95,6 +103,21 @@ SedListOfExperimentReferences::operator=(const SedListOfExperimentReferences& rh
 }
 
 
+/*
+ * Move assignment operator for SedListOfExperimentReferences.
+ */
+SedListOfExperimentReferences&
+SedListOfExperimentReferences::operator=(SedListOfExperimentReferences&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfExperimentReferences object.
  */
@@ -152,11 +175,7 @@ SedListOfExperimentReferences::get(const std::string& sid)
 const SedExperimentReference*
 SedListOfExperimentReferences::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedExperimentReference>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedExperimentReference*>
-    (*result);
+  return static_cast <const SedExperimentReference*> (getItemById(sid));
 }
 
 
@@ -178,19 +197,7 @@ SedListOfExperimentReferences::remove(unsigned int n)
 SedExperimentReference*
 SedListOfExperimentReferences::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedExperimentReference>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedExperimentReference*> (item);
+  return static_cast <SedExperimentReference*> (removeItemById(sid));
 }
 
 
@@ -228,6 +235,47 @@ SedListOfExperimentReferences::addExperimentReference(const SedExperimentReferen
 }
 
 
+/*
+ * Adds the given SedExperimentReference to this SedListOfExperimentReferences,
+ * which takes ownership of it.
+ */
+int
+SedListOfExperimentReferences::addExperimentReference(std::unique_ptr<SedExperimentReference> ser)
+{
+  if (!ser)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ser->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ser.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ser->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ser->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ser->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ser.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(ser));
+  }
+}
+
+
 /*
  * Get the number of SedExperimentReference objects in this SedListOfExperimentReferences.
  */
@@ -250,7 +298,7 @@ SedListOfExperimentReferences::createExperimentReference()
 
   try
   {
-    ser = new SedExperimentReference(getSedNamespaces());
+    ser = new (getSedArena()) SedExperimentReference(getSedNamespaces());
   }
   catch (...)
   {
@@ -354,7 +402,7 @@ SedListOfExperimentReferences::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "experimentReference")
   {
-    object = new SedExperimentReference(getSedNamespaces());
+    object = new (getSedArena()) SedExperimentReference(getSedNamespaces());
     appendAndOwn(object);
   }
 
@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfExperimentReferences(SedNamespaces *sedmlns);
+  SedListOfExperimentReferences(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfExperimentReferences& operator=(const SedListOfExperimentReferences& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfExperimentReferences.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfExperimentReferences instance to move from.
+   */
+  SedListOfExperimentReferences(SedListOfExperimentReferences&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfExperimentReferences.
+   *
+   * @param rhs the SedListOfExperimentReferences object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfExperimentReferences& operator=(SedListOfExperimentReferences&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfExperimentReferences object.
    *
@@ -277,6 +299,28 @@ public:
   int addExperimentReference(const SedExperimentReference* ser);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedExperimentReference to this SedListOfExperimentReferences without copying it.
+   *
+   * @param ser the SedExperimentReference object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addExperimentReference(const SedExperimentReference* ser)
+   */
+  int addExperimentReference(std::unique_ptr<SedExperimentReference> ser);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedExperimentReference objects in this
    * SedListOfExperimentReferences.
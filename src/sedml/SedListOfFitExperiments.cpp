@@ -55,7 +55,6 @@ SedListOfFitExperiments::SedListOfFitExperiments(unsigned int level,
                                                  unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -63,7 +62,7 @@ SedListOfFitExperiments::SedListOfFitExperiments(unsigned int level,
  * Creates a new SedListOfFitExperiments using the given SedNamespaces object
  * @p sedmlns.
  */
-SedListOfFitExperiments::SedListOfFitExperiments(SedNamespaces *sedmlns)
+SedListOfFitExperiments::SedListOfFitExperiments(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -80,6 +79,15 @@ SedListOfFitExperiments::SedListOfFitExperiments(const SedListOfFitExperiments&
 }
 
 
+/*
+ * Move constructor for SedListOfFitExperiments.
+ */
+SedListOfFitExperiments::SedListOfFitExperiments(SedListOfFitExperiments&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfFitExperiments.
  */
@@ -95,6 +103,21 @@ SedListOfFitExperiments::operator=(const SedListOfFitExperiments& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfFitExperiments.
+ */
+SedListOfFitExperiments&
+SedListOfFitExperiments::operator=(SedListOfFitExperiments&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfFitExperiments object.
  */
@@ -152,11 +175,7 @@ SedListOfFitExperiments::get(const std::string& sid)
 const SedFitExperiment*
 SedListOfFitExperiments::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedFitExperiment>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedFitExperiment*>
-    (*result);
+  return static_cast <const SedFitExperiment*> (getItemById(sid));
 }
 
 
@@ -178,19 +197,7 @@ SedListOfFitExperiments::remove(unsigned int n)
 SedFitExperiment*
 SedListOfFitExperiments::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedFitExperiment>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedFitExperiment*> (item);
+  return static_cast <SedFitExperiment*> (removeItemById(sid));
 }
 
 
@@ -228,6 +235,47 @@ SedListOfFitExperiments::addFitExperiment(const SedFitExperiment* sfe)
 }
 
 
+/*
+ * Adds the given SedFitExperiment to this SedListOfFitExperiments,
+ * which takes ownership of it.
+ */
+int
+SedListOfFitExperiments::addFitExperiment(std::unique_ptr<SedFitExperiment> sfe)
+{
+  if (!sfe)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sfe->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sfe.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sfe->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sfe->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sfe->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sfe.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sfe));
+  }
+}
+
+
 /*
  * Get the number of SedFitExperiment objects in this SedListOfFitExperiments.
  */
@@ -250,7 +298,7 @@ SedListOfFitExperiments::createFitExperiment()
 
   try
   {
-    sfe = new SedFitExperiment(getSedNamespaces());
+    sfe = new (getSedArena()) SedFitExperiment(getSedNamespaces());
   }
   catch (...)
   {
@@ -312,7 +360,7 @@ SedListOfFitExperiments::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "fitExperiment")
   {
-    object = new SedFitExperiment(getSedNamespaces());
+    object = new (getSedArena()) SedFitExperiment(getSedNamespaces());
     appendAndOwn(object);
   }
 
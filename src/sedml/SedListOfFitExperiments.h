@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfFitExperiments(SedNamespaces *sedmlns);
+  SedListOfFitExperiments(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfFitExperiments& operator=(const SedListOfFitExperiments& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfFitExperiments.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfFitExperiments instance to move from.
+   */
+  SedListOfFitExperiments(SedListOfFitExperiments&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfFitExperiments.
+   *
+   * @param rhs the SedListOfFitExperiments object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfFitExperiments& operator=(SedListOfFitExperiments&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfFitExperiments object.
    *
@@ -277,6 +299,28 @@ public:
   int addFitExperiment(const SedFitExperiment* sfe);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedFitExperiment to this SedListOfFitExperiments without copying it.
+   *
+   * @param sfe the SedFitExperiment object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addFitExperiment(const SedFitExperiment* sfe)
+   */
+  int addFitExperiment(std::unique_ptr<SedFitExperiment> sfe);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedFitExperiment objects in this
    * SedListOfFitExperiments.
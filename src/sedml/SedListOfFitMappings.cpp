@@ -55,7 +55,6 @@ SedListOfFitMappings::SedListOfFitMappings(unsigned int level,
                                            unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -63,7 +62,7 @@ SedListOfFitMappings::SedListOfFitMappings(unsigned int level,
  * Creates a new SedListOfFitMappings using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfFitMappings::SedListOfFitMappings(SedNamespaces *sedmlns)
+SedListOfFitMappings::SedListOfFitMappings(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -79,6 +78,15 @@ SedListOfFitMappings::SedListOfFitMappings(const SedListOfFitMappings& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfFitMappings.
+ */
+SedListOfFitMappings::SedListOfFitMappings(SedListOfFitMappings&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfFitMappings.
  */
@@ -94,6 +102,21 @@ SedListOfFitMappings::operator=(const SedListOfFitMappings& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfFitMappings.
+ */
+SedListOfFitMappings&
+SedListOfFitMappings::operator=(SedListOfFitMappings&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfFitMappings object.
  */
@@ -149,10 +172,7 @@ SedListOfFitMappings::get(const std::string& sid)
 const SedFitMapping*
 SedListOfFitMappings::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedFitMapping>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedFitMapping*>
-    (*result);
+  return static_cast <const SedFitMapping*> (getItemById(sid));
 }
 
 
@@ -174,18 +194,7 @@ SedListOfFitMappings::remove(unsigned int n)
 SedFitMapping*
 SedListOfFitMappings::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedFitMapping>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedFitMapping*> (item);
+  return static_cast <SedFitMapping*> (removeItemById(sid));
 }
 
 
@@ -223,6 +232,47 @@ SedListOfFitMappings::addFitMapping(const SedFitMapping* sfm)
 }
 
 
+/*
+ * Adds the given SedFitMapping to this SedListOfFitMappings,
+ * which takes ownership of it.
+ */
+int
+SedListOfFitMappings::addFitMapping(std::unique_ptr<SedFitMapping> sfm)
+{
+  if (!sfm)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sfm->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sfm.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sfm->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sfm->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sfm->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sfm.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sfm));
+  }
+}
+
+
 /*
  * Get the number of SedFitMapping objects in this SedListOfFitMappings.
  */
@@ -244,7 +294,7 @@ SedListOfFitMappings::createFitMapping()
 
   try
   {
-    sfm = new SedFitMapping(getSedNamespaces());
+    sfm = new (getSedArena()) SedFitMapping(getSedNamespaces());
   }
   catch (...)
   {
@@ -432,7 +482,7 @@ SedListOfFitMappings::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "fitMapping")
   {
-    object = new SedFitMapping(getSedNamespaces());
+    object = new (getSedArena()) SedFitMapping(getSedNamespaces());
     appendAndOwn(object);
   }
 
@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfFitMappings(SedNamespaces *sedmlns);
+  SedListOfFitMappings(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfFitMappings& operator=(const SedListOfFitMappings& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfFitMappings.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfFitMappings instance to move from.
+   */
+  SedListOfFitMappings(SedListOfFitMappings&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfFitMappings.
+   *
+   * @param rhs the SedListOfFitMappings object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfFitMappings& operator=(SedListOfFitMappings&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfFitMappings object.
    *
@@ -274,6 +296,28 @@ public:
   int addFitMapping(const SedFitMapping* sfm);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedFitMapping to this SedListOfFitMappings without copying it.
+   *
+   * @param sfm the SedFitMapping object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addFitMapping(const SedFitMapping* sfm)
+   */
+  int addFitMapping(std::unique_ptr<SedFitMapping> sfm);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedFitMapping objects in this SedListOfFitMappings.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfModels::SedListOfModels(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -62,7 +61,7 @@ SedListOfModels::SedListOfModels(unsigned int level, unsigned int version)
  * Creates a new SedListOfModels using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfModels::SedListOfModels(SedNamespaces *sedmlns)
+SedListOfModels::SedListOfModels(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -78,6 +77,15 @@ SedListOfModels::SedListOfModels(const SedListOfModels& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfModels.
+ */
+SedListOfModels::SedListOfModels(SedListOfModels&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfModels.
  */
@@ -93,6 +101,21 @@ SedListOfModels::operator=(const SedListOfModels& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfModels.
+ */
+SedListOfModels&
+SedListOfModels::operator=(SedListOfModels&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfModels object.
  */
@@ -137,8 +160,8 @@ SedListOfModels::get(unsigned int n) const
 SedModel*
 SedListOfModels::get(const std::string& sid)
 {
-  return const_cast<SedModel*>(static_cast<const
-    SedListOfModels&>(*this).get(sid));
+  return static_cast<SedModel*>(unshareItem(static_cast<const
+    SedListOfModels&>(*this).get(sid)));
 }
 
 
@@ -148,10 +171,7 @@ SedListOfModels::get(const std::string& sid)
 const SedModel*
 SedListOfModels::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedModel>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedModel*>
-    (*result);
+  return static_cast <const SedModel*> (getItemById(sid));
 }
 
 
@@ -173,18 +193,7 @@ SedListOfModels::remove(unsigned int n)
 SedModel*
 SedListOfModels::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedModel>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedModel*> (item);
+  return static_cast <SedModel*> (removeItemById(sid));
 }
 
 
@@ -222,6 +231,47 @@ SedListOfModels::addModel(const SedModel* sm)
 }
 
 
+/*
+ * Adds the given SedModel to this SedListOfModels,
+ * which takes ownership of it.
+ */
+int
+SedListOfModels::addModel(std::unique_ptr<SedModel> sm)
+{
+  if (!sm)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sm->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sm.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sm->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sm->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sm->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sm.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sm));
+  }
+}
+
+
 /*
  * Get the number of SedModel objects in this SedListOfModels.
  */
@@ -243,7 +293,7 @@ SedListOfModels::createModel()
 
   try
   {
-    sm = new SedModel(getSedNamespaces());
+    sm = new (getSedArena()) SedModel(getSedNamespaces());
   }
   catch (...)
   {
@@ -305,7 +355,7 @@ SedListOfModels::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "model")
   {
-    object = new SedModel(getSedNamespaces());
+    object = new (getSedArena()) SedModel(getSedNamespaces());
     appendAndOwn(object);
   }
 
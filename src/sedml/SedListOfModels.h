@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfModels(SedNamespaces *sedmlns);
+  SedListOfModels(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfModels& operator=(const SedListOfModels& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfModels.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfModels instance to move from.
+   */
+  SedListOfModels(SedListOfModels&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfModels.
+   *
+   * @param rhs the SedListOfModels object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfModels& operator=(SedListOfModels&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfModels object.
    *
@@ -272,6 +294,28 @@ public:
   int addModel(const SedModel* sm);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedModel to this SedListOfModels without copying it.
+   *
+   * @param sm the SedModel object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addModel(const SedModel* sm)
+   */
+  int addModel(std::unique_ptr<SedModel> sm);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedModel objects in this SedListOfModels.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedListOfOutputs.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 #include <sedml/SedReport.h>
@@ -61,7 +62,6 @@ SedListOfOutputs::SedListOfOutputs(unsigned int level, unsigned int version)
   : SedListOf(level, version)
   , mElementName("listOfOutputs")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -69,7 +69,7 @@ SedListOfOutputs::SedListOfOutputs(unsigned int level, unsigned int version)
  * Creates a new SedListOfOutputs using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfOutputs::SedListOfOutputs(SedNamespaces *sedmlns)
+SedListOfOutputs::SedListOfOutputs(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
   , mElementName("listOfOutputs")
 {
@@ -87,6 +87,16 @@ SedListOfOutputs::SedListOfOutputs(const SedListOfOutputs& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfOutputs.
+ */
+SedListOfOutputs::SedListOfOutputs(SedListOfOutputs&& orig)
+  : SedListOf( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfOutputs.
  */
@@ -103,6 +113,22 @@ SedListOfOutputs::operator=(const SedListOfOutputs& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfOutputs.
+ */
+SedListOfOutputs&
+SedListOfOutputs::operator=(SedListOfOutputs&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfOutputs object.
  */
@@ -147,8 +173,8 @@ SedListOfOutputs::get(unsigned int n) const
 SedOutput*
 SedListOfOutputs::get(const std::string& sid)
 {
-  return const_cast<SedOutput*>(static_cast<const
-    SedListOfOutputs&>(*this).get(sid));
+  return static_cast<SedOutput*>(unshareItem(static_cast<const
+    SedListOfOutputs&>(*this).get(sid)));
 }
 
 
@@ -158,10 +184,7 @@ SedListOfOutputs::get(const std::string& sid)
 const SedOutput*
 SedListOfOutputs::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedOutput>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedOutput*>
-    (*result);
+  return static_cast <const SedOutput*> (getItemById(sid));
 }
 
 
@@ -183,18 +206,7 @@ SedListOfOutputs::remove(unsigned int n)
 SedOutput*
 SedListOfOutputs::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedOutput>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedOutput*> (item);
+  return static_cast <SedOutput*> (removeItemById(sid));
 }
 
 
@@ -232,6 +244,47 @@ SedListOfOutputs::addOutput(const SedOutput* so)
 }
 
 
+/*
+ * Adds the given SedOutput to this SedListOfOutputs,
+ * which takes ownership of it.
+ */
+int
+SedListOfOutputs::addOutput(std::unique_ptr<SedOutput> so)
+{
+  if (!so)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (so->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    so.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (so->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != so->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != so->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(so.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(so));
+  }
+}
+
+
 /*
  * Get the number of SedOutput objects in this SedListOfOutputs.
  */
@@ -253,7 +306,7 @@ SedListOfOutputs::createReport()
 
   try
   {
-    sr = new SedReport(getSedNamespaces());
+    sr = new (getSedArena()) SedReport(getSedNamespaces());
   }
   catch (...)
   {
@@ -279,7 +332,7 @@ SedListOfOutputs::createPlot2D()
 
   try
   {
-    spd = new SedPlot2D(getSedNamespaces());
+    spd = new (getSedArena()) SedPlot2D(getSedNamespaces());
   }
   catch (...)
   {
@@ -305,7 +358,7 @@ SedListOfOutputs::createPlot3D()
 
   try
   {
-    spd = new SedPlot3D(getSedNamespaces());
+    spd = new (getSedArena()) SedPlot3D(getSedNamespaces());
   }
   catch (...)
   {
@@ -331,7 +384,7 @@ SedListOfOutputs::createFigure()
 
   try
   {
-    sf = new SedFigure(getSedNamespaces());
+    sf = new (getSedArena()) SedFigure(getSedNamespaces());
   }
   catch (...)
   {
@@ -358,7 +411,7 @@ SedListOfOutputs::createParameterEstimationResultPlot()
 
   try
   {
-    sperp = new SedParameterEstimationResultPlot(getSedNamespaces());
+    sperp = new (getSedArena()) SedParameterEstimationResultPlot(getSedNamespaces());
   }
   catch (...)
   {
@@ -373,6 +426,36 @@ SedListOfOutputs::createParameterEstimationResultPlot()
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedListOfOutputs object to @p
+ * stream.
+ */
+void
+SedListOfOutputs::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedListOf::writeBinary(stream);
+
+  stream.writeString(mElementName);
+}
+
+
+/*
+ * Reads the attributes and children of this SedListOfOutputs object from @p
+ * stream.
+ */
+void
+SedListOfOutputs::readBinary(SedBinaryInputStream& stream)
+{
+  SedListOf::readBinary(stream);
+
+  stream.readString(mElementName);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedListOfOutputs object.
  */
@@ -434,37 +517,37 @@ SedListOfOutputs::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "output")
   {
-    object = new SedOutput(getSedNamespaces());
+    object = new (getSedArena()) SedOutput(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "report")
   {
-    object = new SedReport(getSedNamespaces());
+    object = new (getSedArena()) SedReport(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "plot2D")
   {
-    object = new SedPlot2D(getSedNamespaces());
+    object = new (getSedArena()) SedPlot2D(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "plot3D")
   {
-    object = new SedPlot3D(getSedNamespaces());
+    object = new (getSedArena()) SedPlot3D(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "figure")
   {
-    object = new SedFigure(getSedNamespaces());
+    object = new (getSedArena()) SedFigure(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "parameterEstimationResultPlot")
   {
-    object = new SedParameterEstimationResultPlot(getSedNamespaces());
+    object = new (getSedArena()) SedParameterEstimationResultPlot(getSedNamespaces());
     appendAndOwn(object);
   }
 
@@ -100,7 +100,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfOutputs(SedNamespaces *sedmlns);
+  SedListOfOutputs(const SedNamespaces *sedmlns);
 
 
   /**
@@ -120,6 +120,28 @@ public:
   SedListOfOutputs& operator=(const SedListOfOutputs& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfOutputs.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfOutputs instance to move from.
+   */
+  SedListOfOutputs(SedListOfOutputs&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfOutputs.
+   *
+   * @param rhs the SedListOfOutputs object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfOutputs& operator=(SedListOfOutputs&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfOutputs object.
    *
@@ -287,6 +309,28 @@ public:
   int addOutput(const SedOutput* so);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedOutput to this SedListOfOutputs without copying it.
+   *
+   * @param so the SedOutput object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addOutput(const SedOutput* so)
+   */
+  int addOutput(std::unique_ptr<SedOutput> so);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedOutput objects in this SedListOfOutputs.
    *
@@ -393,6 +437,22 @@ public:
   SedParameterEstimationResultPlot* createParameterEstimationResultPlot();
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedListOfOutputs object.
    *
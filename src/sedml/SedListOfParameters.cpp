@@ -55,7 +55,6 @@ SedListOfParameters::SedListOfParameters(unsigned int level,
                                          unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -63,7 +62,7 @@ SedListOfParameters::SedListOfParameters(unsigned int level,
  * Creates a new SedListOfParameters using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfParameters::SedListOfParameters(SedNamespaces *sedmlns)
+SedListOfParameters::SedListOfParameters(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -79,6 +78,15 @@ SedListOfParameters::SedListOfParameters(const SedListOfParameters& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfParameters.
+ */
+SedListOfParameters::SedListOfParameters(SedListOfParameters&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfParameters.
  */
@@ -94,6 +102,21 @@ SedListOfParameters::operator=(const SedListOfParameters& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfParameters.
+ */
+SedListOfParameters&
+SedListOfParameters::operator=(SedListOfParameters&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfParameters object.
  */
@@ -149,10 +172,7 @@ SedListOfParameters::get(const std::string& sid)
 const SedParameter*
 SedListOfParameters::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedParameter>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedParameter*>
-    (*result);
+  return static_cast <const SedParameter*> (getItemById(sid));
 }
 
 
@@ -174,18 +194,7 @@ SedListOfParameters::remove(unsigned int n)
 SedParameter*
 SedListOfParameters::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedParameter>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedParameter*> (item);
+  return static_cast <SedParameter*> (removeItemById(sid));
 }
 
 
@@ -223,6 +232,47 @@ SedListOfParameters::addParameter(const SedParameter* sp)
 }
 
 
+/*
+ * Adds the given SedParameter to this SedListOfParameters,
+ * which takes ownership of it.
+ */
+int
+SedListOfParameters::addParameter(std::unique_ptr<SedParameter> sp)
+{
+  if (!sp)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sp->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sp.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sp->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sp->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sp->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sp.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sp));
+  }
+}
+
+
 /*
  * Get the number of SedParameter objects in this SedListOfParameters.
  */
@@ -244,7 +294,7 @@ SedListOfParameters::createParameter()
 
   try
   {
-    sp = new SedParameter(getSedNamespaces());
+    sp = new (getSedArena()) SedParameter(getSedNamespaces());
   }
   catch (...)
   {
@@ -306,7 +356,7 @@ SedListOfParameters::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "parameter")
   {
-    object = new SedParameter(getSedNamespaces());
+    object = new (getSedArena()) SedParameter(getSedNamespaces());
     appendAndOwn(object);
   }
 
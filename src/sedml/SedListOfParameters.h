@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfParameters(SedNamespaces *sedmlns);
+  SedListOfParameters(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfParameters& operator=(const SedListOfParameters& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfParameters.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfParameters instance to move from.
+   */
+  SedListOfParameters(SedListOfParameters&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfParameters.
+   *
+   * @param rhs the SedListOfParameters object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfParameters& operator=(SedListOfParameters&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfParameters object.
    *
@@ -274,6 +296,28 @@ public:
   int addParameter(const SedParameter* sp);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedParameter to this SedListOfParameters without copying it.
+   *
+   * @param sp the SedParameter object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addParameter(const SedParameter* sp)
+   */
+  int addParameter(std::unique_ptr<SedParameter> sp);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedParameter objects in this SedListOfParameters.
    *
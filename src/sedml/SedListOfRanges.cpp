@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedListOfRanges.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 #include <sedml/SedUniformRange.h>
@@ -60,7 +61,6 @@ SedListOfRanges::SedListOfRanges(unsigned int level, unsigned int version)
   : SedListOf(level, version)
   , mElementName("listOfRanges")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -68,7 +68,7 @@ SedListOfRanges::SedListOfRanges(unsigned int level, unsigned int version)
  * Creates a new SedListOfRanges using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfRanges::SedListOfRanges(SedNamespaces *sedmlns)
+SedListOfRanges::SedListOfRanges(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
   , mElementName("listOfRanges")
 {
@@ -86,6 +86,16 @@ SedListOfRanges::SedListOfRanges(const SedListOfRanges& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfRanges.
+ */
+SedListOfRanges::SedListOfRanges(SedListOfRanges&& orig)
+  : SedListOf( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfRanges.
  */
@@ -102,6 +112,22 @@ SedListOfRanges::operator=(const SedListOfRanges& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfRanges.
+ */
+SedListOfRanges&
+SedListOfRanges::operator=(SedListOfRanges&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfRanges object.
  */
@@ -157,10 +183,7 @@ SedListOfRanges::get(const std::string& sid)
 const SedRange*
 SedListOfRanges::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedRange>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedRange*>
-    (*result);
+  return static_cast <const SedRange*> (getItemById(sid));
 }
 
 
@@ -182,18 +205,7 @@ SedListOfRanges::remove(unsigned int n)
 SedRange*
 SedListOfRanges::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedRange>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedRange*> (item);
+  return static_cast <SedRange*> (removeItemById(sid));
 }
 
 
@@ -231,6 +243,47 @@ SedListOfRanges::addRange(const SedRange* sr)
 }
 
 
+/*
+ * Adds the given SedRange to this SedListOfRanges,
+ * which takes ownership of it.
+ */
+int
+SedListOfRanges::addRange(std::unique_ptr<SedRange> sr)
+{
+  if (!sr)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sr->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sr.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sr->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sr->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sr->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sr.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sr));
+  }
+}
+
+
 /*
  * Get the number of SedRange objects in this SedListOfRanges.
  */
@@ -252,7 +305,7 @@ SedListOfRanges::createUniformRange()
 
   try
   {
-    sur = new SedUniformRange(getSedNamespaces());
+    sur = new (getSedArena()) SedUniformRange(getSedNamespaces());
   }
   catch (...)
   {
@@ -278,7 +331,7 @@ SedListOfRanges::createVectorRange()
 
   try
   {
-    svr = new SedVectorRange(getSedNamespaces());
+    svr = new (getSedArena()) SedVectorRange(getSedNamespaces());
   }
   catch (...)
   {
@@ -304,7 +357,7 @@ SedListOfRanges::createFunctionalRange()
 
   try
   {
-    sfr = new SedFunctionalRange(getSedNamespaces());
+    sfr = new (getSedArena()) SedFunctionalRange(getSedNamespaces());
   }
   catch (...)
   {
@@ -330,7 +383,7 @@ SedListOfRanges::createDataRange()
 
   try
   {
-    sdr = new SedDataRange(getSedNamespaces());
+    sdr = new (getSedArena()) SedDataRange(getSedNamespaces());
   }
   catch (...)
   {
@@ -345,6 +398,36 @@ SedListOfRanges::createDataRange()
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedListOfRanges object to @p
+ * stream.
+ */
+void
+SedListOfRanges::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedListOf::writeBinary(stream);
+
+  stream.writeString(mElementName);
+}
+
+
+/*
+ * Reads the attributes and children of this SedListOfRanges object from @p
+ * stream.
+ */
+void
+SedListOfRanges::readBinary(SedBinaryInputStream& stream)
+{
+  SedListOf::readBinary(stream);
+
+  stream.readString(mElementName);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedListOfRanges object.
  */
@@ -406,31 +489,31 @@ SedListOfRanges::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "range")
   {
-    object = new SedRange(getSedNamespaces());
+    object = new (getSedArena()) SedRange(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "uniformRange")
   {
-    object = new SedUniformRange(getSedNamespaces());
+    object = new (getSedArena()) SedUniformRange(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "vectorRange")
   {
-    object = new SedVectorRange(getSedNamespaces());
+    object = new (getSedArena()) SedVectorRange(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "functionalRange")
   {
-    object = new SedFunctionalRange(getSedNamespaces());
+    object = new (getSedArena()) SedFunctionalRange(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "dataRange")
   {
-    object = new SedDataRange(getSedNamespaces());
+    object = new (getSedArena()) SedDataRange(getSedNamespaces());
     appendAndOwn(object);
   }
 
@@ -99,7 +99,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfRanges(SedNamespaces *sedmlns);
+  SedListOfRanges(const SedNamespaces *sedmlns);
 
 
   /**
@@ -119,6 +119,28 @@ public:
   SedListOfRanges& operator=(const SedListOfRanges& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfRanges.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfRanges instance to move from.
+   */
+  SedListOfRanges(SedListOfRanges&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfRanges.
+   *
+   * @param rhs the SedListOfRanges object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfRanges& operator=(SedListOfRanges&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfRanges object.
    *
@@ -284,6 +306,28 @@ public:
   int addRange(const SedRange* sr);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedRange to this SedListOfRanges without copying it.
+   *
+   * @param sr the SedRange object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addRange(const SedRange* sr)
+   */
+  int addRange(std::unique_ptr<SedRange> sr);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedRange objects in this SedListOfRanges.
    *
@@ -371,6 +415,22 @@ public:
   SedDataRange* createDataRange();
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedListOfRanges object.
    *
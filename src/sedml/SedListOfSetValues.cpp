@@ -56,7 +56,6 @@ SedListOfSetValues::SedListOfSetValues(unsigned int level,
                                        unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -64,7 +63,7 @@ SedListOfSetValues::SedListOfSetValues(unsigned int level,
  * Creates a new SedListOfSetValues using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfSetValues::SedListOfSetValues(SedNamespaces *sedmlns)
+SedListOfSetValues::SedListOfSetValues(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -80,6 +79,15 @@ SedListOfSetValues::SedListOfSetValues(const SedListOfSetValues& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfSetValues.
+ */
+SedListOfSetValues::SedListOfSetValues(SedListOfSetValues&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfSetValues.
  */
@@ -95,6 +103,21 @@ SedListOfSetValues::operator=(const SedListOfSetValues& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfSetValues.
+ */
+SedListOfSetValues&
+SedListOfSetValues::operator=(SedListOfSetValues&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfSetValues object.
  */
@@ -150,10 +173,7 @@ SedListOfSetValues::get(const std::string& sid)
 const SedSetValue*
 SedListOfSetValues::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSetValue>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSetValue*>
-    (*result);
+  return static_cast <const SedSetValue*> (getItemById(sid));
 }
 
 
@@ -175,18 +195,7 @@ SedListOfSetValues::remove(unsigned int n)
 SedSetValue*
 SedListOfSetValues::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSetValue>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSetValue*> (item);
+  return static_cast <SedSetValue*> (removeItemById(sid));
 }
 
 
@@ -228,6 +237,51 @@ SedListOfSetValues::addTaskChange(const SedSetValue* ssv)
 }
 
 
+/*
+ * Adds the given SedSetValue to this SedListOfSetValues,
+ * which takes ownership of it.
+ */
+int
+SedListOfSetValues::addTaskChange(std::unique_ptr<SedSetValue> ssv)
+{
+  if (!ssv)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ssv->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ssv.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ssv->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ssv->hasRequiredElements() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ssv->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ssv->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ssv.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(ssv));
+  }
+}
+
+
 /*
  * Get the number of SedSetValue objects in this SedListOfSetValues.
  */
@@ -249,7 +303,7 @@ SedListOfSetValues::createSetValue()
 
   try
   {
-    ssv = new SedSetValue(getSedNamespaces());
+    ssv = new (getSedArena()) SedSetValue(getSedNamespaces());
   }
   catch (...)
   {
@@ -395,7 +449,7 @@ SedListOfSetValues::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "setValue")
   {
-    object = new SedSetValue(getSedNamespaces());
+    object = new (getSedArena()) SedSetValue(getSedNamespaces());
     appendAndOwn(object);
   }
 
@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfSetValues(SedNamespaces *sedmlns);
+  SedListOfSetValues(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfSetValues& operator=(const SedListOfSetValues& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfSetValues.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfSetValues instance to move from.
+   */
+  SedListOfSetValues(SedListOfSetValues&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfSetValues.
+   *
+   * @param rhs the SedListOfSetValues object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfSetValues& operator=(SedListOfSetValues&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfSetValues object.
    *
@@ -274,6 +296,28 @@ public:
   int addTaskChange(const SedSetValue* ssv);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSetValue to this SedListOfSetValues without copying it.
+   *
+   * @param ssv the SedSetValue object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addTaskChange(const SedSetValue* ssv)
+   */
+  int addTaskChange(std::unique_ptr<SedSetValue> ssv);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSetValue objects in this SedListOfSetValues.
    *
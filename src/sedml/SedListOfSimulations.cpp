@@ -60,7 +60,6 @@ SedListOfSimulations::SedListOfSimulations(unsigned int level,
                                            unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -68,7 +67,7 @@ SedListOfSimulations::SedListOfSimulations(unsigned int level,
  * Creates a new SedListOfSimulations using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfSimulations::SedListOfSimulations(SedNamespaces *sedmlns)
+SedListOfSimulations::SedListOfSimulations(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -84,6 +83,15 @@ SedListOfSimulations::SedListOfSimulations(const SedListOfSimulations& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfSimulations.
+ */
+SedListOfSimulations::SedListOfSimulations(SedListOfSimulations&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfSimulations.
  */
@@ -99,6 +107,21 @@ SedListOfSimulations::operator=(const SedListOfSimulations& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfSimulations.
+ */
+SedListOfSimulations&
+SedListOfSimulations::operator=(SedListOfSimulations&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfSimulations object.
  */
@@ -143,8 +166,8 @@ SedListOfSimulations::get(unsigned int n) const
 SedSimulation*
 SedListOfSimulations::get(const std::string& sid)
 {
-  return const_cast<SedSimulation*>(static_cast<const
-    SedListOfSimulations&>(*this).get(sid));
+  return static_cast<SedSimulation*>(unshareItem(static_cast<const
+    SedListOfSimulations&>(*this).get(sid)));
 }
 
 
@@ -154,10 +177,7 @@ SedListOfSimulations::get(const std::string& sid)
 const SedSimulation*
 SedListOfSimulations::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSimulation>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSimulation*>
-    (*result);
+  return static_cast <const SedSimulation*> (getItemById(sid));
 }
 
 
@@ -179,18 +199,7 @@ SedListOfSimulations::remove(unsigned int n)
 SedSimulation*
 SedListOfSimulations::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSimulation>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSimulation*> (item);
+  return static_cast <SedSimulation*> (removeItemById(sid));
 }
 
 
@@ -232,6 +241,51 @@ SedListOfSimulations::addSimulation(const SedSimulation* ss)
 }
 
 
+/*
+ * Adds the given SedSimulation to this SedListOfSimulations,
+ * which takes ownership of it.
+ */
+int
+SedListOfSimulations::addSimulation(std::unique_ptr<SedSimulation> ss)
+{
+  if (!ss)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ss->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ss.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ss->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ss->hasRequiredElements() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ss->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ss->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ss.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(ss));
+  }
+}
+
+
 /*
  * Get the number of SedSimulation objects in this SedListOfSimulations.
  */
@@ -254,7 +308,7 @@ SedListOfSimulations::createUniformTimeCourse()
 
   try
   {
-    sutc = new SedUniformTimeCourse(getSedNamespaces());
+    sutc = new (getSedArena()) SedUniformTimeCourse(getSedNamespaces());
   }
   catch (...)
   {
@@ -280,7 +334,7 @@ SedListOfSimulations::createOneStep()
 
   try
   {
-    sos = new SedOneStep(getSedNamespaces());
+    sos = new (getSedArena()) SedOneStep(getSedNamespaces());
   }
   catch (...)
   {
@@ -306,7 +360,7 @@ SedListOfSimulations::createSteadyState()
 
   try
   {
-    sss = new SedSteadyState(getSedNamespaces());
+    sss = new (getSedArena()) SedSteadyState(getSedNamespaces());
   }
   catch (...)
   {
@@ -332,7 +386,7 @@ SedListOfSimulations::createAnalysis()
 
     try
     {
-        sss = new SedAnalysis(getSedNamespaces());
+        sss = new (getSedArena()) SedAnalysis(getSedNamespaces());
     }
     catch (...)
     {
@@ -394,31 +448,31 @@ SedListOfSimulations::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "simulation")
   {
-    object = new SedSimulation(getSedNamespaces());
+    object = new (getSedArena()) SedSimulation(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "uniformTimeCourse")
   {
-    object = new SedUniformTimeCourse(getSedNamespaces());
+    object = new (getSedArena()) SedUniformTimeCourse(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "oneStep")
   {
-    object = new SedOneStep(getSedNamespaces());
+    object = new (getSedArena()) SedOneStep(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "steadyState")
   {
-    object = new SedSteadyState(getSedNamespaces());
+    object = new (getSedArena()) SedSteadyState(getSedNamespaces());
     appendAndOwn(object);
   }
 
   if (name == "analysis")
   {
-      object = new SedAnalysis(getSedNamespaces());
+      object = new (getSedArena()) SedAnalysis(getSedNamespaces());
       appendAndOwn(object);
   }
 
@@ -92,7 +92,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfSimulations(SedNamespaces *sedmlns);
+  SedListOfSimulations(const SedNamespaces *sedmlns);
 
 
   /**
@@ -112,6 +112,28 @@ public:
   SedListOfSimulations& operator=(const SedListOfSimulations& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfSimulations.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfSimulations instance to move from.
+   */
+  SedListOfSimulations(SedListOfSimulations&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfSimulations.
+   *
+   * @param rhs the SedListOfSimulations object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfSimulations& operator=(SedListOfSimulations&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfSimulations object.
    *
@@ -279,6 +301,28 @@ public:
   int addSimulation(const SedSimulation* ss);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSimulation to this SedListOfSimulations without copying it.
+   *
+   * @param ss the SedSimulation object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addSimulation(const SedSimulation* ss)
+   */
+  int addSimulation(std::unique_ptr<SedSimulation> ss);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSimulation objects in this SedListOfSimulations.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfSlices::SedListOfSlices(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -62,7 +61,7 @@ SedListOfSlices::SedListOfSlices(unsigned int level, unsigned int version)
  * Creates a new SedListOfSlices using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfSlices::SedListOfSlices(SedNamespaces *sedmlns)
+SedListOfSlices::SedListOfSlices(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -78,6 +77,15 @@ SedListOfSlices::SedListOfSlices(const SedListOfSlices& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfSlices.
+ */
+SedListOfSlices::SedListOfSlices(SedListOfSlices&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfSlices.
  */
@@ -93,6 +101,21 @@ SedListOfSlices::operator=(const SedListOfSlices& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfSlices.
+ */
+SedListOfSlices&
+SedListOfSlices::operator=(SedListOfSlices&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfSlices object.
  */
@@ -148,10 +171,7 @@ SedListOfSlices::get(const std::string& sid)
 const SedSlice*
 SedListOfSlices::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSlice>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSlice*>
-    (*result);
+  return static_cast <const SedSlice*> (getItemById(sid));
 }
 
 
@@ -173,18 +193,7 @@ SedListOfSlices::remove(unsigned int n)
 SedSlice*
 SedListOfSlices::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSlice>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSlice*> (item);
+  return static_cast <SedSlice*> (removeItemById(sid));
 }
 
 
@@ -222,6 +231,47 @@ SedListOfSlices::addSlice(const SedSlice* ss)
 }
 
 
+/*
+ * Adds the given SedSlice to this SedListOfSlices,
+ * which takes ownership of it.
+ */
+int
+SedListOfSlices::addSlice(std::unique_ptr<SedSlice> ss)
+{
+  if (!ss)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ss->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ss.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ss->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ss->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ss->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ss.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(ss));
+  }
+}
+
+
 /*
  * Get the number of SedSlice objects in this SedListOfSlices.
  */
@@ -243,7 +293,7 @@ SedListOfSlices::createSlice()
 
   try
   {
-    ss = new SedSlice(getSedNamespaces());
+    ss = new (getSedArena()) SedSlice(getSedNamespaces());
   }
   catch (...)
   {
@@ -387,7 +437,7 @@ SedListOfSlices::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "slice")
   {
-    object = new SedSlice(getSedNamespaces());
+    object = new (getSedArena()) SedSlice(getSedNamespaces());
     appendAndOwn(object);
   }
 
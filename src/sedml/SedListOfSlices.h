@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfSlices(SedNamespaces *sedmlns);
+  SedListOfSlices(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfSlices& operator=(const SedListOfSlices& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfSlices.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfSlices instance to move from.
+   */
+  SedListOfSlices(SedListOfSlices&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfSlices.
+   *
+   * @param rhs the SedListOfSlices object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfSlices& operator=(SedListOfSlices&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfSlices object.
    *
@@ -272,6 +294,28 @@ public:
   int addSlice(const SedSlice* ss);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSlice to this SedListOfSlices without copying it.
+   *
+   * @param ss the SedSlice object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addSlice(const SedSlice* ss)
+   */
+  int addSlice(std::unique_ptr<SedSlice> ss);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSlice objects in this SedListOfSlices.
    *
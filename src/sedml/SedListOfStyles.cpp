@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfStyles::SedListOfStyles(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -62,7 +61,7 @@ SedListOfStyles::SedListOfStyles(unsigned int level, unsigned int version)
  * Creates a new SedListOfStyles using the given SedNamespaces object @p
  * sedMLns.
  */
-SedListOfStyles::SedListOfStyles(SedNamespaces *sedMLns)
+SedListOfStyles::SedListOfStyles(const SedNamespaces *sedMLns)
   : SedListOf(sedMLns)
 {
   setElementNamespace(sedMLns->getURI());
@@ -78,6 +77,15 @@ SedListOfStyles::SedListOfStyles(const SedListOfStyles& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfStyles.
+ */
+SedListOfStyles::SedListOfStyles(SedListOfStyles&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfStyles.
  */
@@ -93,6 +101,21 @@ SedListOfStyles::operator=(const SedListOfStyles& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfStyles.
+ */
+SedListOfStyles&
+SedListOfStyles::operator=(SedListOfStyles&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfStyles object.
  */
@@ -137,8 +160,8 @@ SedListOfStyles::get(unsigned int n) const
 SedStyle*
 SedListOfStyles::get(const std::string& sid)
 {
-  return const_cast<SedStyle*>(static_cast<const
-    SedListOfStyles&>(*this).get(sid));
+  return static_cast<SedStyle*>(unshareItem(static_cast<const
+    SedListOfStyles&>(*this).get(sid)));
 }
 
 
@@ -148,10 +171,7 @@ SedListOfStyles::get(const std::string& sid)
 const SedStyle*
 SedListOfStyles::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedStyle>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedStyle*>
-    (*result);
+  return static_cast <const SedStyle*> (getItemById(sid));
 }
 
 
@@ -173,18 +193,7 @@ SedListOfStyles::remove(unsigned int n)
 SedStyle*
 SedListOfStyles::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedStyle>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedStyle*> (item);
+  return static_cast <SedStyle*> (removeItemById(sid));
 }
 
 
@@ -222,6 +231,47 @@ SedListOfStyles::addStyle(const SedStyle* ss)
 }
 
 
+/*
+ * Adds the given SedStyle to this SedListOfStyles,
+ * which takes ownership of it.
+ */
+int
+SedListOfStyles::addStyle(std::unique_ptr<SedStyle> ss)
+{
+  if (!ss)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ss->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ss.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ss->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ss->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ss->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ss.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(ss));
+  }
+}
+
+
 /*
  * Get the number of SedStyle objects in this SedListOfStyles.
  */
@@ -243,7 +293,7 @@ SedListOfStyles::createStyle()
 
   try
   {
-    ss = new SedStyle(getSedNamespaces());
+    ss = new (getSedArena()) SedStyle(getSedNamespaces());
   }
   catch (...)
   {
@@ -294,8 +344,8 @@ SedListOfStyles::getByBaseStyle(const std::string& sid) const
 SedStyle*
 SedListOfStyles::getByBaseStyle(const std::string& sid)
 {
-  return const_cast<SedStyle*>(static_cast<const
-    SedListOfStyles&>(*this).getByBaseStyle(sid));
+  return static_cast<SedStyle*>(unshareItem(static_cast<const
+    SedListOfStyles&>(*this).getByBaseStyle(sid)));
 }
 
 
@@ -346,7 +396,7 @@ SedListOfStyles::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "style")
   {
-    object = new SedStyle(getSedNamespaces());
+    object = new (getSedArena()) SedStyle(getSedNamespaces());
     appendAndOwn(object);
   }
 
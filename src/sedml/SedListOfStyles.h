@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfStyles(SedNamespaces *sedMLns);
+  SedListOfStyles(const SedNamespaces *sedMLns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfStyles& operator=(const SedListOfStyles& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfStyles.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfStyles instance to move from.
+   */
+  SedListOfStyles(SedListOfStyles&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfStyles.
+   *
+   * @param rhs the SedListOfStyles object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfStyles& operator=(SedListOfStyles&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfStyles object.
    *
@@ -272,6 +294,28 @@ public:
   int addStyle(const SedStyle* ss);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedStyle to this SedListOfStyles without copying it.
+   *
+   * @param ss the SedStyle object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addStyle(const SedStyle* ss)
+   */
+  int addStyle(std::unique_ptr<SedStyle> ss);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedStyle objects in this SedListOfStyles.
    *
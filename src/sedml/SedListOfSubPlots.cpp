@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfSubPlots::SedListOfSubPlots(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -62,7 +61,7 @@ SedListOfSubPlots::SedListOfSubPlots(unsigned int level, unsigned int version)
  * Creates a new SedListOfSubPlots using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfSubPlots::SedListOfSubPlots(SedNamespaces *sedmlns)
+SedListOfSubPlots::SedListOfSubPlots(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -78,6 +77,15 @@ SedListOfSubPlots::SedListOfSubPlots(const SedListOfSubPlots& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfSubPlots.
+ */
+SedListOfSubPlots::SedListOfSubPlots(SedListOfSubPlots&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfSubPlots.
  */
@@ -93,6 +101,21 @@ SedListOfSubPlots::operator=(const SedListOfSubPlots& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfSubPlots.
+ */
+SedListOfSubPlots&
+SedListOfSubPlots::operator=(SedListOfSubPlots&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfSubPlots object.
  */
@@ -148,10 +171,7 @@ SedListOfSubPlots::get(const std::string& sid)
 const SedSubPlot*
 SedListOfSubPlots::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSubPlot>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSubPlot*>
-    (*result);
+  return static_cast <const SedSubPlot*> (getItemById(sid));
 }
 
 
@@ -173,18 +193,7 @@ SedListOfSubPlots::remove(unsigned int n)
 SedSubPlot*
 SedListOfSubPlots::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSubPlot>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSubPlot*> (item);
+  return static_cast <SedSubPlot*> (removeItemById(sid));
 }
 
 
@@ -222,6 +231,47 @@ SedListOfSubPlots::addSubPlot(const SedSubPlot* ssp)
 }
 
 
+/*
+ * Adds the given SedSubPlot to this SedListOfSubPlots,
+ * which takes ownership of it.
+ */
+int
+SedListOfSubPlots::addSubPlot(std::unique_ptr<SedSubPlot> ssp)
+{
+  if (!ssp)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ssp->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ssp.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ssp->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ssp->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ssp->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ssp.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(ssp));
+  }
+}
+
+
 /*
  * Get the number of SedSubPlot objects in this SedListOfSubPlots.
  */
@@ -243,7 +293,7 @@ SedListOfSubPlots::createSubPlot()
 
   try
   {
-    ssp = new SedSubPlot(getSedNamespaces());
+    ssp = new (getSedArena()) SedSubPlot(getSedNamespaces());
   }
   catch (...)
   {
@@ -346,7 +396,7 @@ SedListOfSubPlots::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "subPlot")
   {
-    object = new SedSubPlot(getSedNamespaces());
+    object = new (getSedArena()) SedSubPlot(getSedNamespaces());
     appendAndOwn(object);
   }
 
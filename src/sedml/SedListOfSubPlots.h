@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfSubPlots(SedNamespaces *sedmlns);
+  SedListOfSubPlots(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfSubPlots& operator=(const SedListOfSubPlots& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfSubPlots.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfSubPlots instance to move from.
+   */
+  SedListOfSubPlots(SedListOfSubPlots&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfSubPlots.
+   *
+   * @param rhs the SedListOfSubPlots object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfSubPlots& operator=(SedListOfSubPlots&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfSubPlots object.
    *
@@ -274,6 +296,28 @@ public:
   int addSubPlot(const SedSubPlot* ssp);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSubPlot to this SedListOfSubPlots without copying it.
+   *
+   * @param ssp the SedSubPlot object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addSubPlot(const SedSubPlot* ssp)
+   */
+  int addSubPlot(std::unique_ptr<SedSubPlot> ssp);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSubPlot objects in this SedListOfSubPlots.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfSubTasks::SedListOfSubTasks(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -62,7 +61,7 @@ SedListOfSubTasks::SedListOfSubTasks(unsigned int level, unsigned int version)
  * Creates a new SedListOfSubTasks using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfSubTasks::SedListOfSubTasks(SedNamespaces *sedmlns)
+SedListOfSubTasks::SedListOfSubTasks(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -78,6 +77,15 @@ SedListOfSubTasks::SedListOfSubTasks(const SedListOfSubTasks& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfSubTasks.
+ */
+SedListOfSubTasks::SedListOfSubTasks(SedListOfSubTasks&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfSubTasks.
  */
@@ -93,6 +101,21 @@ SedListOfSubTasks::operator=(const SedListOfSubTasks& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfSubTasks.
+ */
+SedListOfSubTasks&
+SedListOfSubTasks::operator=(SedListOfSubTasks&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfSubTasks object.
  */
@@ -134,6 +157,12 @@ struct SubTaskOrderComparator
 void SedListOfSubTasks::sort()
 {
     std::sort(mItems.begin(), mItems.end(), SubTaskOrderComparator());
+
+    // the first of several items sharing an id may have changed
+    if (mIdIndexHasDuplicates)
+    {
+        invalidateIdIndex();
+    }
 }
 
 
@@ -175,10 +204,7 @@ SedListOfSubTasks::get(const std::string& sid)
 const SedSubTask*
 SedListOfSubTasks::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSubTask>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSubTask*>
-    (*result);
+  return static_cast <const SedSubTask*> (getItemById(sid));
 }
 
 
@@ -200,18 +226,7 @@ SedListOfSubTasks::remove(unsigned int n)
 SedSubTask*
 SedListOfSubTasks::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSubTask>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSubTask*> (item);
+  return static_cast <SedSubTask*> (removeItemById(sid));
 }
 
 
@@ -249,6 +264,47 @@ SedListOfSubTasks::addSubTask(const SedSubTask* sst)
 }
 
 
+/*
+ * Adds the given SedSubTask to this SedListOfSubTasks,
+ * which takes ownership of it.
+ */
+int
+SedListOfSubTasks::addSubTask(std::unique_ptr<SedSubTask> sst)
+{
+  if (!sst)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sst->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sst.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sst->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sst->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sst->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sst.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sst));
+  }
+}
+
+
 /*
  * Get the number of SedSubTask objects in this SedListOfSubTasks.
  */
@@ -270,7 +326,7 @@ SedListOfSubTasks::createSubTask()
 
   try
   {
-    sst = new SedSubTask(getSedNamespaces());
+    sst = new (getSedArena()) SedSubTask(getSedNamespaces());
   }
   catch (...)
   {
@@ -373,7 +429,7 @@ SedListOfSubTasks::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "subTask")
   {
-    object = new SedSubTask(getSedNamespaces());
+    object = new (getSedArena()) SedSubTask(getSedNamespaces());
     appendAndOwn(object);
   }
 
@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfSubTasks(SedNamespaces *sedmlns);
+  SedListOfSubTasks(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfSubTasks& operator=(const SedListOfSubTasks& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfSubTasks.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfSubTasks instance to move from.
+   */
+  SedListOfSubTasks(SedListOfSubTasks&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfSubTasks.
+   *
+   * @param rhs the SedListOfSubTasks object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfSubTasks& operator=(SedListOfSubTasks&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfSubTasks object.
    *
@@ -281,6 +303,28 @@ public:
   int addSubTask(const SedSubTask* sst);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSubTask to this SedListOfSubTasks without copying it.
+   *
+   * @param sst the SedSubTask object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addSubTask(const SedSubTask* sst)
+   */
+  int addSubTask(std::unique_ptr<SedSubTask> sst);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSubTask objects in this SedListOfSubTasks.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfSurfaces::SedListOfSurfaces(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -62,7 +61,7 @@ SedListOfSurfaces::SedListOfSurfaces(unsigned int level, unsigned int version)
  * Creates a new SedListOfSurfaces using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfSurfaces::SedListOfSurfaces(SedNamespaces *sedmlns)
+SedListOfSurfaces::SedListOfSurfaces(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -78,6 +77,15 @@ SedListOfSurfaces::SedListOfSurfaces(const SedListOfSurfaces& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfSurfaces.
+ */
+SedListOfSurfaces::SedListOfSurfaces(SedListOfSurfaces&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfSurfaces.
  */
@@ -93,6 +101,21 @@ SedListOfSurfaces::operator=(const SedListOfSurfaces& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfSurfaces.
+ */
+SedListOfSurfaces&
+SedListOfSurfaces::operator=(SedListOfSurfaces&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 struct SurfaceOrderComparator
 {
     // Compare two SedSubTasks objects using the 'order' attribute.
@@ -116,6 +139,12 @@ struct SurfaceOrderComparator
 void SedListOfSurfaces::sort()
 {
     std::sort(mItems.begin(), mItems.end(), SurfaceOrderComparator());
+
+    // the first of several items sharing an id may have changed
+    if (mIdIndexHasDuplicates)
+    {
+        invalidateIdIndex();
+    }
 }
 
 /*
@@ -173,10 +202,7 @@ SedListOfSurfaces::get(const std::string& sid)
 const SedSurface*
 SedListOfSurfaces::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSurface>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSurface*>
-    (*result);
+  return static_cast <const SedSurface*> (getItemById(sid));
 }
 
 
@@ -198,18 +224,7 @@ SedListOfSurfaces::remove(unsigned int n)
 SedSurface*
 SedListOfSurfaces::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSurface>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSurface*> (item);
+  return static_cast <SedSurface*> (removeItemById(sid));
 }
 
 
@@ -247,6 +262,47 @@ SedListOfSurfaces::addSurface(const SedSurface* ss)
 }
 
 
+/*
+ * Adds the given SedSurface to this SedListOfSurfaces,
+ * which takes ownership of it.
+ */
+int
+SedListOfSurfaces::addSurface(std::unique_ptr<SedSurface> ss)
+{
+  if (!ss)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ss->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ss.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ss->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ss->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ss->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ss.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(ss));
+  }
+}
+
+
 /*
  * Get the number of SedSurface objects in this SedListOfSurfaces.
  */
@@ -268,7 +324,7 @@ SedListOfSurfaces::createSurface()
 
   try
   {
-    ss = new SedSurface(getSedNamespaces());
+    ss = new (getSedArena()) SedSurface(getSedNamespaces());
   }
   catch (...)
   {
@@ -497,7 +553,7 @@ SedListOfSurfaces::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "surface")
   {
-    object = new SedSurface(getSedNamespaces());
+    object = new (getSedArena()) SedSurface(getSedNamespaces());
     appendAndOwn(object);
   }
 
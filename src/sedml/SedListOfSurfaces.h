@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfSurfaces(SedNamespaces *sedmlns);
+  SedListOfSurfaces(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfSurfaces& operator=(const SedListOfSurfaces& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfSurfaces.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfSurfaces instance to move from.
+   */
+  SedListOfSurfaces(SedListOfSurfaces&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfSurfaces.
+   *
+   * @param rhs the SedListOfSurfaces object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfSurfaces& operator=(SedListOfSurfaces&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Sort the SedListOfCurves according to the 'order' attribute.
    *
@@ -280,6 +302,28 @@ public:
   int addSurface(const SedSurface* ss);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSurface to this SedListOfSurfaces without copying it.
+   *
+   * @param ss the SedSurface object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addSurface(const SedSurface* ss)
+   */
+  int addSurface(std::unique_ptr<SedSurface> ss);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSurface objects in this SedListOfSurfaces.
    *
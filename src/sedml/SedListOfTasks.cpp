@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedListOfTasks.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 #include <sedml/SedTask.h>
@@ -59,7 +60,6 @@ SedListOfTasks::SedListOfTasks(unsigned int level, unsigned int version)
   : SedListOf(level, version)
   , mElementName("listOfTasks")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -67,7 +67,7 @@ SedListOfTasks::SedListOfTasks(unsigned int level, unsigned int version)
  * Creates a new SedListOfTasks using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfTasks::SedListOfTasks(SedNamespaces *sedmlns)
+SedListOfTasks::SedListOfTasks(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
   , mElementName("listOfTasks")
 {
@@ -85,6 +85,16 @@ SedListOfTasks::SedListOfTasks(const SedListOfTasks& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfTasks.
+ */
+SedListOfTasks::SedListOfTasks(SedListOfTasks&& orig)
+  : SedListOf( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfTasks.
  */
@@ -101,6 +111,22 @@ SedListOfTasks::operator=(const SedListOfTasks& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfTasks.
+ */
+SedListOfTasks&
+SedListOfTasks::operator=(SedListOfTasks&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfTasks object.
  */
@@ -145,8 +171,8 @@ SedListOfTasks::get(unsigned int n) const
 SedAbstractTask*
 SedListOfTasks::get(const std::string& sid)
 {
-  return const_cast<SedAbstractTask*>(static_cast<const
-    SedListOfTasks&>(*this).get(sid));
+  return static_cast<SedAbstractTask*>(unshareItem(static_cast<const
+    SedListOfTasks&>(*this).get(sid)));
 }
 
 
@@ -156,11 +182,7 @@ SedListOfTasks::get(const std::string& sid)
 const SedAbstractTask*
 SedListOfTasks::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAbstractTask>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedAbstractTask*>
-    (*result);
+  return static_cast <const SedAbstractTask*> (getItemById(sid));
 }
 
 
@@ -182,19 +204,7 @@ SedListOfTasks::remove(unsigned int n)
 SedAbstractTask*
 SedListOfTasks::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAbstractTask>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedAbstractTask*> (item);
+  return static_cast <SedAbstractTask*> (removeItemById(sid));
 }
 
 
@@ -232,6 +242,47 @@ SedListOfTasks::addAbstractTask(const SedAbstractTask* sat)
 }
 
 
+/*
+ * Adds the given SedAbstractTask to this SedListOfTasks,
+ * which takes ownership of it.
+ */
+int
+SedListOfTasks::addAbstractTask(std::unique_ptr<SedAbstractTask> sat)
+{
+  if (!sat)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sat->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sat.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sat->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sat->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sat->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sat.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sat));
+  }
+}
+
+
 /*
  * Get the number of SedAbstractTask objects in this SedListOfTasks.
  */
@@ -253,7 +304,7 @@ SedListOfTasks::createTask()
 
   try
   {
-    st = new SedTask(getSedNamespaces());
+    st = new (getSedArena()) SedTask(getSedNamespaces());
   }
   catch (...)
   {
@@ -279,7 +330,7 @@ SedListOfTasks::createRepeatedTask()
 
   try
   {
-    srt = new SedRepeatedTask(getSedNamespaces());
+    srt = new (getSedArena()) SedRepeatedTask(getSedNamespaces());
   }
   catch (...)
   {
@@ -306,7 +357,7 @@ SedListOfTasks::createParameterEstimationTask()
 
   try
   {
-    spet = new SedParameterEstimationTask(getSedNamespaces());
+    spet = new (getSedArena()) SedParameterEstimationTask(getSedNamespaces());
   }
   catch (...)
   {
@@ -321,6 +372,36 @@ SedListOfTasks::createParameterEstimationTask()
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedListOfTasks object to @p
+ * stream.
+ */
+void
+SedListOfTasks::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedListOf::writeBinary(stream);
+
+  stream.writeString(mElementName);
+}
+
+
+/*
+ * Reads the attributes and children of this SedListOfTasks object from @p
+ * stream.
+ */
+void
+SedListOfTasks::readBinary(SedBinaryInputStream& stream)
+{
+  SedListOf::readBinary(stream);
+
+  stream.readString(mElementName);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedListOfTasks object.
  */
@@ -382,7 +463,7 @@ SedListOfTasks::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "task")
   {
-    object = new SedTask(getSedNamespaces());
+    object = new (getSedArena()) SedTask(getSedNamespaces());
     if (object)
     {
       dynamic_cast<SedAbstractTask*>(object)->setElementName(name);
@@ -393,7 +474,7 @@ SedListOfTasks::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "repeatedTask")
   {
-    object = new SedRepeatedTask(getSedNamespaces());
+    object = new (getSedArena()) SedRepeatedTask(getSedNamespaces());
     if (object)
     {
       dynamic_cast<SedAbstractTask*>(object)->setElementName(name);
@@ -404,7 +485,7 @@ SedListOfTasks::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "parameterEstimationTask")
   {
-    object = new SedParameterEstimationTask(getSedNamespaces());
+    object = new (getSedArena()) SedParameterEstimationTask(getSedNamespaces());
     if (object)
     {
       dynamic_cast<SedAbstractTask*>(object)->setElementName(name);
@@ -98,7 +98,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfTasks(SedNamespaces *sedmlns);
+  SedListOfTasks(const SedNamespaces *sedmlns);
 
 
   /**
@@ -118,6 +118,28 @@ public:
   SedListOfTasks& operator=(const SedListOfTasks& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfTasks.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfTasks instance to move from.
+   */
+  SedListOfTasks(SedListOfTasks&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfTasks.
+   *
+   * @param rhs the SedListOfTasks object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfTasks& operator=(SedListOfTasks&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfTasks object.
    *
@@ -285,6 +307,28 @@ public:
   int addAbstractTask(const SedAbstractTask* sat);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAbstractTask to this SedListOfTasks without copying it.
+   *
+   * @param sat the SedAbstractTask object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addAbstractTask(const SedAbstractTask* sat)
+   */
+  int addAbstractTask(std::unique_ptr<SedAbstractTask> sat);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAbstractTask objects in this SedListOfTasks.
    *
@@ -355,6 +399,22 @@ public:
   SedParameterEstimationTask* createParameterEstimationTask();
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedListOfTasks object.
    *
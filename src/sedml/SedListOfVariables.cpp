@@ -56,7 +56,6 @@ SedListOfVariables::SedListOfVariables(unsigned int level,
                                        unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -64,7 +63,7 @@ SedListOfVariables::SedListOfVariables(unsigned int level,
  * Creates a new SedListOfVariables using the given SedNamespaces object @p
  * sedmlns.
  */
-SedListOfVariables::SedListOfVariables(SedNamespaces *sedmlns)
+SedListOfVariables::SedListOfVariables(const SedNamespaces *sedmlns)
   : SedListOf(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -80,6 +79,15 @@ SedListOfVariables::SedListOfVariables(const SedListOfVariables& orig)
 }
 
 
+/*
+ * Move constructor for SedListOfVariables.
+ */
+SedListOfVariables::SedListOfVariables(SedListOfVariables&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedListOfVariables.
  */
@@ -95,6 +103,21 @@ SedListOfVariables::operator=(const SedListOfVariables& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedListOfVariables.
+ */
+SedListOfVariables&
+SedListOfVariables::operator=(SedListOfVariables&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfVariables object.
  */
@@ -150,10 +173,7 @@ SedListOfVariables::get(const std::string& sid)
 const SedVariable*
 SedListOfVariables::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedVariable>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedVariable*>
-    (*result);
+  return static_cast <const SedVariable*> (getItemById(sid));
 }
 
 
@@ -175,18 +195,7 @@ SedListOfVariables::remove(unsigned int n)
 SedVariable*
 SedListOfVariables::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedVariable>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedVariable*> (item);
+  return static_cast <SedVariable*> (removeItemById(sid));
 }
 
 
@@ -224,6 +233,47 @@ SedListOfVariables::addVariable(const SedVariable* sv)
 }
 
 
+/*
+ * Adds the given SedVariable to this SedListOfVariables,
+ * which takes ownership of it.
+ */
+int
+SedListOfVariables::addVariable(std::unique_ptr<SedVariable> sv)
+{
+  if (!sv)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sv->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sv.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sv->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sv->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sv->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sv.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return appendAndOwn(std::move(sv));
+  }
+}
+
+
 /*
  * Get the number of SedVariable objects in this SedListOfVariables.
  */
@@ -245,7 +295,7 @@ SedListOfVariables::createVariable()
 
   try
   {
-    sv = new SedVariable(getSedNamespaces());
+    sv = new (getSedArena()) SedVariable(getSedNamespaces());
   }
   catch (...)
   {
@@ -407,7 +457,7 @@ SedListOfVariables::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
   if (name == "variable")
   {
-    object = new SedVariable(getSedNamespaces());
+    object = new (getSedArena()) SedVariable(getSedNamespaces());
     appendAndOwn(object);
   }
 
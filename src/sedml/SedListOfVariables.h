@@ -87,7 +87,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedListOfVariables(SedNamespaces *sedmlns);
+  SedListOfVariables(const SedNamespaces *sedmlns);
 
 
   /**
@@ -107,6 +107,28 @@ public:
   SedListOfVariables& operator=(const SedListOfVariables& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedListOfVariables.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedListOfVariables instance to move from.
+   */
+  SedListOfVariables(SedListOfVariables&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfVariables.
+   *
+   * @param rhs the SedListOfVariables object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedListOfVariables& operator=(SedListOfVariables&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfVariables object.
    *
@@ -274,6 +296,28 @@ public:
   int addVariable(const SedVariable* sv);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedVariable to this SedListOfVariables without copying it.
+   *
+   * @param sv the SedVariable object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addVariable(const SedVariable* sv)
+   */
+  int addVariable(std::unique_ptr<SedVariable> sv);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedVariable objects in this SedListOfVariables.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedMarker.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -60,14 +61,13 @@ SedMarker::SedMarker(unsigned int level, unsigned int version)
   , mLineThickness (util_NaN())
   , mIsSetLineThickness (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedMarker using the given SedNamespaces object @p sedmlns.
  */
-SedMarker::SedMarker(SedNamespaces *sedmlns)
+SedMarker::SedMarker(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mSize (util_NaN())
   , mIsSetSize (false)
@@ -97,6 +97,22 @@ SedMarker::SedMarker(const SedMarker& orig)
 }
 
 
+/*
+ * Move constructor for SedMarker.
+ */
+SedMarker::SedMarker(SedMarker&& orig)
+  : SedBase( std::move(orig) )
+  , mSize ( std::move(orig.mSize) )
+  , mIsSetSize ( std::move(orig.mIsSetSize) )
+  , mType ( std::move(orig.mType) )
+  , mFill ( std::move(orig.mFill) )
+  , mLineColor ( std::move(orig.mLineColor) )
+  , mLineThickness ( std::move(orig.mLineThickness) )
+  , mIsSetLineThickness ( std::move(orig.mIsSetLineThickness) )
+{
+}
+
+
 /*
  * Assignment operator for SedMarker.
  */
@@ -119,6 +135,28 @@ SedMarker::operator=(const SedMarker& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedMarker.
+ */
+SedMarker&
+SedMarker::operator=(SedMarker&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mSize = std::move(rhs.mSize);
+    mIsSetSize = std::move(rhs.mIsSetSize);
+    mType = std::move(rhs.mType);
+    mFill = std::move(rhs.mFill);
+    mLineColor = std::move(rhs.mLineColor);
+    mLineThickness = std::move(rhs.mLineThickness);
+    mIsSetLineThickness = std::move(rhs.mIsSetLineThickness);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedMarker object.
  */
@@ -256,6 +294,8 @@ SedMarker::isSetLineThickness() const
 int
 SedMarker::setSize(double size)
 {
+  invalidateEffectiveStyles();
+
   mSize = size;
   mIsSetSize = true;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -268,6 +308,8 @@ SedMarker::setSize(double size)
 int
 SedMarker::setType(const MarkerType_t type)
 {
+  invalidateEffectiveStyles();
+
   if (MarkerType_isValid(type) == 0)
   {
     mType = SEDML_MARKERTYPE_INVALID;
@@ -287,6 +329,8 @@ SedMarker::setType(const MarkerType_t type)
 int
 SedMarker::setType(const std::string& type)
 {
+  invalidateEffectiveStyles();
+
   mType = MarkerType_fromString(type.c_str());
 
   if (mType == SEDML_MARKERTYPE_INVALID)
@@ -304,6 +348,8 @@ SedMarker::setType(const std::string& type)
 int
 SedMarker::setFill(const std::string& fill)
 {
+  invalidateEffectiveStyles();
+
   mFill = fill;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -315,6 +361,8 @@ SedMarker::setFill(const std::string& fill)
 int
 SedMarker::setLineColor(const std::string& lineColor)
 {
+  invalidateEffectiveStyles();
+
   mLineColor = lineColor;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -326,6 +374,8 @@ SedMarker::setLineColor(const std::string& lineColor)
 int
 SedMarker::setLineThickness(double lineThickness)
 {
+  invalidateEffectiveStyles();
+
   mLineThickness = lineThickness;
   mIsSetLineThickness = true;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -338,6 +388,8 @@ SedMarker::setLineThickness(double lineThickness)
 int
 SedMarker::unsetSize()
 {
+  invalidateEffectiveStyles();
+
   mSize = util_NaN();
   mIsSetSize = false;
 
@@ -358,6 +410,8 @@ SedMarker::unsetSize()
 int
 SedMarker::unsetType()
 {
+  invalidateEffectiveStyles();
+
   mType = SEDML_MARKERTYPE_INVALID;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -369,6 +423,8 @@ SedMarker::unsetType()
 int
 SedMarker::unsetFill()
 {
+  invalidateEffectiveStyles();
+
   mFill.erase();
 
   if (mFill.empty() == true)
@@ -388,6 +444,8 @@ SedMarker::unsetFill()
 int
 SedMarker::unsetLineColor()
 {
+  invalidateEffectiveStyles();
+
   mLineColor.erase();
 
   if (mLineColor.empty() == true)
@@ -407,6 +465,8 @@ SedMarker::unsetLineColor()
 int
 SedMarker::unsetLineThickness()
 {
+  invalidateEffectiveStyles();
+
   mLineThickness = util_NaN();
   mIsSetLineThickness = false;
 
@@ -421,6 +481,62 @@ SedMarker::unsetLineThickness()
 }
 
 
+/*
+ * Adds the memory held by this SedMarker object to @p usage.
+ */
+void
+SedMarker::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedMarker) - sizeof(SedBase));
+  usage.addString(type, mFill);
+  usage.addString(type, mLineColor);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedMarker object to @p stream.
+ */
+void
+SedMarker::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeDouble(mSize);
+  stream.writeBool(mIsSetSize);
+  stream.writeInt(mType);
+  stream.writeString(mFill);
+  stream.writeString(mLineColor);
+  stream.writeDouble(mLineThickness);
+  stream.writeBool(mIsSetLineThickness);
+}
+
+
+/*
+ * Reads the attributes and children of this SedMarker object from @p stream.
+ */
+void
+SedMarker::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  mSize = stream.readDouble();
+  mIsSetSize = stream.readBool();
+  mType = static_cast<MarkerType_t>(stream.readInt());
+  stream.readString(mFill);
+  stream.readString(mLineColor);
+  mLineThickness = stream.readDouble();
+  mIsSetLineThickness = stream.readBool();
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedMarker object.
  */
@@ -145,7 +145,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedMarker(SedNamespaces *sedmlns);
+  SedMarker(const SedNamespaces *sedmlns);
 
 
   /**
@@ -165,6 +165,28 @@ public:
   SedMarker& operator=(const SedMarker& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedMarker.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedMarker instance to move from.
+   */
+  SedMarker(SedMarker&& orig);
+
+
+  /**
+   * Move assignment operator for SedMarker.
+   *
+   * @param rhs the SedMarker object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedMarker& operator=(SedMarker&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedMarker object.
    *
@@ -452,6 +474,28 @@ public:
   int unsetLineThickness();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedMarker object.
    *
@@ -0,0 +1,530 @@
+/**
+ * @file SedMemoryUsage.cpp
+ * @brief Implementation of the SedMemoryUsage class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedMemoryUsage.h>
+#include <sedml/SedNamespaces.h>
+#include <sedml/common/SedInternedString.h>
+
+#include <sbml/math/ASTNode.h>
+#include <sbml/xml/XMLNode.h>
+#include <sbml/xml/XMLOutputStream.h>
+#include <numl/DimensionDescription.h>
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+LIBNUML_CPP_NAMESPACE_USE
+
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Creates a new, empty SedMemoryUsage.
+ */
+SedMemoryUsage::SedMemoryUsage()
+  : mTypes (SEDML_LIST_OF + 1)
+  , mShared ()
+  , mStringBytes (0)
+  , mMathBytes (0)
+  , mXMLBytes (0)
+  , mNamespacesBytes (0)
+  , mDimensionDescriptionBytes (0)
+  , mVectorValuesBytes (0)
+{
+  clear();
+}
+
+
+/*
+ * Destructor for SedMemoryUsage.
+ */
+SedMemoryUsage::~SedMemoryUsage()
+{
+}
+
+
+/*
+ * Resets all the counts of this SedMemoryUsage to zero.
+ */
+void
+SedMemoryUsage::clear()
+{
+  for (vector<TypeUsage>::iterator it = mTypes.begin(); it != mTypes.end();
+    ++it)
+  {
+    it->objects = 0;
+    it->bytes = 0;
+  }
+
+  mShared.clear();
+  mStringBytes = 0;
+  mMathBytes = 0;
+  mXMLBytes = 0;
+  mNamespacesBytes = 0;
+  mDimensionDescriptionBytes = 0;
+  mVectorValuesBytes = 0;
+}
+
+
+/*
+ * Returns the number of objects of the given type.
+ */
+unsigned int
+SedMemoryUsage::getNumObjects(int type) const
+{
+  if (type < 0 || type >= (int)mTypes.size())
+  {
+    return 0;
+  }
+
+  return mTypes[type].objects;
+}
+
+
+/*
+ * Returns the number of bytes held by the objects of the given type.
+ */
+size_t
+SedMemoryUsage::getBytes(int type) const
+{
+  if (type < 0 || type >= (int)mTypes.size())
+  {
+    return 0;
+  }
+
+  return mTypes[type].bytes;
+}
+
+
+/*
+ * Returns the total number of objects counted.
+ */
+unsigned int
+SedMemoryUsage::getTotalObjects() const
+{
+  unsigned int total = 0;
+  for (vector<TypeUsage>::const_iterator it = mTypes.begin();
+    it != mTypes.end(); ++it)
+  {
+    total += it->objects;
+  }
+
+  return total;
+}
+
+
+/*
+ * Returns the total number of bytes counted.
+ */
+size_t
+SedMemoryUsage::getTotalBytes() const
+{
+  size_t total = 0;
+  for (vector<TypeUsage>::const_iterator it = mTypes.begin();
+    it != mTypes.end(); ++it)
+  {
+    total += it->bytes;
+  }
+
+  return total;
+}
+
+
+/*
+ * Returns the bytes held by strings.
+ */
+size_t
+SedMemoryUsage::getStringBytes() const
+{
+  return mStringBytes;
+}
+
+
+/*
+ * Returns the bytes held by math.
+ */
+size_t
+SedMemoryUsage::getMathBytes() const
+{
+  return mMathBytes;
+}
+
+
+/*
+ * Returns the bytes held by XMLNode trees.
+ */
+size_t
+SedMemoryUsage::getXMLBytes() const
+{
+  return mXMLBytes;
+}
+
+
+/*
+ * Returns the bytes held by SedNamespaces objects.
+ */
+size_t
+SedMemoryUsage::getNamespacesBytes() const
+{
+  return mNamespacesBytes;
+}
+
+
+/*
+ * Returns the bytes held by DimensionDescription objects.
+ */
+size_t
+SedMemoryUsage::getDimensionDescriptionBytes() const
+{
+  return mDimensionDescriptionBytes;
+}
+
+
+/*
+ * Returns the bytes held by vector range values.
+ */
+size_t
+SedMemoryUsage::getVectorValuesBytes() const
+{
+  return mVectorValuesBytes;
+}
+
+
+/*
+ * Returns a human-readable table of the counts.
+ */
+std::string
+SedMemoryUsage::toString() const
+{
+  ostringstream os;
+
+  os << left << setw(28) << "type" << right << setw(10) << "objects"
+     << setw(14) << "bytes" << "\n";
+
+  for (size_t type = 0; type < mTypes.size(); ++type)
+  {
+    if (mTypes[type].objects == 0 && mTypes[type].bytes == 0)
+    {
+      continue;
+    }
+
+    os << left << setw(28) << SedTypeCode_toString((int)type)
+       << right << setw(10) << mTypes[type].objects
+       << setw(14) << mTypes[type].bytes << "\n";
+  }
+
+  os << left << setw(28) << "total" << right << setw(10)
+     << getTotalObjects() << setw(14) << getTotalBytes() << "\n"
+     << "\n"
+     << left << setw(38) << "strings" << right << setw(14) << mStringBytes
+     << "\n"
+     << left << setw(38) << "math" << right << setw(14) << mMathBytes << "\n"
+     << left << setw(38) << "xml" << right << setw(14) << mXMLBytes << "\n"
+     << left << setw(38) << "namespaces" << right << setw(14)
+     << mNamespacesBytes << "\n"
+     << left << setw(38) << "dimension descriptions" << right << setw(14)
+     << mDimensionDescriptionBytes << "\n"
+     << left << setw(38) << "vector values" << right << setw(14)
+     << mVectorValuesBytes << "\n";
+
+  return os.str();
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Counts one object of the given type, of the given size.
+ */
+void
+SedMemoryUsage::addObject(int type, size_t bytes)
+{
+  TypeUsage& usage = getTypeUsage(type);
+  usage.objects++;
+  usage.bytes += bytes;
+}
+
+
+/*
+ * Adds bytes to the given type without counting a new object.
+ */
+void
+SedMemoryUsage::addBytes(int type, size_t bytes)
+{
+  getTypeUsage(type).bytes += bytes;
+}
+
+
+/*
+ * Adds the heap bytes of a string owned by an object of the given type; the
+ * std::string itself is part of the size of the object.
+ */
+void
+SedMemoryUsage::addString(int type, const std::string& value)
+{
+  size_t bytes = getHeapBytes(value);
+  mStringBytes += bytes;
+  addBytes(type, bytes);
+}
+
+
+/*
+ * Adds an interned string. The object only holds a pointer; the shared
+ * std::string is counted under the first object that refers to it.
+ */
+void
+SedMemoryUsage::addString(int type, const SedInternedString& value)
+{
+  if (value.empty() || !mShared.insert(&value.str()).second)
+  {
+    return;
+  }
+
+  size_t bytes = sizeof(std::string) + getHeapBytes(value.str());
+  mStringBytes += bytes;
+  addBytes(type, bytes);
+}
+
+
+/*
+ * Adds the estimated size of a math tree.
+ */
+void
+SedMemoryUsage::addMath(int type, const ASTNode* math)
+{
+  size_t bytes = getMathBytes(math);
+  mMathBytes += bytes;
+  addBytes(type, bytes);
+}
+
+
+/*
+ * Adds the estimated size of an XMLNode tree.
+ */
+void
+SedMemoryUsage::addXML(int type, const XMLNode* node)
+{
+  if (node == NULL)
+  {
+    return;
+  }
+
+  size_t bytes = getXMLBytes(*node);
+  mXMLBytes += bytes;
+  addBytes(type, bytes);
+}
+
+
+/*
+ * Adds a SedNamespaces object; shared ones are counted only once.
+ */
+void
+SedMemoryUsage::addNamespaces(int type, const SedNamespaces* sedns)
+{
+  if (sedns == NULL || !mShared.insert(sedns).second)
+  {
+    return;
+  }
+
+  size_t bytes = sizeof(SedNamespaces);
+
+  const XMLNamespaces* xmlns = sedns->getNamespaces();
+  if (xmlns != NULL)
+  {
+    bytes += sizeof(XMLNamespaces);
+    for (int i = 0; i < xmlns->getLength(); ++i)
+    {
+      bytes += 2 * sizeof(std::string) + getHeapBytes(xmlns->getPrefix(i)) +
+        getHeapBytes(xmlns->getURI(i));
+    }
+  }
+
+  mNamespacesBytes += bytes;
+  addBytes(type, bytes);
+}
+
+
+/*
+ * Adds the estimated size of a NuML DimensionDescription. Its content is
+ * not accessible generically, so the size of its serialization is used as
+ * a stand-in for the data it holds.
+ */
+void
+SedMemoryUsage::addDimensionDescription(int type,
+  const DimensionDescription* dd)
+{
+  if (dd == NULL)
+  {
+    return;
+  }
+
+  ostringstream os;
+  XMLOutputStream stream(os, "UTF-8", false);
+  dd->write(stream);
+
+  size_t bytes = sizeof(DimensionDescription) + os.str().size();
+  mDimensionDescriptionBytes += bytes;
+  addBytes(type, bytes);
+}
+
+
+/*
+ * Adds the storage of the values of a SedVectorRange.
+ */
+void
+SedMemoryUsage::addVectorValues(int type, const std::vector<double>& values)
+{
+  size_t bytes = values.capacity() * sizeof(double);
+  mVectorValuesBytes += bytes;
+  addBytes(type, bytes);
+}
+
+
+/*
+ * Returns the heap bytes of a string: none if the characters are stored in
+ * the std::string itself (short string optimization), otherwise the
+ * capacity plus the terminator.
+ */
+size_t
+SedMemoryUsage::getHeapBytes(const std::string& value)
+{
+  const char* data = value.data();
+  const char* self = reinterpret_cast<const char*>(&value);
+
+  if (data >= self && data < self + sizeof(std::string))
+  {
+    return 0;
+  }
+
+  return value.capacity() + 1;
+}
+
+
+/*
+ * Returns the TypeUsage for the given type; unknown types are counted as
+ * SEDML_UNKNOWN.
+ */
+SedMemoryUsage::TypeUsage&
+SedMemoryUsage::getTypeUsage(int type)
+{
+  if (type < 0 || type >= (int)mTypes.size())
+  {
+    type = SEDML_UNKNOWN;
+  }
+
+  return mTypes[type];
+}
+
+
+/*
+ * Returns the estimated size of an XMLNode and its descendants.
+ */
+size_t
+SedMemoryUsage::getXMLBytes(const XMLNode& node) const
+{
+  size_t bytes = sizeof(XMLNode) + getHeapBytes(node.getName()) +
+    getHeapBytes(node.getPrefix()) + getHeapBytes(node.getURI()) +
+    getHeapBytes(node.getCharacters());
+
+  const XMLAttributes& attributes = node.getAttributes();
+  for (int i = 0; i < attributes.getLength(); ++i)
+  {
+    bytes += 4 * sizeof(std::string) + getHeapBytes(attributes.getName(i)) +
+      getHeapBytes(attributes.getPrefix(i)) +
+      getHeapBytes(attributes.getURI(i)) +
+      getHeapBytes(attributes.getValue(i));
+  }
+
+  const XMLNamespaces& namespaces = node.getNamespaces();
+  for (int i = 0; i < namespaces.getLength(); ++i)
+  {
+    bytes += 2 * sizeof(std::string) + getHeapBytes(namespaces.getPrefix(i))
+      + getHeapBytes(namespaces.getURI(i));
+  }
+
+  for (unsigned int n = 0; n < node.getNumChildren(); ++n)
+  {
+    bytes += getXMLBytes(node.getChild(n));
+  }
+
+  return bytes;
+}
+
+
+/*
+ * Returns the estimated size of a math tree: the nodes, their names and
+ * the list cells linking each node to its parent.
+ */
+size_t
+SedMemoryUsage::getMathBytes(const ASTNode* math) const
+{
+  if (math == NULL)
+  {
+    return 0;
+  }
+
+  size_t bytes = sizeof(ASTNode);
+
+  if (math->getName() != NULL)
+  {
+    bytes += strlen(math->getName()) + 1;
+  }
+
+  for (unsigned int n = 0; n < math->getNumChildren(); ++n)
+  {
+    bytes += 2 * sizeof(void*) + getMathBytes(math->getChild(n));
+  }
+
+  return bytes;
+}
+
+/** @endcond */
+
+
+#endif /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
@@ -0,0 +1,335 @@
+/**
+ * @file SedMemoryUsage.h
+ * @brief Definition of the SedMemoryUsage class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedMemoryUsage
+ * @sbmlbrief{} Breakdown of the heap memory held by a SED-ML object tree.
+ *
+ * A SedMemoryUsage is filled in by SedBase::getMemoryUsage() (usually
+ * called on a SedDocument). For every
+ * @if clike #SedTypeCode_t@else type code@endif@~ it records the number of
+ * objects of that type and the bytes they hold: the objects themselves
+ * plus the strings, math, notes, annotations and other data they own. The
+ * same bytes are also totalled by category (strings, math, XML, ...), so
+ * that it is easy to see what a large document spends its memory on.
+ *
+ * The object and string sizes are exact for the standard library in use;
+ * the sizes of ASTNode, XMLNode and NuML DimensionDescription trees are
+ * estimates, since those classes do not expose their layout. Data shared
+ * between objects (interned attribute values, SedNamespaces) is counted
+ * once, under the first object that refers to it.
+ */
+
+
+#ifndef SedMemoryUsage_h
+#define SedMemoryUsage_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+#include <sedml/SedTypeCodes.h>
+
+
+#ifdef __cplusplus
+
+
+#include <string>
+#include <vector>
+#include <unordered_set>
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class XMLNode;
+class ASTNode;
+
+LIBSBML_CPP_NAMESPACE_END
+
+LIBNUML_CPP_NAMESPACE_BEGIN
+
+class DimensionDescription;
+
+LIBNUML_CPP_NAMESPACE_END
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedInternedString;
+class SedNamespaces;
+
+
+class LIBSEDML_EXTERN SedMemoryUsage
+{
+public:
+
+  /**
+   * Creates a new, empty SedMemoryUsage.
+   */
+  SedMemoryUsage();
+
+
+  /**
+   * Destructor for SedMemoryUsage.
+   */
+  virtual ~SedMemoryUsage();
+
+
+  /**
+   * Resets all the counts of this SedMemoryUsage to zero.
+   */
+  void clear();
+
+
+  /**
+   * Returns the number of objects of the given type.
+   *
+   * @param type the @if clike #SedTypeCode_t@else int@endif@~ of the
+   * objects.
+   *
+   * @return the number of objects of type @p type that were counted.
+   */
+  unsigned int getNumObjects(int type) const;
+
+
+  /**
+   * Returns the number of bytes held by the objects of the given type,
+   * including the data they own.
+   *
+   * @param type the @if clike #SedTypeCode_t@else int@endif@~ of the
+   * objects.
+   *
+   * @return the bytes held by the objects of type @p type.
+   */
+  size_t getBytes(int type) const;
+
+
+  /**
+   * Returns the total number of objects counted.
+   *
+   * @return the number of objects of all types.
+   */
+  unsigned int getTotalObjects() const;
+
+
+  /**
+   * Returns the total number of bytes counted.
+   *
+   * @return the bytes held by the objects of all types.
+   */
+  size_t getTotalBytes() const;
+
+
+  /**
+   * Returns the bytes held by strings (attribute values, identifiers,
+   * unparsed notes and annotations).
+   *
+   * @return the bytes held by strings.
+   */
+  size_t getStringBytes() const;
+
+
+  /**
+   * Returns the (estimated) bytes held by ASTNode math trees.
+   *
+   * @return the bytes held by math.
+   */
+  size_t getMathBytes() const;
+
+
+  /**
+   * Returns the (estimated) bytes held by XMLNode trees: parsed notes,
+   * annotations and the XML of SedAddXML and SedChangeXML.
+   *
+   * @return the bytes held by XMLNode trees.
+   */
+  size_t getXMLBytes() const;
+
+
+  /**
+   * Returns the bytes held by SedNamespaces objects.
+   *
+   * @return the bytes held by SedNamespaces.
+   */
+  size_t getNamespacesBytes() const;
+
+
+  /**
+   * Returns the (estimated) bytes held by NuML DimensionDescription
+   * objects.
+   *
+   * @return the bytes held by DimensionDescription objects.
+   */
+  size_t getDimensionDescriptionBytes() const;
+
+
+  /**
+   * Returns the bytes held by the values of SedVectorRange objects.
+   *
+   * @return the bytes held by vector range values.
+   */
+  size_t getVectorValuesBytes() const;
+
+
+  /**
+   * Returns a human-readable table of the counts, one line per type that
+   * has objects, followed by the totals per category.
+   *
+   * @return the table as a string.
+   */
+  std::string toString() const;
+
+
+#ifndef SWIG
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /*
+   * Counts one object of the given type, of the given size.
+   */
+  void addObject(int type, size_t bytes);
+
+
+  /*
+   * Adds bytes to the given type without counting a new object.
+   */
+  void addBytes(int type, size_t bytes);
+
+
+  /*
+   * Adds the heap bytes of a string owned by an object of the given type.
+   */
+  void addString(int type, const std::string& value);
+
+
+  /*
+   * Adds an interned string; the shared value is counted only once.
+   */
+  void addString(int type, const SedInternedString& value);
+
+
+  /*
+   * Adds the estimated size of a math tree.
+   */
+  void addMath(int type, const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math);
+
+
+  /*
+   * Adds the estimated size of an XMLNode tree.
+   */
+  void addXML(int type, const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* node);
+
+
+  /*
+   * Adds a SedNamespaces object; shared ones are counted only once.
+   */
+  void addNamespaces(int type, const SedNamespaces* sedns);
+
+
+  /*
+   * Adds the estimated size of a NuML DimensionDescription.
+   */
+  void addDimensionDescription(int type,
+    const LIBNUML_CPP_NAMESPACE_QUALIFIER DimensionDescription* dd);
+
+
+  /*
+   * Adds the storage of the values of a SedVectorRange.
+   */
+  void addVectorValues(int type, const std::vector<double>& values);
+
+
+  /*
+   * Adds the estimated size of an unordered_map keyed by std::string, such
+   * as the id indexes of SedListOf and SedDocument.
+   */
+  template <typename Index>
+  void addIndex(int type, const Index& index)
+  {
+    size_t bytes = index.bucket_count() * sizeof(void*);
+    for (typename Index::const_iterator it = index.begin();
+      it != index.end(); ++it)
+    {
+      bytes += sizeof(typename Index::value_type) + 2 * sizeof(void*) +
+        getHeapBytes(it->first);
+    }
+
+    addBytes(type, bytes);
+  }
+
+
+  /*
+   * Returns the heap bytes of a string, excluding the std::string itself.
+   */
+  static size_t getHeapBytes(const std::string& value);
+
+  /** @endcond */
+
+#endif  /* !SWIG */
+
+
+private:
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  struct TypeUsage
+  {
+    unsigned int objects;
+    size_t bytes;
+  };
+
+  TypeUsage& getTypeUsage(int type);
+
+  size_t getXMLBytes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode& node) const;
+
+  size_t getMathBytes(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
+    const;
+
+  std::vector<TypeUsage> mTypes;
+  std::unordered_set<const void*> mShared;
+
+  size_t mStringBytes;
+  size_t mMathBytes;
+  size_t mXMLBytes;
+  size_t mNamespacesBytes;
+  size_t mDimensionDescriptionBytes;
+  size_t mVectorValuesBytes;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedMemoryUsage_h */
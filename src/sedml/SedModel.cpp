@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedModel.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfModels.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -63,7 +64,6 @@ SedModel::SedModel(unsigned int level, unsigned int version)
   , mSource ("")
   , mChanges (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -73,7 +73,7 @@ SedModel::SedModel(unsigned int level, unsigned int version)
 /*
  * Creates a new SedModel using the given SedNamespaces object @p sedmlns.
  */
-SedModel::SedModel(SedNamespaces *sedmlns)
+SedModel::SedModel(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mLanguage ("")
   , mSource ("")
@@ -99,6 +99,19 @@ SedModel::SedModel(const SedModel& orig)
 }
 
 
+/*
+ * Move constructor for SedModel.
+ */
+SedModel::SedModel(SedModel&& orig)
+  : SedBase( std::move(orig) )
+  , mLanguage ( std::move(orig.mLanguage) )
+  , mSource ( std::move(orig.mSource) )
+  , mChanges ( std::move(orig.mChanges) )
+{
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedModel.
  */
@@ -118,6 +131,26 @@ SedModel::operator=(const SedModel& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedModel.
+ */
+SedModel&
+SedModel::operator=(SedModel&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mLanguage = std::move(rhs.mLanguage);
+    mSource = std::move(rhs.mSource);
+    mChanges = std::move(rhs.mChanges);
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedModel object.
  */
@@ -310,6 +343,46 @@ SedModel::addChange(const SedChange* sc)
 }
 
 
+/*
+ * Adds the given SedChange to this SedModel, which takes ownership of it.
+ */
+int
+SedModel::addChange(std::unique_ptr<SedChange> sc)
+{
+  if (!sc)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sc->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sc.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sc->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sc->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sc->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sc.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return mChanges.appendAndOwn(std::move(sc));
+  }
+}
+
+
 /*
  * Get the number of SedChange objects in this SedModel.
  */
@@ -331,7 +404,7 @@ SedModel::createAddXML()
 
   try
   {
-    saxml = new SedAddXML(getSedNamespaces());
+    saxml = new (getSedArena()) SedAddXML(getSedNamespaces());
   }
   catch (...)
   {
@@ -357,7 +430,7 @@ SedModel::createChangeXML()
 
   try
   {
-    scxml = new SedChangeXML(getSedNamespaces());
+    scxml = new (getSedArena()) SedChangeXML(getSedNamespaces());
   }
   catch (...)
   {
@@ -383,7 +456,7 @@ SedModel::createRemoveXML()
 
   try
   {
-    srxml = new SedRemoveXML(getSedNamespaces());
+    srxml = new (getSedArena()) SedRemoveXML(getSedNamespaces());
   }
   catch (...)
   {
@@ -409,7 +482,7 @@ SedModel::createChangeAttribute()
 
   try
   {
-    sca = new SedChangeAttribute(getSedNamespaces());
+    sca = new (getSedArena()) SedChangeAttribute(getSedNamespaces());
   }
   catch (...)
   {
@@ -435,7 +508,7 @@ SedModel::createComputeChange()
 
   try
   {
-    scc = new SedComputeChange(getSedNamespaces());
+    scc = new (getSedArena()) SedComputeChange(getSedNamespaces());
   }
   catch (...)
   {
@@ -460,6 +533,61 @@ SedModel::removeChange(unsigned int n)
 }
 
 
+/*
+ * Adds the memory held by this SedModel object to @p usage.
+ */
+void
+SedModel::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedModel) - sizeof(SedBase) -
+    sizeof(SedListOfChanges));
+  usage.addString(type, mLanguage);
+  usage.addString(type, mSource);
+
+  if (mChanges.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mChanges.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedModel object to @p stream.
+ */
+void
+SedModel::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mLanguage);
+  stream.writeString(mSource);
+  mChanges.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedModel object from @p stream.
+ */
+void
+SedModel::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mLanguage);
+  stream.readString(mSource);
+  mChanges.readBinary(stream);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedModel object.
  */
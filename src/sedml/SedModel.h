@@ -93,7 +93,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedModel(SedNamespaces *sedmlns);
+  SedModel(const SedNamespaces *sedmlns);
 
 
   /**
@@ -113,6 +113,28 @@ public:
   SedModel& operator=(const SedModel& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedModel.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedModel instance to move from.
+   */
+  SedModel(SedModel&& orig);
+
+
+  /**
+   * Move assignment operator for SedModel.
+   *
+   * @param rhs the SedModel object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedModel& operator=(SedModel&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedModel object.
    *
@@ -315,6 +337,28 @@ public:
   int addChange(const SedChange* sc);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedChange to this SedModel without copying it.
+   *
+   * @param sc the SedChange object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addChange(const SedChange* sc)
+   */
+  int addChange(std::unique_ptr<SedChange> sc);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedChange objects in this SedModel.
    *
@@ -440,6 +484,28 @@ public:
   SedChange* removeChange(unsigned int n);
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedModel object.
    *
@@ -37,6 +37,9 @@
 #include <sstream>
 #include <sedml/common/common.h>
 #include <iostream>
+#include <atomic>
+#include <map>
+#include <mutex>
 
 /** @cond doxygenIgnored */
 
@@ -95,6 +98,7 @@ SedNamespaces::SedNamespaces(unsigned int level, unsigned int version)
  : mLevel(level)
   ,mVersion(version)
   ,mNamespaces(NULL)
+  ,mIsShared(false)
 {
   initSedNamespace();
 }
@@ -114,6 +118,7 @@ SedNamespaces::SedNamespaces(const SedNamespaces& orig)
  : mLevel(orig.mLevel)
  , mVersion(orig.mVersion)
  , mNamespaces(NULL)
+ , mIsShared(false)
 {
   if(orig.mNamespaces != NULL)
     this->mNamespaces = 
@@ -458,6 +463,336 @@ SedNamespaces::setNamespaces(XMLNamespaces * xmlns)
   else
     mNamespaces = NULL;
 }
+
+
+/*
+ * A SedNamespaces shared by SED-ML objects.  The instances for SED-ML
+ * Level 1 Versions 1-4, with just the default namespace declaration and
+ * without any declaration, are permanent; all others are reference counted
+ * and kept in the SedSharedNamespacesTable.
+ */
+class SedSharedNamespaces : public SedNamespaces
+{
+public:
+  SedSharedNamespaces(unsigned int level, unsigned int version,
+                      const XMLNamespaces* xmlns, bool permanent)
+    : SedNamespaces(level, version)
+    , mReferences(0)
+    , mPermanent(permanent)
+  {
+    setNamespaces(const_cast<XMLNamespaces*>(xmlns));
+    mLevel = level;
+    mVersion = version;
+    mIsShared = true;
+  }
+
+  std::atomic<unsigned int> mReferences;
+  bool mPermanent;
+};
+
+
+/*
+ * The permanent shared instances, indexed by version - 1, and the
+ * permanent interned URIs: the empty one and the SED-ML ones.
+ */
+struct SedPermanentNamespaces
+{
+  SedPermanentNamespaces()
+  {
+    mURIs[0] = new std::string("");
+    for (unsigned int version = 1; version <= 4; ++version)
+    {
+      SedNamespaces defaults(1, version);
+      mDefault[version - 1] =
+        new SedSharedNamespaces(1, version, defaults.getNamespaces(), true);
+      mUndeclared[version - 1] =
+        new SedSharedNamespaces(1, version, NULL, true);
+      mURIs[version] =
+        new std::string(SedNamespaces::getSedNamespaceURI(1, version));
+    }
+  }
+
+  bool isPermanentURI(const std::string* uri) const
+  {
+    for (size_t i = 0; i < 5; ++i)
+    {
+      if (mURIs[i] == uri)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  SedSharedNamespaces* mDefault[4];
+  SedSharedNamespaces* mUndeclared[4];
+  const std::string* mURIs[5];
+};
+
+
+/*
+ * The reference counted shared instances, keyed by level, version and
+ * namespace declarations, and the reference counted interned URIs.
+ * Entries whose count dropped to zero stay available for reuse until the
+ * table grows beyond sMaxIdleEntries.
+ */
+struct SedSharedNamespacesTable
+{
+  std::mutex mMutex;
+  std::map<std::string, SedSharedNamespaces*> mEntries;
+  std::map<std::string, size_t> mURIs;
+};
+
+
+static const size_t sMaxIdleEntries = 64;
+
+
+// both are created on first use and deliberately never destroyed, as SED-ML
+// objects may still release their namespaces during static destruction
+static const SedPermanentNamespaces&
+getPermanentNamespaces()
+{
+  static const SedPermanentNamespaces* permanent = new SedPermanentNamespaces();
+  return *permanent;
+}
+
+
+static SedSharedNamespacesTable&
+getSharedNamespacesTable()
+{
+  static SedSharedNamespacesTable* table = new SedSharedNamespacesTable();
+  return *table;
+}
+
+
+static bool
+isDefaultDeclaration(unsigned int level, unsigned int version,
+                     const XMLNamespaces* xmlns)
+{
+  return xmlns->getLength() == 1 && xmlns->getPrefix(0).empty() &&
+    xmlns->getURI(0) == SedNamespaces::getSedNamespaceURI(level, version);
+}
+
+
+static std::string
+getSharedKey(unsigned int level, unsigned int version,
+             const XMLNamespaces* xmlns)
+{
+  std::string key = std::to_string(level);
+  key += ' ';
+  key += std::to_string(version);
+
+  if (xmlns == NULL)
+  {
+    key += " -";
+  }
+  else
+  {
+    for (int i = 0; i < xmlns->getLength(); ++i)
+    {
+      key += ' ';
+      key += xmlns->getPrefix(i);
+      key += '=';
+      key += xmlns->getURI(i);
+    }
+  }
+
+  return key;
+}
+
+
+SedNamespaces*
+SedNamespaces::getShared(const SedNamespaces* sedmlns)
+{
+  if (sedmlns == NULL)
+  {
+    return NULL;
+  }
+
+  if (sedmlns->mIsShared)
+  {
+    SedSharedNamespaces* shared =
+      static_cast<SedSharedNamespaces*>(const_cast<SedNamespaces*>(sedmlns));
+    if (!shared->mPermanent)
+    {
+      ++shared->mReferences;
+    }
+    return shared;
+  }
+
+  return getShared(sedmlns->mLevel, sedmlns->mVersion, sedmlns->mNamespaces);
+}
+
+
+SedNamespaces*
+SedNamespaces::getShared(unsigned int level, unsigned int version,
+                         const XMLNamespaces* xmlns)
+{
+  if (level == 1 && version >= 1 && version <= 4)
+  {
+    const SedPermanentNamespaces& permanent = getPermanentNamespaces();
+    if (xmlns == NULL)
+    {
+      return permanent.mUndeclared[version - 1];
+    }
+    else if (isDefaultDeclaration(level, version, xmlns))
+    {
+      return permanent.mDefault[version - 1];
+    }
+  }
+
+  const std::string key = getSharedKey(level, version, xmlns);
+  SedSharedNamespacesTable& table = getSharedNamespacesTable();
+  std::lock_guard<std::mutex> lock(table.mMutex);
+
+  std::map<std::string, SedSharedNamespaces*>::iterator it =
+    table.mEntries.find(key);
+  if (it != table.mEntries.end())
+  {
+    ++it->second->mReferences;
+    return it->second;
+  }
+
+  // references are only taken while the table is locked, or from a holder
+  // of another reference, so an idle entry cannot be revived while purging
+  if (table.mEntries.size() >= sMaxIdleEntries)
+  {
+    for (it = table.mEntries.begin(); it != table.mEntries.end(); )
+    {
+      if (it->second->mReferences == 0)
+      {
+        delete it->second;
+        table.mEntries.erase(it++);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+
+  SedSharedNamespaces* shared =
+    new SedSharedNamespaces(level, version, xmlns, false);
+  shared->mReferences = 1;
+  table.mEntries.insert(std::make_pair(key, shared));
+  return shared;
+}
+
+
+SedNamespaces*
+SedNamespaces::getShared(unsigned int level, unsigned int version)
+{
+  if (level == 1 && version >= 1 && version <= 4)
+  {
+    return getPermanentNamespaces().mDefault[version - 1];
+  }
+
+  SedNamespaces sedmlns(level, version);
+  return getShared(&sedmlns);
+}
+
+
+void
+SedNamespaces::releaseShared(SedNamespaces* sedmlns)
+{
+  if (sedmlns == NULL)
+  {
+    return;
+  }
+
+  if (!sedmlns->mIsShared)
+  {
+    delete sedmlns;
+    return;
+  }
+
+  SedSharedNamespaces* shared = static_cast<SedSharedNamespaces*>(sedmlns);
+  if (!shared->mPermanent)
+  {
+    --shared->mReferences;
+  }
+}
+
+
+bool
+SedNamespaces::isShared() const
+{
+  return mIsShared;
+}
+
+
+const std::string*
+SedNamespaces::internURI(const std::string& uri)
+{
+  const SedPermanentNamespaces& permanent = getPermanentNamespaces();
+  for (size_t i = 0; i < 5; ++i)
+  {
+    if (*permanent.mURIs[i] == uri)
+    {
+      return permanent.mURIs[i];
+    }
+  }
+
+  SedSharedNamespacesTable& table = getSharedNamespacesTable();
+  std::lock_guard<std::mutex> lock(table.mMutex);
+
+  std::map<std::string, size_t>::iterator it = table.mURIs.find(uri);
+  if (it == table.mURIs.end())
+  {
+    if (table.mURIs.size() >= sMaxIdleEntries)
+    {
+      for (it = table.mURIs.begin(); it != table.mURIs.end(); )
+      {
+        if (it->second == 0)
+        {
+          table.mURIs.erase(it++);
+        }
+        else
+        {
+          ++it;
+        }
+      }
+    }
+
+    it = table.mURIs.insert(std::make_pair(uri, (size_t)0)).first;
+  }
+
+  ++it->second;
+  return &it->first;
+}
+
+
+const std::string*
+SedNamespaces::retainURI(const std::string* uri)
+{
+  if (uri == NULL || getPermanentNamespaces().isPermanentURI(uri))
+  {
+    return uri;
+  }
+
+  SedSharedNamespacesTable& table = getSharedNamespacesTable();
+  std::lock_guard<std::mutex> lock(table.mMutex);
+  ++table.mURIs[*uri];
+  return uri;
+}
+
+
+void
+SedNamespaces::releaseURI(const std::string* uri)
+{
+  if (uri == NULL || getPermanentNamespaces().isPermanentURI(uri))
+  {
+    return;
+  }
+
+  SedSharedNamespacesTable& table = getSharedNamespacesTable();
+  std::lock_guard<std::mutex> lock(table.mMutex);
+  std::map<std::string, size_t>::iterator it = table.mURIs.find(*uri);
+  if (it != table.mURIs.end() && it->second > 0)
+  {
+    --it->second;
+  }
+}
 /** @endcond */
 
 #endif /* __cplusplus */
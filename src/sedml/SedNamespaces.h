@@ -277,6 +277,68 @@ public:
 
 
   void setNamespaces(XMLNamespaces * xmlns);
+
+
+  /*
+   * Returns the shared SedNamespaces equal to @p sedmlns and holds a
+   * reference to it for the caller.
+   *
+   * SED-ML objects point at shared instances instead of owning a copy each;
+   * a shared instance must never be modified, and every reference obtained
+   * here must be given back through releaseShared().
+   */
+  static SedNamespaces* getShared(const SedNamespaces* sedmlns);
+
+
+  /*
+   * Returns the shared SedNamespaces with the given level, version and
+   * namespace declarations (which may be NULL); see getShared().
+   */
+  static SedNamespaces* getShared(unsigned int level, unsigned int version,
+                                  const XMLNamespaces* xmlns);
+
+
+  /*
+   * Returns the shared SedNamespaces equal to SedNamespaces(level, version);
+   * see getShared().
+   */
+  static SedNamespaces* getShared(unsigned int level, unsigned int version);
+
+
+  /*
+   * Gives back a reference obtained from getShared().  A SedNamespaces that
+   * is not shared is deleted instead.
+   */
+  static void releaseShared(SedNamespaces* sedmlns);
+
+
+  /*
+   * Predicate returning @c true if this SedNamespaces is shared, and hence
+   * read-only.
+   */
+  bool isShared() const;
+
+
+  /*
+   * Returns a string equal to @p uri that stays alive until it is given
+   * back with releaseURI(), so SED-ML objects can refer to their element
+   * namespace by pointer.  The empty URI and the SED-ML URIs are never
+   * destroyed; other URIs are reference counted like the shared
+   * SedNamespaces, and purged once no object uses them.
+   */
+  static const std::string* internURI(const std::string& uri);
+
+
+  /*
+   * Takes another reference to a string returned by internURI().
+   */
+  static const std::string* retainURI(const std::string* uri);
+
+
+  /*
+   * Gives back a reference obtained from internURI() or retainURI().
+   */
+  static void releaseURI(const std::string* uri);
   /** @endcond */
 
 protected:  
@@ -286,6 +348,7 @@ protected:
   unsigned int    mLevel;
   unsigned int    mVersion;
   XMLNamespaces * mNamespaces;
+  bool            mIsShared;
 
   /** @endcond */
 };
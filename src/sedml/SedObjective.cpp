@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedObjective.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 #include <sedml/SedLeastSquareObjectiveFunction.h>
@@ -57,14 +58,13 @@ SedObjective::SedObjective(unsigned int level, unsigned int version)
   : SedBase(level, version)
   , mElementName("objective")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedObjective using the given SedNamespaces object @p sedmlns.
  */
-SedObjective::SedObjective(SedNamespaces *sedmlns)
+SedObjective::SedObjective(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mElementName("objective")
 {
@@ -82,6 +82,16 @@ SedObjective::SedObjective(const SedObjective& orig)
 }
 
 
+/*
+ * Move constructor for SedObjective.
+ */
+SedObjective::SedObjective(SedObjective&& orig)
+  : SedBase( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
 /*
  * Assignment operator for SedObjective.
  */
@@ -98,6 +108,22 @@ SedObjective::operator=(const SedObjective& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedObjective.
+ */
+SedObjective&
+SedObjective::operator=(SedObjective&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedObjective object.
  */
@@ -127,6 +153,49 @@ SedObjective::isSedLeastSquareObjectiveFunction() const
 }
 
 
+/*
+ * Adds the memory held by this SedObjective object to @p usage.
+ */
+void
+SedObjective::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedObjective) - sizeof(SedBase));
+  usage.addString(type, mElementName);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedObjective object to @p stream.
+ */
+void
+SedObjective::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mElementName);
+}
+
+
+/*
+ * Reads the attributes and children of this SedObjective object from @p stream.
+ */
+void
+SedObjective::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mElementName);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedObjective object.
  */
@@ -95,7 +95,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedObjective(SedNamespaces *sedmlns);
+  SedObjective(const SedNamespaces *sedmlns);
 
 
   /**
@@ -115,6 +115,28 @@ public:
   SedObjective& operator=(const SedObjective& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedObjective.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedObjective instance to move from.
+   */
+  SedObjective(SedObjective&& orig);
+
+
+  /**
+   * Move assignment operator for SedObjective.
+   *
+   * @param rhs the SedObjective object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedObjective& operator=(SedObjective&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedObjective object.
    *
@@ -139,6 +161,28 @@ public:
   virtual bool isSedLeastSquareObjectiveFunction() const;
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedObjective object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedOneStep.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -55,14 +56,13 @@ SedOneStep::SedOneStep(unsigned int level, unsigned int version)
   , mStep (util_NaN())
   , mIsSetStep (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedOneStep using the given SedNamespaces object @p sedmlns.
  */
-SedOneStep::SedOneStep(SedNamespaces *sedmlns)
+SedOneStep::SedOneStep(const SedNamespaces *sedmlns)
   : SedSimulation(sedmlns)
   , mStep (util_NaN())
   , mIsSetStep (false)
@@ -82,6 +82,17 @@ SedOneStep::SedOneStep(const SedOneStep& orig)
 }
 
 
+/*
+ * Move constructor for SedOneStep.
+ */
+SedOneStep::SedOneStep(SedOneStep&& orig)
+  : SedSimulation( std::move(orig) )
+  , mStep ( std::move(orig.mStep) )
+  , mIsSetStep ( std::move(orig.mIsSetStep) )
+{
+}
+
+
 /*
  * Assignment operator for SedOneStep.
  */
@@ -99,6 +110,23 @@ SedOneStep::operator=(const SedOneStep& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedOneStep.
+ */
+SedOneStep&
+SedOneStep::operator=(SedOneStep&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedSimulation::operator=(std::move(rhs));
+    mStep = std::move(rhs.mStep);
+    mIsSetStep = std::move(rhs.mIsSetStep);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedOneStep object.
  */
@@ -169,6 +197,50 @@ SedOneStep::unsetStep()
 }
 
 
+/*
+ * Adds the memory held by this SedOneStep object to @p usage.
+ */
+void
+SedOneStep::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedSimulation::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedOneStep) - sizeof(SedSimulation));
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedOneStep object to @p stream.
+ */
+void
+SedOneStep::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedSimulation::writeBinary(stream);
+
+  stream.writeDouble(mStep);
+  stream.writeBool(mIsSetStep);
+}
+
+
+/*
+ * Reads the attributes and children of this SedOneStep object from @p stream.
+ */
+void
+SedOneStep::readBinary(SedBinaryInputStream& stream)
+{
+  SedSimulation::readBinary(stream);
+
+  mStep = stream.readDouble();
+  mIsSetStep = stream.readBool();
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedOneStep object.
  */
@@ -93,7 +93,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedOneStep(SedNamespaces *sedmlns);
+  SedOneStep(const SedNamespaces *sedmlns);
 
 
   /**
@@ -113,6 +113,28 @@ public:
   SedOneStep& operator=(const SedOneStep& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedOneStep.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedOneStep instance to move from.
+   */
+  SedOneStep(SedOneStep&& orig);
+
+
+  /**
+   * Move assignment operator for SedOneStep.
+   *
+   * @param rhs the SedOneStep object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedOneStep& operator=(SedOneStep&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedOneStep object.
    *
@@ -167,6 +189,28 @@ public:
   int unsetStep();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedOneStep object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedOutput.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfOutputs.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -61,7 +62,6 @@ SedOutput::SedOutput(unsigned int level, unsigned int version)
   : SedBase(level, version)
   , mElementName("output")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
 }
@@ -70,7 +70,7 @@ SedOutput::SedOutput(unsigned int level, unsigned int version)
 /*
  * Creates a new SedOutput using the given SedNamespaces object @p sedmlns.
  */
-SedOutput::SedOutput(SedNamespaces *sedmlns)
+SedOutput::SedOutput(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mElementName("output")
 {
@@ -90,6 +90,16 @@ SedOutput::SedOutput(const SedOutput& orig)
 }
 
 
+/*
+ * Move constructor for SedOutput.
+ */
+SedOutput::SedOutput(SedOutput&& orig)
+  : SedBase( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
 /*
  * Assignment operator for SedOutput.
  */
@@ -106,6 +116,22 @@ SedOutput::operator=(const SedOutput& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedOutput.
+ */
+SedOutput&
+SedOutput::operator=(SedOutput&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedOutput object.
  */
@@ -179,6 +205,49 @@ SedOutput::isSedParameterEstimationResultPlot() const
 }
 
 
+/*
+ * Adds the memory held by this SedOutput object to @p usage.
+ */
+void
+SedOutput::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedOutput) - sizeof(SedBase));
+  usage.addString(type, mElementName);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedOutput object to @p stream.
+ */
+void
+SedOutput::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mElementName);
+}
+
+
+/*
+ * Reads the attributes and children of this SedOutput object from @p stream.
+ */
+void
+SedOutput::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mElementName);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedOutput object.
  */
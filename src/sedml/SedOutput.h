@@ -97,7 +97,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedOutput(SedNamespaces *sedmlns);
+  SedOutput(const SedNamespaces *sedmlns);
 
 
   /**
@@ -117,6 +117,28 @@ public:
   SedOutput& operator=(const SedOutput& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedOutput.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedOutput instance to move from.
+   */
+  SedOutput(SedOutput&& orig);
+
+
+  /**
+   * Move assignment operator for SedOutput.
+   *
+   * @param rhs the SedOutput object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedOutput& operator=(SedOutput&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedOutput object.
    *
@@ -181,6 +203,28 @@ public:
   virtual bool isSedParameterEstimationResultPlot() const;
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedOutput object.
    *
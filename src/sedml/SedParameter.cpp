@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedParameter.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfParameters.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -57,7 +58,6 @@ SedParameter::SedParameter(unsigned int level, unsigned int version)
   , mValue (util_NaN())
   , mIsSetValue (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
 }
@@ -66,7 +66,7 @@ SedParameter::SedParameter(unsigned int level, unsigned int version)
 /*
  * Creates a new SedParameter using the given SedNamespaces object @p sedmlns.
  */
-SedParameter::SedParameter(SedNamespaces *sedmlns)
+SedParameter::SedParameter(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mValue (util_NaN())
   , mIsSetValue (false)
@@ -88,6 +88,17 @@ SedParameter::SedParameter(const SedParameter& orig)
 }
 
 
+/*
+ * Move constructor for SedParameter.
+ */
+SedParameter::SedParameter(SedParameter&& orig)
+  : SedBase( std::move(orig) )
+  , mValue ( std::move(orig.mValue) )
+  , mIsSetValue ( std::move(orig.mIsSetValue) )
+{
+}
+
+
 /*
  * Assignment operator for SedParameter.
  */
@@ -105,6 +116,23 @@ SedParameter::operator=(const SedParameter& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedParameter.
+ */
+SedParameter&
+SedParameter::operator=(SedParameter&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mValue = std::move(rhs.mValue);
+    mIsSetValue = std::move(rhs.mIsSetValue);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedParameter object.
  */
@@ -151,6 +179,7 @@ SedParameter::setValue(double value)
 {
   mValue = value;
   mIsSetValue = true;
+  invalidateCompiledMath();
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -163,6 +192,7 @@ SedParameter::unsetValue()
 {
   mValue = util_NaN();
   mIsSetValue = false;
+  invalidateCompiledMath();
 
   if (isSetValue() == false)
   {
@@ -175,6 +205,50 @@ SedParameter::unsetValue()
 }
 
 
+/*
+ * Adds the memory held by this SedParameter object to @p usage.
+ */
+void
+SedParameter::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedParameter) - sizeof(SedBase));
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedParameter object to @p stream.
+ */
+void
+SedParameter::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeDouble(mValue);
+  stream.writeBool(mIsSetValue);
+}
+
+
+/*
+ * Reads the attributes and children of this SedParameter object from @p stream.
+ */
+void
+SedParameter::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  mValue = stream.readDouble();
+  mIsSetValue = stream.readBool();
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedParameter object.
  */
@@ -94,7 +94,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedParameter(SedNamespaces *sedmlns);
+  SedParameter(const SedNamespaces *sedmlns);
 
 
   /**
@@ -114,6 +114,28 @@ public:
   SedParameter& operator=(const SedParameter& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedParameter.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedParameter instance to move from.
+   */
+  SedParameter(SedParameter&& orig);
+
+
+  /**
+   * Move assignment operator for SedParameter.
+   *
+   * @param rhs the SedParameter object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedParameter& operator=(SedParameter&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedParameter object.
    *
@@ -170,6 +192,28 @@ public:
   int unsetValue();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedParameter object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedParameterEstimationReport.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -57,7 +58,6 @@ SedParameterEstimationReport::SedParameterEstimationReport(unsigned int level,
   : SedOutput(level, version)
   , mTaskReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -65,7 +65,7 @@ SedParameterEstimationReport::SedParameterEstimationReport(unsigned int level,
  * Creates a new SedParameterEstimationReport using the given SedNamespaces
  * object @p sedmlns.
  */
-SedParameterEstimationReport::SedParameterEstimationReport(SedNamespaces
+SedParameterEstimationReport::SedParameterEstimationReport(const SedNamespaces
   *sedmlns)
   : SedOutput(sedmlns)
   , mTaskReference ("")
@@ -85,6 +85,16 @@ SedParameterEstimationReport::SedParameterEstimationReport(const
 }
 
 
+/*
+ * Move constructor for SedParameterEstimationReport.
+ */
+SedParameterEstimationReport::SedParameterEstimationReport(SedParameterEstimationReport&& orig)
+  : SedOutput( std::move(orig) )
+  , mTaskReference ( std::move(orig.mTaskReference) )
+{
+}
+
+
 /*
  * Assignment operator for SedParameterEstimationReport.
  */
@@ -102,6 +112,22 @@ SedParameterEstimationReport::operator=(const SedParameterEstimationReport&
 }
 
 
+/*
+ * Move assignment operator for SedParameterEstimationReport.
+ */
+SedParameterEstimationReport&
+SedParameterEstimationReport::operator=(SedParameterEstimationReport&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedOutput::operator=(std::move(rhs));
+    mTaskReference = std::move(rhs.mTaskReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedParameterEstimationReport object.
  */
@@ -194,6 +220,66 @@ SedParameterEstimationReport::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedParameterEstimationReport object to @p refs.
+ */
+void
+SedParameterEstimationReport::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetTaskReference())
+  {
+    refs.push_back(std::make_pair(std::string("taskReference"),
+      mTaskReference));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedParameterEstimationReport object to @p usage.
+ */
+void
+SedParameterEstimationReport::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedOutput::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type,
+    sizeof(SedParameterEstimationReport) - sizeof(SedOutput));
+  usage.addString(type, mTaskReference);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedParameterEstimationReport
+ * object to @p stream.
+ */
+void
+SedParameterEstimationReport::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedOutput::writeBinary(stream);
+
+  stream.writeString(mTaskReference);
+}
+
+
+/*
+ * Reads the attributes and children of this SedParameterEstimationReport object
+ * from @p stream.
+ */
+void
+SedParameterEstimationReport::readBinary(SedBinaryInputStream& stream)
+{
+  SedOutput::readBinary(stream);
+
+  stream.readString(mTaskReference);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedParameterEstimationReport object.
@@ -613,7 +699,9 @@ SedParameterEstimationReport::readAttributes(
   // taskReference SIdRef (use = "required" )
   // 
 
-  assigned = attributes.readInto("taskReference", mTaskReference);
+  std::string taskReference;
+  assigned = attributes.readInto("taskReference", taskReference);
+  mTaskReference = taskReference;
 
   if (assigned == true)
   {
@@ -631,7 +719,8 @@ SedParameterEstimationReport::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mTaskReference + "', which does not conform to the syntax.";
+      msg += " is '" + mTaskReference.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlParameterEstimationReportTaskReferenceMustBeTask, level, version,
         msg, getLine(), getColumn());
     }
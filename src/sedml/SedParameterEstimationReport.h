@@ -51,6 +51,7 @@
 
 
 #include <sedml/SedOutput.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -63,7 +64,7 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  std::string mTaskReference;
+  SedInternedString mTaskReference;
 
   /** @endcond */
 
@@ -93,7 +94,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedParameterEstimationReport(SedNamespaces *sedmlns);
+  SedParameterEstimationReport(const SedNamespaces *sedmlns);
 
 
   /**
@@ -114,6 +115,28 @@ public:
     rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedParameterEstimationReport.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedParameterEstimationReport instance to move from.
+   */
+  SedParameterEstimationReport(SedParameterEstimationReport&& orig);
+
+
+  /**
+   * Move assignment operator for SedParameterEstimationReport.
+   *
+   * @param rhs the SedParameterEstimationReport object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedParameterEstimationReport& operator=(SedParameterEstimationReport&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedParameterEstimationReport
    * object.
@@ -181,6 +204,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedParameterEstimationReport object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedParameterEstimationResultPlot.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -59,7 +60,6 @@ SedParameterEstimationResultPlot::SedParameterEstimationResultPlot(
   : SedPlot(level, version)
   , mTaskReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -67,7 +67,7 @@ SedParameterEstimationResultPlot::SedParameterEstimationResultPlot(
  * Creates a new SedParameterEstimationResultPlot using the given SedNamespaces
  * object @p sedmlns.
  */
-SedParameterEstimationResultPlot::SedParameterEstimationResultPlot(SedNamespaces
+SedParameterEstimationResultPlot::SedParameterEstimationResultPlot(const SedNamespaces
   *sedmlns)
   : SedPlot(sedmlns)
   , mTaskReference ("")
@@ -87,6 +87,16 @@ SedParameterEstimationResultPlot::SedParameterEstimationResultPlot(const
 }
 
 
+/*
+ * Move constructor for SedParameterEstimationResultPlot.
+ */
+SedParameterEstimationResultPlot::SedParameterEstimationResultPlot(SedParameterEstimationResultPlot&& orig)
+  : SedPlot( std::move(orig) )
+  , mTaskReference ( std::move(orig.mTaskReference) )
+{
+}
+
+
 /*
  * Assignment operator for SedParameterEstimationResultPlot.
  */
@@ -104,6 +114,22 @@ SedParameterEstimationResultPlot::operator=(const
 }
 
 
+/*
+ * Move assignment operator for SedParameterEstimationResultPlot.
+ */
+SedParameterEstimationResultPlot&
+SedParameterEstimationResultPlot::operator=(SedParameterEstimationResultPlot&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedPlot::operator=(std::move(rhs));
+    mTaskReference = std::move(rhs.mTaskReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedParameterEstimationResultPlot
  * object.
@@ -197,6 +223,68 @@ SedParameterEstimationResultPlot::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedParameterEstimationResultPlot object to @p refs.
+ */
+void
+SedParameterEstimationResultPlot::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetTaskReference())
+  {
+    refs.push_back(std::make_pair(std::string("taskReference"),
+      mTaskReference));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedParameterEstimationResultPlot object to
+ * @p usage.
+ */
+void
+SedParameterEstimationResultPlot::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedPlot::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type,
+    sizeof(SedParameterEstimationResultPlot) - sizeof(SedPlot));
+  usage.addString(type, mTaskReference);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedParameterEstimationResultPlot
+ * object to @p stream.
+ */
+void
+SedParameterEstimationResultPlot::writeBinary(SedBinaryOutputStream&
+  stream) const
+{
+  SedPlot::writeBinary(stream);
+
+  stream.writeString(mTaskReference);
+}
+
+
+/*
+ * Reads the attributes and children of this SedParameterEstimationResultPlot
+ * object from @p stream.
+ */
+void
+SedParameterEstimationResultPlot::readBinary(SedBinaryInputStream& stream)
+{
+  SedPlot::readBinary(stream);
+
+  stream.readString(mTaskReference);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedParameterEstimationResultPlot
@@ -639,7 +727,9 @@ SedParameterEstimationResultPlot::readAttributes(
   // taskReference SIdRef (use = "required" )
   // 
 
-  assigned = attributes.readInto("taskReference", mTaskReference);
+  std::string taskReference;
+  assigned = attributes.readInto("taskReference", taskReference);
+  mTaskReference = taskReference;
 
   if (assigned == true)
   {
@@ -657,7 +747,8 @@ SedParameterEstimationResultPlot::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mTaskReference + "', which does not conform to the syntax.";
+      msg += " is '" + mTaskReference.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlParameterEstimationResultPlotTaskReferenceMustBeTask, level,
         version, msg, getLine(), getColumn());
     }
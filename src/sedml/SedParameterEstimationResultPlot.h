@@ -52,6 +52,7 @@
 
 
 #include <sedml/SedPlot.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -64,7 +65,7 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  std::string mTaskReference;
+  SedInternedString mTaskReference;
 
   /** @endcond */
 
@@ -95,7 +96,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedParameterEstimationResultPlot(SedNamespaces *sedmlns);
+  SedParameterEstimationResultPlot(const SedNamespaces *sedmlns);
 
 
   /**
@@ -117,6 +118,28 @@ public:
     SedParameterEstimationResultPlot& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedParameterEstimationResultPlot.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedParameterEstimationResultPlot instance to move from.
+   */
+  SedParameterEstimationResultPlot(SedParameterEstimationResultPlot&& orig);
+
+
+  /**
+   * Move assignment operator for SedParameterEstimationResultPlot.
+   *
+   * @param rhs the SedParameterEstimationResultPlot object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedParameterEstimationResultPlot& operator=(SedParameterEstimationResultPlot&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedParameterEstimationResultPlot
    * object.
@@ -184,6 +207,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedParameterEstimationResultPlot
    * object.
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedParameterEstimationTask.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 #include <sedml/SedLeastSquareObjectiveFunction.h>
@@ -61,7 +62,6 @@ SedParameterEstimationTask::SedParameterEstimationTask(unsigned int level,
   , mAdjustableParameters (level, version)
   , mFitExperiments (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -70,7 +70,7 @@ SedParameterEstimationTask::SedParameterEstimationTask(unsigned int level,
  * Creates a new SedParameterEstimationTask using the given SedNamespaces
  * object @p sedmlns.
  */
-SedParameterEstimationTask::SedParameterEstimationTask(SedNamespaces *sedmlns)
+SedParameterEstimationTask::SedParameterEstimationTask(const SedNamespaces *sedmlns)
   : SedAbstractTask(sedmlns)
   , mAlgorithm (NULL)
   , mObjective (NULL)
@@ -107,6 +107,23 @@ SedParameterEstimationTask::SedParameterEstimationTask(const
 }
 
 
+/*
+ * Move constructor for SedParameterEstimationTask.
+ */
+SedParameterEstimationTask::SedParameterEstimationTask(SedParameterEstimationTask&& orig)
+  : SedAbstractTask( std::move(orig) )
+  , mAlgorithm ( orig.mAlgorithm )
+  , mObjective ( orig.mObjective )
+  , mAdjustableParameters ( std::move(orig.mAdjustableParameters) )
+  , mFitExperiments ( std::move(orig.mFitExperiments) )
+{
+  orig.mAlgorithm = NULL;
+  orig.mObjective = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedParameterEstimationTask.
  */
@@ -145,6 +162,31 @@ SedParameterEstimationTask::operator=(const SedParameterEstimationTask& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedParameterEstimationTask.
+ */
+SedParameterEstimationTask&
+SedParameterEstimationTask::operator=(SedParameterEstimationTask&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedAbstractTask::operator=(std::move(rhs));
+    mAdjustableParameters = std::move(rhs.mAdjustableParameters);
+    mFitExperiments = std::move(rhs.mFitExperiments);
+    delete mAlgorithm;
+    mAlgorithm = rhs.mAlgorithm;
+    rhs.mAlgorithm = NULL;
+    delete mObjective;
+    mObjective = rhs.mObjective;
+    rhs.mObjective = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedParameterEstimationTask object.
  */
@@ -308,7 +350,7 @@ SedParameterEstimationTask::createAlgorithm()
     delete mAlgorithm;
   }
 
-  mAlgorithm = new SedAlgorithm(getSedNamespaces());
+  mAlgorithm = new (getSedArena()) SedAlgorithm(getSedNamespaces());
 
   connectToChild();
 
@@ -329,7 +371,7 @@ SedParameterEstimationTask::createLeastSquareObjectiveFunction()
     delete mObjective;
   }
 
-  mObjective = new SedLeastSquareObjectiveFunction(getSedNamespaces());
+  mObjective = new (getSedArena()) SedLeastSquareObjectiveFunction(getSedNamespaces());
 
   connectToChild();
 
@@ -465,6 +507,48 @@ SedParameterEstimationTask::addAdjustableParameter(const
 }
 
 
+/*
+ * Adds the given SedAdjustableParameter to this SedParameterEstimationTask,
+ * which takes ownership of it.
+ */
+int
+SedParameterEstimationTask::addAdjustableParameter(
+  std::unique_ptr<SedAdjustableParameter> sap)
+{
+  if (!sap)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sap->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sap.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sap->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sap->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sap->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sap.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return mAdjustableParameters.appendAndOwn(std::move(sap));
+  }
+}
+
+
 /*
  * Get the number of SedAdjustableParameter objects in this
  * SedParameterEstimationTask.
@@ -488,7 +572,7 @@ SedParameterEstimationTask::createAdjustableParameter()
 
   try
   {
-    sap = new SedAdjustableParameter(getSedNamespaces());
+    sap = new (getSedArena()) SedAdjustableParameter(getSedNamespaces());
   }
   catch (...)
   {
@@ -615,6 +699,51 @@ SedParameterEstimationTask::addFitExperiment(const SedFitExperiment* sfe)
 }
 
 
+/*
+ * Adds the given SedFitExperiment to this SedParameterEstimationTask,
+ * which takes ownership of it.
+ */
+int
+SedParameterEstimationTask::addFitExperiment(std::unique_ptr<SedFitExperiment> sfe)
+{
+  if (!sfe)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sfe->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sfe.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sfe->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sfe->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sfe->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sfe.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sfe->isSetId() && (mFitExperiments.get(sfe->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mFitExperiments.appendAndOwn(std::move(sfe));
+  }
+}
+
+
 /*
  * Get the number of SedFitExperiment objects in this
  * SedParameterEstimationTask.
@@ -638,7 +767,7 @@ SedParameterEstimationTask::createFitExperiment()
 
   try
   {
-    sfe = new SedFitExperiment(getSedNamespaces());
+    sfe = new (getSedArena()) SedFitExperiment(getSedNamespaces());
   }
   catch (...)
   {
@@ -675,6 +804,71 @@ SedParameterEstimationTask::removeFitExperiment(const std::string& sid)
 }
 
 
+/*
+ * Adds the memory held by this SedParameterEstimationTask object to @p usage.
+ */
+void
+SedParameterEstimationTask::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedAbstractTask::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type,
+    sizeof(SedParameterEstimationTask) - sizeof(SedAbstractTask) -
+    sizeof(SedListOfAdjustableParameters) -
+    sizeof(SedListOfFitExperiments));
+
+  if (mAdjustableParameters.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mAdjustableParameters.addMemoryUsage(usage);
+  }
+
+  if (mFitExperiments.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mFitExperiments.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedParameterEstimationTask object
+ * to @p stream.
+ */
+void
+SedParameterEstimationTask::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedAbstractTask::writeBinary(stream);
+
+  stream.writeObject(mAlgorithm);
+  stream.writeObject(mObjective);
+  mAdjustableParameters.writeBinary(stream);
+  mFitExperiments.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedParameterEstimationTask object
+ * from @p stream.
+ */
+void
+SedParameterEstimationTask::readBinary(SedBinaryInputStream& stream)
+{
+  SedAbstractTask::readBinary(stream);
+
+  stream.readObject(mAlgorithm, this);
+  stream.readObject(mObjective, this);
+  mAdjustableParameters.readBinary(stream);
+  mFitExperiments.readBinary(stream);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedParameterEstimationTask object.
  */
@@ -1370,7 +1564,7 @@ SedParameterEstimationTask::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
     }
 
     delete mObjective;
-    mObjective = new SedLeastSquareObjectiveFunction(getSedNamespaces());
+    mObjective = new (getSedArena()) SedLeastSquareObjectiveFunction(getSedNamespaces());
     obj = mObjective;
   }
   else if (name == "algorithm")
@@ -1382,7 +1576,7 @@ SedParameterEstimationTask::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER
     }
 
     delete mAlgorithm;
-    mAlgorithm = new SedAlgorithm(getSedNamespaces());
+    mAlgorithm = new (getSedArena()) SedAlgorithm(getSedNamespaces());
     obj = mAlgorithm;
   }
 
@@ -100,7 +100,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedParameterEstimationTask(SedNamespaces *sedmlns);
+  SedParameterEstimationTask(const SedNamespaces *sedmlns);
 
 
   /**
@@ -120,6 +120,28 @@ public:
   SedParameterEstimationTask& operator=(const SedParameterEstimationTask& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedParameterEstimationTask.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedParameterEstimationTask instance to move from.
+   */
+  SedParameterEstimationTask(SedParameterEstimationTask&& orig);
+
+
+  /**
+   * Move assignment operator for SedParameterEstimationTask.
+   *
+   * @param rhs the SedParameterEstimationTask object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedParameterEstimationTask& operator=(SedParameterEstimationTask&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedParameterEstimationTask object.
    *
@@ -409,6 +431,28 @@ public:
   int addAdjustableParameter(const SedAdjustableParameter* sap);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAdjustableParameter to this SedParameterEstimationTask without copying it.
+   *
+   * @param sap the SedAdjustableParameter object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addAdjustableParameter(const SedAdjustableParameter* sap)
+   */
+  int addAdjustableParameter(std::unique_ptr<SedAdjustableParameter> sap);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAdjustableParameter objects in this
    * SedParameterEstimationTask.
@@ -618,6 +662,28 @@ public:
   int addFitExperiment(const SedFitExperiment* sfe);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedFitExperiment to this SedParameterEstimationTask without copying it.
+   *
+   * @param sfe the SedFitExperiment object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addFitExperiment(const SedFitExperiment* sfe)
+   */
+  int addFitExperiment(std::unique_ptr<SedFitExperiment> sfe);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedFitExperiment objects in this
    * SedParameterEstimationTask.
@@ -698,6 +764,28 @@ public:
   SedFitExperiment* removeFitExperiment(const std::string& sid);
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedParameterEstimationTask object.
    *
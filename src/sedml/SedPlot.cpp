@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedPlot.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -61,7 +62,6 @@ SedPlot::SedPlot(unsigned int level, unsigned int version)
   , mXAxis (NULL)
   , mYAxis (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -69,7 +69,7 @@ SedPlot::SedPlot(unsigned int level, unsigned int version)
 /*
  * Creates a new SedPlot using the given SedNamespaces object @p sedmlns.
  */
-SedPlot::SedPlot(SedNamespaces *sedmlns)
+SedPlot::SedPlot(const SedNamespaces *sedmlns)
   : SedOutput(sedmlns)
   , mLegend (false)
   , mIsSetLegend (false)
@@ -113,6 +113,27 @@ SedPlot::SedPlot(const SedPlot& orig)
 }
 
 
+/*
+ * Move constructor for SedPlot.
+ */
+SedPlot::SedPlot(SedPlot&& orig)
+  : SedOutput( std::move(orig) )
+  , mLegend ( std::move(orig.mLegend) )
+  , mIsSetLegend ( std::move(orig.mIsSetLegend) )
+  , mHeight ( std::move(orig.mHeight) )
+  , mIsSetHeight ( std::move(orig.mIsSetHeight) )
+  , mWidth ( std::move(orig.mWidth) )
+  , mIsSetWidth ( std::move(orig.mIsSetWidth) )
+  , mXAxis ( orig.mXAxis )
+  , mYAxis ( orig.mYAxis )
+{
+  orig.mXAxis = NULL;
+  orig.mYAxis = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedPlot.
  */
@@ -155,6 +176,35 @@ SedPlot::operator=(const SedPlot& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedPlot.
+ */
+SedPlot&
+SedPlot::operator=(SedPlot&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedOutput::operator=(std::move(rhs));
+    mLegend = std::move(rhs.mLegend);
+    mIsSetLegend = std::move(rhs.mIsSetLegend);
+    mHeight = std::move(rhs.mHeight);
+    mIsSetHeight = std::move(rhs.mIsSetHeight);
+    mWidth = std::move(rhs.mWidth);
+    mIsSetWidth = std::move(rhs.mIsSetWidth);
+    delete mXAxis;
+    mXAxis = rhs.mXAxis;
+    rhs.mXAxis = NULL;
+    delete mYAxis;
+    mYAxis = rhs.mYAxis;
+    rhs.mYAxis = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedPlot object.
  */
@@ -467,7 +517,7 @@ SedPlot::createXAxis()
     delete mXAxis;
   }
 
-  mXAxis = new SedAxis(getSedNamespaces());
+  mXAxis = new (getSedArena()) SedAxis(getSedNamespaces());
 
   mXAxis->setElementName("xAxis");
 
@@ -489,7 +539,7 @@ SedPlot::createYAxis()
     delete mYAxis;
   }
 
-  mYAxis = new SedAxis(getSedNamespaces());
+  mYAxis = new (getSedArena()) SedAxis(getSedNamespaces());
 
   mYAxis->setElementName("yAxis");
 
@@ -523,6 +573,62 @@ SedPlot::unsetYAxis()
 }
 
 
+/*
+ * Adds the memory held by this SedPlot object to @p usage.
+ */
+void
+SedPlot::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedOutput::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedPlot) - sizeof(SedOutput));
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedPlot object to @p stream.
+ */
+void
+SedPlot::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedOutput::writeBinary(stream);
+
+  stream.writeBool(mLegend);
+  stream.writeBool(mIsSetLegend);
+  stream.writeDouble(mHeight);
+  stream.writeBool(mIsSetHeight);
+  stream.writeDouble(mWidth);
+  stream.writeBool(mIsSetWidth);
+  stream.writeObject(mXAxis);
+  stream.writeObject(mYAxis);
+}
+
+
+/*
+ * Reads the attributes and children of this SedPlot object from @p stream.
+ */
+void
+SedPlot::readBinary(SedBinaryInputStream& stream)
+{
+  SedOutput::readBinary(stream);
+
+  mLegend = stream.readBool();
+  mIsSetLegend = stream.readBool();
+  mHeight = stream.readDouble();
+  mIsSetHeight = stream.readBool();
+  mWidth = stream.readDouble();
+  mIsSetWidth = stream.readBool();
+  stream.readObject(mXAxis, this);
+  stream.readObject(mYAxis, this);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedPlot object.
  */
@@ -1158,7 +1264,7 @@ SedPlot::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mXAxis;
-    mXAxis = new SedAxis(getSedNamespaces());
+    mXAxis = new (getSedArena()) SedAxis(getSedNamespaces());
     mXAxis->setElementName(name);
     obj = mXAxis;
   }
@@ -1171,7 +1277,7 @@ SedPlot::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mYAxis;
-    mYAxis = new SedAxis(getSedNamespaces());
+    mYAxis = new (getSedArena()) SedAxis(getSedNamespaces());
     mYAxis->setElementName(name);
     obj = mYAxis;
   }
@@ -98,7 +98,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedPlot(SedNamespaces *sedmlns);
+  SedPlot(const SedNamespaces *sedmlns);
 
 
   /**
@@ -118,6 +118,28 @@ public:
   SedPlot& operator=(const SedPlot& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedPlot.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedPlot instance to move from.
+   */
+  SedPlot(SedPlot&& orig);
+
+
+  /**
+   * Move assignment operator for SedPlot.
+   *
+   * @param rhs the SedPlot object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedPlot& operator=(SedPlot&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedPlot object.
    *
@@ -366,6 +388,28 @@ public:
   int unsetYAxis();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedPlot object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedPlot2D.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 #include <sedml/SedCurve.h>
@@ -58,7 +59,6 @@ SedPlot2D::SedPlot2D(unsigned int level, unsigned int version)
   , mAbstractCurves (level, version)
   , mRightYAxis (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -66,7 +66,7 @@ SedPlot2D::SedPlot2D(unsigned int level, unsigned int version)
 /*
  * Creates a new SedPlot2D using the given SedNamespaces object @p sedmlns.
  */
-SedPlot2D::SedPlot2D(SedNamespaces *sedmlns)
+SedPlot2D::SedPlot2D(const SedNamespaces *sedmlns)
   : SedPlot(sedmlns)
   , mAbstractCurves (sedmlns)
   , mRightYAxis (NULL)
@@ -93,6 +93,20 @@ SedPlot2D::SedPlot2D(const SedPlot2D& orig)
 }
 
 
+/*
+ * Move constructor for SedPlot2D.
+ */
+SedPlot2D::SedPlot2D(SedPlot2D&& orig)
+  : SedPlot( std::move(orig) )
+  , mAbstractCurves ( std::move(orig.mAbstractCurves) )
+  , mRightYAxis ( orig.mRightYAxis )
+{
+  orig.mRightYAxis = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedPlot2D.
  */
@@ -120,6 +134,27 @@ SedPlot2D::operator=(const SedPlot2D& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedPlot2D.
+ */
+SedPlot2D&
+SedPlot2D::operator=(SedPlot2D&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedPlot::operator=(std::move(rhs));
+    mAbstractCurves = std::move(rhs.mAbstractCurves);
+    delete mRightYAxis;
+    mRightYAxis = rhs.mRightYAxis;
+    rhs.mRightYAxis = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedPlot2D object.
  */
@@ -213,7 +248,7 @@ SedPlot2D::createRightYAxis()
     delete mRightYAxis;
   }
 
-  mRightYAxis = new SedAxis(getSedNamespaces());
+  mRightYAxis = new (getSedArena()) SedAxis(getSedNamespaces());
 
   mRightYAxis->setElementName("rightYAxis");
 
@@ -377,6 +412,51 @@ SedPlot2D::addCurve(const SedAbstractCurve* sac)
 }
 
 
+/*
+ * Adds the given SedAbstractCurve to this SedPlot2D,
+ * which takes ownership of it.
+ */
+int
+SedPlot2D::addCurve(std::unique_ptr<SedAbstractCurve> sac)
+{
+  if (!sac)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sac->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sac.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sac->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sac->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sac->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sac.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sac->isSetId() && (mAbstractCurves.get(sac->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mAbstractCurves.appendAndOwn(std::move(sac));
+  }
+}
+
+
 /*
  * Get the number of SedAbstractCurve objects in this SedPlot2D.
  */
@@ -398,7 +478,7 @@ SedPlot2D::createCurve()
 
   try
   {
-    sc = new SedCurve(getSedNamespaces());
+    sc = new (getSedArena()) SedCurve(getSedNamespaces());
   }
   catch (...)
   {
@@ -424,7 +504,7 @@ SedPlot2D::createShadedArea()
 
   try
   {
-    ssa = new SedShadedArea(getSedNamespaces());
+    ssa = new (getSedArena()) SedShadedArea(getSedNamespaces());
   }
   catch (...)
   {
@@ -461,6 +541,57 @@ SedPlot2D::removeCurve(const std::string& sid)
 }
 
 
+/*
+ * Adds the memory held by this SedPlot2D object to @p usage.
+ */
+void
+SedPlot2D::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedPlot::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedPlot2D) - sizeof(SedPlot) -
+    sizeof(SedListOfCurves));
+
+  if (mAbstractCurves.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mAbstractCurves.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedPlot2D object to @p stream.
+ */
+void
+SedPlot2D::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedPlot::writeBinary(stream);
+
+  mAbstractCurves.writeBinary(stream);
+  stream.writeObject(mRightYAxis);
+}
+
+
+/*
+ * Reads the attributes and children of this SedPlot2D object from @p stream.
+ */
+void
+SedPlot2D::readBinary(SedBinaryInputStream& stream)
+{
+  SedPlot::readBinary(stream);
+
+  mAbstractCurves.readBinary(stream);
+  stream.readObject(mRightYAxis, this);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedPlot2D object.
  */
@@ -1026,7 +1157,7 @@ SedPlot2D::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mRightYAxis;
-    mRightYAxis = new SedAxis(getSedNamespaces());
+    mRightYAxis = new (getSedArena()) SedAxis(getSedNamespaces());
     mRightYAxis->setElementName(name);
     obj = mRightYAxis;
   }
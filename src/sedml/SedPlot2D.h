@@ -94,7 +94,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedPlot2D(SedNamespaces *sedmlns);
+  SedPlot2D(const SedNamespaces *sedmlns);
 
 
   /**
@@ -114,6 +114,28 @@ public:
   SedPlot2D& operator=(const SedPlot2D& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedPlot2D.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedPlot2D instance to move from.
+   */
+  SedPlot2D(SedPlot2D&& orig);
+
+
+  /**
+   * Move assignment operator for SedPlot2D.
+   *
+   * @param rhs the SedPlot2D object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedPlot2D& operator=(SedPlot2D&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedPlot2D object.
    *
@@ -395,6 +417,28 @@ public:
   int addCurve(const SedAbstractCurve* sac);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAbstractCurve to this SedPlot2D without copying it.
+   *
+   * @param sac the SedAbstractCurve object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addCurve(const SedAbstractCurve* sac)
+   */
+  int addCurve(std::unique_ptr<SedAbstractCurve> sac);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAbstractCurve objects in this SedPlot2D.
    *
@@ -489,6 +533,28 @@ public:
   SedAbstractCurve* removeCurve(const std::string& sid);
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedPlot2D object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedPlot3D.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -55,7 +56,6 @@ SedPlot3D::SedPlot3D(unsigned int level, unsigned int version)
   , mSurfaces (level, version)
   , mZAxis (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -63,7 +63,7 @@ SedPlot3D::SedPlot3D(unsigned int level, unsigned int version)
 /*
  * Creates a new SedPlot3D using the given SedNamespaces object @p sedmlns.
  */
-SedPlot3D::SedPlot3D(SedNamespaces *sedmlns)
+SedPlot3D::SedPlot3D(const SedNamespaces *sedmlns)
   : SedPlot(sedmlns)
   , mSurfaces (sedmlns)
   , mZAxis (NULL)
@@ -90,6 +90,20 @@ SedPlot3D::SedPlot3D(const SedPlot3D& orig)
 }
 
 
+/*
+ * Move constructor for SedPlot3D.
+ */
+SedPlot3D::SedPlot3D(SedPlot3D&& orig)
+  : SedPlot( std::move(orig) )
+  , mSurfaces ( std::move(orig.mSurfaces) )
+  , mZAxis ( orig.mZAxis )
+{
+  orig.mZAxis = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedPlot3D.
  */
@@ -117,6 +131,27 @@ SedPlot3D::operator=(const SedPlot3D& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedPlot3D.
+ */
+SedPlot3D&
+SedPlot3D::operator=(SedPlot3D&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedPlot::operator=(std::move(rhs));
+    mSurfaces = std::move(rhs.mSurfaces);
+    delete mZAxis;
+    mZAxis = rhs.mZAxis;
+    rhs.mZAxis = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedPlot3D object.
  */
@@ -210,7 +245,7 @@ SedPlot3D::createZAxis()
     delete mZAxis;
   }
 
-  mZAxis = new SedAxis(getSedNamespaces());
+  mZAxis = new (getSedArena()) SedAxis(getSedNamespaces());
 
   mZAxis->setElementName("zAxis");
 
@@ -416,6 +451,50 @@ SedPlot3D::addSurface(const SedSurface* ss)
 }
 
 
+/*
+ * Adds the given SedSurface to this SedPlot3D, which takes ownership of it.
+ */
+int
+SedPlot3D::addSurface(std::unique_ptr<SedSurface> ss)
+{
+  if (!ss)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ss->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ss.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ss->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ss->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ss->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ss.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (ss->isSetId() && (mSurfaces.get(ss->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mSurfaces.appendAndOwn(std::move(ss));
+  }
+}
+
+
 /*
  * Get the number of SedSurface objects in this SedPlot3D.
  */
@@ -437,7 +516,7 @@ SedPlot3D::createSurface()
 
   try
   {
-    ss = new SedSurface(getSedNamespaces());
+    ss = new (getSedArena()) SedSurface(getSedNamespaces());
   }
   catch (...)
   {
@@ -473,6 +552,57 @@ SedPlot3D::removeSurface(const std::string& sid)
 }
 
 
+/*
+ * Adds the memory held by this SedPlot3D object to @p usage.
+ */
+void
+SedPlot3D::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedPlot::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedPlot3D) - sizeof(SedPlot) -
+    sizeof(SedListOfSurfaces));
+
+  if (mSurfaces.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mSurfaces.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedPlot3D object to @p stream.
+ */
+void
+SedPlot3D::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedPlot::writeBinary(stream);
+
+  mSurfaces.writeBinary(stream);
+  stream.writeObject(mZAxis);
+}
+
+
+/*
+ * Reads the attributes and children of this SedPlot3D object from @p stream.
+ */
+void
+SedPlot3D::readBinary(SedBinaryInputStream& stream)
+{
+  SedPlot::readBinary(stream);
+
+  mSurfaces.readBinary(stream);
+  stream.readObject(mZAxis, this);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedPlot3D object.
  */
@@ -1025,7 +1155,7 @@ SedPlot3D::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mZAxis;
-    mZAxis = new SedAxis(getSedNamespaces());
+    mZAxis = new (getSedArena()) SedAxis(getSedNamespaces());
     mZAxis->setElementName(name);
     obj = mZAxis;
   }
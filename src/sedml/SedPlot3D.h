@@ -94,7 +94,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedPlot3D(SedNamespaces *sedmlns);
+  SedPlot3D(const SedNamespaces *sedmlns);
 
 
   /**
@@ -114,6 +114,28 @@ public:
   SedPlot3D& operator=(const SedPlot3D& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedPlot3D.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedPlot3D instance to move from.
+   */
+  SedPlot3D(SedPlot3D&& orig);
+
+
+  /**
+   * Move assignment operator for SedPlot3D.
+   *
+   * @param rhs the SedPlot3D object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedPlot3D& operator=(SedPlot3D&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedPlot3D object.
    *
@@ -449,6 +471,28 @@ public:
   int addSurface(const SedSurface* ss);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSurface to this SedPlot3D without copying it.
+   *
+   * @param ss the SedSurface object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addSurface(const SedSurface* ss)
+   */
+  int addSurface(std::unique_ptr<SedSurface> ss);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSurface objects in this SedPlot3D.
    *
@@ -525,6 +569,28 @@ public:
   SedSurface* removeSurface(const std::string& sid);
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedPlot3D object.
    *
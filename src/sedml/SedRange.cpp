@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedRange.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfRanges.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -60,7 +61,6 @@ SedRange::SedRange(unsigned int level, unsigned int version)
   : SedBase(level, version)
   , mElementName("range")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mIdAllowedPreV4 = true;
 }
 
@@ -68,7 +68,7 @@ SedRange::SedRange(unsigned int level, unsigned int version)
 /*
  * Creates a new SedRange using the given SedNamespaces object @p sedmlns.
  */
-SedRange::SedRange(SedNamespaces *sedmlns)
+SedRange::SedRange(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mElementName("range")
 {
@@ -87,6 +87,16 @@ SedRange::SedRange(const SedRange& orig)
 }
 
 
+/*
+ * Move constructor for SedRange.
+ */
+SedRange::SedRange(SedRange&& orig)
+  : SedBase( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
 /*
  * Assignment operator for SedRange.
  */
@@ -103,6 +113,22 @@ SedRange::operator=(const SedRange& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedRange.
+ */
+SedRange&
+SedRange::operator=(SedRange&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedRange object.
  */
@@ -165,6 +191,49 @@ SedRange::isSedDataRange() const
 }
 
 
+/*
+ * Adds the memory held by this SedRange object to @p usage.
+ */
+void
+SedRange::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedRange) - sizeof(SedBase));
+  usage.addString(type, mElementName);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedRange object to @p stream.
+ */
+void
+SedRange::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mElementName);
+}
+
+
+/*
+ * Reads the attributes and children of this SedRange object from @p stream.
+ */
+void
+SedRange::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mElementName);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedRange object.
  */
@@ -95,7 +95,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedRange(SedNamespaces *sedmlns);
+  SedRange(const SedNamespaces *sedmlns);
 
 
   /**
@@ -115,6 +115,28 @@ public:
   SedRange& operator=(const SedRange& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedRange.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedRange instance to move from.
+   */
+  SedRange(SedRange&& orig);
+
+
+  /**
+   * Move assignment operator for SedRange.
+   *
+   * @param rhs the SedRange object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedRange& operator=(SedRange&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedRange object.
    *
@@ -169,6 +191,28 @@ public:
   virtual bool isSedDataRange() const;
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedRange object.
    *
@@ -33,19 +33,27 @@
  */
 
 
+#include <atomic>
+#include <exception>
+#include <thread>
+
 #include <sbml/xml/XMLError.h>
 #include <sbml/xml/XMLErrorLog.h>
 #include <sbml/xml/XMLInputStream.h>
+#include <sbml/common/libsbml-version.h>
 
 #include <sedml/SedErrorLog.h>
 #include <sedml/SedVisitor.h>
 #include <sedml/SedDocument.h>
 #include <sedml/SedError.h>
 #include <sedml/SedReader.h>
+#include <sedml/SedReaderHandler.h>
+#include <sedml/common/SedMappedFile.h>
 
 #include <sbml/compress/CompressCommon.h>
 #include <sbml/compress/InputDecompressor.h>
 
+
 /** @cond doxygenIgnored */
 
 using namespace std;
@@ -60,6 +68,8 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
  * Creates a new SedReader and returns it. 
  */
 SedReader::SedReader ()
+  : mLoadMask (SEDML_LOAD_ALL)
+  , mArenaAllocation (false)
 {
 }
 
@@ -97,7 +107,7 @@ SedReader::~SedReader ()
 SedDocument*
 SedReader::readSedML (const std::string& filename)
 {
-  return readInternal(filename.c_str(), true);
+  return readFileInternal(filename);
 }
 
 
@@ -107,7 +117,102 @@ SedReader::readSedML (const std::string& filename)
 SedDocument*
 SedReader::readSedMLFromFile (const std::string& filename)
 {
-  return readInternal(filename.c_str(), true);
+  return readFileInternal(filename);
+}
+
+
+/*
+ * Reads the given files concurrently; the documents are returned in the
+ * order of filenames.
+ */
+std::vector<SedDocument*>
+SedReader::readSedMLBatch (const std::vector<std::string>& filenames,
+                           unsigned int numThreads)
+{
+  std::vector<SedDocument*> documents(filenames.size(), (SedDocument*)NULL);
+
+  if (numThreads == 0)
+  {
+    numThreads = std::thread::hardware_concurrency();
+  }
+
+  if (isLibSBMLCompiledWith("xerces-c") != 0)
+  {
+    numThreads = 1;
+  }
+
+  if (numThreads > filenames.size())
+  {
+    numThreads = static_cast<unsigned int>(filenames.size());
+  }
+
+  // files are handed out one at a time, so that a few large files do not
+  // leave the other threads idle
+  std::atomic<size_t> next(0);
+
+  auto readOne = [&](size_t n)
+  {
+    std::string details;
+    try
+    {
+      documents[n] = readFileInternal(filenames[n]);
+      return;
+    }
+    catch (const std::exception& e)
+    {
+      details = e.what();
+    }
+    catch (...)
+    {
+    }
+
+    // reported like a file that cannot be read, so that every entry still
+    // gets a document
+    try
+    {
+      SedDocument* d = new SedDocument();
+      d->getErrorLog()->logError(XMLFileUnreadable, d->getLevel(),
+                                 d->getVersion(), details);
+      documents[n] = d;
+    }
+    catch (...)
+    {
+    }
+  };
+
+  auto readNext = [&]()
+  {
+    size_t n;
+    while ((n = next++) < filenames.size())
+    {
+      readOne(n);
+    }
+  };
+
+  if (numThreads <= 1)
+  {
+    readNext();
+    return documents;
+  }
+
+  // the first file is read before any thread is started, so that the XML
+  // parser performs its one-time global initialization on this thread
+  readOne(next++);
+
+  std::vector<std::thread> threads;
+  for (unsigned int i = 1; i < numThreads; ++i)
+  {
+    threads.push_back(std::thread(readNext));
+  }
+
+  readNext();
+
+  for (size_t i = 0; i < threads.size(); ++i)
+  {
+    threads[i].join();
+  }
+
+  return documents;
 }
 
 
@@ -143,6 +248,28 @@ SedReader::readSedMLFromString (const std::string& xml)
 }
 
 
+/*
+ * Reads an Sed document from a caller-owned, null-terminated buffer; the
+ * buffer is only copied if it lacks an XML declaration.
+ */
+SedDocument*
+SedReader::readSedMLFromBuffer (const char* xml)
+{
+  if (xml == NULL)
+  {
+    return readSedMLFromString("");
+  }
+  else if (!strncmp(xml, "<?xml", 5))
+  {
+    return readInternal(xml, false);
+  }
+  else
+  {
+    return readSedMLFromString(xml);
+  }
+}
+
+
 /*
  * Predicate returning @c true if
  * libSEDML is linked with zlib.
@@ -169,6 +296,80 @@ SedReader::hasBzip2()
 }
 
 
+/*
+ * Selects which parts of a document are built by the read methods.
+ */
+void
+SedReader::setLoadMask (unsigned int mask)
+{
+  mLoadMask = mask;
+}
+
+
+/*
+ * Returns the load mask of this SedReader.
+ */
+unsigned int
+SedReader::getLoadMask () const
+{
+  return mLoadMask;
+}
+
+
+/*
+ * Sets whether documents read by this SedReader allocate their objects
+ * from a pool.
+ */
+void
+SedReader::setArenaAllocation (bool enable)
+{
+  mArenaAllocation = enable;
+}
+
+
+/*
+ * Returns whether documents read by this SedReader allocate their objects
+ * from a pool.
+ */
+bool
+SedReader::getArenaAllocation () const
+{
+  return mArenaAllocation;
+}
+
+
+/*
+ * Reads the SED-ML file filename, reporting each element to handler.
+ */
+int
+SedReader::parseSedML (const std::string& filename, SedReaderHandler& handler,
+                       SedErrorLog* log)
+{
+  return parseInternal(filename.c_str(), true, handler, log);
+}
+
+
+/*
+ * Reads the SED-ML content of xml, reporting each element to handler.
+ */
+int
+SedReader::parseSedMLFromString (const std::string& xml,
+                                 SedReaderHandler& handler, SedErrorLog* log)
+{
+  const static string dummy_xml ("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+
+  if (!strncmp(xml.c_str(), dummy_xml.c_str(), 14))
+  {
+    return parseInternal(xml.c_str(), false, handler, log);
+  }
+  else
+  {
+    const std::string temp = (dummy_xml + xml);
+    return parseInternal(temp.c_str(), false, handler, log);
+  }
+}
+
+
 /** @cond doxygenLibsedmlInternal */
 static bool
 isCriticalError(const unsigned int errorId)
@@ -203,6 +404,245 @@ isCriticalError(const unsigned int errorId)
 
 
 /** @cond doxygenLibsedmlInternal */
+/*
+ * Maps the XML name of a SED-ML element onto its type code; the table is
+ * constant so that it can be shared between threads.
+ */
+struct SedElementTypeCode
+{
+  const char* name;
+  int type;
+};
+
+static const SedElementTypeCode SED_ELEMENT_TYPECODES[] =
+{
+  { "addXML",                        SEDML_CHANGE_ADDXML },
+  { "adjustableParameter",           SEDML_ADJUSTABLE_PARAMETER },
+  { "algorithm",                     SEDML_SIMULATION_ALGORITHM },
+  { "algorithmParameter",            SEDML_SIMULATION_ALGORITHM_PARAMETER },
+  { "analysis",                      SEDML_SIMULATION_ANALYSIS },
+  { "appliedDimension",              SEDML_APPLIEDDIMENSION },
+  { "bounds",                        SEDML_BOUNDS },
+  { "changeAttribute",               SEDML_CHANGE_ATTRIBUTE },
+  { "changeXML",                     SEDML_CHANGE_CHANGEXML },
+  { "computeChange",                 SEDML_CHANGE_COMPUTECHANGE },
+  { "curve",                         SEDML_OUTPUT_CURVE },
+  { "dataDescription",               SEDML_DATA_DESCRIPTION },
+  { "dataGenerator",                 SEDML_DATAGENERATOR },
+  { "dataRange",                     SEDML_DATA_RANGE },
+  { "dataSet",                       SEDML_OUTPUT_DATASET },
+  { "dataSource",                    SEDML_DATA_SOURCE },
+  { "experimentReference",           SEDML_EXPERIMENT_REFERENCE },
+  { "figure",                        SEDML_FIGURE },
+  { "fill",                          SEDML_FILL },
+  { "fitExperiment",                 SEDML_FIT_EXPERIMENT },
+  { "fitMapping",                    SEDML_FITMAPPING },
+  { "functionalRange",               SEDML_RANGE_FUNCTIONALRANGE },
+  { "leastSquareObjectiveFunction",  SEDML_LEAST_SQUARE_OBJECTIVE },
+  { "line",                          SEDML_LINE },
+  { "marker",                        SEDML_MARKER },
+  { "model",                         SEDML_MODEL },
+  { "oneStep",                       SEDML_SIMULATION_ONESTEP },
+  { "parameter",                     SEDML_PARAMETER },
+  { "parameterEstimationReport",     SEDML_PARAMETERESTIMATIONREPORT },
+  { "parameterEstimationResultPlot", SEDML_PARAMETERESTIMATIONRESULTPLOT },
+  { "parameterEstimationTask",       SEDML_TASK_PARAMETER_ESTIMATION },
+  { "plot",                          SEDML_OUTPUT_PLOT },
+  { "plot2D",                        SEDML_OUTPUT_PLOT2D },
+  { "plot3D",                        SEDML_OUTPUT_PLOT3D },
+  { "removeXML",                     SEDML_CHANGE_REMOVEXML },
+  { "repeatedTask",                  SEDML_TASK_REPEATEDTASK },
+  { "report",                        SEDML_OUTPUT_REPORT },
+  { "rightYAxis",                    SEDML_AXIS },
+  { "sedML",                         SEDML_DOCUMENT },
+  { "setValue",                      SEDML_TASK_SETVALUE },
+  { "shadedArea",                    SEDML_SHADEDAREA },
+  { "slice",                         SEDML_DATA_SLICE },
+  { "steadyState",                   SEDML_SIMULATION_STEADYSTATE },
+  { "style",                         SEDML_STYLE },
+  { "subPlot",                       SEDML_SUBPLOT },
+  { "subTask",                       SEDML_TASK_SUBTASK },
+  { "surface",                       SEDML_OUTPUT_SURFACE },
+  { "task",                          SEDML_TASK },
+  { "uniformRange",                  SEDML_RANGE_UNIFORMRANGE },
+  { "uniformTimeCourse",             SEDML_SIMULATION_UNIFORMTIMECOURSE },
+  { "variable",                      SEDML_VARIABLE },
+  { "vectorRange",                   SEDML_RANGE_VECTORRANGE },
+  { "waterfallPlot",                 SEDML_WATERFALLPLOT },
+  { "xAxis",                         SEDML_AXIS },
+  { "yAxis",                         SEDML_AXIS },
+  { "zAxis",                         SEDML_AXIS },
+};
+
+
+static int
+getTypeCodeForElement(const std::string& name)
+{
+  if (name.compare(0, 6, "listOf") == 0)
+  {
+    return SEDML_LIST_OF;
+  }
+
+  const size_t count =
+    sizeof(SED_ELEMENT_TYPECODES) / sizeof(SED_ELEMENT_TYPECODES[0]);
+
+  // the table is sorted by name
+  size_t lo = 0, hi = count;
+  while (lo < hi)
+  {
+    size_t mid = (lo + hi) / 2;
+    int cmp = name.compare(SED_ELEMENT_TYPECODES[mid].name);
+    if (cmp == 0)
+    {
+      return SED_ELEMENT_TYPECODES[mid].type;
+    }
+    else if (cmp < 0)
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+
+  return SEDML_UNKNOWN;
+}
+
+
+/*
+ * Used by parseSedML() and parseSedMLFromString().
+ */
+int
+SedReader::parseInternal (const char* content, bool isFile,
+                          SedReaderHandler& handler, SedErrorLog* log)
+{
+  SedErrorLog localLog;
+  if (log == NULL)
+  {
+    log = &localLog;
+  }
+
+  if (content == NULL || (isFile && util_file_exists(content) == false))
+  {
+    log->logError(XMLFileUnreadable);
+    return LIBSEDML_OPERATION_FAILED;
+  }
+
+  XMLInputStream stream(content, isFile, "", log);
+
+  if (stream.peek().isStart() && stream.peek().getName() != "sedML")
+  {
+    log->logError(SedNotSchemaConformant);
+    return LIBSEDML_OPERATION_FAILED;
+  }
+
+  // type codes of the elements that are currently open
+  vector<int> open;
+
+  while (stream.isGood())
+  {
+    const XMLToken token = stream.next();
+
+    if (token.isStart())
+    {
+      const int type = getTypeCodeForElement(token.getName());
+      if (!handler.startElement(type, token.getName(), token.getAttributes()))
+      {
+        return LIBSEDML_OPERATION_SUCCESS;
+      }
+
+      if (type == SEDML_UNKNOWN)
+      {
+        // math, notes, annotations, XML payloads: nothing for the handler
+        stream.skipPastEnd(token);
+        if (!handler.endElement(type, token.getName()))
+        {
+          return LIBSEDML_OPERATION_SUCCESS;
+        }
+      }
+      else
+      {
+        open.push_back(type);
+      }
+    }
+    else if (token.isEnd())
+    {
+      if (open.empty())
+      {
+        break;
+      }
+
+      const int type = open.back();
+      open.pop_back();
+      if (!handler.endElement(type, token.getName()))
+      {
+        return LIBSEDML_OPERATION_SUCCESS;
+      }
+
+      if (open.empty())
+      {
+        break;
+      }
+    }
+    else if (token.isEOF())
+    {
+      break;
+    }
+  }
+
+  return stream.isError() ? LIBSEDML_OPERATION_FAILED
+                          : LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * Returns true if libSBML would decompress the file, judging by its name.
+ */
+static bool
+isCompressedFile (const std::string& filename)
+{
+  static const char* const suffixes[] = { ".gz", ".zip", ".bz2", ".bz" };
+
+  for (size_t i = 0; i < sizeof(suffixes) / sizeof(suffixes[0]); ++i)
+  {
+    const size_t length = strlen(suffixes[i]);
+    if (filename.size() > length &&
+        filename.compare(filename.size() - length, length, suffixes[i]) == 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * Used by readSedML() and readSedMLFromFile(): uncompressed files are
+ * parsed from a memory mapping, everything else goes through libSBML.
+ */
+SedDocument*
+SedReader::readFileInternal (const std::string& filename)
+{
+  if (isCompressedFile(filename))
+  {
+    return readInternal(filename.c_str(), true);
+  }
+
+  SedMappedFile mapped(filename);
+
+  if (mapped.getData() == NULL)
+  {
+    return readInternal(filename.c_str(), true);
+  }
+
+  return readInternal(mapped.getData(), false);
+}
+
+
 /*
  * Used by readSedML() and readSedMLFromString().
  */
@@ -226,6 +666,8 @@ SedReader::readInternal (const char* content, bool isFile)
 	  return d;
     }
 	
+    d->setLoadMask(mLoadMask);
+    d->setArenaAllocation(mArenaAllocation);
     d->read(stream);
     
     if (stream.isError())
@@ -328,8 +770,7 @@ SedDocument_t *
 SedReader_readSedMLFromString (SedReader_t *sr, const char *xml)
 {
   if (sr != NULL)
-    return (xml != NULL) ? sr->readSedMLFromString(xml) :
-                         sr->readSedMLFromString("");
+    return sr->readSedMLFromBuffer(xml);
   else
     return NULL;
 }
@@ -351,6 +792,25 @@ SedReader_hasBzip2 (void)
 }
 
 
+LIBSEDML_EXTERN
+void
+SedReader_setLoadMask (SedReader_t *sr, unsigned int mask)
+{
+  if (sr != NULL)
+  {
+    sr->setLoadMask(mask);
+  }
+}
+
+
+LIBSEDML_EXTERN
+unsigned int
+SedReader_getLoadMask (const SedReader_t *sr)
+{
+  return (sr != NULL) ? sr->getLoadMask() : 0;
+}
+
+
 LIBSEDML_EXTERN
 SedDocument_t *
 readSedML (const char *filename)
@@ -374,7 +834,7 @@ SedDocument_t *
 readSedMLFromString (const char *xml)
 {
   SedReader sr;
-  return (xml != NULL) ? sr.readSedMLFromString(xml) : sr.readSedMLFromString("");
+  return sr.readSedMLFromBuffer(xml);
 }
 
 LIBSEDML_CPP_NAMESPACE_END
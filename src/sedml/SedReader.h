@@ -44,14 +44,49 @@
 #include <sedml/common/sedmlfwd.h>
 #include <sbml/util/util.h>
 
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+/**
+ * @enum SedLoadMask_t
+ * Flags selecting which parts of a SED-ML document SedReader builds.
+ *
+ * Content whose flag is not set in the load mask of a SedReader is skipped
+ * during reading without creating any objects for it.
+ *
+ * @see SedReader::setLoadMask()
+ */
+typedef enum
+{
+    SEDML_LOAD_ALGORITHM_PARAMETERS   = 0x0001 /*!< the listOfAlgorithmParameters of the document */
+  , SEDML_LOAD_DATA_DESCRIPTIONS      = 0x0002 /*!< the listOfDataDescriptions */
+  , SEDML_LOAD_MODELS                 = 0x0004 /*!< the listOfModels */
+  , SEDML_LOAD_SIMULATIONS            = 0x0008 /*!< the listOfSimulations */
+  , SEDML_LOAD_TASKS                  = 0x0010 /*!< the listOfTasks */
+  , SEDML_LOAD_DATA_GENERATORS        = 0x0020 /*!< the listOfDataGenerators */
+  , SEDML_LOAD_OUTPUTS                = 0x0040 /*!< the listOfOutputs */
+  , SEDML_LOAD_STYLES                 = 0x0080 /*!< the listOfStyles */
+  , SEDML_LOAD_NOTES                  = 0x0100 /*!< the notes of every element */
+  , SEDML_LOAD_ANNOTATIONS            = 0x0200 /*!< the annotations of every element */
+  , SEDML_LOAD_DIMENSION_DESCRIPTIONS = 0x0400 /*!< the NuML dimensionDescription of data descriptions */
+  , SEDML_LOAD_XML_PAYLOADS           = 0x0800 /*!< the newXML content of addXML and changeXML */
+  , SEDML_LOAD_ALL                    = 0x0FFF /*!< everything (the default) */
+} SedLoadMask_t;
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
 #ifdef __cplusplus
 
 
 #include <string>
+#include <vector>
 
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
 class SedDocument;
+class SedErrorLog;
+class SedReaderHandler;
 
 
 class LIBSEDML_EXTERN SedReader
@@ -98,6 +133,11 @@ public:
    * @return a pointer to the SedDocument object created from the Sed
    * content in @p filename.
    *
+   * On platforms that support it, an uncompressed file is parsed directly
+   * from a read-only memory mapping instead of being read through a
+   * stream.  Compressed files (see hasZlib() and hasBzip2()) are
+   * decompressed by libSBML as before.
+   *
    * @see readSedMLFromString(@if java String@endif)
    * @see SedError
    * @see SedDocument
@@ -116,6 +156,56 @@ public:
   SedDocument* readSedMLFromString (const std::string& xml);
 
 
+  /**
+   * Reads a SED-ML document from a null-terminated buffer owned by the
+   * caller.
+   *
+   * Unlike readSedMLFromString(), the buffer is parsed in place, without
+   * being copied, as long as it begins with an XML declaration; otherwise
+   * a copy with the declaration prepended is read instead.  The buffer
+   * must stay valid until this method returns.
+   *
+   * @param xml a null-terminated buffer holding a full SED-ML document.
+   *
+   * @return a pointer to the SedDocument created from the content of
+   * @p xml.
+   *
+   * @see readSedMLFromString(@if java String@endif)
+   */
+  SedDocument* readSedMLFromBuffer (const char* xml);
+
+
+  /**
+   * Reads several SED-ML files concurrently.
+   *
+   * The files are distributed over @p numThreads threads (the calling
+   * thread included), each of which reads one file at a time exactly as
+   * readSedMLFromFile() would, honouring the load mask of this SedReader.
+   *
+   * Documents returned by this method are independent of each other, but
+   * each one must only be used by one thread at a time: even the @c const
+   * accessors of a document may update caches, such as the notes and
+   * annotations that are only parsed when first requested.
+   *
+   * When libSBML is built with the Xerces-C++ parser, whose global
+   * initialization is not thread-safe, the files are read one after the
+   * other on the calling thread.
+   *
+   * @param filenames the names of the files to read.
+   *
+   * @param numThreads the number of threads to use, or @c 0 to use one
+   * thread per hardware thread.
+   *
+   * @return a vector with one SedDocument per entry of @p filenames, in the
+   * same order.  Problems encountered while reading a file are recorded in
+   * the error log of its SedDocument; a file whose reading throws an
+   * exception yields an empty document with an XMLFileUnreadable error.
+   * The caller owns the documents and is responsible for deleting them.
+   */
+  std::vector<SedDocument*> readSedMLBatch (const std::vector<std::string>& filenames,
+                                            unsigned int numThreads = 0);
+
+
   /**
    * Static method; returns @c true if this copy of libSEDML supports
    * <i>gzip</I> and <i>zip</i> format compression.
@@ -140,6 +230,100 @@ public:
   static bool hasBzip2();
 
 
+  /**
+   * Selects which parts of a document are built by subsequent calls to the
+   * read methods of this SedReader.
+   *
+   * Skipped content is scanned past without constructing any objects, so
+   * that reading only the parts that are needed is faster and uses less
+   * memory. The resulting SedDocument records the mask it was read with
+   * (see SedDocument::getLoadMask()); writing it out again loses whatever
+   * was skipped.
+   *
+   * @param mask a bitwise combination of @if clike #SedLoadMask_t@else the
+   * SEDML_LOAD_* constants@endif@~; the default is @c SEDML_LOAD_ALL.
+   */
+  void setLoadMask (unsigned int mask);
+
+
+  /**
+   * Returns the load mask of this SedReader.
+   *
+   * @return the bitwise combination of @if clike #SedLoadMask_t@else the
+   * SEDML_LOAD_* constants@endif@~ selecting the content that is built.
+   *
+   * @see setLoadMask(unsigned int mask)
+   */
+  unsigned int getLoadMask () const;
+
+
+  /**
+   * Sets whether the documents read by subsequent calls to the read methods
+   * of this SedReader allocate their objects from a pool.
+   *
+   * Reading and deleting large documents is faster with the pool, as the
+   * many small objects of the document then share a few large allocations.
+   * The setting stays with the resulting SedDocument; see
+   * SedDocument::setArenaAllocation() for the details.
+   *
+   * @param enable @c true to read documents into a pool; the default is
+   * @c false.
+   */
+  void setArenaAllocation (bool enable);
+
+
+  /**
+   * Returns whether the documents read by this SedReader allocate their
+   * objects from a pool.
+   *
+   * @return @c true if arena allocation is enabled, @c false otherwise.
+   *
+   * @see setArenaAllocation(bool enable)
+   */
+  bool getArenaAllocation () const;
+
+
+  /**
+   * Reads the SED-ML file @p filename without building a SedDocument,
+   * reporting each element to @p handler as it is encountered.
+   *
+   * Only the stack of currently open elements is kept in memory, so the
+   * memory used does not depend on the size of the file. The parse stops
+   * as soon as a callback of @p handler returns @c false.
+   *
+   * @param filename the name or full pathname of the file to be read.
+   * @param handler the SedReaderHandler receiving the elements.
+   * @param log an optional SedErrorLog to which XML errors are reported.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   *
+   * Stopping the parse from the handler is not a failure.
+   */
+  int parseSedML (const std::string& filename, SedReaderHandler& handler,
+                  SedErrorLog* log = NULL);
+
+
+  /**
+   * Reads the SED-ML content of @p xml without building a SedDocument,
+   * reporting each element to @p handler as it is encountered.
+   *
+   * @param xml a string containing a full SED-ML document.
+   * @param handler the SedReaderHandler receiving the elements.
+   * @param log an optional SedErrorLog to which XML errors are reported.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   *
+   * @see parseSedML(const std::string& filename, SedReaderHandler& handler, SedErrorLog* log)
+   */
+  int parseSedMLFromString (const std::string& xml,
+                            SedReaderHandler& handler,
+                            SedErrorLog* log = NULL);
+
+
 protected:
   /** @cond doxygenLibsedmlInternal */
   /**
@@ -147,6 +331,24 @@ protected:
    */
   SedDocument* readInternal (const char* content, bool isFile = true);
 
+
+  /**
+   * Used by readSedML() and readSedMLFromFile(); parses uncompressed files
+   * from a read-only memory mapping.
+   */
+  SedDocument* readFileInternal (const std::string& filename);
+
+
+  /**
+   * Used by parseSedML() and parseSedMLFromString().
+   */
+  int parseInternal (const char* content, bool isFile,
+                     SedReaderHandler& handler, SedErrorLog* log);
+
+
+  unsigned int mLoadMask;
+  bool mArenaAllocation;
+
   /** @endcond */
 };
 
@@ -281,6 +483,39 @@ LIBSEDML_EXTERN
 int
 SedReader_hasBzip2 ();
 
+
+/**
+ * Selects which parts of a document are built by the given SedReader_t.
+ *
+ * @param sr the SedReader_t structure to use.
+ *
+ * @param mask a bitwise combination of #SedLoadMask_t values.
+ *
+ * @if conly
+ * @memberof SedReader_t
+ * @endif
+ */
+LIBSEDML_EXTERN
+void
+SedReader_setLoadMask (SedReader_t *sr, unsigned int mask);
+
+
+/**
+ * Returns the load mask of the given SedReader_t.
+ *
+ * @param sr the SedReader_t structure to use.
+ *
+ * @return a bitwise combination of #SedLoadMask_t values, or @c 0 if
+ * @p sr is @c NULL.
+ *
+ * @if conly
+ * @memberof SedReader_t
+ * @endif
+ */
+LIBSEDML_EXTERN
+unsigned int
+SedReader_getLoadMask (const SedReader_t *sr);
+
 #endif  /* !SWIG */
 
 
@@ -0,0 +1,118 @@
+/**
+ * @file SedReaderHandler.h
+ * @brief Definition of the SedReaderHandler class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedReaderHandler
+ * @sbmlbrief{} Callback interface for event-driven reading of SED-ML.
+ *
+ * A SedReaderHandler receives the elements of a SED-ML file, in document
+ * order, from SedReader::parseSedML() and
+ * SedReader::parseSedMLFromString(). No SedBase objects are created: each
+ * element is reported with its libSEDML type code, its XML name and its
+ * attributes, which are only valid for the duration of the call.
+ *
+ * Returning @c false from any callback stops the parse.
+ *
+ * Content that is not SED-ML (math, notes, annotations, the XML payload
+ * of changes and the values of a vectorRange) is reported as an element
+ * of type @c SEDML_UNKNOWN and skipped as a whole.
+ */
+
+
+#ifndef SedReaderHandler_h
+#define SedReaderHandler_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+#include <sedml/SedTypeCodes.h>
+
+
+#ifdef __cplusplus
+
+
+#include <string>
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+class XMLAttributes;
+LIBSBML_CPP_NAMESPACE_END
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+class LIBSEDML_EXTERN SedReaderHandler
+{
+public:
+
+  /**
+   * Destroys this SedReaderHandler.
+   */
+  virtual ~SedReaderHandler ();
+
+
+  /**
+   * Called for the start tag of every element.
+   *
+   * @param type the @if clike #SedTypeCode_t@else int@endif@~ of the
+   * element (@c SEDML_LIST_OF for all the listOf elements, @c SEDML_UNKNOWN
+   * for content that is not SED-ML).
+   * @param name the XML name of the element.
+   * @param attributes the attributes of the element.
+   *
+   * @return @c true to continue parsing, @c false to stop.
+   */
+  virtual bool startElement (int type, const std::string& name,
+                             const LIBSBML_CPP_NAMESPACE_QUALIFIER
+                               XMLAttributes& attributes);
+
+
+  /**
+   * Called for the end tag of every element.
+   *
+   * @param type the @if clike #SedTypeCode_t@else int@endif@~ of the
+   * element.
+   * @param name the XML name of the element.
+   *
+   * @return @c true to continue parsing, @c false to stop.
+   */
+  virtual bool endElement (int type, const std::string& name);
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedReaderHandler_h */
@@ -0,0 +1,344 @@
+/**
+ * @file SedReferenceGraph.cpp
+ * @brief Implementation of the SedReferenceGraph class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedReferenceGraph.h>
+#include <sedml/SedDocument.h>
+#include <sedml/SedListOf.h>
+
+#include <deque>
+#include <unordered_set>
+
+
+using namespace std;
+
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Creates a new, empty SedReferenceGraph.
+ */
+SedReferenceGraph::SedReferenceGraph()
+  : mDocument (NULL)
+  , mReferences ()
+  , mForward ()
+  , mReverse ()
+{
+}
+
+
+/*
+ * Creates a new SedReferenceGraph for the given SedDocument.
+ */
+SedReferenceGraph::SedReferenceGraph(const SedDocument* doc)
+  : mDocument (NULL)
+  , mReferences ()
+  , mForward ()
+  , mReverse ()
+{
+  build(doc);
+}
+
+
+/*
+ * Destructor for SedReferenceGraph.
+ */
+SedReferenceGraph::~SedReferenceGraph()
+{
+}
+
+
+/*
+ * (Re)builds this graph from the given SedDocument.
+ */
+void
+SedReferenceGraph::build(const SedDocument* doc)
+{
+  clear();
+  mDocument = doc;
+
+  if (doc == NULL)
+  {
+    return;
+  }
+
+  // read in place, so that lists shared by a copy-on-write clone stay shared
+  List* elements = doc->collectElements(NULL);
+  if (elements == NULL)
+  {
+    return;
+  }
+
+  SedIdRefList refs;
+  while (elements->getSize() > 0)
+  {
+    const SedBase* element = static_cast<const SedBase*>(elements->remove(0));
+
+    refs.clear();
+    element->collectSIdRefs(refs);
+
+    for (SedIdRefList::const_iterator it = refs.begin(); it != refs.end(); ++it)
+    {
+      SedReference ref = { element, it->first, it->second,
+                           resolve(element, it->first, it->second) };
+      mReferences.push_back(ref);
+    }
+  }
+  delete elements;
+
+  // mReferences no longer grows, so pointers into it stay valid
+  for (vector<SedReference>::const_iterator it = mReferences.begin();
+       it != mReferences.end(); ++it)
+  {
+    mForward[it->referrer].push_back(&(*it));
+    if (it->target != NULL)
+    {
+      mReverse[it->target].push_back(&(*it));
+    }
+  }
+}
+
+
+/*
+ * Removes all references from this graph.
+ */
+void
+SedReferenceGraph::clear()
+{
+  mDocument = NULL;
+  mReferences.clear();
+  mForward.clear();
+  mReverse.clear();
+}
+
+
+/*
+ * Returns the SedDocument this graph was built for.
+ */
+const SedDocument*
+SedReferenceGraph::getSedDocument() const
+{
+  return mDocument;
+}
+
+
+/*
+ * Returns the number of references in this graph.
+ */
+unsigned int
+SedReferenceGraph::getNumReferences() const
+{
+  return (unsigned int)mReferences.size();
+}
+
+
+/*
+ * Returns the nth reference of this graph.
+ */
+const SedReference*
+SedReferenceGraph::getReference(unsigned int n) const
+{
+  return (n < mReferences.size()) ? &mReferences[n] : NULL;
+}
+
+
+/*
+ * Returns the references made by the given element.
+ */
+const SedReferenceGraph::ReferenceList&
+SedReferenceGraph::getReferencesFrom(const SedBase* element) const
+{
+  static const ReferenceList empty;
+  AdjacencyMap::const_iterator it = mForward.find(element);
+  return (it == mForward.end()) ? empty : it->second;
+}
+
+
+/*
+ * Returns the references that resolve to the given element.
+ */
+const SedReferenceGraph::ReferenceList&
+SedReferenceGraph::getReferencesTo(const SedBase* element) const
+{
+  static const ReferenceList empty;
+  AdjacencyMap::const_iterator it = mReverse.find(element);
+  return (it == mReverse.end()) ? empty : it->second;
+}
+
+
+/*
+ * Returns the references whose identifier could not be resolved.
+ */
+SedReferenceGraph::ReferenceList
+SedReferenceGraph::getUnresolvedReferences() const
+{
+  ReferenceList result;
+  for (vector<SedReference>::const_iterator it = mReferences.begin();
+       it != mReferences.end(); ++it)
+  {
+    if (it->target == NULL)
+    {
+      result.push_back(&(*it));
+    }
+  }
+  return result;
+}
+
+
+/*
+ * Returns the elements that refer to the given element.
+ */
+vector<const SedBase*>
+SedReferenceGraph::getReferrers(const SedBase* element, int type) const
+{
+  vector<const SedBase*> result;
+  unordered_set<const SedBase*> seen;
+
+  const ReferenceList& refs = getReferencesTo(element);
+  for (ReferenceList::const_iterator it = refs.begin(); it != refs.end(); ++it)
+  {
+    const SedBase* referrer = (*it)->referrer;
+    if (type != SEDML_UNKNOWN && referrer->getTypeCode() != type)
+    {
+      referrer = referrer->getAncestorOfType(type);
+    }
+
+    if (referrer != NULL && seen.insert(referrer).second)
+    {
+      result.push_back(referrer);
+    }
+  }
+
+  return result;
+}
+
+
+/*
+ * Returns every element that depends on the given element.
+ */
+vector<const SedBase*>
+SedReferenceGraph::getDependents(const SedBase* element) const
+{
+  vector<const SedBase*> result;
+  unordered_set<const SedBase*> seen;
+  deque<const SedBase*> pending;
+
+  seen.insert(element);
+  pending.push_back(element);
+
+  while (!pending.empty())
+  {
+    const ReferenceList& refs = getReferencesTo(pending.front());
+    pending.pop_front();
+
+    for (ReferenceList::const_iterator it = refs.begin(); it != refs.end(); ++it)
+    {
+      // whatever contains a referring element depends on it as well
+      for (const SedBase* obj = (*it)->referrer;
+           obj != NULL && obj != mDocument; obj = obj->getParentSedObject())
+      {
+        if (obj->getTypeCode() == SEDML_LIST_OF)
+        {
+          continue;
+        }
+        if (!seen.insert(obj).second)
+        {
+          break;
+        }
+        result.push_back(obj);
+        pending.push_back(obj);
+      }
+    }
+  }
+
+  return result;
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Resolves the given identifier as seen from the referrer.
+ *
+ * Identifiers in math and "range" attributes are local: they name variables
+ * and parameters of the referrer or ranges of the enclosing repeated task,
+ * and are looked up there before the document-wide namespace is consulted.
+ */
+const SedBase*
+SedReferenceGraph::resolve(const SedBase* referrer, const string& attribute,
+                           const string& id) const
+{
+  if (attribute == "math" || attribute == "range")
+  {
+    const SedBase* found = referrer->getElementBySId(id);
+    if (found != NULL)
+    {
+      return found;
+    }
+
+    const SedBase* parent = referrer->getParentSedObject();
+    if (parent != NULL && parent->getTypeCode() == SEDML_LIST_OF)
+    {
+      parent = parent->getParentSedObject();
+    }
+
+    if (parent != NULL && parent != mDocument)
+    {
+      found = parent->getElementBySId(id);
+      if (found != NULL)
+      {
+        return found;
+      }
+    }
+  }
+
+  return mDocument->getElementBySId(id);
+}
+
+/** @endcond */
+
+
+#endif /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
@@ -0,0 +1,253 @@
+/**
+ * @file SedReferenceGraph.h
+ * @brief Definition of the SedReferenceGraph class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedReferenceGraph
+ * @sbmlbrief{} Forward and reverse index of the SIdRef attributes of a
+ * SedDocument.
+ *
+ * A SedReferenceGraph is built in a single pass over a SedDocument. For
+ * every SIdRef attribute known to SedBase::collectSIdRefs() (taskReference,
+ * modelReference, xDataReference, style, ..., and the identifiers used in
+ * math) it records a SedReference, resolves the referenced identifier and
+ * makes the result available both from the referring element ("what does
+ * this Curve use?") and from the referenced one ("which DataGenerators use
+ * this Task?").
+ *
+ * The graph is a snapshot: it holds plain pointers into the document and
+ * has to be rebuilt with build() after the document has been modified.
+ */
+
+
+#ifndef SedReferenceGraph_h
+#define SedReferenceGraph_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+#include <sedml/SedTypeCodes.h>
+
+
+#ifdef __cplusplus
+
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedBase;
+class SedDocument;
+
+
+/**
+ * A single SIdRef found in a SedDocument.
+ */
+struct LIBSEDML_EXTERN SedReference
+{
+  /** the element carrying the attribute (or math) */
+  const SedBase* referrer;
+
+  /** the name of the attribute, or @c "math" */
+  std::string attribute;
+
+  /** the identifier that is referenced */
+  std::string id;
+
+  /** the element @c id resolves to, or @c NULL if it could not be found */
+  const SedBase* target;
+};
+
+
+class LIBSEDML_EXTERN SedReferenceGraph
+{
+public:
+
+  typedef std::vector<const SedReference*> ReferenceList;
+
+
+  /**
+   * Creates a new, empty SedReferenceGraph.
+   */
+  SedReferenceGraph();
+
+
+  /**
+   * Creates a new SedReferenceGraph for the given SedDocument.
+   *
+   * @param doc the SedDocument to build the graph for.
+   */
+  explicit SedReferenceGraph(const SedDocument* doc);
+
+
+  /**
+   * Destructor for SedReferenceGraph.
+   */
+  virtual ~SedReferenceGraph();
+
+
+  /**
+   * (Re)builds this graph from the given SedDocument, discarding any
+   * previous content.
+   *
+   * @param doc the SedDocument to build the graph for.
+   */
+  void build(const SedDocument* doc);
+
+
+  /**
+   * Removes all references from this graph.
+   */
+  void clear();
+
+
+  /**
+   * Returns the SedDocument this graph was built for.
+   *
+   * @return the SedDocument, or @c NULL if the graph is empty.
+   */
+  const SedDocument* getSedDocument() const;
+
+
+  /**
+   * Returns the number of references in this graph.
+   *
+   * @return the number of SedReference entries.
+   */
+  unsigned int getNumReferences() const;
+
+
+  /**
+   * Returns the nth reference of this graph, in document order.
+   *
+   * @param n an unsigned int representing the index of the reference.
+   *
+   * @return the nth SedReference, or @c NULL if @p n is out of range.
+   */
+  const SedReference* getReference(unsigned int n) const;
+
+
+  /**
+   * Returns the references made by the given element (forward edges).
+   *
+   * @param element the referring SedBase.
+   *
+   * @return the references made by @p element; the list is empty if there
+   * are none.
+   */
+  const ReferenceList& getReferencesFrom(const SedBase* element) const;
+
+
+  /**
+   * Returns the references that resolve to the given element (reverse
+   * edges).
+   *
+   * @param element the referenced SedBase.
+   *
+   * @return the references to @p element; the list is empty if there are
+   * none.
+   */
+  const ReferenceList& getReferencesTo(const SedBase* element) const;
+
+
+  /**
+   * Returns the references whose identifier could not be resolved.
+   *
+   * @return the dangling references, in document order.
+   */
+  ReferenceList getUnresolvedReferences() const;
+
+
+  /**
+   * Returns the elements that refer to @p element.
+   *
+   * If @p type is not @c SEDML_UNKNOWN, each referring element is replaced
+   * by its closest ancestor (or itself) of that type, and references for
+   * which no such element exists are skipped. For example, asking for the
+   * referrers of a task with type @c SEDML_DATAGENERATOR yields the data
+   * generators whose variables use the task.
+   *
+   * @param element the referenced SedBase.
+   * @param type the @if clike #SedTypeCode_t@else int@endif@~ of the
+   * elements to return.
+   *
+   * @return the referring elements, without duplicates, in document order.
+   */
+  std::vector<const SedBase*> getReferrers(const SedBase* element,
+                                           int type = SEDML_UNKNOWN) const;
+
+
+  /**
+   * Returns every element that depends on @p element, directly or
+   * transitively.
+   *
+   * An element depends on @p element if it, or one of its children, refers
+   * to @p element or to another dependent. For instance, the dependents of
+   * a model include the tasks that simulate it, the data generators reading
+   * those tasks and the curves plotting those data generators.
+   *
+   * @param element the SedBase whose dependents are requested.
+   *
+   * @return the dependents of @p element in breadth-first order.
+   */
+  std::vector<const SedBase*> getDependents(const SedBase* element) const;
+
+
+private:
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  SedReferenceGraph(const SedReferenceGraph&);
+  SedReferenceGraph& operator=(const SedReferenceGraph&);
+
+  const SedBase* resolve(const SedBase* referrer, const std::string& attribute,
+                         const std::string& id) const;
+
+  typedef std::unordered_map<const SedBase*, ReferenceList> AdjacencyMap;
+
+  const SedDocument* mDocument;
+  std::vector<SedReference> mReferences;
+  AdjacencyMap mForward;
+  AdjacencyMap mReverse;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedReferenceGraph_h */
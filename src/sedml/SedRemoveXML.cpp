@@ -54,14 +54,13 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedRemoveXML::SedRemoveXML(unsigned int level, unsigned int version)
   : SedChange(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedRemoveXML using the given SedNamespaces object @p sedmlns.
  */
-SedRemoveXML::SedRemoveXML(SedNamespaces *sedmlns)
+SedRemoveXML::SedRemoveXML(const SedNamespaces *sedmlns)
   : SedChange(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -77,6 +76,15 @@ SedRemoveXML::SedRemoveXML(const SedRemoveXML& orig)
 }
 
 
+/*
+ * Move constructor for SedRemoveXML.
+ */
+SedRemoveXML::SedRemoveXML(SedRemoveXML&& orig)
+  : SedChange( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedRemoveXML.
  */
@@ -92,6 +100,21 @@ SedRemoveXML::operator=(const SedRemoveXML& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedRemoveXML.
+ */
+SedRemoveXML&
+SedRemoveXML::operator=(SedRemoveXML&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedChange::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedRemoveXML object.
  */
@@ -86,7 +86,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedRemoveXML(SedNamespaces *sedmlns);
+  SedRemoveXML(const SedNamespaces *sedmlns);
 
 
   /**
@@ -106,6 +106,28 @@ public:
   SedRemoveXML& operator=(const SedRemoveXML& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedRemoveXML.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedRemoveXML instance to move from.
+   */
+  SedRemoveXML(SedRemoveXML&& orig);
+
+
+  /**
+   * Move assignment operator for SedRemoveXML.
+   *
+   * @param rhs the SedRemoveXML object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedRemoveXML& operator=(SedRemoveXML&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedRemoveXML object.
    *
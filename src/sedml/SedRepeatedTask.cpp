@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedRepeatedTask.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 #include <sedml/SedUniformRange.h>
@@ -67,7 +68,6 @@ SedRepeatedTask::SedRepeatedTask(unsigned int level, unsigned int version)
   , mSetValues (level, version)
   , mSubTasks (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -76,7 +76,7 @@ SedRepeatedTask::SedRepeatedTask(unsigned int level, unsigned int version)
  * Creates a new SedRepeatedTask using the given SedNamespaces object @p
  * sedmlns.
  */
-SedRepeatedTask::SedRepeatedTask(SedNamespaces *sedmlns)
+SedRepeatedTask::SedRepeatedTask(const SedNamespaces *sedmlns)
   : SedAbstractTask(sedmlns)
   , mRange ("")
   , mResetModel (false)
@@ -110,6 +110,24 @@ SedRepeatedTask::SedRepeatedTask(const SedRepeatedTask& orig)
 }
 
 
+/*
+ * Move constructor for SedRepeatedTask.
+ */
+SedRepeatedTask::SedRepeatedTask(SedRepeatedTask&& orig)
+  : SedAbstractTask( std::move(orig) )
+  , mRange ( std::move(orig.mRange) )
+  , mResetModel ( std::move(orig.mResetModel) )
+  , mIsSetResetModel ( std::move(orig.mIsSetResetModel) )
+  , mConcatenate ( std::move(orig.mConcatenate) )
+  , mIsSetConcatenate ( std::move(orig.mIsSetConcatenate) )
+  , mRanges ( std::move(orig.mRanges) )
+  , mSetValues ( std::move(orig.mSetValues) )
+  , mSubTasks ( std::move(orig.mSubTasks) )
+{
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedRepeatedTask.
  */
@@ -134,6 +152,31 @@ SedRepeatedTask::operator=(const SedRepeatedTask& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedRepeatedTask.
+ */
+SedRepeatedTask&
+SedRepeatedTask::operator=(SedRepeatedTask&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedAbstractTask::operator=(std::move(rhs));
+    mRange = std::move(rhs.mRange);
+    mResetModel = std::move(rhs.mResetModel);
+    mIsSetResetModel = std::move(rhs.mIsSetResetModel);
+    mConcatenate = std::move(rhs.mConcatenate);
+    mIsSetConcatenate = std::move(rhs.mIsSetConcatenate);
+    mRanges = std::move(rhs.mRanges);
+    mSetValues = std::move(rhs.mSetValues);
+    mSubTasks = std::move(rhs.mSubTasks);
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedRepeatedTask object.
  */
@@ -418,6 +461,51 @@ SedRepeatedTask::addRange(const SedRange* sr)
 }
 
 
+/*
+ * Adds the given SedRange to this SedRepeatedTask,
+ * which takes ownership of it.
+ */
+int
+SedRepeatedTask::addRange(std::unique_ptr<SedRange> sr)
+{
+  if (!sr)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sr->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sr.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sr->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sr->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sr->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sr.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sr->isSetId() && (mRanges.get(sr->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mRanges.appendAndOwn(std::move(sr));
+  }
+}
+
+
 /*
  * Get the number of SedRange objects in this SedRepeatedTask.
  */
@@ -439,7 +527,7 @@ SedRepeatedTask::createUniformRange()
 
   try
   {
-    sur = new SedUniformRange(getSedNamespaces());
+    sur = new (getSedArena()) SedUniformRange(getSedNamespaces());
   }
   catch (...)
   {
@@ -465,7 +553,7 @@ SedRepeatedTask::createVectorRange()
 
   try
   {
-    svr = new SedVectorRange(getSedNamespaces());
+    svr = new (getSedArena()) SedVectorRange(getSedNamespaces());
   }
   catch (...)
   {
@@ -491,7 +579,7 @@ SedRepeatedTask::createFunctionalRange()
 
   try
   {
-    sfr = new SedFunctionalRange(getSedNamespaces());
+    sfr = new (getSedArena()) SedFunctionalRange(getSedNamespaces());
   }
   catch (...)
   {
@@ -517,7 +605,7 @@ SedRepeatedTask::createDataRange()
 
   try
   {
-    sdr = new SedDataRange(getSedNamespaces());
+    sdr = new (getSedArena()) SedDataRange(getSedNamespaces());
   }
   catch (const SedConstructorException&)
   {
@@ -677,6 +765,51 @@ SedRepeatedTask::addTaskChange(const SedSetValue* ssv)
 }
 
 
+/*
+ * Adds the given SedSetValue to this SedRepeatedTask,
+ * which takes ownership of it.
+ */
+int
+SedRepeatedTask::addTaskChange(std::unique_ptr<SedSetValue> ssv)
+{
+  if (!ssv)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (ssv->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    ssv.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ssv->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (ssv->hasRequiredElements() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != ssv->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != ssv->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(ssv.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return mSetValues.appendAndOwn(std::move(ssv));
+  }
+}
+
+
 /*
  * Get the number of SedSetValue objects in this SedRepeatedTask.
  */
@@ -698,7 +831,7 @@ SedRepeatedTask::createTaskChange()
 
   try
   {
-    ssv = new SedSetValue(getSedNamespaces());
+    ssv = new (getSedArena()) SedSetValue(getSedNamespaces());
   }
   catch (...)
   {
@@ -820,6 +953,47 @@ SedRepeatedTask::addSubTask(const SedSubTask* sst)
 }
 
 
+/*
+ * Adds the given SedSubTask to this SedRepeatedTask,
+ * which takes ownership of it.
+ */
+int
+SedRepeatedTask::addSubTask(std::unique_ptr<SedSubTask> sst)
+{
+  if (!sst)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sst->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sst.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sst->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sst->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sst->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sst.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return mSubTasks.appendAndOwn(std::move(sst));
+  }
+}
+
+
 /*
  * Get the number of SedSubTask objects in this SedRepeatedTask.
  */
@@ -841,7 +1015,7 @@ SedRepeatedTask::createSubTask()
 
   try
   {
-    sst = new SedSubTask(getSedNamespaces());
+    sst = new (getSedArena()) SedSubTask(getSedNamespaces());
   }
   catch (...)
   {
@@ -880,6 +1054,99 @@ SedRepeatedTask::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedRepeatedTask object to @p refs.
+ */
+void
+SedRepeatedTask::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetRangeId())
+  {
+    refs.push_back(std::make_pair(std::string("range"), mRange));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedRepeatedTask object to @p usage.
+ */
+void
+SedRepeatedTask::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedAbstractTask::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedRepeatedTask) - sizeof(SedAbstractTask) -
+    sizeof(SedListOfRanges) -
+    sizeof(SedListOfSetValues) -
+    sizeof(SedListOfSubTasks));
+  usage.addString(type, mRange);
+
+  if (mRanges.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mRanges.addMemoryUsage(usage);
+  }
+
+  if (mSetValues.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mSetValues.addMemoryUsage(usage);
+  }
+
+  if (mSubTasks.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mSubTasks.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedRepeatedTask object to @p
+ * stream.
+ */
+void
+SedRepeatedTask::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedAbstractTask::writeBinary(stream);
+
+  stream.writeString(mRange);
+  stream.writeBool(mResetModel);
+  stream.writeBool(mIsSetResetModel);
+  stream.writeBool(mConcatenate);
+  stream.writeBool(mIsSetConcatenate);
+  mRanges.writeBinary(stream);
+  mSetValues.writeBinary(stream);
+  mSubTasks.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedRepeatedTask object from @p
+ * stream.
+ */
+void
+SedRepeatedTask::readBinary(SedBinaryInputStream& stream)
+{
+  SedAbstractTask::readBinary(stream);
+
+  stream.readString(mRange);
+  mResetModel = stream.readBool();
+  mIsSetResetModel = stream.readBool();
+  mConcatenate = stream.readBool();
+  mIsSetConcatenate = stream.readBool();
+  mRanges.readBinary(stream);
+  mSetValues.readBinary(stream);
+  mSubTasks.readBinary(stream);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedRepeatedTask object.
@@ -103,7 +103,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedRepeatedTask(SedNamespaces *sedmlns);
+  SedRepeatedTask(const SedNamespaces *sedmlns);
 
 
   /**
@@ -123,6 +123,28 @@ public:
   SedRepeatedTask& operator=(const SedRepeatedTask& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedRepeatedTask.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedRepeatedTask instance to move from.
+   */
+  SedRepeatedTask(SedRepeatedTask&& orig);
+
+
+  /**
+   * Move assignment operator for SedRepeatedTask.
+   *
+   * @param rhs the SedRepeatedTask object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedRepeatedTask& operator=(SedRepeatedTask&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedRepeatedTask object.
    *
@@ -409,6 +431,28 @@ public:
   int addRange(const SedRange* sr);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedRange to this SedRepeatedTask without copying it.
+   *
+   * @param sr the SedRange object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addRange(const SedRange* sr)
+   */
+  int addRange(std::unique_ptr<SedRange> sr);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedRange objects in this SedRepeatedTask.
    *
@@ -701,6 +745,28 @@ public:
   int addTaskChange(const SedSetValue* ssv);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSetValue to this SedRepeatedTask without copying it.
+   *
+   * @param ssv the SedSetValue object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addTaskChange(const SedSetValue* ssv)
+   */
+  int addTaskChange(std::unique_ptr<SedSetValue> ssv);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSetValue objects in this SedRepeatedTask.
    *
@@ -889,6 +955,28 @@ public:
   int addSubTask(const SedSubTask* sst);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSubTask to this SedRepeatedTask without copying it.
+   *
+   * @param sst the SedSubTask object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addSubTask(const SedSubTask* sst)
+   */
+  int addSubTask(std::unique_ptr<SedSubTask> sst);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSubTask objects in this SedRepeatedTask.
    *
@@ -950,6 +1038,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedRepeatedTask object.
    *
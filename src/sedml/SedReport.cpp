@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedReport.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -54,7 +55,6 @@ SedReport::SedReport(unsigned int level, unsigned int version)
   : SedOutput(level, version)
   , mDataSets (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -62,7 +62,7 @@ SedReport::SedReport(unsigned int level, unsigned int version)
 /*
  * Creates a new SedReport using the given SedNamespaces object @p sedmlns.
  */
-SedReport::SedReport(SedNamespaces *sedmlns)
+SedReport::SedReport(const SedNamespaces *sedmlns)
   : SedOutput(sedmlns)
   , mDataSets (sedmlns)
 {
@@ -82,6 +82,17 @@ SedReport::SedReport(const SedReport& orig)
 }
 
 
+/*
+ * Move constructor for SedReport.
+ */
+SedReport::SedReport(SedReport&& orig)
+  : SedOutput( std::move(orig) )
+  , mDataSets ( std::move(orig.mDataSets) )
+{
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedReport.
  */
@@ -99,6 +110,24 @@ SedReport::operator=(const SedReport& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedReport.
+ */
+SedReport&
+SedReport::operator=(SedReport&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedOutput::operator=(std::move(rhs));
+    mDataSets = std::move(rhs.mDataSets);
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedReport object.
  */
@@ -237,6 +266,50 @@ SedReport::addDataSet(const SedDataSet* sds)
 }
 
 
+/*
+ * Adds the given SedDataSet to this SedReport, which takes ownership of it.
+ */
+int
+SedReport::addDataSet(std::unique_ptr<SedDataSet> sds)
+{
+  if (!sds)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sds->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sds.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sds->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sds->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sds->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sds.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sds->isSetId() && (mDataSets.get(sds->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mDataSets.appendAndOwn(std::move(sds));
+  }
+}
+
+
 /*
  * Get the number of SedDataSet objects in this SedReport.
  */
@@ -258,7 +331,7 @@ SedReport::createDataSet()
 
   try
   {
-    sds = new SedDataSet(getSedNamespaces());
+    sds = new (getSedArena()) SedDataSet(getSedNamespaces());
   }
   catch (...)
   {
@@ -294,6 +367,55 @@ SedReport::removeDataSet(const std::string& sid)
 }
 
 
+/*
+ * Adds the memory held by this SedReport object to @p usage.
+ */
+void
+SedReport::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedOutput::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedReport) - sizeof(SedOutput) -
+    sizeof(SedListOfDataSets));
+
+  if (mDataSets.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mDataSets.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedReport object to @p stream.
+ */
+void
+SedReport::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedOutput::writeBinary(stream);
+
+  mDataSets.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedReport object from @p stream.
+ */
+void
+SedReport::readBinary(SedBinaryInputStream& stream)
+{
+  SedOutput::readBinary(stream);
+
+  mDataSets.readBinary(stream);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedReport object.
  */
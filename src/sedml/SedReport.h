@@ -92,7 +92,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedReport(SedNamespaces *sedmlns);
+  SedReport(const SedNamespaces *sedmlns);
 
 
   /**
@@ -112,6 +112,28 @@ public:
   SedReport& operator=(const SedReport& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedReport.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedReport instance to move from.
+   */
+  SedReport(SedReport&& orig);
+
+
+  /**
+   * Move assignment operator for SedReport.
+   *
+   * @param rhs the SedReport object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedReport& operator=(SedReport&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedReport object.
    *
@@ -302,6 +324,28 @@ public:
   int addDataSet(const SedDataSet* sds);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedDataSet to this SedReport without copying it.
+   *
+   * @param sds the SedDataSet object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addDataSet(const SedDataSet* sds)
+   */
+  int addDataSet(std::unique_ptr<SedDataSet> sds);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedDataSet objects in this SedReport.
    *
@@ -378,6 +422,28 @@ public:
   SedDataSet* removeDataSet(const std::string& sid);
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedReport object.
    *
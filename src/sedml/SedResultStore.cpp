@@ -0,0 +1,996 @@
+/**
+ * @file SedResultStore.cpp
+ * @brief Implementation of the SedResultStore class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <sedml/SedResultStore.h>
+#include <sedml/SedAppliedDimension.h>
+#include <sedml/SedCompiledMath.h>
+#include <sedml/SedDataGenerator.h>
+#include <sedml/SedVariable.h>
+#include <sedml/common/SedMappedFile.h>
+#include <sedml/common/SedOperationReturnValues.h>
+
+/** @cond doxygenIgnored */
+
+using namespace std;
+
+/** @endcond */
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+#ifdef __cplusplus
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Columns are aligned to cache lines, which also suits any vector unit.
+ */
+static const size_t COLUMN_ALIGNMENT = 64;
+
+/*
+ * Values appended by copying go into chunks of at least this many values,
+ * so that appending one time point at a time does not create a chunk for
+ * each.
+ */
+static const size_t MIN_CHUNK_LENGTH = 1024;
+
+static const char KEY_SEPARATOR = '\x1f';
+
+
+static double*
+allocateColumn(size_t length)
+{
+  void* data = NULL;
+#if defined(_WIN32)
+  data = _aligned_malloc(length * sizeof(double), COLUMN_ALIGNMENT);
+#else
+  if (posix_memalign(&data, COLUMN_ALIGNMENT, length * sizeof(double)) != 0)
+  {
+    data = NULL;
+  }
+#endif
+  return static_cast<double*>(data);
+}
+
+
+static void
+freeColumn(double* data)
+{
+#if defined(_WIN32)
+  _aligned_free(data);
+#else
+  free(data);
+#endif
+}
+
+
+/*
+ * Appends an optional part of a key, tagged with its name.
+ */
+static void
+addKeyField(std::string& key, const char* name, const std::string& value)
+{
+  if (!value.empty())
+  {
+    key += KEY_SEPARATOR;
+    key += name;
+    key += '=';
+    key += value;
+  }
+}
+
+/** @endcond */
+
+
+/*
+ * Creates a new, empty SedResultStore.
+ */
+SedResultStore::SedResultStore(size_t maxBytes)
+  : mColumns ()
+  , mBytes (0)
+  , mSpilledBytes (0)
+  , mMaxBytes (maxBytes)
+  , mSpillDirectory ()
+  , mClock (0)
+{
+}
+
+
+/*
+ * Destroys this SedResultStore and all its columns.
+ */
+SedResultStore::~SedResultStore()
+{
+  clear();
+}
+
+
+/*
+ * Returns the key of the column holding the values of a Variable.
+ */
+std::string
+SedResultStore::getKey(const SedVariable* variable)
+{
+  if (variable == NULL)
+  {
+    return "";
+  }
+
+  std::string key = getKey(variable->getTaskReference(),
+                           variable->getTarget(), variable->getSymbol());
+  addKeyField(key, "model", variable->getModelReference());
+  addKeyField(key, "term", variable->getTerm());
+  addKeyField(key, "target2", variable->getTarget2());
+  addKeyField(key, "symbol2", variable->getSymbol2());
+  addKeyField(key, "dimensionTerm", variable->getDimensionTerm());
+
+  for (unsigned int i = 0; i < variable->getNumAppliedDimensions(); ++i)
+  {
+    const SedAppliedDimension* dimension = variable->getAppliedDimension(i);
+    addKeyField(key, "dimension",
+                dimension->getTarget() + "/" +
+                dimension->getDimensionTarget());
+  }
+
+  return key;
+}
+
+
+/*
+ * Returns the key of the column holding a target or symbol of a task.
+ */
+std::string
+SedResultStore::getKey(const std::string& taskReference,
+                       const std::string& target,
+                       const std::string& symbol)
+{
+  return taskReference + KEY_SEPARATOR + target + KEY_SEPARATOR + symbol;
+}
+
+
+/*
+ * Appends a copy of values to a column, filling up its last chunk first.
+ */
+int
+SedResultStore::append(const std::string& key, const double* values,
+                       size_t length)
+{
+  if (key.empty() || (values == NULL && length != 0))
+  {
+    return LIBSEDML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  Column& column = mColumns[key];
+  column.lastUse = ++mClock;
+
+  if (!column.chunks.empty())
+  {
+    Chunk& last = column.chunks.back();
+    const size_t count = min(length, last.capacity - last.length);
+    if (last.file == NULL && count > 0)
+    {
+      memcpy(last.data + last.length, values, count * sizeof(double));
+      last.length += count;
+      column.length += count;
+      values += count;
+      length -= count;
+    }
+  }
+
+  if (length == 0)
+  {
+    return LIBSEDML_OPERATION_SUCCESS;
+  }
+
+  double* data = addChunk(column, length, max(length, MIN_CHUNK_LENGTH));
+  if (data == NULL)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+
+  memcpy(data, values, length * sizeof(double));
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Appends a chunk for the caller to fill in.  It is full from the start,
+ * so that appending to the column never moves it.
+ */
+double*
+SedResultStore::appendChunk(const std::string& key, size_t length)
+{
+  if (key.empty() || length == 0)
+  {
+    return NULL;
+  }
+
+  Column& column = mColumns[key];
+  column.lastUse = ++mClock;
+
+  double* data = addChunk(column, length, length);
+  if (data != NULL)
+  {
+    fill(data, data + length, numeric_limits<double>::quiet_NaN());
+  }
+
+  return data;
+}
+
+
+/*
+ * Predicate returning true if there is a column with the given key.
+ */
+bool
+SedResultStore::hasColumn(const std::string& key) const
+{
+  return find(key) != NULL;
+}
+
+
+/*
+ * Returns the number of values in a column.
+ */
+size_t
+SedResultStore::getLength(const std::string& key) const
+{
+  const Column* column = find(key);
+  return column != NULL ? column->length : 0;
+}
+
+
+/*
+ * Returns the number of chunks of a column.
+ */
+unsigned int
+SedResultStore::getNumChunks(const std::string& key) const
+{
+  const Column* column = find(key);
+  return column != NULL ? static_cast<unsigned int>(column->chunks.size())
+                        : 0;
+}
+
+
+/*
+ * Returns the values of one chunk of a column.
+ */
+const double*
+SedResultStore::getChunk(const std::string& key, unsigned int n,
+                         size_t& length) const
+{
+  const Column* column = find(key);
+  if (column == NULL || n >= column->chunks.size())
+  {
+    length = 0;
+    return NULL;
+  }
+
+  column->lastUse = ++mClock;
+  length = column->chunks[n].length;
+  return column->chunks[n].data;
+}
+
+
+/*
+ * Returns the values of a column as one array, merging its chunks.
+ */
+const double*
+SedResultStore::getColumn(const std::string& key)
+{
+  ColumnMap::iterator it = mColumns.find(key);
+  if (it == mColumns.end() || it->second.length == 0)
+  {
+    return NULL;
+  }
+
+  Column& column = it->second;
+  column.lastUse = ++mClock;
+
+  if (column.chunks.size() > 1)
+  {
+    double* data = allocateColumn(column.length);
+    if (data == NULL)
+    {
+      return NULL;
+    }
+
+    size_t offset = 0;
+    for (size_t i = 0; i < column.chunks.size(); ++i)
+    {
+      const Chunk& chunk = column.chunks[i];
+      memcpy(data + offset, chunk.data, chunk.length * sizeof(double));
+      offset += chunk.length;
+    }
+
+    releaseChunks(column);
+    Chunk merged = { data, column.length, column.length, NULL };
+    column.chunks.push_back(merged);
+    mBytes += column.length * sizeof(double);
+    enforceBudget(&column);
+  }
+
+  return column.chunks[0].data;
+}
+
+
+/*
+ * Removes a column.
+ */
+int
+SedResultStore::removeColumn(const std::string& key)
+{
+  ColumnMap::iterator it = mColumns.find(key);
+  if (it == mColumns.end())
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  releaseChunks(it->second);
+  mColumns.erase(it);
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Returns the number of columns.
+ */
+unsigned int
+SedResultStore::getNumColumns() const
+{
+  return static_cast<unsigned int>(mColumns.size());
+}
+
+
+/*
+ * Returns the keys of all columns.
+ */
+std::vector<std::string>
+SedResultStore::getKeys() const
+{
+  vector<string> keys;
+  for (ColumnMap::const_iterator it = mColumns.begin();
+       it != mColumns.end(); ++it)
+  {
+    keys.push_back(it->first);
+  }
+
+  return keys;
+}
+
+
+/*
+ * Removes all columns.
+ */
+void
+SedResultStore::clear()
+{
+  for (ColumnMap::iterator it = mColumns.begin(); it != mColumns.end(); ++it)
+  {
+    releaseChunks(it->second);
+  }
+
+  mColumns.clear();
+}
+
+
+/*
+ * Moves the columns of another store to the end of those of this one.
+ * Chunks change owner; none is copied.
+ */
+int
+SedResultStore::moveColumns(SedResultStore& source)
+{
+  if (&source == this)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  for (ColumnMap::iterator it = source.mColumns.begin();
+       it != source.mColumns.end(); ++it)
+  {
+    Column& column = mColumns[it->first];
+    column.lastUse = ++mClock;
+
+    const vector<Chunk>& chunks = it->second.chunks;
+    for (size_t i = 0; i < chunks.size(); ++i)
+    {
+      column.chunks.push_back(chunks[i]);
+      column.length += chunks[i].length;
+      if (chunks[i].file != NULL)
+      {
+        mSpilledBytes += chunks[i].length * sizeof(double);
+      }
+      else
+      {
+        mBytes += chunks[i].capacity * sizeof(double);
+      }
+    }
+  }
+
+  source.mColumns.clear();
+  source.mBytes = 0;
+  source.mSpilledBytes = 0;
+
+  enforceBudget(NULL);
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Computes a data generator, first merging the columns that its math
+ * reduces over, so that later computations read them in place as well.
+ */
+int
+SedResultStore::evaluate(const SedDataGenerator* dataGenerator,
+                         std::vector<double>& result)
+{
+  const SedCompiledMath* program =
+    dataGenerator != NULL ? dataGenerator->getCompiledMath() : NULL;
+
+  if (program != NULL && program->isCompiled() && program->hasReductions())
+  {
+    vector<string> keys;
+    vector<const Column*> columns;
+    size_t length = 0;
+    const int status =
+      findInputs(dataGenerator, program, keys, columns, length);
+    if (status != LIBSEDML_OPERATION_SUCCESS)
+    {
+      return status;
+    }
+
+    // merge all columns before reading any, as merging one may spill
+    // another, which leaves that in one chunk as well
+    for (size_t i = 0; length != 0 && i < columns.size(); ++i)
+    {
+      if (columns[i] != NULL && getColumn(keys[i]) == NULL)
+      {
+        return LIBSEDML_OPERATION_FAILED;
+      }
+    }
+  }
+
+  const SedResultStore& self = *this;
+  return self.evaluate(dataGenerator, result);
+}
+
+
+/*
+ * Computes a data generator without changing the columns.  Unless its math
+ * has reductions, it is evaluated over the stretches in which no column
+ * changes chunks, reading the chunks in place.
+ */
+int
+SedResultStore::evaluate(const SedDataGenerator* dataGenerator,
+                         std::vector<double>& result) const
+{
+  if (dataGenerator == NULL)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  const SedCompiledMath* program = dataGenerator->getCompiledMath();
+  if (program == NULL || !program->isCompiled())
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  vector<string> keys;
+  vector<const Column*> columns;
+  size_t length = 0;
+  const int status =
+    findInputs(dataGenerator, program, keys, columns, length);
+  if (status != LIBSEDML_OPERATION_SUCCESS)
+  {
+    return status;
+  }
+
+  const unsigned int numInputs = program->getNumInputs();
+  result.assign(length, numeric_limits<double>::quiet_NaN());
+  vector<const double*> inputs(numInputs, NULL);
+
+  if (length == 0)
+  {
+    return LIBSEDML_OPERATION_SUCCESS;
+  }
+
+  if (program->hasReductions())
+  {
+    // columns of several chunks are copied rather than merged, which
+    // would change the store under other readers
+    vector< vector<double> > copies(numInputs);
+
+    for (unsigned int i = 0; i < numInputs; ++i)
+    {
+      if (columns[i] == NULL)
+      {
+        continue;
+      }
+
+      const vector<Chunk>& chunks = columns[i]->chunks;
+      columns[i]->lastUse = ++mClock;
+
+      if (chunks.size() == 1)
+      {
+        inputs[i] = chunks[0].data;
+        continue;
+      }
+
+      copies[i].reserve(length);
+      for (size_t k = 0; k < chunks.size(); ++k)
+      {
+        copies[i].insert(copies[i].end(), chunks[k].data,
+                         chunks[k].data + chunks[k].length);
+      }
+      inputs[i] = copies[i].data();
+    }
+
+    return program->evaluate(inputs.data(), length, result.data());
+  }
+
+  vector<size_t> chunk(numInputs, 0);
+  vector<size_t> offset(numInputs, 0);
+
+  for (size_t done = 0; done < length; )
+  {
+    size_t count = length - done;
+
+    for (unsigned int i = 0; i < numInputs; ++i)
+    {
+      if (columns[i] == NULL)
+      {
+        continue;
+      }
+
+      while (offset[i] == columns[i]->chunks[chunk[i]].length)
+      {
+        ++chunk[i];
+        offset[i] = 0;
+      }
+
+      const Chunk& current = columns[i]->chunks[chunk[i]];
+      count = min(count, current.length - offset[i]);
+      inputs[i] = current.data + offset[i];
+      columns[i]->lastUse = ++mClock;
+    }
+
+    const int status = program->evaluate(inputs.data(), count,
+                                         result.data() + done);
+    if (status != LIBSEDML_OPERATION_SUCCESS)
+    {
+      return status;
+    }
+
+    for (unsigned int i = 0; i < numInputs; ++i)
+    {
+      offset[i] += count;
+    }
+
+    done += count;
+  }
+
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Sets the memory budget for the columns, spilling at once if needed.
+ */
+void
+SedResultStore::setMaxBytes(size_t maxBytes)
+{
+  mMaxBytes = maxBytes;
+  enforceBudget(NULL);
+}
+
+
+/*
+ * Returns the memory budget for the columns.
+ */
+size_t
+SedResultStore::getMaxBytes() const
+{
+  return mMaxBytes;
+}
+
+
+/*
+ * Sets the directory that columns are spilled to.
+ */
+void
+SedResultStore::setSpillDirectory(const std::string& directory)
+{
+  mSpillDirectory = directory;
+}
+
+
+/*
+ * Returns the directory that columns are spilled to.
+ */
+const std::string&
+SedResultStore::getSpillDirectory() const
+{
+  return mSpillDirectory;
+}
+
+
+/*
+ * Returns the number of bytes held in memory.
+ */
+size_t
+SedResultStore::getBytes() const
+{
+  return mBytes;
+}
+
+
+/*
+ * Returns the number of bytes spilled to disk.
+ */
+size_t
+SedResultStore::getSpilledBytes() const
+{
+  return mSpilledBytes;
+}
+
+
+/*
+ * Predicate returning true if a column has been spilled.
+ */
+bool
+SedResultStore::isSpilled(const std::string& key) const
+{
+  const Column* column = find(key);
+  if (column == NULL)
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < column->chunks.size(); ++i)
+  {
+    if (column->chunks[i].file != NULL)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns the column with the given key, or NULL.
+ */
+const SedResultStore::Column*
+SedResultStore::find(const std::string& key) const
+{
+  ColumnMap::const_iterator it = mColumns.find(key);
+  return it != mColumns.end() ? &it->second : NULL;
+}
+
+
+/*
+ * Looks up the columns of the variables that the math of a data generator
+ * uses, and the length they share: 1 if it uses none.
+ */
+int
+SedResultStore::findInputs(const SedDataGenerator* dataGenerator,
+                           const SedCompiledMath* program,
+                           std::vector<std::string>& keys,
+                           std::vector<const Column*>& columns,
+                           size_t& length) const
+{
+  const unsigned int numInputs = program->getNumInputs();
+  keys.assign(numInputs, "");
+  columns.assign(numInputs, NULL);
+  length = 1;
+  bool haveLength = false;
+
+  for (unsigned int i = 0; i < numInputs; ++i)
+  {
+    if (!program->usesInput(i))
+    {
+      continue;
+    }
+
+    // identifiers that are not variables have no column
+    if (i >= dataGenerator->getNumVariables())
+    {
+      return LIBSEDML_INVALID_OBJECT;
+    }
+
+    keys[i] = getKey(dataGenerator->getVariable(i));
+    columns[i] = find(keys[i]);
+    if (columns[i] == NULL ||
+        (haveLength && columns[i]->length != length))
+    {
+      return LIBSEDML_INVALID_OBJECT;
+    }
+
+    length = columns[i]->length;
+    haveLength = true;
+  }
+
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Adds a chunk of length values, with room for capacity, to a column and
+ * spills other columns if this exceeds the budget.
+ */
+double*
+SedResultStore::addChunk(Column& column, size_t length, size_t capacity)
+{
+  double* data = allocateColumn(capacity);
+  if (data == NULL)
+  {
+    return NULL;
+  }
+
+  Chunk chunk = { data, length, capacity, NULL };
+  column.chunks.push_back(chunk);
+  column.length += length;
+  mBytes += capacity * sizeof(double);
+
+  enforceBudget(&column);
+  return data;
+}
+
+
+/*
+ * Frees the chunks of a column.
+ */
+void
+SedResultStore::releaseChunks(Column& column)
+{
+  for (size_t i = 0; i < column.chunks.size(); ++i)
+  {
+    Chunk& chunk = column.chunks[i];
+    if (chunk.file != NULL)
+    {
+      mSpilledBytes -= chunk.length * sizeof(double);
+      delete chunk.file;
+    }
+    else
+    {
+      mBytes -= chunk.capacity * sizeof(double);
+      freeColumn(chunk.data);
+    }
+  }
+
+  column.chunks.clear();
+}
+
+
+/*
+ * Writes the runs of chunks of a column held in memory to temporary files,
+ * replacing each by a mapping of its file.  Returns false if nothing could
+ * be spilled.
+ */
+bool
+SedResultStore::spill(Column& column)
+{
+  bool spilled = false;
+
+  for (size_t first = 0; first < column.chunks.size(); ++first)
+  {
+    if (column.chunks[first].file != NULL)
+    {
+      continue;
+    }
+
+    size_t last = first;
+    while (last < column.chunks.size() && column.chunks[last].file == NULL)
+    {
+      ++last;
+    }
+
+    if (!spillChunks(column, first, last))
+    {
+      break;
+    }
+
+    spilled = true;
+  }
+
+  return spilled;
+}
+
+
+/*
+ * Writes the chunks [first, last) of a column, all held in memory, to a
+ * temporary file and replaces them by a mapping of the file.  Returns
+ * false, leaving the column as it is, if this fails.
+ */
+bool
+SedResultStore::spillChunks(Column& column, size_t first, size_t last)
+{
+#if defined(_WIN32)
+  (void)column;
+  (void)first;
+  (void)last;
+  return false;
+#else
+  size_t length = 0;
+  for (size_t i = first; i < last; ++i)
+  {
+    length += column.chunks[i].length;
+  }
+
+  if (length == 0)
+  {
+    return false;
+  }
+
+  string directory = mSpillDirectory;
+  if (directory.empty())
+  {
+    const char* temp = getenv("TMPDIR");
+    directory = temp != NULL && *temp != '\0' ? temp : "/tmp";
+  }
+
+  string pattern = directory + "/sedml-column-XXXXXX";
+  vector<char> name(pattern.begin(), pattern.end());
+  name.push_back('\0');
+
+  int fd = mkstemp(name.data());
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  bool written = true;
+  for (size_t i = first; written && i < last; ++i)
+  {
+    const char* data = reinterpret_cast<const char*>(column.chunks[i].data);
+    size_t remaining = column.chunks[i].length * sizeof(double);
+
+    while (remaining > 0)
+    {
+      const ssize_t count = write(fd, data, remaining);
+      if (count < 0 && errno == EINTR)
+      {
+        continue;
+      }
+      if (count <= 0)
+      {
+        written = false;
+        break;
+      }
+      data += count;
+      remaining -= static_cast<size_t>(count);
+    }
+  }
+
+  close(fd);
+
+  // the mapping keeps the data of the file after its name is removed
+  SedMappedFile* file = written ? new SedMappedFile(name.data()) : NULL;
+  unlink(name.data());
+
+  if (file == NULL || file->getData() == NULL ||
+      file->getSize() != length * sizeof(double))
+  {
+    delete file;
+    return false;
+  }
+
+  for (size_t i = first; i < last; ++i)
+  {
+    mBytes -= column.chunks[i].capacity * sizeof(double);
+    freeColumn(column.chunks[i].data);
+  }
+
+  // mapped read-only and page aligned; the store never writes to it
+  double* data = reinterpret_cast<double*>(
+    const_cast<char*>(file->getData()));
+  Chunk chunk = { data, length, length, file };
+  column.chunks[first] = chunk;
+  column.chunks.erase(column.chunks.begin() + first + 1,
+                      column.chunks.begin() + last);
+  mSpilledBytes += length * sizeof(double);
+
+  return true;
+#endif
+}
+
+
+/*
+ * Predicate returning true if some chunk of a column is held in memory.
+ */
+bool
+SedResultStore::isInMemory(const Column& column)
+{
+  for (size_t i = 0; i < column.chunks.size(); ++i)
+  {
+    if (column.chunks[i].file == NULL)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * Spills the least recently used columns, other than keep, until the
+ * columns held in memory fit the budget.
+ */
+void
+SedResultStore::enforceBudget(const Column* keep)
+{
+  while (mMaxBytes != 0 && mBytes > mMaxBytes)
+  {
+    Column* coldest = NULL;
+
+    for (ColumnMap::iterator it = mColumns.begin(); it != mColumns.end();
+         ++it)
+    {
+      Column& column = it->second;
+      if (&column != keep && isInMemory(column) &&
+          (coldest == NULL || column.lastUse < coldest->lastUse))
+      {
+        coldest = &column;
+      }
+    }
+
+    if (coldest == NULL || !spill(*coldest))
+    {
+      return;
+    }
+  }
+}
+
+/** @endcond */
+
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
@@ -0,0 +1,447 @@
+/**
+ * @file SedResultStore.h
+ * @brief Definition of the SedResultStore class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedResultStore
+ * @sbmlbrief{} Columns of simulation results, one per task variable.
+ *
+ * A SedResultStore holds the values that simulations produce for the
+ * Variable objects of a document: the time series that DataGenerator
+ * objects are computed from.  Each column is identified by a key built
+ * from what a Variable refers to (see getKey()): its task or model
+ * reference, target or symbol, and the dimensions it applies, so that
+ * variables that mean the same thing share a column.
+ *
+ * A column is a list of chunks, each a contiguous array of doubles aligned
+ * to 64 bytes.  appendChunk() hands out a new chunk for a simulator to
+ * write into, so that the iterations of a SedRepeatedTask whose
+ * concatenate attribute is @c true are added to a column without copying
+ * what is already there; getColumn() merges the chunks of a column into
+ * one array when a contiguous one is needed.  evaluate() computes a
+ * SedDataGenerator directly from the chunks unless its math reduces a
+ * variable over all elements.
+ *
+ * Once the columns take more memory than the budget set with
+ * setMaxBytes(), the least recently used ones are written to temporary
+ * files and mapped back into memory read-only, leaving it to the
+ * operating system to page them in and out.  Spilled columns are read as
+ * before; the files are deleted as soon as they are mapped.  On platforms
+ * without memory mapping, columns stay in memory.
+ *
+ * Pointers returned by a SedResultStore stay valid until the next call of
+ * one of its non-const methods.  The const methods never merge or spill
+ * columns, so several threads may call them at once, for instance to
+ * compute different data generators, as long as no non-const method is
+ * called at the same time.
+ */
+
+
+#ifndef SedResultStore_h
+#define SedResultStore_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedCompiledMath;
+class SedDataGenerator;
+class SedMappedFile;
+class SedVariable;
+
+
+class LIBSEDML_EXTERN SedResultStore
+{
+public:
+
+  /**
+   * Creates a new, empty SedResultStore.
+   *
+   * @param maxBytes the memory budget for the columns, in bytes, beyond
+   * which columns are spilled to disk; @c 0, the default, means no limit.
+   */
+  SedResultStore(size_t maxBytes = 0);
+
+
+  /**
+   * Destroys this SedResultStore and all its columns.
+   */
+  ~SedResultStore();
+
+
+  /**
+   * Returns the key of the column holding the values of a Variable.
+   *
+   * @param variable the SedVariable.
+   *
+   * @return the key, or an empty string if @p variable is @c NULL.
+   */
+  static std::string getKey(const SedVariable* variable);
+
+
+  /**
+   * Returns the key of the column holding the values of a target or
+   * symbol in the results of a task.
+   *
+   * @param taskReference the identifier of the task.
+   * @param target the target, an XPath expression into the model.
+   * @param symbol the symbol, such as the URN of time.
+   *
+   * @return the key, the same as that of a Variable with these attributes
+   * and no others.
+   */
+  static std::string getKey(const std::string& taskReference,
+                            const std::string& target,
+                            const std::string& symbol = "");
+
+
+  /**
+   * Appends a copy of @p length values to a column, creating it if needed.
+   *
+   * @param key the key of the column.
+   * @param values the values to append.
+   * @param length the number of values.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_ATTRIBUTE_VALUE, OperationReturnValues_t}
+   * if @p key is empty, or @p values is @c NULL while @p length is not
+   * @c 0.
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * if memory for the values could not be allocated.
+   */
+  int append(const std::string& key, const double* values, size_t length);
+
+
+  /**
+   * Appends a chunk of @p length values to a column, creating the column if
+   * needed, and returns it for the caller to fill in.
+   *
+   * The chunk has to be filled before any other non-const method of this
+   * store is called, including appendChunk() itself: any of them may
+   * spill the column to disk or merge its chunks, which frees the array
+   * and keeps whatever it held at that point.  To produce several columns
+   * at once, fill one chunk at a time or write the values with append().
+   *
+   * @param key the key of the column.
+   * @param length the number of values.
+   *
+   * @return an array of @p length doubles aligned to 64 bytes and
+   * initialized to NaN, valid until the next call of a non-const method,
+   * or @c NULL if @p key is empty, @p length is @c 0 or the memory could
+   * not be allocated.
+   */
+  double* appendChunk(const std::string& key, size_t length);
+
+
+  /**
+   * Predicate returning @c true if there is a column with the given key.
+   *
+   * @param key the key of the column.
+   *
+   * @return @c true if the column exists, @c false otherwise.
+   */
+  bool hasColumn(const std::string& key) const;
+
+
+  /**
+   * Returns the number of values in a column.
+   *
+   * @param key the key of the column.
+   *
+   * @return the length of the column, or @c 0 if there is none.
+   */
+  size_t getLength(const std::string& key) const;
+
+
+  /**
+   * Returns the number of chunks a column consists of.
+   *
+   * @param key the key of the column.
+   *
+   * @return the number of chunks, or @c 0 if there is no such column.
+   */
+  unsigned int getNumChunks(const std::string& key) const;
+
+
+  /**
+   * Returns the values of one chunk of a column, without copying.
+   *
+   * @param key the key of the column.
+   * @param n an unsigned int representing the index of the chunk.
+   * @param length set to the number of values in the chunk.
+   *
+   * @return the values, or @c NULL (and @p length @c 0) if there is no
+   * such chunk.
+   */
+  const double* getChunk(const std::string& key, unsigned int n,
+                         size_t& length) const;
+
+
+  /**
+   * Returns the values of a column as one contiguous array, merging its
+   * chunks first if there are several.
+   *
+   * @param key the key of the column.
+   *
+   * @return the getLength() values of the column, or @c NULL if there is
+   * no such column, it is empty, or merging it failed.
+   */
+  const double* getColumn(const std::string& key);
+
+
+  /**
+   * Removes a column.
+   *
+   * @param key the key of the column.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if there is no such column.
+   */
+  int removeColumn(const std::string& key);
+
+
+  /**
+   * Returns the number of columns.
+   *
+   * @return the number of columns.
+   */
+  unsigned int getNumColumns() const;
+
+
+  /**
+   * Returns the keys of all columns, in lexicographical order.
+   *
+   * @return the keys.
+   */
+  std::vector<std::string> getKeys() const;
+
+
+  /**
+   * Removes all columns.
+   */
+  void clear();
+
+
+  /**
+   * Moves all columns of another SedResultStore into this one, appending
+   * their chunks to the columns with the same keys.  The chunks change
+   * owner without being copied, which lets simulations running in
+   * parallel fill stores of their own before their results are combined.
+   *
+   * @param source the SedResultStore to empty.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p source is this store.
+   */
+  int moveColumns(SedResultStore& source);
+
+
+  /**
+   * Computes a SedDataGenerator from the columns of its Variable children.
+   * The columns are read in place; they are only merged if the math of the
+   * data generator reduces a variable over all elements.
+   *
+   * @param dataGenerator the SedDataGenerator to compute.
+   * @param result set to the values of the data generator, one for each
+   * value of its variables, or a single value if it has none.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p dataGenerator is @c NULL or its math cannot be compiled, a
+   * variable its math uses has no column, or the columns it uses differ
+   * in length.
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * if the columns had to be merged and memory could not be allocated.
+   */
+  int evaluate(const SedDataGenerator* dataGenerator,
+               std::vector<double>& result);
+
+
+  /**
+   * Computes a SedDataGenerator from the columns of its Variable children
+   * without changing the columns, so that it may be called from several
+   * threads at once.  If the math of the data generator reduces a variable
+   * over all elements and its column consists of several chunks, they are
+   * copied into one array for this computation instead of being merged.
+   *
+   * @param dataGenerator the SedDataGenerator to compute.
+   * @param result set to the values of the data generator, one for each
+   * value of its variables, or a single value if it has none.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p dataGenerator is @c NULL or its math cannot be compiled, a
+   * variable its math uses has no column, or the columns it uses differ
+   * in length.
+   */
+  int evaluate(const SedDataGenerator* dataGenerator,
+               std::vector<double>& result) const;
+
+
+  /**
+   * Sets the memory budget for the columns.  Columns are spilled to disk,
+   * least recently used first, when appending to a column or merging one
+   * takes the columns held in memory beyond the budget.
+   *
+   * @param maxBytes the budget in bytes; @c 0 means no limit.
+   */
+  void setMaxBytes(size_t maxBytes);
+
+
+  /**
+   * Returns the memory budget for the columns.
+   *
+   * @return the budget in bytes, or @c 0 if there is no limit.
+   */
+  size_t getMaxBytes() const;
+
+
+  /**
+   * Sets the directory that columns are spilled to.
+   *
+   * @param directory the directory; an empty string selects the directory
+   * named by the environment variable @c TMPDIR, or @c /tmp.
+   */
+  void setSpillDirectory(const std::string& directory);
+
+
+  /**
+   * Returns the directory that columns are spilled to.
+   *
+   * @return the directory set with setSpillDirectory().
+   */
+  const std::string& getSpillDirectory() const;
+
+
+  /**
+   * Returns the number of bytes the columns take in memory, not counting
+   * those spilled to disk.
+   *
+   * @return the number of bytes held in memory.
+   */
+  size_t getBytes() const;
+
+
+  /**
+   * Returns the number of bytes of the columns spilled to disk.
+   *
+   * @return the number of bytes spilled.
+   */
+  size_t getSpilledBytes() const;
+
+
+  /**
+   * Predicate returning @c true if a column is held on disk, entirely or
+   * in part: chunks appended after a column has been spilled are held in
+   * memory until it is spilled again.
+   *
+   * @param key the key of the column.
+   *
+   * @return @c true if the column has been spilled, @c false otherwise.
+   */
+  bool isSpilled(const std::string& key) const;
+
+
+private:
+  /** @cond doxygenLibSEDMLInternal */
+
+  // a chunk is either allocated by the store or part of a spilled file
+  struct Chunk
+  {
+    double* data;
+    size_t length;
+    size_t capacity;
+    SedMappedFile* file;
+  };
+
+  struct Column
+  {
+    std::vector<Chunk> chunks;
+    size_t length;
+    mutable std::atomic<unsigned long> lastUse;
+
+    Column() : chunks(), length(0), lastUse(0) {}
+  };
+
+  typedef std::map<std::string, Column> ColumnMap;
+
+  SedResultStore(const SedResultStore&);
+  SedResultStore& operator=(const SedResultStore&);
+
+  const Column* find(const std::string& key) const;
+  int findInputs(const SedDataGenerator* dataGenerator,
+                 const SedCompiledMath* program,
+                 std::vector<std::string>& keys,
+                 std::vector<const Column*>& columns,
+                 size_t& length) const;
+  double* addChunk(Column& column, size_t length, size_t capacity);
+  void releaseChunks(Column& column);
+  bool spill(Column& column);
+  bool spillChunks(Column& column, size_t first, size_t last);
+  static bool isInMemory(const Column& column);
+  void enforceBudget(const Column* keep);
+
+  ColumnMap mColumns;
+  size_t mBytes;
+  size_t mSpilledBytes;
+  size_t mMaxBytes;
+  std::string mSpillDirectory;
+  mutable std::atomic<unsigned long> mClock;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedResultStore_h */
@@ -0,0 +1,377 @@
+/**
+ * @file SedScheduler.cpp
+ * @brief Implementation of the SedScheduler class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedScheduler.h>
+#include <sedml/SedDataGenerator.h>
+#include <sedml/SedExecutionPlan.h>
+#include <sedml/SedIterationPlan.h>
+#include <sedml/SedModel.h>
+#include <sedml/SedOutput.h>
+#include <sedml/SedRepeatedTask.h>
+#include <sedml/SedResultStore.h>
+#include <sedml/SedSimulator.h>
+#include <sedml/common/SedOperationReturnValues.h>
+#include <sedml/common/SedThreadPool.h>
+
+#include <thread>
+
+
+using namespace std;
+
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Creates a new SedScheduler.
+ */
+SedScheduler::SedScheduler(unsigned int numThreads)
+  : mNumThreads (numThreads)
+  , mPlan (NULL)
+  , mSimulator (NULL)
+  , mResults (NULL)
+  , mPool (NULL)
+  , mResultsMutex ()
+  , mResultsIdle ()
+  , mNumReaders (0)
+  , mRemaining ()
+  , mBlocked ()
+  , mStatus ()
+  , mValues ()
+  , mDataGenerators ()
+{
+}
+
+
+/*
+ * Destructor for SedScheduler.
+ */
+SedScheduler::~SedScheduler()
+{
+}
+
+
+/*
+ * Sets the number of nodes to run at once.
+ */
+void
+SedScheduler::setNumThreads(unsigned int numThreads)
+{
+  mNumThreads = numThreads;
+}
+
+
+/*
+ * Returns the number of nodes run at once.
+ */
+unsigned int
+SedScheduler::getNumThreads() const
+{
+  if (mNumThreads > 0)
+  {
+    return mNumThreads;
+  }
+
+  const unsigned int hardware = thread::hardware_concurrency();
+  return hardware > 0 ? hardware : 1;
+}
+
+
+/*
+ * Executes a plan.
+ */
+int
+SedScheduler::run(const SedExecutionPlan& plan, SedSimulator& simulator,
+                  SedResultStore& results)
+{
+  const unsigned int count = plan.getNumNodes();
+
+  mPlan = &plan;
+  mSimulator = &simulator;
+  mResults = &results;
+  mRemaining.reset(new atomic<unsigned int>[count]);
+  mBlocked.reset(new atomic<bool>[count]);
+  mStatus.assign(count, LIBSEDML_OPERATION_FAILED);
+  mValues.assign(count, vector<double>());
+  mDataGenerators.clear();
+
+  for (unsigned int n = 0; n < count; ++n)
+  {
+    mRemaining[n] = plan.getNumDependencies(n);
+    mBlocked[n] = false;
+
+    const SedBase* element = plan.getNode(n);
+    if (element->getTypeCode() == SEDML_DATAGENERATOR)
+    {
+      mDataGenerators[element->getId()] = n;
+    }
+  }
+
+  {
+    SedThreadPool pool(getNumThreads());
+    mPool = &pool;
+
+    for (unsigned int n = 0; n < count; ++n)
+    {
+      if (plan.getNumDependencies(n) == 0)
+      {
+        pool.submit([this, n]() { execute(n); });
+      }
+    }
+
+    pool.wait();
+    mPool = NULL;
+  }
+
+  for (unsigned int n = 0; n < count; ++n)
+  {
+    if (mStatus[n] != LIBSEDML_OPERATION_SUCCESS)
+    {
+      return LIBSEDML_OPERATION_FAILED;
+    }
+  }
+
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Returns the SedExecutionPlan executed by the last call of run().
+ */
+const SedExecutionPlan*
+SedScheduler::getExecutionPlan() const
+{
+  return mPlan;
+}
+
+
+/*
+ * Returns the outcome of the nth node of the plan.
+ */
+int
+SedScheduler::getNodeStatus(unsigned int n) const
+{
+  return n < mStatus.size() ? mStatus[n] : LIBSEDML_INVALID_OBJECT;
+}
+
+
+/*
+ * Returns the values computed for a DataGenerator.
+ */
+const vector<double>*
+SedScheduler::getDataGeneratorValues(const string& id) const
+{
+  unordered_map<string, unsigned int>::const_iterator it =
+    mDataGenerators.find(id);
+  if (it == mDataGenerators.end() ||
+      mStatus[it->second] != LIBSEDML_OPERATION_SUCCESS)
+  {
+    return NULL;
+  }
+
+  return &mValues[it->second];
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Runs the nth node, or skips it if a dependency failed, and submits the
+ * dependents that are then ready.
+ */
+void
+SedScheduler::execute(unsigned int n)
+{
+  int status = LIBSEDML_INVALID_OBJECT;
+  if (!mBlocked[n])
+  {
+    try
+    {
+      status = runNode(n);
+    }
+    catch (...)
+    {
+      status = LIBSEDML_OPERATION_FAILED;
+    }
+  }
+
+  mStatus[n] = status;
+
+  for (unsigned int k = 0; k < mPlan->getNumDependents(n); ++k)
+  {
+    const unsigned int next =
+      static_cast<unsigned int>(mPlan->getDependent(n, k));
+
+    // set before the count drops, so that it is seen by whichever node
+    // completes the dependencies last
+    if (status != LIBSEDML_OPERATION_SUCCESS)
+    {
+      mBlocked[next] = true;
+    }
+
+    if (--mRemaining[next] == 0)
+    {
+      mPool->submit([this, next]() { execute(next); });
+    }
+  }
+}
+
+
+/*
+ * Runs the nth node.
+ */
+int
+SedScheduler::runNode(unsigned int n)
+{
+  const SedBase* element = mPlan->getNode(n);
+  const vector<const SedVariable*>& variables = mPlan->getVariables(n);
+
+  switch (element->getTypeCode())
+  {
+  case SEDML_MODEL:
+    return mSimulator->loadModel(static_cast<const SedModel*>(element));
+
+  case SEDML_TASK:
+  case SEDML_TASK_PARAMETER_ESTIMATION:
+  {
+    SedResultStore results;
+    int status = mSimulator->runTask(
+      static_cast<const SedAbstractTask*>(element), variables, results,
+      NULL);
+    if (status != LIBSEDML_OPERATION_SUCCESS)
+    {
+      return status;
+    }
+
+    return moveResults(results);
+  }
+
+  case SEDML_TASK_REPEATEDTASK:
+  {
+    SedIterationPlan iterations;
+    int status =
+      iterations.build(static_cast<const SedRepeatedTask*>(element));
+    if (status != LIBSEDML_OPERATION_SUCCESS)
+    {
+      return status;
+    }
+
+    SedResultStore results;
+    SedIterationCursor cursor(&iterations);
+    while (cursor.next())
+    {
+      status = mSimulator->runTask(cursor.getTask(), variables, results,
+                                   &cursor);
+      if (status != LIBSEDML_OPERATION_SUCCESS)
+      {
+        return status;
+      }
+    }
+
+    return moveResults(results);
+  }
+
+  case SEDML_DATAGENERATOR:
+  {
+    {
+      lock_guard<mutex> lock(mResultsMutex);
+      ++mNumReaders;
+    }
+
+    // the const overload leaves the store as it is, so other data
+    // generators can be computed at the same time
+    const SedResultStore& results = *mResults;
+    vector<double> values;
+    int status = LIBSEDML_OPERATION_FAILED;
+    try
+    {
+      status = results.evaluate(
+        static_cast<const SedDataGenerator*>(element), values);
+    }
+    catch (...)
+    {
+    }
+
+    {
+      lock_guard<mutex> lock(mResultsMutex);
+      if (--mNumReaders == 0)
+      {
+        mResultsIdle.notify_all();
+      }
+    }
+
+    mValues[n].swap(values);
+    return status;
+  }
+
+  default:
+    break;
+  }
+
+  const SedOutput* output = dynamic_cast<const SedOutput*>(element);
+  if (output == NULL)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  return mSimulator->writeOutput(output, *this);
+}
+
+
+/*
+ * Moves the columns of the store of a task into the one passed to run(),
+ * once no data generator is reading that.
+ */
+int
+SedScheduler::moveResults(SedResultStore& results)
+{
+  unique_lock<mutex> lock(mResultsMutex);
+  mResultsIdle.wait(lock, [this]() { return mNumReaders == 0; });
+  return mResults->moveColumns(results);
+}
+
+/** @endcond */
+
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
@@ -0,0 +1,223 @@
+/**
+ * @file SedScheduler.h
+ * @brief Definition of the SedScheduler class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedScheduler
+ * @sbmlbrief{} Executes a SedExecutionPlan on a pool of threads.
+ *
+ * A SedScheduler runs the nodes of a SedExecutionPlan as soon as the nodes
+ * they depend on have completed, handing them to a work-stealing pool of
+ * threads so that independent tasks, data generators and outputs run in
+ * parallel.  Models are loaded, tasks run and outputs produced by a
+ * SedSimulator:
+ *
+ * @li a Model is passed to SedSimulator::loadModel();
+ * @li a Task or ParameterEstimationTask is passed to
+ * SedSimulator::runTask() once;
+ * @li a RepeatedTask is expanded with a SedIterationPlan, and each task it
+ * runs is passed to SedSimulator::runTask() in turn, with the position of
+ * the SedIterationCursor;
+ * @li a DataGenerator is computed from the results with
+ * SedResultStore::evaluate();
+ * @li an Output is passed to SedSimulator::writeOutput().
+ *
+ * Each task writes its results to a SedResultStore of its own, whose
+ * columns are moved into the one passed to run() when it completes.  Data
+ * generators read that store through its const methods, several at a
+ * time; a task that completes meanwhile waits for them before moving its
+ * columns in.
+ *
+ * When a node fails, the nodes that depend on it are skipped; the others
+ * still run.
+ */
+
+
+#ifndef SedScheduler_h
+#define SedScheduler_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedExecutionPlan;
+class SedResultStore;
+class SedSimulator;
+class SedThreadPool;
+
+
+class LIBSEDML_EXTERN SedScheduler
+{
+public:
+
+  /**
+   * Creates a new SedScheduler.
+   *
+   * @param numThreads the number of nodes to run at once, or @c 0, the
+   * default, for as many as the hardware runs concurrently.
+   */
+  SedScheduler(unsigned int numThreads = 0);
+
+
+  /**
+   * Destructor for SedScheduler.
+   */
+  virtual ~SedScheduler();
+
+
+  /**
+   * Sets the number of nodes to run at once.
+   *
+   * @param numThreads the number of worker threads, or @c 0 for as many
+   * as the hardware runs concurrently.
+   */
+  void setNumThreads(unsigned int numThreads);
+
+
+  /**
+   * Returns the number of nodes run at once.
+   *
+   * @return the number of worker threads.
+   */
+  unsigned int getNumThreads() const;
+
+
+  /**
+   * Executes a plan, returning once every node has completed or been
+   * skipped.
+   *
+   * @param plan the SedExecutionPlan to execute.
+   * @param simulator the SedSimulator to load models, run tasks and
+   * produce outputs with.
+   * @param results the SedResultStore receiving the results of the tasks;
+   * columns it already holds are appended to.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * if a node failed or was skipped; see getNodeStatus().
+   */
+  int run(const SedExecutionPlan& plan, SedSimulator& simulator,
+          SedResultStore& results);
+
+
+  /**
+   * Returns the SedExecutionPlan executed by the last call of run().
+   *
+   * @return the SedExecutionPlan, or @c NULL if run() has not been called.
+   */
+  const SedExecutionPlan* getExecutionPlan() const;
+
+
+  /**
+   * Returns the outcome of the nth node of the plan in the last call of
+   * run().
+   *
+   * @param n an unsigned int representing the index of the node.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if the node was skipped because a node it depends on failed, or
+   * @p n is out of range.
+   * @li any other value returned by the SedSimulator, the
+   * SedIterationPlan or the SedResultStore for the node.
+   */
+  int getNodeStatus(unsigned int n) const;
+
+
+  /**
+   * Returns the values computed for a DataGenerator in the last call of
+   * run().  May be called by SedSimulator::writeOutput() for the data
+   * generators of the Output being written.
+   *
+   * @param id the identifier of the SedDataGenerator.
+   *
+   * @return the values, or @c NULL if there is no such data generator or
+   * it has not been computed.
+   */
+  const std::vector<double>* getDataGeneratorValues(
+    const std::string& id) const;
+
+
+private:
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  SedScheduler(const SedScheduler&);
+  SedScheduler& operator=(const SedScheduler&);
+
+  void execute(unsigned int n);
+
+  int runNode(unsigned int n);
+
+  int moveResults(SedResultStore& results);
+
+  unsigned int mNumThreads;
+
+  // the state of the current, or last, call of run()
+  const SedExecutionPlan* mPlan;
+  SedSimulator* mSimulator;
+  SedResultStore* mResults;
+  SedThreadPool* mPool;
+  std::mutex mResultsMutex;
+  std::condition_variable mResultsIdle;
+  unsigned int mNumReaders;
+  std::unique_ptr<std::atomic<unsigned int>[]> mRemaining;
+  std::unique_ptr<std::atomic<bool>[]> mBlocked;
+  std::vector<int> mStatus;
+  std::vector<std::vector<double> > mValues;
+  std::unordered_map<std::string, unsigned int> mDataGenerators;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedScheduler_h */
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedSetValue.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfSetValues.h>
 #include <sbml/xml/XMLInputStream.h>
 #include <sbml/math/MathML.h>
@@ -63,7 +64,6 @@ SedSetValue::SedSetValue(unsigned int level, unsigned int version)
   , mVariables (level, version)
   , mParameters (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -71,7 +71,7 @@ SedSetValue::SedSetValue(unsigned int level, unsigned int version)
 /*
  * Creates a new SedSetValue using the given SedNamespaces object @p sedmlns.
  */
-SedSetValue::SedSetValue(SedNamespaces *sedmlns)
+SedSetValue::SedSetValue(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mModelReference ("")
   , mSymbol ("")
@@ -108,6 +108,25 @@ SedSetValue::SedSetValue(const SedSetValue& orig)
 }
 
 
+/*
+ * Move constructor for SedSetValue.
+ */
+SedSetValue::SedSetValue(SedSetValue&& orig)
+  : SedBase( std::move(orig) )
+  , mModelReference ( std::move(orig.mModelReference) )
+  , mSymbol ( std::move(orig.mSymbol) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mRange ( std::move(orig.mRange) )
+  , mMath ( orig.mMath )
+  , mVariables ( std::move(orig.mVariables) )
+  , mParameters ( std::move(orig.mParameters) )
+{
+  orig.mMath = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedSetValue.
  */
@@ -124,6 +143,7 @@ SedSetValue::operator=(const SedSetValue& rhs)
     mVariables = rhs.mVariables;
     mParameters = rhs.mParameters;
     delete mMath;
+    mCompiledMath.clear();
     if (rhs.mMath != NULL)
     {
       mMath = rhs.mMath->deepCopy();
@@ -140,6 +160,33 @@ SedSetValue::operator=(const SedSetValue& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedSetValue.
+ */
+SedSetValue&
+SedSetValue::operator=(SedSetValue&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mModelReference = std::move(rhs.mModelReference);
+    mSymbol = std::move(rhs.mSymbol);
+    mTarget = std::move(rhs.mTarget);
+    mRange = std::move(rhs.mRange);
+    mVariables = std::move(rhs.mVariables);
+    mParameters = std::move(rhs.mParameters);
+    delete mMath;
+    mCompiledMath.clear();
+    mMath = rhs.mMath;
+    rhs.mMath = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSetValue object.
  */
@@ -391,6 +438,7 @@ SedSetValue::getMath() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedSetValue::getMath()
 {
+  mCompiledMath.exposeMath();
   return mMath;
 }
 
@@ -405,6 +453,30 @@ SedSetValue::isSetMath() const
 }
 
 
+/*
+ * Returns the math of this SedSetValue compiled for evaluation over arrays.
+ */
+const SedCompiledMath*
+SedSetValue::getCompiledMath() const
+{
+  return mCompiledMath.get(this);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Discards the compiled math of this SedSetValue.
+ */
+void
+SedSetValue::clearCompiledMath()
+{
+  mCompiledMath.clear();
+}
+
+/** @endcond */
+
+
 /*
  * Sets the value of the "math" element of this SedSetValue.
  */
@@ -418,6 +490,7 @@ SedSetValue::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
   else if (math == NULL)
   {
     delete mMath;
+    mCompiledMath.clear();
     mMath = NULL;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -428,6 +501,7 @@ SedSetValue::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
   else
   {
     delete mMath;
+    mCompiledMath.clear();
     mMath = (math != NULL) ? math->deepCopy() : NULL;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -441,6 +515,7 @@ int
 SedSetValue::unsetMath()
 {
   delete mMath;
+  mCompiledMath.clear();
   mMath = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -588,6 +663,50 @@ SedSetValue::addVariable(const SedVariable* sv)
 }
 
 
+/*
+ * Adds the given SedVariable to this SedSetValue, which takes ownership of it.
+ */
+int
+SedSetValue::addVariable(std::unique_ptr<SedVariable> sv)
+{
+  if (!sv)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sv->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sv.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sv->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sv->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sv->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sv.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sv->isSetId() && (mVariables.get(sv->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mVariables.appendAndOwn(std::move(sv));
+  }
+}
+
+
 /*
  * Get the number of SedVariable objects in this SedSetValue.
  */
@@ -609,7 +728,7 @@ SedSetValue::createVariable()
 
   try
   {
-    sv = new SedVariable(getSedNamespaces());
+    sv = new (getSedArena()) SedVariable(getSedNamespaces());
   }
   catch (...)
   {
@@ -744,6 +863,51 @@ SedSetValue::addParameter(const SedParameter* sp)
 }
 
 
+/*
+ * Adds the given SedParameter to this SedSetValue,
+ * which takes ownership of it.
+ */
+int
+SedSetValue::addParameter(std::unique_ptr<SedParameter> sp)
+{
+  if (!sp)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sp->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sp.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sp->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sp->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sp->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sp.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else if (sp->isSetId() && (mParameters.get(sp->getId())) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+  else
+  {
+    return mParameters.appendAndOwn(std::move(sp));
+  }
+}
+
+
 /*
  * Get the number of SedParameter objects in this SedSetValue.
  */
@@ -765,7 +929,7 @@ SedSetValue::createParameter()
 
   try
   {
-    sp = new SedParameter(getSedNamespaces());
+    sp = new (getSedArena()) SedParameter(getSedNamespaces());
   }
   catch (...)
   {
@@ -821,9 +985,111 @@ SedSetValue::renameSIdRefs(const std::string& oldid, const std::string& newid)
   if (isSetMath())
   {
     mMath->renameSIdRefs(oldid, newid);
+    mCompiledMath.clear();
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedSetValue object to @p refs.
+ */
+void
+SedSetValue::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetModelReference())
+  {
+    refs.push_back(std::make_pair(std::string("modelReference"),
+      mModelReference));
+  }
+
+  if (isSetRange())
+  {
+    refs.push_back(std::make_pair(std::string("range"), mRange));
+  }
+
+  if (isSetMath())
+  {
+    collectMathSIdRefs(mMath, refs);
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedSetValue object to @p usage.
+ */
+void
+SedSetValue::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedSetValue) - sizeof(SedBase) -
+    sizeof(SedListOfVariables) -
+    sizeof(SedListOfParameters));
+  usage.addString(type, mModelReference);
+  usage.addString(type, mSymbol);
+  usage.addString(type, mTarget);
+  usage.addString(type, mRange);
+  usage.addMath(type, mMath);
+
+  if (mVariables.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mVariables.addMemoryUsage(usage);
+  }
+
+  if (mParameters.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mParameters.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedSetValue object to @p stream.
+ */
+void
+SedSetValue::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mModelReference);
+  stream.writeString(mSymbol);
+  stream.writeString(mTarget);
+  stream.writeString(mRange);
+  stream.writeMath(mMath);
+  mVariables.writeBinary(stream);
+  mParameters.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedSetValue object from @p stream.
+ */
+void
+SedSetValue::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mModelReference);
+  stream.readString(mSymbol);
+  stream.readString(mTarget);
+  stream.readString(mRange);
+
+  delete mMath;
+  mCompiledMath.clear();
+  mMath = stream.readMath();
+
+  mVariables.readBinary(stream);
+  mParameters.readBinary(stream);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedSetValue object.
@@ -1538,7 +1804,9 @@ SedSetValue::readAttributes(
   // modelReference SIdRef (use = "required" )
   // 
 
-  assigned = attributes.readInto("modelReference", mModelReference);
+  std::string modelReference;
+  assigned = attributes.readInto("modelReference", modelReference);
+  mModelReference = modelReference;
 
   if (assigned == true)
   {
@@ -1555,8 +1823,8 @@ SedSetValue::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mModelReference + "', which does not conform to the "
-        "syntax.";
+      msg += " is '" + mModelReference.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlSetValueModelReferenceMustBeModel, level, version, msg,
         getLine(), getColumn());
     }
@@ -1590,7 +1858,9 @@ SedSetValue::readAttributes(
   // target string (use = "optional" )
   // 
 
-  assigned = attributes.readInto("target", mTarget);
+  std::string target;
+  assigned = attributes.readInto("target", target);
+  mTarget = target;
 
   if (assigned == true)
   {
@@ -1649,6 +1919,7 @@ SedSetValue::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
     const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken elem = stream.peek();
     const std::string prefix = checkMathMLNamespace(elem);
     delete mMath;
+    mCompiledMath.clear();
     mMath = readMathML(stream, prefix);
     read = true;
   }
@@ -52,8 +52,10 @@
 
 #include <sedml/SedBase.h>
 #include <sbml/math/ASTNode.h>
+#include <sedml/SedCompiledMath.h>
 #include <sedml/SedListOfVariables.h>
 #include <sedml/SedListOfParameters.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -66,11 +68,12 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  std::string mModelReference;
+  SedInternedString mModelReference;
   std::string mSymbol;
-  std::string mTarget;
+  SedInternedString mTarget;
   std::string mRange;
   LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* mMath;
+  SedCompiledMathCache mCompiledMath;
   SedListOfVariables mVariables;
   SedListOfParameters mParameters;
 
@@ -101,7 +104,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedSetValue(SedNamespaces *sedmlns);
+  SedSetValue(const SedNamespaces *sedmlns);
 
 
   /**
@@ -121,6 +124,28 @@ public:
   SedSetValue& operator=(const SedSetValue& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedSetValue.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedSetValue instance to move from.
+   */
+  SedSetValue(SedSetValue&& orig);
+
+
+  /**
+   * Move assignment operator for SedSetValue.
+   *
+   * @param rhs the SedSetValue object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedSetValue& operator=(SedSetValue&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSetValue object.
    *
@@ -333,6 +358,26 @@ public:
   bool isSetMath() const;
 
 
+#ifndef SWIG
+  /**
+   * Returns the math of this SedSetValue compiled for evaluation over
+   * arrays, with its Variable children bound to the first inputs and its
+   * Parameter children folded in.
+   *
+   * The program is built on first use and kept until the math, the
+   * variables or the parameters change.  Once the non-const getMath() has
+   * been called, edits made to the math in place are noticed as well, at
+   * the cost of hashing the math on each call.  The program may be used
+   * from several threads at once.
+   *
+   * @return the SedCompiledMath of this SedSetValue; use
+   * SedCompiledMath::isCompiled() to check that the math could be
+   * compiled.
+   */
+  const SedCompiledMath* getCompiledMath() const;
+#endif
+
+
   /**
    * Sets the value of the "math" element of this SedSetValue.
    *
@@ -563,6 +608,28 @@ public:
   int addVariable(const SedVariable* sv);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedVariable to this SedSetValue without copying it.
+   *
+   * @param sv the SedVariable object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addVariable(const SedVariable* sv)
+   */
+  int addVariable(std::unique_ptr<SedVariable> sv);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedVariable objects in this SedSetValue.
    *
@@ -787,6 +854,28 @@ public:
   int addParameter(const SedParameter* sp);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedParameter to this SedSetValue without copying it.
+   *
+   * @param sp the SedParameter object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addParameter(const SedParameter* sp)
+   */
+  int addParameter(std::unique_ptr<SedParameter> sp);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedParameter objects in this SedSetValue.
    *
@@ -870,6 +959,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedSetValue object.
    *
@@ -1277,6 +1394,17 @@ public:
 
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Discards the compiled math of this SedSetValue.
+   */
+  virtual void clearCompiledMath();
+
+  /** @endcond */
+
+
+
 
   #endif /* !SWIG */
 
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedShadedArea.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -56,14 +57,13 @@ SedShadedArea::SedShadedArea(unsigned int level, unsigned int version)
   , mYDataReferenceFrom ("")
   , mYDataReferenceTo ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedShadedArea using the given SedNamespaces object @p sedmlns.
  */
-SedShadedArea::SedShadedArea(SedNamespaces *sedmlns)
+SedShadedArea::SedShadedArea(const SedNamespaces *sedmlns)
   : SedAbstractCurve(sedmlns)
   , mYDataReferenceFrom ("")
   , mYDataReferenceTo ("")
@@ -83,6 +83,17 @@ SedShadedArea::SedShadedArea(const SedShadedArea& orig)
 }
 
 
+/*
+ * Move constructor for SedShadedArea.
+ */
+SedShadedArea::SedShadedArea(SedShadedArea&& orig)
+  : SedAbstractCurve( std::move(orig) )
+  , mYDataReferenceFrom ( std::move(orig.mYDataReferenceFrom) )
+  , mYDataReferenceTo ( std::move(orig.mYDataReferenceTo) )
+{
+}
+
+
 /*
  * Assignment operator for SedShadedArea.
  */
@@ -100,6 +111,23 @@ SedShadedArea::operator=(const SedShadedArea& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedShadedArea.
+ */
+SedShadedArea&
+SedShadedArea::operator=(SedShadedArea&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedAbstractCurve::operator=(std::move(rhs));
+    mYDataReferenceFrom = std::move(rhs.mYDataReferenceFrom);
+    mYDataReferenceTo = std::move(rhs.mYDataReferenceTo);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedShadedArea object.
  */
@@ -254,6 +282,75 @@ SedShadedArea::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedShadedArea object to @p refs.
+ */
+void
+SedShadedArea::collectSIdRefs(SedIdRefList& refs) const
+{
+  SedAbstractCurve::collectSIdRefs(refs);
+
+  if (isSetYDataReferenceFrom())
+  {
+    refs.push_back(std::make_pair(std::string("yDataReferenceFrom"),
+      mYDataReferenceFrom));
+  }
+
+  if (isSetYDataReferenceTo())
+  {
+    refs.push_back(std::make_pair(std::string("yDataReferenceTo"),
+      mYDataReferenceTo));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedShadedArea object to @p usage.
+ */
+void
+SedShadedArea::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedAbstractCurve::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedShadedArea) - sizeof(SedAbstractCurve));
+  usage.addString(type, mYDataReferenceFrom);
+  usage.addString(type, mYDataReferenceTo);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedShadedArea object to @p stream.
+ */
+void
+SedShadedArea::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedAbstractCurve::writeBinary(stream);
+
+  stream.writeString(mYDataReferenceFrom);
+  stream.writeString(mYDataReferenceTo);
+}
+
+
+/*
+ * Reads the attributes and children of this SedShadedArea object from @p
+ * stream.
+ */
+void
+SedShadedArea::readBinary(SedBinaryInputStream& stream)
+{
+  SedAbstractCurve::readBinary(stream);
+
+  stream.readString(mYDataReferenceFrom);
+  stream.readString(mYDataReferenceTo);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedShadedArea object.
@@ -94,7 +94,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedShadedArea(SedNamespaces *sedmlns);
+  SedShadedArea(const SedNamespaces *sedmlns);
 
 
   /**
@@ -114,6 +114,28 @@ public:
   SedShadedArea& operator=(const SedShadedArea& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedShadedArea.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedShadedArea instance to move from.
+   */
+  SedShadedArea(SedShadedArea&& orig);
+
+
+  /**
+   * Move assignment operator for SedShadedArea.
+   *
+   * @param rhs the SedShadedArea object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedShadedArea& operator=(SedShadedArea&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedShadedArea object.
    *
@@ -226,6 +248,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedShadedArea object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedSimulation.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfSimulations.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -62,7 +63,6 @@ SedSimulation::SedSimulation(unsigned int level, unsigned int version)
   , mAlgorithm (NULL)
   , mElementName("simulation")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -72,7 +72,7 @@ SedSimulation::SedSimulation(unsigned int level, unsigned int version)
 /*
  * Creates a new SedSimulation using the given SedNamespaces object @p sedmlns.
  */
-SedSimulation::SedSimulation(SedNamespaces *sedmlns)
+SedSimulation::SedSimulation(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mAlgorithm (NULL)
   , mElementName("simulation")
@@ -101,6 +101,20 @@ SedSimulation::SedSimulation(const SedSimulation& orig)
 }
 
 
+/*
+ * Move constructor for SedSimulation.
+ */
+SedSimulation::SedSimulation(SedSimulation&& orig)
+  : SedBase( std::move(orig) )
+  , mAlgorithm ( orig.mAlgorithm )
+  , mElementName ( std::move(orig.mElementName) )
+{
+  orig.mAlgorithm = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedSimulation.
  */
@@ -128,6 +142,27 @@ SedSimulation::operator=(const SedSimulation& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedSimulation.
+ */
+SedSimulation&
+SedSimulation::operator=(SedSimulation&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+    delete mAlgorithm;
+    mAlgorithm = rhs.mAlgorithm;
+    rhs.mAlgorithm = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSimulation object.
  */
@@ -221,7 +256,7 @@ SedSimulation::createAlgorithm()
     delete mAlgorithm;
   }
 
-  mAlgorithm = new SedAlgorithm(getSedNamespaces());
+  mAlgorithm = new (getSedArena()) SedAlgorithm(getSedNamespaces());
 
   connectToChild();
 
@@ -285,6 +320,52 @@ SedSimulation::isSedAnalysis() const
 }
 
 
+/*
+ * Adds the memory held by this SedSimulation object to @p usage.
+ */
+void
+SedSimulation::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedSimulation) - sizeof(SedBase));
+  usage.addString(type, mElementName);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedSimulation object to @p stream.
+ */
+void
+SedSimulation::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeObject(mAlgorithm);
+  stream.writeString(mElementName);
+}
+
+
+/*
+ * Reads the attributes and children of this SedSimulation object from @p
+ * stream.
+ */
+void
+SedSimulation::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readObject(mAlgorithm, this);
+  stream.readString(mElementName);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedSimulation object.
  */
@@ -834,7 +915,7 @@ SedSimulation::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
     }
 
     delete mAlgorithm;
-    mAlgorithm = new SedAlgorithm(getSedNamespaces());
+    mAlgorithm = new (getSedArena()) SedAlgorithm(getSedNamespaces());
     obj = mAlgorithm;
   }
 
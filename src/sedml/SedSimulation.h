@@ -100,7 +100,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedSimulation(SedNamespaces *sedmlns);
+  SedSimulation(const SedNamespaces *sedmlns);
 
 
   /**
@@ -120,6 +120,28 @@ public:
   SedSimulation& operator=(const SedSimulation& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedSimulation.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedSimulation instance to move from.
+   */
+  SedSimulation(SedSimulation&& orig);
+
+
+  /**
+   * Move assignment operator for SedSimulation.
+   *
+   * @param rhs the SedSimulation object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedSimulation& operator=(SedSimulation&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSimulation object.
    *
@@ -234,6 +256,28 @@ public:
   virtual bool isSedAnalysis() const;
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedSimulation object.
    *
@@ -0,0 +1,150 @@
+/**
+ * @file SedSimulator.h
+ * @brief Definition of the SedSimulator class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedSimulator
+ * @sbmlbrief{} Interface between SedScheduler and a simulation engine.
+ *
+ * A SedScheduler executes a SedDocument by calling a SedSimulator: once for
+ * every Model before the tasks using it, once for every task, or for every
+ * task a SedRepeatedTask runs, and once for every Output after the data
+ * generators it shows have been computed.  An implementation wraps a
+ * simulation engine, such as an SBML simulator; SedStubSimulator is one
+ * that produces made-up results without simulating anything.
+ *
+ * The methods of a SedSimulator are called from the worker threads of the
+ * scheduler, several at once for objects that do not depend on each other,
+ * so they have to be thread-safe.  Each call of runTask() is given a
+ * SedResultStore of its own, which the scheduler merges into its results
+ * afterwards.
+ */
+
+
+#ifndef SedSimulator_h
+#define SedSimulator_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <vector>
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedAbstractTask;
+class SedIterationCursor;
+class SedModel;
+class SedOutput;
+class SedResultStore;
+class SedScheduler;
+class SedVariable;
+
+
+class LIBSEDML_EXTERN SedSimulator
+{
+public:
+
+  /**
+   * Destructor for SedSimulator.
+   */
+  virtual ~SedSimulator();
+
+
+  /**
+   * Prepares a Model for the tasks that use it, for instance by reading
+   * its source and applying its changes.  The default implementation does
+   * nothing.
+   *
+   * @param model the SedModel.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * if the model cannot be loaded; the tasks using it are then skipped.
+   */
+  virtual int loadModel(const SedModel* model);
+
+
+  /**
+   * Runs a task and records the values of the given variables, each in the
+   * column keyed by SedResultStore::getKey(const SedVariable*).
+   *
+   * @param task the task to run, a SedTask or SedParameterEstimationTask;
+   * never a SedRepeatedTask, whose tasks are passed one at a time.
+   * @param variables the Variable objects of the document that refer to
+   * the task or, within a repeated task, to the repeated task.
+   * @param results the SedResultStore to append the values to; a chunk
+   * obtained from SedResultStore::appendChunk() has to be filled before
+   * the store is called again.
+   * @param iteration the position within the repeated task, giving the
+   * ranges and SetValue objects that apply, or @c NULL if the task is run
+   * on its own.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * if the simulation failed.
+   */
+  virtual int runTask(const SedAbstractTask* task,
+                      const std::vector<const SedVariable*>& variables,
+                      SedResultStore& results,
+                      const SedIterationCursor* iteration) = 0;
+
+
+  /**
+   * Produces an Output from the values of its data generators, which are
+   * available from SedScheduler::getDataGeneratorValues().  The default
+   * implementation does nothing.
+   *
+   * @param output the SedOutput.
+   * @param scheduler the SedScheduler executing the document.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * if the output cannot be produced.
+   */
+  virtual int writeOutput(const SedOutput* output,
+                          const SedScheduler& scheduler);
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedSimulator_h */
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedSlice.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfSlices.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -61,14 +62,13 @@ SedSlice::SedSlice(unsigned int level, unsigned int version)
   , mEndIndex (SEDML_INT_MAX)
   , mIsSetEndIndex (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedSlice using the given SedNamespaces object @p sedmlns.
  */
-SedSlice::SedSlice(SedNamespaces *sedmlns)
+SedSlice::SedSlice(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mReference ("")
   , mValue ("")
@@ -98,6 +98,22 @@ SedSlice::SedSlice(const SedSlice& orig)
 }
 
 
+/*
+ * Move constructor for SedSlice.
+ */
+SedSlice::SedSlice(SedSlice&& orig)
+  : SedBase( std::move(orig) )
+  , mReference ( std::move(orig.mReference) )
+  , mValue ( std::move(orig.mValue) )
+  , mIndex ( std::move(orig.mIndex) )
+  , mStartIndex ( std::move(orig.mStartIndex) )
+  , mIsSetStartIndex ( std::move(orig.mIsSetStartIndex) )
+  , mEndIndex ( std::move(orig.mEndIndex) )
+  , mIsSetEndIndex ( std::move(orig.mIsSetEndIndex) )
+{
+}
+
+
 /*
  * Assignment operator for SedSlice.
  */
@@ -120,6 +136,28 @@ SedSlice::operator=(const SedSlice& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedSlice.
+ */
+SedSlice&
+SedSlice::operator=(SedSlice&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mReference = std::move(rhs.mReference);
+    mValue = std::move(rhs.mValue);
+    mIndex = std::move(rhs.mIndex);
+    mStartIndex = std::move(rhs.mStartIndex);
+    mIsSetStartIndex = std::move(rhs.mIsSetStartIndex);
+    mEndIndex = std::move(rhs.mEndIndex);
+    mIsSetEndIndex = std::move(rhs.mIsSetEndIndex);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSlice object.
  */
@@ -424,6 +462,81 @@ SedSlice::renameSIdRefs(const std::string& oldid, const std::string& newid)
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedSlice object to @p refs.
+ */
+void
+SedSlice::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetReference())
+  {
+    refs.push_back(std::make_pair(std::string("reference"), mReference));
+  }
+
+  if (isSetIndex())
+  {
+    refs.push_back(std::make_pair(std::string("index"), mIndex));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedSlice object to @p usage.
+ */
+void
+SedSlice::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedSlice) - sizeof(SedBase));
+  usage.addString(type, mReference);
+  usage.addString(type, mValue);
+  usage.addString(type, mIndex);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedSlice object to @p stream.
+ */
+void
+SedSlice::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mReference);
+  stream.writeString(mValue);
+  stream.writeString(mIndex);
+  stream.writeInt(mStartIndex);
+  stream.writeBool(mIsSetStartIndex);
+  stream.writeInt(mEndIndex);
+  stream.writeBool(mIsSetEndIndex);
+}
+
+
+/*
+ * Reads the attributes and children of this SedSlice object from @p stream.
+ */
+void
+SedSlice::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mReference);
+  stream.readString(mValue);
+  stream.readString(mIndex);
+  mStartIndex = static_cast<int>(stream.readInt());
+  mIsSetStartIndex = stream.readBool();
+  mEndIndex = static_cast<int>(stream.readInt());
+  mIsSetEndIndex = stream.readBool();
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedSlice object.
@@ -96,7 +96,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedSlice(SedNamespaces *sedmlns);
+  SedSlice(const SedNamespaces *sedmlns);
 
 
   /**
@@ -116,6 +116,28 @@ public:
   SedSlice& operator=(const SedSlice& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedSlice.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedSlice instance to move from.
+   */
+  SedSlice(SedSlice&& orig);
+
+
+  /**
+   * Move assignment operator for SedSlice.
+   *
+   * @param rhs the SedSlice object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedSlice& operator=(SedSlice&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSlice object.
    *
@@ -345,6 +367,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedSlice object.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedSteadyState::SedSteadyState(unsigned int level, unsigned int version)
   : SedSimulation(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -62,7 +61,7 @@ SedSteadyState::SedSteadyState(unsigned int level, unsigned int version)
  * Creates a new SedSteadyState using the given SedNamespaces object @p
  * sedmlns.
  */
-SedSteadyState::SedSteadyState(SedNamespaces *sedmlns)
+SedSteadyState::SedSteadyState(const SedNamespaces *sedmlns)
   : SedSimulation(sedmlns)
 {
   setElementNamespace(sedmlns->getURI());
@@ -78,6 +77,15 @@ SedSteadyState::SedSteadyState(const SedSteadyState& orig)
 }
 
 
+/*
+ * Move constructor for SedSteadyState.
+ */
+SedSteadyState::SedSteadyState(SedSteadyState&& orig)
+  : SedSimulation( std::move(orig) )
+{
+}
+
+
 /*
  * Assignment operator for SedSteadyState.
  */
@@ -93,6 +101,21 @@ SedSteadyState::operator=(const SedSteadyState& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedSteadyState.
+ */
+SedSteadyState&
+SedSteadyState::operator=(SedSteadyState&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedSimulation::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSteadyState object.
  */
@@ -86,7 +86,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedSteadyState(SedNamespaces *sedmlns);
+  SedSteadyState(const SedNamespaces *sedmlns);
 
 
   /**
@@ -106,6 +106,28 @@ public:
   SedSteadyState& operator=(const SedSteadyState& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedSteadyState.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedSteadyState instance to move from.
+   */
+  SedSteadyState(SedSteadyState&& orig);
+
+
+  /**
+   * Move assignment operator for SedSteadyState.
+   *
+   * @param rhs the SedSteadyState object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedSteadyState& operator=(SedSteadyState&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSteadyState object.
    *
@@ -0,0 +1,296 @@
+/**
+ * @file SedStubSimulator.cpp
+ * @brief Implementation of the SedStubSimulator class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+#include <chrono>
+#include <thread>
+
+#include <sedml/SedStubSimulator.h>
+#include <sedml/SedDocument.h>
+#include <sedml/SedIterationPlan.h>
+#include <sedml/SedOneStep.h>
+#include <sedml/SedResultStore.h>
+#include <sedml/SedTask.h>
+#include <sedml/SedUniformTimeCourse.h>
+#include <sedml/SedVariable.h>
+#include <sedml/common/SedOperationReturnValues.h>
+
+/** @cond doxygenIgnored */
+
+using namespace std;
+
+/** @endcond */
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+#ifdef __cplusplus
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns the time points a task yields values at.
+ */
+static vector<double>
+getTimePoints(const SedAbstractTask* task)
+{
+  vector<double> points;
+
+  const SedSimulation* simulation = NULL;
+  const SedDocument* doc = task->getSedDocument();
+  if (doc != NULL && task->getTypeCode() == SEDML_TASK)
+  {
+    simulation = doc->getSimulation(
+      static_cast<const SedTask*>(task)->getSimulationReference());
+  }
+
+  if (simulation != NULL && simulation->isSedUniformTimeCourse())
+  {
+    const SedUniformTimeCourse* utc =
+      static_cast<const SedUniformTimeCourse*>(simulation);
+    const int steps = utc->getNumberOfSteps() > 0
+                      ? utc->getNumberOfSteps() : 0;
+    const double start = utc->getOutputStartTime();
+    const double end = utc->getOutputEndTime();
+
+    for (int i = 0; i <= steps; ++i)
+    {
+      points.push_back(steps == 0 ? start
+                       : start + (end - start) * i / steps);
+    }
+  }
+  else if (simulation != NULL && simulation->isSedOneStep())
+  {
+    points.push_back(0.0);
+    points.push_back(static_cast<const SedOneStep*>(simulation)->getStep());
+  }
+  else
+  {
+    points.push_back(0.0);
+  }
+
+  return points;
+}
+
+/** @endcond */
+
+
+/*
+ * Creates a new SedStubSimulator.
+ */
+SedStubSimulator::SedStubSimulator()
+  : SedSimulator()
+  , mRunTime (0)
+  , mNumRuns (0)
+  , mNumActiveRuns (0)
+  , mMaxConcurrentRuns (0)
+  , mNumModelsLoaded (0)
+  , mNumOutputsWritten (0)
+{
+}
+
+
+/*
+ * Destructor for SedStubSimulator.
+ */
+SedStubSimulator::~SedStubSimulator()
+{
+}
+
+
+/*
+ * Counts the Model as loaded.
+ */
+int
+SedStubSimulator::loadModel(const SedModel* model)
+{
+  if (model == NULL)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  ++mNumModelsLoaded;
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Appends made-up values for the given variables.
+ */
+int
+SedStubSimulator::runTask(const SedAbstractTask* task,
+                          const vector<const SedVariable*>& variables,
+                          SedResultStore& results,
+                          const SedIterationCursor* iteration)
+{
+  if (task == NULL)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  ++mNumRuns;
+  const unsigned int active = ++mNumActiveRuns;
+  unsigned int highest = mMaxConcurrentRuns.load();
+  while (active > highest &&
+         !mMaxConcurrentRuns.compare_exchange_weak(highest, active))
+  {
+  }
+
+  if (mRunTime > 0)
+  {
+    this_thread::sleep_for(chrono::milliseconds(mRunTime.load()));
+  }
+
+  const vector<double> points = getTimePoints(task);
+  const double offset = iteration != NULL ? iteration->getIteration(0) : 0;
+
+  int result = LIBSEDML_OPERATION_SUCCESS;
+  for (size_t i = 0; i < variables.size(); ++i)
+  {
+    const SedVariable* variable = variables[i];
+    if (variable == NULL)
+    {
+      continue;
+    }
+
+    double* values = results.appendChunk(SedResultStore::getKey(variable),
+                                         points.size());
+    if (values == NULL)
+    {
+      result = LIBSEDML_OPERATION_FAILED;
+      break;
+    }
+
+    const double shift = variable->isSetSymbol() ? 0.0 : offset;
+    for (size_t j = 0; j < points.size(); ++j)
+    {
+      values[j] = points[j] + shift;
+    }
+  }
+
+  --mNumActiveRuns;
+  return result;
+}
+
+
+/*
+ * Counts the Output as written.
+ */
+int
+SedStubSimulator::writeOutput(const SedOutput* output, const SedScheduler&)
+{
+  if (output == NULL)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  ++mNumOutputsWritten;
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Sets the time every call of runTask() takes.
+ */
+void
+SedStubSimulator::setRunTime(unsigned int milliseconds)
+{
+  mRunTime = milliseconds;
+}
+
+
+/*
+ * Returns the time every call of runTask() takes.
+ */
+unsigned int
+SedStubSimulator::getRunTime() const
+{
+  return mRunTime;
+}
+
+
+/*
+ * Returns the number of calls of runTask() so far.
+ */
+unsigned int
+SedStubSimulator::getNumRuns() const
+{
+  return mNumRuns;
+}
+
+
+/*
+ * Returns the largest number of concurrent calls of runTask().
+ */
+unsigned int
+SedStubSimulator::getMaxConcurrentRuns() const
+{
+  return mMaxConcurrentRuns;
+}
+
+
+/*
+ * Returns the number of calls of loadModel() so far.
+ */
+unsigned int
+SedStubSimulator::getNumModelsLoaded() const
+{
+  return mNumModelsLoaded;
+}
+
+
+/*
+ * Returns the number of calls of writeOutput() so far.
+ */
+unsigned int
+SedStubSimulator::getNumOutputsWritten() const
+{
+  return mNumOutputsWritten;
+}
+
+
+/*
+ * Resets the counters to 0.
+ */
+void
+SedStubSimulator::resetCounters()
+{
+  mNumRuns = 0;
+  mMaxConcurrentRuns = 0;
+  mNumModelsLoaded = 0;
+  mNumOutputsWritten = 0;
+}
+
+
+#endif  /* __cplusplus */
+
+LIBSEDML_CPP_NAMESPACE_END
@@ -0,0 +1,216 @@
+/**
+ * @file SedStubSimulator.h
+ * @brief Definition of the SedStubSimulator class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedStubSimulator
+ * @sbmlbrief{} SedSimulator producing predictable results without a model.
+ *
+ * A SedStubSimulator stands in for a simulation engine when testing the
+ * execution of documents.  It does not read models; a task yields values
+ * at the time points of its simulation:
+ *
+ * @li for a UniformTimeCourse, numberOfSteps + 1 points evenly spaced from
+ * outputStartTime to outputEndTime;
+ * @li for a OneStep, the points 0 and step;
+ * @li for any other simulation, and for parameter estimation tasks, the
+ * single point 0.
+ *
+ * A Variable with a symbol takes the value @em t at time @em t; one with a
+ * target takes @em t + @em i, where @em i is the iteration of the
+ * outermost repeated task the task runs in, or 0.  Each run appends one
+ * chunk per variable.
+ *
+ * A SedStubSimulator counts the calls it receives, and can be made to
+ * take a fixed time for every task, which lets tests observe how many run
+ * concurrently.
+ */
+
+
+#ifndef SedStubSimulator_h
+#define SedStubSimulator_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+#include <sedml/SedSimulator.h>
+
+
+#ifdef __cplusplus
+
+
+#include <atomic>
+#include <vector>
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+class LIBSEDML_EXTERN SedStubSimulator : public SedSimulator
+{
+public:
+
+  /**
+   * Creates a new SedStubSimulator.
+   */
+  SedStubSimulator();
+
+
+  /**
+   * Destructor for SedStubSimulator.
+   */
+  virtual ~SedStubSimulator();
+
+
+  /**
+   * Counts the Model as loaded.
+   *
+   * @param model the SedModel.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p model is @c NULL.
+   */
+  virtual int loadModel(const SedModel* model);
+
+
+  /**
+   * Appends made-up values for the given variables.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p task is @c NULL.
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * if memory for the values could not be allocated.
+   *
+   * @see SedSimulator::runTask()
+   */
+  virtual int runTask(const SedAbstractTask* task,
+                      const std::vector<const SedVariable*>& variables,
+                      SedResultStore& results,
+                      const SedIterationCursor* iteration);
+
+
+  /**
+   * Counts the Output as written.
+   *
+   * @param output the SedOutput.
+   * @param scheduler the SedScheduler executing the document.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p output is @c NULL.
+   */
+  virtual int writeOutput(const SedOutput* output,
+                          const SedScheduler& scheduler);
+
+
+  /**
+   * Sets the time every call of runTask() takes.
+   *
+   * @param milliseconds the duration of a run; the default is @c 0.
+   */
+  void setRunTime(unsigned int milliseconds);
+
+
+  /**
+   * Returns the time every call of runTask() takes.
+   *
+   * @return the duration of a run in milliseconds.
+   */
+  unsigned int getRunTime() const;
+
+
+  /**
+   * Returns the number of calls of runTask() so far.
+   *
+   * @return the number of runs.
+   */
+  unsigned int getNumRuns() const;
+
+
+  /**
+   * Returns the largest number of calls of runTask() that were in progress
+   * at the same time.
+   *
+   * @return the highest number of concurrent runs.
+   */
+  unsigned int getMaxConcurrentRuns() const;
+
+
+  /**
+   * Returns the number of calls of loadModel() so far.
+   *
+   * @return the number of models loaded.
+   */
+  unsigned int getNumModelsLoaded() const;
+
+
+  /**
+   * Returns the number of calls of writeOutput() so far.
+   *
+   * @return the number of outputs written.
+   */
+  unsigned int getNumOutputsWritten() const;
+
+
+  /**
+   * Resets the counters to @c 0.
+   */
+  void resetCounters();
+
+
+private:
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  SedStubSimulator(const SedStubSimulator&);
+  SedStubSimulator& operator=(const SedStubSimulator&);
+
+  std::atomic<unsigned int> mRunTime;
+  std::atomic<unsigned int> mNumRuns;
+  std::atomic<unsigned int> mNumActiveRuns;
+  std::atomic<unsigned int> mMaxConcurrentRuns;
+  std::atomic<unsigned int> mNumModelsLoaded;
+  std::atomic<unsigned int> mNumOutputsWritten;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedStubSimulator_h */
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedStyle.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfStyles.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -58,7 +59,6 @@ SedStyle::SedStyle(unsigned int level, unsigned int version)
   , mMarkerStyle (NULL)
   , mFillStyle (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -66,7 +66,7 @@ SedStyle::SedStyle(unsigned int level, unsigned int version)
 /*
  * Creates a new SedStyle using the given SedNamespaces object @p sedmlns.
  */
-SedStyle::SedStyle(SedNamespaces *sedmlns)
+SedStyle::SedStyle(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mBaseStyle ("")
   , mLineStyle (NULL)
@@ -107,6 +107,24 @@ SedStyle::SedStyle(const SedStyle& orig)
 }
 
 
+/*
+ * Move constructor for SedStyle.
+ */
+SedStyle::SedStyle(SedStyle&& orig)
+  : SedBase( std::move(orig) )
+  , mBaseStyle ( std::move(orig.mBaseStyle) )
+  , mLineStyle ( orig.mLineStyle )
+  , mMarkerStyle ( orig.mMarkerStyle )
+  , mFillStyle ( orig.mFillStyle )
+{
+  orig.mLineStyle = NULL;
+  orig.mMarkerStyle = NULL;
+  orig.mFillStyle = NULL;
+
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedStyle.
  */
@@ -115,6 +133,7 @@ SedStyle::operator=(const SedStyle& rhs)
 {
   if (&rhs != this)
   {
+    invalidateEffectiveStyles();
     SedBase::operator=(rhs);
     mBaseStyle = rhs.mBaseStyle;
     delete mLineStyle;
@@ -154,6 +173,33 @@ SedStyle::operator=(const SedStyle& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedStyle.
+ */
+SedStyle&
+SedStyle::operator=(SedStyle&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mBaseStyle = std::move(rhs.mBaseStyle);
+    delete mLineStyle;
+    mLineStyle = rhs.mLineStyle;
+    rhs.mLineStyle = NULL;
+    delete mMarkerStyle;
+    mMarkerStyle = rhs.mMarkerStyle;
+    rhs.mMarkerStyle = NULL;
+    delete mFillStyle;
+    mFillStyle = rhs.mFillStyle;
+    rhs.mFillStyle = NULL;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedStyle object.
  */
@@ -169,6 +215,7 @@ SedStyle::clone() const
  */
 SedStyle::~SedStyle()
 {
+  invalidateEffectiveStyles();
   delete mLineStyle;
   mLineStyle = NULL;
   delete mMarkerStyle;
@@ -204,6 +251,8 @@ SedStyle::isSetBaseStyle() const
 int
 SedStyle::setBaseStyle(const std::string& baseStyle)
 {
+  invalidateEffectiveStyles();
+
   if (!(SyntaxChecker::isValidInternalSId(baseStyle)))
   {
     return LIBSEDML_INVALID_ATTRIBUTE_VALUE;
@@ -222,6 +271,8 @@ SedStyle::setBaseStyle(const std::string& baseStyle)
 int
 SedStyle::unsetBaseStyle()
 {
+  invalidateEffectiveStyles();
+
   mBaseStyle.erase();
 
   if (mBaseStyle.empty() == true)
@@ -331,6 +382,8 @@ SedStyle::isSetFillStyle() const
 int
 SedStyle::setLineStyle(const SedLine* lineStyle)
 {
+  invalidateEffectiveStyles();
+
   if (mLineStyle == lineStyle)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -361,6 +414,8 @@ SedStyle::setLineStyle(const SedLine* lineStyle)
 int
 SedStyle::setMarkerStyle(const SedMarker* markerStyle)
 {
+  invalidateEffectiveStyles();
+
   if (mMarkerStyle == markerStyle)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -391,6 +446,8 @@ SedStyle::setMarkerStyle(const SedMarker* markerStyle)
 int
 SedStyle::setFillStyle(const SedFill* fillStyle)
 {
+  invalidateEffectiveStyles();
+
   if (mFillStyle == fillStyle)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -422,12 +479,14 @@ SedStyle::setFillStyle(const SedFill* fillStyle)
 SedLine*
 SedStyle::createLineStyle()
 {
+  invalidateEffectiveStyles();
+
   if (mLineStyle != NULL)
   {
     delete mLineStyle;
   }
 
-  mLineStyle = new SedLine(getSedNamespaces());
+  mLineStyle = new (getSedArena()) SedLine(getSedNamespaces());
 
 
   connectToChild();
@@ -443,12 +502,14 @@ SedStyle::createLineStyle()
 SedMarker*
 SedStyle::createMarkerStyle()
 {
+  invalidateEffectiveStyles();
+
   if (mMarkerStyle != NULL)
   {
     delete mMarkerStyle;
   }
 
-  mMarkerStyle = new SedMarker(getSedNamespaces());
+  mMarkerStyle = new (getSedArena()) SedMarker(getSedNamespaces());
 
 
   connectToChild();
@@ -464,12 +525,14 @@ SedStyle::createMarkerStyle()
 SedFill*
 SedStyle::createFillStyle()
 {
+  invalidateEffectiveStyles();
+
   if (mFillStyle != NULL)
   {
     delete mFillStyle;
   }
 
-  mFillStyle = new SedFill(getSedNamespaces());
+  mFillStyle = new (getSedArena()) SedFill(getSedNamespaces());
 
 
   connectToChild();
@@ -484,6 +547,8 @@ SedStyle::createFillStyle()
 int
 SedStyle::unsetLineStyle()
 {
+  invalidateEffectiveStyles();
+
   delete mLineStyle;
   mLineStyle = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -496,6 +561,8 @@ SedStyle::unsetLineStyle()
 int
 SedStyle::unsetMarkerStyle()
 {
+  invalidateEffectiveStyles();
+
   delete mMarkerStyle;
   mMarkerStyle = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -508,6 +575,8 @@ SedStyle::unsetMarkerStyle()
 int
 SedStyle::unsetFillStyle()
 {
+  invalidateEffectiveStyles();
+
   delete mFillStyle;
   mFillStyle = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -526,6 +595,68 @@ SedStyle::renameSIdRefs(const std::string& oldid, const std::string& newid)
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedStyle object to @p refs.
+ */
+void
+SedStyle::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetBaseStyle())
+  {
+    refs.push_back(std::make_pair(std::string("baseStyle"), mBaseStyle));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedStyle object to @p usage.
+ */
+void
+SedStyle::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedStyle) - sizeof(SedBase));
+  usage.addString(type, mBaseStyle);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedStyle object to @p stream.
+ */
+void
+SedStyle::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mBaseStyle);
+  stream.writeObject(mLineStyle);
+  stream.writeObject(mMarkerStyle);
+  stream.writeObject(mFillStyle);
+}
+
+
+/*
+ * Reads the attributes and children of this SedStyle object from @p stream.
+ */
+void
+SedStyle::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mBaseStyle);
+  stream.readObject(mLineStyle, this);
+  stream.readObject(mMarkerStyle, this);
+  stream.readObject(mFillStyle, this);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedStyle object.
@@ -621,7 +752,10 @@ SedStyle::accept(SedVisitor& v) const
 void
 SedStyle::setSedDocument(SedDocument* d)
 {
+  // both the document losing and the one gaining this style are affected
+  invalidateEffectiveStyles();
   SedBase::setSedDocument(d);
+  invalidateEffectiveStyles();
 
   if (mLineStyle != NULL)
   {
@@ -1184,7 +1318,7 @@ SedStyle::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mLineStyle;
-    mLineStyle = new SedLine(getSedNamespaces());
+    mLineStyle = new (getSedArena()) SedLine(getSedNamespaces());
 
     obj = mLineStyle;
   }
@@ -1197,7 +1331,7 @@ SedStyle::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mMarkerStyle;
-    mMarkerStyle = new SedMarker(getSedNamespaces());
+    mMarkerStyle = new (getSedArena()) SedMarker(getSedNamespaces());
 
     obj = mMarkerStyle;
   }
@@ -1210,7 +1344,7 @@ SedStyle::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mFillStyle;
-    mFillStyle = new SedFill(getSedNamespaces());
+    mFillStyle = new (getSedArena()) SedFill(getSedNamespaces());
 
     obj = mFillStyle;
   }
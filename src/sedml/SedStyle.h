@@ -96,7 +96,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedStyle(SedNamespaces *sedmlns);
+  SedStyle(const SedNamespaces *sedmlns);
 
 
   /**
@@ -116,6 +116,28 @@ public:
   SedStyle& operator=(const SedStyle& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedStyle.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedStyle instance to move from.
+   */
+  SedStyle(SedStyle&& orig);
+
+
+  /**
+   * Move assignment operator for SedStyle.
+   *
+   * @param rhs the SedStyle object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedStyle& operator=(SedStyle&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedStyle object.
    *
@@ -354,6 +376,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedStyle object.
    *
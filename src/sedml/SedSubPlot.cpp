@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedSubPlot.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfSubPlots.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -63,14 +64,13 @@ SedSubPlot::SedSubPlot(unsigned int level, unsigned int version)
   , mColSpan (SEDML_INT_MAX)
   , mIsSetColSpan (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedSubPlot using the given SedNamespaces object @p sedmlns.
  */
-SedSubPlot::SedSubPlot(SedNamespaces *sedmlns)
+SedSubPlot::SedSubPlot(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mPlot ("")
   , mRow (SEDML_INT_MAX)
@@ -104,6 +104,24 @@ SedSubPlot::SedSubPlot(const SedSubPlot& orig)
 }
 
 
+/*
+ * Move constructor for SedSubPlot.
+ */
+SedSubPlot::SedSubPlot(SedSubPlot&& orig)
+  : SedBase( std::move(orig) )
+  , mPlot ( std::move(orig.mPlot) )
+  , mRow ( std::move(orig.mRow) )
+  , mIsSetRow ( std::move(orig.mIsSetRow) )
+  , mCol ( std::move(orig.mCol) )
+  , mIsSetCol ( std::move(orig.mIsSetCol) )
+  , mRowSpan ( std::move(orig.mRowSpan) )
+  , mIsSetRowSpan ( std::move(orig.mIsSetRowSpan) )
+  , mColSpan ( std::move(orig.mColSpan) )
+  , mIsSetColSpan ( std::move(orig.mIsSetColSpan) )
+{
+}
+
+
 /*
  * Assignment operator for SedSubPlot.
  */
@@ -128,6 +146,30 @@ SedSubPlot::operator=(const SedSubPlot& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedSubPlot.
+ */
+SedSubPlot&
+SedSubPlot::operator=(SedSubPlot&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mPlot = std::move(rhs.mPlot);
+    mRow = std::move(rhs.mRow);
+    mIsSetRow = std::move(rhs.mIsSetRow);
+    mCol = std::move(rhs.mCol);
+    mIsSetCol = std::move(rhs.mIsSetCol);
+    mRowSpan = std::move(rhs.mRowSpan);
+    mIsSetRowSpan = std::move(rhs.mIsSetRowSpan);
+    mColSpan = std::move(rhs.mColSpan);
+    mIsSetColSpan = std::move(rhs.mIsSetColSpan);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSubPlot object.
  */
@@ -423,6 +465,78 @@ SedSubPlot::renameSIdRefs(const std::string& oldid, const std::string& newid)
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedSubPlot object to @p refs.
+ */
+void
+SedSubPlot::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetPlot())
+  {
+    refs.push_back(std::make_pair(std::string("plot"), mPlot));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedSubPlot object to @p usage.
+ */
+void
+SedSubPlot::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedSubPlot) - sizeof(SedBase));
+  usage.addString(type, mPlot);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedSubPlot object to @p stream.
+ */
+void
+SedSubPlot::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mPlot);
+  stream.writeInt(mRow);
+  stream.writeBool(mIsSetRow);
+  stream.writeInt(mCol);
+  stream.writeBool(mIsSetCol);
+  stream.writeInt(mRowSpan);
+  stream.writeBool(mIsSetRowSpan);
+  stream.writeInt(mColSpan);
+  stream.writeBool(mIsSetColSpan);
+}
+
+
+/*
+ * Reads the attributes and children of this SedSubPlot object from @p stream.
+ */
+void
+SedSubPlot::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mPlot);
+  mRow = static_cast<int>(stream.readInt());
+  mIsSetRow = stream.readBool();
+  mCol = static_cast<int>(stream.readInt());
+  mIsSetCol = stream.readBool();
+  mRowSpan = static_cast<int>(stream.readInt());
+  mIsSetRowSpan = stream.readBool();
+  mColSpan = static_cast<int>(stream.readInt());
+  mIsSetColSpan = stream.readBool();
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedSubPlot object.
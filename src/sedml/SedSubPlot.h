@@ -100,7 +100,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedSubPlot(SedNamespaces *sedmlns);
+  SedSubPlot(const SedNamespaces *sedmlns);
 
 
   /**
@@ -120,6 +120,28 @@ public:
   SedSubPlot& operator=(const SedSubPlot& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedSubPlot.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedSubPlot instance to move from.
+   */
+  SedSubPlot(SedSubPlot&& orig);
+
+
+  /**
+   * Move assignment operator for SedSubPlot.
+   *
+   * @param rhs the SedSubPlot object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedSubPlot& operator=(SedSubPlot&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSubPlot object.
    *
@@ -345,6 +367,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedSubPlot object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedSubTask.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfSubTasks.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -58,14 +59,13 @@ SedSubTask::SedSubTask(unsigned int level, unsigned int version)
   , mTask ("")
   , mSetValues (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedSubTask using the given SedNamespaces object @p sedmlns.
  */
-SedSubTask::SedSubTask(SedNamespaces *sedmlns)
+SedSubTask::SedSubTask(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mOrder (SEDML_INT_MAX)
   , mIsSetOrder (false)
@@ -89,6 +89,19 @@ SedSubTask::SedSubTask(const SedSubTask& orig)
 }
 
 
+/*
+ * Move constructor for SedSubTask.
+ */
+SedSubTask::SedSubTask(SedSubTask&& orig)
+  : SedBase( std::move(orig) )
+  , mOrder ( std::move(orig.mOrder) )
+  , mIsSetOrder ( std::move(orig.mIsSetOrder) )
+  , mTask ( std::move(orig.mTask) )
+  , mSetValues ( std::move(orig.mSetValues) )
+{
+}
+
+
 /*
  * Assignment operator for SedSubTask.
  */
@@ -108,6 +121,25 @@ SedSubTask::operator=(const SedSubTask& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedSubTask.
+ */
+SedSubTask&
+SedSubTask::operator=(SedSubTask&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mOrder = std::move(rhs.mOrder);
+    mIsSetOrder = std::move(rhs.mIsSetOrder);
+    mTask = std::move(rhs.mTask);
+    mSetValues = std::move(rhs.mSetValues);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSubTask object.
  */
@@ -371,6 +403,54 @@ SedSubTask::addTaskChange(const SedSetValue* ssv)
 }
 
 
+/*
+ * Adds the given SedSetValue to this SedSubTask, which takes ownership of it.
+ */
+int
+SedSubTask::addTaskChange(std::unique_ptr<SedSetValue> ssv)
+{
+    if (!ssv)
+    {
+        return LIBSEDML_OPERATION_FAILED;
+    }
+    else if (ssv->getParentSedObject() != NULL)
+    {
+        // still owned by its parent, which deletes it
+        ssv.release();
+        return LIBSEDML_INVALID_OBJECT;
+    }
+    else if (getLevel() == 1 && getVersion() < 4)
+    {
+        return LIBSEDML_INVALID_OBJECT;
+    }
+    else if (ssv->hasRequiredAttributes() == false)
+    {
+        return LIBSEDML_INVALID_OBJECT;
+    }
+    else if (ssv->hasRequiredElements() == false)
+    {
+        return LIBSEDML_INVALID_OBJECT;
+    }
+    else if (getLevel() != ssv->getLevel())
+    {
+        return LIBSEDML_LEVEL_MISMATCH;
+    }
+    else if (getVersion() != ssv->getVersion())
+    {
+        return LIBSEDML_VERSION_MISMATCH;
+    }
+    else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+        SedBase*>(ssv.get())) == false)
+    {
+        return LIBSEDML_NAMESPACES_MISMATCH;
+    }
+    else
+    {
+        return mSetValues.appendAndOwn(std::move(ssv));
+    }
+}
+
+
 /*
  * Get the number of SedSetValue objects in this SedSubTask.
  */
@@ -397,7 +477,7 @@ SedSubTask::createTaskChange()
 
     try
     {
-        ssv = new SedSetValue(getSedNamespaces());
+        ssv = new (getSedArena()) SedSetValue(getSedNamespaces());
     }
     catch (...)
     {
@@ -435,6 +515,75 @@ SedSubTask::renameSIdRefs(const std::string& oldid, const std::string& newid)
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedSubTask object to @p refs.
+ */
+void
+SedSubTask::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetTask())
+  {
+    refs.push_back(std::make_pair(std::string("task"), mTask));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedSubTask object to @p usage.
+ */
+void
+SedSubTask::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedSubTask) - sizeof(SedBase) -
+    sizeof(SedListOfSetValues));
+  usage.addString(type, mTask);
+
+  if (mSetValues.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mSetValues.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedSubTask object to @p stream.
+ */
+void
+SedSubTask::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeInt(mOrder);
+  stream.writeBool(mIsSetOrder);
+  stream.writeString(mTask);
+  mSetValues.writeBinary(stream);
+}
+
+
+/*
+ * Reads the attributes and children of this SedSubTask object from @p stream.
+ */
+void
+SedSubTask::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  mOrder = static_cast<int>(stream.readInt());
+  mIsSetOrder = stream.readBool();
+  stream.readString(mTask);
+  mSetValues.readBinary(stream);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedSubTask object.
@@ -1103,7 +1252,9 @@ SedSubTask::readAttributes(
   // task SIdRef (use = "required" )
   // 
 
-  assigned = attributes.readInto("task", mTask);
+  std::string task;
+  assigned = attributes.readInto("task", task);
+  mTask = task;
 
   if (assigned == true)
   {
@@ -1119,7 +1270,8 @@ SedSubTask::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mTask + "', which does not conform to the syntax.";
+      msg += " is '" + mTask.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlSubTaskTaskMustBeAbstractTask, level, version, msg,
         getLine(), getColumn());
     }
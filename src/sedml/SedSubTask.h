@@ -52,6 +52,7 @@
 
 #include <sedml/SedBase.h>
 #include <sedml/SedListOfSetValues.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -66,7 +67,7 @@ protected:
 
   int mOrder;
   bool mIsSetOrder;
-  std::string mTask;
+  SedInternedString mTask;
   SedListOfSetValues mSetValues;
 
   /** @endcond */
@@ -96,7 +97,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedSubTask(SedNamespaces *sedmlns);
+  SedSubTask(const SedNamespaces *sedmlns);
 
 
   /**
@@ -116,6 +117,28 @@ public:
   SedSubTask& operator=(const SedSubTask& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedSubTask.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedSubTask instance to move from.
+   */
+  SedSubTask(SedSubTask&& orig);
+
+
+  /**
+   * Move assignment operator for SedSubTask.
+   *
+   * @param rhs the SedSubTask object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedSubTask& operator=(SedSubTask&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSubTask object.
    *
@@ -396,6 +419,28 @@ public:
   int addTaskChange(const SedSetValue* ssv);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedSetValue to this SedSubTask without copying it.
+   *
+   * @param ssv the SedSetValue object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addTaskChange(const SedSetValue* ssv)
+   */
+  int addTaskChange(std::unique_ptr<SedSetValue> ssv);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedSetValue objects in this SedRepeatedTask.
    *
@@ -457,6 +502,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedSubTask object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedSurface.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfSurfaces.h>
 #include <sbml/xml/XMLInputStream.h>
 #include <sedml/SedPlot3D.h>
@@ -68,7 +69,6 @@ SedSurface::SedSurface(unsigned int level, unsigned int version)
   , mOrder (SEDML_INT_MAX)
   , mIsSetOrder (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mNameAllowedPreV4 = true;
   mIdAllowedPreV4 = true;
 }
@@ -77,7 +77,7 @@ SedSurface::SedSurface(unsigned int level, unsigned int version)
 /*
  * Creates a new SedSurface using the given SedNamespaces object @p sedmlns.
  */
-SedSurface::SedSurface(SedNamespaces *sedmlns)
+SedSurface::SedSurface(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mXDataReference ("")
   , mYDataReference ("")
@@ -121,6 +121,28 @@ SedSurface::SedSurface(const SedSurface& orig)
 }
 
 
+/*
+ * Move constructor for SedSurface.
+ */
+SedSurface::SedSurface(SedSurface&& orig)
+  : SedBase( std::move(orig) )
+  , mXDataReference ( std::move(orig.mXDataReference) )
+  , mYDataReference ( std::move(orig.mYDataReference) )
+  , mZDataReference ( std::move(orig.mZDataReference) )
+  , mType ( std::move(orig.mType) )
+  , mStyle ( std::move(orig.mStyle) )
+  , mLogX ( std::move(orig.mLogX) )
+  , mIsSetLogX ( std::move(orig.mIsSetLogX) )
+  , mLogY ( std::move(orig.mLogY) )
+  , mIsSetLogY ( std::move(orig.mIsSetLogY) )
+  , mLogZ ( std::move(orig.mLogZ) )
+  , mIsSetLogZ ( std::move(orig.mIsSetLogZ) )
+  , mOrder ( std::move(orig.mOrder) )
+  , mIsSetOrder ( std::move(orig.mIsSetOrder) )
+{
+}
+
+
 /*
  * Assignment operator for SedSurface.
  */
@@ -149,6 +171,34 @@ SedSurface::operator=(const SedSurface& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedSurface.
+ */
+SedSurface&
+SedSurface::operator=(SedSurface&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mXDataReference = std::move(rhs.mXDataReference);
+    mYDataReference = std::move(rhs.mYDataReference);
+    mZDataReference = std::move(rhs.mZDataReference);
+    mType = std::move(rhs.mType);
+    mStyle = std::move(rhs.mStyle);
+    mLogX = std::move(rhs.mLogX);
+    mIsSetLogX = std::move(rhs.mIsSetLogX);
+    mLogY = std::move(rhs.mLogY);
+    mIsSetLogY = std::move(rhs.mIsSetLogY);
+    mLogZ = std::move(rhs.mLogZ);
+    mIsSetLogZ = std::move(rhs.mIsSetLogZ);
+    mOrder = std::move(rhs.mOrder);
+    mIsSetOrder = std::move(rhs.mIsSetOrder);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSurface object.
  */
@@ -809,6 +859,107 @@ SedSurface::renameSIdRefs(const std::string& oldid, const std::string& newid)
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedSurface object to @p refs.
+ */
+void
+SedSurface::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetXDataReference())
+  {
+    refs.push_back(std::make_pair(std::string("xDataReference"),
+      mXDataReference));
+  }
+
+  if (isSetYDataReference())
+  {
+    refs.push_back(std::make_pair(std::string("yDataReference"),
+      mYDataReference));
+  }
+
+  if (isSetZDataReference())
+  {
+    refs.push_back(std::make_pair(std::string("zDataReference"),
+      mZDataReference));
+  }
+
+  if (isSetStyle())
+  {
+    refs.push_back(std::make_pair(std::string("style"), mStyle));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedSurface object to @p usage.
+ */
+void
+SedSurface::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedSurface) - sizeof(SedBase));
+  usage.addString(type, mXDataReference);
+  usage.addString(type, mYDataReference);
+  usage.addString(type, mZDataReference);
+  usage.addString(type, mStyle);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedSurface object to @p stream.
+ */
+void
+SedSurface::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mXDataReference);
+  stream.writeString(mYDataReference);
+  stream.writeString(mZDataReference);
+  stream.writeInt(mType);
+  stream.writeString(mStyle);
+  stream.writeBool(mLogX);
+  stream.writeBool(mIsSetLogX);
+  stream.writeBool(mLogY);
+  stream.writeBool(mIsSetLogY);
+  stream.writeBool(mLogZ);
+  stream.writeBool(mIsSetLogZ);
+  stream.writeInt(mOrder);
+  stream.writeBool(mIsSetOrder);
+}
+
+
+/*
+ * Reads the attributes and children of this SedSurface object from @p stream.
+ */
+void
+SedSurface::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mXDataReference);
+  stream.readString(mYDataReference);
+  stream.readString(mZDataReference);
+  mType = static_cast<SurfaceType_t>(stream.readInt());
+  stream.readString(mStyle);
+  mLogX = stream.readBool();
+  mIsSetLogX = stream.readBool();
+  mLogY = stream.readBool();
+  mIsSetLogY = stream.readBool();
+  mLogZ = stream.readBool();
+  mIsSetLogZ = stream.readBool();
+  mOrder = static_cast<int>(stream.readInt());
+  mIsSetOrder = stream.readBool();
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedSurface object.
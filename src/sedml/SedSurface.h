@@ -140,7 +140,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedSurface(SedNamespaces *sedmlns);
+  SedSurface(const SedNamespaces *sedmlns);
 
 
   /**
@@ -160,6 +160,28 @@ public:
   SedSurface& operator=(const SedSurface& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedSurface.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedSurface instance to move from.
+   */
+  SedSurface(SedSurface&& orig);
+
+
+  /**
+   * Move assignment operator for SedSurface.
+   *
+   * @param rhs the SedSurface object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedSurface& operator=(SedSurface&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSurface object.
    *
@@ -605,6 +627,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedSurface object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedTask.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -55,14 +56,13 @@ SedTask::SedTask(unsigned int level, unsigned int version)
   , mModelReference ("")
   , mSimulationReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
 /*
  * Creates a new SedTask using the given SedNamespaces object @p sedmlns.
  */
-SedTask::SedTask(SedNamespaces *sedmlns)
+SedTask::SedTask(const SedNamespaces *sedmlns)
   : SedAbstractTask(sedmlns)
   , mModelReference ("")
   , mSimulationReference ("")
@@ -82,6 +82,17 @@ SedTask::SedTask(const SedTask& orig)
 }
 
 
+/*
+ * Move constructor for SedTask.
+ */
+SedTask::SedTask(SedTask&& orig)
+  : SedAbstractTask( std::move(orig) )
+  , mModelReference ( std::move(orig.mModelReference) )
+  , mSimulationReference ( std::move(orig.mSimulationReference) )
+{
+}
+
+
 /*
  * Assignment operator for SedTask.
  */
@@ -99,6 +110,23 @@ SedTask::operator=(const SedTask& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedTask.
+ */
+SedTask&
+SedTask::operator=(SedTask&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedAbstractTask::operator=(std::move(rhs));
+    mModelReference = std::move(rhs.mModelReference);
+    mSimulationReference = std::move(rhs.mSimulationReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedTask object.
  */
@@ -250,6 +278,72 @@ SedTask::renameSIdRefs(const std::string& oldid, const std::string& newid)
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedTask object to @p refs.
+ */
+void
+SedTask::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetModelReference())
+  {
+    refs.push_back(std::make_pair(std::string("modelReference"),
+      mModelReference));
+  }
+
+  if (isSetSimulationReference())
+  {
+    refs.push_back(std::make_pair(std::string("simulationReference"),
+      mSimulationReference));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedTask object to @p usage.
+ */
+void
+SedTask::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedAbstractTask::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedTask) - sizeof(SedAbstractTask));
+  usage.addString(type, mModelReference);
+  usage.addString(type, mSimulationReference);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedTask object to @p stream.
+ */
+void
+SedTask::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedAbstractTask::writeBinary(stream);
+
+  stream.writeString(mModelReference);
+  stream.writeString(mSimulationReference);
+}
+
+
+/*
+ * Reads the attributes and children of this SedTask object from @p stream.
+ */
+void
+SedTask::readBinary(SedBinaryInputStream& stream)
+{
+  SedAbstractTask::readBinary(stream);
+
+  stream.readString(mModelReference);
+  stream.readString(mSimulationReference);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedTask object.
@@ -662,7 +756,9 @@ SedTask::readAttributes(
   // modelReference SIdRef (use = "optional" )
   // 
 
-  assigned = attributes.readInto("modelReference", mModelReference);
+  std::string modelReference;
+  assigned = attributes.readInto("modelReference", modelReference);
+  mModelReference = modelReference;
 
   if (assigned == true)
   {
@@ -679,8 +775,8 @@ SedTask::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mModelReference + "', which does not conform to the "
-        "syntax.";
+      msg += " is '" + mModelReference.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlTaskModelReferenceMustBeModel, level, version, msg,
         getLine(), getColumn());
     }
@@ -690,7 +786,9 @@ SedTask::readAttributes(
   // simulationReference SIdRef (use = "optional" )
   // 
 
-  assigned = attributes.readInto("simulationReference", mSimulationReference);
+  std::string simulationReference;
+  assigned = attributes.readInto("simulationReference", simulationReference);
+  mSimulationReference = simulationReference;
 
   if (assigned == true)
   {
@@ -707,8 +805,8 @@ SedTask::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mSimulationReference + "', which does not conform to the "
-        "syntax.";
+      msg += " is '" + mSimulationReference.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlTaskSimulationReferenceMustBeSimulation, level, version,
         msg, getLine(), getColumn());
     }
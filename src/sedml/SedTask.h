@@ -51,6 +51,7 @@
 
 
 #include <sedml/SedAbstractTask.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -63,8 +64,8 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  std::string mModelReference;
-  std::string mSimulationReference;
+  SedInternedString mModelReference;
+  SedInternedString mSimulationReference;
 
   /** @endcond */
 
@@ -91,7 +92,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedTask(SedNamespaces *sedmlns);
+  SedTask(const SedNamespaces *sedmlns);
 
 
   /**
@@ -111,6 +112,28 @@ public:
   SedTask& operator=(const SedTask& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedTask.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedTask instance to move from.
+   */
+  SedTask(SedTask&& orig);
+
+
+  /**
+   * Move assignment operator for SedTask.
+   *
+   * @param rhs the SedTask object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedTask& operator=(SedTask&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedTask object.
    *
@@ -218,6 +241,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedTask object.
    *
@@ -105,7 +105,21 @@
 #include <sedml/SedParameterEstimationReport.h>
 
 #include <sedml/SedReader.h>
+#include <sedml/SedReaderHandler.h>
 #include <sedml/SedWriter.h>
+#include <sedml/SedBinaryReader.h>
+#include <sedml/SedBinaryWriter.h>
+#include <sedml/SedDocumentCache.h>
+#include <sedml/SedReferenceGraph.h>
+#include <sedml/SedIterationPlan.h>
+#include <sedml/SedCompiledMath.h>
+#include <sedml/SedResultStore.h>
+#include <sedml/SedExecutionPlan.h>
+#include <sedml/SedSimulator.h>
+#include <sedml/SedStubSimulator.h>
+#include <sedml/SedScheduler.h>
+#include <sedml/SedMemoryUsage.h>
+#include <sedml/SedFrozenDocument.h>
 
 #include <sbml/math/FormulaFormatter.h>  
 
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedUniformRange.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -61,7 +62,6 @@ SedUniformRange::SedUniformRange(unsigned int level, unsigned int version)
   , mIsSetNumberOfSteps (false)
   , mType ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -69,7 +69,7 @@ SedUniformRange::SedUniformRange(unsigned int level, unsigned int version)
  * Creates a new SedUniformRange using the given SedNamespaces object @p
  * sedmlns.
  */
-SedUniformRange::SedUniformRange(SedNamespaces *sedmlns)
+SedUniformRange::SedUniformRange(const SedNamespaces *sedmlns)
   : SedRange(sedmlns)
   , mStart (util_NaN())
   , mIsSetStart (false)
@@ -99,6 +99,22 @@ SedUniformRange::SedUniformRange(const SedUniformRange& orig)
 }
 
 
+/*
+ * Move constructor for SedUniformRange.
+ */
+SedUniformRange::SedUniformRange(SedUniformRange&& orig)
+  : SedRange( std::move(orig) )
+  , mStart ( std::move(orig.mStart) )
+  , mIsSetStart ( std::move(orig.mIsSetStart) )
+  , mEnd ( std::move(orig.mEnd) )
+  , mIsSetEnd ( std::move(orig.mIsSetEnd) )
+  , mNumberOfSteps ( std::move(orig.mNumberOfSteps) )
+  , mIsSetNumberOfSteps ( std::move(orig.mIsSetNumberOfSteps) )
+  , mType ( std::move(orig.mType) )
+{
+}
+
+
 /*
  * Assignment operator for SedUniformRange.
  */
@@ -121,6 +137,28 @@ SedUniformRange::operator=(const SedUniformRange& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedUniformRange.
+ */
+SedUniformRange&
+SedUniformRange::operator=(SedUniformRange&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedRange::operator=(std::move(rhs));
+    mStart = std::move(rhs.mStart);
+    mIsSetStart = std::move(rhs.mIsSetStart);
+    mEnd = std::move(rhs.mEnd);
+    mIsSetEnd = std::move(rhs.mIsSetEnd);
+    mNumberOfSteps = std::move(rhs.mNumberOfSteps);
+    mIsSetNumberOfSteps = std::move(rhs.mIsSetNumberOfSteps);
+    mType = std::move(rhs.mType);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedUniformRange object.
  */
@@ -402,6 +440,63 @@ SedUniformRange::unsetType()
 }
 
 
+/*
+ * Adds the memory held by this SedUniformRange object to @p usage.
+ */
+void
+SedUniformRange::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedRange::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedUniformRange) - sizeof(SedRange));
+  usage.addString(type, mType);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedUniformRange object to @p
+ * stream.
+ */
+void
+SedUniformRange::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedRange::writeBinary(stream);
+
+  stream.writeDouble(mStart);
+  stream.writeBool(mIsSetStart);
+  stream.writeDouble(mEnd);
+  stream.writeBool(mIsSetEnd);
+  stream.writeInt(mNumberOfSteps);
+  stream.writeBool(mIsSetNumberOfSteps);
+  stream.writeString(mType);
+}
+
+
+/*
+ * Reads the attributes and children of this SedUniformRange object from @p
+ * stream.
+ */
+void
+SedUniformRange::readBinary(SedBinaryInputStream& stream)
+{
+  SedRange::readBinary(stream);
+
+  mStart = stream.readDouble();
+  mIsSetStart = stream.readBool();
+  mEnd = stream.readDouble();
+  mIsSetEnd = stream.readBool();
+  mNumberOfSteps = static_cast<int>(stream.readInt());
+  mIsSetNumberOfSteps = stream.readBool();
+  stream.readString(mType);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedUniformRange object.
  */
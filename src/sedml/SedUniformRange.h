@@ -99,7 +99,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedUniformRange(SedNamespaces *sedmlns);
+  SedUniformRange(const SedNamespaces *sedmlns);
 
 
   /**
@@ -119,6 +119,28 @@ public:
   SedUniformRange& operator=(const SedUniformRange& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedUniformRange.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedUniformRange instance to move from.
+   */
+  SedUniformRange(SedUniformRange&& orig);
+
+
+  /**
+   * Move assignment operator for SedUniformRange.
+   *
+   * @param rhs the SedUniformRange object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedUniformRange& operator=(SedUniformRange&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedUniformRange object.
    *
@@ -350,6 +372,28 @@ public:
   int unsetType();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedUniformRange object.
    *
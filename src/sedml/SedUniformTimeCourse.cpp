@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedUniformTimeCourse.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -63,7 +64,6 @@ SedUniformTimeCourse::SedUniformTimeCourse(unsigned int level,
   , mNumberOfSteps (SEDML_INT_MAX)
   , mIsSetNumberOfSteps (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -71,7 +71,7 @@ SedUniformTimeCourse::SedUniformTimeCourse(unsigned int level,
  * Creates a new SedUniformTimeCourse using the given SedNamespaces object @p
  * sedmlns.
  */
-SedUniformTimeCourse::SedUniformTimeCourse(SedNamespaces *sedmlns)
+SedUniformTimeCourse::SedUniformTimeCourse(const SedNamespaces *sedmlns)
   : SedSimulation(sedmlns)
   , mInitialTime (util_NaN())
   , mIsSetInitialTime (false)
@@ -103,6 +103,23 @@ SedUniformTimeCourse::SedUniformTimeCourse(const SedUniformTimeCourse& orig)
 }
 
 
+/*
+ * Move constructor for SedUniformTimeCourse.
+ */
+SedUniformTimeCourse::SedUniformTimeCourse(SedUniformTimeCourse&& orig)
+  : SedSimulation( std::move(orig) )
+  , mInitialTime ( std::move(orig.mInitialTime) )
+  , mIsSetInitialTime ( std::move(orig.mIsSetInitialTime) )
+  , mOutputStartTime ( std::move(orig.mOutputStartTime) )
+  , mIsSetOutputStartTime ( std::move(orig.mIsSetOutputStartTime) )
+  , mOutputEndTime ( std::move(orig.mOutputEndTime) )
+  , mIsSetOutputEndTime ( std::move(orig.mIsSetOutputEndTime) )
+  , mNumberOfSteps ( std::move(orig.mNumberOfSteps) )
+  , mIsSetNumberOfSteps ( std::move(orig.mIsSetNumberOfSteps) )
+{
+}
+
+
 /*
  * Assignment operator for SedUniformTimeCourse.
  */
@@ -126,6 +143,29 @@ SedUniformTimeCourse::operator=(const SedUniformTimeCourse& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedUniformTimeCourse.
+ */
+SedUniformTimeCourse&
+SedUniformTimeCourse::operator=(SedUniformTimeCourse&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedSimulation::operator=(std::move(rhs));
+    mInitialTime = std::move(rhs.mInitialTime);
+    mIsSetInitialTime = std::move(rhs.mIsSetInitialTime);
+    mOutputStartTime = std::move(rhs.mOutputStartTime);
+    mIsSetOutputStartTime = std::move(rhs.mIsSetOutputStartTime);
+    mOutputEndTime = std::move(rhs.mOutputEndTime);
+    mIsSetOutputEndTime = std::move(rhs.mIsSetOutputEndTime);
+    mNumberOfSteps = std::move(rhs.mNumberOfSteps);
+    mIsSetNumberOfSteps = std::move(rhs.mIsSetNumberOfSteps);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedUniformTimeCourse object.
  */
@@ -423,6 +463,64 @@ SedUniformTimeCourse::unsetNumberOfSteps()
 }
 
 
+/*
+ * Adds the memory held by this SedUniformTimeCourse object to @p usage.
+ */
+void
+SedUniformTimeCourse::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedSimulation::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedUniformTimeCourse) - sizeof(SedSimulation));
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedUniformTimeCourse object to @p
+ * stream.
+ */
+void
+SedUniformTimeCourse::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedSimulation::writeBinary(stream);
+
+  stream.writeDouble(mInitialTime);
+  stream.writeBool(mIsSetInitialTime);
+  stream.writeDouble(mOutputStartTime);
+  stream.writeBool(mIsSetOutputStartTime);
+  stream.writeDouble(mOutputEndTime);
+  stream.writeBool(mIsSetOutputEndTime);
+  stream.writeInt(mNumberOfSteps);
+  stream.writeBool(mIsSetNumberOfSteps);
+}
+
+
+/*
+ * Reads the attributes and children of this SedUniformTimeCourse object from @p
+ * stream.
+ */
+void
+SedUniformTimeCourse::readBinary(SedBinaryInputStream& stream)
+{
+  SedSimulation::readBinary(stream);
+
+  mInitialTime = stream.readDouble();
+  mIsSetInitialTime = stream.readBool();
+  mOutputStartTime = stream.readDouble();
+  mIsSetOutputStartTime = stream.readBool();
+  mOutputEndTime = stream.readDouble();
+  mIsSetOutputEndTime = stream.readBool();
+  mNumberOfSteps = static_cast<int>(stream.readInt());
+  mIsSetNumberOfSteps = stream.readBool();
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedUniformTimeCourse object.
  */
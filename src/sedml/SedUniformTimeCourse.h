@@ -100,7 +100,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedUniformTimeCourse(SedNamespaces *sedmlns);
+  SedUniformTimeCourse(const SedNamespaces *sedmlns);
 
 
   /**
@@ -120,6 +120,28 @@ public:
   SedUniformTimeCourse& operator=(const SedUniformTimeCourse& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedUniformTimeCourse.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedUniformTimeCourse instance to move from.
+   */
+  SedUniformTimeCourse(SedUniformTimeCourse&& orig);
+
+
+  /**
+   * Move assignment operator for SedUniformTimeCourse.
+   *
+   * @param rhs the SedUniformTimeCourse object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedUniformTimeCourse& operator=(SedUniformTimeCourse&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedUniformTimeCourse object.
    *
@@ -362,6 +384,28 @@ public:
   int unsetNumberOfSteps();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedUniformTimeCourse object.
    *
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedVariable.h>
+#include <sedml/SedBinaryStream.h>
 #include <sedml/SedListOfVariables.h>
 #include <sbml/xml/XMLInputStream.h>
 
@@ -64,7 +65,6 @@ SedVariable::SedVariable(unsigned int level, unsigned int version)
   , mTarget2 ("")
   , mDimensionTerm ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -74,7 +74,7 @@ SedVariable::SedVariable(unsigned int level, unsigned int version)
 /*
  * Creates a new SedVariable using the given SedNamespaces object @p sedmlns.
  */
-SedVariable::SedVariable(SedNamespaces *sedmlns)
+SedVariable::SedVariable(const SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mSymbol ("")
   , mTarget ("")
@@ -112,6 +112,25 @@ SedVariable::SedVariable(const SedVariable& orig)
 }
 
 
+/*
+ * Move constructor for SedVariable.
+ */
+SedVariable::SedVariable(SedVariable&& orig)
+  : SedBase( std::move(orig) )
+  , mSymbol ( std::move(orig.mSymbol) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mTaskReference ( std::move(orig.mTaskReference) )
+  , mModelReference ( std::move(orig.mModelReference) )
+  , mAppliedDimensions ( std::move(orig.mAppliedDimensions) )
+  , mTerm ( std::move(orig.mTerm) )
+  , mSymbol2 ( std::move(orig.mSymbol2) )
+  , mTarget2 ( std::move(orig.mTarget2) )
+  , mDimensionTerm ( std::move(orig.mDimensionTerm) )
+{
+  connectToChild();
+}
+
+
 /*
  * Assignment operator for SedVariable.
  */
@@ -137,6 +156,32 @@ SedVariable::operator=(const SedVariable& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedVariable.
+ */
+SedVariable&
+SedVariable::operator=(SedVariable&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mSymbol = std::move(rhs.mSymbol);
+    mTarget = std::move(rhs.mTarget);
+    mTaskReference = std::move(rhs.mTaskReference);
+    mModelReference = std::move(rhs.mModelReference);
+    mAppliedDimensions = std::move(rhs.mAppliedDimensions);
+    mTerm = std::move(rhs.mTerm);
+    mSymbol2 = std::move(rhs.mSymbol2);
+    mTarget2 = std::move(rhs.mTarget2);
+    mDimensionTerm = std::move(rhs.mDimensionTerm);
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedVariable object.
  */
@@ -692,6 +737,47 @@ SedVariable::addAppliedDimension(const SedAppliedDimension* sad)
 }
 
 
+/*
+ * Adds the given SedAppliedDimension to this SedVariable,
+ * which takes ownership of it.
+ */
+int
+SedVariable::addAppliedDimension(std::unique_ptr<SedAppliedDimension> sad)
+{
+  if (!sad)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+  else if (sad->getParentSedObject() != NULL)
+  {
+    // still owned by its parent, which deletes it
+    sad.release();
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (sad->hasRequiredAttributes() == false)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+  else if (getLevel() != sad->getLevel())
+  {
+    return LIBSEDML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != sad->getVersion())
+  {
+    return LIBSEDML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSedNamespacesForAddition(static_cast<const
+    SedBase*>(sad.get())) == false)
+  {
+    return LIBSEDML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return mAppliedDimensions.appendAndOwn(std::move(sad));
+  }
+}
+
+
 /*
  * Get the number of SedAppliedDimension objects in this SedVariable.
  */
@@ -713,7 +799,7 @@ SedVariable::createAppliedDimension()
 
   try
   {
-    sad = new SedAppliedDimension(getSedNamespaces());
+    sad = new (getSedArena()) SedAppliedDimension(getSedNamespaces());
   }
   catch (...)
   {
@@ -756,6 +842,99 @@ SedVariable::renameSIdRefs(const std::string& oldid, const std::string& newid)
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedVariable object to @p refs.
+ */
+void
+SedVariable::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetTaskReference())
+  {
+    refs.push_back(std::make_pair(std::string("taskReference"),
+      mTaskReference));
+  }
+
+  if (isSetModelReference())
+  {
+    refs.push_back(std::make_pair(std::string("modelReference"),
+      mModelReference));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedVariable object to @p usage.
+ */
+void
+SedVariable::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedBase::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedVariable) - sizeof(SedBase) -
+    sizeof(SedListOfAppliedDimensions));
+  usage.addString(type, mSymbol);
+  usage.addString(type, mTarget);
+  usage.addString(type, mTaskReference);
+  usage.addString(type, mModelReference);
+  usage.addString(type, mTerm);
+  usage.addString(type, mSymbol2);
+  usage.addString(type, mTarget2);
+  usage.addString(type, mDimensionTerm);
+
+  if (mAppliedDimensions.size() == 0)
+  {
+    // empty lists are not returned by getAllElements()
+    mAppliedDimensions.addMemoryUsage(usage);
+  }
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedVariable object to @p stream.
+ */
+void
+SedVariable::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedBase::writeBinary(stream);
+
+  stream.writeString(mSymbol);
+  stream.writeString(mTarget);
+  stream.writeString(mTaskReference);
+  stream.writeString(mModelReference);
+  mAppliedDimensions.writeBinary(stream);
+  stream.writeString(mTerm);
+  stream.writeString(mSymbol2);
+  stream.writeString(mTarget2);
+  stream.writeString(mDimensionTerm);
+}
+
+
+/*
+ * Reads the attributes and children of this SedVariable object from @p stream.
+ */
+void
+SedVariable::readBinary(SedBinaryInputStream& stream)
+{
+  SedBase::readBinary(stream);
+
+  stream.readString(mSymbol);
+  stream.readString(mTarget);
+  stream.readString(mTaskReference);
+  stream.readString(mModelReference);
+  mAppliedDimensions.readBinary(stream);
+  stream.readString(mTerm);
+  stream.readString(mSymbol2);
+  stream.readString(mTarget2);
+  stream.readString(mDimensionTerm);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedVariable object.
@@ -1525,7 +1704,9 @@ SedVariable::readAttributes(
   // target string (use = "optional" )
   // 
 
-  assigned = attributes.readInto("target", mTarget);
+  std::string target;
+  assigned = attributes.readInto("target", target);
+  mTarget = target;
 
   if (assigned == true)
   {
@@ -1539,7 +1720,9 @@ SedVariable::readAttributes(
   // taskReference SIdRef (use = "optional" )
   // 
 
-  assigned = attributes.readInto("taskReference", mTaskReference);
+  std::string taskReference;
+  assigned = attributes.readInto("taskReference", taskReference);
+  mTaskReference = taskReference;
 
   if (assigned == true)
   {
@@ -1556,8 +1739,8 @@ SedVariable::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mTaskReference + "', which does not conform to the "
-        "syntax.";
+      msg += " is '" + mTaskReference.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlVariableTaskReferenceMustBeAbstractTask, level, version,
         msg, getLine(), getColumn());
     }
@@ -1567,7 +1750,9 @@ SedVariable::readAttributes(
   // modelReference SIdRef (use = "optional" )
   // 
 
-  assigned = attributes.readInto("modelReference", mModelReference);
+  std::string modelReference;
+  assigned = attributes.readInto("modelReference", modelReference);
+  mModelReference = modelReference;
 
   if (assigned == true)
   {
@@ -1584,8 +1769,8 @@ SedVariable::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mModelReference + "', which does not conform to the "
-        "syntax.";
+      msg += " is '" + mModelReference.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlVariableModelReferenceMustBeModel, level, version, msg,
         getLine(), getColumn());
     }
@@ -52,6 +52,7 @@
 
 #include <sedml/SedBase.h>
 #include <sedml/SedListOfAppliedDimensions.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -65,9 +66,9 @@ protected:
   /** @cond doxygenLibSEDMLInternal */
 
   std::string mSymbol;
-  std::string mTarget;
-  std::string mTaskReference;
-  std::string mModelReference;
+  SedInternedString mTarget;
+  SedInternedString mTaskReference;
+  SedInternedString mModelReference;
   SedListOfAppliedDimensions mAppliedDimensions;
   std::string mTerm;
   std::string mSymbol2;
@@ -101,7 +102,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedVariable(SedNamespaces *sedmlns);
+  SedVariable(const SedNamespaces *sedmlns);
 
 
   /**
@@ -121,6 +122,28 @@ public:
   SedVariable& operator=(const SedVariable& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedVariable.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedVariable instance to move from.
+   */
+  SedVariable(SedVariable&& orig);
+
+
+  /**
+   * Move assignment operator for SedVariable.
+   *
+   * @param rhs the SedVariable object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedVariable& operator=(SedVariable&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedVariable object.
    *
@@ -647,6 +670,28 @@ public:
   int addAppliedDimension(const SedAppliedDimension* sad);
 
 
+#ifndef SWIG
+  /**
+   * Adds the given SedAppliedDimension to this SedVariable without copying it.
+   *
+   * @param sad the SedAppliedDimension object to add; if it already belongs to another
+   * object it is refused and left alone; otherwise it is deleted if it cannot
+   * be added.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @see addAppliedDimension(const SedAppliedDimension* sad)
+   */
+  int addAppliedDimension(std::unique_ptr<SedAppliedDimension> sad);
+#endif /* !SWIG */
+
+
   /**
    * Get the number of SedAppliedDimension objects in this SedVariable.
    *
@@ -708,6 +753,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedVariable object.
    *
@@ -32,6 +32,9 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedVectorRange.h>
+#include <sedml/SedBinaryStream.h>
+#include <sedml/common/SedNumberFormat.h>
+#include <sedml/common/SedXMLOutputStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -55,7 +58,6 @@ SedVectorRange::SedVectorRange(unsigned int level, unsigned int version)
   : SedRange(level, version)
   , mValue ()
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -63,7 +65,7 @@ SedVectorRange::SedVectorRange(unsigned int level, unsigned int version)
  * Creates a new SedVectorRange using the given SedNamespaces object @p
  * sedmlns.
  */
-SedVectorRange::SedVectorRange(SedNamespaces *sedmlns)
+SedVectorRange::SedVectorRange(const SedNamespaces *sedmlns)
   : SedRange(sedmlns)
   , mValue ()
 {
@@ -81,6 +83,16 @@ SedVectorRange::SedVectorRange(const SedVectorRange& orig)
 }
 
 
+/*
+ * Move constructor for SedVectorRange.
+ */
+SedVectorRange::SedVectorRange(SedVectorRange&& orig)
+  : SedRange( std::move(orig) )
+  , mValue ( std::move(orig.mValue) )
+{
+}
+
+
 /*
  * Assignment operator for SedVectorRange.
  */
@@ -97,6 +109,22 @@ SedVectorRange::operator=(const SedVectorRange& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedVectorRange.
+ */
+SedVectorRange&
+SedVectorRange::operator=(SedVectorRange&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedRange::operator=(std::move(rhs));
+    mValue = std::move(rhs.mValue);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedVectorRange object.
  */
@@ -157,6 +185,45 @@ SedVectorRange::setValues(const std::vector<double>& value)
 }
 
 
+/*
+ * Sets the value of the "value" attribute of this SedVectorRange from an
+ * array of doubles.
+ */
+int
+SedVectorRange::setValues(const double* values, size_t length)
+{
+  if (values == NULL && length != 0)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+
+  mValue.assign(values, values + length);
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Returns a pointer to the contiguous storage of the "value" attribute of
+ * this SedVectorRange.
+ */
+const double*
+SedVectorRange::getValuesData() const
+{
+  return mValue.empty() ? NULL : &mValue[0];
+}
+
+
+/*
+ * Reserves storage for the given number of values.
+ */
+int
+SedVectorRange::reserveValues(size_t length)
+{
+  mValue.reserve(length);
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
 /*
  * Adds another value to the "value" attribute of this SedVectorRange.
  */
@@ -179,6 +246,51 @@ SedVectorRange::clearValues()
 }
 
 
+/*
+ * Adds the memory held by this SedVectorRange object to @p usage.
+ */
+void
+SedVectorRange::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedRange::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedVectorRange) - sizeof(SedRange));
+  usage.addVectorValues(type, mValue);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedVectorRange object to @p
+ * stream.
+ */
+void
+SedVectorRange::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedRange::writeBinary(stream);
+
+  stream.writeValues(mValue);
+}
+
+
+/*
+ * Reads the attributes and children of this SedVectorRange object from @p
+ * stream.
+ */
+void
+SedVectorRange::readBinary(SedBinaryInputStream& stream)
+{
+  SedRange::readBinary(stream);
+
+  stream.readValues(mValue);
+}
+
+/** @endcond */
+
+
 /*
  * Returns the XML element name of this SedVectorRange object.
  */
@@ -227,12 +339,52 @@ SedVectorRange::writeElements(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 
   if (hasValues())
   {
-    for (std::vector<double>::const_iterator it = mValue.begin(); it !=
-      mValue.end(); ++it)
+    char number[SedNumberFormat::BUFFER_SIZE];
+    SedXMLOutputStream* rawStream =
+      dynamic_cast<SedXMLOutputStream*>(&stream);
+
+    if (rawStream != NULL)
     {
+      // format the values in blocks and hand each block to the stream at
+      // once, one <value> element per line, rather than element by element
+      static const size_t valuesPerBlock = 4096;
+      std::string block;
+      block.reserve(valuesPerBlock * (SedNumberFormat::BUFFER_SIZE + 16));
+
+      for (size_t n = 0; n < mValue.size(); ++n)
+      {
+        size_t length = SedNumberFormat::formatDouble(mValue[n], number);
+
+        if (!block.empty()) block += '\n';
+        block += "<value> ";
+        block.append(number, length);
+        block += " </value>";
+
+        if ((n + 1) % valuesPerBlock == 0 || n + 1 == mValue.size())
+        {
+          rawStream->writeRaw(block, true);
+          block.clear();
+        }
+      }
+
+      return;
+    }
+
+    // any other stream gets each value as an element of its own, still
+    // formatted with SedNumberFormat
+    std::string text;
+    text.reserve(SedNumberFormat::BUFFER_SIZE + 2);
+
+    for (size_t n = 0; n < mValue.size(); ++n)
+    {
+      size_t length = SedNumberFormat::formatDouble(mValue[n], number);
+      text.assign(1, ' ');
+      text.append(number, length);
+      text += ' ';
+
       stream.startElement("value");
       stream.setAutoIndent(false);
-      stream << " " << *it << " ";
+      stream << text;
       stream.endElement("value");
       stream.setAutoIndent(true);
     }
@@ -585,18 +737,22 @@ SedVectorRange::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 {
   bool read = false;
 
+  // reused for every <value>, so parsing allocates nothing per number
+  std::string text;
+
   while (stream.peek().getName() == "value")
   {
     stream.next();
-    stringstream text;
+
+    text.clear();
     while (stream.isGood() && stream.peek().isText())
     {
-      text << stream.next().getCharacters();
+      text += stream.peek().getCharacters();
+      stream.next();
     }
 
     double value;
-    text >> value;
-    if (!text.fail())
+    if (SedNumberFormat::parseDouble(text, value))
     {
       mValue.push_back(value);
     }
@@ -94,7 +94,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedVectorRange(SedNamespaces *sedmlns);
+  SedVectorRange(const SedNamespaces *sedmlns);
 
 
   /**
@@ -114,6 +114,28 @@ public:
   SedVectorRange& operator=(const SedVectorRange& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedVectorRange.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedVectorRange instance to move from.
+   */
+  SedVectorRange(SedVectorRange&& orig);
+
+
+  /**
+   * Move assignment operator for SedVectorRange.
+   *
+   * @param rhs the SedVectorRange object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedVectorRange& operator=(SedVectorRange&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedVectorRange object.
    *
@@ -166,6 +188,44 @@ public:
   int setValues(const std::vector<double>& value);
 
 
+  /**
+   * Sets the value of the "value" attribute of this SedVectorRange from an
+   * array of doubles, replacing any existing values with a single copy.
+   *
+   * @param values pointer to the first of the values to be set.
+   * @param length the number of values to be set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  int setValues(const double* values, size_t length);
+
+
+  /**
+   * Returns a pointer to the contiguous storage of the "value" attribute of
+   * this SedVectorRange.
+   *
+   * The getNumValues() values stay valid until the "value" attribute is
+   * next modified.
+   *
+   * @return a pointer to the first value, or @c NULL if there are no values.
+   */
+  const double* getValuesData() const;
+
+
+  /**
+   * Reserves storage for the given number of values, so that subsequent
+   * calls to addValue() do not reallocate.
+   *
+   * @param length the number of values to reserve storage for.
+   *
+   * @copydetails doc_returns_one_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   */
+  int reserveValues(size_t length);
+
+
   /**
    * Adds another value to the "value" attribute of this SedVectorRange.
    *
@@ -189,6 +249,28 @@ public:
   int clearValues();
 
 
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedVectorRange object.
    *
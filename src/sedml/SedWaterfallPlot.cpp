@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedWaterfallPlot.h>
+#include <sedml/SedBinaryStream.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -55,7 +56,6 @@ SedWaterfallPlot::SedWaterfallPlot(unsigned int level, unsigned int version)
   : SedPlot(level, version)
   , mTaskReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -63,7 +63,7 @@ SedWaterfallPlot::SedWaterfallPlot(unsigned int level, unsigned int version)
  * Creates a new SedWaterfallPlot using the given SedNamespaces object @p
  * sedmlns.
  */
-SedWaterfallPlot::SedWaterfallPlot(SedNamespaces *sedmlns)
+SedWaterfallPlot::SedWaterfallPlot(const SedNamespaces *sedmlns)
   : SedPlot(sedmlns)
   , mTaskReference ("")
 {
@@ -81,6 +81,16 @@ SedWaterfallPlot::SedWaterfallPlot(const SedWaterfallPlot& orig)
 }
 
 
+/*
+ * Move constructor for SedWaterfallPlot.
+ */
+SedWaterfallPlot::SedWaterfallPlot(SedWaterfallPlot&& orig)
+  : SedPlot( std::move(orig) )
+  , mTaskReference ( std::move(orig.mTaskReference) )
+{
+}
+
+
 /*
  * Assignment operator for SedWaterfallPlot.
  */
@@ -97,6 +107,22 @@ SedWaterfallPlot::operator=(const SedWaterfallPlot& rhs)
 }
 
 
+/*
+ * Move assignment operator for SedWaterfallPlot.
+ */
+SedWaterfallPlot&
+SedWaterfallPlot::operator=(SedWaterfallPlot&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedPlot::operator=(std::move(rhs));
+    mTaskReference = std::move(rhs.mTaskReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedWaterfallPlot object.
  */
@@ -186,6 +212,65 @@ SedWaterfallPlot::renameSIdRefs(const std::string& oldid,
   }
 }
 
+/*
+ * Appends the SIdRef attributes of this SedWaterfallPlot object to @p refs.
+ */
+void
+SedWaterfallPlot::collectSIdRefs(SedIdRefList& refs) const
+{
+  if (isSetTaskReference())
+  {
+    refs.push_back(std::make_pair(std::string("taskReference"),
+      mTaskReference));
+  }
+}
+
+
+
+/*
+ * Adds the memory held by this SedWaterfallPlot object to @p usage.
+ */
+void
+SedWaterfallPlot::addMemoryUsage(SedMemoryUsage& usage) const
+{
+  SedPlot::addMemoryUsage(usage);
+
+  int type = getTypeCode();
+
+  usage.addBytes(type, sizeof(SedWaterfallPlot) - sizeof(SedPlot));
+  usage.addString(type, mTaskReference);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the attributes and children of this SedWaterfallPlot object to @p
+ * stream.
+ */
+void
+SedWaterfallPlot::writeBinary(SedBinaryOutputStream& stream) const
+{
+  SedPlot::writeBinary(stream);
+
+  stream.writeString(mTaskReference);
+}
+
+
+/*
+ * Reads the attributes and children of this SedWaterfallPlot object from @p
+ * stream.
+ */
+void
+SedWaterfallPlot::readBinary(SedBinaryInputStream& stream)
+{
+  SedPlot::readBinary(stream);
+
+  stream.readString(mTaskReference);
+}
+
+/** @endcond */
+
 
 /*
  * Returns the XML element name of this SedWaterfallPlot object.
@@ -589,7 +674,9 @@ SedWaterfallPlot::readAttributes(
   // taskReference SIdRef (use = "required" )
   // 
 
-  assigned = attributes.readInto("taskReference", mTaskReference);
+  std::string taskReference;
+  assigned = attributes.readInto("taskReference", taskReference);
+  mTaskReference = taskReference;
 
   if (assigned == true)
   {
@@ -606,7 +693,8 @@ SedWaterfallPlot::readAttributes(
         msg += " with id '" + getId() + "'";
       }
 
-      msg += " is '" + mTaskReference + "', which does not conform to the syntax.";
+      msg += " is '" + mTaskReference.str() +
+        "', which does not conform to the syntax.";
       logError(SedmlWaterfallPlotTaskReferenceMustBeTask, level, version, msg,
         getLine(), getColumn());
     }
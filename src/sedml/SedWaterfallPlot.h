@@ -51,6 +51,7 @@
 
 
 #include <sedml/SedPlot.h>
+#include <sedml/common/SedInternedString.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -63,7 +64,7 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  std::string mTaskReference;
+  SedInternedString mTaskReference;
 
   /** @endcond */
 
@@ -93,7 +94,7 @@ public:
    *
    * @copydetails doc_note_setting_lv_pkg
    */
-  SedWaterfallPlot(SedNamespaces *sedmlns);
+  SedWaterfallPlot(const SedNamespaces *sedmlns);
 
 
   /**
@@ -113,6 +114,28 @@ public:
   SedWaterfallPlot& operator=(const SedWaterfallPlot& rhs);
 
 
+#ifndef SWIG
+  /**
+   * Move constructor for SedWaterfallPlot.
+   *
+   * The children of @p orig are transferred rather than copied, and @p orig
+   * is left empty.
+   *
+   * @param orig the SedWaterfallPlot instance to move from.
+   */
+  SedWaterfallPlot(SedWaterfallPlot&& orig);
+
+
+  /**
+   * Move assignment operator for SedWaterfallPlot.
+   *
+   * @param rhs the SedWaterfallPlot object whose values and children are moved
+   * into this object; it is left empty.
+   */
+  SedWaterfallPlot& operator=(SedWaterfallPlot&& rhs);
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedWaterfallPlot object.
    *
@@ -176,6 +199,34 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::collectSIdRefs
+   */
+  virtual void collectSIdRefs(SedIdRefList& refs) const;
+
+
+  /**
+   * @copydoc SedBase::addMemoryUsage
+   */
+  virtual void addMemoryUsage(SedMemoryUsage& usage) const;
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * @copydoc SedBase::writeBinary
+   */
+  virtual void writeBinary(SedBinaryOutputStream& stream) const;
+
+
+  /**
+   * @copydoc SedBase::readBinary
+   */
+  virtual void readBinary(SedBinaryInputStream& stream);
+
+  /** @endcond */
+
+
   /**
    * Returns the XML element name of this SedWaterfallPlot object.
    *
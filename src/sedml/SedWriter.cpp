@@ -40,6 +40,7 @@
 
 #include <sedml/common/common.h>
 #include <sbml/xml/XMLOutputStream.h>
+#include <sedml/common/SedXMLOutputStream.h>
 
 #include <sedml/SedError.h>
 #include <sedml/SedErrorLog.h>
@@ -235,8 +236,8 @@ SedWriter::writeSedML (const SedDocument* d, std::ostream& stream)
   try
   {
     stream.exceptions(ios_base::badbit | ios_base::failbit | ios_base::eofbit);
-    XMLOutputStream xos(stream, "UTF-8", true, mProgramName, 
-                                               mProgramVersion);
+    SedXMLOutputStream xos(stream, "UTF-8", true, mProgramName,
+                                                  mProgramVersion);
     d->write(xos);
     stream << endl;
 
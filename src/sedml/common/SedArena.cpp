@@ -0,0 +1,379 @@
+/**
+ * @file SedArena.cpp
+ * @brief Implementation of the SedArena class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+#include <sedml/common/SedArena.h>
+#include <sedml/common/SedArena.h>
+
+#include <cstdlib>
+#include <new>
+#include <unordered_set>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+
+using namespace std;
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Blocks are aligned for doubles and pointers, which is all SED-ML objects
+ * need.
+ */
+union SedArenaAlignment
+{
+  void*  pointer;
+  double align;
+};
+
+
+static const size_t sAlignment = sizeof(SedArenaAlignment);
+
+
+/*
+ * Every chunk is aligned to its size and starts with the chunk before it
+ * and the arena it belongs to, so that the arena of a block is found from
+ * its address alone.
+ */
+struct SedArenaChunk
+{
+  char*     previous;
+  SedArena* arena;
+};
+
+
+/*
+ * The start addresses of the chunks of all arenas.  Memory outside of
+ * them came from the heap, which needs no lookup at all as long as there
+ * are no arenas.  Created on first use and never destroyed, as objects may
+ * still be deleted during static destruction.
+ */
+struct SedArenaRegistry
+{
+  std::mutex mMutex;
+  std::unordered_set<size_t> mChunks;
+  std::atomic<size_t> mNumChunks;
+
+  SedArenaRegistry() : mMutex(), mChunks(), mNumChunks(0) {}
+};
+
+
+static SedArenaRegistry&
+getRegistry()
+{
+  static SedArenaRegistry* registry = new SedArenaRegistry();
+  return *registry;
+}
+
+
+/*
+ * Rounds size up to a multiple of the alignment.
+ */
+static size_t
+alignSize(size_t size)
+{
+  return (size + sAlignment - 1) / sAlignment * sAlignment;
+}
+
+
+static const size_t sChunkHeaderSize = alignSize(sizeof(SedArenaChunk));
+
+
+static char*
+allocateChunk()
+{
+  void* chunk = NULL;
+#if defined(_WIN32)
+  chunk = _aligned_malloc(SedArena::CHUNK_SIZE, SedArena::CHUNK_SIZE);
+#else
+  if (posix_memalign(&chunk, SedArena::CHUNK_SIZE, SedArena::CHUNK_SIZE)
+      != 0)
+  {
+    chunk = NULL;
+  }
+#endif
+  if (chunk == NULL)
+  {
+    throw std::bad_alloc();
+  }
+  return static_cast<char*>(chunk);
+}
+
+
+static void
+freeChunk(char* chunk)
+{
+#if defined(_WIN32)
+  _aligned_free(chunk);
+#else
+  free(chunk);
+#endif
+}
+
+
+const size_t SedArena::MAX_OBJECT_SIZE;
+const size_t SedArena::CHUNK_SIZE;
+
+
+SedArena::SedArena()
+  : mChunks(NULL)
+  , mNumChunks(0)
+  , mNext(NULL)
+  , mEnd(NULL)
+  , mFreeBlocks(MAX_OBJECT_SIZE / sAlignment + 1, NULL)
+  , mMutex()
+  , mLiveObjects(0)
+  , mReferences(1)
+{
+}
+
+
+/*
+ * Frees all chunks in one pass; the objects in them are gone already.
+ */
+SedArena::~SedArena()
+{
+  SedArenaRegistry& registry = getRegistry();
+  {
+    std::lock_guard<std::mutex> lock(registry.mMutex);
+    for (char* chunk = mChunks; chunk != NULL;
+         chunk = reinterpret_cast<SedArenaChunk*>(chunk)->previous)
+    {
+      registry.mChunks.erase(reinterpret_cast<size_t>(chunk));
+    }
+    registry.mNumChunks.fetch_sub(mNumChunks, std::memory_order_release);
+  }
+
+  while (mChunks != NULL)
+  {
+    char* previous = reinterpret_cast<SedArenaChunk*>(mChunks)->previous;
+    freeChunk(mChunks);
+    mChunks = previous;
+  }
+}
+
+
+/*
+ * Creates a new SedArena, referenced once by its creator.
+ */
+SedArena*
+SedArena::create()
+{
+  return new SedArena();
+}
+
+
+/*
+ * Takes a block of size bytes, a multiple of the alignment, from the ones
+ * freed before or else from the current chunk, starting a new one if
+ * needed.
+ */
+void*
+SedArena::allocateBlock(size_t size)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  void*& freed = mFreeBlocks[size / sAlignment];
+  if (freed != NULL)
+  {
+    void* block = freed;
+    freed = *static_cast<void**>(block);
+    return block;
+  }
+
+  if (mNext == NULL || (size_t)(mEnd - mNext) < size)
+  {
+    char* chunk = allocateChunk();
+    SedArenaChunk* header = reinterpret_cast<SedArenaChunk*>(chunk);
+    header->previous = mChunks;
+    header->arena = this;
+
+    SedArenaRegistry& registry = getRegistry();
+    {
+      std::lock_guard<std::mutex> registryLock(registry.mMutex);
+      registry.mChunks.insert(reinterpret_cast<size_t>(chunk));
+      registry.mNumChunks.fetch_add(1, std::memory_order_release);
+    }
+
+    mChunks = chunk;
+    ++mNumChunks;
+    mNext = chunk + sChunkHeaderSize;
+    mEnd = chunk + CHUNK_SIZE;
+  }
+
+  void* block = mNext;
+  mNext += size;
+  return block;
+}
+
+
+/*
+ * Keeps a block of size bytes, a multiple of the alignment, for the next
+ * object of the same size.
+ */
+void
+SedArena::freeBlock(void* block, size_t size)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  void*& freed = mFreeBlocks[size / sAlignment];
+  *static_cast<void**>(block) = freed;
+  freed = block;
+}
+
+
+/*
+ * Allocates size bytes from arena, or from the heap if arena is NULL or
+ * the object is too large to be worth pooling.
+ */
+void*
+SedArena::allocate(SedArena* arena, size_t size)
+{
+  if (arena == NULL || size > MAX_OBJECT_SIZE)
+  {
+    return ::operator new(size);
+  }
+
+  void* block = arena->allocateBlock(alignSize(size));
+  arena->mLiveObjects.fetch_add(1, std::memory_order_relaxed);
+  arena->mReferences.fetch_add(1, std::memory_order_relaxed);
+  return block;
+}
+
+
+/*
+ * Frees memory obtained from allocate().
+ */
+void
+SedArena::deallocate(void* ptr, size_t size)
+{
+  if (ptr == NULL)
+  {
+    return;
+  }
+
+  SedArena* arena = getArena(ptr);
+  if (arena == NULL)
+  {
+    ::operator delete(ptr);
+    return;
+  }
+
+  if (size != 0 && size <= MAX_OBJECT_SIZE)
+  {
+    arena->freeBlock(ptr, alignSize(size));
+  }
+
+  arena->mLiveObjects.fetch_sub(1, std::memory_order_relaxed);
+  arena->unref();
+}
+
+
+/*
+ * Returns the SedArena ptr was allocated from: the one owning the chunk
+ * that contains it, if any.
+ */
+SedArena*
+SedArena::getArena(const void* ptr)
+{
+  SedArenaRegistry& registry = getRegistry();
+  if (ptr == NULL ||
+      registry.mNumChunks.load(std::memory_order_acquire) == 0)
+  {
+    return NULL;
+  }
+
+  const size_t chunk = reinterpret_cast<size_t>(ptr) & ~(CHUNK_SIZE - 1);
+
+  std::lock_guard<std::mutex> lock(registry.mMutex);
+  if (registry.mChunks.find(chunk) == registry.mChunks.end())
+  {
+    return NULL;
+  }
+
+  return reinterpret_cast<const SedArenaChunk*>(chunk)->arena;
+}
+
+
+/*
+ * Drops the reference of the creator of this SedArena.
+ */
+void
+SedArena::release()
+{
+  unref();
+}
+
+
+void
+SedArena::unref()
+{
+  if (mReferences.fetch_sub(1, std::memory_order_acq_rel) == 1)
+  {
+    delete this;
+  }
+}
+
+
+/*
+ * Returns the number of bytes reserved by this SedArena.
+ */
+size_t
+SedArena::getReservedBytes() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mNumChunks * CHUNK_SIZE;
+}
+
+
+/*
+ * Returns the number of objects allocated from this SedArena that have
+ * not been deallocated yet.
+ */
+size_t
+SedArena::getNumLiveObjects() const
+{
+  return mLiveObjects.load(std::memory_order_relaxed);
+}
+
+
+#endif /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
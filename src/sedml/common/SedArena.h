@@ -0,0 +1,192 @@
+/**
+ * @file SedArena.h
+ * @brief Definition of the SedArena class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedArena
+ * @sbmlbrief{} Pool from which the objects of a SedDocument are allocated.
+ *
+ * A SedDocument with arena allocation enabled (see
+ * SedDocument::setArenaAllocation()) hands out the memory for the objects
+ * created in it from large chunks, instead of one heap allocation per
+ * object.  Deleting such an object only runs its destructor; the chunks are
+ * returned in one go once the document and every object allocated from the
+ * arena are gone.  Objects removed from the document therefore stay valid,
+ * and keep the arena alive, until they are deleted themselves.
+ *
+ * Memory of objects deleted while the arena is alive is reused for later
+ * objects of the same size.  The destructors of the objects still run one
+ * by one, as their strings and other members live on the heap; only the
+ * memory of the objects themselves is returned in one pass over the
+ * chunks.
+ *
+ * The chunks are aligned to their size, and the arena of an object is
+ * found from its address, so objects need no header of their own, and
+ * those allocated from the heap take no more memory than a plain new.
+ *
+ * Objects may be allocated from and deallocated to the same SedArena from
+ * several threads at once.
+ */
+
+
+#ifndef SedArena_h
+#define SedArena_h
+
+
+#include <sedml/common/extern.h>
+
+
+#ifdef __cplusplus
+
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+class LIBSEDML_EXTERN SedArena
+{
+public:
+
+  /**
+   * Creates a new SedArena, referenced once by its creator.
+   *
+   * @return the new SedArena; pass it to release() when done with it.
+   */
+  static SedArena* create();
+
+
+  /**
+   * Allocates @p size bytes for an object.
+   *
+   * @param arena the SedArena to allocate from, or @c NULL to allocate
+   * from the heap.
+   * @param size the number of bytes needed.
+   *
+   * @return the memory, to be freed with deallocate(); throws
+   * std::bad_alloc if no memory is available.
+   */
+  static void* allocate(SedArena* arena, size_t size);
+
+
+  /**
+   * Frees memory obtained from allocate(), whether it came from an arena
+   * or from the heap.
+   *
+   * @param ptr the memory to free, may be @c NULL.
+   * @param size the number of bytes passed to allocate(), if known, so
+   * that memory from an arena can be reused; @c 0 otherwise.
+   */
+  static void deallocate(void* ptr, size_t size = 0);
+
+
+  /**
+   * Returns the SedArena @p ptr was allocated from.
+   *
+   * @param ptr memory obtained from allocate().
+   *
+   * @return the SedArena, or @c NULL if @p ptr did not come from an arena.
+   */
+  static SedArena* getArena(const void* ptr);
+
+
+  /**
+   * Drops the reference of the creator of this SedArena; it is freed once
+   * no object allocated from it is left.
+   */
+  void release();
+
+
+  /**
+   * Returns the number of bytes reserved by this SedArena.
+   */
+  size_t getReservedBytes() const;
+
+
+  /**
+   * Returns the number of objects allocated from this SedArena that have
+   * not been deallocated yet.
+   */
+  size_t getNumLiveObjects() const;
+
+
+  /**
+   * Objects larger than this are allocated from the heap.
+   */
+  static const size_t MAX_OBJECT_SIZE = 4096;
+
+
+  /**
+   * The size of the chunks memory is reserved in.
+   */
+  static const size_t CHUNK_SIZE = 64 * 1024;
+
+
+private:
+  /** @cond doxygenLibsedmlInternal */
+
+  SedArena();
+  ~SedArena();
+  SedArena(const SedArena&);
+  SedArena& operator=(const SedArena&);
+
+  void* allocateBlock(size_t size);
+  void freeBlock(void* block, size_t size);
+  void unref();
+
+  // the chunks, newest first, each starting with a pointer to the one
+  // before; mMutex guards them, the free space of the newest and the
+  // lists of freed blocks, indexed by size
+  char* mChunks;
+  size_t mNumChunks;
+  char* mNext;
+  char* mEnd;
+  std::vector<void*> mFreeBlocks;
+  mutable std::mutex mMutex;
+
+  std::atomic<size_t> mLiveObjects;
+
+  // one for the creator plus one per live object
+  std::atomic<size_t> mReferences;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedArena_h */
@@ -0,0 +1,430 @@
+/**
+ * @file SedInternedString.cpp
+ * @brief Implementation of the SedInternedString class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+#include <sedml/common/SedInternedString.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+
+using namespace std;
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+#ifdef __cplusplus
+
+
+/*
+ * A distinct string in the table, with the number of handles holding it.
+ */
+struct SedInternedStringEntry
+{
+  SedInternedStringEntry()
+    : mValue(NULL)
+    , mReferences(0)
+  {
+  }
+
+  // the key of this entry in the table
+  const string* mValue;
+  atomic<unsigned int> mReferences;
+};
+
+
+static const size_t sMinPurgeSize = 64;
+
+static const size_t sNumShards = 64;
+
+
+/*
+ * Part of the distinct strings held by SedInternedString objects.  Entries
+ * whose count dropped to zero stay available for reuse until the shard has
+ * doubled in size since it was last purged.
+ */
+struct SedInternedStringShard
+{
+  SedInternedStringShard()
+    : mMutex()
+    , mEntries()
+    , mPurgeAt(sMinPurgeSize)
+  {
+  }
+
+  mutex mMutex;
+  unordered_map<string, SedInternedStringEntry> mEntries;
+  size_t mPurgeAt;
+};
+
+
+/*
+ * The distinct strings held by SedInternedString objects, spread over
+ * shards by their hash so that threads interning different strings rarely
+ * wait for each other.
+ */
+struct SedInternedStringTable
+{
+  SedInternedStringShard& getShard(const string& value)
+  {
+    return mShards[hash<string>()(value) % sNumShards];
+  }
+
+  SedInternedStringShard mShards[sNumShards];
+};
+
+
+// created on first use and deliberately never destroyed, as SED-ML objects
+// may still release their strings during static destruction
+static SedInternedStringTable&
+getInternedStringTable()
+{
+  static SedInternedStringTable* table = new SedInternedStringTable();
+  return *table;
+}
+
+
+static const string&
+getEmptyString()
+{
+  static const string* empty = new string();
+  return *empty;
+}
+
+
+SedInternedString::SedInternedString()
+  : mEntry(NULL)
+{
+}
+
+
+SedInternedString::SedInternedString(const std::string& value)
+  : mEntry(intern(value))
+{
+}
+
+
+SedInternedString::SedInternedString(const SedInternedString& orig)
+  : mEntry(orig.mEntry)
+{
+  // the entry cannot be purged while orig holds it
+  if (mEntry != NULL)
+  {
+    ++mEntry->mReferences;
+  }
+}
+
+
+SedInternedString::SedInternedString(SedInternedString&& orig)
+  : mEntry(orig.mEntry)
+{
+  orig.mEntry = NULL;
+}
+
+
+SedInternedString::~SedInternedString()
+{
+  release(mEntry);
+}
+
+
+SedInternedString&
+SedInternedString::operator=(const SedInternedString& rhs)
+{
+  if (mEntry != rhs.mEntry)
+  {
+    if (rhs.mEntry != NULL)
+    {
+      ++rhs.mEntry->mReferences;
+    }
+    release(mEntry);
+    mEntry = rhs.mEntry;
+  }
+
+  return *this;
+}
+
+
+SedInternedString&
+SedInternedString::operator=(SedInternedString&& rhs)
+{
+  if (&rhs != this)
+  {
+    release(mEntry);
+    mEntry = rhs.mEntry;
+    rhs.mEntry = NULL;
+  }
+
+  return *this;
+}
+
+
+SedInternedString&
+SedInternedString::operator=(const std::string& value)
+{
+  SedInternedStringEntry* entry = intern(value);
+  release(mEntry);
+  mEntry = entry;
+
+  return *this;
+}
+
+
+const std::string&
+SedInternedString::str() const
+{
+  return (mEntry != NULL) ? *mEntry->mValue : getEmptyString();
+}
+
+
+SedInternedString::operator const std::string&() const
+{
+  return str();
+}
+
+
+const char*
+SedInternedString::c_str() const
+{
+  return str().c_str();
+}
+
+
+bool
+SedInternedString::empty() const
+{
+  return (mEntry == NULL);
+}
+
+
+size_t
+SedInternedString::size() const
+{
+  return str().size();
+}
+
+
+void
+SedInternedString::clear()
+{
+  release(mEntry);
+  mEntry = NULL;
+}
+
+
+SedInternedString&
+SedInternedString::erase()
+{
+  clear();
+  return *this;
+}
+
+
+bool
+SedInternedString::operator==(const SedInternedString& rhs) const
+{
+  return (mEntry == rhs.mEntry);
+}
+
+
+bool
+SedInternedString::operator!=(const SedInternedString& rhs) const
+{
+  return (mEntry != rhs.mEntry);
+}
+
+
+const std::string&
+SedInternedString::lookup(const std::string& value)
+{
+  // never the string of a handle, so it compares unequal to all of them
+  static const string* unused = new string();
+
+  if (value.empty())
+  {
+    return getEmptyString();
+  }
+
+  SedInternedStringShard& shard = getInternedStringTable().getShard(value);
+  lock_guard<mutex> lock(shard.mMutex);
+
+  unordered_map<string, SedInternedStringEntry>::const_iterator it =
+    shard.mEntries.find(value);
+  if (it == shard.mEntries.end() || it->second.mReferences == 0)
+  {
+    return *unused;
+  }
+
+  return it->first;
+}
+
+
+size_t
+SedInternedString::getNumInterned()
+{
+  SedInternedStringTable& table = getInternedStringTable();
+
+  size_t count = 0;
+  for (size_t i = 0; i < sNumShards; ++i)
+  {
+    SedInternedStringShard& shard = table.mShards[i];
+    lock_guard<mutex> lock(shard.mMutex);
+
+    unordered_map<string, SedInternedStringEntry>::const_iterator it;
+    for (it = shard.mEntries.begin(); it != shard.mEntries.end(); ++it)
+    {
+      if (it->second.mReferences != 0)
+      {
+        ++count;
+      }
+    }
+  }
+
+  return count;
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns the entry for value, with a reference taken for the caller.
+ */
+SedInternedStringEntry*
+SedInternedString::intern(const std::string& value)
+{
+  if (value.empty())
+  {
+    return NULL;
+  }
+
+  SedInternedStringShard& shard = getInternedStringTable().getShard(value);
+  lock_guard<mutex> lock(shard.mMutex);
+
+  unordered_map<string, SedInternedStringEntry>::iterator it =
+    shard.mEntries.find(value);
+  if (it == shard.mEntries.end())
+  {
+    // references are only taken while the shard is locked, or from a
+    // holder of another reference, so an idle entry cannot be revived
+    // while purging
+    if (shard.mEntries.size() >= shard.mPurgeAt)
+    {
+      for (it = shard.mEntries.begin(); it != shard.mEntries.end(); )
+      {
+        if (it->second.mReferences == 0)
+        {
+          it = shard.mEntries.erase(it);
+        }
+        else
+        {
+          ++it;
+        }
+      }
+      shard.mPurgeAt = max(sMinPurgeSize, 2 * shard.mEntries.size());
+    }
+
+    it = shard.mEntries.emplace(piecewise_construct, forward_as_tuple(value),
+                                forward_as_tuple()).first;
+    it->second.mValue = &it->first;
+  }
+
+  ++it->second.mReferences;
+  return &it->second;
+}
+
+
+/*
+ * Drops a reference to entry; idle entries are purged by intern().
+ */
+void
+SedInternedString::release(SedInternedStringEntry* entry)
+{
+  if (entry != NULL)
+  {
+    --entry->mReferences;
+  }
+}
+
+/** @endcond */
+
+
+bool
+operator==(const SedInternedString& lhs, const std::string& rhs)
+{
+  return lhs.str() == rhs;
+}
+
+
+bool
+operator==(const std::string& lhs, const SedInternedString& rhs)
+{
+  return lhs == rhs.str();
+}
+
+
+bool
+operator==(const SedInternedString& lhs, const char* rhs)
+{
+  return lhs.str() == rhs;
+}
+
+
+bool
+operator!=(const SedInternedString& lhs, const std::string& rhs)
+{
+  return lhs.str() != rhs;
+}
+
+
+bool
+operator!=(const std::string& lhs, const SedInternedString& rhs)
+{
+  return lhs != rhs.str();
+}
+
+
+bool
+operator!=(const SedInternedString& lhs, const char* rhs)
+{
+  return lhs.str() != rhs;
+}
+
+
+#endif /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
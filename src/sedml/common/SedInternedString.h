@@ -0,0 +1,280 @@
+/**
+ * @file SedInternedString.h
+ * @brief Definition of the SedInternedString class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedInternedString
+ * @sbmlbrief{} Handle to a string kept once in a table shared by all
+ * SED-ML objects.
+ *
+ * SED-ML documents repeat the same values many times: the ids held by
+ * "taskReference" and "modelReference" attributes, XPath "target"
+ * expressions and KiSAO ids.  Attributes stored as a SedInternedString
+ * hold a pointer to a single reference counted copy of each distinct
+ * value instead of a string of their own.  Two handles are equal exactly
+ * when they point to the same copy, so they compare in constant time, and
+ * the strings returned for equal values are the same object.
+ *
+ * The table may be used from several threads at once.  It is split into
+ * shards by the hash of the strings, each with a lock of its own, so that
+ * threads interning or looking up different strings rarely wait for each
+ * other.
+ */
+
+
+#ifndef SedInternedString_h
+#define SedInternedString_h
+
+
+#include <sedml/common/extern.h>
+
+
+#ifdef __cplusplus
+
+
+#include <cstddef>
+#include <string>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibSEDMLInternal */
+struct SedInternedStringEntry;
+/** @endcond */
+
+
+class LIBSEDML_EXTERN SedInternedString
+{
+public:
+
+  /**
+   * Creates an empty SedInternedString.
+   */
+  SedInternedString();
+
+
+  /**
+   * Creates a SedInternedString holding @p value.
+   *
+   * @param value the string to intern.
+   */
+  SedInternedString(const std::string& value);
+
+
+  /**
+   * Copy constructor; the copy shares the string of @p orig.
+   *
+   * @param orig the SedInternedString to copy.
+   */
+  SedInternedString(const SedInternedString& orig);
+
+
+  /**
+   * Move constructor; @p orig is left empty.
+   *
+   * @param orig the SedInternedString to move from.
+   */
+  SedInternedString(SedInternedString&& orig);
+
+
+  /**
+   * Destructor.
+   */
+  ~SedInternedString();
+
+
+  /**
+   * Assignment operator.
+   *
+   * @param rhs the SedInternedString whose string is to be shared.
+   */
+  SedInternedString& operator=(const SedInternedString& rhs);
+
+
+  /**
+   * Move assignment operator; @p rhs is left empty.
+   *
+   * @param rhs the SedInternedString to move from.
+   */
+  SedInternedString& operator=(SedInternedString&& rhs);
+
+
+  /**
+   * Replaces the string held by this SedInternedString with @p value.
+   *
+   * @param value the string to intern.
+   */
+  SedInternedString& operator=(const std::string& value);
+
+
+  /**
+   * Returns the string held by this SedInternedString.
+   *
+   * The string is shared by all handles holding the same value, and
+   * remains valid as long as this handle holds it.
+   */
+  const std::string& str() const;
+
+
+  /**
+   * Returns the string held by this SedInternedString.
+   */
+  operator const std::string&() const;
+
+
+  /**
+   * Returns the string held by this SedInternedString as a C string.
+   */
+  const char* c_str() const;
+
+
+  /**
+   * Returns @c true if this SedInternedString holds the empty string.
+   */
+  bool empty() const;
+
+
+  /**
+   * Returns the length of the string held by this SedInternedString.
+   */
+  size_t size() const;
+
+
+  /**
+   * Makes this SedInternedString hold the empty string.
+   */
+  void clear();
+
+
+  /**
+   * Makes this SedInternedString hold the empty string, like
+   * std::string::erase().
+   */
+  SedInternedString& erase();
+
+
+  /**
+   * Returns @c true if this SedInternedString and @p rhs hold the same
+   * string.
+   */
+  bool operator==(const SedInternedString& rhs) const;
+
+
+  /**
+   * Returns @c true if this SedInternedString and @p rhs hold different
+   * strings.
+   */
+  bool operator!=(const SedInternedString& rhs) const;
+
+
+  /**
+   * Returns the copy of @p value held by the table, without adding it.
+   *
+   * Strings returned by str() are equal to @p value exactly when they are
+   * the object returned here, so a value looked up once can be compared
+   * with many handles by address.
+   *
+   * @param value the string to look up.
+   *
+   * @return the shared copy of @p value, or a string no handle holds if
+   * @p value is not in use.
+   */
+  static const std::string& lookup(const std::string& value);
+
+
+  /**
+   * Returns the number of distinct non-empty strings currently held by
+   * SedInternedString objects.
+   */
+  static size_t getNumInterned();
+
+
+private:
+  /** @cond doxygenLibSEDMLInternal */
+
+  static SedInternedStringEntry* intern(const std::string& value);
+  static void release(SedInternedStringEntry* entry);
+
+  // NULL for the empty string
+  SedInternedStringEntry* mEntry;
+
+  /** @endcond */
+};
+
+
+/**
+ * Returns @c true if @p lhs holds @p rhs.
+ */
+LIBSEDML_EXTERN
+bool operator==(const SedInternedString& lhs, const std::string& rhs);
+
+
+/**
+ * Returns @c true if @p rhs holds @p lhs.
+ */
+LIBSEDML_EXTERN
+bool operator==(const std::string& lhs, const SedInternedString& rhs);
+
+
+/**
+ * Returns @c true if @p lhs holds @p rhs.
+ */
+LIBSEDML_EXTERN
+bool operator==(const SedInternedString& lhs, const char* rhs);
+
+
+/**
+ * Returns @c true if @p lhs does not hold @p rhs.
+ */
+LIBSEDML_EXTERN
+bool operator!=(const SedInternedString& lhs, const std::string& rhs);
+
+
+/**
+ * Returns @c true if @p rhs does not hold @p lhs.
+ */
+LIBSEDML_EXTERN
+bool operator!=(const std::string& lhs, const SedInternedString& rhs);
+
+
+/**
+ * Returns @c true if @p lhs does not hold @p rhs.
+ */
+LIBSEDML_EXTERN
+bool operator!=(const SedInternedString& lhs, const char* rhs);
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedInternedString_h */
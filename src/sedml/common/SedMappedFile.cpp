@@ -0,0 +1,133 @@
+/**
+ * @file SedMappedFile.cpp
+ * @brief Implementation of the SedMappedFile class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+#include <sedml/common/SedMappedFile.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+using namespace std;
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Maps the file with the given name.
+ */
+SedMappedFile::SedMappedFile(const std::string& filename)
+  : mData (NULL)
+  , mSize (0)
+  , mLength (0)
+{
+#if !defined(_WIN32)
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return;
+
+  struct stat info;
+  if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0)
+  {
+    const size_t size = static_cast<size_t>(info.st_size);
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    // reserve a zero-filled region one page longer than the file and
+    // map the file over its start; whatever follows the last byte of
+    // the file reads as zero
+    mLength = (size / page + 2) * page;
+    void* base = mmap(NULL, mLength, PROT_READ,
+                      MAP_PRIVATE | MAP_ANON, -1, 0);
+
+    if (base != MAP_FAILED)
+    {
+      if (mmap(base, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0)
+          != MAP_FAILED)
+      {
+        madvise(base, size, MADV_SEQUENTIAL);
+        mData = base;
+        mSize = size;
+      }
+      else
+      {
+        munmap(base, mLength);
+      }
+    }
+  }
+
+  close(fd);
+#endif
+}
+
+
+/*
+ * Unmaps the file.
+ */
+SedMappedFile::~SedMappedFile()
+{
+#if !defined(_WIN32)
+  if (mData != NULL) munmap(mData, mLength);
+#endif
+}
+
+
+/*
+ * Returns the contents of the file, or NULL if it could not be mapped.
+ */
+const char*
+SedMappedFile::getData() const
+{
+  return static_cast<const char*>(mData);
+}
+
+
+/*
+ * Returns the size of the file in bytes, not counting the zero padding.
+ */
+size_t
+SedMappedFile::getSize() const
+{
+  return mSize;
+}
+
+
+#endif /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
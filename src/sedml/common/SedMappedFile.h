@@ -0,0 +1,117 @@
+/**
+ * @file SedMappedFile.h
+ * @brief Definition of the SedMappedFile class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedMappedFile
+ * @sbmlbrief{} Read-only memory mapping of a file.
+ *
+ * The mapping is followed by at least one zero byte, so that a text file can
+ * be parsed in place as a null-terminated string.  Files are only mapped on
+ * platforms providing POSIX @c mmap(); elsewhere, and for anything that is
+ * not a regular non-empty file, getData() returns @c NULL and callers fall
+ * back to reading the file the conventional way.
+ */
+
+
+#ifndef SedMappedFile_h
+#define SedMappedFile_h
+
+
+#include <sedml/common/extern.h>
+
+
+#ifdef __cplusplus
+
+
+#include <cstddef>
+#include <string>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+class LIBSEDML_EXTERN SedMappedFile
+{
+public:
+
+  /**
+   * Maps the file with the given name.
+   *
+   * @param filename the name or full pathname of the file to map.
+   */
+  explicit SedMappedFile(const std::string& filename);
+
+
+  /**
+   * Unmaps the file.
+   */
+  ~SedMappedFile();
+
+
+  /**
+   * Returns the contents of the file, or @c NULL if it could not be mapped.
+   *
+   * @return the first byte of the mapping.
+   */
+  const char* getData() const;
+
+
+  /**
+   * Returns the size of the file in bytes, not counting the zero padding.
+   *
+   * @return the size of the mapped file, or @c 0 if it could not be mapped.
+   */
+  size_t getSize() const;
+
+
+private:
+
+  SedMappedFile(const SedMappedFile&);
+  SedMappedFile& operator=(const SedMappedFile&);
+
+  void*  mData;
+  size_t mSize;
+  size_t mLength;
+};
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedMappedFile_h */
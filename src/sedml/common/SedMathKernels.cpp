@@ -0,0 +1,221 @@
+/**
+ * @file SedMathKernels.cpp
+ * @brief Implementation of the vectorized kernels of SedCompiledMath.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+#include <sedml/common/SedMathKernels.h>
+#include <sedml/common/SedMathKernelsImpl.h>
+
+#include <atomic>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+
+using namespace std;
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+#ifdef __cplusplus
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * No kernels at all: SedCompiledMath uses its portable loops.
+ */
+static const SedMathKernelSet SCALAR_KERNELS = { "scalar", { NULL } };
+
+
+static atomic<const SedMathKernelSet*> sKernels(NULL);
+
+
+/*
+ * The SSE2 kernels, or @c NULL if this is not an x86 build with SSE2.
+ */
+static const SedMathKernelSet*
+getSedMathKernelsSSE2()
+{
+#ifdef SEDML_HAVE_SSE2_KERNELS
+  struct Builder
+  {
+    SedMathKernelSet set;
+    Builder()
+    {
+      set = SCALAR_KERNELS;
+      set.name = "sse2";
+      sedSetKernels<SedVectorSSE2>(set);
+    }
+  };
+
+  static const Builder builder;
+  return &builder.set;
+#else
+  return NULL;
+#endif
+}
+
+
+/*
+ * Predicate returning @c true if the processor and operating system
+ * support AVX2.
+ */
+static bool
+supportsAVX2()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") != 0;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7)
+  {
+    return false;
+  }
+
+  // the operating system must save the AVX registers on context switches
+  __cpuid(info, 1);
+  if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 ||
+      (_xgetbv(0) & 6) != 6)
+  {
+    return false;
+  }
+
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else
+  return false;
+#endif
+}
+
+
+/*
+ * Returns the kernel set with the given name if it can be used here.
+ */
+static const SedMathKernelSet*
+findKernels(const string& name)
+{
+  if (name == "scalar")
+  {
+    return &SCALAR_KERNELS;
+  }
+  if (name == "sse2")
+  {
+    return getSedMathKernelsSSE2();
+  }
+  if (name == "avx2")
+  {
+    // the AVX2 source file may not even be initialized on other processors
+    static const bool supported = supportsAVX2();
+    return supported ? getSedMathKernelsAVX2() : NULL;
+  }
+  return NULL;
+}
+
+
+/*
+ * Returns the kernels currently used, selecting the best on first use.
+ */
+const SedMathKernelSet*
+getSedMathKernels()
+{
+  const SedMathKernelSet* kernels = sKernels.load(memory_order_acquire);
+
+  if (kernels == NULL)
+  {
+    vector<string> names = getAvailableSedMathKernels();
+    kernels = findKernels(names.back());
+    sKernels.store(kernels, memory_order_release);
+  }
+
+  return kernels;
+}
+
+
+/*
+ * Selects the kernels to use by name, or the best if @p name is empty.
+ */
+bool
+setSedMathKernels(const std::string& name)
+{
+  const SedMathKernelSet* kernels = NULL;
+
+  if (name.empty())
+  {
+    kernels = findKernels(getAvailableSedMathKernels().back());
+  }
+  else
+  {
+    kernels = findKernels(name);
+  }
+
+  if (kernels == NULL)
+  {
+    return false;
+  }
+
+  sKernels.store(kernels, memory_order_release);
+  return true;
+}
+
+
+/*
+ * Returns the names of the kernel sets that can be used, best last.
+ */
+std::vector<std::string>
+getAvailableSedMathKernels()
+{
+  static const char* const NAMES[] = { "scalar", "sse2", "avx2" };
+
+  vector<string> names;
+  for (size_t i = 0; i < sizeof(NAMES) / sizeof(NAMES[0]); ++i)
+  {
+    if (findKernels(NAMES[i]) != NULL)
+    {
+      names.push_back(NAMES[i]);
+    }
+  }
+
+  return names;
+}
+
+/** @endcond */
+
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
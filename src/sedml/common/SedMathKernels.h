@@ -0,0 +1,177 @@
+/**
+ * @file SedMathKernels.h
+ * @brief Definition of the vectorized kernels of SedCompiledMath.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * The instructions of a SedCompiledMath program are applied to blocks of
+ * elements by kernels.  Besides the portable loops of SedCompiledMath
+ * itself, there are kernels using SSE2 and AVX2, the latter compiled
+ * separately and only used on processors that support it; the best set
+ * available is picked on first use.
+ *
+ * Vectorized exp() and ln() are accurate to a few units in the last
+ * place, and pow() to about 1e-13 relative; lanes outside the range of
+ * the approximations (zero, negative or non-finite arguments, results
+ * that overflow or underflow) are computed by the C library, so that
+ * special values come out as in scalar code.
+ */
+
+
+#ifndef SedMathKernels_h
+#define SedMathKernels_h
+
+
+#include <sedml/common/extern.h>
+
+
+#ifdef __cplusplus
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * The operations of a compiled program.
+ */
+enum SedMathOp
+{
+  SEDML_OP_CONST,
+  SEDML_OP_SCALAR,
+  SEDML_OP_COPY,
+  SEDML_OP_NEG,
+  SEDML_OP_ADD,
+  SEDML_OP_SUB,
+  SEDML_OP_MUL,
+  SEDML_OP_DIV,
+  SEDML_OP_POW,
+  SEDML_OP_ROOT,
+  SEDML_OP_LOGBASE,
+  SEDML_OP_ABS,
+  SEDML_OP_EXP,
+  SEDML_OP_LN,
+  SEDML_OP_LOG10,
+  SEDML_OP_SQRT,
+  SEDML_OP_FLOOR,
+  SEDML_OP_CEIL,
+  SEDML_OP_QUOTIENT,
+  SEDML_OP_REM,
+  SEDML_OP_MIN,
+  SEDML_OP_MAX,
+  SEDML_OP_EQ,
+  SEDML_OP_NEQ,
+  SEDML_OP_GT,
+  SEDML_OP_GEQ,
+  SEDML_OP_LT,
+  SEDML_OP_LEQ,
+  SEDML_OP_AND,
+  SEDML_OP_OR,
+  SEDML_OP_XOR,
+  SEDML_OP_NOT,
+  SEDML_OP_IMPLIES,
+  SEDML_OP_SELECT,
+  SEDML_OP_CALL,
+  SEDML_NUM_OPS
+};
+
+
+/*
+ * Computes d[i] = op(a[i], b[i], c[i]) for @p n elements; the operands an
+ * operation does not use are ignored.  @p d may be the same array as any
+ * of the operands.
+ */
+typedef void (*SedMathKernel)(double* d, const double* a, const double* b,
+                              const double* c, size_t n);
+
+
+/*
+ * The kernels of one instruction set, indexed by SedMathOp; operations
+ * without a kernel are left to the portable loops.
+ */
+struct SedMathKernelSet
+{
+  const char* name;
+  SedMathKernel kernels[SEDML_NUM_OPS];
+};
+
+
+/*
+ * Returns the kernels currently used by SedCompiledMath, never @c NULL;
+ * the best set available is selected on the first call.
+ */
+LIBSEDML_EXTERN
+const SedMathKernelSet*
+getSedMathKernels();
+
+
+/*
+ * Selects the kernels to use by name; an empty name selects the best set
+ * available.  Returns @c false, leaving the selection unchanged, if the
+ * set is unknown or not supported by this build or processor.
+ */
+LIBSEDML_EXTERN
+bool
+setSedMathKernels(const std::string& name);
+
+
+/*
+ * Returns the names of the kernel sets that can be selected, from the
+ * portable one to the best.
+ */
+LIBSEDML_EXTERN
+std::vector<std::string>
+getAvailableSedMathKernels();
+
+
+/*
+ * The AVX2 kernels, defined in a source file compiled for AVX2; @c NULL if
+ * the compiler could not build them.  They must only be used after
+ * checking that the processor supports AVX2.
+ */
+const SedMathKernelSet*
+getSedMathKernelsAVX2();
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedMathKernels_h */
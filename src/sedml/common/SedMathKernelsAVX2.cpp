@@ -0,0 +1,116 @@
+/**
+ * @file SedMathKernelsAVX2.cpp
+ * @brief The AVX2 kernels of SedCompiledMath.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * This file is compiled with the compiler flags for AVX2, see
+ * src/sedml/CMakeLists.txt; nothing in it may run before the processor
+ * has been checked for AVX2 support.
+ */
+#include <sedml/common/SedMathKernels.h>
+#include <sedml/common/SedMathKernelsImpl.h>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+#ifdef __cplusplus
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+#ifdef SEDML_HAVE_AVX2_KERNELS
+
+namespace
+{
+
+struct SedFloorOp
+{
+  typedef SedVectorAVX2 Vector;
+  static __m256d apply(__m256d a) { return SedVectorAVX2::floor(a); }
+};
+
+struct SedCeilOp
+{
+  typedef SedVectorAVX2 Vector;
+  static __m256d apply(__m256d a) { return SedVectorAVX2::ceil(a); }
+};
+
+
+/*
+ * The AVX2 kernels; on top of those of every instruction set, AVX has
+ * rounding instructions.
+ */
+struct SedKernelsAVX2
+{
+  SedMathKernelSet set;
+
+  SedKernelsAVX2()
+  {
+    set.name = "avx2";
+    for (int i = 0; i < SEDML_NUM_OPS; ++i)
+    {
+      set.kernels[i] = NULL;
+    }
+
+    sedSetKernels<SedVectorAVX2>(set);
+    set.kernels[SEDML_OP_FLOOR] = &sedUnaryKernel<SedFloorOp>;
+    set.kernels[SEDML_OP_CEIL]  = &sedUnaryKernel<SedCeilOp>;
+  }
+};
+
+}  // namespace
+
+
+const SedMathKernelSet*
+getSedMathKernelsAVX2()
+{
+  static const SedKernelsAVX2 kernels;
+  return &kernels.set;
+}
+
+#else
+
+const SedMathKernelSet*
+getSedMathKernelsAVX2()
+{
+  return NULL;
+}
+
+#endif  /* SEDML_HAVE_AVX2_KERNELS */
+
+/** @endcond */
+
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
@@ -0,0 +1,811 @@
+/**
+ * @file SedMathKernelsImpl.h
+ * @brief Vectorized kernels shared by the instruction sets of SedMathKernels.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * This header is included by the source files building the kernels of
+ * one instruction set each, with the compiler flags for that set.
+ * Everything here has internal linkage, so that code compiled for AVX2
+ * cannot be picked by the linker for a caller built for SSE2; for the
+ * same reason no library templates are instantiated here.
+ *
+ * The exponential and logarithm follow the rational approximations of
+ * the Cephes library.
+ */
+
+
+#ifndef SedMathKernelsImpl_h
+#define SedMathKernelsImpl_h
+
+
+#include <sedml/common/SedMathKernels.h>
+
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SEDML_HAVE_SSE2_KERNELS
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SEDML_HAVE_AVX2_KERNELS
+#endif
+
+
+#ifdef __cplusplus
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+namespace
+{
+
+// 2^52: adding it to a small non-negative integer puts the integer in the
+// low bits of the mantissa
+const double SEDML_MANTISSA_SHIFT = 4503599627370496.0;
+
+const double SEDML_MIN_NORMAL = 2.2250738585072014e-308;
+const double SEDML_MAX_FINITE = 1.7976931348623157e+308;
+
+// the range in which exp() neither overflows nor becomes subnormal
+const double SEDML_EXP_LOW = -708.0;
+const double SEDML_EXP_HIGH = 709.0;
+
+
+#ifdef SEDML_HAVE_SSE2_KERNELS
+
+/*
+ * Two doubles in an SSE2 register.
+ */
+struct SedVectorSSE2
+{
+  typedef __m128d Type;
+  enum { LANES = 2, ALL = 3 };
+
+  static Type load(const double* p)   { return _mm_loadu_pd(p); }
+  static void store(double* p, Type v) { _mm_storeu_pd(p, v); }
+  static Type set(double x)           { return _mm_set1_pd(x); }
+
+  static Type add(Type a, Type b) { return _mm_add_pd(a, b); }
+  static Type sub(Type a, Type b) { return _mm_sub_pd(a, b); }
+  static Type mul(Type a, Type b) { return _mm_mul_pd(a, b); }
+  static Type div(Type a, Type b) { return _mm_div_pd(a, b); }
+  static Type min(Type a, Type b) { return _mm_min_pd(a, b); }
+  static Type max(Type a, Type b) { return _mm_max_pd(a, b); }
+  static Type sqrt(Type a)        { return _mm_sqrt_pd(a); }
+
+  static Type bitAnd(Type a, Type b) { return _mm_and_pd(a, b); }
+  static Type bitOr(Type a, Type b)  { return _mm_or_pd(a, b); }
+  static Type bitXor(Type a, Type b) { return _mm_xor_pd(a, b); }
+  static Type andNot(Type a, Type b) { return _mm_andnot_pd(a, b); }
+
+  static Type eq(Type a, Type b)  { return _mm_cmpeq_pd(a, b); }
+  static Type neq(Type a, Type b) { return _mm_cmpneq_pd(a, b); }
+  static Type gt(Type a, Type b)  { return _mm_cmpgt_pd(a, b); }
+  static Type geq(Type a, Type b) { return _mm_cmpge_pd(a, b); }
+  static Type lt(Type a, Type b)  { return _mm_cmplt_pd(a, b); }
+  static Type leq(Type a, Type b) { return _mm_cmple_pd(a, b); }
+
+  static int mask(Type m) { return _mm_movemask_pd(m); }
+
+  static Type select(Type m, Type a, Type b)
+  {
+    return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b));
+  }
+
+  // rounds to the nearest integer; |x| must be below 2^31
+  static Type round(Type x)
+  {
+    return _mm_cvtepi32_pd(_mm_cvtpd_epi32(x));
+  }
+
+  // 2^n for integers n in [-1022, 1023]
+  static Type pow2(Type n)
+  {
+    Type biased = _mm_add_pd(n, _mm_set1_pd(SEDML_MANTISSA_SHIFT + 1023.0));
+    return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(biased), 52));
+  }
+
+  // the biased exponent of positive x
+  static Type exponent(Type x)
+  {
+    __m128i bits = _mm_srli_epi64(_mm_castpd_si128(x), 52);
+    Type shift = _mm_set1_pd(SEDML_MANTISSA_SHIFT);
+    bits = _mm_or_si128(bits, _mm_castpd_si128(shift));
+    return _mm_sub_pd(_mm_castsi128_pd(bits), shift);
+  }
+
+  // the mantissa of x scaled to [0.5, 1)
+  static Type mantissa(Type x)
+  {
+    __m128i bits = _mm_set1_epi64x(0x000FFFFFFFFFFFFFLL);
+    return _mm_or_pd(_mm_and_pd(x, _mm_castsi128_pd(bits)),
+                     _mm_set1_pd(0.5));
+  }
+};
+
+#endif  /* SEDML_HAVE_SSE2_KERNELS */
+
+
+#ifdef SEDML_HAVE_AVX2_KERNELS
+
+/*
+ * Four doubles in an AVX register.
+ */
+struct SedVectorAVX2
+{
+  typedef __m256d Type;
+  enum { LANES = 4, ALL = 15 };
+
+  static Type load(const double* p)   { return _mm256_loadu_pd(p); }
+  static void store(double* p, Type v) { _mm256_storeu_pd(p, v); }
+  static Type set(double x)           { return _mm256_set1_pd(x); }
+
+  static Type add(Type a, Type b) { return _mm256_add_pd(a, b); }
+  static Type sub(Type a, Type b) { return _mm256_sub_pd(a, b); }
+  static Type mul(Type a, Type b) { return _mm256_mul_pd(a, b); }
+  static Type div(Type a, Type b) { return _mm256_div_pd(a, b); }
+  static Type min(Type a, Type b) { return _mm256_min_pd(a, b); }
+  static Type max(Type a, Type b) { return _mm256_max_pd(a, b); }
+  static Type sqrt(Type a)        { return _mm256_sqrt_pd(a); }
+  static Type floor(Type a)       { return _mm256_floor_pd(a); }
+  static Type ceil(Type a)        { return _mm256_ceil_pd(a); }
+
+  static Type bitAnd(Type a, Type b) { return _mm256_and_pd(a, b); }
+  static Type bitOr(Type a, Type b)  { return _mm256_or_pd(a, b); }
+  static Type bitXor(Type a, Type b) { return _mm256_xor_pd(a, b); }
+  static Type andNot(Type a, Type b) { return _mm256_andnot_pd(a, b); }
+
+  static Type eq(Type a, Type b)  { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+  static Type neq(Type a, Type b) { return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); }
+  static Type gt(Type a, Type b)  { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+  static Type geq(Type a, Type b) { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+  static Type lt(Type a, Type b)  { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+  static Type leq(Type a, Type b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+
+  static int mask(Type m) { return _mm256_movemask_pd(m); }
+
+  static Type select(Type m, Type a, Type b)
+  {
+    return _mm256_blendv_pd(b, a, m);
+  }
+
+  static Type round(Type x)
+  {
+    return _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  }
+
+  static Type pow2(Type n)
+  {
+    Type biased = _mm256_add_pd(n,
+                                _mm256_set1_pd(SEDML_MANTISSA_SHIFT + 1023.0));
+    return _mm256_castsi256_pd(
+      _mm256_slli_epi64(_mm256_castpd_si256(biased), 52));
+  }
+
+  static Type exponent(Type x)
+  {
+    __m256i bits = _mm256_srli_epi64(_mm256_castpd_si256(x), 52);
+    Type shift = _mm256_set1_pd(SEDML_MANTISSA_SHIFT);
+    bits = _mm256_or_si256(bits, _mm256_castpd_si256(shift));
+    return _mm256_sub_pd(_mm256_castsi256_pd(bits), shift);
+  }
+
+  static Type mantissa(Type x)
+  {
+    __m256i bits = _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL);
+    return _mm256_or_pd(_mm256_and_pd(x, _mm256_castsi256_pd(bits)),
+                        _mm256_set1_pd(0.5));
+  }
+};
+
+#endif  /* SEDML_HAVE_AVX2_KERNELS */
+
+
+/*
+ * Replaces the lanes of @p r that are not in @p fast by f(a) or f(a, b),
+ * computed by the C library.
+ */
+template <typename V>
+inline typename V::Type
+sedFixLanes(typename V::Type fast, typename V::Type r, typename V::Type a,
+            double (*f)(double))
+{
+  const int m = V::mask(fast);
+  if (m == V::ALL)
+  {
+    return r;
+  }
+
+  double x[V::LANES], y[V::LANES];
+  V::store(x, a);
+  V::store(y, r);
+  for (int j = 0; j < V::LANES; ++j)
+  {
+    if ((m & (1 << j)) == 0)
+    {
+      y[j] = f(x[j]);
+    }
+  }
+  return V::load(y);
+}
+
+
+template <typename V>
+inline typename V::Type
+sedFixLanes(typename V::Type fast, typename V::Type r, typename V::Type a,
+            typename V::Type b, double (*f)(double, double))
+{
+  const int m = V::mask(fast);
+  if (m == V::ALL)
+  {
+    return r;
+  }
+
+  double x[V::LANES], z[V::LANES], y[V::LANES];
+  V::store(x, a);
+  V::store(z, b);
+  V::store(y, r);
+  for (int j = 0; j < V::LANES; ++j)
+  {
+    if ((m & (1 << j)) == 0)
+    {
+      y[j] = f(x[j], z[j]);
+    }
+  }
+  return V::load(y);
+}
+
+
+/*
+ * exp(x) for x in [SEDML_EXP_LOW, SEDML_EXP_HIGH]: x = n ln(2) + y with
+ * |y| <= ln(2) / 2, and exp(y) from a Pade approximation.
+ */
+template <typename V>
+inline typename V::Type
+sedExpCore(typename V::Type x)
+{
+  typedef typename V::Type T;
+
+  const T n = V::round(V::mul(x, V::set(1.4426950408889634073599)));
+  T y = V::sub(x, V::mul(n, V::set(6.93145751953125e-1)));
+  y = V::sub(y, V::mul(n, V::set(1.42860682030941723212e-6)));
+
+  const T yy = V::mul(y, y);
+  T p = V::set(1.26177193074810590878e-4);
+  p = V::add(V::mul(p, yy), V::set(3.02994407707441961300e-2));
+  p = V::add(V::mul(p, yy), V::set(9.99999999999999999910e-1));
+  p = V::mul(p, y);
+  T q = V::set(3.00198505138664455042e-6);
+  q = V::add(V::mul(q, yy), V::set(2.52448340349684104192e-3));
+  q = V::add(V::mul(q, yy), V::set(2.27265548208155028766e-1));
+  q = V::add(V::mul(q, yy), V::set(2.00000000000000000009e0));
+
+  y = V::div(p, V::sub(q, p));
+  y = V::add(V::set(1.0), V::add(y, y));
+  return V::mul(y, V::pow2(n));
+}
+
+
+/*
+ * ln(x) for positive, normal and finite x: x = m 2^e with m in
+ * [sqrt(1/2), sqrt(2)), and ln(m) from a rational approximation; ln(2)
+ * is split in two parts to keep e ln(2) exact.
+ */
+template <typename V>
+inline typename V::Type
+sedLogCore(typename V::Type x)
+{
+  typedef typename V::Type T;
+
+  T e = V::sub(V::exponent(x), V::set(1022.0));
+  T m = V::mantissa(x);
+  const T small = V::lt(m, V::set(7.07106781186547524401e-1));
+  e = V::sub(e, V::bitAnd(small, V::set(1.0)));
+  m = V::add(V::sub(m, V::set(1.0)), V::bitAnd(small, m));
+
+  const T z = V::mul(m, m);
+  T p = V::set(1.01875663804580931796e-4);
+  p = V::add(V::mul(p, m), V::set(4.97494994976747001425e-1));
+  p = V::add(V::mul(p, m), V::set(4.70579119878881725854e0));
+  p = V::add(V::mul(p, m), V::set(1.44989225341610930846e1));
+  p = V::add(V::mul(p, m), V::set(1.79368678507819816313e1));
+  p = V::add(V::mul(p, m), V::set(7.70838733755885391666e0));
+  T q = V::add(m, V::set(1.12873587189167450590e1));
+  q = V::add(V::mul(q, m), V::set(4.52279145837532221105e1));
+  q = V::add(V::mul(q, m), V::set(8.29875266912776603211e1));
+  q = V::add(V::mul(q, m), V::set(7.11544750618563894466e1));
+  q = V::add(V::mul(q, m), V::set(2.31251620126765340583e1));
+
+  T r = V::mul(m, V::div(V::mul(z, p), q));
+  r = V::sub(r, V::mul(e, V::set(2.121944400546905827679e-4)));
+  r = V::sub(r, V::mul(z, V::set(0.5)));
+  r = V::add(m, r);
+  return V::add(r, V::mul(e, V::set(0.693359375)));
+}
+
+
+/*
+ * The mask of the lanes of @p x that are positive, normal and finite.
+ */
+template <typename V>
+inline typename V::Type
+sedIsNormal(typename V::Type x)
+{
+  return V::bitAnd(V::geq(x, V::set(SEDML_MIN_NORMAL)),
+                   V::leq(x, V::set(SEDML_MAX_FINITE)));
+}
+
+
+/*
+ * 1.0 where the mask @p m is set, 0.0 elsewhere.
+ */
+template <typename V>
+inline typename V::Type
+sedTruth(typename V::Type m)
+{
+  return V::bitAnd(m, V::set(1.0));
+}
+
+
+template <typename V>
+inline typename V::Type
+sedNonZero(typename V::Type a)
+{
+  return V::neq(a, V::set(0.0));
+}
+
+
+/*
+ * The operations; each maps whole vectors.
+ */
+template <typename V>
+struct SedNegOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a)
+  {
+    return V::bitXor(a, V::set(-0.0));
+  }
+};
+
+template <typename V>
+struct SedAbsOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a)
+  {
+    return V::andNot(V::set(-0.0), a);
+  }
+};
+
+template <typename V>
+struct SedSqrtOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a) { return V::sqrt(a); }
+};
+
+template <typename V>
+struct SedExpOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a)
+  {
+    typedef typename V::Type T;
+    const T fast = V::bitAnd(V::geq(a, V::set(SEDML_EXP_LOW)),
+                             V::leq(a, V::set(SEDML_EXP_HIGH)));
+    const T r = sedExpCore<V>(V::bitAnd(fast, a));
+    return sedFixLanes<V>(fast, r, a, &exp);
+  }
+};
+
+template <typename V>
+struct SedLnOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a)
+  {
+    typedef typename V::Type T;
+    const T fast = sedIsNormal<V>(a);
+    const T r = sedLogCore<V>(V::select(fast, a, V::set(1.0)));
+    return sedFixLanes<V>(fast, r, a, &log);
+  }
+};
+
+template <typename V>
+struct SedLog10Op
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a)
+  {
+    typedef typename V::Type T;
+    const T fast = sedIsNormal<V>(a);
+    T r = sedLogCore<V>(V::select(fast, a, V::set(1.0)));
+    r = V::mul(r, V::set(4.34294481903251827651e-1));
+    return sedFixLanes<V>(fast, r, a, &log10);
+  }
+};
+
+template <typename V>
+struct SedNotOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a)
+  {
+    return sedTruth<V>(V::eq(a, V::set(0.0)));
+  }
+};
+
+template <typename V>
+struct SedAddOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return V::add(a, b);
+  }
+};
+
+template <typename V>
+struct SedSubOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return V::sub(a, b);
+  }
+};
+
+template <typename V>
+struct SedMulOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return V::mul(a, b);
+  }
+};
+
+template <typename V>
+struct SedDivOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return V::div(a, b);
+  }
+};
+
+/*
+ * pow(a, b) as exp(b ln(a)) for positive a; exponents for which the C
+ * library is exact are computed exactly, so that squares, square roots
+ * and reciprocals agree with scalar code.
+ */
+template <typename V>
+struct SedPowOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    typedef typename V::Type T;
+    const T normal = sedIsNormal<V>(a);
+    const T t = V::mul(b, sedLogCore<V>(V::select(normal, a, V::set(1.0))));
+    const T fast = V::bitAnd(normal,
+                             V::bitAnd(V::geq(t, V::set(SEDML_EXP_LOW)),
+                                       V::leq(t, V::set(SEDML_EXP_HIGH))));
+    T r = sedExpCore<V>(V::bitAnd(fast, t));
+    r = V::select(V::eq(b, V::set(2.0)), V::mul(a, a), r);
+    r = V::select(V::eq(b, V::set(1.0)), a, r);
+    r = V::select(V::eq(b, V::set(0.5)), V::sqrt(a), r);
+    r = V::select(V::eq(b, V::set(-1.0)), V::div(V::set(1.0), a), r);
+    return sedFixLanes<V>(fast, r, a, b, &pow);
+  }
+};
+
+// the scalar code returns b if b < a, which is what min(b, a) does
+template <typename V>
+struct SedMinOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return V::min(b, a);
+  }
+};
+
+template <typename V>
+struct SedMaxOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return V::max(b, a);
+  }
+};
+
+template <typename V>
+struct SedEqOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return sedTruth<V>(V::eq(a, b));
+  }
+};
+
+template <typename V>
+struct SedNeqOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return sedTruth<V>(V::neq(a, b));
+  }
+};
+
+template <typename V>
+struct SedGtOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return sedTruth<V>(V::gt(a, b));
+  }
+};
+
+template <typename V>
+struct SedGeqOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return sedTruth<V>(V::geq(a, b));
+  }
+};
+
+template <typename V>
+struct SedLtOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return sedTruth<V>(V::lt(a, b));
+  }
+};
+
+template <typename V>
+struct SedLeqOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return sedTruth<V>(V::leq(a, b));
+  }
+};
+
+template <typename V>
+struct SedAndOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return sedTruth<V>(V::bitAnd(sedNonZero<V>(a), sedNonZero<V>(b)));
+  }
+};
+
+template <typename V>
+struct SedOrOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return sedTruth<V>(V::bitOr(sedNonZero<V>(a), sedNonZero<V>(b)));
+  }
+};
+
+template <typename V>
+struct SedXorOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return sedTruth<V>(V::bitXor(sedNonZero<V>(a), sedNonZero<V>(b)));
+  }
+};
+
+template <typename V>
+struct SedImpliesOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b)
+  {
+    return sedTruth<V>(V::bitOr(V::eq(a, V::set(0.0)), sedNonZero<V>(b)));
+  }
+};
+
+template <typename V>
+struct SedSelectOp
+{
+  typedef V Vector;
+  static typename V::Type apply(typename V::Type a, typename V::Type b,
+                                typename V::Type c)
+  {
+    return V::select(sedNonZero<V>(a), b, c);
+  }
+};
+
+
+/*
+ * Copies the last @p count < LANES elements of @p a into a full vector,
+ * padded with ones so that no lane raises a spurious special case.
+ */
+template <typename V>
+inline typename V::Type
+sedLoadPartial(const double* a, size_t count)
+{
+  double x[V::LANES];
+  for (size_t j = 0; j < (size_t)V::LANES; ++j)
+  {
+    x[j] = j < count ? a[j] : 1.0;
+  }
+  return V::load(x);
+}
+
+
+template <typename V>
+inline void
+sedStorePartial(double* d, typename V::Type v, size_t count)
+{
+  double x[V::LANES];
+  V::store(x, v);
+  for (size_t j = 0; j < count; ++j)
+  {
+    d[j] = x[j];
+  }
+}
+
+
+/*
+ * The kernels applying an operation to arrays, a vector at a time.
+ */
+template <typename Op>
+void
+sedUnaryKernel(double* d, const double* a, const double*, const double*,
+               size_t n)
+{
+  typedef typename Op::Vector V;
+  size_t i = 0;
+  for (; i + V::LANES <= n; i += V::LANES)
+  {
+    V::store(d + i, Op::apply(V::load(a + i)));
+  }
+  if (i < n)
+  {
+    sedStorePartial<V>(d + i, Op::apply(sedLoadPartial<V>(a + i, n - i)),
+                       n - i);
+  }
+}
+
+
+template <typename Op>
+void
+sedBinaryKernel(double* d, const double* a, const double* b, const double*,
+                size_t n)
+{
+  typedef typename Op::Vector V;
+  size_t i = 0;
+  for (; i + V::LANES <= n; i += V::LANES)
+  {
+    V::store(d + i, Op::apply(V::load(a + i), V::load(b + i)));
+  }
+  if (i < n)
+  {
+    sedStorePartial<V>(d + i, Op::apply(sedLoadPartial<V>(a + i, n - i),
+                                        sedLoadPartial<V>(b + i, n - i)),
+                       n - i);
+  }
+}
+
+
+template <typename Op>
+void
+sedTernaryKernel(double* d, const double* a, const double* b,
+                 const double* c, size_t n)
+{
+  typedef typename Op::Vector V;
+  size_t i = 0;
+  for (; i + V::LANES <= n; i += V::LANES)
+  {
+    V::store(d + i, Op::apply(V::load(a + i), V::load(b + i),
+                              V::load(c + i)));
+  }
+  if (i < n)
+  {
+    sedStorePartial<V>(d + i, Op::apply(sedLoadPartial<V>(a + i, n - i),
+                                        sedLoadPartial<V>(b + i, n - i),
+                                        sedLoadPartial<V>(c + i, n - i)),
+                       n - i);
+  }
+}
+
+
+/*
+ * Fills in the kernels every instruction set provides.
+ */
+template <typename V>
+void
+sedSetKernels(SedMathKernelSet& set)
+{
+  set.kernels[SEDML_OP_NEG]     = &sedUnaryKernel<SedNegOp<V> >;
+  set.kernels[SEDML_OP_ABS]     = &sedUnaryKernel<SedAbsOp<V> >;
+  set.kernels[SEDML_OP_SQRT]    = &sedUnaryKernel<SedSqrtOp<V> >;
+  set.kernels[SEDML_OP_EXP]     = &sedUnaryKernel<SedExpOp<V> >;
+  set.kernels[SEDML_OP_LN]      = &sedUnaryKernel<SedLnOp<V> >;
+  set.kernels[SEDML_OP_LOG10]   = &sedUnaryKernel<SedLog10Op<V> >;
+  set.kernels[SEDML_OP_NOT]     = &sedUnaryKernel<SedNotOp<V> >;
+  set.kernels[SEDML_OP_ADD]     = &sedBinaryKernel<SedAddOp<V> >;
+  set.kernels[SEDML_OP_SUB]     = &sedBinaryKernel<SedSubOp<V> >;
+  set.kernels[SEDML_OP_MUL]     = &sedBinaryKernel<SedMulOp<V> >;
+  set.kernels[SEDML_OP_DIV]     = &sedBinaryKernel<SedDivOp<V> >;
+  set.kernels[SEDML_OP_POW]     = &sedBinaryKernel<SedPowOp<V> >;
+  set.kernels[SEDML_OP_MIN]     = &sedBinaryKernel<SedMinOp<V> >;
+  set.kernels[SEDML_OP_MAX]     = &sedBinaryKernel<SedMaxOp<V> >;
+  set.kernels[SEDML_OP_EQ]      = &sedBinaryKernel<SedEqOp<V> >;
+  set.kernels[SEDML_OP_NEQ]     = &sedBinaryKernel<SedNeqOp<V> >;
+  set.kernels[SEDML_OP_GT]      = &sedBinaryKernel<SedGtOp<V> >;
+  set.kernels[SEDML_OP_GEQ]     = &sedBinaryKernel<SedGeqOp<V> >;
+  set.kernels[SEDML_OP_LT]      = &sedBinaryKernel<SedLtOp<V> >;
+  set.kernels[SEDML_OP_LEQ]     = &sedBinaryKernel<SedLeqOp<V> >;
+  set.kernels[SEDML_OP_AND]     = &sedBinaryKernel<SedAndOp<V> >;
+  set.kernels[SEDML_OP_OR]      = &sedBinaryKernel<SedOrOp<V> >;
+  set.kernels[SEDML_OP_XOR]     = &sedBinaryKernel<SedXorOp<V> >;
+  set.kernels[SEDML_OP_IMPLIES] = &sedBinaryKernel<SedImpliesOp<V> >;
+  set.kernels[SEDML_OP_SELECT]  = &sedTernaryKernel<SedSelectOp<V> >;
+}
+
+}  // namespace
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedMathKernelsImpl_h */
@@ -0,0 +1,320 @@
+/**
+ * @file SedNumberFormat.cpp
+ * @brief Implementation of the SedNumberFormat class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+#include <sedml/common/SedNumberFormat.h>
+
+#include <clocale>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
+
+
+using namespace std;
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Powers of ten that are exactly representable as doubles.
+ */
+static const double sExactPowersOfTen[] =
+{
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
+static bool
+isSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+
+static bool
+isDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+
+static bool
+equals(const char* begin, const char* end, const char* text)
+{
+  size_t length = strlen(text);
+  return static_cast<size_t>(end - begin) == length &&
+         strncmp(begin, text, length) == 0;
+}
+
+
+/*
+ * Parses decimal text whose significand fits into 53 bits and whose power
+ * of ten is exactly representable; a single multiplication or division of
+ * two exact doubles is then correctly rounded.  Returns false for anything
+ * else, including text that would need more digits to decide the rounding.
+ */
+static bool
+parseExactDouble(const char* p, const char* end, double& value)
+{
+  bool negative = false;
+  if (p != end && (*p == '+' || *p == '-'))
+  {
+    negative = (*p == '-');
+    ++p;
+  }
+
+  unsigned long long significand = 0;
+  int digits = 0;
+  int exponent = 0;
+  bool any = false;
+
+  for (; p != end && isDigit(*p); ++p)
+  {
+    any = true;
+    if (digits == 19) return false;
+    significand = significand * 10 + static_cast<unsigned int>(*p - '0');
+    if (significand != 0) ++digits;
+  }
+
+  if (p != end && *p == '.')
+  {
+    for (++p; p != end && isDigit(*p); ++p)
+    {
+      any = true;
+      if (digits == 19) return false;
+      significand = significand * 10 + static_cast<unsigned int>(*p - '0');
+      if (significand != 0) ++digits;
+      --exponent;
+    }
+  }
+
+  if (!any) return false;
+
+  if (p != end && (*p == 'e' || *p == 'E'))
+  {
+    ++p;
+    bool negativeExponent = false;
+    if (p != end && (*p == '+' || *p == '-'))
+    {
+      negativeExponent = (*p == '-');
+      ++p;
+    }
+
+    if (p == end || !isDigit(*p)) return false;
+
+    int e = 0;
+    for (; p != end && isDigit(*p); ++p)
+    {
+      if (e > 10000) return false;
+      e = e * 10 + (*p - '0');
+    }
+
+    exponent += negativeExponent ? -e : e;
+  }
+
+  if (p != end) return false;
+
+  if (significand == 0)
+  {
+    value = negative ? -0.0 : 0.0;
+    return true;
+  }
+
+  if (significand > (1ULL << 53) || exponent < -22 || exponent > 22)
+  {
+    return false;
+  }
+
+  double result = static_cast<double>(significand);
+  if (exponent < 0)
+  {
+    result /= sExactPowersOfTen[-exponent];
+  }
+  else
+  {
+    result *= sExactPowersOfTen[exponent];
+  }
+
+  value = negative ? -result : result;
+  return true;
+}
+
+
+/*
+ * Parses the number in the given range of characters.
+ */
+bool
+SedNumberFormat::parseDouble(const char* begin, const char* end, double& value)
+{
+  if (begin == NULL || end == NULL)
+  {
+    return false;
+  }
+
+  while (begin != end && isSpace(*begin)) ++begin;
+  while (end != begin && isSpace(*(end - 1))) --end;
+
+  if (begin == end)
+  {
+    return false;
+  }
+
+  if (parseExactDouble(begin, end, value))
+  {
+    return true;
+  }
+
+  if (equals(begin, end, "INF") || equals(begin, end, "+INF"))
+  {
+    value = numeric_limits<double>::infinity();
+    return true;
+  }
+  else if (equals(begin, end, "-INF"))
+  {
+    value = -numeric_limits<double>::infinity();
+    return true;
+  }
+  else if (equals(begin, end, "NaN"))
+  {
+    value = numeric_limits<double>::quiet_NaN();
+    return true;
+  }
+
+  // long or out of range significands, and text trailing the number
+  istringstream stream(string(begin, end));
+  stream.imbue(locale::classic());
+
+  double result;
+  stream >> result;
+  if (stream.fail())
+  {
+    return false;
+  }
+
+  value = result;
+  return true;
+}
+
+
+/*
+ * Parses the number in the given string.
+ */
+bool
+SedNumberFormat::parseDouble(const std::string& text, double& value)
+{
+  const char* begin = text.c_str();
+  return parseDouble(begin, begin + text.size(), value);
+}
+
+
+/*
+ * Writes the shortest text that parseDouble() reads back as value.
+ */
+size_t
+SedNumberFormat::formatDouble(double value, char* buffer)
+{
+  if (value != value)
+  {
+    strcpy(buffer, "NaN");
+    return 3;
+  }
+  else if (value == numeric_limits<double>::infinity())
+  {
+    strcpy(buffer, "INF");
+    return 3;
+  }
+  else if (value == -numeric_limits<double>::infinity())
+  {
+    strcpy(buffer, "-INF");
+    return 4;
+  }
+
+  // printf honours LC_NUMERIC; put back the '.' it may have replaced
+  const char* point = localeconv()->decimal_point;
+  size_t pointLength = (point != NULL) ? strlen(point) : 0;
+  bool localized = pointLength != 0 && strcmp(point, ".") != 0;
+
+  size_t length = 0;
+  for (int precision = 15; precision <= 17; ++precision)
+  {
+    int written = snprintf(buffer, BUFFER_SIZE, "%.*g", precision, value);
+    length = (written > 0) ? static_cast<size_t>(written) : 0;
+
+    if (localized)
+    {
+      char* found = strstr(buffer, point);
+      if (found != NULL)
+      {
+        *found = '.';
+        memmove(found + 1, found + pointLength,
+                length - static_cast<size_t>(found - buffer) - pointLength + 1);
+        length -= pointLength - 1;
+      }
+    }
+
+    double check;
+    if (precision == 17 ||
+        (parseDouble(buffer, buffer + length, check) && check == value))
+    {
+      break;
+    }
+  }
+
+  return length;
+}
+
+
+/*
+ * Returns the shortest text that parseDouble() reads back as value.
+ */
+std::string
+SedNumberFormat::formatDouble(double value)
+{
+  char buffer[BUFFER_SIZE];
+  size_t length = formatDouble(value, buffer);
+  return std::string(buffer, length);
+}
+
+
+#endif /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
@@ -0,0 +1,133 @@
+/**
+ * @file SedNumberFormat.h
+ * @brief Definition of the SedNumberFormat class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedNumberFormat
+ * @sbmlbrief{} Locale-independent conversion between doubles and text.
+ *
+ * The SED-ML files written by libSEDML must not depend on the locale of the
+ * process that wrote them, and large vectors of numbers (for instance the
+ * values of a SedVectorRange) should not pay for a std::stringstream per
+ * number.  SedNumberFormat parses doubles with a fast exact path for the
+ * common short decimals and falls back to the "C" locale otherwise; it
+ * formats doubles with the shortest representation that reads back to the
+ * same value.
+ */
+
+
+#ifndef SedNumberFormat_h
+#define SedNumberFormat_h
+
+
+#include <sedml/common/extern.h>
+
+
+#ifdef __cplusplus
+
+
+#include <string>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+class LIBSEDML_EXTERN SedNumberFormat
+{
+public:
+
+  /**
+   * The size of a buffer large enough for any result of formatDouble().
+   */
+  static const size_t BUFFER_SIZE = 32;
+
+
+  /**
+   * Parses the number in the given range of characters.
+   *
+   * Leading and trailing whitespace is ignored.  Besides the usual decimal
+   * notation, the XML Schema spellings @c INF, @c -INF and @c NaN are
+   * accepted.  Text following a number is ignored, as it is when reading
+   * with a std::istream.
+   *
+   * @param begin pointer to the first character.
+   * @param end pointer one past the last character.
+   * @param value the parsed number, left unchanged on failure.
+   *
+   * @return @c true if a number was read, @c false otherwise.
+   */
+  static bool parseDouble(const char* begin, const char* end, double& value);
+
+
+  /**
+   * Parses the number in the given string.
+   *
+   * @copydetails parseDouble(const char*, const char*, double&)
+   */
+  static bool parseDouble(const std::string& text, double& value);
+
+
+  /**
+   * Writes the shortest text that parseDouble() reads back as @p value.
+   *
+   * Infinities and NaN are written as @c INF, @c -INF and @c NaN.  The
+   * output never depends on the locale.
+   *
+   * @param value the number to format.
+   * @param buffer a buffer of at least SedNumberFormat::BUFFER_SIZE
+   * characters, which receives the null-terminated text.
+   *
+   * @return the number of characters written, excluding the terminator.
+   */
+  static size_t formatDouble(double value, char* buffer);
+
+
+  /**
+   * Returns the shortest text that parseDouble() reads back as @p value.
+   *
+   * @param value the number to format.
+   *
+   * @return the formatted number.
+   */
+  static std::string formatDouble(double value);
+
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedNumberFormat_h */
+
+
@@ -39,7 +39,7 @@
 
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
-static SedOperationReturnValues_t SEDML_OPERATION_RETURN_VALUES_INDICES[] = 
+static const SedOperationReturnValues_t SEDML_OPERATION_RETURN_VALUES_INDICES[] = 
 {
     LIBSEDML_OPERATION_SUCCESS
   , LIBSEDML_INDEX_EXCEEDS_SIZE
@@ -59,7 +59,7 @@ static SedOperationReturnValues_t SEDML_OPERATION_RETURN_VALUES_INDICES[] =
   , LIBSEDML_DEPRECATED_ATTRIBUTE
 };
 
-static const char* SEDML_OPERATION_RETURN_VALUES_STRINGS[] =
+static const char* const SEDML_OPERATION_RETURN_VALUES_STRINGS[] =
 {
   /* LIBSEDML_OPERATION_SUCCESS = 0 */
    "The operation was successful. "
@@ -0,0 +1,248 @@
+/**
+ * @file SedThreadPool.cpp
+ * @brief Implementation of the SedThreadPool class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+#include <sedml/common/SedThreadPool.h>
+
+
+using namespace std;
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+#ifdef __cplusplus
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+namespace
+{
+
+// the pool and queue of the worker running on this thread, if any
+thread_local SedThreadPool* currentPool = NULL;
+thread_local unsigned int currentQueue = 0;
+
+}
+
+
+/*
+ * Starts the worker threads.
+ */
+SedThreadPool::SedThreadPool(unsigned int numThreads)
+  : mQueues ()
+  , mThreads ()
+  , mQueued (0)
+  , mPending (0)
+  , mNext (0)
+  , mStop (false)
+{
+  if (numThreads == 0)
+  {
+    numThreads = thread::hardware_concurrency();
+  }
+  if (numThreads == 0)
+  {
+    numThreads = 1;
+  }
+
+  for (unsigned int i = 0; i < numThreads; ++i)
+  {
+    mQueues.push_back(unique_ptr<Queue>(new Queue()));
+  }
+
+  for (unsigned int i = 0; i < numThreads; ++i)
+  {
+    mThreads.push_back(thread(&SedThreadPool::work, this, i));
+  }
+}
+
+
+/*
+ * Runs the jobs still queued, then stops the worker threads.
+ */
+SedThreadPool::~SedThreadPool()
+{
+  {
+    lock_guard<mutex> lock(mMutex);
+    mStop = true;
+  }
+  mWake.notify_all();
+
+  for (size_t i = 0; i < mThreads.size(); ++i)
+  {
+    mThreads[i].join();
+  }
+}
+
+
+/*
+ * Returns the number of worker threads.
+ */
+unsigned int
+SedThreadPool::getNumThreads() const
+{
+  return static_cast<unsigned int>(mThreads.size());
+}
+
+
+/*
+ * Queues a job.
+ */
+void
+SedThreadPool::submit(const Job& job)
+{
+  unsigned int index;
+  if (currentPool == this)
+  {
+    index = currentQueue;
+  }
+  else
+  {
+    lock_guard<mutex> lock(mMutex);
+    index = mNext++ % mQueues.size();
+  }
+
+  {
+    lock_guard<mutex> lock(mQueues[index]->mutex);
+    mQueues[index]->jobs.push_back(job);
+  }
+
+  {
+    lock_guard<mutex> lock(mMutex);
+    ++mQueued;
+    ++mPending;
+  }
+  mWake.notify_one();
+}
+
+
+/*
+ * Blocks until every job has finished.
+ */
+void
+SedThreadPool::wait()
+{
+  unique_lock<mutex> lock(mMutex);
+  mIdle.wait(lock, [this]() { return mPending == 0; });
+}
+
+
+/*
+ * The loop of a worker thread.
+ */
+void
+SedThreadPool::work(unsigned int index)
+{
+  currentPool = this;
+  currentQueue = index;
+
+  for (;;)
+  {
+    {
+      unique_lock<mutex> lock(mMutex);
+      mWake.wait(lock, [this]() { return mStop || mQueued > 0; });
+      if (mQueued == 0)
+      {
+        return;
+      }
+      --mQueued;
+    }
+
+    // there are at least as many queued jobs as reservations, but a scan
+    // may miss them while other workers take and submit jobs
+    Job job;
+    while (!take(index, job))
+    {
+      this_thread::yield();
+    }
+
+    try
+    {
+      job();
+    }
+    catch (...)
+    {
+    }
+    job = Job();
+
+    {
+      lock_guard<mutex> lock(mMutex);
+      if (--mPending == 0)
+      {
+        mIdle.notify_all();
+      }
+    }
+  }
+}
+
+
+/*
+ * Takes the newest job of the given queue or, failing that, the oldest of
+ * another one.
+ */
+bool
+SedThreadPool::take(unsigned int index, Job& job)
+{
+  {
+    Queue& own = *mQueues[index];
+    lock_guard<mutex> lock(own.mutex);
+    if (!own.jobs.empty())
+    {
+      job = own.jobs.back();
+      own.jobs.pop_back();
+      return true;
+    }
+  }
+
+  for (size_t i = 1; i < mQueues.size(); ++i)
+  {
+    Queue& other = *mQueues[(index + i) % mQueues.size()];
+    lock_guard<mutex> lock(other.mutex);
+    if (!other.jobs.empty())
+    {
+      job = other.jobs.front();
+      other.jobs.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+#endif  /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
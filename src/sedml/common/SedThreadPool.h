@@ -0,0 +1,151 @@
+/**
+ * @file SedThreadPool.h
+ * @brief Definition of the SedThreadPool class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ *
+ * @class SedThreadPool
+ * @sbmlbrief{} Work-stealing pool of threads running jobs.
+ *
+ * Each worker thread owns a queue of jobs.  Jobs submitted by a job go to
+ * the queue of the worker running it, which takes its most recent job
+ * first; a worker whose queue is empty steals the oldest job of another.
+ * Jobs submitted from outside the pool are spread over the queues in turn.
+ * Work that unfolds as a graph therefore stays on one thread, close to the
+ * data it has just produced, until some other thread runs out of work.
+ */
+
+
+#ifndef SedThreadPool_h
+#define SedThreadPool_h
+
+
+#include <sedml/common/extern.h>
+
+
+#ifdef __cplusplus
+
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+class LIBSEDML_EXTERN SedThreadPool
+{
+public:
+
+  typedef std::function<void()> Job;
+
+
+  /**
+   * Starts the worker threads.
+   *
+   * @param numThreads the number of worker threads, or @c 0 for as many as
+   * the hardware runs concurrently.
+   */
+  explicit SedThreadPool(unsigned int numThreads = 0);
+
+
+  /**
+   * Runs the jobs still queued, then stops the worker threads.
+   */
+  ~SedThreadPool();
+
+
+  /**
+   * Returns the number of worker threads.
+   */
+  unsigned int getNumThreads() const;
+
+
+  /**
+   * Queues a job.  Exceptions thrown by the job are discarded.
+   *
+   * @param job the job to run on one of the worker threads.
+   */
+  void submit(const Job& job);
+
+
+  /**
+   * Blocks until every job submitted so far, and every job those have
+   * submitted, has finished.  Must not be called from a job.
+   */
+  void wait();
+
+
+private:
+
+  struct Queue
+  {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+
+  SedThreadPool(const SedThreadPool&);
+  SedThreadPool& operator=(const SedThreadPool&);
+
+  void work(unsigned int index);
+
+  bool take(unsigned int index, Job& job);
+
+  std::vector<std::unique_ptr<Queue> > mQueues;
+  std::vector<std::thread> mThreads;
+
+  // counts of jobs sitting in queues and of jobs not finished yet; a
+  // worker reserves a queued job before looking for it
+  std::mutex mMutex;
+  std::condition_variable mWake;
+  std::condition_variable mIdle;
+  size_t mQueued;
+  size_t mPending;
+  unsigned int mNext;
+  bool mStop;
+};
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* SedThreadPool_h */
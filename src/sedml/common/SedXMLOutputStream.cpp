@@ -0,0 +1,102 @@
+/**
+ * @file SedXMLOutputStream.cpp
+ * @brief Implementation of the SedXMLOutputStream class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+#include <sedml/common/SedXMLOutputStream.h>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Creates a new SedXMLOutputStream.
+ */
+SedXMLOutputStream::SedXMLOutputStream(std::ostream& stream,
+                                       const std::string& encoding,
+                                       bool writeXMLDecl,
+                                       const std::string& programName,
+                                       const std::string& programVersion)
+  : XMLOutputStream(stream, encoding, writeXMLDecl, programName,
+                    programVersion)
+{
+}
+
+
+/*
+ * Writes markup unchanged, closing a pending start tag and indenting
+ * exactly as startElement() does.
+ */
+void
+SedXMLOutputStream::writeRaw(const std::string& markup, bool indentLines)
+{
+  if (mInStart)
+  {
+    mStream << '>';
+    upIndent();
+  }
+
+  mInStart = false;
+
+  if (!indentLines)
+  {
+    writeIndent();
+    mStream << markup;
+  }
+  else
+  {
+    std::string::size_type start = 0;
+    while (start < markup.size())
+    {
+      std::string::size_type stop = markup.find('\n', start);
+      if (stop == std::string::npos) stop = markup.size();
+
+      writeIndent();
+      mStream.write(markup.data() + start, stop - start);
+      start = stop + 1;
+    }
+  }
+
+  mInText = false;
+}
+
+
+#endif /* __cplusplus */
+
+
+LIBSEDML_CPP_NAMESPACE_END
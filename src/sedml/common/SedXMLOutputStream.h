@@ -0,0 +1,97 @@
+/**
+ * @file SedXMLOutputStream.h
+ * @brief Definition of the SedXMLOutputStream class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedXMLOutputStream
+ * @sbmlbrief{} XMLOutputStream that can also write markup as it is.
+ *
+ * Notes, annotations and newXML payloads that were read but never accessed
+ * are kept as markup (see SedBase::readRawXML()).  SedWriter writes
+ * documents through a SedXMLOutputStream, so that such markup goes to the
+ * output unchanged instead of being parsed and serialized again.  Any
+ * other XMLOutputStream still works; markup is then written as a tree.
+ */
+
+
+#ifndef SedXMLOutputStream_h
+#define SedXMLOutputStream_h
+
+
+#include <sedml/common/extern.h>
+#include <sbml/xml/XMLOutputStream.h>
+
+
+#ifdef __cplusplus
+
+
+#include <ostream>
+#include <string>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+class LIBSEDML_EXTERN SedXMLOutputStream :
+  public LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream
+{
+public:
+
+  /**
+   * Creates a new SedXMLOutputStream writing to @p stream; the arguments
+   * are those of XMLOutputStream.
+   */
+  SedXMLOutputStream(std::ostream& stream,
+                     const std::string& encoding = "UTF-8",
+                     bool writeXMLDecl = true,
+                     const std::string& programName = "",
+                     const std::string& programVersion = "");
+
+
+  /**
+   * Writes well-formed markup unchanged, laid out like a child element.
+   *
+   * @param markup the markup, with all the namespaces it uses declared.
+   * @param indentLines if @c true, each line of @p markup is laid out like
+   * a child element of its own.
+   */
+  void writeRaw(const std::string& markup, bool indentLines = false);
+
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedXMLOutputStream_h */
@@ -39,7 +39,7 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 
 
 static
-const char* SEDML_MAPPING_TYPE_STRINGS[] =
+const char* const SEDML_MAPPING_TYPE_STRINGS[] =
 {
   "time"
 , "experimentalCondition"
@@ -76,7 +76,7 @@ LIBSEDML_EXTERN
 MappingType_t
 MappingType_fromString(const char* code)
 {
-  static int size = sizeof(SEDML_MAPPING_TYPE_STRINGS)/sizeof(SEDML_MAPPING_TYPE_STRINGS[0]);
+  static const int size = sizeof(SEDML_MAPPING_TYPE_STRINGS)/sizeof(SEDML_MAPPING_TYPE_STRINGS[0]);
   std::string type(code);
 
   for (int i = 0; i < size; i++)
@@ -126,7 +126,7 @@ MappingType_isValidString(const char* code)
 
 
 static
-const char* SEDML_AXIS_TYPE_STRINGS[] =
+const char* const SEDML_AXIS_TYPE_STRINGS[] =
 {
   "linear"
 , "log10"
@@ -161,7 +161,7 @@ LIBSEDML_EXTERN
 AxisType_t
 AxisType_fromString(const char* code)
 {
-  static int size =
+  static const int size =
     sizeof(SEDML_AXIS_TYPE_STRINGS)/sizeof(SEDML_AXIS_TYPE_STRINGS[0]);
   std::string type(code);
 
@@ -212,7 +212,7 @@ AxisType_isValidString(const char* code)
 
 
 static
-const char* SEDML_LINE_TYPE_STRINGS[] =
+const char* const SEDML_LINE_TYPE_STRINGS[] =
 {
   "none"
 , "solid"
@@ -251,7 +251,7 @@ LIBSEDML_EXTERN
 LineType_t
 LineType_fromString(const char* code)
 {
-  static int size =
+  static const int size =
     sizeof(SEDML_LINE_TYPE_STRINGS)/sizeof(SEDML_LINE_TYPE_STRINGS[0]);
   std::string type(code);
 
@@ -302,7 +302,7 @@ LineType_isValidString(const char* code)
 
 
 static
-const char* SEDML_MARKER_TYPE_STRINGS[] =
+const char* const SEDML_MARKER_TYPE_STRINGS[] =
 {
   "none"
 , "square"
@@ -349,7 +349,7 @@ LIBSEDML_EXTERN
 MarkerType_t
 MarkerType_fromString(const char* code)
 {
-  static int size =
+  static const int size =
     sizeof(SEDML_MARKER_TYPE_STRINGS)/sizeof(SEDML_MARKER_TYPE_STRINGS[0]);
   std::string type(code);
 
@@ -400,7 +400,7 @@ MarkerType_isValidString(const char* code)
 
 
 static
-const char* SEDML_CURVE_TYPE_STRINGS[] =
+const char* const SEDML_CURVE_TYPE_STRINGS[] =
 {
   "points"
 , "bar"
@@ -439,7 +439,7 @@ LIBSEDML_EXTERN
 CurveType_t
 CurveType_fromString(const char* code)
 {
-  static int size =
+  static const int size =
     sizeof(SEDML_CURVE_TYPE_STRINGS)/sizeof(SEDML_CURVE_TYPE_STRINGS[0]);
   std::string type(code);
 
@@ -490,7 +490,7 @@ CurveType_isValidString(const char* code)
 
 
 static
-const char* SEDML_SURFACE_TYPE_STRINGS[] =
+const char* const SEDML_SURFACE_TYPE_STRINGS[] =
 {
   "parametricCurve"
 , "surfaceMesh"
@@ -531,7 +531,7 @@ LIBSEDML_EXTERN
 SurfaceType_t
 SurfaceType_fromString(const char* code)
 {
-  static int size = sizeof(SEDML_SURFACE_TYPE_STRINGS)/sizeof(SEDML_SURFACE_TYPE_STRINGS[0]);
+  static const int size = sizeof(SEDML_SURFACE_TYPE_STRINGS)/sizeof(SEDML_SURFACE_TYPE_STRINGS[0]);
   std::string type(code);
 
   for (int i = 0; i < size; i++)
@@ -581,7 +581,7 @@ SurfaceType_isValidString(const char* code)
 
 
 static
-const char* SEDML_EXPERIMENT_TYPE_STRINGS[] =
+const char* const SEDML_EXPERIMENT_TYPE_STRINGS[] =
 {
   "steadyState"
 , "timeCourse"
@@ -617,7 +617,7 @@ LIBSEDML_EXTERN
 ExperimentType_t
 ExperimentType_fromString(const char* code)
 {
-  static int size = sizeof(SEDML_EXPERIMENT_TYPE_STRINGS)/sizeof(SEDML_EXPERIMENT_TYPE_STRINGS[0]);
+  static const int size = sizeof(SEDML_EXPERIMENT_TYPE_STRINGS)/sizeof(SEDML_EXPERIMENT_TYPE_STRINGS[0]);
   std::string type(code);
 
   for (int i = 0; i < size; i++)
@@ -667,7 +667,7 @@ ExperimentType_isValidString(const char* code)
 
 
 static
-const char* SEDML_SCALE_TYPE_STRINGS[] =
+const char* const SEDML_SCALE_TYPE_STRINGS[] =
 {
   "linear"
 , "log"
@@ -704,7 +704,7 @@ LIBSEDML_EXTERN
 ScaleType_t
 ScaleType_fromString(const char* code)
 {
-  static int size =
+  static const int size =
     sizeof(SEDML_SCALE_TYPE_STRINGS)/sizeof(SEDML_SCALE_TYPE_STRINGS[0]);
   std::string type(code);
 
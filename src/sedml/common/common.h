@@ -116,5 +116,6 @@ static const int SEDML_INT_MIN = -2147483647 - 1;
 #include <sbml/util/memory.h>
 #include <sbml/util/util.h>
 #include <sedml/common/SedOperationReturnValues.h>
+#include <sedml/common/SedNumberFormat.h>
 
 #endif  /* LIBSEDML_COMMON_H */
@@ -45,7 +45,8 @@
 
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
-std::map<int, std::string> g_kisaomap = {
+// read concurrently by every reader; never modified after initialization
+extern const std::map<int, std::string> g_kisaomap = {
    {654, "amount rate"},
    {386, "scaled preconditioned generalized minimal residual method"},
    {810, "Reduced eigenvalue matrix"},
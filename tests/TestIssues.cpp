@@ -38,11 +38,17 @@
  */
 
 #include "catch.hpp"
+#include <atomic>
+#include <cmath>
+#include <cstdio>
 #include <limits>
 
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <string>
 #include <sstream>
+#include <thread>
 
 #include <sbml/common/libsbml-version.h>
 #include <sedml/common/libsedml-version.h>
@@ -974,3 +980,1866 @@ TEST_CASE("Redirect getLog for L1v4, 3d", "[sedml]")
     CHECK(curve->getLogZ() == true);
 }
 
+
+TEST_CASE("Lookup by id through the SedListOf id index", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedListOfDataGenerators* list = doc.getListOfDataGenerators();
+    list->setIdIndexThreshold(0);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        std::stringstream str;
+        str << "dg" << i;
+        doc.createDataGenerator()->setId(str.str());
+    }
+
+    REQUIRE(doc.getDataGenerator("dg42") == list->get(42));
+    REQUIRE(doc.getDataGenerator("missing") == NULL);
+
+    list->get(42)->setId("renamed");
+    CHECK(doc.getDataGenerator("dg42") == NULL);
+    CHECK(doc.getDataGenerator("renamed") == list->get(42));
+
+    SedDataGenerator* removed = list->remove("renamed");
+    REQUIRE(removed != NULL);
+    CHECK(doc.getDataGenerator("renamed") == NULL);
+    CHECK(removed->getParentSedObject() == NULL);
+    removed->setId("dg43");
+    CHECK(doc.getDataGenerator("dg43") == list->get(42));
+    delete removed;
+
+    list->insert(0, list->get(10));
+    CHECK(doc.getDataGenerator("dg10") == list->get(0));
+
+    SedListOfDataGenerators copy(*list);
+    CHECK(copy.getIdIndexThreshold() == 0);
+    CHECK(copy.get("dg99") == copy.get(99));
+
+    list->clear();
+    CHECK(doc.getDataGenerator("dg0") == NULL);
+}
+
+TEST_CASE("Lookup of nested elements through the document index", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedDataGenerator* dg = doc.createDataGenerator();
+    dg->setId("dg");
+    SedVariable* var = dg->createVariable();
+    var->setId("var");
+    var->setMetaId("meta_var");
+
+    REQUIRE(doc.getElementBySId("var") == var);
+    REQUIRE(doc.getElementByMetaId("meta_var") == var);
+    REQUIRE(dg->getElementByMetaId("meta_var") == var);
+    REQUIRE(doc.getElementBySId("missing") == NULL);
+
+    var->setId("renamed");
+    var->setMetaId("meta_renamed");
+    CHECK(doc.getElementBySId("var") == NULL);
+    CHECK(doc.getElementBySId("renamed") == var);
+    CHECK(doc.getElementByMetaId("meta_var") == NULL);
+    CHECK(doc.getElementByMetaId("meta_renamed") == var);
+
+    SedDataGenerator* added = new SedDataGenerator(1, 4);
+    added->setId("added");
+    added->createVariable()->setId("added_var");
+    doc.getListOfDataGenerators()->appendAndOwn(added);
+    CHECK(doc.getElementBySId("added_var") == added->getVariable(0));
+
+    REQUIRE(var->removeFromParentAndDelete() == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(doc.getElementBySId("renamed") == NULL);
+    CHECK(doc.getElementByMetaId("meta_renamed") == NULL);
+
+    SedDataGenerator* removed = doc.removeDataGenerator("added");
+    REQUIRE(removed != NULL);
+    CHECK(doc.getElementBySId("added") == NULL);
+    CHECK(doc.getElementBySId("added_var") == NULL);
+    delete removed;
+
+    // the first of two elements sharing an id wins
+    doc.createDataGenerator()->setId("dup");
+    SedDataGenerator* first = doc.getDataGenerator("dup");
+    dg->createVariable()->setId("dup");
+    CHECK(doc.getElementBySId("dup") == dg->getVariable(0));
+    dg->getVariable(0)->unsetId();
+    CHECK(doc.getElementBySId("dup") == first);
+
+    // the entry of a key held several times follows its holders
+    SedModel* earlier = doc.createModel();
+    earlier->setId("dup");
+    CHECK(doc.getElementBySId("dup") == earlier);
+    dg->getVariable(0)->setId("dup");
+    CHECK(doc.getElementBySId("dup") == earlier);
+    earlier->setId("not_dup");
+    CHECK(doc.getElementBySId("dup") == dg->getVariable(0));
+    dg->createParameter()->setId("dup");
+    REQUIRE(dg->getVariable(0)->removeFromParentAndDelete() ==
+            LIBSEDML_OPERATION_SUCCESS);
+    CHECK(doc.getElementBySId("dup") == dg->getParameter(0));
+    delete dg->removeParameter(0);
+    CHECK(doc.getElementBySId("dup") == first);
+    first->unsetId();
+    CHECK(doc.getElementBySId("dup") == NULL);
+
+    // assignment copies content, not the place in a document
+    SedDocument* other = new SedDocument(1, 4);
+    SedModel* source = other->createModel();
+    source->setId("m_other");
+    SedModel copy(1, 4);
+    copy = *source;
+    CHECK(copy.getSedDocument() == NULL);
+    CHECK(copy.getParentSedObject() == NULL);
+    SedModel* target = doc.createModel();
+    target->setId("m_doc");
+    *target = *source;
+    CHECK(target->getSedDocument() == &doc);
+    CHECK(doc.getElementBySId("m_doc") == NULL);
+    CHECK(doc.getElementBySId("m_other") == target);
+    CHECK(other->getElementBySId("m_other") == source);
+    delete other;
+    CHECK(copy.getId() == "m_other");
+}
+
+TEST_CASE("Reverse references through SedReferenceGraph", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedModel* model = doc.createModel();
+    model->setId("model");
+    SedUniformTimeCourse* sim = doc.createUniformTimeCourse();
+    sim->setId("sim");
+    SedTask* task = doc.createTask();
+    task->setId("task");
+    task->setModelReference("model");
+    task->setSimulationReference("sim");
+
+    SedDataGenerator* dg = doc.createDataGenerator();
+    dg->setId("dg");
+    SedVariable* var = dg->createVariable();
+    var->setId("time");
+    var->setTaskReference("task");
+    dg->setMath(SBML_parseL3Formula("time"));
+
+    SedDataGenerator* other = doc.createDataGenerator();
+    other->setId("other");
+    SedVariable* otherVar = other->createVariable();
+    otherVar->setId("time");
+    otherVar->setTaskReference("missing");
+    other->setMath(SBML_parseL3Formula("time"));
+
+    SedPlot2D* plot = doc.createPlot2D();
+    plot->setId("plot");
+    SedCurve* curve = plot->createCurve();
+    curve->setId("curve");
+    curve->setXDataReference("dg");
+    curve->setYDataReference("dg");
+
+    SedReferenceGraph graph(&doc);
+    CHECK(graph.getNumReferences() == 8);
+    CHECK(graph.getReferencesFrom(curve).size() == 2);
+    CHECK(graph.getReferencesTo(dg).size() == 2);
+    CHECK(graph.getReferencesTo(model).size() == 1);
+
+    // math resolves to the variable of its own data generator
+    REQUIRE(graph.getReferencesTo(otherVar).size() == 1);
+    CHECK(graph.getReferencesTo(otherVar)[0]->referrer == other);
+
+    std::vector<const SedBase*> users =
+        graph.getReferrers(task, SEDML_DATAGENERATOR);
+    REQUIRE(users.size() == 1);
+    CHECK(users[0] == dg);
+
+    SedReferenceGraph::ReferenceList dangling =
+        graph.getUnresolvedReferences();
+    REQUIRE(dangling.size() == 1);
+    CHECK(dangling[0]->referrer == otherVar);
+    CHECK(dangling[0]->attribute == "taskReference");
+
+    std::vector<const SedBase*> dependents = graph.getDependents(model);
+    CHECK(std::find(dependents.begin(), dependents.end(), task) != dependents.end());
+    CHECK(std::find(dependents.begin(), dependents.end(), dg) != dependents.end());
+    CHECK(std::find(dependents.begin(), dependents.end(), plot) != dependents.end());
+    CHECK(std::find(dependents.begin(), dependents.end(), other) == dependents.end());
+}
+
+TEST_CASE("Effective styles are cached and cycles reported", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedStyle* base = doc.createStyle();
+    base->setId("base");
+    SedLine* line = base->createLineStyle();
+    line->setColor("ff0000");
+    line->setThickness(2.0);
+
+    SedStyle* derived = doc.createStyle();
+    derived->setId("derived");
+    derived->setBaseStyle("base");
+    derived->createLineStyle()->setColor("0000ff");
+
+    const SedStyle* resolved = doc.getResolvedStyle("derived");
+    REQUIRE(resolved != NULL);
+    CHECK(resolved->getLineStyle()->getColor() == "0000ff");
+    CHECK(resolved->getLineStyle()->getThickness() == 2.0);
+    CHECK(doc.getResolvedStyle("derived") == resolved);
+    CHECK(doc.getEffectiveStyle("derived").getLineStyle()->getThickness() == 2.0);
+
+    line->setThickness(3.0);
+    resolved = doc.getResolvedStyle("derived");
+    REQUIRE(resolved != NULL);
+    CHECK(resolved->getLineStyle()->getThickness() == 3.0);
+
+    SedStyle* first = doc.createStyle();
+    first->setId("first");
+    first->setBaseStyle("second");
+    SedStyle* second = doc.createStyle();
+    second->setId("second");
+    second->setBaseStyle("first");
+
+    // each style on the cycle is reported once, even when it was cached
+    // while resolving the other
+    unsigned int numErrors = doc.getNumErrors();
+    CHECK(doc.getResolvedStyle("first") == NULL);
+    CHECK(doc.getNumErrors() == numErrors + 1);
+    CHECK(doc.getResolvedStyle("second") == NULL);
+    CHECK(doc.getNumErrors() == numErrors + 2);
+    CHECK(doc.getResolvedStyle("second") == NULL);
+    CHECK(doc.getNumErrors() == numErrors + 2);
+    CHECK(doc.getError(numErrors)->getErrorId() == SedmlStyleBaseStyleMustNotBeCircular);
+    CHECK(doc.getError(numErrors + 1)->getErrorId() == SedmlStyleBaseStyleMustNotBeCircular);
+
+    second->unsetBaseStyle();
+    CHECK(doc.getResolvedStyle("first") != NULL);
+
+    // a style based on one on a cycle is cyclic in either order
+    for (int order = 0; order < 2; ++order)
+    {
+      SedDocument cyclic(1, 4);
+      SedStyle* a = cyclic.createStyle();
+      a->setId("A");
+      a->setBaseStyle("B");
+      SedStyle* b = cyclic.createStyle();
+      b->setId("B");
+      b->setBaseStyle("A");
+      SedStyle* c = cyclic.createStyle();
+      c->setId("C");
+      c->setBaseStyle("A");
+
+      const char* ids[] = { "A", "C" };
+      const unsigned int errors = cyclic.getNumErrors();
+      CHECK(cyclic.getResolvedStyle(ids[order]) == NULL);
+      CHECK(cyclic.getResolvedStyle(ids[1 - order]) == NULL);
+      CHECK(cyclic.getNumErrors() == errors + 2);
+      CHECK(cyclic.getResolvedStyle("C") == NULL);
+      CHECK(cyclic.getNumErrors() == errors + 2);
+    }
+}
+
+class CountingHandler : public SedReaderHandler
+{
+public:
+    CountingHandler(int stopAfter = -1)
+        : numDataGenerators(0), numUnknown(0), depth(0), stopAfter(stopAfter)
+    {
+    }
+
+    virtual bool startElement(int type, const std::string& name,
+                              const XMLAttributes& attributes)
+    {
+        ++depth;
+        if (type == SEDML_DATAGENERATOR)
+        {
+            ++numDataGenerators;
+        }
+        else if (type == SEDML_VARIABLE)
+        {
+            taskReferences.push_back(attributes.getValue("taskReference"));
+        }
+        else if (type == SEDML_UNKNOWN)
+        {
+            ++numUnknown;
+        }
+        return numDataGenerators != stopAfter;
+    }
+
+    virtual bool endElement(int type, const std::string& name)
+    {
+        --depth;
+        return true;
+    }
+
+    int numDataGenerators;
+    int numUnknown;
+    int depth;
+    int stopAfter;
+    std::vector<std::string> taskReferences;
+};
+
+TEST_CASE("Event-driven parsing through SedReaderHandler", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    for (int i = 0; i < 3; ++i)
+    {
+        std::stringstream str;
+        str << "dg" << i;
+        SedDataGenerator* dg = doc.createDataGenerator();
+        dg->setId(str.str());
+        SedVariable* var = dg->createVariable();
+        var->setId("v");
+        var->setTaskReference("task" + str.str());
+        var->setSymbol("urn:sedml:symbol:time");
+        dg->setMath(SBML_parseL3Formula("v"));
+    }
+    SedWriter sw;
+    std::string xml = sw.writeSedMLToStdString(&doc);
+
+    SedReader reader;
+    CountingHandler handler;
+    REQUIRE(reader.parseSedMLFromString(xml, handler) == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(handler.numDataGenerators == 3);
+    CHECK(handler.numUnknown == 3);
+    CHECK(handler.depth == 0);
+    REQUIRE(handler.taskReferences.size() == 3);
+    CHECK(handler.taskReferences[2] == "taskdg2");
+
+    CountingHandler stopping(2);
+    REQUIRE(reader.parseSedMLFromString(xml, stopping) == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(stopping.numDataGenerators == 2);
+    CHECK(stopping.taskReferences.size() == 1);
+
+    SedErrorLog log;
+    CountingHandler none;
+    CHECK(reader.parseSedML("does-not-exist.sedml", none, &log) == LIBSEDML_OPERATION_FAILED);
+    CHECK(log.getNumErrors() == 1);
+}
+
+TEST_CASE("Selective loading through the SedReader load mask", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    doc.setNotes("<p xmlns=\"http://www.w3.org/1999/xhtml\">document notes</p>");
+    SedModel* model = doc.createModel();
+    model->setId("m1");
+    model->setLanguage("urn:sedml:language:sbml");
+    model->setSource("model.xml");
+    model->setNotes("<p xmlns=\"http://www.w3.org/1999/xhtml\">model notes</p>");
+    SedAddXML* add = model->createAddXML();
+    add->setTarget("/sbml:sbml/sbml:model");
+    add->setNewXML(XMLNode::convertStringToXMLNode("<parameter id=\"p\"/>"));
+    SedDataGenerator* dg = doc.createDataGenerator();
+    dg->setId("dg1");
+    dg->setMath(SBML_parseL3Formula("1"));
+    SedPlot2D* plot = doc.createPlot2D();
+    plot->setId("plot1");
+    SedWriter sw;
+    std::string xml = sw.writeSedMLToStdString(&doc);
+
+    SedReader reader;
+    CHECK(reader.getLoadMask() == SEDML_LOAD_ALL);
+    SedDocument* full = reader.readSedMLFromString(xml);
+    CHECK(full->getLoadMask() == SEDML_LOAD_ALL);
+    CHECK(full->getNumDataGenerators() == 1);
+    CHECK(static_cast<SedAddXML*>(full->getModel(0)->getChange(0))->isSetNewXML());
+    CHECK(full->isSetNotes());
+    delete full;
+
+    reader.setLoadMask(SEDML_LOAD_MODELS);
+    SedDocument* partial = reader.readSedMLFromString(xml);
+    CHECK(partial->getLoadMask() == SEDML_LOAD_MODELS);
+    CHECK(partial->getNumErrors(LIBSEDML_SEV_ERROR) == 0);
+    REQUIRE(partial->getNumModels() == 1);
+    CHECK(partial->getNumDataGenerators() == 0);
+    CHECK(partial->getNumOutputs() == 0);
+    CHECK(partial->isSetNotes() == false);
+    CHECK(partial->getModel(0)->isSetNotes() == false);
+    REQUIRE(partial->getModel(0)->getNumChanges() == 1);
+    CHECK(static_cast<SedAddXML*>(partial->getModel(0)->getChange(0))->isSetNewXML() == false);
+    delete partial;
+}
+
+TEST_CASE("Notes, annotations and newXML are parsed on first access", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedModel* model = doc.createModel();
+    model->setId("m1");
+    model->setLanguage("urn:sedml:language:sbml");
+    model->setSource("model.xml");
+    model->setNotes("<p xmlns=\"http://www.w3.org/1999/xhtml\">model notes</p>");
+    model->setAnnotation("<annotation><info xmlns=\"http://example.org/\" value=\"1\"/></annotation>");
+    SedChangeXML* change = model->createChangeXML();
+    change->setTarget("/sbml:sbml/sbml:model");
+    change->setNewXML(XMLNode::convertStringToXMLNode("<parameter id=\"p\" value=\"2\"/>"));
+    SedWriter sw;
+    std::string xml = sw.writeSedMLToStdString(&doc);
+
+    SedDocument* read = readSedMLFromString(xml.c_str());
+    REQUIRE(read->getNumErrors(LIBSEDML_SEV_ERROR) == 0);
+    SedModel* m = read->getModel(0);
+    CHECK(m->isSetNotes());
+    CHECK(m->isSetAnnotation());
+    CHECK(m->getNotesString().find("model notes") != std::string::npos);
+
+    // written back while untouched
+    std::string roundTrip = sw.writeSedMLToStdString(read);
+    CHECK(roundTrip.find("model notes") != std::string::npos);
+    CHECK(roundTrip.find("http://example.org/") != std::string::npos);
+    CHECK(roundTrip.find("parameter") != std::string::npos);
+
+    SedChangeXML* readChange = static_cast<SedChangeXML*>(m->getChange(0));
+    REQUIRE(readChange->isSetNewXML());
+    REQUIRE(readChange->getNewXML() != NULL);
+    CHECK(readChange->getNewXML()->getName() == "parameter");
+    CHECK(readChange->getNewXML()->getAttrValue("value") == "2");
+
+    REQUIRE(m->getAnnotation() != NULL);
+    CHECK(m->getAnnotation()->getNumChildren() == 1);
+    CHECK(m->getAnnotation()->getChild(0).getName() == "info");
+
+    SedModel copy(*m);
+    REQUIRE(copy.getNotes() != NULL);
+    CHECK(copy.getNotes()->getName() == "notes");
+
+    m->unsetNotes();
+    CHECK(m->isSetNotes() == false);
+    CHECK(sw.writeSedMLToStdString(read).find("model notes") == std::string::npos);
+    delete read;
+
+    // prefixes declared on an enclosing element stay bound
+    std::string prefixed = xml;
+    prefixed.replace(prefixed.find("<listOfModels"), 13,
+      "<listOfModels xmlns:ex=\"http://example.org/ex\"");
+    prefixed.replace(prefixed.find("<info "), 6, "<ex:info ");
+    read = readSedMLFromString(prefixed.c_str());
+    REQUIRE(read->getNumErrors(LIBSEDML_SEV_ERROR) == 0);
+    roundTrip = sw.writeSedMLToStdString(read);
+    CHECK(roundTrip.find("xmlns:ex=\"http://example.org/ex\"") !=
+      std::string::npos);
+    m = read->getModel(0);
+    // untouched markup is written as it was kept, not serialized again
+    CHECK(roundTrip.find(m->getAnnotationString()) != std::string::npos);
+    REQUIRE(m->getAnnotation() != NULL);
+    CHECK(m->getAnnotation()->getChild(0).getPrefix() == "ex");
+    CHECK(m->getAnnotation()->getChild(0).getURI() == "http://example.org/ex");
+    delete read;
+}
+
+TEST_CASE("Batch reading returns documents in input order", "[sedml]")
+{
+    std::vector<std::string> files;
+    files.push_back(getTestFile("/test-data/noble_1962_local.sedml"));
+    files.push_back(getTestFile("/test-data/sort_curves.sedml"));
+    files.push_back(getTestFile("/test-data/does_not_exist.sedml"));
+    files.push_back(getTestFile("/test-data/issue_63.sedml"));
+    files.push_back(getTestFile("/test-data/sort_subtasks.sedml"));
+
+    SedReader reader;
+    std::vector<SedDocument*> docs = reader.readSedMLBatch(files, 3);
+    REQUIRE(docs.size() == files.size());
+
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        REQUIRE(docs[i] != NULL);
+        SedDocument* serial = reader.readSedMLFromFile(files[i]);
+        CHECK(docs[i]->getNumErrors() == serial->getNumErrors());
+        CHECK(docs[i]->getNumModels() == serial->getNumModels());
+        CHECK(docs[i]->getNumTasks() == serial->getNumTasks());
+        CHECK(docs[i]->getNumOutputs() == serial->getNumOutputs());
+        delete serial;
+    }
+    CHECK(docs[2]->getNumErrors() > 0);
+
+    for (size_t i = 0; i < docs.size(); ++i)
+    {
+        delete docs[i];
+    }
+}
+
+TEST_CASE("Reading from mapped files and caller-owned buffers", "[sedml]")
+{
+    std::string fileName = getTestFile("/test-data/sort_curves.sedml");
+    SedReader reader;
+    SedDocument* fromFile = reader.readSedMLFromFile(fileName);
+    REQUIRE(fromFile->getNumErrors(LIBSEDML_SEV_ERROR) == 0);
+
+    std::ifstream in(fileName.c_str());
+    std::stringstream contents;
+    contents << in.rdbuf();
+    const std::string xml = contents.str();
+
+    SedDocument* fromBuffer = reader.readSedMLFromBuffer(xml.c_str());
+    CHECK(fromBuffer->getNumErrors() == fromFile->getNumErrors());
+    CHECK(fromBuffer->getNumOutputs() == fromFile->getNumOutputs());
+    CHECK(fromBuffer->getNumDataGenerators() == fromFile->getNumDataGenerators());
+
+    SedWriter sw;
+    CHECK(sw.writeSedMLToStdString(fromBuffer) == sw.writeSedMLToStdString(fromFile));
+
+    SedDocument* missing = reader.readSedMLFromFile(getTestFile("/test-data/does_not_exist.sedml"));
+    CHECK(missing->getNumErrors() == 1);
+
+    delete missing;
+    delete fromBuffer;
+    delete fromFile;
+}
+
+TEST_CASE("Vector range values round-trip exactly in bulk", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedRepeatedTask* task = doc.createRepeatedTask();
+    task->setId("task1");
+    SedVectorRange* range = task->createVectorRange();
+    range->setId("range1");
+
+    std::vector<double> values;
+    values.push_back(0.1);
+    values.push_back(1e-300);
+    values.push_back(0.30000000000000004);
+    values.push_back(-2.5e17);
+    values.push_back(1.0 / 3.0);
+    for (int i = 0; i < 20000; ++i)
+    {
+        values.push_back(i * 0.001 - 7.0);
+    }
+
+    CHECK(range->setValues(NULL, 1) == LIBSEDML_OPERATION_FAILED);
+    CHECK(range->setValues(&values[0], values.size()) == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(range->getNumValues() == values.size());
+    CHECK(range->getValuesData() != &values[0]);
+
+    SedWriter sw;
+    const std::string xml = sw.writeSedMLToStdString(&doc);
+    CHECK(xml.find("<value> 0.30000000000000004 </value>") != std::string::npos);
+
+    SedDocument* read = readSedMLFromString(xml.c_str());
+    REQUIRE(read->getNumErrors(LIBSEDML_SEV_ERROR) == 0);
+    SedRepeatedTask* readTask = static_cast<SedRepeatedTask*>(read->getTask("task1"));
+    REQUIRE(readTask != NULL);
+    SedVectorRange* readRange = static_cast<SedVectorRange*>(readTask->getRange("range1"));
+    REQUIRE(readRange != NULL);
+    REQUIRE(readRange->getNumValues() == values.size());
+
+    const double* data = readRange->getValuesData();
+    bool identical = true;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        identical = identical && data[i] == values[i];
+    }
+    CHECK(identical);
+    CHECK(sw.writeSedMLToStdString(read) == xml);
+
+    double parsed = 0;
+    CHECK(SedNumberFormat::parseDouble(" -INF ", parsed));
+    CHECK(parsed == -std::numeric_limits<double>::infinity());
+    CHECK(SedNumberFormat::formatDouble(0.5) == "0.5");
+    CHECK(!SedNumberFormat::parseDouble("abc", parsed));
+
+    delete read;
+}
+
+class NamespacedModel : public SedModel
+{
+public:
+    NamespacedModel() : SedModel(1, 4) {}
+    using SedBase::setElementNamespace;
+    using SedBase::getElementNamespace;
+};
+
+TEST_CASE("Objects share their SedNamespaces until modified", "[sedml]")
+{
+    SedModel first(1, 4);
+    SedModel second(1, 4);
+    REQUIRE(first.getElementNamespaces() != NULL);
+    CHECK(first.getElementNamespaces() == second.getElementNamespaces());
+
+    SedModel copy(first);
+    CHECK(copy.getElementNamespaces() == first.getElementNamespaces());
+
+    // modifying the namespaces of one object leaves the others alone
+    first.getNamespaces()->add("http://www.sbml.org/sbml/level3/version1/core", "sbml");
+    CHECK(first.getElementNamespaces() != second.getElementNamespaces());
+    CHECK(first.getNamespaces()->hasPrefix("sbml"));
+    CHECK(!second.getNamespaces()->hasPrefix("sbml"));
+    CHECK(!copy.getNamespaces()->hasPrefix("sbml"));
+
+    // custom declarations on elements are kept
+    std::string fileName = getTestFile("/test-data/issue_77.sedml");
+    SedDocument* doc = readSedMLFromFile(fileName.c_str());
+    REQUIRE(doc->getNumErrors(LIBSEDML_SEV_ERROR) == 0);
+    SedVariable* var = doc->getDataGenerator("xDataGenerator1_1")->getVariable("xVariable1_1");
+    REQUIRE(var != NULL);
+    SedVariable* varCopy = var->clone();
+    REQUIRE(varCopy->getElementNamespaces() != NULL);
+    CHECK(var->getElementNamespaces()->containsUri("http://www.cellml.org/cellml/1.0#"));
+
+    SedDocument* docCopy = doc->clone();
+    docCopy->getNamespaces()->add("http://example.org/ns", "ex");
+    CHECK(!doc->getNamespaces()->hasPrefix("ex"));
+
+    // the const accessor hands out the shared instance read-only
+    const SedModel& constSecond = second;
+    const SedNamespaces* sharedNs = constSecond.getSedNamespaces();
+    CHECK(sharedNs == SedModel(1, 4).getSedNamespaces());
+
+    // other element namespaces are interned for as long as objects use them
+    NamespacedModel* custom = new NamespacedModel();
+    custom->setElementNamespace("http://example.org/custom");
+    NamespacedModel customCopy(*custom);
+    CHECK(&customCopy.getElementNamespace() == &custom->getElementNamespace());
+    delete custom;
+    for (int i = 0; i < 100; ++i)
+    {
+        NamespacedModel other;
+        std::ostringstream uri;
+        uri << "http://example.org/other" << i;
+        other.setElementNamespace(uri.str());
+    }
+    CHECK(customCopy.getElementNamespace() == "http://example.org/custom");
+
+    delete docCopy;
+    delete varCopy;
+    delete doc;
+}
+
+TEST_CASE("Rarely used SedBase fields are kept apart", "[sedml]")
+{
+    SedVariable plain(1, 4);
+    CHECK(!plain.isSetMetaId());
+    CHECK(!plain.isSetNotes());
+    CHECK(!plain.isSetAnnotation());
+    CHECK(!plain.isSetUserData());
+    CHECK(plain.getNotes() == NULL);
+    CHECK(plain.getAnnotationString().empty());
+
+    SedVariable var(1, 4);
+    var.setId("var1");
+    REQUIRE(var.setMetaId("meta1") == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(var.setNotes("<notes><p xmlns=\"http://www.w3.org/1999/xhtml\">text</p></notes>") == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(var.setAnnotation("<annotation><ex:info xmlns:ex=\"http://example.org/\"/></annotation>") == LIBSEDML_OPERATION_SUCCESS);
+    int marker = 0;
+    REQUIRE(var.setUserData(&marker) == LIBSEDML_OPERATION_SUCCESS);
+
+    SedVariable copy(var);
+    CHECK(copy.getMetaId() == "meta1");
+    CHECK(copy.isSetNotes());
+    CHECK(copy.isSetAnnotation());
+    CHECK(copy.getUserData() == &marker);
+
+    plain = var;
+    CHECK(plain.getMetaId() == "meta1");
+    CHECK(plain.getNotesString() == var.getNotesString());
+
+    CHECK(var.unsetMetaId() == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(var.unsetNotes() == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(var.unsetAnnotation() == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(var.unsetUserData() == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(!var.isSetMetaId());
+    CHECK(!var.isSetNotes());
+    CHECK(!var.isSetAnnotation());
+    CHECK(!var.isSetUserData());
+    CHECK(copy.isSetNotes());
+
+    // notes and annotations read from a file are still written back
+    std::string fileName = getTestFile("/test-data/issue_77.sedml");
+    SedDocument* doc = readSedMLFromFile(fileName.c_str());
+    REQUIRE(doc->getNumErrors(LIBSEDML_SEV_ERROR) == 0);
+    SedWriter sw;
+    std::string xml = sw.writeSedMLToStdString(doc);
+    SedDocument* read = readSedMLFromString(xml.c_str());
+    CHECK(sw.writeSedMLToStdString(read) == xml);
+
+    delete read;
+    delete doc;
+}
+
+TEST_CASE("Documents can allocate their objects from an arena", "[sedml]")
+{
+    SedReader reader;
+    CHECK(!reader.getArenaAllocation());
+    reader.setArenaAllocation(true);
+
+    std::string fileName = getTestFile("/test-data/issue_77.sedml");
+    SedDocument* doc = reader.readSedMLFromFile(fileName);
+    REQUIRE(doc->getNumErrors(LIBSEDML_SEV_ERROR) == 0);
+    CHECK(doc->getArenaAllocation());
+    REQUIRE(doc->getArena() != NULL);
+    CHECK(doc->getArena()->getNumLiveObjects() > 0);
+
+    SedDataGenerator* generator = doc->getDataGenerator("xDataGenerator1_1");
+    REQUIRE(generator != NULL);
+    CHECK(SedArena::getArena(generator) == doc->getArena());
+
+    SedWriter sw;
+    std::string xml = sw.writeSedMLToStdString(doc);
+
+    SedParameter* param = generator->createParameter();
+    CHECK(SedArena::getArena(param) == doc->getArena());
+
+    // the memory of a deleted object goes to the next one of its size
+    SedArena* docArena = doc->getArena();
+    const size_t live = docArena->getNumLiveObjects();
+    SedVariable* spare = new (docArena) SedVariable(1, 4);
+    const void* spareAddress = spare;
+    delete spare;
+    SedVariable* reused = new (docArena) SedVariable(1, 4);
+    CHECK(static_cast<const void*>(reused) == spareAddress);
+    delete reused;
+    CHECK(docArena->getNumLiveObjects() == live);
+
+    // objects outside of an arena carry nothing to tell where they are
+    SedVariable local(1, 4);
+    CHECK(SedArena::getArena(&local) == NULL);
+
+    // objects removed from the document outlive it
+    SedDataGenerator* removed = doc->removeDataGenerator("xDataGenerator1_1");
+    REQUIRE(removed == generator);
+    delete doc;
+
+    CHECK(removed->getId() == "xDataGenerator1_1");
+    CHECK(removed->getVariable("xVariable1_1") != NULL);
+    SedArena* arena = SedArena::getArena(removed);
+    REQUIRE(arena != NULL);
+    CHECK(arena->getNumLiveObjects() ==
+      1 + removed->getNumVariables() + removed->getNumParameters());
+    SedDataGenerator* copy = removed->clone();
+    CHECK(SedArena::getArena(copy) == NULL);
+    delete removed;
+    CHECK(copy->getNumVariables() > 0);
+    delete copy;
+
+    // documents read without the arena are written out the same way
+    reader.setArenaAllocation(false);
+    SedDocument* plain = reader.readSedMLFromFile(fileName);
+    CHECK(!plain->getArenaAllocation());
+    CHECK(SedArena::getArena(plain->getDataGenerator(0)) == NULL);
+    CHECK(sw.writeSedMLToStdString(plain) == xml);
+    delete plain;
+}
+
+TEST_CASE("Objects can be moved and added without copying", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedDataGenerator* generator = doc.createDataGenerator();
+    generator->setId("dg1");
+    SedVariable* variable = generator->createVariable();
+    variable->setId("var1");
+
+    // moving detaches the children from the old owner
+    SedDataGenerator moved(std::move(*generator));
+    CHECK(moved.getId() == "dg1");
+    CHECK(moved.getParentSedObject() == NULL);
+    CHECK(moved.getSedDocument() == NULL);
+    REQUIRE(moved.getNumVariables() == 1);
+    CHECK(moved.getVariable(0) == variable);
+    CHECK(variable->getParentSedObject() == moved.getListOfVariables());
+    CHECK(!generator->isSetId());
+    CHECK(generator->getNumVariables() == 0);
+    CHECK(doc.getElementBySId("dg1") == NULL);
+    CHECK(doc.getElementBySId("var1") == NULL);
+
+    // moving into an attached object links the children to its document
+    *generator = std::move(moved);
+    CHECK(generator->getVariable(0) == variable);
+    CHECK(variable->getSedDocument() == &doc);
+    CHECK(doc.getElementBySId("dg1") == generator);
+    CHECK(doc.getElementBySId("var1") == variable);
+    CHECK(moved.getNumVariables() == 0);
+
+    std::unique_ptr<SedVariable> owned(new SedVariable(1, 4));
+    owned->setId("var2");
+    SedVariable* raw = owned.get();
+    CHECK(generator->addVariable(std::move(owned)) == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(owned.get() == NULL);
+    CHECK(generator->getVariable("var2") == raw);
+    CHECK(raw->getSedDocument() == &doc);
+
+    // objects that already belong to another one are refused
+    std::unique_ptr<SedVariable> attached(variable);
+    CHECK(generator->addVariable(std::move(attached)) == LIBSEDML_INVALID_OBJECT);
+    CHECK(generator->getNumVariables() == 2);
+    CHECK(generator->getVariable("var1") == variable);
+    std::unique_ptr<SedBase> item(generator);
+    CHECK(doc.getListOfDataGenerators()->appendAndOwn(std::move(item)) ==
+      LIBSEDML_INVALID_OBJECT);
+    CHECK(doc.getNumDataGenerators() == 1);
+
+    SedDocument movedDoc(std::move(doc));
+    CHECK(movedDoc.getNumDataGenerators() == 1);
+    CHECK(doc.getNumDataGenerators() == 0);
+    CHECK(raw->getSedDocument() == &movedDoc);
+    CHECK(movedDoc.getElementBySId("var2") == raw);
+}
+
+TEST_CASE("Copy-on-write clones share content until modified", "[sedml]")
+{
+    std::string fileName = getTestFile("/test-data/issue_77.sedml");
+    SedDocument* doc = readSedMLFromFile(fileName.c_str());
+    REQUIRE(doc != NULL);
+    SedWriter sw;
+    std::string xml = sw.writeSedMLToStdString(doc);
+
+    doc->setCopyOnWriteClone(true);
+    CHECK(doc->getCopyOnWriteClone());
+    SedDocument* clone = doc->clone();
+    CHECK(!clone->getCopyOnWriteClone());
+    CHECK((clone->getSharedLists() & SEDML_LOAD_TASKS) != 0);
+    CHECK((clone->getSharedLists() & SEDML_LOAD_DATA_GENERATORS) != 0);
+
+    // reading does not copy anything
+    const SedDocument* view = clone;
+    CHECK(view->getNumTasks() == 2);
+    CHECK(view->getTask("task1")->getSedDocument() != clone);
+    CHECK(view->getTask("task1")->getParentSedObject() !=
+      view->getListOfTasks());
+    CHECK(view->getTask("task1")->getParentSedObject()->getSedDocument() ==
+      view->getTask("task1")->getSedDocument());
+    CHECK(view->getElementBySId("xVariable1_1") != NULL);
+    CHECK(sw.writeSedMLToStdString(clone) == xml);
+    CHECK((clone->getSharedLists() & SEDML_LOAD_TASKS) != 0);
+
+    // getting a task to modify gives the clone its own copy of that task
+    // only
+    SedAbstractTask* task = clone->getTask("task1");
+    REQUIRE(task != NULL);
+    task->setName("edited");
+    CHECK(task->getSedDocument() == clone);
+    CHECK(task->getParentSedObject() == view->getListOfTasks());
+    CHECK(view->getTask("repeatedTask")->getParentSedObject() !=
+      view->getListOfTasks());
+    CHECK(clone->getTask("task1") == task);
+    CHECK(view->getTask("task1") == task);
+    CHECK(view->getTask("repeatedTask")->getSedDocument() != clone);
+    CHECK((clone->getSharedLists() & SEDML_LOAD_TASKS) != 0);
+    CHECK((clone->getSharedLists() & SEDML_LOAD_MODELS) != 0);
+    CHECK(!static_cast<const SedDocument*>(doc)->getTask("task1")
+      ->isSetName());
+
+    SedBase* variable = clone->getElementBySId("xVariable1_1");
+    REQUIRE(variable != NULL);
+    CHECK(variable->getSedDocument() == clone);
+    CHECK(variable->getParentSedObject()->getParentSedObject()
+      ->getParentSedObject() == view->getListOfDataGenerators());
+    CHECK((clone->getSharedLists() & SEDML_LOAD_DATA_GENERATORS) == 0);
+
+    // a clone of a clone shares what its original still shares
+    SedDocument* second = clone->clone();
+    CHECK(second->getSharedLists() == clone->getSharedLists());
+    CHECK(second->getTask("task1")->getName() == "edited");
+
+    // modifying the template renews the snapshot for later clones
+    doc->getModel("model")->setName("template");
+    SedDocument* third = doc->clone();
+    CHECK(static_cast<const SedDocument*>(third)->getModel("model")
+      ->getName() == "template");
+    CHECK(!static_cast<const SedDocument*>(clone)->getModel("model")
+      ->isSetName());
+
+    // the renewed snapshot is shared again by the clones after it
+    SedDocument* fourth = doc->clone();
+    CHECK(static_cast<const SedDocument*>(fourth)->getModel("model") ==
+      static_cast<const SedDocument*>(third)->getModel("model"));
+    CHECK(static_cast<const SedDocument*>(fourth)->getModel("model")
+      ->getSedDocument() != fourth);
+    delete fourth;
+
+    doc->setCopyOnWriteClone(false);
+    SedDocument* deep = doc->clone();
+    CHECK(deep->getSharedLists() == 0);
+    CHECK(deep->getModel("model")->getName() == "template");
+
+    // clones keep the content they share alive
+    delete doc;
+    CHECK(static_cast<const SedDocument*>(clone)->getNumModels() == 1);
+    CHECK(sw.writeSedMLToStdString(third).find("template") != std::string::npos);
+
+    delete deep;
+    delete third;
+    delete second;
+    delete clone;
+
+    // clones of one snapshot may be used on different threads; the notes
+    // of the shared elements are parsed before the snapshot is shared
+    SedDocument* source = readSedMLFromString(xml.c_str());
+    REQUIRE(source != NULL);
+    source->getDataGenerator(0)->setNotes(
+      "<p xmlns=\"http://www.w3.org/1999/xhtml\">shared note</p>");
+    doc = readSedMLFromString(sw.writeSedMLToStdString(source).c_str());
+    delete source;
+    REQUIRE(doc != NULL);
+    doc->setCopyOnWriteClone(true);
+
+    std::vector<std::thread> workers;
+    std::vector<int> failures(4, 0);
+    for (size_t t = 0; t < failures.size(); ++t)
+    {
+      workers.push_back(std::thread([&, t]()
+      {
+        for (int i = 0; i < 50; ++i)
+        {
+          SedDocument* variant = doc->clone();
+          const SedDocument* shared = variant;
+          variant->getTask("task1")->setName("variant");
+          if (shared->getDataGenerator(0)->getNotesString().find("shared note") ==
+              std::string::npos ||
+              shared->getElementBySId("xVariable1_1") == NULL ||
+              shared->getTask("task1")->getName() != "variant" ||
+              variant->getSharedLists() == 0)
+          {
+            failures[t]++;
+          }
+          delete variant;
+        }
+      }));
+    }
+    for (size_t t = 0; t < workers.size(); ++t)
+    {
+      workers[t].join();
+    }
+    for (size_t t = 0; t < failures.size(); ++t)
+    {
+      CHECK(failures[t] == 0);
+    }
+    CHECK(!doc->getTask("task1")->isSetName());
+    delete doc;
+}
+
+TEST_CASE("Reference and target attributes are interned", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedDataGenerator* generator = doc.createDataGenerator();
+    SedVariable* v1 = generator->createVariable();
+    v1->setId("v1");
+    v1->setTaskReference("task1");
+    v1->setTarget("/sbml:sbml/sbml:model/sbml:listOfSpecies/sbml:species[@id='S1']");
+    SedVariable* v2 = generator->createVariable();
+    v2->setId("v2");
+    v2->setTaskReference(std::string("task") + "1");
+    v2->setTarget(v1->getTarget());
+
+    // equal values are stored once
+    CHECK(v2->getTaskReference() == "task1");
+    CHECK(&v1->getTaskReference() == &v2->getTaskReference());
+    CHECK(&v1->getTarget() == &v2->getTarget());
+    CHECK(&SedInternedString::lookup("task1") == &v1->getTaskReference());
+    CHECK(&SedInternedString::lookup("unused") != &v1->getTaskReference());
+
+    SedListOfVariables* variables = generator->getListOfVariables();
+    CHECK(variables->getByTaskReference("task1") == v1);
+    CHECK(variables->getByTaskReference("task2") == NULL);
+
+    v2->setTaskReference("task2");
+    CHECK(variables->getByTaskReference("task2") == v2);
+    CHECK(v1->getTaskReference() == "task1");
+
+    v1->unsetTaskReference();
+    CHECK(!v1->isSetTaskReference());
+    CHECK(v1->getTaskReference().empty());
+    CHECK(variables->getByTaskReference("task1") == NULL);
+
+    // strings are interned and looked up from several threads at once
+    std::vector<std::thread> workers;
+    std::vector<int> failures(4, 0);
+    for (size_t t = 0; t < failures.size(); ++t)
+    {
+      workers.push_back(std::thread([&, t]() {
+        for (int i = 0; i < 1000; ++i)
+        {
+          std::ostringstream value;
+          value << "task" << (i % 2 == 0 ? t : 99) << "_" << i;
+          SedInternedString first(value.str());
+          SedInternedString second(value.str());
+          if (first != second ||
+              &SedInternedString::lookup(value.str()) != &first.str())
+          {
+            failures[t]++;
+          }
+        }
+      }));
+    }
+    for (size_t t = 0; t < workers.size(); ++t)
+    {
+      workers[t].join();
+    }
+    CHECK(failures == std::vector<int>(4, 0));
+
+    // copies and documents read from XML share the strings
+    SedDocument* copy = doc.clone();
+    CHECK(&copy->getDataGenerator(0)->getVariable("v2")->getTaskReference() ==
+      &v2->getTaskReference());
+
+    std::string xml = writeSedMLToStdString(&doc);
+    SedDocument* read = readSedMLFromString(xml.c_str());
+    REQUIRE(read->getDataGenerator(0) != NULL);
+    CHECK(&read->getDataGenerator(0)->getVariable("v1")->getTarget() ==
+      &v1->getTarget());
+
+    delete read;
+    delete copy;
+}
+
+TEST_CASE("Memory usage is reported per type", "[sedml]")
+{
+    std::string fileName = getTestFile("/test-data/issue_77.sedml");
+    SedDocument* doc = readSedMLFromFile(fileName.c_str());
+    REQUIRE(doc != NULL);
+
+    SedMemoryUsage usage = doc->getMemoryUsage();
+    CHECK(usage.getNumObjects(SEDML_DOCUMENT) == 1);
+    CHECK(usage.getNumObjects(SEDML_DATAGENERATOR) ==
+      doc->getNumDataGenerators());
+    CHECK(usage.getNumObjects(SEDML_VARIABLE) > 0);
+    CHECK(usage.getBytes(SEDML_DATAGENERATOR) >=
+      doc->getNumDataGenerators() * sizeof(SedDataGenerator));
+    CHECK(usage.getMathBytes() > 0);
+    CHECK(usage.getTotalBytes() > usage.getMathBytes() +
+      usage.getStringBytes());
+    CHECK(usage.toString().find("DataGenerator") != std::string::npos);
+
+    // owned data is added to the type that owns it
+    SedVectorRange* range = new SedVectorRange(1, 4);
+    range->setValues(std::vector<double>(1000, 1.0));
+    SedMemoryUsage rangeUsage = range->getMemoryUsage();
+    CHECK(rangeUsage.getNumObjects(SEDML_RANGE_VECTORRANGE) == 1);
+    CHECK(rangeUsage.getVectorValuesBytes() >= 1000 * sizeof(double));
+    CHECK(rangeUsage.getBytes(SEDML_RANGE_VECTORRANGE) >=
+      sizeof(SedVectorRange) + 1000 * sizeof(double));
+    delete range;
+
+    // lists shared by a copy-on-write clone are not counted twice
+    doc->setCopyOnWriteClone(true);
+    SedDocument* clone = doc->clone();
+    SedMemoryUsage cloneUsage = clone->getMemoryUsage();
+    CHECK(cloneUsage.getNumObjects(SEDML_DATAGENERATOR) == 0);
+    CHECK(cloneUsage.getTotalBytes() < usage.getTotalBytes());
+
+    clone->getDataGenerator(0)->setName("edited");
+    CHECK(clone->getMemoryUsage().getNumObjects(SEDML_DATAGENERATOR) ==
+      doc->getNumDataGenerators());
+
+    delete clone;
+    delete doc;
+}
+
+TEST_CASE("Frozen documents can be read from several threads", "[sedml]")
+{
+    std::string fileName = getTestFile("/test-data/issue_77.sedml");
+    SedDocument* doc = readSedMLFromFile(fileName.c_str());
+    REQUIRE(doc != NULL);
+    doc->getDataGenerator(0)->setNotes(
+      "<p xmlns=\"http://www.w3.org/1999/xhtml\">x</p>");
+
+    SedFrozenDocument* frozen = doc->freeze();
+    const SedDocument* copy = frozen->getSedDocument();
+    REQUIRE(copy != NULL);
+    CHECK(copy != doc);
+
+    CHECK(frozen->getElementBySId("task1") == copy->getTask("task1"));
+    CHECK(frozen->getElementBySId("xVariable1_1") != NULL);
+    CHECK(frozen->getElementBySId("missing") == NULL);
+    CHECK(frozen->getNumElementsOfType(SEDML_TASK) == 1);
+    CHECK(frozen->getElementOfType(SEDML_TASK, 0) == copy->getTask("task1"));
+    CHECK(frozen->getElementOfType(SEDML_TASK, 1) == NULL);
+    CHECK(frozen->getNumElementsOfType(SEDML_DATAGENERATOR) ==
+      copy->getNumDataGenerators());
+
+    unsigned int total = 0;
+    for (int type = SEDML_UNKNOWN; type <= SEDML_LIST_OF; ++type)
+    {
+      total += frozen->getNumElementsOfType(type);
+    }
+    CHECK(total == frozen->getNumElements());
+
+    const SedBase* task = frozen->getElementBySId("task1");
+    CHECK(!frozen->getReferenceGraph().getReferencesTo(task).empty());
+
+    // the snapshot does not follow the original
+    doc->getTask("task1")->setId("renamed");
+    CHECK(frozen->getElementBySId("task1") != NULL);
+    CHECK(copy->getTask("task1") != NULL);
+    delete doc;
+
+    const std::string notes = copy->getDataGenerator(0)->getNotesString();
+    std::vector<std::thread> readers;
+    std::vector<int> failures(4, 0);
+    for (size_t t = 0; t < failures.size(); ++t)
+    {
+      readers.push_back(std::thread([&, t]()
+      {
+        for (int i = 0; i < 200; ++i)
+        {
+          if (copy->getElementBySId("xVariable1_1") !=
+              frozen->getElementBySId("xVariable1_1") ||
+              copy->getTask("task1") != task ||
+              copy->getDataGenerator(0)->getNotesString() != notes ||
+              frozen->getReferenceGraph().getReferencesTo(task).empty())
+          {
+            failures[t]++;
+          }
+        }
+      }));
+    }
+    for (size_t t = 0; t < readers.size(); ++t)
+    {
+      readers[t].join();
+    }
+    CHECK(failures == std::vector<int>(4, 0));
+
+    delete frozen;
+}
+
+TEST_CASE("Documents round-trip through the binary format", "[sedml]")
+{
+    const char* files[] = {
+      "/test-data/issue_63.sedml",
+      "/test-data/issue_77.sedml",
+      "/test-data/BIOMD0000000087_fig5.sedml",
+      "/test-data/teusink_experiment-user-3.sedml",
+      "/test-data/sort_surfaces.sedml",
+      "/test-data/line_uses_style.sedml"
+    };
+
+    SedBinaryWriter bw;
+    SedBinaryReader br;
+
+    for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); ++i)
+    {
+      std::string fileName = getTestFile(files[i]);
+      SedDocument* doc = readSedMLFromFile(fileName.c_str());
+      REQUIRE(doc != NULL);
+
+      const std::string xml = writeSedMLToStdString(doc);
+      SedDocument* copy = br.readSedMLFromStdString(
+        bw.writeSedMLToStdString(doc));
+      REQUIRE(copy != NULL);
+      CHECK(copy->getNumErrors(LIBSEDML_SEV_ERROR) == 0);
+      CHECK(writeSedMLToStdString(copy) == xml);
+
+      delete copy;
+      delete doc;
+    }
+
+    // notes held as a tree, an unknown namespace, values and math
+    SedDocument doc(1, 4);
+    XMLNamespaces xmlns(*doc.getNamespaces());
+    xmlns.add("http://example.org/unknown", "ex");
+    doc.setNamespaces(&xmlns);
+    doc.setNotes("<p xmlns=\"http://www.w3.org/1999/xhtml\">binary</p>");
+    REQUIRE(doc.getNotes() != NULL);
+    SedRepeatedTask* task = doc.createRepeatedTask();
+    task->setId("task1");
+    SedVectorRange* range = task->createVectorRange();
+    range->setId("range1");
+    range->setValues(std::vector<double>(1000, 1.0 / 3.0));
+    SedDataGenerator* dg = doc.createDataGenerator();
+    dg->setId("dg1");
+    dg->setMath(SBML_parseL3Formula("time * 2.5e-3 / -7"));
+
+    const std::string xml = writeSedMLToStdString(&doc);
+    CHECK(xml.find("xmlns:ex=\"http://example.org/unknown\"") !=
+      std::string::npos);
+
+    const std::string binaryFile = "binary_round_trip.sedmlb";
+    REQUIRE(writeSedMLToBinaryFile(&doc, binaryFile.c_str()) == 1);
+    SedDocument* copy = readSedMLFromBinaryFile(binaryFile.c_str());
+    std::remove(binaryFile.c_str());
+    REQUIRE(copy != NULL);
+    CHECK(copy->getNumErrors(LIBSEDML_SEV_ERROR) == 0);
+    CHECK(writeSedMLToStdString(copy) == xml);
+    delete copy;
+
+    // truncated or foreign data is reported, not trusted
+    const std::string binary = bw.writeSedMLToStdString(&doc);
+    copy = br.readSedMLFromBuffer(binary.data(), binary.size() / 2);
+    CHECK(copy->getErrorLog()->contains(SedInvalidBinaryFormat));
+    delete copy;
+    copy = br.readSedMLFromStdString(xml);
+    CHECK(copy->getErrorLog()->contains(SedInvalidBinaryFormat));
+    delete copy;
+
+    // parameters nested too deeply to be read back safely
+    SedDocument nested(1, 4);
+    SedAlgorithmParameter* parameter = nested.createAlgorithmParameter();
+    for (int depth = 0; depth < 2000; ++depth)
+    {
+      parameter = parameter->createAlgorithmParameter();
+    }
+    copy = br.readSedMLFromStdString(bw.writeSedMLToStdString(&nested));
+    REQUIRE(copy != NULL);
+    CHECK(copy->getErrorLog()->contains(SedInvalidBinaryFormat));
+    delete copy;
+}
+
+TEST_CASE("Parsed documents are cached by content", "[sedml]")
+{
+    std::string xml;
+    {
+      std::ifstream in(getTestFile("/test-data/issue_63.sedml").c_str());
+      xml.assign((std::istreambuf_iterator<char>(in)),
+                 std::istreambuf_iterator<char>());
+    }
+    REQUIRE(!xml.empty());
+
+    const std::string fileName = "document_cache.sedml";
+    {
+      std::ofstream out(fileName.c_str());
+      out << xml;
+    }
+
+    SedDocumentCache cache;
+    SedDocument* first = cache.readSedMLFromFile(fileName);
+    SedDocument* second = cache.readSedMLFromFile(fileName);
+    REQUIRE(first != NULL);
+    REQUIRE(second != NULL);
+    CHECK(first != second);
+    CHECK(cache.getNumMisses() == 1);
+    CHECK(cache.getNumHits() == 1);
+    CHECK(cache.getNumEntries() == 1);
+    CHECK(cache.getBytes() > 0);
+    const std::string expected = writeSedMLToStdString(first);
+    CHECK(writeSedMLToStdString(second) == expected);
+
+    // changes to a returned document do not reach the cache
+    second->createDataGenerator()->setId("added");
+    delete second;
+    SedDocument* third = cache.readSedMLFromString(xml);
+    CHECK(cache.getNumHits() == 2);
+    CHECK(writeSedMLToStdString(third) == expected);
+    delete third;
+    delete first;
+
+    // changed content is a new entry
+    {
+      std::ofstream out(fileName.c_str());
+      out << xml << "\n";
+    }
+    delete cache.readSedMLFromFile(fileName);
+    CHECK(cache.getNumMisses() == 2);
+    CHECK(cache.getNumEntries() == 2);
+
+    // a second cache finds the documents the first stored on disk
+    cache.setDiskCacheDirectory(".");
+    delete cache.readSedMLFromString(xml + " ");
+    CHECK(cache.getNumMisses() == 3);
+    SedDocumentCache other;
+    other.setDiskCacheDirectory(".");
+    SedDocument* fromDisk = other.readSedMLFromString(xml + " ");
+    CHECK(other.getNumDiskHits() == 1);
+    CHECK(other.getNumMisses() == 0);
+    CHECK(writeSedMLToStdString(fromDisk) == expected);
+    delete fromDisk;
+    std::remove(("./" + SedDocumentCache::getContentKey(xml + " ",
+      SEDML_LOAD_ALL) + ".sedmlb").c_str());
+
+    // a damaged file on disk is ignored and the content parsed again
+    const std::string damaged = "./" + SedDocumentCache::getContentKey(
+      xml + "  ", SEDML_LOAD_ALL) + ".sedmlb";
+    {
+      std::ofstream out(damaged.c_str());
+      out << "not a binary document";
+    }
+    SedDocument* reparsed = other.readSedMLFromString(xml + "  ");
+    REQUIRE(reparsed != NULL);
+    CHECK(other.getNumDiskHits() == 1);
+    CHECK(other.getNumMisses() == 1);
+    CHECK(writeSedMLToStdString(reparsed) == expected);
+    delete reparsed;
+    std::remove(damaged.c_str());
+
+    // nothing fits a tiny budget
+    cache.setMaxBytes(1);
+    CHECK(cache.getNumEntries() == 0);
+    CHECK(cache.getBytes() == 0);
+    CHECK(cache.getNumEvictions() == 3);
+    cache.setMaxBytes(256 * 1024 * 1024);
+    cache.setDiskCacheDirectory("");
+    cache.resetStatistics();
+
+    std::vector<std::thread> readers;
+    std::vector<int> failures(4, 0);
+    for (size_t t = 0; t < failures.size(); ++t)
+    {
+      readers.push_back(std::thread([&, t]() {
+        for (int i = 0; i < 10; ++i)
+        {
+          // the copies share the cached elements while they are used
+          SedDocument* copy = cache.readSedMLFromFile(fileName);
+          if (copy == NULL || writeSedMLToStdString(copy) != expected)
+          {
+            failures[t]++;
+          }
+          else
+          {
+            copy->createDataGenerator()->setId("added");
+          }
+          delete copy;
+        }
+      }));
+    }
+    for (size_t t = 0; t < readers.size(); ++t)
+    {
+      readers[t].join();
+      CHECK(failures[t] == 0);
+    }
+    CHECK(cache.getNumHits() + cache.getNumMisses() == 40);
+    CHECK(cache.getNumEntries() == 1);
+
+    std::remove(fileName.c_str());
+}
+
+TEST_CASE("Repeated tasks expand into iteration plans", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedTask* task = doc.createTask();
+    task->setId("task1");
+
+    // inner: three values, model reset before each
+    SedRepeatedTask* inner = doc.createRepeatedTask();
+    inner->setId("inner");
+    inner->setRangeId("v");
+    inner->setResetModel(true);
+    SedVectorRange* vector = inner->createVectorRange();
+    vector->setId("v");
+    vector->setValues(std::vector<double>({ 1, 2, 3 }));
+    inner->createSubTask()->setTask("task1");
+
+    SedRepeatedTask* outer = doc.createRepeatedTask();
+    outer->setId("outer");
+    outer->setRangeId("u");
+    outer->setConcatenate(true);
+    SedUniformRange* uniform = outer->createUniformRange();
+    uniform->setId("u");
+    uniform->setStart(1);
+    uniform->setEnd(1000);
+    uniform->setNumberOfSteps(3);
+    uniform->setType("log");
+    SedFunctionalRange* functional = outer->createFunctionalRange();
+    functional->setId("f");
+    functional->setRange("u");
+    functional->setMath(SBML_parseL3Formula("piecewise(u * p, u < 50, -1)"));
+    SedParameter* p = functional->createParameter();
+    p->setId("p");
+    p->setValue(2);
+    SedFunctionalRange* dynamic = outer->createFunctionalRange();
+    dynamic->setId("g");
+    dynamic->setMath(SBML_parseL3Formula("x + u"));
+    dynamic->createVariable()->setId("x");
+    SedSetValue* change = outer->createTaskChange();
+    change->setModelReference("model1");
+    change->setTarget("/sbml:sbml/sbml:model/@k1");
+    change->setRange("f");
+    change->setMath(SBML_parseL3Formula("f + 1"));
+    SedSubTask* second = outer->createSubTask();
+    second->setTask("task1");
+    second->setOrder(2);
+    SedSubTask* first = outer->createSubTask();
+    first->setTask("inner");
+    first->setOrder(1);
+
+    SedIterationPlan plan;
+    REQUIRE(plan.build(outer) == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(plan.getNumIterations() == 4);
+    CHECK(plan.getNumSteps() == 16);
+    CHECK(plan.getConcatenate());
+    CHECK(plan.getMasterRangeIndex() == plan.getRangeIndex("u"));
+
+    const double* u = plan.getRangeValues(plan.getRangeIndex("u"));
+    REQUIRE(u != NULL);
+    CHECK(u[0] == 1);
+    CHECK(std::fabs(u[1] - 10) < 1e-12);
+    CHECK(std::fabs(u[2] - 100) < 1e-12);
+    CHECK(u[3] == 1000);
+    const double* f = plan.getRangeValues(plan.getRangeIndex("f"));
+    REQUIRE(f != NULL);
+    CHECK(std::fabs(f[1] - 20) < 1e-12);
+    CHECK(f[2] == -1);
+    CHECK(plan.isRangeDynamic(plan.getRangeIndex("g")));
+    CHECK(plan.getRangeValues(plan.getRangeIndex("g")) == NULL);
+
+    REQUIRE(plan.getNumSetValues() == 1);
+    REQUIRE(plan.getSetValue(0)->values.size() == 4);
+    CHECK(std::fabs(plan.getSetValue(0)->values[1] - 21) < 1e-12);
+
+    REQUIRE(plan.getNumSubTasks() == 2);
+    CHECK(plan.getSubTask(0)->subTask == first);
+    REQUIRE(plan.getSubTask(0)->plan != NULL);
+    CHECK(plan.getSubTask(0)->plan->getResetModel());
+    CHECK(plan.getSubTask(1)->task == task);
+
+    // every step runs task1: three inner iterations, then the outer one
+    SedIterationCursor cursor(&plan);
+    unsigned int steps = 0;
+    while (cursor.next())
+    {
+      CHECK(cursor.getTask() == task);
+      const unsigned int position = steps % 4;
+      CHECK(cursor.getDepth() == (position < 3 ? 2u : 1u));
+      CHECK(cursor.getIteration(0) == steps / 4);
+      CHECK(cursor.getResetModel() == (position < 3));
+      if (position == 0)
+      {
+        // the outer SetValue comes first in each outer iteration
+        REQUIRE(cursor.getNumAssignments() == 1);
+        CHECK(cursor.getAssignment(0)->value ==
+          plan.getSetValue(0)->values[steps / 4]);
+      }
+      else
+      {
+        CHECK(cursor.getNumAssignments() == 0);
+      }
+      ++steps;
+    }
+    CHECK(steps == 16);
+
+    // data ranges have no values until the caller supplies them
+    SedRepeatedTask* data = doc.createRepeatedTask();
+    data->setId("data");
+    data->setRangeId("d");
+    data->createDataRange()->setId("d");
+    data->createSubTask()->setTask("task1");
+    SedIterationPlan dataPlan(data);
+    CHECK(dataPlan.getNumIterations() == 0);
+    CHECK(dataPlan.setRangeValues("d", std::vector<double>(5, 0.5)) ==
+      LIBSEDML_OPERATION_SUCCESS);
+    CHECK(dataPlan.getNumSteps() == 5);
+
+    // a repeated task that contains itself is reported
+    SedRepeatedTask* loop = doc.createRepeatedTask();
+    loop->setId("loop");
+    loop->setRangeId("d");
+    loop->createDataRange()->setId("d");
+    loop->createSubTask()->setTask("loop");
+    CHECK(SedIterationPlan().build(loop) == LIBSEDML_INVALID_OBJECT);
+}
+
+TEST_CASE("Math compiles into programs evaluated over arrays", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedDataGenerator* dg = doc.createDataGenerator();
+    dg->setId("dg1");
+    dg->createVariable()->setId("x");
+    dg->createVariable()->setId("y");
+    SedParameter* p = dg->createParameter();
+    p->setId("p");
+    p->setValue(3);
+    dg->setMath(SBML_parseL3Formula(
+      "piecewise(x / y * p, x > 500, -x) + sum(y) / max(x) + 2 * 4"));
+
+    const SedCompiledMath* program = dg->getCompiledMath();
+    REQUIRE(program != NULL);
+    REQUIRE(program->isCompiled());
+    CHECK(program->getNumInputs() == 2);
+    CHECK(program->getInputIndex("y") == 1);
+    CHECK(dg->getCompiledMath() == program);
+
+    const size_t length = 1000;
+    std::vector<double> x(length);
+    std::vector<double> y(length);
+    double sum = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+      x[i] = static_cast<double>(i);
+      y[i] = 1.0 + 0.5 * i;
+      sum += y[i];
+    }
+    const double* inputs[] = { x.data(), y.data() };
+    std::vector<double> result(length);
+    REQUIRE(program->evaluate(inputs, length, result.data()) ==
+      LIBSEDML_OPERATION_SUCCESS);
+    for (size_t i = 0; i < length; i += 97)
+    {
+      const double expected = (x[i] > 500 ? x[i] / y[i] * 3 : -x[i]) +
+        sum / (length - 1) + 8;
+      CHECK(std::fabs(result[i] - expected) < 1e-9 * std::fabs(expected));
+    }
+
+    // scalar evaluation, where reductions see a single value
+    const double values[] = { 600, 2 };
+    CHECK(std::fabs(program->evaluate(values) - (900 + 2.0 / 600 + 8)) <
+      1e-9);
+
+    // changes to the math or the parameters produce a new program
+    p->setValue(4);
+    const SedCompiledMath* changed = dg->getCompiledMath();
+    CHECK(std::fabs(changed->evaluate(values) - (1200 + 2.0 / 600 + 8)) <
+      1e-9);
+    dg->setMath(SBML_parseL3Formula("x * y + z"));
+    program = dg->getCompiledMath();
+    CHECK(program->getNumInputs() == 3);
+    CHECK(program->getInputName(2) == "z");
+    CHECK(program->evaluate(inputs, length, result.data()) ==
+      LIBSEDML_INVALID_OBJECT);
+
+    // as do edits made in place and changes to the variables
+    ASTNode* math = dg->getMath();
+    CHECK(dg->getCompiledMath()->getNumInputs() == 3);
+    math->getChild(1)->setName("x");
+    CHECK(dg->getCompiledMath()->getNumInputs() == 2);
+    dg->getVariable(1)->setId("z");
+    CHECK(dg->getCompiledMath()->getInputName(1) == "z");
+    CHECK(dg->getCompiledMath()->getNumInputs() == 3);
+
+    // constants are folded
+    SedCompiledMath folded;
+    REQUIRE(folded.compile(SBML_parseL3Formula("exp(0) * 2 + a"),
+      std::vector<std::string>(1, "a")) == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(folded.getNumInstructions() == 2);
+    const double a = 5;
+    CHECK(folded.evaluate(&a) == 7);
+
+    // functions SED-ML does not define are rejected
+    CHECK(folded.compile(SBML_parseL3Formula("f(a)")) ==
+      LIBSEDML_INVALID_OBJECT);
+    CHECK(!folded.isCompiled());
+}
+
+TEST_CASE("Vectorized kernels agree with the scalar evaluation", "[sedml]")
+{
+    SedCompiledMath program;
+    std::vector<std::string> names;
+    names.push_back("x");
+    names.push_back("y");
+    REQUIRE(program.compile(SBML_parseL3Formula(
+      "piecewise(exp(-x / 10) * y^2.5, x >= y && y > 0, ln(abs(x) + 1)) "
+      "- max(x, y) / (1 + x^2) + sqrt(y) * (x != y)"), names) ==
+      LIBSEDML_OPERATION_SUCCESS);
+
+    // not a multiple of any vector width, with special values mixed in
+    const size_t length = 1003;
+    std::vector<double> x(length);
+    std::vector<double> y(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+      x[i] = std::sin(0.37 * i) * 800.0;
+      y[i] = i % 10 == 0 ? -1.0 : std::cos(0.11 * i) * 50.0 + 40.0;
+    }
+    y[7] = std::numeric_limits<double>::quiet_NaN();
+    x[13] = std::numeric_limits<double>::infinity();
+    const double* inputs[] = { x.data(), y.data() };
+
+    std::vector<std::string> sets = SedCompiledMath::getInstructionSets();
+    REQUIRE(!sets.empty());
+    CHECK(sets.front() == "scalar");
+    CHECK(SedCompiledMath::getInstructionSet() == sets.back());
+    CHECK(SedCompiledMath::setInstructionSet("mmx") ==
+      LIBSEDML_INVALID_ATTRIBUTE_VALUE);
+
+    std::vector<double> expected(length);
+    REQUIRE(SedCompiledMath::setInstructionSet("scalar") ==
+      LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(program.evaluate(inputs, length, expected.data()) ==
+      LIBSEDML_OPERATION_SUCCESS);
+
+    for (size_t s = 1; s < sets.size(); ++s)
+    {
+      REQUIRE(SedCompiledMath::setInstructionSet(sets[s]) ==
+        LIBSEDML_OPERATION_SUCCESS);
+      CHECK(SedCompiledMath::getInstructionSet() == sets[s]);
+
+      std::vector<double> result(length);
+      REQUIRE(program.evaluate(inputs, length, result.data()) ==
+        LIBSEDML_OPERATION_SUCCESS);
+      for (size_t i = 0; i < length; ++i)
+      {
+        if (expected[i] != expected[i])
+        {
+          CHECK(result[i] != result[i]);
+        }
+        else
+        {
+          CHECK(std::fabs(result[i] - expected[i]) <=
+            1e-12 * std::fabs(expected[i]));
+        }
+      }
+    }
+
+    CHECK(SedCompiledMath::setInstructionSet("") ==
+      LIBSEDML_OPERATION_SUCCESS);
+    CHECK(SedCompiledMath::getInstructionSet() == sets.back());
+}
+
+TEST_CASE("Task results are stored in columns", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedDataGenerator* dg = doc.createDataGenerator();
+    dg->setId("dg1");
+    SedVariable* x = dg->createVariable();
+    x->setId("x");
+    x->setTaskReference("task1");
+    x->setTarget("/sbml:sbml/sbml:model/descendant::*[@id='S1']");
+    SedVariable* t = dg->createVariable();
+    t->setId("t");
+    t->setTaskReference("task1");
+    t->setSymbol("urn:sedml:symbol:time");
+    dg->setMath(SBML_parseL3Formula("x + 2 * t"));
+
+    const std::string xKey = SedResultStore::getKey(x);
+    const std::string tKey = SedResultStore::getKey(t);
+    CHECK(tKey == SedResultStore::getKey("task1", "", "urn:sedml:symbol:time"));
+    CHECK(xKey != tKey);
+
+    // the iterations of a concatenating repeated task, written in place
+    SedResultStore store;
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+      double* values = store.appendChunk(xKey, 100);
+      REQUIRE(values != NULL);
+      CHECK(reinterpret_cast<size_t>(values) % 64 == 0);
+      for (int i = 0; i < 100; ++i)
+      {
+        values[i] = iteration * 100 + i;
+      }
+    }
+    for (int i = 0; i < 300; ++i)
+    {
+      const double time = 0.5 * i;
+      REQUIRE(store.append(tKey, &time, 1) == LIBSEDML_OPERATION_SUCCESS);
+    }
+    CHECK(store.getNumColumns() == 2);
+    CHECK(store.getNumChunks(xKey) == 3);
+    CHECK(store.getNumChunks(tKey) == 1);
+    CHECK(store.getLength(xKey) == 300);
+
+    // evaluated chunk by chunk, without merging
+    std::vector<double> result;
+    REQUIRE(store.evaluate(dg, result) == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(result.size() == 300);
+    for (size_t i = 0; i < result.size(); ++i)
+    {
+      CHECK(result[i] == 2.0 * i);
+    }
+    CHECK(store.getNumChunks(xKey) == 3);
+
+    // read-only, the chunks a reduction needs are copied, not merged
+    dg->setMath(SBML_parseL3Formula("x / max(x)"));
+    const SedResultStore& reader = store;
+    REQUIRE(reader.evaluate(dg, result) == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(result[299] == 1.0);
+    CHECK(store.getNumChunks(xKey) == 3);
+
+    // reductions need whole columns
+    REQUIRE(store.evaluate(dg, result) == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(result[299] == 1.0);
+    CHECK(store.getNumChunks(xKey) == 1);
+
+    // the least recently used column goes to disk first
+    store.setMaxBytes(300 * sizeof(double));
+    CHECK(store.isSpilled(tKey));
+    CHECK(!store.isSpilled(xKey));
+    CHECK(store.getBytes() <= store.getMaxBytes());
+    CHECK(store.getSpilledBytes() == 300 * sizeof(double));
+
+    dg->setMath(SBML_parseL3Formula("x + 2 * t"));
+    REQUIRE(store.evaluate(dg, result) == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(result[123] == 246.0);
+
+    // columns of different lengths cannot be combined
+    store.appendChunk(xKey, 10);
+    CHECK(store.evaluate(dg, result) == LIBSEDML_INVALID_OBJECT);
+    CHECK(store.removeColumn(xKey) == LIBSEDML_OPERATION_SUCCESS);
+    CHECK(store.evaluate(dg, result) == LIBSEDML_INVALID_OBJECT);
+
+    store.clear();
+    CHECK(store.getNumColumns() == 0);
+    CHECK(store.getBytes() == 0);
+    CHECK(store.getSpilledBytes() == 0);
+}
+
+TEST_CASE("Documents execute as a dependency graph", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedModel* model = doc.createModel();
+    model->setId("m1");
+    model->setLanguage("urn:sedml:language:sbml");
+    model->setSource("model.xml");
+    SedUniformTimeCourse* sim = doc.createUniformTimeCourse();
+    sim->setId("sim1");
+    sim->setInitialTime(0);
+    sim->setOutputStartTime(0);
+    sim->setOutputEndTime(10);
+    sim->setNumberOfSteps(10);
+
+    // listed before the task it repeats, which has to run first
+    SedRepeatedTask* repeated = doc.createRepeatedTask();
+    repeated->setId("r1");
+    repeated->setRangeId("v");
+    repeated->setConcatenate(true);
+    SedVectorRange* range = repeated->createVectorRange();
+    range->setId("v");
+    range->setValues(std::vector<double>({ 1, 2, 3 }));
+    repeated->createSubTask()->setTask("t1");
+
+    const char* tasks[] = { "t1", "t2", "t3" };
+    for (int i = 0; i < 3; ++i)
+    {
+      SedTask* task = doc.createTask();
+      task->setId(tasks[i]);
+      task->setModelReference("m1");
+      task->setSimulationReference("sim1");
+
+      SedDataGenerator* dg = doc.createDataGenerator();
+      dg->setId(std::string("dg_") + tasks[i]);
+      SedVariable* x = dg->createVariable();
+      x->setId("x");
+      x->setTaskReference(tasks[i]);
+      x->setTarget("/sbml:sbml/sbml:model/descendant::*[@id='S1']");
+      SedVariable* time = dg->createVariable();
+      time->setId("time");
+      time->setTaskReference(tasks[i]);
+      time->setSymbol("urn:sedml:symbol:time");
+      dg->setMath(SBML_parseL3Formula("x + time"));
+    }
+
+    SedDataGenerator* scan = doc.createDataGenerator();
+    scan->setId("dg_r1");
+    SedVariable* y = scan->createVariable();
+    y->setId("y");
+    y->setTaskReference("r1");
+    y->setTarget("/sbml:sbml/sbml:model/descendant::*[@id='S1']");
+    scan->setMath(SBML_parseL3Formula("y"));
+
+    SedReport* report = doc.createReport();
+    report->setId("report");
+    for (int i = 0; i < 3; ++i)
+    {
+      SedDataSet* set = report->createDataSet();
+      set->setId(std::string("ds_") + tasks[i]);
+      set->setLabel(tasks[i]);
+      set->setDataReference(std::string("dg_") + tasks[i]);
+    }
+    SedPlot2D* plot = doc.createPlot2D();
+    plot->setId("plot");
+    SedCurve* curve = plot->createCurve();
+    curve->setId("c1");
+    curve->setXDataReference("dg_t1");
+    curve->setYDataReference("dg_r1");
+
+    SedExecutionPlan plan;
+    REQUIRE(plan.build(&doc) == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(plan.getNumNodes() == 11);
+    CHECK(plan.getNode(0) == model);
+    CHECK(plan.getNodeIndex(doc.getTask("t1")) == 1);
+    CHECK(plan.getNodeIndex(repeated) == 2);
+    CHECK(plan.getNodeIndex(plot) == 10);
+    CHECK(plan.getNodeIndex(curve) == -1);
+
+    const unsigned int r1 = plan.getNodeIndex(repeated);
+    REQUIRE(plan.getNumDependencies(r1) == 1);
+    CHECK(plan.getDependency(r1, 0) == 1);
+    CHECK(plan.getNumDependents(0) == 3);
+    CHECK(plan.getNumDependencies(plan.getNodeIndex(report)) == 3);
+    CHECK(plan.getNumDependencies(plan.getNodeIndex(plot)) == 2);
+    CHECK(plan.getVariables(1).size() == 2);
+    REQUIRE(plan.getVariables(r1).size() == 1);
+    CHECK(plan.getVariables(r1)[0] == y);
+    CHECK(plan.getVariables(0).empty());
+
+    SedStubSimulator simulator;
+    simulator.setRunTime(20);
+    SedScheduler scheduler(4);
+    CHECK(scheduler.getNumThreads() == 4);
+
+    SedResultStore results;
+    REQUIRE(scheduler.run(plan, simulator, results) ==
+      LIBSEDML_OPERATION_SUCCESS);
+    CHECK(simulator.getNumModelsLoaded() == 1);
+    CHECK(simulator.getNumRuns() == 6);
+    CHECK(simulator.getNumOutputsWritten() == 2);
+    CHECK(simulator.getMaxConcurrentRuns() >= 2);
+
+    for (int i = 0; i < 3; ++i)
+    {
+      const std::vector<double>* values =
+        scheduler.getDataGeneratorValues(std::string("dg_") + tasks[i]);
+      REQUIRE(values != NULL);
+      REQUIRE(values->size() == 11);
+      for (size_t j = 0; j < values->size(); ++j)
+      {
+        CHECK((*values)[j] == 2.0 * j);
+      }
+    }
+
+    // one chunk per iteration, the values of iteration i shifted by i
+    const std::string key = SedResultStore::getKey(y);
+    CHECK(results.getLength(key) == 33);
+    CHECK(results.getNumChunks(key) == 3);
+    const std::vector<double>* values =
+      scheduler.getDataGeneratorValues("dg_r1");
+    REQUIRE(values != NULL);
+    REQUIRE(values->size() == 33);
+    CHECK((*values)[0] == 0);
+    CHECK((*values)[12] == 2);
+    CHECK((*values)[32] == 12);
+    CHECK(scheduler.getDataGeneratorValues("missing") == NULL);
+
+    // data generators read the results at the same time
+    const SedResultStore& shared = results;
+    const SedDataGenerator* overlapping[] =
+      { doc.getDataGenerator("dg_t2"), scan };
+    std::atomic<int> started(0);
+    std::vector<std::thread> readers;
+    std::vector<int> failures(2, 0);
+    for (size_t t = 0; t < failures.size(); ++t)
+    {
+      readers.push_back(std::thread([&, t]() {
+        const std::vector<double>* expected =
+          scheduler.getDataGeneratorValues(overlapping[t]->getId());
+        ++started;
+        while (started < 2)
+        {
+          std::this_thread::yield();
+        }
+        for (int i = 0; i < 200; ++i)
+        {
+          std::vector<double> computed;
+          if (shared.evaluate(overlapping[t], computed) !=
+                LIBSEDML_OPERATION_SUCCESS || computed != *expected)
+          {
+            failures[t]++;
+          }
+        }
+      }));
+    }
+    for (size_t t = 0; t < readers.size(); ++t)
+    {
+      readers[t].join();
+    }
+    CHECK(failures == std::vector<int>(2, 0));
+    CHECK(results.getNumChunks(key) == 3);
+
+    // a data generator without results fails, and its output is skipped
+    SedDataGenerator* broken = doc.createDataGenerator();
+    broken->setId("dg_broken");
+    SedVariable* z = broken->createVariable();
+    z->setId("z");
+    z->setModelReference("m1");
+    z->setTarget("/sbml:sbml/sbml:model/descendant::*[@id='S2']");
+    broken->setMath(SBML_parseL3Formula("z"));
+    SedReport* skipped = doc.createReport();
+    skipped->setId("skipped");
+    skipped->createDataSet()->setDataReference("dg_broken");
+
+    REQUIRE(plan.build(&doc) == LIBSEDML_OPERATION_SUCCESS);
+    simulator.resetCounters();
+    SedResultStore more;
+    CHECK(scheduler.run(plan, simulator, more) ==
+      LIBSEDML_OPERATION_FAILED);
+    CHECK(scheduler.getNodeStatus(plan.getNodeIndex(broken)) ==
+      LIBSEDML_INVALID_OBJECT);
+    CHECK(scheduler.getNodeStatus(plan.getNodeIndex(skipped)) ==
+      LIBSEDML_INVALID_OBJECT);
+    CHECK(scheduler.getNodeStatus(plan.getNodeIndex(plot)) ==
+      LIBSEDML_OPERATION_SUCCESS);
+    CHECK(simulator.getNumOutputsWritten() == 2);
+    CHECK(scheduler.getDataGeneratorValues("dg_broken") == NULL);
+
+    // repeated tasks running each other cannot be ordered
+    SedRepeatedTask* loop = doc.createRepeatedTask();
+    loop->setId("r2");
+    loop->setRangeId("w");
+    SedVectorRange* values2 = loop->createVectorRange();
+    values2->setId("w");
+    values2->setValues(std::vector<double>({ 1 }));
+    loop->createSubTask()->setTask("r1");
+    repeated->createSubTask()->setTask("r2");
+
+    CHECK(plan.build(&doc) == LIBSEDML_INVALID_OBJECT);
+    CHECK(plan.getNumNodes() == 0);
+    CHECK(plan.getSedDocument() == NULL);
+}